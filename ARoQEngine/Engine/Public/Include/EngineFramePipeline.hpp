@@ -0,0 +1,185 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   EngineFramePipeline.hpp
+///             @brief  Frame pipeline between the update stage and the render stage.
+///                     The update stage writes the render snapshot of frame N+1
+///                     while the render stage records and submits frame N from its own snapshot.
+///             How To: Update thread : snapshot = BeginUpdate(); (update and write snapshot); EndUpdate();
+///                     Render thread : snapshot = BeginRender(); (record and submit); EndRender();
+///                     SingleThread mode calls both stages in order on the main thread.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef ENGINE_FRAME_PIPELINE_HPP
+#define ENGINE_FRAME_PIPELINE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "EngineRenderSnapshot.hpp"
+#include "GameUtility/Base/Include/GUClassUtility.hpp"
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace engine::setting
+{
+	/****************************************************************************
+	*				  			FramePipelineMode
+	*************************************************************************//**
+	*  @enum      FramePipelineMode
+	*  @brief     How the update stage and the render stage are executed
+	*****************************************************************************/
+	enum class FramePipelineMode : gu::uint8
+	{
+		SingleThread, // update -> render on the main thread (deterministic, no render thread)
+		Pipelined,    // render on the render thread, overlapped with the next update up to MaxFrameLatency
+	};
+
+	struct FramePipelineSettings
+	{
+		FramePipelineMode Mode = FramePipelineMode::Pipelined;
+
+		/* @brief : Frames the update can run ahead of the finished render (0 : update and render alternate, max : 2)*/
+		gu::uint32 MaxFrameLatency = 1;
+	};
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace engine::core
+{
+	/****************************************************************************
+	*				  			FramePipeline
+	*************************************************************************//**
+	*  @class     FramePipeline
+	*  @brief     Ring of the render snapshots shared by one update thread and one render thread.
+	*             Frame N uses the snapshot N % SNAPSHOT_COUNT. The update of frame N waits until
+	*             the render of frame N - 1 - MaxFrameLatency has finished, so the snapshot is never
+	*             written while it is read, and the render of frame N waits until the update of frame N has finished.
+	*****************************************************************************/
+	class FramePipeline : public gu::NonCopyable
+	{
+	public:
+		/****************************************************************************
+		**                Static Configuration
+		*****************************************************************************/
+		static constexpr gu::uint32 MAX_FRAME_LATENCY = 2;
+
+		static constexpr gu::uint32 SNAPSHOT_COUNT = MAX_FRAME_LATENCY + 1;
+
+		/****************************************************************************
+		**                Public Struct
+		*****************************************************************************/
+		/*----------------------------------------------------------------------
+		*  @brief : Stage times accumulated since the construction or the last ResetStatistics (microseconds)
+		/*----------------------------------------------------------------------*/
+		struct Statistics
+		{
+			gu::uint64 FrameCount             = 0; // rendered frames
+			gu::uint64 ElapsedMicroseconds    = 0;
+			gu::uint64 UpdateMicroseconds     = 0; // time between BeginUpdate and EndUpdate
+			gu::uint64 RenderMicroseconds     = 0; // time between BeginRender and EndRender
+			gu::uint64 UpdateWaitMicroseconds = 0; // update stage blocked by the frame latency
+			gu::uint64 RenderWaitMicroseconds = 0; // render stage blocked by the update
+			gu::uint64 GPUWaitMicroseconds    = 0; // part of the render stage blocked by the GPU fence
+			gu::uint32 ThreadCount            = 1;
+
+			double GetAverageFrameMicroseconds() const noexcept
+			{
+				return FrameCount == 0 ? 0.0 : static_cast<double>(ElapsedMicroseconds) / static_cast<double>(FrameCount);
+			}
+
+			/* @brief : CPU busy time of the stages / (elapsed time * stage thread count) [0, 1]*/
+			double GetCPUUtilization() const noexcept
+			{
+				if (ElapsedMicroseconds == 0) { return 0.0; }
+				const auto busy = UpdateMicroseconds + RenderMicroseconds - (GPUWaitMicroseconds < RenderMicroseconds ? GPUWaitMicroseconds : RenderMicroseconds);
+				return static_cast<double>(busy) / (static_cast<double>(ElapsedMicroseconds) * ThreadCount);
+			}
+		};
+
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Wait for the free snapshot and return it cleared. nullptr after Stop.*/
+		RenderSnapshot* BeginUpdate();
+
+		/* @brief : Publish the snapshot to the render stage*/
+		void EndUpdate();
+
+		/* @brief : Wait for the next published snapshot. nullptr after Stop.*/
+		const RenderSnapshot* BeginRender();
+
+		/* @brief : Release the snapshot to the update stage*/
+		void EndRender();
+
+		/* @brief : Wait until all published frames are rendered.
+		            Call on the update stage before changing the state the render stage reads (scene transition etc.)*/
+		void Flush();
+
+		/* @brief : Wake up the waiting stages. The Begin functions return nullptr after this call.*/
+		void Stop();
+
+		/* @brief : Called by the render stage with the time blocked by the GPU fence*/
+		void AddGPUWaitMicroseconds(const gu::uint64 microseconds);
+
+		Statistics GetStatistics() const;
+
+		void ResetStatistics();
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		setting::FramePipelineMode GetMode() const noexcept { return _mode; }
+
+		bool IsPipelined() const noexcept { return _mode == setting::FramePipelineMode::Pipelined; }
+
+		/* @brief : Clamped to [0, MAX_FRAME_LATENCY]. Takes effect from the next BeginUpdate.*/
+		void SetMaxFrameLatency(const gu::uint32 latency) noexcept;
+
+		gu::uint32 GetMaxFrameLatency() const noexcept { return _maxFrameLatency.load(); }
+
+		bool IsStopped() const;
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		FramePipeline() : FramePipeline(setting::FramePipelineSettings()) {};
+
+		explicit FramePipeline(const setting::FramePipelineSettings& settings);
+
+		~FramePipeline();
+
+	protected:
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		RenderSnapshot _snapshots[SNAPSHOT_COUNT] = {};
+
+		setting::FramePipelineMode _mode = setting::FramePipelineMode::Pipelined;
+
+		std::atomic<gu::uint32> _maxFrameLatency = 1;
+
+		mutable std::mutex      _mutex             = {};
+		std::condition_variable _conditionVariable = {};
+
+		/* @brief : Last frame whose update / render has finished (guarded by _mutex)*/
+		gu::uint64 _publishedFrame = 0;
+		gu::uint64 _renderedFrame  = 0;
+
+		bool _isStopped = false;
+
+		/* @brief : Start time of the current stage (only touched by the stage thread)*/
+		gu::uint64 _updateBeginTime = 0;
+		gu::uint64 _renderBeginTime = 0;
+
+		gu::uint64 _statisticsBeginTime = 0;
+		Statistics _statistics          = {};
+	};
+}
+#endif
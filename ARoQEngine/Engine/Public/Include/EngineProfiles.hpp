@@ -14,6 +14,7 @@
 #include "Platform/Core/Include/CoreWindow.hpp"
 #include "Platform/Core/Include/CorePlatformCommand.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHICommonState.hpp"
+#include "EngineFramePipeline.hpp"
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
@@ -33,6 +34,7 @@ namespace engine::setting
 	{
 		platform::core::CoreWindowDesc WindowSettings = {};
 		GraphicsSettings GraphicsSettings = {};
+		FramePipelineSettings FramePipelineSettings = {};
 	};
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,136 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   EngineRenderSnapshot.hpp
+///             @brief  Render data written by the update stage and read by the render stage.
+///                     The frame pipeline owns the snapshots in the ring, so the update of the next frame
+///                     can write its snapshot while the render thread is still reading the previous one.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef ENGINE_RENDER_SNAPSHOT_HPP
+#define ENGINE_RENDER_SNAPSHOT_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Rendering/Light/Include/LightType.hpp"
+#include "GameCore/Rendering/UI/Public/Include/UIImage.hpp"
+#include "GameUtility/Base/Include/GUSmartPointer.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+#include "GameUtility/Math/Include/GMMatrix.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::core
+{
+	class GPUResourceView;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace engine::core
+{
+	/****************************************************************************
+	*				  			CameraSnapshot
+	*************************************************************************//**
+	*  @struct    CameraSnapshot
+	*  @brief     Camera state of the frame
+	*****************************************************************************/
+	struct CameraSnapshot
+	{
+		gm::Float4x4 View        = gm::Float4x4();
+		gm::Float4x4 Projection  = gm::Float4x4();
+		gm::Float3   EyePosition = { 0.0f, 0.0f, 0.0f };
+		float        NearZ       = 0.0f;
+		float        FarZ        = 0.0f;
+	};
+
+	/****************************************************************************
+	*				  			UIDrawList
+	*************************************************************************//**
+	*  @struct    UIDrawList
+	*  @brief     UI rects of the frame. The render stage passes the ranges to UIRenderer::AddFrameVertices.
+	*****************************************************************************/
+	struct UIDrawList
+	{
+		using ResourceViewPtr = gu::SharedPointer<rhi::core::GPUResourceView>;
+
+		struct Range
+		{
+			ResourceViewPtr View       = nullptr;
+			gu::uint32      ImageStart = 0; // first rect index in Vertices
+			gu::uint32      ImageCount = 0;
+			gu::uint32      Layer      = 0;
+		};
+
+		/* @brief : 4 vertices per rect*/
+		gu::DynamicArray<gm::Vertex> Vertices = {};
+
+		gu::DynamicArray<Range> Ranges = {};
+
+		/* @brief : Copy the vertices of the images*/
+		void AddImages(const gu::DynamicArray<gc::ui::Image>& images, const ResourceViewPtr& view, const gu::uint32 layer = 0)
+		{
+			if (images.IsEmpty()) { return; }
+
+			Ranges.Push({ view, static_cast<gu::uint32>(Vertices.Size() / 4), static_cast<gu::uint32>(images.Size()), layer });
+			for (const auto& image : images)
+			{
+				const auto vertices = image.GetVertices();
+				for (gu::uint32 i = 0; i < 4; ++i) { Vertices.Push(vertices[i]); }
+			}
+		}
+
+		/* @brief : Keep the capacity*/
+		void Clear()
+		{
+			Vertices.Clear();
+			Ranges  .Clear();
+		}
+	};
+
+	/****************************************************************************
+	*				  			RenderSnapshot
+	*************************************************************************//**
+	*  @struct    RenderSnapshot
+	*  @brief     Everything the render stage reads from the game state.
+	*             The arrays are cleared (not released) at the start of each update,
+	*             so the steady state does not allocate.
+	*             Transforms is indexed by the scene (the scene decides which object uses which index).
+	*****************************************************************************/
+	struct RenderSnapshot
+	{
+		/* @brief : Frame number assigned by the frame pipeline (starts with 1)*/
+		gu::uint64 FrameIndex = 0;
+
+		float DeltaTime = 0.0f;
+		float TotalTime = 0.0f;
+
+		CameraSnapshot Camera = {};
+
+		/* @brief : World matrices of the drawn objects*/
+		gu::DynamicArray<gm::Float4x4> Transforms = {};
+
+		gu::DynamicArray<gc::rendering::DirectionalLightData> DirectionalLights = {};
+		gu::DynamicArray<gc::rendering::PointLightData>       PointLights       = {};
+		gu::DynamicArray<gc::rendering::SpotLightData>        SpotLights        = {};
+
+		UIDrawList UI = {};
+
+		void Clear()
+		{
+			FrameIndex = 0;
+			DeltaTime  = 0.0f;
+			TotalTime  = 0.0f;
+			Camera     = {};
+			Transforms       .Clear();
+			DirectionalLights.Clear();
+			PointLights      .Clear();
+			SpotLights       .Clear();
+			UI               .Clear();
+		}
+	};
+}
+#endif
@@ -48,6 +48,7 @@ protected:
 	using CoreWindowPtr             = gu::SharedPointer<platform::core::CoreWindow>;
 	using PlatformCommandPtr        = gu::SharedPointer<platform::core::PlatformCommand>;
 	using EngineThreadManagerPtr    = gu::SharedPointer<engine::core::EngineThreadManager>;
+	using FramePipelinePtr          = gu::SharedPointer<engine::core::FramePipeline>;
 	using GameTimerPtr              = gu::SharedPointer<GameTimer>;
 	using LowLevelGraphicsEnginePtr = gu::SharedPointer<LowLevelGraphicsEngine>;
 	using RenderPipelinePtr         = gu::SharedPointer<gc::IRenderPipeline>;
@@ -81,6 +82,9 @@ public:
 
 	RenderPipelinePtr GetRenderPipeline() const noexcept { return _renderPipeline; }
 
+	/* @brief : XVXe[Wƕ`Xe[W̎󂯓nsNX*/
+	FramePipelinePtr GetFramePipeline() const noexcept { return _framePipeline; }
+
 	void SetRenderingPipeline(const RenderPipelinePtr& pipeline) { _renderPipeline = pipeline; }
 
 	/****************************************************************************
@@ -94,6 +98,11 @@ protected:
 	/****************************************************************************
 	**                Protected Function
 	*****************************************************************************/
+	/* @brief : 1t[̃Q[XVs, `p̃XibvVbg𔭍s܂*/
+	void ExecuteUpdateStage();
+
+	/* @brief : sς݂̃XibvVbg1t[`悵܂. ~falseԂ܂*/
+	bool ExecuteRenderStage();
 
 	/****************************************************************************
 	**                Protected Member Variables
@@ -115,6 +124,9 @@ protected:
 	/* @brief : GW̃XbhǗNX*/
 	EngineThreadManagerPtr _engineThreadManager = nullptr;
 
+	/* @brief : XVXe[Wƕ`Xe[W̊Ԃ̃XibvVbg̃O*/
+	FramePipelinePtr _framePipeline = nullptr;
+
 	/* @brief : SẴXbh~vs*/
 	std::atomic_bool _isStoppedAllThreads = false;
 
@@ -0,0 +1,238 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   EngineFramePipeline.cpp
+///             @brief  Frame pipeline between the update stage and the render stage
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "Engine/Public/Include/EngineFramePipeline.hpp"
+#include "GameUtility/Base/Include/GUProfiler.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace engine;
+using namespace engine::core;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+FramePipeline::FramePipeline(const setting::FramePipelineSettings& settings)
+	: _mode(settings.Mode)
+{
+	SetMaxFrameLatency(settings.MaxFrameLatency);
+	ResetStatistics();
+}
+
+FramePipeline::~FramePipeline()
+{
+	Stop();
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Main Function
+/****************************************************************************
+*                     BeginUpdate
+*************************************************************************//**
+*  @fn        RenderSnapshot* FramePipeline::BeginUpdate()
+*
+*  @brief     Wait until the render of frame N - 1 - MaxFrameLatency has finished
+*             and return the cleared snapshot of frame N.
+*             In the single thread mode the previous render has always finished, so this does not wait.
+*
+*  @param[in] void
+*
+*  @return    RenderSnapshot* (nullptr after Stop)
+*****************************************************************************/
+RenderSnapshot* FramePipeline::BeginUpdate()
+{
+	const auto waitBeginTime = gu::Profiler::GetClockMicroseconds();
+
+	std::unique_lock<std::mutex> lock(_mutex);
+
+	const auto frame   = _publishedFrame + 1;
+	const auto latency = static_cast<gu::uint64>(_maxFrameLatency.load());
+	_conditionVariable.wait(lock, [&]() { return _isStopped || frame <= _renderedFrame + 1 + latency; });
+
+	if (_isStopped) { return nullptr; }
+
+	_updateBeginTime = gu::Profiler::GetClockMicroseconds();
+	_statistics.UpdateWaitMicroseconds += _updateBeginTime - waitBeginTime;
+
+	auto& snapshot = _snapshots[frame % SNAPSHOT_COUNT];
+	lock.unlock();
+
+	// The render stage does not read this slot until EndUpdate
+	snapshot.Clear();
+	snapshot.FrameIndex = frame;
+	return &snapshot;
+}
+
+/****************************************************************************
+*                     EndUpdate
+*************************************************************************//**
+*  @fn        void FramePipeline::EndUpdate()
+*
+*  @brief     Publish the snapshot written after BeginUpdate to the render stage
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
+void FramePipeline::EndUpdate()
+{
+	const auto endTime = gu::Profiler::GetClockMicroseconds();
+	{
+		std::scoped_lock lock(_mutex);
+		_publishedFrame++;
+		_statistics.UpdateMicroseconds += endTime - _updateBeginTime;
+	}
+	_conditionVariable.notify_all();
+}
+
+/****************************************************************************
+*                     BeginRender
+*************************************************************************//**
+*  @fn        const RenderSnapshot* FramePipeline::BeginRender()
+*
+*  @brief     Wait until the update of the next frame has been published and return its snapshot
+*
+*  @param[in] void
+*
+*  @return    const RenderSnapshot* (nullptr after Stop)
+*****************************************************************************/
+const RenderSnapshot* FramePipeline::BeginRender()
+{
+	const auto waitBeginTime = gu::Profiler::GetClockMicroseconds();
+
+	std::unique_lock<std::mutex> lock(_mutex);
+
+	const auto frame = _renderedFrame + 1;
+	_conditionVariable.wait(lock, [&]() { return _isStopped || frame <= _publishedFrame; });
+
+	if (_isStopped) { return nullptr; }
+
+	_renderBeginTime = gu::Profiler::GetClockMicroseconds();
+	_statistics.RenderWaitMicroseconds += _renderBeginTime - waitBeginTime;
+
+	return &_snapshots[frame % SNAPSHOT_COUNT];
+}
+
+/****************************************************************************
+*                     EndRender
+*************************************************************************//**
+*  @fn        void FramePipeline::EndRender()
+*
+*  @brief     Release the snapshot of the rendered frame to the update stage
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
+void FramePipeline::EndRender()
+{
+	const auto endTime = gu::Profiler::GetClockMicroseconds();
+	{
+		std::scoped_lock lock(_mutex);
+		_renderedFrame++;
+		_statistics.RenderMicroseconds += endTime - _renderBeginTime;
+		_statistics.FrameCount++;
+	}
+	_conditionVariable.notify_all();
+}
+
+/****************************************************************************
+*                     Flush
+*************************************************************************//**
+*  @fn        void FramePipeline::Flush()
+*
+*  @brief     Wait until all published frames are rendered.
+*             Call on the update stage. The frame being updated is not published yet, so this does not deadlock.
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
+void FramePipeline::Flush()
+{
+	const auto waitBeginTime = gu::Profiler::GetClockMicroseconds();
+
+	std::unique_lock<std::mutex> lock(_mutex);
+	_conditionVariable.wait(lock, [&]() { return _isStopped || _publishedFrame <= _renderedFrame; });
+
+	_statistics.UpdateWaitMicroseconds += gu::Profiler::GetClockMicroseconds() - waitBeginTime;
+}
+
+/****************************************************************************
+*                     Stop
+*************************************************************************//**
+*  @fn        void FramePipeline::Stop()
+*
+*  @brief     Wake up the waiting stages. The Begin functions return nullptr after this call.
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
+void FramePipeline::Stop()
+{
+	{
+		std::scoped_lock lock(_mutex);
+		_isStopped = true;
+	}
+	_conditionVariable.notify_all();
+}
+
+void FramePipeline::AddGPUWaitMicroseconds(const gu::uint64 microseconds)
+{
+	std::scoped_lock lock(_mutex);
+	_statistics.GPUWaitMicroseconds += microseconds;
+}
+
+/****************************************************************************
+*                     GetStatistics
+*************************************************************************//**
+*  @fn        FramePipeline::Statistics FramePipeline::GetStatistics() const
+*
+*  @brief     Return the stage times accumulated since the construction or the last ResetStatistics
+*
+*  @param[in] void
+*
+*  @return    Statistics
+*****************************************************************************/
+FramePipeline::Statistics FramePipeline::GetStatistics() const
+{
+	std::scoped_lock lock(_mutex);
+
+	auto statistics = _statistics;
+	statistics.ElapsedMicroseconds = gu::Profiler::GetClockMicroseconds() - _statisticsBeginTime;
+	return statistics;
+}
+
+void FramePipeline::ResetStatistics()
+{
+	std::scoped_lock lock(_mutex);
+
+	_statistics             = {};
+	_statistics.ThreadCount = IsPipelined() ? 2 : 1;
+	_statisticsBeginTime    = gu::Profiler::GetClockMicroseconds();
+}
+#pragma endregion Main Function
+
+#pragma region Property
+void FramePipeline::SetMaxFrameLatency(const gu::uint32 latency) noexcept
+{
+	_maxFrameLatency.store(latency < MAX_FRAME_LATENCY ? latency : MAX_FRAME_LATENCY);
+	_conditionVariable.notify_all();
+}
+
+bool FramePipeline::IsStopped() const
+{
+	std::scoped_lock lock(_mutex);
+	return _isStopped;
+}
+#pragma endregion Property
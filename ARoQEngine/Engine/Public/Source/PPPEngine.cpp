@@ -26,6 +26,7 @@
 // timer
 #include "GameUtility/Base/Include/GameTimer.hpp"
 #include "GameUtility/Base/Include/GUAssert.hpp"
+#include "GameUtility/Base/Include/GUProfiler.hpp"
 
 #include "MainGame/Core/Include/GameManager.hpp"
 #include "MainGame/Core/Include/SceneManager.hpp"
@@ -91,6 +92,10 @@ void PPPEngine::StartUp(const StartUpParameters& setting)
 	-----------------------------------------------------------------*/
 	GameInput::Instance().Initialize(_platformApplication->GetInstanceHandle(), _mainWindow->GetWindowHandle());
 
+	/*---------------------------------------------------------------
+					  XVƕ`̃t[pCvC̍쐬
+	-----------------------------------------------------------------*/
+	_framePipeline = gu::MakeShared<FramePipeline>(StartUpParameter.FramePipelineSettings);
 }
 
 void PPPEngine::Run()
@@ -132,26 +137,39 @@ void PPPEngine::ExecuteMainThread()
 			{
 				_mainThreadTimer->AverageFrame(_mainWindow->GetWindowHandle());
 				GameInput::Instance().Update();
-				// VOXbh.
-				GameManager::Instance().GameUpdateMain();
+
+				ExecuteUpdateStage();
+
+				// VOXbh̏ꍇ͍XVɓXbhŕ`悷
+				if (!_framePipeline->IsPipelined()) { ExecuteRenderStage(); }
 			}
 		}
 
 	}
 	_isStoppedAllThreads.store(true);
 
+	// ҋ@̕`Xe[WN
+	_framePipeline->Stop();
+
 	// SẴXbhɑ΂s҂
 	_engineThreadManager->ShutDown();
 
 }
 
+/****************************************************************************
+*                     ExecuteUpdateThread
+*************************************************************************//**
+*  @fn        void PPPEngine::ExecuteUpdateThread()
+*
+*  @brief     Q[̍XV̓CXbhōs (͂ƃbZ[W[vXbhłKv), 
+*             ł͂Ɋʒm܂.
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
 void PPPEngine::ExecuteUpdateThread()
 {
-	while (!_isStoppedAllThreads)
-	{
-		
-	}
-
 	_engineThreadManager->CallExecuteComplete(ThreadPoolType::UpdateMain);
 	printf("update finish\n");
 }
@@ -172,27 +190,75 @@ void PPPEngine::ExecuteRenderThread()
 	/*---------------------------------------------------------------
 					  `惋[v
 	-----------------------------------------------------------------*/
-	while (!_isStoppedAllThreads)
+	// VOXbh̏ꍇ̓CXbhŕ`悷邽, Ȃ
+	if (_framePipeline->IsPipelined())
 	{
-		// Jn : R}hobt@Openɂ
-		_graphicsEngine->BeginDrawFrame();
+		while (ExecuteRenderStage()) {}
+	}
+
+	_engineThreadManager->CallExecuteComplete(ThreadPoolType::RenderMain);
+	printf("draw finish\n");
+}
+
+/****************************************************************************
+*                     ExecuteUpdateStage
+*************************************************************************//**
+*  @fn        void PPPEngine::ExecuteUpdateStage()
+*
+*  @brief     1t[̃Q[XVs, `Xe[WփXibvVbg𔭍s܂.
+*             XibvVbggȂV[͕`撆GPU\[X邽, Ot[̕`抮҂ĂXV܂.
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
+void PPPEngine::ExecuteUpdateStage()
+{
+	if (!GameManager::Instance().UseRenderSnapshot()) { _framePipeline->Flush(); }
 
-		// `惋[vOɃEBhETCYύXĂ炷Ƀobt@ςĂ.
-		_graphicsEngine->OnResize(Screen::GetScreenWidth(), Screen::GetScreenHeight());
+	const auto snapshot = _framePipeline->BeginUpdate();
+	if (!snapshot) { return; }
 
-		// _[pX̐ݒ
-		_graphicsEngine->BeginSwapchainRenderPass();
-		
-		// V[̕`
-		GameManager::Instance().GameDrawMain();
+	GameManager::Instance().GameUpdateMain(*snapshot);
 
-		// I, `R}hs
-		_graphicsEngine->EndDrawFrame();
-	}
+	_framePipeline->EndUpdate();
+}
+
+/****************************************************************************
+*                     ExecuteRenderStage
+*************************************************************************//**
+*  @fn        bool PPPEngine::ExecuteRenderStage()
+*
+*  @brief     sς݂̃XibvVbg1t[`悵܂.
+*
+*  @param[in] void
+*
+*  @return    bool (false : t[pCvC~)
+*****************************************************************************/
+bool PPPEngine::ExecuteRenderStage()
+{
+	const auto snapshot = _framePipeline->BeginRender();
+	if (!snapshot) { return false; }
 
+	// Jn : R}hobt@Openɂ (GPŨtFX҂܂)
+	const auto gpuWaitBeginTime = gu::Profiler::GetClockMicroseconds();
+	_graphicsEngine->BeginDrawFrame();
+	_framePipeline->AddGPUWaitMicroseconds(gu::Profiler::GetClockMicroseconds() - gpuWaitBeginTime);
 
-	_engineThreadManager->CallExecuteComplete(ThreadPoolType::RenderMain);
-	printf("draw finish\n");
+	// `惋[vOɃEBhETCYύXĂ炷Ƀobt@ςĂ.
+	_graphicsEngine->OnResize(Screen::GetScreenWidth(), Screen::GetScreenHeight());
+
+	// _[pX̐ݒ
+	_graphicsEngine->BeginSwapchainRenderPass();
+
+	// V[̕`
+	GameManager::Instance().GameDrawMain(*snapshot);
+
+	// I, `R}hs
+	_graphicsEngine->EndDrawFrame();
+
+	_framePipeline->EndRender();
+	return true;
 }
 
 void PPPEngine::ShutDown()
@@ -200,7 +266,9 @@ void PPPEngine::ShutDown()
 	if (_hasShutdown) { return; }
 
 	// Xbh̔j
+	if (_framePipeline) { _framePipeline->Stop(); }
 	_engineThreadManager.Reset();
+	_framePipeline.Reset();
 
 	// ̓foCX̔j
 	GameInput::Instance().Finalize();
@@ -12,6 +12,7 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include "GameUtility/Base/Include/GUClassUtility.hpp"
+#include "GameUtility/Base/Include/GUName.hpp"
 #include <string>
 #include <memory>
 #include "GameUtility/Container/Include/GUSortedMap.hpp"
@@ -66,7 +67,8 @@ namespace gc::audio
 		/****************************************************************************
 		**                Protected Member Variables
 		*****************************************************************************/
-		gu::SortedMap<std::uint64_t, AudioClipPtr> _audioClipList = {};
+		// key : interned file path
+		gu::SortedMap<gu::Name, AudioClipPtr> _audioClipList = {};
 
 	};
 }
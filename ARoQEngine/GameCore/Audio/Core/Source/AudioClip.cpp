@@ -10,6 +10,7 @@
 #include "GameCore/Audio/Core/Include/AudioClip.hpp"
 #include "GameCore/Audio/Private/Include/WavDecoder.hpp"
 #include "GameUtility/File/Include/FileSystem.hpp"
+#include "GameUtility/Memory/Include/GUMemoryTracker.hpp"
 #include <memory>
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -42,6 +43,8 @@ AudioClip::~AudioClip()
 *****************************************************************************/
 bool AudioClip::Load(const std::wstring& filePath)
 {
+	GU_MEMORY_TAG_SCOPE(gu::MemoryTag::Audio);
+
 	/*-------------------------------------------------------------------
 	-    Select the appropriate sound loading function for each extension
 	---------------------------------------------------------------------*/
@@ -10,7 +10,6 @@
 //////////////////////////////////////////////////////////////////////////////////
 #include "GameCore/Audio/Core/Include/AudioClipCache.hpp"
 #include "GameCore/Audio/Core/Include/AudioClip.hpp"
-#include <functional>
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
@@ -46,16 +45,16 @@ AudioClipCache::~AudioClipCache()
 AudioClipCache::AudioClipPtr AudioClipCache::Load(const std::wstring& filePath)
 {
 	/*-------------------------------------------------------------------
-	-           Get hash code
+	-           Get interned key
 	---------------------------------------------------------------------*/
-	size_t hashCode = std::hash<std::wstring>()(filePath);
+	const gu::Name key(filePath.c_str(), filePath.size());
 
 	/*-------------------------------------------------------------------
 	-           Load audio clip
 	---------------------------------------------------------------------*/
-	if (_audioClipList.Contains(hashCode))
+	if (_audioClipList.Contains(key))
 	{
-		return _audioClipList.At(hashCode);
+		return _audioClipList.At(key);
 	}
 	else
 	{
@@ -65,8 +64,8 @@ AudioClipCache::AudioClipPtr AudioClipCache::Load(const std::wstring& filePath)
 		if (!audioClip->Load(filePath)) { OutputDebugStringA("Failed to load sound file.");  return nullptr; };
 
 		// regist audio clip to the audioClipList;
-		_audioClipList[hashCode] = std::move(audioClip);
-		return _audioClipList[hashCode];
+		_audioClipList[key] = std::move(audioClip);
+		return _audioClipList[key];
 	}
 }
 
@@ -84,10 +83,10 @@ AudioClipCache::AudioClipPtr AudioClipCache::Load(const std::wstring& filePath)
 bool AudioClipCache::Exist(const std::wstring& filePath)
 {
 	/*-------------------------------------------------------------------
-	-           Get hash code
+	-           Get interned key (the path which has never been registered is not loaded)
 	---------------------------------------------------------------------*/
-	size_t hashCode = std::hash<std::wstring>()(filePath);
+	const gu::Name key = gu::Name::Find(filePath.c_str(), filePath.size());
 
-	return _audioClipList.Contains(hashCode);
+	return !key.IsNone() && _audioClipList.Contains(key);
 }
 #pragma endregion Main Function
\ No newline at end of file
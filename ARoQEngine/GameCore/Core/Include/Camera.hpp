@@ -19,6 +19,7 @@
 //////////////////////////////////////////////////////////////////////////////////
 class GameTimer;
 class LowLevelGraphicsEngine;
+class FrameConstantBuffer;
 namespace rhi::core
 {
 	class GPUBuffer;
@@ -94,7 +95,7 @@ namespace gc
 		};
 
 		using LowLevelGraphicsEnginePtr = gu::SharedPointer<LowLevelGraphicsEngine>;
-		using SceneConstantBufferPtr    = gu::SharedPointer<rhi::core::GPUBuffer>;
+		using SceneConstantBufferPtr    = gu::SharedPointer<FrameConstantBuffer>;
 		using GPUResourceViewPtr        = gu::SharedPointer<rhi::core::GPUResourceView>;
 		using GameTimerPtr              = gu::SharedPointer<GameTimer>;
 
@@ -14,7 +14,9 @@
 #include "GameUtility/Base/Include/GUClassUtility.hpp"
 #include "GameUtility/Math/Include/GMTransform.hpp"
 #include "GameUtility/Base/Include/GUString.hpp"
+#include "GameUtility/Base/Include/GUName.hpp"
 #include "GameUtility/Container/Include/GUDynamicArray.hpp"
+#include "GameUtility/Container/Include/GUSmallArray.hpp"
 #include "GameUtility/Base/Include/GUSmartPointer.hpp"
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -64,10 +66,10 @@ namespace gc::core
 		-                       Find
 		---------------------------------------------------------------------*/
 		/* @brief : Obtain a gameObject matching the name*/
-		static GameObjectPtr Find(const gu::tstring& name);
+		static GameObjectPtr Find(const gu::Name& name);
 
 		/* @brief : This function returns the gameobject list with the same tag as the assign tag.*/
-		static gu::DynamicArray<GameObjectPtr> GameObjectsWithTag(const gu::tstring& tag);
+		static gu::DynamicArray<GameObjectPtr> GameObjectsWithTag(const gu::Name& tag);
 
 		/*-------------------------------------------------------------------
 		-               Destroy and Clear
@@ -79,7 +81,7 @@ namespace gc::core
 		static void DestroyWithChildren(GameObjectPtr& parent);
 
 		/* @brief : destroy all objects have the tag*/
-		static void DestroyAllTagObjects(const gu::tstring& tag);
+		static void DestroyAllTagObjects(const gu::Name& tag);
 
 		/* @brief : Clear all game objects*/
 		static void ClearAllGameObjects();
@@ -128,19 +130,19 @@ namespace gc::core
 		/*-------------------------------------------------------------------
 		-               GameObject Default Infomation
 		---------------------------------------------------------------------*/
-		inline gu::tstring GetName() const { return _name; }
+		inline const gu::Name& GetName() const { return _name; }
 
-		inline gu::tstring GetTag() const { return _tag; }
+		inline const gu::Name& GetTag() const { return _tag; }
 
-		inline gu::tstring GetLayerName() const { return LayerList[_layer]; }
+		gu::Name GetLayerName() const;
 
 		inline ObjectType GetType() const { return _type; }
 
-		inline void SetName(const gu::tstring& name) { _name = name; }
+		inline void SetName(const gu::Name& name) { _name = name; }
 
-		inline void SetTag(const gu::tstring& name) { _tag = name; }
+		inline void SetTag(const gu::Name& name) { _tag = name; }
 
-		inline void SetLayer(const gu::tstring& name) { int bit = GetLayerBit(name); if (bit >= 0) { _layer = (1 << bit); } }
+		inline void SetLayer(const gu::Name& name) { int bit = GetLayerBit(name); if (bit >= 0) { _layer = (1 << bit); } }
 
 
 		/*-------------------------------------------------------------------
@@ -173,9 +175,9 @@ namespace gc::core
 		/*-------------------------------------------------------------------
 		-           gameObject default info
 		---------------------------------------------------------------------*/
-		gu::tstring _name = SP(""); // object name
+		gu::Name _name = {}; // object name (interned)
 
-		gu::tstring _tag  = SP(""); // object tag
+		gu::Name _tag  = {}; // object tag  (interned)
 
 		int          _layer = 0;
 
@@ -198,19 +200,19 @@ namespace gc::core
 
 		LowLevelGraphicsEnginePtr _engine = nullptr;
 
-		gu::DynamicArray<GameObjectPtr> _children = {};
+		gu::SmallArray<GameObjectPtr, 4> _children = {};
 		
 	private:
 		/****************************************************************************
 		**                Private Function
 		*****************************************************************************/
-		int GetLayerBit(const gu::tstring& layer);
+		int GetLayerBit(const gu::Name& layer) const;
 
 		/****************************************************************************
 		**                Private Member Variables
 		*****************************************************************************/
 		static gu::DynamicArray<GameObjectPtr> GameObjects;
-		static gu::DynamicArray<gu::tstring>  LayerList;
+		static gu::DynamicArray<gu::Name>  LayerList;
 	};
 }
 #endif
\ No newline at end of file
@@ -20,6 +20,7 @@
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
 class LowLevelGraphicsEngine;
+class FrameConstantBuffer;
 
 namespace rhi::core
 {
@@ -44,12 +45,13 @@ namespace gc::core
 	*************************************************************************//**
 	*  @class     GameWorldInfo
 	*  @brief     GameWorld constant buffer (This class can be used for both individual drawings and instancing drawings. )
-	*             When you would like to change the contents in the buffer, you should use GetBuffer function.
+	*             When you would like to change the contents in the buffer, you should use Update function.
+	*             The constants are placed in the per-frame upload ring, so Update can be called every frame.
 	*****************************************************************************/
 	class GameWorldInfo : public gu::NonCopyable
 	{
 		using LowLevelGraphicsEnginePtr = gu::SharedPointer<LowLevelGraphicsEngine>;
-		using ConstantBufferPtr         = gu::SharedPointer<rhi::core::GPUBuffer>;
+		using ConstantBufferPtr         = gu::SharedPointer<FrameConstantBuffer>;
 		using ConstantBufferViewPtr     = gu::SharedPointer<rhi::core::GPUResourceView>;
 		using GraphicsCommandListPtr    = gu::SharedPointer<rhi::core::RHICommandList>;
 
@@ -60,13 +62,16 @@ namespace gc::core
 		/* @brief : Bind constant buffer view. index : root descriptor table id.*/
 		void Bind(const GraphicsCommandListPtr& commandList, const std::uint32_t index);
 
+		/* @brief : Write the game world constants. instanceCount + firstInstance must be less than or equal to max instance count.*/
+		void Update(const GameWorldConstant* constants, const std::uint64_t instanceCount = 1, const std::uint64_t firstInstance = 0);
+
 		/****************************************************************************
 		**                Public Member Variables
 		*****************************************************************************/
 		/* @brief : Return max instance count for instance drawing. */
 		std::uint64_t GetMaxInsntanceCount() const { return _maxInstanceCount; }
 
-		/* @brief : Return gpu buffer pointer*/
+		/* @brief : Return constant buffer in the per-frame upload ring*/
 		ConstantBufferPtr GetBuffer() const noexcept { return _gameWorldConstants; }
 
 		/* @brief: Return constant buffer view including the Game world constants.*/
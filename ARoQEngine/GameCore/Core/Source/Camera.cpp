@@ -52,10 +52,9 @@ Camera::Camera(const LowLevelGraphicsEnginePtr& engine) : _engine(engine), _type
 	/*-------------------------------------------------------------------
 	-               Create scece constant buffer and view
 	---------------------------------------------------------------------*/
-	GPUBufferMetaData metaData = GPUBufferMetaData::ConstantBuffer(sizeof(SceneConstants), 1);
-	_sceneConstantBuffer = device->CreateBuffer(metaData, SP("SceneConstants"));
-
-	_resourceView = device->CreateResourceView(ResourceViewType::ConstantBuffer, _sceneConstantBuffer, 0,0,nullptr);
+	// t[XV邽, t[Ƃ̃Abv[hOɔzu
+	_sceneConstantBuffer = gu::MakeShared<FrameConstantBuffer>(_engine->GetFrameUploadAllocator(), device, sizeof(SceneConstants));
+	_resourceView        = _sceneConstantBuffer->GetView();
 }
 
 Camera::Camera(const LowLevelGraphicsEnginePtr& engine, const PerspectiveInfo& info)
@@ -73,10 +72,9 @@ Camera::Camera(const LowLevelGraphicsEnginePtr& engine, const PerspectiveInfo& i
 	/*-------------------------------------------------------------------
 	-               Create scece constant buffer and view
 	---------------------------------------------------------------------*/
-	GPUBufferMetaData metaData = GPUBufferMetaData::ConstantBuffer(sizeof(SceneConstants), 1);
-	_sceneConstantBuffer = device->CreateBuffer(metaData, L"SceneConstants");
-
-	_resourceView = device->CreateResourceView(ResourceViewType::ConstantBuffer, _sceneConstantBuffer,0,0, nullptr);
+	// t[XV邽, t[Ƃ̃Abv[hOɔzu
+	_sceneConstantBuffer = gu::MakeShared<FrameConstantBuffer>(_engine->GetFrameUploadAllocator(), device, sizeof(SceneConstants));
+	_resourceView        = _sceneConstantBuffer->GetView();
 
 }
 
@@ -95,10 +93,9 @@ Camera::Camera(const LowLevelGraphicsEnginePtr& engine, const OrthographicInfo&
 	/*-------------------------------------------------------------------
 	-               Create scece constant buffer and view
 	---------------------------------------------------------------------*/
-	GPUBufferMetaData metaData = GPUBufferMetaData::ConstantBuffer(sizeof(SceneConstants), 1);
-	_sceneConstantBuffer = device->CreateBuffer(metaData, L"SceneConstants");
-
-	_resourceView = device->CreateResourceView(ResourceViewType::ConstantBuffer, _sceneConstantBuffer, 0,0,nullptr);
+	// t[XV邽, t[Ƃ̃Abv[hOɔzu
+	_sceneConstantBuffer = gu::MakeShared<FrameConstantBuffer>(_engine->GetFrameUploadAllocator(), device, sizeof(SceneConstants));
+	_resourceView        = _sceneConstantBuffer->GetView();
 }
 
 #pragma endregion Constructor and Destructor
@@ -638,6 +635,6 @@ void Camera::UpdateSceneConstants(const GameTimerPtr& gameTimer)
 	scene.TotalTime               = gameTimer->TotalTime();
 	scene.DeltaTime               = gameTimer->DeltaTime();
 
-	_sceneConstantBuffer->Pack(&scene, nullptr); 
+	_sceneConstantBuffer->SetData(&scene, sizeof(SceneConstants));
 }
 #pragma endregion Protected Function
\ No newline at end of file
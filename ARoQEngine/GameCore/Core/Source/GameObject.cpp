@@ -24,14 +24,14 @@ static constexpr int INVALID_VALUE = -1;
 namespace gc::core
 {
 	gu::DynamicArray<GameObject::GameObjectPtr> GameObject::GameObjects = {};
-	gu::DynamicArray<gu::tstring> GameObject::LayerList = {};
+	gu::DynamicArray<gu::Name> GameObject::LayerList = {};
 }
 
 #pragma region Constructor and Destructor 
 GameObject::GameObject(const LowLevelGraphicsEnginePtr& engine) : _engine(engine)
 {
-	_tag     = L"";
-	_name    = L"";
+	_tag     = gu::Name();
+	_name    = gu::Name();
 	_isActive = true;
 	_parent = nullptr;
 
@@ -49,15 +49,16 @@ GameObject::~GameObject()
 /****************************************************************************
 *                          Find
 *************************************************************************//**
-*  @fn        GameObject* GameObject::Find(const gu::string& name)
+*  @fn        GameObject* GameObject::Find(const gu::Name& name)
 * 
 *  @brief     This function returns the gameObject with the same name as the assign name.
+*             (The interned names are compared by the index)
 * 
-*  @param[in] gu::string name
+*  @param[in] const gu::Name& name
 * 
 *  @return @@GameObject*
 *****************************************************************************/
-GameObject::GameObjectPtr GameObject::Find(const gu::tstring& name)
+GameObject::GameObjectPtr GameObject::Find(const gu::Name& name)
 {
 	for (auto it = GameObjects.begin(); it != GameObjects.end(); ++it)
 	{
@@ -72,15 +73,15 @@ GameObject::GameObjectPtr GameObject::Find(const gu::tstring& name)
 /****************************************************************************
 *                          GameObjectsWithTag
 *************************************************************************//**
-*  @fn        gu::DynamicArray<GameObject*> GameObject::GameObjectsWithTag(const gu::string& tag)
+*  @fn        gu::DynamicArray<GameObject*> GameObject::GameObjectsWithTag(const gu::Name& tag)
 * 
 *  @brief     This function returns the gameObject list with the same tag as the assign tag.
 * 
-*  @param[in] gu::string tag
+*  @param[in] const gu::Name& tag
 * 
 *  @return @@gu::DynamicArray<GameObject*>
 *****************************************************************************/
-gu::DynamicArray<GameObject::GameObjectPtr> GameObject::GameObjectsWithTag(const gu::tstring& tag)
+gu::DynamicArray<GameObject::GameObjectPtr> GameObject::GameObjectsWithTag(const gu::Name& tag)
 {
 	gu::DynamicArray<GameObjectPtr> gameObjects = {};
 
@@ -123,15 +124,15 @@ bool GameObject::Destroy(GameObjectPtr& gameObject)
 /****************************************************************************
 *                          DestroyAllTagObject
 *************************************************************************//**
-*  @fn        void GameObject::DestroyAllTagObject(const gu::string& tag)
+*  @fn        void GameObject::DestroyAllTagObject(const gu::Name& tag)
 * 
 *  @brief     This function destroys all objects with the tag
 * 
-*  @param[in] gu::string tag
+*  @param[in] const gu::Name& tag
 * 
 *  @return @@void
 *****************************************************************************/
-void GameObject::DestroyAllTagObjects(const gu::tstring& tag)
+void GameObject::DestroyAllTagObjects(const gu::Name& tag)
 {
 	gu::uint64 findCount = 0;
 
@@ -280,11 +281,35 @@ void GameObject::ClearAllGameObjects()
 //	}
 //}
 #pragma endregion Component
+#pragma region Layer
+/****************************************************************************
+*                          GetLayerName
+*************************************************************************//**
+*  @fn        gu::Name GameObject::GetLayerName() const
+*
+*  @brief     Return the layer name of the layer bit.
+*
+*  @param[in] void
+*
+*  @return @@gu::Name (None if the layer is not set)
+*****************************************************************************/
+gu::Name GameObject::GetLayerName() const
+{
+	for (int i = 0; i < 31 && i < static_cast<int>(LayerList.Size()); ++i)
+	{
+		if (_layer == (1 << i)) { return LayerList[i]; }
+	}
+	return gu::Name();
+}
+#pragma endregion Layer
+
 #pragma region Private Function
-int gc::core::GameObject::GetLayerBit(const gu::tstring& layer)
+int gc::core::GameObject::GetLayerBit(const gu::Name& layer) const
 {
-	if (layer == L"") { return INVALID_VALUE; }
-	for (int i = 0; i < 31; ++i) // 4byte
+	if (layer.IsNone()) { return INVALID_VALUE; }
+
+	const int layerCount = LayerList.Size() < 31 ? static_cast<int>(LayerList.Size()) : 31; // 4byte
+	for (int i = 0; i < layerCount; ++i)
 	{
 		if (LayerList[i] == layer)
 		{
@@ -36,10 +36,10 @@ GameWorldInfo::GameWorldInfo(const LowLevelGraphicsEnginePtr& engine, const std:
 	-            Prepare constant and upload buffer
 	---------------------------------------------------------------------*/
 	const GameWorldConstant world = { .World = gm::Float4x4()};
-	const auto bufferInfo = GPUBufferMetaData::ConstantBuffer(sizeof(GameWorldConstant), maxInstanceCount, MemoryHeap::Upload, ResourceState::Common, (void*)&world);
 	
-	_gameWorldConstants = device->CreateBuffer(bufferInfo);
-	_resourceView       = device->CreateResourceView(ResourceViewType::ConstantBuffer, _gameWorldConstants);
+	_gameWorldConstants = gu::MakeShared<FrameConstantBuffer>(_engine->GetFrameUploadAllocator(), device, sizeof(GameWorldConstant), maxInstanceCount);
+	_gameWorldConstants->SetData(&world, sizeof(GameWorldConstant));
+	_resourceView       = _gameWorldConstants->GetView();
 
 }
 
@@ -57,4 +57,12 @@ void GameWorldInfo::Bind(const GraphicsCommandListPtr& commandList, const std::u
 {
 	_resourceView->Bind(commandList, index);
 }
+
+void GameWorldInfo::Update(const GameWorldConstant* constants, const std::uint64_t instanceCount, const std::uint64_t firstInstance)
+{
+#ifdef _DEBUG
+	Check(firstInstance + instanceCount <= _maxInstanceCount);
+#endif
+	_gameWorldConstants->SetElements(constants, instanceCount, firstInstance);
+}
 #pragma endregion Main Function
\ No newline at end of file
@@ -0,0 +1,197 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   BitStream.hpp
+///             @brief  Bit packed writer and reader for the state replication.
+///                     Ranged integer, quantized float and smallest three quaternion
+///                     are written with the minimum bit count.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef BIT_STREAM_HPP
+#define BIT_STREAM_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/Math/Include/GMVector.hpp"
+#include "GameUtility/Math/Include/GMQuaternion.hpp"
+#include <vector>
+#include <cstdint>
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gc
+{
+	/****************************************************************************
+	*				  			 BitPacking
+	*************************************************************************//**
+	*  @class     BitPacking
+	*  @brief     Shared quantization rule of the BitWriter and the BitReader
+	*****************************************************************************/
+	class BitPacking
+	{
+	public:
+		/* @brief : Default bit count per component of the smallest three quaternion*/
+		static constexpr std::uint32_t DEFAULT_QUATERNION_BITS = 10;
+
+		/* @brief : Return the bit count required to express [0, range]*/
+		static std::uint32_t RequiredBits(const std::uint32_t range);
+
+		/* @brief : Return the bit count required to express [min, max] with the resolution step*/
+		static std::uint32_t RequiredBits(const float min, const float max, const float resolution);
+
+		/* @brief : float -> integer step in [0, 2^bitCount - 1]*/
+		static std::uint32_t QuantizeFloat(const float value, const float min, const float max, const std::uint32_t bitCount);
+
+		/* @brief : integer step -> float*/
+		static float DequantizeFloat(const std::uint32_t value, const float min, const float max, const std::uint32_t bitCount);
+
+		BitPacking() = delete;
+	};
+
+	/****************************************************************************
+	*				  			 BitWriter
+	*************************************************************************//**
+	*  @class     BitWriter
+	*  @brief     Write values with the arbitrary bit count.
+	*             The byte order of the wire format is always little endian (independent of the host).
+	*****************************************************************************/
+	class BitWriter
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Write the lower bitCount bits of the value. (bitCount : 1 - 32)*/
+		void WriteBits(const std::uint32_t value, const std::uint32_t bitCount);
+
+		/* @brief : Write 1 bit*/
+		void WriteBool(const bool value) { WriteBits(value ? 1 : 0, 1); }
+
+		/* @brief : Write integer in [min, max] with the minimum bit count*/
+		void WriteRangedInteger(const std::int32_t value, const std::int32_t min, const std::int32_t max);
+
+		/* @brief : Write float in [min, max] quantized by resolution*/
+		void WriteQuantizedFloat(const float value, const float min, const float max, const float resolution);
+
+		/* @brief : Write float in [min, max] quantized to bitCount bits*/
+		void WriteQuantizedFloatBits(const float value, const float min, const float max, const std::uint32_t bitCount);
+
+		/* @brief : Write float3 in [min, max] quantized by resolution (each component)*/
+		void WriteQuantizedFloat3(const gm::Float3& value, const float min, const float max, const float resolution);
+
+		/* @brief : Write normalized quaternion by the smallest three encoding (2 + 3 * bitsPerComponent bits)*/
+		void WriteQuaternion(const gm::QuaternionF& quaternion, const std::uint32_t bitsPerComponent = BitPacking::DEFAULT_QUATERNION_BITS);
+
+		/* @brief : Write full 32 bit float without quantization*/
+		void WriteFloat(const float value);
+
+		/* @brief : Pad zero bits up to the next byte boundary*/
+		void AlignToByte();
+
+		/* @brief : Flush the bits remaining in the scratch register to the buffer. Call before GetBuffer*/
+		void Flush();
+
+		/* @brief : Clear buffer and scratch*/
+		void Clear();
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		const std::vector<std::uint8_t>& GetBuffer() const { return _buffer; }
+
+		std::uint64_t GetBitCount() const { return _bitCount; }
+
+		std::uint64_t GetByteCount() const { return (_bitCount + 7) / 8; }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		BitWriter() = default;
+
+		explicit BitWriter(const std::uint64_t reserveByteSize) { _buffer.reserve(reserveByteSize); }
+
+		~BitWriter() = default;
+
+	protected:
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		std::vector<std::uint8_t> _buffer = {};
+
+		// pending bits which have not been flushed to the buffer yet (lower bits first)
+		std::uint64_t _scratch     = 0;
+		std::uint32_t _scratchBits = 0;
+
+		// total written bits
+		std::uint64_t _bitCount = 0;
+	};
+
+	/****************************************************************************
+	*				  			 BitReader
+	*************************************************************************//**
+	*  @class     BitReader
+	*  @brief     Read values written by BitWriter. The reader does not copy the source buffer.
+	*             Reading past the end of the buffer throws std::runtime_error.
+	*****************************************************************************/
+	class BitReader
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Read bitCount bits (bitCount : 1 - 32)*/
+		std::uint32_t ReadBits(const std::uint32_t bitCount);
+
+		bool ReadBool() { return ReadBits(1) != 0; }
+
+		std::int32_t ReadRangedInteger(const std::int32_t min, const std::int32_t max);
+
+		float ReadQuantizedFloat(const float min, const float max, const float resolution);
+
+		float ReadQuantizedFloatBits(const float min, const float max, const std::uint32_t bitCount);
+
+		gm::Float3 ReadQuantizedFloat3(const float min, const float max, const float resolution);
+
+		gm::QuaternionF ReadQuaternion(const std::uint32_t bitsPerComponent = BitPacking::DEFAULT_QUATERNION_BITS);
+
+		float ReadFloat();
+
+		/* @brief : Skip bits up to the next byte boundary*/
+		void AlignToByte();
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		std::uint64_t GetReadBitCount() const { return _bitPosition; }
+
+		std::uint64_t GetRemainingBitCount() const { return _bitSize - _bitPosition; }
+
+		bool DoneRead() const { return _bitPosition >= _bitSize; }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		BitReader(const std::uint8_t* data, const std::uint64_t byteSize)
+			: _data(data), _bitSize(byteSize * 8) {};
+
+		explicit BitReader(const std::vector<std::uint8_t>& buffer)
+			: _data(buffer.data()), _bitSize(buffer.size() * 8) {};
+
+		~BitReader() = default;
+
+	protected:
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		const std::uint8_t* _data = nullptr;
+
+		std::uint64_t _bitSize     = 0;
+		std::uint64_t _bitPosition = 0;
+	};
+}
+#endif
@@ -0,0 +1,306 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   SnapshotSerializer.hpp
+///             @brief  Delta compressed snapshot for the state replication.
+///                     ReplicationSchema    : describe the replicated fields of the entity state struct
+///                     ReplicationSnapshot  : entity states of one network tick
+///                     SnapshotHistory      : sent snapshots waiting for the acknowledgement
+///                     SnapshotSerializer   : encode / decode the snapshot against the acknowledged baseline
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef SNAPSHOT_SERIALIZER_HPP
+#define SNAPSHOT_SERIALIZER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "BitStream.hpp"
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <type_traits>
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gc
+{
+	/****************************************************************************
+	*				  			 ReplicatedFieldType
+	*************************************************************************//**
+	*  @enum      ReplicatedFieldType
+	*  @brief     Memory layout of the field and the way to encode it
+	*****************************************************************************/
+	enum class ReplicatedFieldType : std::uint8_t
+	{
+		Bool,            // bool             : 1 bit
+		RangedInteger,   // std::int32_t     : bits of (max - min)
+		QuantizedFloat,  // float            : bits of (max - min) / resolution
+		QuantizedFloat3, // gm::Float3       : 3 * bits of (max - min) / resolution
+		Quaternion,      // gm::Float4 (x, y, z, w) : 2 + 3 * bitCount (smallest three)
+		Float,           // float            : 32 bit
+	};
+
+	/****************************************************************************
+	*				  			 ReplicatedField
+	*************************************************************************//**
+	*  @struct    ReplicatedField
+	*  @brief     One replicated member of the entity state
+	*****************************************************************************/
+	struct ReplicatedField
+	{
+		std::string         Name       = "";
+		ReplicatedFieldType Type       = ReplicatedFieldType::Bool;
+		std::uint32_t       ByteOffset = 0;     // offset from the head of the state struct
+		std::uint32_t       BitCount   = 0;     // encoded bit count per component
+		std::int32_t        IntegerMin = 0;
+		std::int32_t        IntegerMax = 0;
+		float               FloatMin   = 0.0f;
+		float               FloatMax   = 0.0f;
+	};
+
+	/****************************************************************************
+	*				  			 ReplicationSchema
+	*************************************************************************//**
+	*  @class     ReplicationSchema
+	*  @brief     Description of the replicated fields.
+	*             The state struct must be trivially copyable.
+	*             A state struct can describe itself with the reflection hook
+	*             (static void DescribeReplication(ReplicationSchema&)) and be created by ReplicationSchema::Create<T>().
+	*
+	*             struct TransformState
+	*             {
+	*                 gm::Float3      Position;
+	*                 gm::Float4      Rotation; // quaternion (x, y, z, w)
+	*                 static void DescribeReplication(gc::ReplicationSchema& schema)
+	*                 {
+	*                     schema.AddQuantizedFloat3("Position", offsetof(TransformState, Position), -512.0f, 512.0f, 0.01f);
+	*                     schema.AddQuaternion     ("Rotation", offsetof(TransformState, Rotation));
+	*                 }
+	*             };
+	*****************************************************************************/
+	class ReplicationSchema
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Create the schema from the state struct which has DescribeReplication*/
+		template<class StateType> requires requires(ReplicationSchema& schema) { StateType::DescribeReplication(schema); }
+		static ReplicationSchema Create()
+		{
+			static_assert(std::is_trivially_copyable_v<StateType>, "replicated state must be trivially copyable");
+
+			ReplicationSchema schema(static_cast<std::uint32_t>(sizeof(StateType)));
+			StateType::DescribeReplication(schema);
+			return schema;
+		}
+
+		ReplicationSchema& AddBool           (const std::string& name, const std::size_t byteOffset);
+
+		ReplicationSchema& AddRangedInteger  (const std::string& name, const std::size_t byteOffset, const std::int32_t min, const std::int32_t max);
+
+		ReplicationSchema& AddQuantizedFloat (const std::string& name, const std::size_t byteOffset, const float min, const float max, const float resolution);
+
+		ReplicationSchema& AddQuantizedFloat3(const std::string& name, const std::size_t byteOffset, const float min, const float max, const float resolution);
+
+		ReplicationSchema& AddQuaternion     (const std::string& name, const std::size_t byteOffset, const std::uint32_t bitsPerComponent = BitPacking::DEFAULT_QUATERNION_BITS);
+
+		ReplicationSchema& AddFloat          (const std::string& name, const std::size_t byteOffset);
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		const std::vector<ReplicatedField>& GetFields() const { return _fields; }
+
+		std::uint32_t GetStateByteSize() const { return _stateByteSize; }
+
+		/* @brief : Bit count of all fields (the entity is sent without the baseline)*/
+		std::uint64_t GetFullStateBitCount() const;
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		ReplicationSchema() = default;
+
+		explicit ReplicationSchema(const std::uint32_t stateByteSize) : _stateByteSize(stateByteSize) {};
+
+		~ReplicationSchema() = default;
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+		ReplicationSchema& AddField(ReplicatedField&& field, const std::size_t fieldByteSize);
+
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		std::vector<ReplicatedField> _fields = {};
+
+		std::uint32_t _stateByteSize = 0;
+	};
+
+	/****************************************************************************
+	*				  			 ReplicationSnapshot
+	*************************************************************************//**
+	*  @class     ReplicationSnapshot
+	*  @brief     Entity states of one network tick.
+	*             The states are stored in one contiguous byte array (stride = schema state byte size)
+	*             and the entity ids are kept in ascending order.
+	*****************************************************************************/
+	class ReplicationSnapshot
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Add (or overwrite) the entity state*/
+		void SetEntity(const std::uint32_t entityID, const void* state);
+
+		/* @brief : Return nullptr if the entity does not exist*/
+		const std::uint8_t* FindState(const std::uint32_t entityID) const;
+
+		void Clear() { _entityIDs.clear(); _states.clear(); }
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		std::uint32_t GetSequence() const { return _sequence; }
+
+		void SetSequence(const std::uint32_t sequence) { _sequence = sequence; }
+
+		std::uint32_t GetEntityCount() const { return static_cast<std::uint32_t>(_entityIDs.size()); }
+
+		std::uint32_t GetEntityID(const std::uint32_t index) const { return _entityIDs[index]; }
+
+		const std::uint8_t* GetState(const std::uint32_t index) const { return &_states[static_cast<std::size_t>(index) * _stride]; }
+
+		std::uint32_t GetStride() const { return _stride; }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		ReplicationSnapshot() = default;
+
+		ReplicationSnapshot(const ReplicationSchema& schema, const std::uint32_t sequence = 0)
+			: _stride(schema.GetStateByteSize()), _sequence(sequence) {};
+
+	protected:
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		std::vector<std::uint32_t> _entityIDs = {};
+
+		std::vector<std::uint8_t> _states = {};
+
+		std::uint32_t _stride   = 0;
+
+		std::uint32_t _sequence = 0;
+	};
+
+	/****************************************************************************
+	*				  			 SnapshotHistory
+	*************************************************************************//**
+	*  @class     SnapshotHistory
+	*  @brief     Ring buffer of the sent snapshots.
+	*             When the receiver acknowledges a sequence, that snapshot becomes the delta baseline.
+	*****************************************************************************/
+	class SnapshotHistory
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Store the sent snapshot*/
+		void Push(const ReplicationSnapshot& snapshot);
+
+		/* @brief : The receiver has received the sequence. Old sequence is ignored.*/
+		void Acknowledge(const std::uint32_t sequence);
+
+		/* @brief : Return nullptr if the snapshot has already been overwritten*/
+		const ReplicationSnapshot* Find(const std::uint32_t sequence) const;
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		/* @brief : Latest acknowledged snapshot. nullptr means the full state must be sent.*/
+		const ReplicationSnapshot* GetBaseline() const { return _hasAcknowledged ? Find(_acknowledgedSequence) : nullptr; }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		explicit SnapshotHistory(const std::uint32_t capacity = 64) : _snapshots(capacity), _isValid(capacity, false) {};
+
+	protected:
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		std::vector<ReplicationSnapshot> _snapshots = {};
+
+		std::vector<bool> _isValid = {};
+
+		std::uint32_t _acknowledgedSequence = 0;
+
+		bool _hasAcknowledged = false;
+	};
+
+	/****************************************************************************
+	*				  			 SnapshotSerializer
+	*************************************************************************//**
+	*  @class     SnapshotSerializer
+	*  @brief     Encode / decode the snapshot with the bit packing and the delta compression.
+	*             Wire format :
+	*                 sequence (32) | hasBaseline (1) [baseline sequence (32)] | entityCount (32)
+	*                 per entity  : id delta | [changed (1)] | per field [changed (1)] value
+	*             Unchanged fields are compared after the quantization, so the jitter smaller than the resolution is not sent.
+	*****************************************************************************/
+	class SnapshotSerializer
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Encode current snapshot. baseline == nullptr sends all fields. Return written bit count*/
+		std::uint64_t Encode(const ReplicationSnapshot& current, const ReplicationSnapshot* baseline, BitWriter& writer) const;
+
+		/* @brief : Decode the snapshot. The history must contain the baseline referenced by the packet*/
+		ReplicationSnapshot Decode(BitReader& reader, const SnapshotHistory& receivedHistory) const;
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		const ReplicationSchema& GetSchema() const { return _schema; }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		explicit SnapshotSerializer(const ReplicationSchema& schema) : _schema(schema) {};
+
+		~SnapshotSerializer() = default;
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+		bool IsFieldChanged(const ReplicatedField& field, const std::uint8_t* current, const std::uint8_t* baseline) const;
+
+		void WriteField(const ReplicatedField& field, const std::uint8_t* state, BitWriter& writer) const;
+
+		void ReadField (const ReplicatedField& field, std::uint8_t* state, BitReader& reader) const;
+
+		void WriteEntityID(const std::uint32_t entityID, const std::uint32_t previousID, BitWriter& writer) const;
+
+		std::uint32_t ReadEntityID(const std::uint32_t previousID, BitReader& reader) const;
+
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		ReplicationSchema _schema;
+	};
+}
+#endif
@@ -0,0 +1,429 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   BitStream.cpp
+///             @brief  Bit packed writer and reader for the state replication.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Network/Private/Include/BitStream.hpp"
+#include <stdexcept>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace gc;
+
+namespace
+{
+	// Range of the three smallest components of a normalized quaternion : [-1/sqrt(2), 1/sqrt(2)]
+	constexpr float SMALLEST_THREE_MIN = -0.707106781f;
+	constexpr float SMALLEST_THREE_MAX =  0.707106781f;
+
+	constexpr std::uint32_t BitMask(const std::uint32_t bitCount)
+	{
+		return bitCount >= 32 ? 0xffffffffu : ((1u << bitCount) - 1u);
+	}
+}
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region BitPacking
+/****************************************************************************
+*                     RequiredBits
+*************************************************************************//**
+*  @fn        std::uint32_t BitPacking::RequiredBits(const std::uint32_t range)
+*
+*  @brief     Return the bit count required to express [0, range]
+*
+*  @param[in] const std::uint32_t range
+*
+*  @return    std::uint32_t (0 - 32)
+*****************************************************************************/
+std::uint32_t BitPacking::RequiredBits(const std::uint32_t range)
+{
+	std::uint32_t bitCount = 0;
+	while (bitCount < 32 && (range >> bitCount) != 0) { ++bitCount; }
+	return bitCount;
+}
+
+/****************************************************************************
+*                     RequiredBits
+*************************************************************************//**
+*  @fn        std::uint32_t BitPacking::RequiredBits(const float min, const float max, const float resolution)
+*
+*  @brief     Return the bit count required to express [min, max] with the resolution step
+*
+*  @param[in] const float min
+*  @param[in] const float max
+*  @param[in] const float resolution (> 0)
+*
+*  @return    std::uint32_t (1 - 32)
+*****************************************************************************/
+std::uint32_t BitPacking::RequiredBits(const float min, const float max, const float resolution)
+{
+	if (resolution <= 0.0f || max <= min) { throw std::runtime_error("invalid quantization range"); }
+
+	const double steps = std::ceil(static_cast<double>(max - min) / resolution);
+	if (steps >= 4294967295.0) { return 32; }
+
+	return (std::max)(1u, RequiredBits(static_cast<std::uint32_t>(steps)));
+}
+
+/****************************************************************************
+*                     QuantizeFloat
+*************************************************************************//**
+*  @fn        std::uint32_t BitPacking::QuantizeFloat(const float value, const float min, const float max, const std::uint32_t bitCount)
+*
+*  @brief     Map float in [min, max] to the nearest integer step. Out of range value is clamped.
+*
+*  @param[in] const float value
+*  @param[in] const float min
+*  @param[in] const float max
+*  @param[in] const std::uint32_t bitCount
+*
+*  @return    std::uint32_t
+*****************************************************************************/
+std::uint32_t BitPacking::QuantizeFloat(const float value, const float min, const float max, const std::uint32_t bitCount)
+{
+	const double maxStep    = static_cast<double>(BitMask(bitCount));
+	const double normalized = (std::clamp)((static_cast<double>(value) - min) / (static_cast<double>(max) - min), 0.0, 1.0);
+	return static_cast<std::uint32_t>(normalized * maxStep + 0.5);
+}
+
+/****************************************************************************
+*                     DequantizeFloat
+*************************************************************************//**
+*  @fn        float BitPacking::DequantizeFloat(const std::uint32_t value, const float min, const float max, const std::uint32_t bitCount)
+*
+*  @brief     Map integer step to float in [min, max]
+*
+*  @param[in] const std::uint32_t value
+*  @param[in] const float min
+*  @param[in] const float max
+*  @param[in] const std::uint32_t bitCount
+*
+*  @return    float
+*****************************************************************************/
+float BitPacking::DequantizeFloat(const std::uint32_t value, const float min, const float max, const std::uint32_t bitCount)
+{
+	const double maxStep = static_cast<double>(BitMask(bitCount));
+	return static_cast<float>(min + (static_cast<double>(max) - min) * (value / maxStep));
+}
+#pragma endregion BitPacking
+
+#pragma region BitWriter
+/****************************************************************************
+*                     WriteBits
+*************************************************************************//**
+*  @fn        void BitWriter::WriteBits(const std::uint32_t value, const std::uint32_t bitCount)
+*
+*  @brief     Write the lower bitCount bits of the value.
+*             The bits are accumulated in the 64 bit scratch and flushed by 32 bits.
+*
+*  @param[in] const std::uint32_t value
+*  @param[in] const std::uint32_t bitCount (1 - 32)
+*
+*  @return    void
+*****************************************************************************/
+void BitWriter::WriteBits(const std::uint32_t value, const std::uint32_t bitCount)
+{
+	if (bitCount == 0 || bitCount > 32) { throw std::runtime_error("bitCount must be 1 - 32"); }
+
+	_scratch     |= static_cast<std::uint64_t>(value & BitMask(bitCount)) << _scratchBits;
+	_scratchBits += bitCount;
+	_bitCount    += bitCount;
+
+	if (_scratchBits >= 32)
+	{
+		const auto word = static_cast<std::uint32_t>(_scratch);
+		_buffer.push_back(static_cast<std::uint8_t>(word));
+		_buffer.push_back(static_cast<std::uint8_t>(word >> 8));
+		_buffer.push_back(static_cast<std::uint8_t>(word >> 16));
+		_buffer.push_back(static_cast<std::uint8_t>(word >> 24));
+
+		_scratch    >>= 32;
+		_scratchBits -= 32;
+	}
+}
+
+/****************************************************************************
+*                     WriteRangedInteger
+*************************************************************************//**
+*  @fn        void BitWriter::WriteRangedInteger(const std::int32_t value, const std::int32_t min, const std::int32_t max)
+*
+*  @brief     Write integer in [min, max] with the minimum bit count.
+*             If min == max, nothing is written.
+*
+*  @param[in] const std::int32_t value
+*  @param[in] const std::int32_t min
+*  @param[in] const std::int32_t max
+*
+*  @return    void
+*****************************************************************************/
+void BitWriter::WriteRangedInteger(const std::int32_t value, const std::int32_t min, const std::int32_t max)
+{
+	if (max < min || value < min || max < value) { throw std::runtime_error("value is out of range"); }
+
+	const auto range    = static_cast<std::uint32_t>(static_cast<std::int64_t>(max) - min);
+	const auto bitCount = BitPacking::RequiredBits(range);
+	if (bitCount == 0) { return; }
+
+	WriteBits(static_cast<std::uint32_t>(static_cast<std::int64_t>(value) - min), bitCount);
+}
+
+/****************************************************************************
+*                     WriteQuantizedFloat
+*************************************************************************//**
+*  @fn        void BitWriter::WriteQuantizedFloat(const float value, const float min, const float max, const float resolution)
+*
+*  @brief     Write float in [min, max] quantized by resolution
+*
+*  @param[in] const float value
+*  @param[in] const float min
+*  @param[in] const float max
+*  @param[in] const float resolution
+*
+*  @return    void
+*****************************************************************************/
+void BitWriter::WriteQuantizedFloat(const float value, const float min, const float max, const float resolution)
+{
+	WriteQuantizedFloatBits(value, min, max, BitPacking::RequiredBits(min, max, resolution));
+}
+
+void BitWriter::WriteQuantizedFloatBits(const float value, const float min, const float max, const std::uint32_t bitCount)
+{
+	WriteBits(BitPacking::QuantizeFloat(value, min, max, bitCount), bitCount);
+}
+
+void BitWriter::WriteQuantizedFloat3(const gm::Float3& value, const float min, const float max, const float resolution)
+{
+	const auto bitCount = BitPacking::RequiredBits(min, max, resolution);
+	WriteQuantizedFloatBits(value.x, min, max, bitCount);
+	WriteQuantizedFloatBits(value.y, min, max, bitCount);
+	WriteQuantizedFloatBits(value.z, min, max, bitCount);
+}
+
+/****************************************************************************
+*                     WriteQuaternion
+*************************************************************************//**
+*  @fn        void BitWriter::WriteQuaternion(const gm::QuaternionF& quaternion, const std::uint32_t bitsPerComponent)
+*
+*  @brief     Smallest three encoding.
+*             The largest absolute component is dropped (2 bit index) and rebuilt from the unit length.
+*             Because q and -q are the same rotation, the sign is flipped so that the dropped component is positive.
+*
+*  @param[in] const gm::QuaternionF& normalized quaternion
+*  @param[in] const std::uint32_t bitsPerComponent
+*
+*  @return    void
+*****************************************************************************/
+void BitWriter::WriteQuaternion(const gm::QuaternionF& quaternion, const std::uint32_t bitsPerComponent)
+{
+	std::uint32_t largestIndex = 0;
+	float         largestValue = 0.0f;
+	for (std::uint32_t i = 0; i < 4; ++i)
+	{
+		if (std::fabs(quaternion[i]) > largestValue)
+		{
+			largestValue = std::fabs(quaternion[i]);
+			largestIndex = i;
+		}
+	}
+
+	const float sign = quaternion[largestIndex] < 0.0f ? -1.0f : 1.0f;
+
+	WriteBits(largestIndex, 2);
+	for (std::uint32_t i = 0; i < 4; ++i)
+	{
+		if (i == largestIndex) { continue; }
+		WriteQuantizedFloatBits(quaternion[i] * sign, SMALLEST_THREE_MIN, SMALLEST_THREE_MAX, bitsPerComponent);
+	}
+}
+
+/****************************************************************************
+*                     WriteFloat
+*************************************************************************//**
+*  @fn        void BitWriter::WriteFloat(const float value)
+*
+*  @brief     Write full 32 bit float (IEEE754 bit pattern)
+*
+*  @param[in] const float value
+*
+*  @return    void
+*****************************************************************************/
+void BitWriter::WriteFloat(const float value)
+{
+	std::uint32_t bits = 0;
+	std::memcpy(&bits, &value, sizeof(float));
+	WriteBits(bits, 32);
+}
+
+/****************************************************************************
+*                     AlignToByte
+*************************************************************************//**
+*  @fn        void BitWriter::AlignToByte()
+*
+*  @brief     Pad zero bits up to the next byte boundary
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
+void BitWriter::AlignToByte()
+{
+	const auto remainder = static_cast<std::uint32_t>(_bitCount % 8);
+	if (remainder != 0) { WriteBits(0, 8 - remainder); }
+}
+
+/****************************************************************************
+*                     Flush
+*************************************************************************//**
+*  @fn        void BitWriter::Flush()
+*
+*  @brief     Pad to the byte boundary and move the scratch bits into the buffer.
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
+void BitWriter::Flush()
+{
+	AlignToByte();
+
+	while (_scratchBits > 0)
+	{
+		_buffer.push_back(static_cast<std::uint8_t>(_scratch));
+		_scratch    >>= 8;
+		_scratchBits -= 8;
+	}
+}
+
+/****************************************************************************
+*                     Clear
+*************************************************************************//**
+*  @fn        void BitWriter::Clear()
+*
+*  @brief     Clear buffer (the capacity is kept for the next packet)
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
+void BitWriter::Clear()
+{
+	_buffer.clear();
+	_scratch     = 0;
+	_scratchBits = 0;
+	_bitCount    = 0;
+}
+#pragma endregion BitWriter
+
+#pragma region BitReader
+/****************************************************************************
+*                     ReadBits
+*************************************************************************//**
+*  @fn        std::uint32_t BitReader::ReadBits(const std::uint32_t bitCount)
+*
+*  @brief     Read bitCount bits. Up to 5 bytes are gathered at once.
+*
+*  @param[in] const std::uint32_t bitCount (1 - 32)
+*
+*  @return    std::uint32_t
+*****************************************************************************/
+std::uint32_t BitReader::ReadBits(const std::uint32_t bitCount)
+{
+	if (bitCount == 0 || bitCount > 32)         { throw std::runtime_error("bitCount must be 1 - 32"); }
+	if (_bitPosition + bitCount > _bitSize)     { throw std::runtime_error("Exceed max stream size"); }
+
+	const std::uint64_t byteIndex = _bitPosition / 8;
+	const std::uint32_t bitOffset = static_cast<std::uint32_t>(_bitPosition % 8);
+	const std::uint64_t byteCount = (std::min)(static_cast<std::uint64_t>((bitOffset + bitCount + 7) / 8), _bitSize / 8 - byteIndex);
+
+	std::uint64_t word = 0;
+	for (std::uint64_t i = 0; i < byteCount; ++i)
+	{
+		word |= static_cast<std::uint64_t>(_data[byteIndex + i]) << (8 * i);
+	}
+
+	_bitPosition += bitCount;
+	return static_cast<std::uint32_t>(word >> bitOffset) & BitMask(bitCount);
+}
+
+std::int32_t BitReader::ReadRangedInteger(const std::int32_t min, const std::int32_t max)
+{
+	if (max < min) { throw std::runtime_error("invalid range"); }
+
+	const auto range    = static_cast<std::uint32_t>(static_cast<std::int64_t>(max) - min);
+	const auto bitCount = BitPacking::RequiredBits(range);
+	if (bitCount == 0) { return min; }
+
+	return static_cast<std::int32_t>(static_cast<std::int64_t>(min) + ReadBits(bitCount));
+}
+
+float BitReader::ReadQuantizedFloat(const float min, const float max, const float resolution)
+{
+	return ReadQuantizedFloatBits(min, max, BitPacking::RequiredBits(min, max, resolution));
+}
+
+float BitReader::ReadQuantizedFloatBits(const float min, const float max, const std::uint32_t bitCount)
+{
+	return BitPacking::DequantizeFloat(ReadBits(bitCount), min, max, bitCount);
+}
+
+gm::Float3 BitReader::ReadQuantizedFloat3(const float min, const float max, const float resolution)
+{
+	const auto bitCount = BitPacking::RequiredBits(min, max, resolution);
+	const auto x = ReadQuantizedFloatBits(min, max, bitCount);
+	const auto y = ReadQuantizedFloatBits(min, max, bitCount);
+	const auto z = ReadQuantizedFloatBits(min, max, bitCount);
+	return gm::Float3(x, y, z);
+}
+
+/****************************************************************************
+*                     ReadQuaternion
+*************************************************************************//**
+*  @fn        gm::QuaternionF BitReader::ReadQuaternion(const std::uint32_t bitsPerComponent)
+*
+*  @brief     Decode the smallest three encoding. The dropped component is sqrt(1 - (a^2 + b^2 + c^2)).
+*
+*  @param[in] const std::uint32_t bitsPerComponent
+*
+*  @return    gm::QuaternionF
+*****************************************************************************/
+gm::QuaternionF BitReader::ReadQuaternion(const std::uint32_t bitsPerComponent)
+{
+	const auto largestIndex = ReadBits(2);
+
+	gm::QuaternionF result;
+	float sumSquare = 0.0f;
+	for (std::uint32_t i = 0; i < 4; ++i)
+	{
+		if (i == largestIndex) { continue; }
+		result[i]  = ReadQuantizedFloatBits(SMALLEST_THREE_MIN, SMALLEST_THREE_MAX, bitsPerComponent);
+		sumSquare += result[i] * result[i];
+	}
+
+	result[largestIndex] = std::sqrt((std::max)(0.0f, 1.0f - sumSquare));
+	return result;
+}
+
+float BitReader::ReadFloat()
+{
+	const auto bits = ReadBits(32);
+	float value = 0.0f;
+	std::memcpy(&value, &bits, sizeof(float));
+	return value;
+}
+
+void BitReader::AlignToByte()
+{
+	const auto remainder = static_cast<std::uint32_t>(_bitPosition % 8);
+	if (remainder != 0) { ReadBits(8 - remainder); }
+}
+#pragma endregion BitReader
@@ -0,0 +1,672 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   SnapshotSerializer.cpp
+///             @brief  Delta compressed snapshot for the state replication.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Network/Private/Include/SnapshotSerializer.hpp"
+#include <stdexcept>
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace gc;
+
+namespace
+{
+	constexpr std::uint32_t INVALID_ENTITY_ID      = 0xffffffffu;
+	constexpr std::uint32_t SMALL_ID_DELTA_BITS    = 6;
+	constexpr std::uint32_t MAX_QUATERNION_BITS    = 20;   // 2 + 3 * 20 bits fit in std::uint64_t
+
+	template<typename T>
+	T LoadField(const std::uint8_t* state, const std::uint32_t offset)
+	{
+		T value;
+		std::memcpy(&value, state + offset, sizeof(T));
+		return value;
+	}
+
+	template<typename T>
+	void StoreField(std::uint8_t* state, const std::uint32_t offset, const T& value)
+	{
+		std::memcpy(state + offset, &value, sizeof(T));
+	}
+
+	/*-------------------------------------------------------------------
+	-  Same quantization as BitWriter::WriteQuaternion, packed into one integer for the comparison
+	---------------------------------------------------------------------*/
+	std::uint64_t PackQuaternion(const std::uint8_t* state, const ReplicatedField& field)
+	{
+		float q[4] = {};
+		std::memcpy(q, state + field.ByteOffset, sizeof(q));
+
+		std::uint32_t largestIndex = 0;
+		for (std::uint32_t i = 1; i < 4; ++i)
+		{
+			if (std::fabs(q[i]) > std::fabs(q[largestIndex])) { largestIndex = i; }
+		}
+		const float sign = q[largestIndex] < 0.0f ? -1.0f : 1.0f;
+
+		std::uint64_t packed = largestIndex;
+		for (std::uint32_t i = 0; i < 4; ++i)
+		{
+			if (i == largestIndex) { continue; }
+			packed = (packed << field.BitCount) | BitPacking::QuantizeFloat(q[i] * sign, -0.707106781f, 0.707106781f, field.BitCount);
+		}
+		return packed;
+	}
+}
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region ReplicationSchema
+ReplicationSchema& ReplicationSchema::AddBool(const std::string& name, const std::size_t byteOffset)
+{
+	ReplicatedField field = {};
+	field.Name       = name;
+	field.Type       = ReplicatedFieldType::Bool;
+	field.ByteOffset = static_cast<std::uint32_t>(byteOffset);
+	field.BitCount   = 1;
+	return AddField(std::move(field), sizeof(bool));
+}
+
+ReplicationSchema& ReplicationSchema::AddRangedInteger(const std::string& name, const std::size_t byteOffset, const std::int32_t min, const std::int32_t max)
+{
+	if (max < min) { throw std::runtime_error("invalid integer range"); }
+
+	ReplicatedField field = {};
+	field.Name       = name;
+	field.Type       = ReplicatedFieldType::RangedInteger;
+	field.ByteOffset = static_cast<std::uint32_t>(byteOffset);
+	field.BitCount   = BitPacking::RequiredBits(static_cast<std::uint32_t>(static_cast<std::int64_t>(max) - min));
+	field.IntegerMin = min;
+	field.IntegerMax = max;
+	return AddField(std::move(field), sizeof(std::int32_t));
+}
+
+ReplicationSchema& ReplicationSchema::AddQuantizedFloat(const std::string& name, const std::size_t byteOffset, const float min, const float max, const float resolution)
+{
+	ReplicatedField field = {};
+	field.Name       = name;
+	field.Type       = ReplicatedFieldType::QuantizedFloat;
+	field.ByteOffset = static_cast<std::uint32_t>(byteOffset);
+	field.BitCount   = BitPacking::RequiredBits(min, max, resolution);
+	field.FloatMin   = min;
+	field.FloatMax   = max;
+	return AddField(std::move(field), sizeof(float));
+}
+
+ReplicationSchema& ReplicationSchema::AddQuantizedFloat3(const std::string& name, const std::size_t byteOffset, const float min, const float max, const float resolution)
+{
+	ReplicatedField field = {};
+	field.Name       = name;
+	field.Type       = ReplicatedFieldType::QuantizedFloat3;
+	field.ByteOffset = static_cast<std::uint32_t>(byteOffset);
+	field.BitCount   = BitPacking::RequiredBits(min, max, resolution);
+	field.FloatMin   = min;
+	field.FloatMax   = max;
+	return AddField(std::move(field), sizeof(float) * 3);
+}
+
+ReplicationSchema& ReplicationSchema::AddQuaternion(const std::string& name, const std::size_t byteOffset, const std::uint32_t bitsPerComponent)
+{
+	if (bitsPerComponent == 0 || bitsPerComponent > MAX_QUATERNION_BITS) { throw std::runtime_error("quaternion bit count must be 1 - 20"); }
+
+	ReplicatedField field = {};
+	field.Name       = name;
+	field.Type       = ReplicatedFieldType::Quaternion;
+	field.ByteOffset = static_cast<std::uint32_t>(byteOffset);
+	field.BitCount   = bitsPerComponent;
+	return AddField(std::move(field), sizeof(float) * 4);
+}
+
+ReplicationSchema& ReplicationSchema::AddFloat(const std::string& name, const std::size_t byteOffset)
+{
+	ReplicatedField field = {};
+	field.Name       = name;
+	field.Type       = ReplicatedFieldType::Float;
+	field.ByteOffset = static_cast<std::uint32_t>(byteOffset);
+	field.BitCount   = 32;
+	return AddField(std::move(field), sizeof(float));
+}
+
+/****************************************************************************
+*                     AddField
+*************************************************************************//**
+*  @fn        ReplicationSchema& ReplicationSchema::AddField(ReplicatedField&& field, const std::size_t fieldByteSize)
+*
+*  @brief     Check the field is inside the state struct and register it.
+*
+*  @param[in] ReplicatedField&& field
+*  @param[in] const std::size_t fieldByteSize
+*
+*  @return    ReplicationSchema& (for the method chain)
+*****************************************************************************/
+ReplicationSchema& ReplicationSchema::AddField(ReplicatedField&& field, const std::size_t fieldByteSize)
+{
+	if (field.ByteOffset + fieldByteSize > _stateByteSize) { throw std::runtime_error("replicated field is outside of the state : " + field.Name); }
+
+	_fields.push_back(std::move(field));
+	return *this;
+}
+
+/****************************************************************************
+*                     GetFullStateBitCount
+*************************************************************************//**
+*  @fn        std::uint64_t ReplicationSchema::GetFullStateBitCount() const
+*
+*  @brief     Bit count of all fields without the delta compression
+*
+*  @param[in] void
+*
+*  @return    std::uint64_t
+*****************************************************************************/
+std::uint64_t ReplicationSchema::GetFullStateBitCount() const
+{
+	std::uint64_t bitCount = 0;
+	for (const auto& field : _fields)
+	{
+		switch (field.Type)
+		{
+			case ReplicatedFieldType::QuantizedFloat3: { bitCount += 3ull * field.BitCount;     break; }
+			case ReplicatedFieldType::Quaternion:      { bitCount += 2ull + 3ull * field.BitCount; break; }
+			default:                                   { bitCount += field.BitCount; break; }
+		}
+	}
+	return bitCount;
+}
+#pragma endregion ReplicationSchema
+
+#pragma region ReplicationSnapshot
+/****************************************************************************
+*                     SetEntity
+*************************************************************************//**
+*  @fn        void ReplicationSnapshot::SetEntity(const std::uint32_t entityID, const void* state)
+*
+*  @brief     Add the entity state keeping the ascending id order.
+*             Adding in the ascending order is O(1).
+*
+*  @param[in] const std::uint32_t entityID
+*  @param[in] const void* state (schema state byte size)
+*
+*  @return    void
+*****************************************************************************/
+void ReplicationSnapshot::SetEntity(const std::uint32_t entityID, const void* state)
+{
+	if (entityID == INVALID_ENTITY_ID) { throw std::runtime_error("invalid entity id"); }
+
+	const auto source = static_cast<const std::uint8_t*>(state);
+
+	if (_entityIDs.empty() || _entityIDs.back() < entityID)
+	{
+		_entityIDs.push_back(entityID);
+		_states.insert(_states.end(), source, source + _stride);
+		return;
+	}
+
+	const auto iterator = std::lower_bound(_entityIDs.begin(), _entityIDs.end(), entityID);
+	const auto index    = static_cast<std::size_t>(iterator - _entityIDs.begin());
+
+	if (*iterator == entityID)
+	{
+		std::memcpy(&_states[index * _stride], source, _stride);
+	}
+	else
+	{
+		_entityIDs.insert(iterator, entityID);
+		_states.insert(_states.begin() + index * _stride, source, source + _stride);
+	}
+}
+
+/****************************************************************************
+*                     FindState
+*************************************************************************//**
+*  @fn        const std::uint8_t* ReplicationSnapshot::FindState(const std::uint32_t entityID) const
+*
+*  @brief     Binary search the entity state
+*
+*  @param[in] const std::uint32_t entityID
+*
+*  @return    const std::uint8_t* (nullptr : not found)
+*****************************************************************************/
+const std::uint8_t* ReplicationSnapshot::FindState(const std::uint32_t entityID) const
+{
+	const auto iterator = std::lower_bound(_entityIDs.begin(), _entityIDs.end(), entityID);
+	if (iterator == _entityIDs.end() || *iterator != entityID) { return nullptr; }
+
+	return &_states[static_cast<std::size_t>(iterator - _entityIDs.begin()) * _stride];
+}
+#pragma endregion ReplicationSnapshot
+
+#pragma region SnapshotHistory
+void SnapshotHistory::Push(const ReplicationSnapshot& snapshot)
+{
+	const auto index = snapshot.GetSequence() % _snapshots.size();
+	_snapshots[index] = snapshot;
+	_isValid  [index] = true;
+}
+
+/****************************************************************************
+*                     Acknowledge
+*************************************************************************//**
+*  @fn        void SnapshotHistory::Acknowledge(const std::uint32_t sequence)
+*
+*  @brief     Update the baseline. The sequence comparison takes the wrap around into account.
+*
+*  @param[in] const std::uint32_t sequence
+*
+*  @return    void
+*****************************************************************************/
+void SnapshotHistory::Acknowledge(const std::uint32_t sequence)
+{
+	if (_hasAcknowledged && static_cast<std::int32_t>(sequence - _acknowledgedSequence) <= 0) { return; }
+	if (Find(sequence) == nullptr) { return; }
+
+	_acknowledgedSequence = sequence;
+	_hasAcknowledged      = true;
+}
+
+const ReplicationSnapshot* SnapshotHistory::Find(const std::uint32_t sequence) const
+{
+	const auto index = sequence % _snapshots.size();
+	if (!_isValid[index] || _snapshots[index].GetSequence() != sequence) { return nullptr; }
+
+	return &_snapshots[index];
+}
+#pragma endregion SnapshotHistory
+
+#pragma region SnapshotSerializer
+/****************************************************************************
+*                     Encode
+*************************************************************************//**
+*  @fn        std::uint64_t SnapshotSerializer::Encode(const ReplicationSnapshot& current, const ReplicationSnapshot* baseline, BitWriter& writer) const
+*
+*  @brief     Encode the snapshot. Entities which exist in the baseline are delta compressed per field.
+*             Entities removed from the current snapshot are simply not written.
+*
+*  @param[in] const ReplicationSnapshot& current
+*  @param[in] const ReplicationSnapshot* baseline (nullptr : full state)
+*  @param[out]BitWriter& writer
+*
+*  @return    std::uint64_t written bit count
+*****************************************************************************/
+std::uint64_t SnapshotSerializer::Encode(const ReplicationSnapshot& current, const ReplicationSnapshot* baseline, BitWriter& writer) const
+{
+	if (current.GetStride() != _schema.GetStateByteSize()) { throw std::runtime_error("snapshot does not match the schema"); }
+
+	const auto startBitCount = writer.GetBitCount();
+
+	/*-------------------------------------------------------------------
+	-                 Header
+	---------------------------------------------------------------------*/
+	writer.WriteBits(current.GetSequence(), 32);
+	writer.WriteBool(baseline != nullptr);
+	if (baseline) { writer.WriteBits(baseline->GetSequence(), 32); }
+	writer.WriteBits(current.GetEntityCount(), 32);
+
+	/*-------------------------------------------------------------------
+	-    Entities (both id lists are sorted, so the baseline is walked once)
+	---------------------------------------------------------------------*/
+	const auto&   fields        = _schema.GetFields();
+	std::uint32_t previousID    = INVALID_ENTITY_ID;
+	std::uint32_t baselineIndex = 0;
+
+	for (std::uint32_t i = 0; i < current.GetEntityCount(); ++i)
+	{
+		const auto entityID = current.GetEntityID(i);
+		const auto state    = current.GetState(i);
+
+		WriteEntityID(entityID, previousID, writer);
+		previousID = entityID;
+
+		const std::uint8_t* baselineState = nullptr;
+		if (baseline)
+		{
+			while (baselineIndex < baseline->GetEntityCount() && baseline->GetEntityID(baselineIndex) < entityID) { ++baselineIndex; }
+			if    (baselineIndex < baseline->GetEntityCount() && baseline->GetEntityID(baselineIndex) == entityID)
+			{
+				baselineState = baseline->GetState(baselineIndex);
+			}
+		}
+
+		// New entity : all fields
+		if (baselineState == nullptr)
+		{
+			for (const auto& field : fields) { WriteField(field, state, writer); }
+			continue;
+		}
+
+		// Known entity : changed flag per entity and per field
+		bool isChanged = false;
+		for (const auto& field : fields)
+		{
+			if (IsFieldChanged(field, state, baselineState)) { isChanged = true; break; }
+		}
+
+		writer.WriteBool(isChanged);
+		if (!isChanged) { continue; }
+
+		for (const auto& field : fields)
+		{
+			const bool isFieldChanged = IsFieldChanged(field, state, baselineState);
+			writer.WriteBool(isFieldChanged);
+			if (isFieldChanged) { WriteField(field, state, writer); }
+		}
+	}
+
+	return writer.GetBitCount() - startBitCount;
+}
+
+/****************************************************************************
+*                     Decode
+*************************************************************************//**
+*  @fn        ReplicationSnapshot SnapshotSerializer::Decode(BitReader& reader, const SnapshotHistory& receivedHistory) const
+*
+*  @brief     Decode the snapshot. Unchanged fields are copied from the baseline in the received history.
+*             The caller pushes the result into the received history and sends back the acknowledgement.
+*
+*  @param[in] BitReader& reader
+*  @param[in] const SnapshotHistory& receivedHistory
+*
+*  @return    ReplicationSnapshot
+*****************************************************************************/
+ReplicationSnapshot SnapshotSerializer::Decode(BitReader& reader, const SnapshotHistory& receivedHistory) const
+{
+	/*-------------------------------------------------------------------
+	-                 Header
+	---------------------------------------------------------------------*/
+	const auto sequence = reader.ReadBits(32);
+	const ReplicationSnapshot* baseline = nullptr;
+	if (reader.ReadBool())
+	{
+		baseline = receivedHistory.Find(reader.ReadBits(32));
+		if (baseline == nullptr) { throw std::runtime_error("baseline snapshot has been lost"); }
+	}
+	const auto entityCount = reader.ReadBits(32);
+
+	/*-------------------------------------------------------------------
+	-                 Entities
+	---------------------------------------------------------------------*/
+	ReplicationSnapshot result(_schema, sequence);
+
+	const auto&   fields        = _schema.GetFields();
+	std::uint32_t previousID    = INVALID_ENTITY_ID;
+	std::uint32_t baselineIndex = 0;
+	std::vector<std::uint8_t> state(_schema.GetStateByteSize(), 0);
+
+	for (std::uint32_t i = 0; i < entityCount; ++i)
+	{
+		const auto entityID = ReadEntityID(previousID, reader);
+		previousID = entityID;
+
+		const std::uint8_t* baselineState = nullptr;
+		if (baseline)
+		{
+			while (baselineIndex < baseline->GetEntityCount() && baseline->GetEntityID(baselineIndex) < entityID) { ++baselineIndex; }
+			if    (baselineIndex < baseline->GetEntityCount() && baseline->GetEntityID(baselineIndex) == entityID)
+			{
+				baselineState = baseline->GetState(baselineIndex);
+			}
+		}
+
+		if (baselineState == nullptr)
+		{
+			std::fill(state.begin(), state.end(), static_cast<std::uint8_t>(0));
+			for (const auto& field : fields) { ReadField(field, state.data(), reader); }
+		}
+		else
+		{
+			std::memcpy(state.data(), baselineState, state.size());
+			if (reader.ReadBool())
+			{
+				for (const auto& field : fields)
+				{
+					if (reader.ReadBool()) { ReadField(field, state.data(), reader); }
+				}
+			}
+		}
+
+		result.SetEntity(entityID, state.data());
+	}
+
+	return result;
+}
+
+/****************************************************************************
+*                     IsFieldChanged
+*************************************************************************//**
+*  @fn        bool SnapshotSerializer::IsFieldChanged(const ReplicatedField& field, const std::uint8_t* current, const std::uint8_t* baseline) const
+*
+*  @brief     Compare the quantized values. The difference below the resolution is regarded as unchanged.
+*
+*  @param[in] const ReplicatedField& field
+*  @param[in] const std::uint8_t* current state
+*  @param[in] const std::uint8_t* baseline state
+*
+*  @return    bool
+*****************************************************************************/
+bool SnapshotSerializer::IsFieldChanged(const ReplicatedField& field, const std::uint8_t* current, const std::uint8_t* baseline) const
+{
+	const auto offset = field.ByteOffset;
+
+	switch (field.Type)
+	{
+		case ReplicatedFieldType::Bool:
+		{
+			return LoadField<bool>(current, offset) != LoadField<bool>(baseline, offset);
+		}
+		case ReplicatedFieldType::RangedInteger:
+		{
+			return LoadField<std::int32_t>(current, offset) != LoadField<std::int32_t>(baseline, offset);
+		}
+		case ReplicatedFieldType::QuantizedFloat:
+		{
+			return BitPacking::QuantizeFloat(LoadField<float>(current , offset), field.FloatMin, field.FloatMax, field.BitCount)
+				!= BitPacking::QuantizeFloat(LoadField<float>(baseline, offset), field.FloatMin, field.FloatMax, field.BitCount);
+		}
+		case ReplicatedFieldType::QuantizedFloat3:
+		{
+			for (std::uint32_t i = 0; i < 3; ++i)
+			{
+				const auto elementOffset = offset + static_cast<std::uint32_t>(sizeof(float)) * i;
+				if (BitPacking::QuantizeFloat(LoadField<float>(current , elementOffset), field.FloatMin, field.FloatMax, field.BitCount)
+				 != BitPacking::QuantizeFloat(LoadField<float>(baseline, elementOffset), field.FloatMin, field.FloatMax, field.BitCount))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+		case ReplicatedFieldType::Quaternion:
+		{
+			return PackQuaternion(current, field) != PackQuaternion(baseline, field);
+		}
+		case ReplicatedFieldType::Float:
+		{
+			return std::memcmp(current + offset, baseline + offset, sizeof(float)) != 0;
+		}
+		default:
+		{
+			throw std::runtime_error("unknown replicated field type");
+		}
+	}
+}
+
+/****************************************************************************
+*                     WriteField
+*************************************************************************//**
+*  @fn        void SnapshotSerializer::WriteField(const ReplicatedField& field, const std::uint8_t* state, BitWriter& writer) const
+*
+*  @brief     Write one field with the encoding described in the schema
+*
+*  @param[in] const ReplicatedField& field
+*  @param[in] const std::uint8_t* state
+*  @param[out]BitWriter& writer
+*
+*  @return    void
+*****************************************************************************/
+void SnapshotSerializer::WriteField(const ReplicatedField& field, const std::uint8_t* state, BitWriter& writer) const
+{
+	const auto offset = field.ByteOffset;
+
+	switch (field.Type)
+	{
+		case ReplicatedFieldType::Bool:
+		{
+			writer.WriteBool(LoadField<bool>(state, offset));
+			break;
+		}
+		case ReplicatedFieldType::RangedInteger:
+		{
+			writer.WriteRangedInteger(LoadField<std::int32_t>(state, offset), field.IntegerMin, field.IntegerMax);
+			break;
+		}
+		case ReplicatedFieldType::QuantizedFloat:
+		{
+			writer.WriteQuantizedFloatBits(LoadField<float>(state, offset), field.FloatMin, field.FloatMax, field.BitCount);
+			break;
+		}
+		case ReplicatedFieldType::QuantizedFloat3:
+		{
+			for (std::uint32_t i = 0; i < 3; ++i)
+			{
+				const auto elementOffset = offset + static_cast<std::uint32_t>(sizeof(float)) * i;
+				writer.WriteQuantizedFloatBits(LoadField<float>(state, elementOffset), field.FloatMin, field.FloatMax, field.BitCount);
+			}
+			break;
+		}
+		case ReplicatedFieldType::Quaternion:
+		{
+			gm::QuaternionF quaternion;
+			for (std::uint32_t i = 0; i < 4; ++i)
+			{
+				quaternion[i] = LoadField<float>(state, offset + static_cast<std::uint32_t>(sizeof(float)) * i);
+			}
+			writer.WriteQuaternion(quaternion, field.BitCount);
+			break;
+		}
+		case ReplicatedFieldType::Float:
+		{
+			writer.WriteFloat(LoadField<float>(state, offset));
+			break;
+		}
+		default:
+		{
+			throw std::runtime_error("unknown replicated field type");
+		}
+	}
+}
+
+/****************************************************************************
+*                     ReadField
+*************************************************************************//**
+*  @fn        void SnapshotSerializer::ReadField(const ReplicatedField& field, std::uint8_t* state, BitReader& reader) const
+*
+*  @brief     Read one field and store it to the state
+*
+*  @param[in] const ReplicatedField& field
+*  @param[out]std::uint8_t* state
+*  @param[in] BitReader& reader
+*
+*  @return    void
+*****************************************************************************/
+void SnapshotSerializer::ReadField(const ReplicatedField& field, std::uint8_t* state, BitReader& reader) const
+{
+	const auto offset = field.ByteOffset;
+
+	switch (field.Type)
+	{
+		case ReplicatedFieldType::Bool:
+		{
+			StoreField(state, offset, reader.ReadBool());
+			break;
+		}
+		case ReplicatedFieldType::RangedInteger:
+		{
+			StoreField(state, offset, reader.ReadRangedInteger(field.IntegerMin, field.IntegerMax));
+			break;
+		}
+		case ReplicatedFieldType::QuantizedFloat:
+		{
+			StoreField(state, offset, reader.ReadQuantizedFloatBits(field.FloatMin, field.FloatMax, field.BitCount));
+			break;
+		}
+		case ReplicatedFieldType::QuantizedFloat3:
+		{
+			for (std::uint32_t i = 0; i < 3; ++i)
+			{
+				const auto elementOffset = offset + static_cast<std::uint32_t>(sizeof(float)) * i;
+				StoreField(state, elementOffset, reader.ReadQuantizedFloatBits(field.FloatMin, field.FloatMax, field.BitCount));
+			}
+			break;
+		}
+		case ReplicatedFieldType::Quaternion:
+		{
+			const auto quaternion = reader.ReadQuaternion(field.BitCount);
+			for (std::uint32_t i = 0; i < 4; ++i)
+			{
+				StoreField(state, offset + static_cast<std::uint32_t>(sizeof(float)) * i, quaternion[i]);
+			}
+			break;
+		}
+		case ReplicatedFieldType::Float:
+		{
+			StoreField(state, offset, reader.ReadFloat());
+			break;
+		}
+		default:
+		{
+			throw std::runtime_error("unknown replicated field type");
+		}
+	}
+}
+
+/****************************************************************************
+*                     WriteEntityID
+*************************************************************************//**
+*  @fn        void SnapshotSerializer::WriteEntityID(const std::uint32_t entityID, const std::uint32_t previousID, BitWriter& writer) const
+*
+*  @brief     Ids are sorted, so only the difference from the previous id is written.
+*             delta == 1 : 1 bit,  delta < 64 : 2 + 6 bits,  otherwise : 2 + 32 bits
+*
+*  @param[in] const std::uint32_t entityID
+*  @param[in] const std::uint32_t previousID (INVALID_ENTITY_ID for the first entity)
+*  @param[out]BitWriter& writer
+*
+*  @return    void
+*****************************************************************************/
+void SnapshotSerializer::WriteEntityID(const std::uint32_t entityID, const std::uint32_t previousID, BitWriter& writer) const
+{
+	const std::uint32_t delta = entityID - previousID; // wraps to entityID + 1 for the first entity
+
+	if (delta == 1) { writer.WriteBool(true); return; }
+
+	writer.WriteBool(false);
+	if (delta < (1u << SMALL_ID_DELTA_BITS))
+	{
+		writer.WriteBool(true);
+		writer.WriteBits(delta, SMALL_ID_DELTA_BITS);
+	}
+	else
+	{
+		writer.WriteBool(false);
+		writer.WriteBits(entityID, 32);
+	}
+}
+
+std::uint32_t SnapshotSerializer::ReadEntityID(const std::uint32_t previousID, BitReader& reader) const
+{
+	if (reader.ReadBool()) { return previousID + 1; }
+
+	if (reader.ReadBool()) { return previousID + reader.ReadBits(SMALL_ID_DELTA_BITS); }
+
+	return reader.ReadBits(32);
+}
+#pragma endregion SnapshotSerializer
@@ -0,0 +1,209 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   CPUSkinning.hpp
+///             @brief  CPU vertex skinning for crowds.
+///                     - SkinningSource keeps the bind pose positions and normals in the SoA layout
+///                       and the bone influences sorted by weight, so the linear blend skinning
+///                       runs 4 vertices at a time (SSE) with the palette rows blended by AVX.
+///                     - SDEF and QDEF vertices are corrected after the linear pass
+///                       (spherical deform / dual quaternion skinning).
+///                     - ExecuteAll splits the characters over the thread pool. Each character computes
+///                       its palette and writes the skinned vertices straight into the destination
+///                       (e.g. the frame upload buffer), which is then bound as the vertex buffer.
+///             How To: job = { &skeleton, &player.GetPose(), &palette, &source, destination }
+///                     CPUSkinning::ExecuteAll(jobs, jobCount, threadPool)
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef CPU_SKINNING_HPP
+#define CPU_SKINNING_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "Skeleton.hpp"
+#include "GameUtility/Math/Include/GMVertex.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+class  FrameUploadAllocator;
+struct FrameUploadAllocation;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gc::animation
+{
+	/****************************************************************************
+	*				  			SkinDeformType
+	*************************************************************************//**
+	*  @enum      SkinDeformType
+	*  @brief     Blend method of a vertex
+	*****************************************************************************/
+	enum class SkinDeformType : gu::uint8
+	{
+		Linear,         // BDEF1, BDEF2, BDEF4
+		Spherical,      // SDEF (two bones)
+		DualQuaternion, // QDEF
+	};
+
+	/****************************************************************************
+	*				  			SkinDeformData
+	*************************************************************************//**
+	*  @struct    SkinDeformData
+	*  @brief     Per vertex deform method and the SDEF parameters (model space)
+	*****************************************************************************/
+	struct SkinDeformData
+	{
+		SkinDeformType Type   = SkinDeformType::Linear;
+		gm::Float3     SDefC  = gm::Float3(0.0f, 0.0f, 0.0f);
+		gm::Float3     SDefR0 = gm::Float3(0.0f, 0.0f, 0.0f);
+		gm::Float3     SDefR1 = gm::Float3(0.0f, 0.0f, 0.0f);
+	};
+
+	/****************************************************************************
+	*				  			SkinnedVertex
+	*************************************************************************//**
+	*  @struct    SkinnedVertex
+	*  @brief     Output vertex of the CPU skinning (24 bytes)
+	*****************************************************************************/
+	struct SkinnedVertex
+	{
+		gm::Float3 Position;
+		gm::Float3 Normal;
+	};
+
+	/****************************************************************************
+	*				  			SkinningSource
+	*************************************************************************//**
+	*  @class     SkinningSource
+	*  @brief     Immutable bind pose vertices of a skin mesh shared by every instance
+	*****************************************************************************/
+	class SkinningSource : public gu::NonCopyable
+	{
+	public:
+		/****************************************************************************
+		**                Static Configuration
+		*****************************************************************************/
+		/* @brief : The SoA arrays are padded to this count*/
+		static constexpr gu::uint32 VERTEX_ALIGNMENT = 8;
+
+		static constexpr gu::uint32 MAX_INFLUENCE_COUNT = 4;
+
+		/* @brief : Bone weights sorted in descending order. The unused slots have the weight 0 and the bone 0.*/
+		struct Influence
+		{
+			float      Weights[MAX_INFLUENCE_COUNT] = {};
+			gu::uint16 Bones  [MAX_INFLUENCE_COUNT] = {};
+		};
+
+		/* @brief : SDEF vertex. CR0 / CR1 are the midpoints of C and the corrected R0 / R1.*/
+		struct SphericalVertex
+		{
+			gu::uint32 Index   = 0;
+			gu::uint16 Bones[2] = {};
+			float      Weight0 = 1.0f;
+			gm::Float3 C       = gm::Float3(0.0f, 0.0f, 0.0f);
+			gm::Float3 CR0     = gm::Float3(0.0f, 0.0f, 0.0f);
+			gm::Float3 CR1     = gm::Float3(0.0f, 0.0f, 0.0f);
+		};
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		gu::uint32 GetVertexCount() const noexcept { return _vertexCount; }
+
+		gu::uint32 GetBoneCount() const noexcept { return _boneCount; }
+
+		/* @brief : SoA bind pose (padded to VERTEX_ALIGNMENT)*/
+		const float* GetPositions(const gu::uint32 axis) const noexcept { return _positions[axis].Data(); }
+
+		const float* GetNormals(const gu::uint32 axis) const noexcept { return _normals[axis].Data(); }
+
+		const Influence* GetInfluences() const noexcept { return _influences.Data(); }
+
+		const gu::DynamicArray<SphericalVertex>& GetSphericalVertices() const noexcept { return _sphericalVertices; }
+
+		const gu::DynamicArray<gu::uint32>& GetDualQuaternionVertices() const noexcept { return _dualQuaternionVertices; }
+
+		/* @brief : The palette needs the dual quaternions (SDEF or QDEF vertices exist)*/
+		bool RequiresDualQuaternions() const noexcept { return !_sphericalVertices.IsEmpty() || !_dualQuaternionVertices.IsEmpty(); }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		SkinningSource() = default;
+
+		/* @brief : Bone indices outside [0, boneCount) are ignored and the weights are normalized.
+		            deforms is per vertex and may be nullptr (all vertices use the linear blend).*/
+		SkinningSource(const gm::SkinMeshVertex* vertices, const gu::uint32 vertexCount, const gu::uint32 boneCount, const SkinDeformData* deforms = nullptr);
+
+		~SkinningSource() = default;
+
+	protected:
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		gu::uint32 _vertexCount = 0;
+		gu::uint32 _boneCount   = 0;
+
+		gu::DynamicArray<float> _positions[3] = {};
+		gu::DynamicArray<float> _normals  [3] = {};
+
+		gu::DynamicArray<Influence> _influences = {};
+
+		gu::DynamicArray<SphericalVertex> _sphericalVertices = {};
+
+		gu::DynamicArray<gu::uint32> _dualQuaternionVertices = {};
+	};
+
+	/****************************************************************************
+	*				  			SkinningJob
+	*************************************************************************//**
+	*  @struct    SkinningJob
+	*  @brief     One character of ExecuteAll. The palette and the destination belong to the job.
+	*****************************************************************************/
+	struct SkinningJob
+	{
+		const animation::Skeleton* Skeleton    = nullptr;
+		const LocalPose*           Pose        = nullptr;
+		SkinningPalette*           Palette     = nullptr;
+		const SkinningSource*      Source      = nullptr;
+		SkinnedVertex*             Destination = nullptr; // Source->GetVertexCount() vertices
+	};
+
+	/****************************************************************************
+	*				  			CPUSkinning
+	*************************************************************************//**
+	*  @class     CPUSkinning
+	*  @brief     Skinning kernels and the parallel dispatch of the characters
+	*****************************************************************************/
+	class CPUSkinning : public gu::NonCopyAndMove
+	{
+	public:
+		/****************************************************************************
+		**                Static Configuration
+		*****************************************************************************/
+		/* @brief : Vertices per parallel job. Smaller characters are merged into one job.*/
+		static constexpr gu::uint32 PARALLEL_VERTEX_COUNT = 16384;
+
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Skin every vertex of the source with the palette. The destination may be write-combined memory.*/
+		static void Skin(const SkinningSource& source, const SkinningPalette& palette, SkinnedVertex* destination);
+
+		/* @brief : ComputePalette and Skin of one character*/
+		static void Execute(const SkinningJob& job);
+
+		/* @brief : Execute the jobs in parallel on the thread pool (serial if the pool is nullptr).
+		            A palette or a destination can appear only once.*/
+		static void ExecuteAll(const SkinningJob* jobs, const gu::uint32 jobCount, gu::ThreadPool* threadPool = nullptr);
+
+		/* @brief : Destination range of the source in the current frame upload buffer*/
+		static FrameUploadAllocation AllocateDestination(FrameUploadAllocator& allocator, const SkinningSource& source);
+	};
+}
+
+#endif
@@ -0,0 +1,206 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   CompressedMotionClip.hpp
+///             @brief  Error bounded compressed bone motion for the crowds and the long motions.
+///                     - The motion is resampled at the uniform frame rate (MotionSamples), so the sampling
+///                       needs no key search and no Bezier curve.
+///                     - Each track stores its value ranges, and the samples are quantized in the range
+///                       with the per track bit rate (0 bits : constant). The rotations are packed as
+///                       the smallest three components and the index of the largest one.
+///                     - The bit rates are the lowest ones whose error of the virtual vertices
+///                       (ShellDistance from each bone) in the model space stays under Tolerance.
+///                     - The samples are stored frame by frame, so a pose is two contiguous bit ranges.
+///                       The tracks are dequantized 4 at a time (SSE).
+///             How To: clip = CompressedMotionClip(MotionSamples::Resample(motionClip), &skeleton)
+///                     binding = clip.Bind(boneNames) -> clip.Sample(frame, binding, pose)
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef COMPRESSED_MOTION_CLIP_HPP
+#define COMPRESSED_MOTION_CLIP_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "MotionPlayer.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gc::animation
+{
+	class Skeleton;
+
+	/****************************************************************************
+	*				  			MotionSamples
+	*************************************************************************//**
+	*  @struct    MotionSamples
+	*  @brief     Uncompressed motion sampled at the uniform frame rate (input of the compression).
+	*             A glTF animation resampled at the frame rate can be stored here as well.
+	*****************************************************************************/
+	struct MotionSamples
+	{
+		/* @brief : Track names (UTF-8)*/
+		gu::DynamicArray<std::string> TrackNames = {};
+
+		/* @brief : [track * SampleCount + sample], the offset from the bind pose*/
+		gu::DynamicArray<gm::Float3> Translations = {};
+
+		/* @brief : [track * SampleCount + sample]*/
+		gu::DynamicArray<gm::Float4> Rotations = {};
+
+		gu::uint32 SampleCount = 0;
+
+		/* @brief : Samples per second*/
+		float SampleRate = MotionClip::FRAME_RATE;
+
+		gu::uint32 GetTrackCount() const noexcept { return static_cast<gu::uint32>(TrackNames.Size()); }
+
+		/* @brief : Sample every frame from 0 to the last key frame of the clip*/
+		static MotionSamples Resample(const MotionClip& clip);
+	};
+
+	/****************************************************************************
+	*				  			MotionCompressionSettings
+	*************************************************************************//**
+	*  @struct    MotionCompressionSettings
+	*  @brief     Error bound of the compression (model units, 1 MMD unit = 8 cm)
+	*****************************************************************************/
+	struct MotionCompressionSettings
+	{
+		/* @brief : Maximum model space error of the virtual vertices*/
+		float Tolerance = 0.01f;
+
+		/* @brief : Minimum distance of the virtual vertices from the bone
+		            (the distance to the farthest child bone is used if it is longer)*/
+		float ShellDistance = 0.5f;
+	};
+
+	/****************************************************************************
+	*				  			MotionCompressionStatistics
+	*************************************************************************//**
+	*  @struct    MotionCompressionStatistics
+	*  @brief     Result of the compression
+	*****************************************************************************/
+	struct MotionCompressionStatistics
+	{
+		/* @brief : Bytes of the MotionSamples arrays (28 bytes per track and sample)*/
+		gu::uint64 SampledSize = 0;
+
+		/* @brief : Bytes of the bit stream and the track ranges*/
+		gu::uint64 CompressedSize = 0;
+
+		/* @brief : Measured maximum error of the virtual vertices at the samples*/
+		float MaxError = 0.0f;
+
+		float AverageRotationBits    = 0.0f;
+		float AverageTranslationBits = 0.0f;
+
+		gu::uint32 ConstantRotationCount    = 0;
+		gu::uint32 ConstantTranslationCount = 0;
+
+		/* @brief : Error evaluations of the skeleton (1 : the first bit rates were enough)*/
+		gu::uint32 OptimizationPassCount = 0;
+	};
+
+	/****************************************************************************
+	*				  			CompressedMotionClip
+	*************************************************************************//**
+	*  @class     CompressedMotionClip
+	*  @brief     Immutable compressed motion shared by every instance which plays it
+	*****************************************************************************/
+	class CompressedMotionClip : public gu::NonCopyable
+	{
+	public:
+		/****************************************************************************
+		**                Static Configuration
+		*****************************************************************************/
+		/* @brief : Bit rates of a value. 1 and 2 bits are skipped (0 bits is the range center).
+		            3 values of the maximum rate fit in one 64 bit read.*/
+		static constexpr gu::uint8 MIN_BIT_RATE = 3;
+		static constexpr gu::uint8 MAX_BIT_RATE = 19;
+
+		/* @brief : Tracks dequantized at a time (the track arrays are padded to this count)*/
+		static constexpr gu::uint32 TRACK_ALIGNMENT = 4;
+
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Map the tracks to the skeleton by the bone name (UTF-8)*/
+		MotionBinding Bind(const gu::string* boneNames, const gu::uint32 boneCount) const;
+
+		MotionBinding Bind(const gu::DynamicArray<gu::string>& boneNames) const { return Bind(boneNames.Data(), static_cast<gu::uint32>(boneNames.Size())); }
+
+		/* @brief : Write the local pose at the frame (clamped to [0, GetFrameCount()]).
+		            The samples are interpolated linearly (nlerp for the rotation). The bones without a track are not written.*/
+		void Sample(const float frame, const MotionBinding& binding, LocalPose& pose) const;
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		gu::uint32 GetTrackCount() const noexcept { return static_cast<gu::uint32>(_trackNames.Size()); }
+
+		gu::uint32 GetSampleCount() const noexcept { return _sampleCount; }
+
+		float GetSampleRate() const noexcept { return _sampleRate; }
+
+		/* @brief : Last frame (in samples)*/
+		float GetFrameCount() const noexcept { return _sampleCount > 0 ? static_cast<float>(_sampleCount - 1) : 0.0f; }
+
+		const gu::DynamicArray<std::string>& GetTrackNames() const noexcept { return _trackNames; }
+
+		const MotionCompressionStatistics& GetStatistics() const noexcept { return _statistics; }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		CompressedMotionClip() = default;
+
+		/* @brief : Compress the samples. The skeleton gives the hierarchy of the error measurement;
+		            without it every track is measured as a root bone.*/
+		CompressedMotionClip(const MotionSamples& samples, const Skeleton* skeleton = nullptr, const MotionCompressionSettings& settings = {});
+
+		~CompressedMotionClip() = default;
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+		/* @brief : Dequantize 4 tracks of the samples f0 and f1 and write them to the pose*/
+		void SampleTracks(const gu::uint32 firstTrack, const gu::uint64 bitOffset0, const gu::uint64 bitOffset1, const float alpha,
+			const MotionBinding& binding, LocalPose& pose) const;
+
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		gu::DynamicArray<std::string> _trackNames = {};
+
+		/* @brief : Frame major bit stream (padded by 8 bytes for the 64 bit reads)*/
+		gu::DynamicArray<gu::uint8> _stream = {};
+
+		/* @brief : Per track layout (padded to TRACK_ALIGNMENT)*/
+		gu::DynamicArray<gu::uint32> _bitOffsets       = {}; // offset in a frame
+		gu::DynamicArray<gu::uint8>  _indexBits        = {}; // 0 : the largest component is always _constantIndices
+		gu::DynamicArray<gu::uint8>  _constantIndices  = {};
+		gu::DynamicArray<gu::uint8>  _rotationBits     = {};
+		gu::DynamicArray<gu::uint8>  _translationBits  = {};
+
+		/* @brief : value = quantized * scale + offset (3 rotation slots and 3 translation axes, SoA)*/
+		gu::DynamicArray<float> _rotationScales     [3] = {};
+		gu::DynamicArray<float> _rotationOffsets    [3] = {};
+		gu::DynamicArray<float> _translationScales  [3] = {};
+		gu::DynamicArray<float> _translationOffsets [3] = {};
+
+		gu::uint64 _frameBitCount = 0;
+		gu::uint32 _sampleCount   = 0;
+		float      _sampleRate    = MotionClip::FRAME_RATE;
+
+		MotionCompressionStatistics _statistics = {};
+	};
+}
+
+#endif
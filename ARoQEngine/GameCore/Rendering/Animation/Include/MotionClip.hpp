@@ -0,0 +1,238 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   MotionClip.hpp
+///             @brief  Bone motion converted from a VMD file for the runtime sampling.
+///                     - The keys are grouped by bone and sorted by frame
+///                     - Each Bezier curve of the VMD interpolation block is baked into a lookup table of x(s)
+///                       at uniform curve parameters s. The sampling finds s from the table, refines it
+///                       by one Newton step and returns y(s). The keys refer to the curves by index,
+///                       so the identical curves share one table and the linear curves need no table.
+///             How To: clip = MotionClip(vmdFile) -> binding = clip.Bind(boneNames) -> MotionPlayer
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef MOTION_CLIP_HPP
+#define MOTION_CLIP_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/Base/Include/GUClassUtility.hpp"
+#include "GameUtility/Base/Include/GUString.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+#include "GameUtility/Math/Include/GMVector.hpp"
+#include <algorithm>
+#include <string>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace vmd
+{
+	class  VMDFile;
+	struct VMDBoneKeyFrame;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gc::animation
+{
+	/****************************************************************************
+	*				  			MotionChannel
+	*************************************************************************//**
+	*  @enum      MotionChannel
+	*  @brief     Interpolation curves held by a bone key (the VMD order)
+	*****************************************************************************/
+	enum class MotionChannel : gu::uint8
+	{
+		TranslationX,
+		TranslationY,
+		TranslationZ,
+		Rotation,
+		CountOf
+	};
+
+	/****************************************************************************
+	*				  			MotionKey
+	*************************************************************************//**
+	*  @struct    MotionKey
+	*  @brief     One bone key. Curves are used for the segment from the previous key to this key.
+	*****************************************************************************/
+	struct MotionKey
+	{
+		float      Frame       = 0.0f;
+		gm::Float3 Translation = gm::Float3(0.0f, 0.0f, 0.0f); // offset from the bind pose
+		gm::Float4 Rotation    = gm::Float4(0.0f, 0.0f, 0.0f, 1.0f);
+
+		/* @brief : Index of the baked curve of each MotionChannel (LINEAR_CURVE : no table)*/
+		gu::uint16 Curves[static_cast<size_t>(MotionChannel::CountOf)] = {};
+	};
+
+	/****************************************************************************
+	*				  			MotionCurve
+	*************************************************************************//**
+	*  @struct    MotionCurve
+	*  @brief     Baked cubic Bezier curve (0, 0) - (x1, y1) - (x2, y2) - (1, 1)
+	*****************************************************************************/
+	struct MotionCurve
+	{
+		static constexpr gu::uint32 TABLE_SIZE = 16;
+
+		/* @brief : x(s) at s = i / TABLE_SIZE (monotonic, X[0] = 0, X[TABLE_SIZE] = 1)*/
+		float X[TABLE_SIZE + 1] = {};
+
+		/* @brief : x(s) = ((a * s + b) * s + c) * s, the same form for y(s)*/
+		float XCoefficients[3] = {};
+		float YCoefficients[3] = {};
+	};
+
+	/****************************************************************************
+	*				  			MotionTrack
+	*************************************************************************//**
+	*  @struct    MotionTrack
+	*  @brief     Key range of one bone
+	*****************************************************************************/
+	struct MotionTrack
+	{
+		std::string BoneName   = ""; // UTF-8
+		gu::uint32  KeyOffset  = 0;
+		gu::uint32  KeyCount   = 0;
+	};
+
+	/****************************************************************************
+	*				  			MotionBinding
+	*************************************************************************//**
+	*  @struct    MotionBinding
+	*  @brief     Track -> skeleton bone index (INVALID_BONE : the model has no such bone)
+	*****************************************************************************/
+	struct MotionBinding
+	{
+		static constexpr gu::uint32 INVALID_BONE = 0xFFFFFFFF;
+
+		gu::DynamicArray<gu::uint32> TrackToBone = {};
+
+		/* @brief : Bone count of the skeleton (size of the sampled pose)*/
+		gu::uint32 BoneCount = 0;
+	};
+
+	/****************************************************************************
+	*				  			MotionClip
+	*************************************************************************//**
+	*  @class     MotionClip
+	*  @brief     Immutable bone motion shared by every instance which plays it
+	*****************************************************************************/
+	class MotionClip : public gu::NonCopyable
+	{
+	public:
+		/****************************************************************************
+		**                Static Configuration
+		*****************************************************************************/
+		/* @brief : Frames per second of the MMD motion*/
+		static constexpr float FRAME_RATE = 30.0f;
+
+		/* @brief : Curve index of the linear interpolation*/
+		static constexpr gu::uint16 LINEAR_CURVE = 0;
+
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Map the tracks to the skeleton by the bone name (UTF-8, e.g. pmx::PMXBone::BoneName)*/
+		MotionBinding Bind(const gu::string* boneNames, const gu::uint32 boneCount) const;
+
+		MotionBinding Bind(const gu::DynamicArray<gu::string>& boneNames) const { return Bind(boneNames.Data(), static_cast<gu::uint32>(boneNames.Size())); }
+
+		/* @brief : Evaluate the baked curve at t ([0, 1] time ratio of the segment)*/
+		__forceinline float EvaluateCurve(const gu::uint16 curve, const float t) const
+		{
+			if (curve == LINEAR_CURVE) { return t; }
+
+			const auto& baked = _curves[static_cast<gu::uint64>(curve) - 1];
+
+			/*-------------------------------------------------------------------
+			-   Table interval which contains t (binary search)
+			---------------------------------------------------------------------*/
+			gu::uint32 lower = 0, upper = MotionCurve::TABLE_SIZE;
+			while (upper - lower > 1)
+			{
+				const auto middle = (lower + upper) >> 1;
+				if (baked.X[middle] <= t) { lower = middle; } else { upper = middle; }
+			}
+
+			/*-------------------------------------------------------------------
+			-   Linear guess of s in the interval, then one Newton step on x(s) = t
+			---------------------------------------------------------------------*/
+			constexpr float step = 1.0f / static_cast<float>(MotionCurve::TABLE_SIZE);
+			const float width = baked.X[upper] - baked.X[lower];
+			const float sMin  = static_cast<float>(lower) * step;
+			float s = sMin + (width > 0.0f ? (t - baked.X[lower]) / width : 0.0f) * step;
+
+			const auto* xc    = baked.XCoefficients;
+			const float x     = ((xc[0] * s + xc[1]) * s + xc[2]) * s;
+			const float slope = (3.0f * xc[0] * s + 2.0f * xc[1]) * s + xc[2];
+			if (slope > 1e-6f) { s = (std::min)((std::max)(s - (x - t) / slope, sMin), sMin + step); }
+
+			const auto* yc = baked.YCoefficients;
+			return ((yc[0] * s + yc[1]) * s + yc[2]) * s;
+		}
+
+		/* @brief : Exact VMD Bezier curve (control points 0 - 127) solved by the Newton method. Used for the baking.*/
+		static float SolveBezier(const gu::uint8 x1, const gu::uint8 y1, const gu::uint8 x2, const gu::uint8 y2, const float t);
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		const gu::DynamicArray<MotionTrack>& GetTracks() const noexcept { return _tracks; }
+
+		const MotionKey* GetKeys() const noexcept { return _keys.Data(); }
+
+		gu::uint32 GetTrackCount() const noexcept { return static_cast<gu::uint32>(_tracks.Size()); }
+
+		gu::uint32 GetKeyCount() const noexcept { return static_cast<gu::uint32>(_keys.Size()); }
+
+		/* @brief : Baked curve count (identical curves are shared, the linear curve has no table)*/
+		gu::uint32 GetCurveCount() const noexcept { return static_cast<gu::uint32>(_curves.Size()); }
+
+		/* @brief : Last key frame*/
+		float GetFrameCount() const noexcept { return _frameCount; }
+
+		/* @brief : Track index of the bone (UTF-8 name), INVALID_TRACK if the motion does not move it*/
+		gu::uint32 FindTrack(const std::string& boneName) const;
+
+		static constexpr gu::uint32 INVALID_TRACK = 0xFFFFFFFF;
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		MotionClip() = default;
+
+		/* @brief : The VMD bone names (Shift-JIS) are converted to UTF-8*/
+		explicit MotionClip(const vmd::VMDFile& file);
+
+		/* @brief : Bone names of the frames have to be UTF-8*/
+		MotionClip(const vmd::VMDBoneKeyFrame* frames, const gu::uint64 frameCount);
+
+		~MotionClip() = default;
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+		void Build(const vmd::VMDBoneKeyFrame* frames, const gu::uint64 frameCount, const bool isShiftJIS);
+
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		gu::DynamicArray<MotionTrack> _tracks = {};
+
+		/* @brief : Keys of every track, the keys of a track are contiguous and sorted by frame*/
+		gu::DynamicArray<MotionKey> _keys = {};
+
+		/* @brief : Baked curves, the curve index of the keys - 1*/
+		gu::DynamicArray<MotionCurve> _curves = {};
+
+		float _frameCount = 0.0f;
+	};
+}
+
+#endif
@@ -0,0 +1,150 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   MotionPlayer.hpp
+///             @brief  Per instance playback state of a MotionClip.
+///                     - Each track keeps a cursor to the last used key, so the forward playback
+///                       finds the key pair in O(1). Seeking or looping falls back to a binary search.
+///                       The output is the local TRS of every bone in the SoA layout.
+///                     - SampleAll samples many instances in parallel on a thread pool.
+///             How To: player.SetClip(&clip, &binding) -> player.Advance(deltaTime) -> player.Sample() -> player.GetPose()
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef MOTION_PLAYER_HPP
+#define MOTION_PLAYER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "MotionClip.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace gu
+{
+	class ThreadPool;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gc::animation
+{
+	/****************************************************************************
+	*				  			LocalPose
+	*************************************************************************//**
+	*  @struct    LocalPose
+	*  @brief     Local translation (offset from the bind pose), rotation and scale of each bone.
+	*             Each component is a separate array so the skinning and the blending can process bones in SIMD width.
+	*****************************************************************************/
+	struct LocalPose
+	{
+		gu::DynamicArray<float> TranslationX = {};
+		gu::DynamicArray<float> TranslationY = {};
+		gu::DynamicArray<float> TranslationZ = {};
+		gu::DynamicArray<float> RotationX    = {};
+		gu::DynamicArray<float> RotationY    = {};
+		gu::DynamicArray<float> RotationZ    = {};
+		gu::DynamicArray<float> RotationW    = {};
+		gu::DynamicArray<float> ScaleX       = {};
+		gu::DynamicArray<float> ScaleY       = {};
+		gu::DynamicArray<float> ScaleZ       = {};
+
+		/* @brief : Allocate the arrays and set the identity transform*/
+		void Resize(const gu::uint32 boneCount);
+
+		/* @brief : Zero translation, identity rotation and unit scale*/
+		void SetIdentity();
+
+		gu::uint32 GetBoneCount() const noexcept { return static_cast<gu::uint32>(RotationW.Size()); }
+	};
+
+	/****************************************************************************
+	*				  			MotionPlayer
+	*************************************************************************//**
+	*  @class     MotionPlayer
+	*  @brief     Playback of a shared MotionClip by one character
+	*****************************************************************************/
+	class MotionPlayer
+	{
+	public:
+		/****************************************************************************
+		**                Static Configuration
+		*****************************************************************************/
+		/* @brief : Keys stepped from the cursor before the binary search is used*/
+		static constexpr gu::uint32 CURSOR_STEP_COUNT = 4;
+
+		/* @brief : Minimum instance count of a parallel job*/
+		static constexpr gu::uint32 PARALLEL_BATCH_SIZE = 8;
+
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Start the clip from the frame 0. The clip and the binding have to outlive the player.*/
+		void SetClip(const MotionClip* clip, const MotionBinding* binding);
+
+		/* @brief : Advance the playback time (seconds, 30 frames per second)*/
+		void Advance(const float deltaTime);
+
+		/* @brief : Write the local pose of the current frame. The bones without a track keep the identity.*/
+		void Sample();
+
+		/* @brief : Sample the players in parallel jobs on the thread pool (serial if the pool is nullptr).
+		            A player can appear only once.*/
+		static void SampleAll(MotionPlayer* const* players, const gu::uint32 playerCount, gu::ThreadPool* threadPool = nullptr);
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		const LocalPose& GetPose() const noexcept { return _pose; }
+
+		const MotionClip* GetClip() const noexcept { return _clip; }
+
+		float GetFrame() const noexcept { return _frame; }
+
+		/* @brief : Seeking is allowed in any direction, the next Sample searches the keys again.*/
+		void SetFrame(const float frame) noexcept { _frame = frame; }
+
+		float GetSpeed() const noexcept { return _speed; }
+
+		void SetSpeed(const float speed) noexcept { _speed = speed; }
+
+		bool IsLoop() const noexcept { return _isLoop; }
+
+		void SetLoop(const bool isLoop) noexcept { _isLoop = isLoop; }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		MotionPlayer() = default;
+
+		MotionPlayer(const MotionClip* clip, const MotionBinding* binding) { SetClip(clip, binding); }
+
+		~MotionPlayer() = default;
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+		/* @brief : Index of the last key whose frame is less than or equal to the current frame (0 if the frame is before the first key)*/
+		gu::uint32 FindKey(const MotionKey* keys, const gu::uint32 keyCount, gu::uint32 cursor) const;
+
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		const MotionClip*    _clip    = nullptr;
+		const MotionBinding* _binding = nullptr;
+
+		/* @brief : Last used key of each track (index in the track)*/
+		gu::DynamicArray<gu::uint32> _cursors = {};
+
+		LocalPose _pose = {};
+
+		float _frame  = 0.0f;
+		float _speed  = 1.0f;
+		bool  _isLoop = true;
+	};
+}
+
+#endif
@@ -0,0 +1,137 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   Skeleton.hpp
+///             @brief  Bone hierarchy of a skin mesh model and the skinning palette built from a local pose.
+///                     - The bind pose is the model space bone position (PMX style, no bind rotation).
+///                     - The bones are evaluated parent-before-child even if the file stores a child first.
+///                     - The palette holds the model space bone matrices and the skin matrices
+///                       (bind -> current pose, transposed 3x4 rows). The dual quaternions used by
+///                       SDEF / QDEF vertices are computed only when they are requested.
+///             How To: skeleton.ComputePalette(player.GetPose(), palette, source.RequiresDualQuaternions())
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef SKELETON_HPP
+#define SKELETON_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "MotionPlayer.hpp"
+#include "GameUtility/Math/Include/GMMatrix.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gc::animation
+{
+	/****************************************************************************
+	*				  			SkeletonBone
+	*************************************************************************//**
+	*  @struct    SkeletonBone
+	*  @brief     Bone description (e.g. pmx::PMXBone)
+	*****************************************************************************/
+	struct SkeletonBone
+	{
+		gu::string Name        = {}; // UTF-8
+		gu::int32  ParentIndex = -1; // -1 : root
+		gm::Float3 Position    = gm::Float3(0.0f, 0.0f, 0.0f); // model space bind position
+	};
+
+	/****************************************************************************
+	*				  			SkinningDualQuaternion
+	*************************************************************************//**
+	*  @struct    SkinningDualQuaternion
+	*  @brief     Rigid part of a skin matrix (unit real part, the scale is ignored)
+	*****************************************************************************/
+	struct SkinningDualQuaternion
+	{
+		gm::Float4 Real = gm::Float4(0.0f, 0.0f, 0.0f, 1.0f);
+		gm::Float4 Dual = gm::Float4(0.0f, 0.0f, 0.0f, 0.0f);
+	};
+
+	/****************************************************************************
+	*				  			SkinningPalette
+	*************************************************************************//**
+	*  @struct    SkinningPalette
+	*  @brief     Per character bone transforms of one frame
+	*****************************************************************************/
+	struct SkinningPalette
+	{
+		/* @brief : Model space transform of each bone (row vector)*/
+		gu::DynamicArray<gm::Float4x4> BoneMatrices = {};
+
+		/* @brief : Bind pose -> current pose. Row r holds the coefficients of the output component r,
+		            which is also the float3x4 layout of the shader constant buffer.*/
+		gu::DynamicArray<gm::Float3x4> SkinMatrices = {};
+
+		/* @brief : Filled only when ComputePalette is called with useDualQuaternions.
+		            The real part is the model space rotation of the bone.*/
+		gu::DynamicArray<SkinningDualQuaternion> DualQuaternions = {};
+
+		gu::uint32 GetBoneCount() const noexcept { return static_cast<gu::uint32>(SkinMatrices.Size()); }
+	};
+
+	/****************************************************************************
+	*				  			Skeleton
+	*************************************************************************//**
+	*  @class     Skeleton
+	*  @brief     Immutable bone hierarchy shared by every instance of a model
+	*****************************************************************************/
+	class Skeleton : public gu::NonCopyable
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Local pose (offset from the bind pose) -> model space bone matrices and skin matrices.
+		            The bone count of the pose has to be the bone count of the skeleton.*/
+		void ComputePalette(const LocalPose& pose, SkinningPalette& palette, const bool useDualQuaternions = false) const;
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		gu::uint32 GetBoneCount() const noexcept { return static_cast<gu::uint32>(_parents.Size()); }
+
+		/* @brief : Bone names for MotionClip::Bind*/
+		const gu::DynamicArray<gu::string>& GetBoneNames() const noexcept { return _boneNames; }
+
+		gu::int32 GetParentIndex(const gu::uint32 bone) const noexcept { return _parents[bone]; }
+
+		const gm::Float3& GetBindPosition(const gu::uint32 bone) const noexcept { return _bindPositions[bone]; }
+
+		/* @brief : Bone indices sorted so that every parent comes before its children*/
+		const gu::DynamicArray<gu::uint32>& GetEvaluationOrder() const noexcept { return _evaluationOrder; }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		Skeleton() = default;
+
+		/* @brief : Invalid parent indices and the parent cycles are treated as the root*/
+		Skeleton(const SkeletonBone* bones, const gu::uint32 boneCount);
+
+		~Skeleton() = default;
+
+	protected:
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		gu::DynamicArray<gu::string> _boneNames = {};
+
+		gu::DynamicArray<gu::int32> _parents = {};
+
+		gu::DynamicArray<gm::Float3> _bindPositions = {};
+
+		/* @brief : Bind position - parent bind position*/
+		gu::DynamicArray<gm::Float3> _bindLocalTranslations = {};
+
+		gu::DynamicArray<gu::uint32> _evaluationOrder = {};
+	};
+}
+
+#endif
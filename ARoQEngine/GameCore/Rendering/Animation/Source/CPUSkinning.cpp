@@ -0,0 +1,580 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   CPUSkinning.cpp
+///             @brief  CPU vertex skinning for crowds.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/CPUSkinning.hpp"
+#include "GraphicsCore/Engine/Include/FrameUploadAllocator.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include "GameUtility/Memory/Include/GUMemoryTracker.hpp"
+#include "GameUtility/Thread/Public/Include/GUThreadPool.hpp"
+#include "GameUtility/Math/Private/Simd/Include/GMSimdMacros.hpp"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#if PLATFORM_CPU_INSTRUCTION_AVX2
+	#include <immintrin.h>
+#elif PLATFORM_CPU_INSTRUCTION_SSE2
+	#include <emmintrin.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace gc::animation;
+
+namespace
+{
+	using gu::uint16;
+	using gu::uint32;
+	using gu::uint64;
+
+	using Influence       = SkinningSource::Influence;
+	using SphericalVertex = SkinningSource::SphericalVertex;
+
+	/*-------------------------------------------------------------------
+	-   Point transform by a skin matrix (transposed 3x4 rows)
+	---------------------------------------------------------------------*/
+	gm::Float3 TransformPoint(const gm::Float3x4& matrix, const gm::Float3& point)
+	{
+		const float* m = matrix.u.a;
+		return gm::Float3(
+			m[0] * point.x + m[1] * point.y + m[2]  * point.z + m[3],
+			m[4] * point.x + m[5] * point.y + m[6]  * point.z + m[7],
+			m[8] * point.x + m[9] * point.y + m[10] * point.z + m[11]);
+	}
+
+	/*-------------------------------------------------------------------
+	-   Rotation of a unit quaternion (x, y, z, w)
+	---------------------------------------------------------------------*/
+	gm::Float3 Rotate(const gm::Float4& q, const gm::Float3& v)
+	{
+		// v + 2w (q.xyz x v) + 2 q.xyz x (q.xyz x v)
+		const float tx = 2.0f * (q.y * v.z - q.z * v.y);
+		const float ty = 2.0f * (q.z * v.x - q.x * v.z);
+		const float tz = 2.0f * (q.x * v.y - q.y * v.x);
+		return gm::Float3(
+			v.x + q.w * tx + (q.y * tz - q.z * ty),
+			v.y + q.w * ty + (q.z * tx - q.x * tz),
+			v.z + q.w * tz + (q.x * ty - q.y * tx));
+	}
+
+	gm::Float3 Normalize(const gm::Float3& v)
+	{
+		const float lengthSquared = v.x * v.x + v.y * v.y + v.z * v.z;
+		const float inverse       = lengthSquared > 1e-12f ? 1.0f / std::sqrt(lengthSquared) : 0.0f;
+		return gm::Float3(v.x * inverse, v.y * inverse, v.z * inverse);
+	}
+
+	/*-------------------------------------------------------------------
+	-   Shortest path slerp of unit quaternions (nlerp when they are almost the same)
+	---------------------------------------------------------------------*/
+	gm::Float4 Slerp(const gm::Float4& start, gm::Float4 end, const float t)
+	{
+		float cosine = start.x * end.x + start.y * end.y + start.z * end.z + start.w * end.w;
+		if (cosine < 0.0f)
+		{
+			cosine = -cosine;
+			end    = gm::Float4(-end.x, -end.y, -end.z, -end.w);
+		}
+
+		float startWeight = 1.0f - t;
+		float endWeight   = t;
+		if (cosine < 0.9995f)
+		{
+			const float angle   = std::acos(cosine);
+			const float inverse = 1.0f / std::sin(angle);
+			startWeight = std::sin(startWeight * angle) * inverse;
+			endWeight   = std::sin(endWeight   * angle) * inverse;
+		}
+
+		gm::Float4 result(
+			start.x * startWeight + end.x * endWeight,
+			start.y * startWeight + end.y * endWeight,
+			start.z * startWeight + end.z * endWeight,
+			start.w * startWeight + end.w * endWeight);
+
+		const float length  = std::sqrt(result.x * result.x + result.y * result.y + result.z * result.z + result.w * result.w);
+		const float inverse = length > 1e-8f ? 1.0f / length : 0.0f;
+		return gm::Float4(result.x * inverse, result.y * inverse, result.z * inverse, result.w * inverse);
+	}
+
+	#if PLATFORM_CPU_INSTRUCTION_SSE2 || PLATFORM_CPU_INSTRUCTION_AVX2
+	/*-------------------------------------------------------------------
+	-   Weighted sum of the skin matrices of a vertex (3 rows)
+	---------------------------------------------------------------------*/
+	__forceinline void BlendMatrices(const Influence& influence, const gm::Float3x4* matrices, __m128& row0, __m128& row1, __m128& row2)
+	{
+	#if PLATFORM_CPU_INSTRUCTION_AVX2
+		// rows 0 and 1 are blended in one 256 bit register
+		const float* m      = matrices[influence.Bones[0]].u.a;
+		__m256       weight = _mm256_set1_ps(influence.Weights[0]);
+		__m256       row01  = _mm256_mul_ps(weight, _mm256_loadu_ps(m));
+		row2 = _mm_mul_ps(_mm256_castps256_ps128(weight), _mm_loadu_ps(m + 8));
+
+		for (uint32 k = 1; k < SkinningSource::MAX_INFLUENCE_COUNT; ++k)
+		{
+			if (influence.Weights[k] == 0.0f) { break; }
+			m      = matrices[influence.Bones[k]].u.a;
+			weight = _mm256_set1_ps(influence.Weights[k]);
+			row01  = _mm256_add_ps(row01, _mm256_mul_ps(weight, _mm256_loadu_ps(m)));
+			row2   = _mm_add_ps(row2, _mm_mul_ps(_mm256_castps256_ps128(weight), _mm_loadu_ps(m + 8)));
+		}
+
+		row0 = _mm256_castps256_ps128(row01);
+		row1 = _mm256_extractf128_ps(row01, 1);
+	#else
+		const float* m      = matrices[influence.Bones[0]].u.a;
+		__m128       weight = _mm_set1_ps(influence.Weights[0]);
+		row0 = _mm_mul_ps(weight, _mm_loadu_ps(m));
+		row1 = _mm_mul_ps(weight, _mm_loadu_ps(m + 4));
+		row2 = _mm_mul_ps(weight, _mm_loadu_ps(m + 8));
+
+		for (uint32 k = 1; k < SkinningSource::MAX_INFLUENCE_COUNT; ++k)
+		{
+			if (influence.Weights[k] == 0.0f) { break; }
+			m      = matrices[influence.Bones[k]].u.a;
+			weight = _mm_set1_ps(influence.Weights[k]);
+			row0   = _mm_add_ps(row0, _mm_mul_ps(weight, _mm_loadu_ps(m)));
+			row1   = _mm_add_ps(row1, _mm_mul_ps(weight, _mm_loadu_ps(m + 4)));
+			row2   = _mm_add_ps(row2, _mm_mul_ps(weight, _mm_loadu_ps(m + 8)));
+		}
+	#endif
+	}
+
+	/*-------------------------------------------------------------------
+	-   Linear blend skinning of 4 vertices at a time.
+	-   The blended rows are transposed so that the transform runs on the SoA positions.
+	---------------------------------------------------------------------*/
+	void SkinLinearSimd(const SkinningSource& source, const gm::Float3x4* matrices, SkinnedVertex* destination, const uint32 begin, const uint32 end)
+	{
+		const float* px = source.GetPositions(0); const float* py = source.GetPositions(1); const float* pz = source.GetPositions(2);
+		const float* nx = source.GetNormals(0);   const float* ny = source.GetNormals(1);   const float* nz = source.GetNormals(2);
+		const auto*  influences = source.GetInfluences();
+
+		const __m128 epsilon = _mm_set1_ps(1e-12f);
+		const __m128 one     = _mm_set1_ps(1.0f);
+
+		// begin is a multiple of 4 and the SoA arrays and the influences are padded, so the last block reads in range.
+		for (uint32 v = begin; v < end; v += 4)
+		{
+			__m128 x0, y0, z0, w0, x1, y1, z1, w1, x2, y2, z2, w2;
+			BlendMatrices(influences[v + 0], matrices, x0, x1, x2);
+			BlendMatrices(influences[v + 1], matrices, y0, y1, y2);
+			BlendMatrices(influences[v + 2], matrices, z0, z1, z2);
+			BlendMatrices(influences[v + 3], matrices, w0, w1, w2);
+
+			// row r of the 4 vertices -> (coefficient of x, y, z, translation) of the output r for each lane
+			_MM_TRANSPOSE4_PS(x0, y0, z0, w0);
+			_MM_TRANSPOSE4_PS(x1, y1, z1, w1);
+			_MM_TRANSPOSE4_PS(x2, y2, z2, w2);
+
+			const __m128 positionX = _mm_loadu_ps(px + v), positionY = _mm_loadu_ps(py + v), positionZ = _mm_loadu_ps(pz + v);
+			const __m128 normalX   = _mm_loadu_ps(nx + v), normalY   = _mm_loadu_ps(ny + v), normalZ   = _mm_loadu_ps(nz + v);
+
+			__m128 outX = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x0, positionX), _mm_mul_ps(y0, positionY)), _mm_add_ps(_mm_mul_ps(z0, positionZ), w0));
+			__m128 outY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x1, positionX), _mm_mul_ps(y1, positionY)), _mm_add_ps(_mm_mul_ps(z1, positionZ), w1));
+			__m128 outZ = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x2, positionX), _mm_mul_ps(y2, positionY)), _mm_add_ps(_mm_mul_ps(z2, positionZ), w2));
+
+			__m128 outNX = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x0, normalX), _mm_mul_ps(y0, normalY)), _mm_mul_ps(z0, normalZ));
+			__m128 outNY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x1, normalX), _mm_mul_ps(y1, normalY)), _mm_mul_ps(z1, normalZ));
+			__m128 outNZ = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x2, normalX), _mm_mul_ps(y2, normalY)), _mm_mul_ps(z2, normalZ));
+
+			const __m128 lengthSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(outNX, outNX), _mm_mul_ps(outNY, outNY)), _mm_mul_ps(outNZ, outNZ));
+			const __m128 valid         = _mm_cmpgt_ps(lengthSquared, epsilon);
+			const __m128 inverse       = _mm_and_ps(valid, _mm_div_ps(one, _mm_sqrt_ps(_mm_max_ps(lengthSquared, epsilon))));
+			outNX = _mm_mul_ps(outNX, inverse);
+			outNY = _mm_mul_ps(outNY, inverse);
+			outNZ = _mm_mul_ps(outNZ, inverse);
+
+			/*-------------------------------------------------------------------
+			-   SoA -> AoS (position xyz + normal x in 16 bytes, normal yz in 8 bytes)
+			---------------------------------------------------------------------*/
+			_MM_TRANSPOSE4_PS(outX, outY, outZ, outNX);
+			const __m128 normalYZ01 = _mm_unpacklo_ps(outNY, outNZ);
+			const __m128 normalYZ23 = _mm_unpackhi_ps(outNY, outNZ);
+
+			float* output = &destination[v].Position.x;
+			const uint32 count = (std::min)(end - v, 4u);
+			                _mm_storeu_ps(output +  0, outX ); _mm_storel_pi(reinterpret_cast<__m64*>(output +  4), normalYZ01);
+			if (count > 1) {_mm_storeu_ps(output +  6, outY ); _mm_storeh_pi(reinterpret_cast<__m64*>(output + 10), normalYZ01); }
+			if (count > 2) {_mm_storeu_ps(output + 12, outZ ); _mm_storel_pi(reinterpret_cast<__m64*>(output + 16), normalYZ23); }
+			if (count > 3) {_mm_storeu_ps(output + 18, outNX); _mm_storeh_pi(reinterpret_cast<__m64*>(output + 22), normalYZ23); }
+		}
+	}
+	#else
+	/*-------------------------------------------------------------------
+	-   Linear blend skinning of the vertices [begin, end)
+	---------------------------------------------------------------------*/
+	void SkinLinearScalar(const SkinningSource& source, const gm::Float3x4* matrices, SkinnedVertex* destination, const uint32 begin, const uint32 end)
+	{
+		const float* px = source.GetPositions(0); const float* py = source.GetPositions(1); const float* pz = source.GetPositions(2);
+		const float* nx = source.GetNormals(0);   const float* ny = source.GetNormals(1);   const float* nz = source.GetNormals(2);
+		const auto*  influences = source.GetInfluences();
+
+		for (uint32 v = begin; v < end; ++v)
+		{
+			const auto& influence = influences[v];
+
+			float blend[12] = {};
+			for (uint32 k = 0; k < SkinningSource::MAX_INFLUENCE_COUNT; ++k)
+			{
+				const float weight = influence.Weights[k];
+				if (weight == 0.0f) { break; }
+
+				const float* m = matrices[influence.Bones[k]].u.a;
+				for (uint32 e = 0; e < 12; ++e) { blend[e] += weight * m[e]; }
+			}
+
+			auto& output = destination[v];
+			output.Position = gm::Float3(
+				blend[0] * px[v] + blend[1] * py[v] + blend[2]  * pz[v] + blend[3],
+				blend[4] * px[v] + blend[5] * py[v] + blend[6]  * pz[v] + blend[7],
+				blend[8] * px[v] + blend[9] * py[v] + blend[10] * pz[v] + blend[11]);
+			output.Normal = Normalize(gm::Float3(
+				blend[0] * nx[v] + blend[1] * ny[v] + blend[2]  * nz[v],
+				blend[4] * nx[v] + blend[5] * ny[v] + blend[6]  * nz[v],
+				blend[8] * nx[v] + blend[9] * ny[v] + blend[10] * nz[v]));
+		}
+	}
+	#endif
+
+	/*-------------------------------------------------------------------
+	-   SDEF : the rotation is the slerp of the two bones, the center is blended
+	-   at the midpoints of C and R0 / R1 so that the joint does not collapse.
+	---------------------------------------------------------------------*/
+	void SkinSpherical(const SkinningSource& source, const SkinningPalette& palette, SkinnedVertex* destination)
+	{
+		const auto& spherical = source.GetSphericalVertices();
+		const float* px = source.GetPositions(0); const float* py = source.GetPositions(1); const float* pz = source.GetPositions(2);
+		const float* nx = source.GetNormals(0);   const float* ny = source.GetNormals(1);   const float* nz = source.GetNormals(2);
+
+		for (uint64 i = 0; i < spherical.Size(); ++i)
+		{
+			const auto& vertex = spherical[i];
+			const auto  index  = vertex.Index;
+			const float weight0 = vertex.Weight0;
+			const float weight1 = 1.0f - weight0;
+
+			const auto rotation = Slerp(palette.DualQuaternions[vertex.Bones[1]].Real, palette.DualQuaternions[vertex.Bones[0]].Real, weight0);
+
+			const auto center0 = TransformPoint(palette.SkinMatrices[vertex.Bones[0]], vertex.CR0);
+			const auto center1 = TransformPoint(palette.SkinMatrices[vertex.Bones[1]], vertex.CR1);
+			const auto offset  = Rotate(rotation, gm::Float3(px[index] - vertex.C.x, py[index] - vertex.C.y, pz[index] - vertex.C.z));
+
+			auto& output = destination[index];
+			output.Position = gm::Float3(
+				offset.x + center0.x * weight0 + center1.x * weight1,
+				offset.y + center0.y * weight0 + center1.y * weight1,
+				offset.z + center0.z * weight0 + center1.z * weight1);
+			output.Normal = Normalize(Rotate(rotation, gm::Float3(nx[index], ny[index], nz[index])));
+		}
+	}
+
+	/*-------------------------------------------------------------------
+	-   QDEF : dual quaternion skinning (the antipodal quaternions are aligned to the first bone)
+	---------------------------------------------------------------------*/
+	void SkinDualQuaternion(const SkinningSource& source, const SkinningPalette& palette, SkinnedVertex* destination)
+	{
+		const auto& vertices   = source.GetDualQuaternionVertices();
+		const auto* influences = source.GetInfluences();
+		const float* px = source.GetPositions(0); const float* py = source.GetPositions(1); const float* pz = source.GetPositions(2);
+		const float* nx = source.GetNormals(0);   const float* ny = source.GetNormals(1);   const float* nz = source.GetNormals(2);
+
+		for (uint64 i = 0; i < vertices.Size(); ++i)
+		{
+			const auto  index     = vertices[i];
+			const auto& influence = influences[index];
+			const auto& pivot     = palette.DualQuaternions[influence.Bones[0]].Real;
+
+			float real[4] = {}, dual[4] = {};
+			for (uint32 k = 0; k < SkinningSource::MAX_INFLUENCE_COUNT; ++k)
+			{
+				if (influence.Weights[k] == 0.0f) { break; }
+
+				const auto& dq = palette.DualQuaternions[influence.Bones[k]];
+				const float dot    = dq.Real.x * pivot.x + dq.Real.y * pivot.y + dq.Real.z * pivot.z + dq.Real.w * pivot.w;
+				const float weight = dot < 0.0f ? -influence.Weights[k] : influence.Weights[k];
+
+				real[0] += weight * dq.Real.x; real[1] += weight * dq.Real.y; real[2] += weight * dq.Real.z; real[3] += weight * dq.Real.w;
+				dual[0] += weight * dq.Dual.x; dual[1] += weight * dq.Dual.y; dual[2] += weight * dq.Dual.z; dual[3] += weight * dq.Dual.w;
+			}
+
+			const float length  = std::sqrt(real[0] * real[0] + real[1] * real[1] + real[2] * real[2] + real[3] * real[3]);
+			const float inverse = length > 1e-8f ? 1.0f / length : 0.0f;
+			const gm::Float4 r(real[0] * inverse, real[1] * inverse, real[2] * inverse, real[3] * inverse);
+			const gm::Float4 d(dual[0] * inverse, dual[1] * inverse, dual[2] * inverse, dual[3] * inverse);
+
+			// translation = 2 * dual * conjugate(real)
+			const gm::Float3 translation(
+				2.0f * (r.w * d.x - d.w * r.x + (r.y * d.z - r.z * d.y)),
+				2.0f * (r.w * d.y - d.w * r.y + (r.z * d.x - r.x * d.z)),
+				2.0f * (r.w * d.z - d.w * r.z + (r.x * d.y - r.y * d.x)));
+
+			const auto rotated = Rotate(r, gm::Float3(px[index], py[index], pz[index]));
+
+			auto& output = destination[index];
+			output.Position = gm::Float3(rotated.x + translation.x, rotated.y + translation.y, rotated.z + translation.z);
+			output.Normal   = Normalize(Rotate(r, gm::Float3(nx[index], ny[index], nz[index])));
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region SkinningSource
+/****************************************************************************
+*                     SkinningSource
+*************************************************************************//**
+*  @fn        SkinningSource::SkinningSource(const gm::SkinMeshVertex* vertices, const gu::uint32 vertexCount, const gu::uint32 boneCount, const SkinDeformData* deforms)
+*
+*  @brief     Split the vertices into the SoA streams and prepare the influences.
+*             The duplicated bones are merged, the weights are sorted in descending order
+*             (the kernel stops at the first zero weight) and normalized.
+*             A vertex without a valid influence follows the bone 0.
+*
+*  @param[in] const gm::SkinMeshVertex* vertices
+*  @param[in] const gu::uint32 vertexCount
+*  @param[in] const gu::uint32 boneCount
+*  @param[in] const SkinDeformData* deforms (per vertex, nullptr : linear)
+*
+*  @return    void
+*****************************************************************************/
+SkinningSource::SkinningSource(const gm::SkinMeshVertex* vertices, const gu::uint32 vertexCount, const gu::uint32 boneCount, const SkinDeformData* deforms)
+	: _vertexCount(vertexCount), _boneCount(boneCount)
+{
+	GU_MEMORY_TAG_SCOPE(gu::MemoryTag::Animation);
+	Check(boneCount <= 0x10000);
+
+	const uint32 paddedCount = (vertexCount + VERTEX_ALIGNMENT - 1) / VERTEX_ALIGNMENT * VERTEX_ALIGNMENT;
+	for (uint32 axis = 0; axis < 3; ++axis)
+	{
+		_positions[axis].Resize(paddedCount, true, 0.0f);
+		_normals  [axis].Resize(paddedCount, true, 0.0f);
+	}
+
+	Influence padding = {};
+	padding.Weights[0] = 1.0f;
+	_influences.Resize(paddedCount, true, padding);
+
+	for (uint32 v = 0; v < vertexCount; ++v)
+	{
+		const auto& vertex = vertices[v];
+		_positions[0][v] = vertex.Position.x; _positions[1][v] = vertex.Position.y; _positions[2][v] = vertex.Position.z;
+		_normals  [0][v] = vertex.Normal.x;   _normals  [1][v] = vertex.Normal.y;   _normals  [2][v] = vertex.Normal.z;
+
+		/*-------------------------------------------------------------------
+		-   Influences
+		---------------------------------------------------------------------*/
+		auto&  influence = _influences[v];
+		uint32 count     = 0;
+		float  total     = 0.0f;
+		influence = Influence();
+
+		for (uint32 k = 0; k < MAX_INFLUENCE_COUNT; ++k)
+		{
+			const int   bone   = vertex.BoneIndices[k];
+			const float weight = vertex.BoneWeights[k];
+			if (bone < 0 || static_cast<uint32>(bone) >= boneCount || !(weight > 0.0f)) { continue; }
+
+			uint32 slot = 0;
+			while (slot < count && influence.Bones[slot] != static_cast<uint16>(bone)) { ++slot; }
+			if (slot == count) { influence.Bones[count++] = static_cast<uint16>(bone); }
+			influence.Weights[slot] += weight;
+			total += weight;
+		}
+
+		if (count == 0)
+		{
+			influence.Weights[0] = 1.0f;
+			continue;
+		}
+
+		// insertion sort of at most 4 elements
+		for (uint32 i = 1; i < count; ++i)
+		{
+			for (uint32 j = i; j > 0 && influence.Weights[j] > influence.Weights[j - 1]; --j)
+			{
+				std::swap(influence.Weights[j], influence.Weights[j - 1]);
+				std::swap(influence.Bones  [j], influence.Bones  [j - 1]);
+			}
+		}
+		for (uint32 i = 0; i < count; ++i) { influence.Weights[i] /= total; }
+
+		/*-------------------------------------------------------------------
+		-   SDEF / QDEF
+		---------------------------------------------------------------------*/
+		if (deforms == nullptr) { continue; }
+
+		const auto& deform = deforms[v];
+		if (deform.Type == SkinDeformType::DualQuaternion)
+		{
+			_dualQuaternionVertices.Push(v);
+		}
+		else if (deform.Type == SkinDeformType::Spherical)
+		{
+			const int bone0 = vertex.BoneIndices[0];
+			const int bone1 = vertex.BoneIndices[1];
+			if (bone0 < 0 || bone1 < 0 || static_cast<uint32>(bone0) >= boneCount || static_cast<uint32>(bone1) >= boneCount) { continue; }
+
+			const float weight0 = (std::clamp)(vertex.BoneWeights[0], 0.0f, 1.0f);
+			const float weight1 = 1.0f - weight0;
+
+			// R0 and R1 are moved so that their weighted average is C
+			const auto& c  = deform.SDefC;
+			const auto& r0 = deform.SDefR0;
+			const auto& r1 = deform.SDefR1;
+			const gm::Float3 rw(r0.x * weight0 + r1.x * weight1, r0.y * weight0 + r1.y * weight1, r0.z * weight0 + r1.z * weight1);
+
+			SphericalVertex spherical = {};
+			spherical.Index    = v;
+			spherical.Bones[0] = static_cast<uint16>(bone0);
+			spherical.Bones[1] = static_cast<uint16>(bone1);
+			spherical.Weight0  = weight0;
+			spherical.C        = c;
+			spherical.CR0      = gm::Float3(c.x + 0.5f * (r0.x - rw.x), c.y + 0.5f * (r0.y - rw.y), c.z + 0.5f * (r0.z - rw.z));
+			spherical.CR1      = gm::Float3(c.x + 0.5f * (r1.x - rw.x), c.y + 0.5f * (r1.y - rw.y), c.z + 0.5f * (r1.z - rw.z));
+			_sphericalVertices.Push(spherical);
+		}
+	}
+}
+#pragma endregion SkinningSource
+
+#pragma region CPUSkinning
+/****************************************************************************
+*                     Skin
+*************************************************************************//**
+*  @fn        void CPUSkinning::Skin(const SkinningSource& source, const SkinningPalette& palette, SkinnedVertex* destination)
+*
+*  @brief     Linear blend skinning of every vertex, then the SDEF / QDEF vertices are overwritten.
+*             The destination is written once per vertex in the increasing address order.
+*
+*  @param[in] const SkinningSource& source
+*  @param[in] const SkinningPalette& palette (ComputePalette with source.RequiresDualQuaternions())
+*  @param[out]SkinnedVertex* destination (source.GetVertexCount() vertices)
+*
+*  @return    void
+*****************************************************************************/
+void CPUSkinning::Skin(const SkinningSource& source, const SkinningPalette& palette, SkinnedVertex* destination)
+{
+	const auto vertexCount = source.GetVertexCount();
+	if (vertexCount == 0) { return; }
+
+	Check(destination);
+	Check(source.GetBoneCount() > 0 && palette.GetBoneCount() >= source.GetBoneCount());
+	Check(!source.RequiresDualQuaternions() || palette.DualQuaternions.Size() >= source.GetBoneCount());
+
+#if PLATFORM_CPU_INSTRUCTION_SSE2 || PLATFORM_CPU_INSTRUCTION_AVX2
+	SkinLinearSimd(source, palette.SkinMatrices.Data(), destination, 0, vertexCount);
+#else
+	SkinLinearScalar(source, palette.SkinMatrices.Data(), destination, 0, vertexCount);
+#endif
+
+	if (!source.GetSphericalVertices().IsEmpty())       { SkinSpherical     (source, palette, destination); }
+	if (!source.GetDualQuaternionVertices().IsEmpty())  { SkinDualQuaternion(source, palette, destination); }
+}
+
+/****************************************************************************
+*                     Execute
+*************************************************************************//**
+*  @fn        void CPUSkinning::Execute(const SkinningJob& job)
+*
+*  @brief     Palette of the pose and the skinning of one character
+*
+*  @param[in] const SkinningJob& job
+*
+*  @return    void
+*****************************************************************************/
+void CPUSkinning::Execute(const SkinningJob& job)
+{
+	Check(job.Skeleton && job.Pose && job.Palette && job.Source);
+
+	job.Skeleton->ComputePalette(*job.Pose, *job.Palette, job.Source->RequiresDualQuaternions());
+	Skin(*job.Source, *job.Palette, job.Destination);
+}
+
+/****************************************************************************
+*                     ExecuteAll
+*************************************************************************//**
+*  @fn        void CPUSkinning::ExecuteAll(const SkinningJob* jobs, const gu::uint32 jobCount, gu::ThreadPool* threadPool)
+*
+*  @brief     Split the characters into contiguous batches with about the same vertex count,
+*             one for each worker and one for the calling thread, and wait until all of them are skinned.
+*
+*  @param[in] const SkinningJob* jobs
+*  @param[in] const gu::uint32 jobCount
+*  @param[in] gu::ThreadPool* threadPool (nullptr : serial)
+*
+*  @return    void
+*****************************************************************************/
+void CPUSkinning::ExecuteAll(const SkinningJob* jobs, const gu::uint32 jobCount, gu::ThreadPool* threadPool)
+{
+	const auto ExecuteRange = [jobs](const uint32 begin, const uint32 end)
+	{
+		for (uint32 i = begin; i < end; ++i) { Execute(jobs[i]); }
+	};
+
+	uint64 totalVertexCount = 0;
+	for (uint32 i = 0; i < jobCount; ++i) { totalVertexCount += jobs[i].Source->GetVertexCount(); }
+
+	const uint64 maxBatchCount = threadPool ? threadPool->GetThreadCount() + 1 : 1;
+	const uint32 batchCount    = static_cast<uint32>((std::min)({ maxBatchCount, static_cast<uint64>(jobCount), (totalVertexCount + PARALLEL_VERTEX_COUNT - 1) / PARALLEL_VERTEX_COUNT }));
+	if (batchCount <= 1) { ExecuteRange(0, jobCount); return; }
+
+	/*-------------------------------------------------------------------
+	-   Batch b starts at the first character after b / batchCount of the vertices
+	---------------------------------------------------------------------*/
+	std::vector<uint32> begins(batchCount + 1, jobCount);
+	begins[0] = 0;
+
+	uint64 accumulated = 0;
+	uint32 batch       = 1;
+	for (uint32 i = 0; i < jobCount && batch < batchCount; ++i)
+	{
+		while (batch < batchCount && accumulated >= totalVertexCount * batch / batchCount)
+		{
+			begins[batch++] = i;
+		}
+		accumulated += jobs[i].Source->GetVertexCount();
+	}
+
+	std::vector<std::future<void>> futures = {};
+	futures.reserve(batchCount - 1);
+	for (uint32 b = 1; b < batchCount; ++b)
+	{
+		const uint32 begin = begins[b];
+		const uint32 end   = begins[b + 1];
+		if (begin >= end) { continue; }
+		futures.push_back(threadPool->Submit([ExecuteRange, begin, end]() { ExecuteRange(begin, end); }));
+	}
+
+	ExecuteRange(0, begins[1]);
+
+	for (auto& future : futures) { future.get(); }
+}
+
+/****************************************************************************
+*                     AllocateDestination
+*************************************************************************//**
+*  @fn        FrameUploadAllocation CPUSkinning::AllocateDestination(FrameUploadAllocator& allocator, const SkinningSource& source)
+*
+*  @brief     The skinned vertices of this frame. CPUAddress is the job destination and
+*             GPUAddress is bound as the vertex buffer (stride : sizeof(SkinnedVertex)).
+*
+*  @param[in] FrameUploadAllocator& allocator
+*  @param[in] const SkinningSource& source
+*
+*  @return    FrameUploadAllocation
+*****************************************************************************/
+FrameUploadAllocation CPUSkinning::AllocateDestination(FrameUploadAllocator& allocator, const SkinningSource& source)
+{
+	return allocator.Allocate(static_cast<uint64>(source.GetVertexCount()) * sizeof(SkinnedVertex), 16);
+}
+#pragma endregion CPUSkinning
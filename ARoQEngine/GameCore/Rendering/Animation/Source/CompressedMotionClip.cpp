@@ -0,0 +1,991 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   CompressedMotionClip.cpp
+///             @brief  Error bounded compressed bone motion for the crowds and the long motions.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/CompressedMotionClip.hpp"
+#include "../Include/Skeleton.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include "GameUtility/Memory/Include/GUMemoryTracker.hpp"
+#include "GameUtility/Math/Private/Simd/Include/GMSimdMacros.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+
+#if PLATFORM_CPU_INSTRUCTION_AVX2
+	#include <immintrin.h>
+#elif PLATFORM_CPU_INSTRUCTION_SSE2
+	#include <emmintrin.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace gc::animation;
+
+namespace
+{
+	using gu::int32;
+	using gu::uint8;
+	using gu::uint32;
+	using gu::uint64;
+
+	constexpr uint32 INVALID_INDEX = 0xFFFFFFFF;
+
+	/*-------------------------------------------------------------------
+	-   Component index of the largest rotation component (bits in the stream)
+	---------------------------------------------------------------------*/
+	constexpr uint8 ROTATION_INDEX_BITS = 2;
+
+	/*-------------------------------------------------------------------
+	-   Share of the tolerance given to each part of the first bit rates
+	---------------------------------------------------------------------*/
+	constexpr float ROTATION_ERROR_RATIO    = 0.5f;
+	constexpr float TRANSLATION_ERROR_RATIO = 0.25f;
+
+	/*-------------------------------------------------------------------
+	-   Ranges narrower than this are constant
+	---------------------------------------------------------------------*/
+	constexpr float CONSTANT_EXTENT = 1e-6f;
+
+	uint8 NextBitRate(const uint8 bits)
+	{
+		return bits == 0 ? CompressedMotionClip::MIN_BIT_RATE : static_cast<uint8>(bits + 1);
+	}
+
+	/*-------------------------------------------------------------------
+	-   Lowest bit rate whose error is in the target (binary search over 0, MIN_BIT_RATE ... MAX_BIT_RATE,
+	-   the error decreases with the rate). MAX_BIT_RATE if no rate is enough.
+	---------------------------------------------------------------------*/
+	template<class Function>
+	uint8 FindBitRate(const Function& measureError, const float target)
+	{
+		constexpr uint32 rateCount = CompressedMotionClip::MAX_BIT_RATE - CompressedMotionClip::MIN_BIT_RATE + 2;
+		const auto toBits = [](const uint32 i) { return static_cast<uint8>(i == 0 ? 0 : CompressedMotionClip::MIN_BIT_RATE + i - 1); };
+
+		uint32 lower = 0, upper = rateCount - 1;
+		while (lower < upper)
+		{
+			const auto middle = (lower + upper) >> 1;
+			if (measureError(toBits(middle)) <= target) { upper = middle; } else { lower = middle + 1; }
+		}
+		return toBits(upper);
+	}
+
+	/*-------------------------------------------------------------------
+	-   Rigid transform (the scale is not animated by the motions)
+	---------------------------------------------------------------------*/
+	struct RigidTransform
+	{
+		gm::Float4 Rotation    = gm::Float4(0.0f, 0.0f, 0.0f, 1.0f);
+		gm::Float3 Translation = gm::Float3(0.0f, 0.0f, 0.0f);
+	};
+
+	gm::Float3 Rotate(const gm::Float4& q, const gm::Float3& v)
+	{
+		// v + 2w(q x v) + 2q x (q x v)
+		const float cx = q.y * v.z - q.z * v.y + q.w * v.x;
+		const float cy = q.z * v.x - q.x * v.z + q.w * v.y;
+		const float cz = q.x * v.y - q.y * v.x + q.w * v.z;
+		return gm::Float3(
+			v.x + 2.0f * (q.y * cz - q.z * cy),
+			v.y + 2.0f * (q.z * cx - q.x * cz),
+			v.z + 2.0f * (q.x * cy - q.y * cx));
+	}
+
+	/*-------------------------------------------------------------------
+	-   parent * local (the local rotation is applied first)
+	---------------------------------------------------------------------*/
+	gm::Float4 Multiply(const gm::Float4& a, const gm::Float4& b)
+	{
+		return gm::Float4(
+			a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+			a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+			a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+			a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z);
+	}
+
+	RigidTransform Combine(const RigidTransform& parent, const RigidTransform& local)
+	{
+		const auto offset = Rotate(parent.Rotation, local.Translation);
+		return { Multiply(parent.Rotation, local.Rotation),
+			gm::Float3(parent.Translation.x + offset.x, parent.Translation.y + offset.y, parent.Translation.z + offset.z) };
+	}
+
+	float Distance(const gm::Float3& a, const gm::Float3& b)
+	{
+		const float x = a.x - b.x, y = a.y - b.y, z = a.z - b.z;
+		return std::sqrt(x * x + y * y + z * z);
+	}
+
+	/*-------------------------------------------------------------------
+	-   Largest error of the virtual vertices on the 3 axes at the distance
+	---------------------------------------------------------------------*/
+	float MeasureError(const RigidTransform& exact, const RigidTransform& approximate, const float distance)
+	{
+		const gm::Float3 axes[3] = { gm::Float3(distance, 0.0f, 0.0f), gm::Float3(0.0f, distance, 0.0f), gm::Float3(0.0f, 0.0f, distance) };
+
+		float error = 0.0f;
+		for (const auto& axis : axes)
+		{
+			const auto a = Rotate(exact      .Rotation, axis);
+			const auto b = Rotate(approximate.Rotation, axis);
+			error = (std::max)(error, Distance(
+				gm::Float3(exact      .Translation.x + a.x, exact      .Translation.y + a.y, exact      .Translation.z + a.z),
+				gm::Float3(approximate.Translation.x + b.x, approximate.Translation.y + b.y, approximate.Translation.z + b.z)));
+		}
+		return error;
+	}
+
+	/*-------------------------------------------------------------------
+	-   Smallest three : the largest component is made positive and dropped
+	---------------------------------------------------------------------*/
+	struct PackedRotation
+	{
+		uint8 Index    = 3;
+		float Slots[3] = {};
+	};
+
+	PackedRotation PackRotation(const gm::Float4& rotation)
+	{
+		const float lengthSquared = rotation.x * rotation.x + rotation.y * rotation.y + rotation.z * rotation.z + rotation.w * rotation.w;
+		const float inverse       = lengthSquared > 0.0f ? 1.0f / std::sqrt(lengthSquared) : 0.0f;
+		float components[4] = { rotation.x * inverse, rotation.y * inverse, rotation.z * inverse, lengthSquared > 0.0f ? rotation.w * inverse : 1.0f };
+
+		PackedRotation packed = {};
+		for (uint8 i = 0; i < 4; ++i)
+		{
+			if (std::abs(components[i]) > std::abs(components[packed.Index])) { packed.Index = i; }
+		}
+
+		const float sign = components[packed.Index] < 0.0f ? -1.0f : 1.0f;
+		for (uint8 i = 0, slot = 0; i < 4; ++i)
+		{
+			if (i != packed.Index) { packed.Slots[slot++] = components[i] * sign; }
+		}
+		return packed;
+	}
+
+	/*-------------------------------------------------------------------
+	-   Same arithmetic as the SIMD decoder, so the measured error is the runtime error
+	---------------------------------------------------------------------*/
+	gm::Float4 UnpackRotation(const uint32 index, const float* slots)
+	{
+		const float largest = std::sqrt((std::max)(0.0f, 1.0f - slots[0] * slots[0] - slots[1] * slots[1] - slots[2] * slots[2]));
+
+		float components[4] = {};
+		for (uint32 i = 0, slot = 0; i < 4; ++i)
+		{
+			components[i] = i == index ? largest : slots[slot++];
+		}
+		return gm::Float4(components[0], components[1], components[2], components[3]);
+	}
+
+	/*-------------------------------------------------------------------
+	-   Range reduction : value = quantized * scale + offset
+	---------------------------------------------------------------------*/
+	struct ValueRange
+	{
+		float Minimum = 0.0f;
+		float Extent  = 0.0f;
+
+		void Include(const float value, const bool isFirst)
+		{
+			if (isFirst) { Minimum = value; Extent = 0.0f; return; }
+			const float maximum = (std::max)(Minimum + Extent, value);
+			Minimum = (std::min)(Minimum, value);
+			Extent  = maximum - Minimum;
+		}
+
+		bool IsConstant() const noexcept { return Extent <= CONSTANT_EXTENT; }
+	};
+
+	void GetScaleOffset(const ValueRange& range, const uint8 bits, float& scale, float& offset)
+	{
+		if (bits == 0)
+		{
+			scale  = 0.0f;
+			offset = range.Minimum + range.Extent * 0.5f;
+			return;
+		}
+		scale  = range.Extent / static_cast<float>((1u << bits) - 1);
+		offset = range.Minimum;
+	}
+
+	uint32 Quantize(const float value, const ValueRange& range, const uint8 bits)
+	{
+		if (bits == 0 || range.Extent <= 0.0f) { return 0; }
+
+		const float maximum = static_cast<float>((1u << bits) - 1);
+		const float ratio   = (std::clamp)((value - range.Minimum) / range.Extent, 0.0f, 1.0f);
+		return static_cast<uint32>(ratio * maximum + 0.5f);
+	}
+
+	float Dequantize(const uint32 quantized, const float scale, const float offset)
+	{
+		return static_cast<float>(static_cast<int32>(quantized)) * scale + offset;
+	}
+
+	/*-------------------------------------------------------------------
+	-   Bit stream (little endian, read and written by 64 bit words)
+	---------------------------------------------------------------------*/
+	void WriteBits(uint8* stream, const uint64 position, const uint32 value, const uint8 bits)
+	{
+		if (bits == 0) { return; }
+
+		uint64 word = 0;
+		std::memcpy(&word, stream + (position >> 3), sizeof(word));
+		word |= static_cast<uint64>(value) << (position & 7);
+		std::memcpy(stream + (position >> 3), &word, sizeof(word));
+	}
+
+	/*-------------------------------------------------------------------
+	-   57 bits or more from the position (the 3 values of a rotation or a translation)
+	---------------------------------------------------------------------*/
+	__forceinline uint64 ReadWord(const uint8* stream, const uint64 position)
+	{
+		uint64 word = 0;
+		std::memcpy(&word, stream + (position >> 3), sizeof(word));
+		return word >> (position & 7);
+	}
+
+#if PLATFORM_CPU_INSTRUCTION_SSE2 || PLATFORM_CPU_INSTRUCTION_AVX2
+	/*-------------------------------------------------------------------
+	-   4 tracks in the SIMD lanes
+	---------------------------------------------------------------------*/
+	struct Rotation4
+	{
+		__m128 X, Y, Z, W;
+	};
+
+	__forceinline __m128 Select(const __m128 mask, const __m128 a, const __m128 b)
+	{
+		return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+	}
+
+	__forceinline __m128 Dequantize(const int32* quantized, const float* scale, const float* offset)
+	{
+		const auto value = _mm_cvtepi32_ps(_mm_load_si128(reinterpret_cast<const __m128i*>(quantized)));
+		return _mm_add_ps(_mm_mul_ps(value, _mm_loadu_ps(scale)), _mm_loadu_ps(offset));
+	}
+
+	/*-------------------------------------------------------------------
+	-   Place the largest component at its index and shift the slots behind it
+	---------------------------------------------------------------------*/
+	__forceinline Rotation4 UnpackRotations(const int32* indices, const __m128 slot0, const __m128 slot1, const __m128 slot2)
+	{
+		auto remain = _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(slot0, slot0));
+		remain      = _mm_sub_ps(remain, _mm_mul_ps(slot1, slot1));
+		remain      = _mm_sub_ps(remain, _mm_mul_ps(slot2, slot2));
+		const auto largest = _mm_sqrt_ps(_mm_max_ps(remain, _mm_setzero_ps()));
+
+		const auto index = _mm_load_si128(reinterpret_cast<const __m128i*>(indices));
+		const auto is0   = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_set1_epi32(0)));
+		const auto is1   = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_set1_epi32(1)));
+		const auto is2   = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_set1_epi32(2)));
+		const auto is3   = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_set1_epi32(3)));
+
+		return
+		{
+			Select(is0, largest, slot0),
+			Select(is0, slot0, Select(is1, largest, slot1)),
+			Select(_mm_or_ps(is0, is1), slot1, Select(is2, largest, slot2)),
+			Select(is3, largest, slot2)
+		};
+	}
+#endif
+
+	/*-------------------------------------------------------------------
+	-   Track state during the compression
+	---------------------------------------------------------------------*/
+	struct TrackEncoder
+	{
+		gu::DynamicArray<PackedRotation> Rotations = {};
+		const gm::Float3* Translations = nullptr;
+		const gm::Float4* Exact        = nullptr;
+
+		ValueRange RotationRanges   [3] = {};
+		ValueRange TranslationRanges[3] = {};
+
+		uint8 IndexBits       = 0;
+		uint8 ConstantIndex   = 3;
+		uint8 RotationBits    = 0;
+		uint8 TranslationBits = 0;
+
+		/* @brief : Decoded samples at the current bit rates*/
+		gu::DynamicArray<RigidTransform> Decoded = {};
+
+		/* @brief : Local rotation error at the unit distance, local translation error*/
+		float RotationError    = 0.0f;
+		float TranslationError = 0.0f;
+
+		bool IsConstantRotation() const noexcept
+		{
+			return IndexBits == 0 && RotationRanges[0].IsConstant() && RotationRanges[1].IsConstant() && RotationRanges[2].IsConstant();
+		}
+
+		bool IsConstantTranslation() const noexcept
+		{
+			return TranslationRanges[0].IsConstant() && TranslationRanges[1].IsConstant() && TranslationRanges[2].IsConstant();
+		}
+
+		gm::Float4 DecodeRotation(const uint32 sample, const uint8 bits) const
+		{
+			const auto& packed = Rotations[sample];
+
+			float slots[3] = {};
+			for (uint32 i = 0; i < 3; ++i)
+			{
+				float scale = 0.0f, offset = 0.0f;
+				GetScaleOffset(RotationRanges[i], bits, scale, offset);
+				slots[i] = Dequantize(Quantize(packed.Slots[i], RotationRanges[i], bits), scale, offset);
+			}
+			return UnpackRotation(IndexBits == 0 ? ConstantIndex : packed.Index, slots);
+		}
+
+		gm::Float3 DecodeTranslation(const uint32 sample, const uint8 bits) const
+		{
+			const auto& translation = Translations[sample];
+			const float values[3]   = { translation.x, translation.y, translation.z };
+
+			float decoded[3] = {};
+			for (uint32 i = 0; i < 3; ++i)
+			{
+				float scale = 0.0f, offset = 0.0f;
+				GetScaleOffset(TranslationRanges[i], bits, scale, offset);
+				decoded[i] = Dequantize(Quantize(values[i], TranslationRanges[i], bits), scale, offset);
+			}
+			return gm::Float3(decoded[0], decoded[1], decoded[2]);
+		}
+
+		RigidTransform GetExact(const uint32 sample) const
+		{
+			const auto& packed = Rotations[sample];
+			return { UnpackRotation(packed.Index, packed.Slots), Translations[sample] };
+		}
+
+		float MeasureRotationError(const uint8 bits, const uint32 sampleCount) const
+		{
+			float error = 0.0f;
+			for (uint32 i = 0; i < sampleCount; ++i)
+			{
+				const RigidTransform exact   = { GetExact(i).Rotation  , gm::Float3(0.0f, 0.0f, 0.0f) };
+				const RigidTransform decoded = { DecodeRotation(i, bits), gm::Float3(0.0f, 0.0f, 0.0f) };
+				error = (std::max)(error, MeasureError(exact, decoded, 1.0f));
+			}
+			return error;
+		}
+
+		float MeasureTranslationError(const uint8 bits, const uint32 sampleCount) const
+		{
+			float error = 0.0f;
+			for (uint32 i = 0; i < sampleCount; ++i)
+			{
+				error = (std::max)(error, Distance(Translations[i], DecodeTranslation(i, bits)));
+			}
+			return error;
+		}
+
+		void Update(const uint32 sampleCount)
+		{
+			RotationError    = MeasureRotationError   (RotationBits   , sampleCount);
+			TranslationError = MeasureTranslationError(TranslationBits, sampleCount);
+			for (uint32 i = 0; i < sampleCount; ++i) { Decoded[i] = { DecodeRotation(i, RotationBits), DecodeTranslation(i, TranslationBits) }; }
+		}
+	};
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+/****************************************************************************
+*                     CompressedMotionClip
+*************************************************************************//**
+*  @fn        CompressedMotionClip::CompressedMotionClip(const MotionSamples& samples, const Skeleton* skeleton, const MotionCompressionSettings& settings)
+*
+*  @brief     1. Pack the rotations (smallest three) and find the value ranges of each track.
+*             2. Choose the lowest bit rates whose local error at the shell distance of the bone is in the tolerance.
+*             3. Measure the model space error of every bone and raise the bit rate of the track
+*                on the parent chain which contributes the most, until every bone is in the tolerance.
+*             4. Write the frame major bit stream.
+*
+*  @param[in] const MotionSamples& samples
+*  @param[in] const Skeleton* skeleton (nullptr : every track is a root bone)
+*  @param[in] const MotionCompressionSettings& settings
+*****************************************************************************/
+CompressedMotionClip::CompressedMotionClip(const MotionSamples& samples, const Skeleton* skeleton, const MotionCompressionSettings& settings)
+{
+	GU_MEMORY_TAG_SCOPE(gu::MemoryTag::Animation);
+
+	const auto trackCount  = samples.GetTrackCount();
+	const auto sampleCount = samples.SampleCount;
+	Check(samples.Translations.Size() == static_cast<uint64>(trackCount) * sampleCount);
+	Check(samples.Rotations   .Size() == static_cast<uint64>(trackCount) * sampleCount);
+
+	_trackNames  = samples.TrackNames;
+	_sampleCount = sampleCount;
+	_sampleRate  = samples.SampleRate;
+	_statistics.SampledSize = static_cast<uint64>(trackCount) * sampleCount * (sizeof(gm::Float3) + sizeof(gm::Float4));
+
+	/*-------------------------------------------------------------------
+	-   Track to bone of the skeleton
+	---------------------------------------------------------------------*/
+	const auto boneCount = skeleton != nullptr ? skeleton->GetBoneCount() : 0;
+	const auto binding   = skeleton != nullptr ? Bind(skeleton->GetBoneNames()) : MotionBinding{};
+
+	gu::DynamicArray<uint32> boneTracks(boneCount, INVALID_INDEX);
+	gu::DynamicArray<float>  shellDistances(boneCount, settings.ShellDistance);
+	gu::DynamicArray<RigidTransform> bindLocals(boneCount);
+
+	for (uint32 track = 0; track < trackCount && skeleton != nullptr; ++track)
+	{
+		const auto bone = binding.TrackToBone[track];
+		if (bone < boneCount && boneTracks[bone] == INVALID_INDEX) { boneTracks[bone] = track; }
+	}
+
+	for (uint32 bone = 0; bone < boneCount; ++bone)
+	{
+		const auto parent   = skeleton->GetParentIndex(bone);
+		const auto position = skeleton->GetBindPosition(bone);
+		if (parent < 0) { bindLocals[bone].Translation = position; continue; }
+
+		const auto& parentPosition = skeleton->GetBindPosition(parent);
+		bindLocals[bone].Translation = gm::Float3(position.x - parentPosition.x, position.y - parentPosition.y, position.z - parentPosition.z);
+		shellDistances[parent] = (std::max)(shellDistances[parent], Distance(position, parentPosition));
+	}
+
+	/*-------------------------------------------------------------------
+	-   1. Packing and the value ranges
+	---------------------------------------------------------------------*/
+	gu::DynamicArray<TrackEncoder> encoders(trackCount);
+	for (uint32 track = 0; track < trackCount; ++track)
+	{
+		auto& encoder = encoders[track];
+		const uint64 first = static_cast<uint64>(track) * sampleCount;
+		encoder.Translations = samples.Translations.Data() + first;
+		encoder.Exact        = samples.Rotations   .Data() + first;
+		encoder.Rotations.Resize(sampleCount);
+		encoder.Decoded  .Resize(sampleCount);
+
+		for (uint32 i = 0; i < sampleCount; ++i)
+		{
+			const auto packed = PackRotation(encoder.Exact[i]);
+			encoder.Rotations[i] = packed;
+
+			const auto& translation = encoder.Translations[i];
+			encoder.TranslationRanges[0].Include(translation.x, i == 0);
+			encoder.TranslationRanges[1].Include(translation.y, i == 0);
+			encoder.TranslationRanges[2].Include(translation.z, i == 0);
+
+			if (i == 0) { encoder.ConstantIndex = packed.Index; }
+			else if (packed.Index != encoder.ConstantIndex) { encoder.IndexBits = ROTATION_INDEX_BITS; }
+		}
+
+		// The slot ranges hold the components of the same index only if the index never changes
+		for (uint32 i = 0; i < sampleCount; ++i)
+		{
+			for (uint32 slot = 0; slot < 3; ++slot)
+			{
+				encoder.RotationRanges[slot].Include(encoder.Rotations[i].Slots[slot], i == 0);
+			}
+		}
+	}
+
+	/*-------------------------------------------------------------------
+	-   2. The first bit rates from the local errors
+	---------------------------------------------------------------------*/
+	for (uint32 track = 0; track < trackCount; ++track)
+	{
+		auto& encoder = encoders[track];
+		const auto bone  = skeleton != nullptr ? binding.TrackToBone[track] : MotionBinding::INVALID_BONE;
+		const float distance = bone < boneCount ? shellDistances[bone] : settings.ShellDistance;
+
+		if (!encoder.IsConstantRotation())
+		{
+			encoder.RotationBits = FindBitRate([&](const uint8 bits) { return encoder.MeasureRotationError(bits, sampleCount) * distance; }, settings.Tolerance * ROTATION_ERROR_RATIO);
+		}
+		if (!encoder.IsConstantTranslation())
+		{
+			encoder.TranslationBits = FindBitRate([&](const uint8 bits) { return encoder.MeasureTranslationError(bits, sampleCount); }, settings.Tolerance * TRANSLATION_ERROR_RATIO);
+		}
+		encoder.Update(sampleCount);
+
+		if (skeleton == nullptr || bone >= boneCount)
+		{
+			_statistics.MaxError = (std::max)(_statistics.MaxError, encoder.RotationError * distance + encoder.TranslationError);
+		}
+	}
+
+	/*-------------------------------------------------------------------
+	-   3. Model space error of the skeleton
+	---------------------------------------------------------------------*/
+	if (skeleton != nullptr && boneCount > 0)
+	{
+		const auto& order = skeleton->GetEvaluationOrder();
+
+		gu::DynamicArray<RigidTransform> exactModels  (boneCount);
+		gu::DynamicArray<RigidTransform> decodedModels(boneCount);
+		gu::DynamicArray<float>          boneErrors   (boneCount, 0.0f);
+		gu::DynamicArray<uint8>          raiseRotation   (trackCount, 0);
+		gu::DynamicArray<uint8>          raiseTranslation(trackCount, 0);
+
+		const float unboundError = _statistics.MaxError;
+
+		while (true)
+		{
+			++_statistics.OptimizationPassCount;
+
+			for (uint32 bone = 0; bone < boneCount; ++bone) { boneErrors[bone] = 0.0f; }
+
+			for (uint32 sample = 0; sample < sampleCount; ++sample)
+			{
+				for (uint32 i = 0; i < boneCount; ++i)
+				{
+					const auto bone   = order[i];
+					const auto parent = skeleton->GetParentIndex(bone);
+					const auto track  = boneTracks[bone];
+
+					auto exact   = bindLocals[bone];
+					auto decoded = bindLocals[bone];
+					if (track != INVALID_INDEX)
+					{
+						const auto exactLocal   = encoders[track].GetExact(sample);
+						const auto decodedLocal = encoders[track].Decoded[sample];
+						exact  .Rotation    = exactLocal.Rotation;
+						decoded.Rotation    = decodedLocal.Rotation;
+						exact  .Translation = gm::Float3(exact  .Translation.x + exactLocal  .Translation.x, exact  .Translation.y + exactLocal  .Translation.y, exact  .Translation.z + exactLocal  .Translation.z);
+						decoded.Translation = gm::Float3(decoded.Translation.x + decodedLocal.Translation.x, decoded.Translation.y + decodedLocal.Translation.y, decoded.Translation.z + decodedLocal.Translation.z);
+					}
+
+					exactModels  [bone] = parent < 0 ? exact   : Combine(exactModels  [parent], exact);
+					decodedModels[bone] = parent < 0 ? decoded : Combine(decodedModels[parent], decoded);
+					boneErrors[bone] = (std::max)(boneErrors[bone], MeasureError(exactModels[bone], decodedModels[bone], shellDistances[bone]));
+				}
+			}
+
+			/*-------------------------------------------------------------------
+			-   Raise one part of the largest contributor on the chain of each failed bone
+			---------------------------------------------------------------------*/
+			bool isRaised = false;
+			float maxError = unboundError;
+			for (uint32 bone = 0; bone < boneCount; ++bone)
+			{
+				maxError = (std::max)(maxError, boneErrors[bone]);
+				if (boneErrors[bone] <= settings.Tolerance) { continue; }
+
+				const auto& position = skeleton->GetBindPosition(bone);
+				float  bestContribution = 0.0f;
+				uint32 bestTrack        = INVALID_INDEX;
+				bool   isRotation       = false;
+
+				for (int32 ancestor = static_cast<int32>(bone); ancestor >= 0; ancestor = skeleton->GetParentIndex(ancestor))
+				{
+					const auto track = boneTracks[ancestor];
+					if (track == INVALID_INDEX) { continue; }
+
+					const auto& encoder = encoders[track];
+					const float reach   = Distance(position, skeleton->GetBindPosition(ancestor)) + shellDistances[bone];
+					if (encoder.RotationBits < MAX_BIT_RATE && !encoder.IsConstantRotation() && encoder.RotationError * reach > bestContribution)
+					{
+						bestContribution = encoder.RotationError * reach;
+						bestTrack        = track;
+						isRotation       = true;
+					}
+					if (encoder.TranslationBits < MAX_BIT_RATE && !encoder.IsConstantTranslation() && encoder.TranslationError > bestContribution)
+					{
+						bestContribution = encoder.TranslationError;
+						bestTrack        = track;
+						isRotation       = false;
+					}
+				}
+
+				if (bestTrack == INVALID_INDEX) { continue; }
+				(isRotation ? raiseRotation : raiseTranslation)[bestTrack] = 1;
+				isRaised = true;
+			}
+
+			_statistics.MaxError = maxError;
+			if (!isRaised) { break; }
+
+			for (uint32 track = 0; track < trackCount; ++track)
+			{
+				if (!raiseRotation[track] && !raiseTranslation[track]) { continue; }
+
+				auto& encoder = encoders[track];
+				if (raiseRotation   [track]) { encoder.RotationBits    = NextBitRate(encoder.RotationBits); }
+				if (raiseTranslation[track]) { encoder.TranslationBits = NextBitRate(encoder.TranslationBits); }
+				encoder.Update(sampleCount);
+				raiseRotation[track] = raiseTranslation[track] = 0;
+			}
+		}
+	}
+
+	/*-------------------------------------------------------------------
+	-   4. Track layout (padded with the constant identity tracks)
+	---------------------------------------------------------------------*/
+	const auto paddedCount = (trackCount + TRACK_ALIGNMENT - 1) / TRACK_ALIGNMENT * TRACK_ALIGNMENT;
+	_bitOffsets     .Resize(paddedCount, true, 0);
+	_indexBits      .Resize(paddedCount, true, 0);
+	_constantIndices.Resize(paddedCount, true, 3);
+	_rotationBits   .Resize(paddedCount, true, 0);
+	_translationBits.Resize(paddedCount, true, 0);
+	for (uint32 i = 0; i < 3; ++i)
+	{
+		_rotationScales    [i].Resize(paddedCount, true, 0.0f);
+		_rotationOffsets   [i].Resize(paddedCount, true, 0.0f);
+		_translationScales [i].Resize(paddedCount, true, 0.0f);
+		_translationOffsets[i].Resize(paddedCount, true, 0.0f);
+	}
+
+	uint64 rotationBitSum = 0, translationBitSum = 0;
+	for (uint32 track = 0; track < trackCount; ++track)
+	{
+		const auto& encoder = encoders[track];
+		_bitOffsets     [track] = static_cast<uint32>(_frameBitCount);
+		_indexBits      [track] = encoder.IndexBits;
+		_constantIndices[track] = encoder.ConstantIndex;
+		_rotationBits   [track] = encoder.RotationBits;
+		_translationBits[track] = encoder.TranslationBits;
+		for (uint32 i = 0; i < 3; ++i)
+		{
+			GetScaleOffset(encoder.RotationRanges   [i], encoder.RotationBits   , _rotationScales   [i][track], _rotationOffsets   [i][track]);
+			GetScaleOffset(encoder.TranslationRanges[i], encoder.TranslationBits, _translationScales[i][track], _translationOffsets[i][track]);
+		}
+		_frameBitCount += encoder.IndexBits + 3u * encoder.RotationBits + 3u * encoder.TranslationBits;
+
+		rotationBitSum    += encoder.RotationBits;
+		translationBitSum += encoder.TranslationBits;
+		if (encoder.RotationBits    == 0 && encoder.IndexBits == 0) { ++_statistics.ConstantRotationCount; }
+		if (encoder.TranslationBits == 0)                           { ++_statistics.ConstantTranslationCount; }
+	}
+
+	/*-------------------------------------------------------------------
+	-   5. Frame major bit stream
+	---------------------------------------------------------------------*/
+	_stream.Resize((static_cast<uint64>(sampleCount) * _frameBitCount + 7) / 8 + sizeof(uint64), true, 0);
+
+	uint64 position = 0;
+	for (uint32 sample = 0; sample < sampleCount; ++sample)
+	{
+		for (uint32 track = 0; track < trackCount; ++track)
+		{
+			const auto& encoder = encoders[track];
+			const auto& packed  = encoder.Rotations[sample];
+
+			WriteBits(_stream.Data(), position, packed.Index, encoder.IndexBits);
+			position += encoder.IndexBits;
+
+			for (uint32 i = 0; i < 3; ++i)
+			{
+				WriteBits(_stream.Data(), position, Quantize(packed.Slots[i], encoder.RotationRanges[i], encoder.RotationBits), encoder.RotationBits);
+				position += encoder.RotationBits;
+			}
+
+			const auto& translation = encoder.Translations[sample];
+			const float values[3]   = { translation.x, translation.y, translation.z };
+			for (uint32 i = 0; i < 3; ++i)
+			{
+				WriteBits(_stream.Data(), position, Quantize(values[i], encoder.TranslationRanges[i], encoder.TranslationBits), encoder.TranslationBits);
+				position += encoder.TranslationBits;
+			}
+		}
+	}
+
+	_statistics.CompressedSize = _stream.Size() + static_cast<uint64>(paddedCount) * (sizeof(uint32) + 4 * sizeof(uint8) + 12 * sizeof(float));
+	_statistics.AverageRotationBits    = trackCount > 0 ? static_cast<float>(rotationBitSum)    / static_cast<float>(trackCount) : 0.0f;
+	_statistics.AverageTranslationBits = trackCount > 0 ? static_cast<float>(translationBitSum) / static_cast<float>(trackCount) : 0.0f;
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Public Function
+/****************************************************************************
+*                     Resample
+*************************************************************************//**
+*  @fn        MotionSamples MotionSamples::Resample(const MotionClip& clip)
+*
+*  @brief     Sample the clip at every frame with a player bound to the tracks themselves
+*
+*  @param[in] const MotionClip& clip
+*
+*  @return    MotionSamples
+*****************************************************************************/
+MotionSamples MotionSamples::Resample(const MotionClip& clip)
+{
+	GU_MEMORY_TAG_SCOPE(gu::MemoryTag::Animation);
+
+	const auto trackCount = clip.GetTrackCount();
+
+	MotionSamples samples = {};
+	samples.SampleRate  = MotionClip::FRAME_RATE;
+	samples.SampleCount = static_cast<uint32>(std::floor(clip.GetFrameCount())) + 1;
+	samples.TrackNames.Resize(trackCount);
+	samples.Translations.Resize(static_cast<uint64>(trackCount) * samples.SampleCount);
+	samples.Rotations   .Resize(static_cast<uint64>(trackCount) * samples.SampleCount);
+
+	MotionBinding binding = {};
+	binding.BoneCount = trackCount;
+	binding.TrackToBone.Resize(trackCount);
+	for (uint32 track = 0; track < trackCount; ++track)
+	{
+		binding.TrackToBone[track] = track;
+		samples.TrackNames[track]  = clip.GetTracks()[track].BoneName;
+	}
+
+	MotionPlayer player(&clip, &binding);
+	player.SetLoop(false);
+
+	const auto& pose = player.GetPose();
+	for (uint32 sample = 0; sample < samples.SampleCount; ++sample)
+	{
+		player.SetFrame(static_cast<float>(sample));
+		player.Sample();
+
+		for (uint32 track = 0; track < trackCount; ++track)
+		{
+			const uint64 index = static_cast<uint64>(track) * samples.SampleCount + sample;
+			samples.Translations[index] = gm::Float3(pose.TranslationX[track], pose.TranslationY[track], pose.TranslationZ[track]);
+			samples.Rotations   [index] = gm::Float4(pose.RotationX[track], pose.RotationY[track], pose.RotationZ[track], pose.RotationW[track]);
+		}
+	}
+	return samples;
+}
+
+/****************************************************************************
+*                     Bind
+*************************************************************************//**
+*  @fn        MotionBinding CompressedMotionClip::Bind(const gu::string* boneNames, const gu::uint32 boneCount) const
+*
+*  @brief     Map each track to the skeleton bone which has the same name.
+*             The tracks of the bones the model does not have are INVALID_BONE.
+*
+*  @param[in] const gu::string* boneNames (UTF-8)
+*  @param[in] const gu::uint32 boneCount
+*
+*  @return    MotionBinding
+*****************************************************************************/
+MotionBinding CompressedMotionClip::Bind(const gu::string* boneNames, const gu::uint32 boneCount) const
+{
+	MotionBinding binding = {};
+	binding.BoneCount   = boneCount;
+	binding.TrackToBone = gu::DynamicArray<uint32>(_trackNames.Size(), MotionBinding::INVALID_BONE);
+
+	std::unordered_map<std::string, uint32> boneTable = {};
+	boneTable.reserve(boneCount);
+
+	// The first bone wins if the model has the same name twice.
+	for (uint32 i = 0; i < boneCount; ++i)
+	{
+		boneTable.emplace(std::string(boneNames[i].CString(), boneNames[i].Size()), i);
+	}
+
+	for (uint64 i = 0; i < _trackNames.Size(); ++i)
+	{
+		const auto found = boneTable.find(_trackNames[i]);
+		if (found != boneTable.end()) { binding.TrackToBone[i] = found->second; }
+	}
+	return binding;
+}
+
+/****************************************************************************
+*                     Sample
+*************************************************************************//**
+*  @fn        void CompressedMotionClip::Sample(const float frame, const MotionBinding& binding, LocalPose& pose) const
+*
+*  @brief     Decode the two samples around the frame and interpolate them
+*
+*  @param[in] const float frame
+*  @param[in] const MotionBinding& binding (from Bind of this clip)
+*  @param[out]LocalPose& pose (binding.BoneCount bones)
+*
+*  @return    void
+*****************************************************************************/
+void CompressedMotionClip::Sample(const float frame, const MotionBinding& binding, LocalPose& pose) const
+{
+	if (_sampleCount == 0) { return; }
+	Check(binding.TrackToBone.Size() == _trackNames.Size());
+	Check(pose.GetBoneCount() == binding.BoneCount);
+
+	const float clamped = (std::clamp)(frame, 0.0f, GetFrameCount());
+	const auto  sample0 = (std::min)(static_cast<uint32>(clamped), _sampleCount - 1);
+	const auto  sample1 = (std::min)(sample0 + 1, _sampleCount - 1);
+	const float alpha   = clamped - static_cast<float>(sample0);
+
+	const uint64 bitOffset0 = static_cast<uint64>(sample0) * _frameBitCount;
+	const uint64 bitOffset1 = static_cast<uint64>(sample1) * _frameBitCount;
+
+	for (uint32 track = 0; track < static_cast<uint32>(_bitOffsets.Size()); track += TRACK_ALIGNMENT)
+	{
+		SampleTracks(track, bitOffset0, bitOffset1, alpha, binding, pose);
+	}
+}
+#pragma endregion Public Function
+
+#pragma region Protected Function
+/****************************************************************************
+*                     SampleTracks
+*************************************************************************//**
+*  @fn        void CompressedMotionClip::SampleTracks(const gu::uint32 firstTrack, const gu::uint64 bitOffset0, const gu::uint64 bitOffset1, const float alpha,
+*             const MotionBinding& binding, LocalPose& pose) const
+*
+*  @brief     The bits of 4 tracks are read in scalar (one word per 3 values), then the dequantization, the largest component,
+*             the nlerp and the translation lerp run on the 4 tracks in SIMD lanes.
+*
+*  @param[in] const gu::uint32 firstTrack (multiple of TRACK_ALIGNMENT)
+*  @param[in] const gu::uint64 bitOffset0 (frame of the sample 0)
+*  @param[in] const gu::uint64 bitOffset1 (frame of the sample 1)
+*  @param[in] const float alpha (weight of the sample 1)
+*  @param[in] const MotionBinding& binding
+*  @param[out]LocalPose& pose
+*
+*  @return    void
+*****************************************************************************/
+void CompressedMotionClip::SampleTracks(const gu::uint32 firstTrack, const gu::uint64 bitOffset0, const gu::uint64 bitOffset1, const float alpha,
+	const MotionBinding& binding, LocalPose& pose) const
+{
+	/*-------------------------------------------------------------------
+	-   Unpack the bits : [sample][index, 3 rotation slots, 3 translation axes][lane]
+	---------------------------------------------------------------------*/
+	alignas(16) int32 values[2][7][TRACK_ALIGNMENT] = {};
+
+	const uint8* stream = _stream.Data();
+	for (uint32 lane = 0; lane < TRACK_ALIGNMENT; ++lane)
+	{
+		const auto track           = firstTrack + lane;
+		const auto indexBits       = _indexBits[track];
+		const auto rotationBits    = _rotationBits[track];
+		const auto translationBits = _translationBits[track];
+		const auto rotationMask    = (1ull << rotationBits)    - 1;
+		const auto translationMask = (1ull << translationBits) - 1;
+
+		const uint64 positions[2] = { bitOffset0 + _bitOffsets[track], bitOffset1 + _bitOffsets[track] };
+		for (uint32 sample = 0; sample < 2; ++sample)
+		{
+			auto* output = values[sample];
+			auto position = positions[sample];
+
+			output[0][lane] = indexBits == 0 ? _constantIndices[track] : static_cast<int32>(ReadWord(stream, position) & 3);
+			position += indexBits;
+
+			const auto rotation = ReadWord(stream, position);
+			output[1][lane] = static_cast<int32>( rotation                        & rotationMask);
+			output[2][lane] = static_cast<int32>((rotation >>      rotationBits)  & rotationMask);
+			output[3][lane] = static_cast<int32>((rotation >> (2 * rotationBits)) & rotationMask);
+			position += 3u * rotationBits;
+
+			const auto translation = ReadWord(stream, position);
+			output[4][lane] = static_cast<int32>( translation                           & translationMask);
+			output[5][lane] = static_cast<int32>((translation >>      translationBits)  & translationMask);
+			output[6][lane] = static_cast<int32>((translation >> (2 * translationBits)) & translationMask);
+		}
+	}
+
+	/*-------------------------------------------------------------------
+	-   Rotation (x, y, z, w) and translation of each lane
+	---------------------------------------------------------------------*/
+	alignas(16) float results[7][TRACK_ALIGNMENT] = {};
+
+#if PLATFORM_CPU_INSTRUCTION_SSE2 || PLATFORM_CPU_INSTRUCTION_AVX2
+	const auto from = UnpackRotations(values[0][0],
+		Dequantize(values[0][1], _rotationScales[0].Data() + firstTrack, _rotationOffsets[0].Data() + firstTrack),
+		Dequantize(values[0][2], _rotationScales[1].Data() + firstTrack, _rotationOffsets[1].Data() + firstTrack),
+		Dequantize(values[0][3], _rotationScales[2].Data() + firstTrack, _rotationOffsets[2].Data() + firstTrack));
+	const auto to = UnpackRotations(values[1][0],
+		Dequantize(values[1][1], _rotationScales[0].Data() + firstTrack, _rotationOffsets[0].Data() + firstTrack),
+		Dequantize(values[1][2], _rotationScales[1].Data() + firstTrack, _rotationOffsets[1].Data() + firstTrack),
+		Dequantize(values[1][3], _rotationScales[2].Data() + firstTrack, _rotationOffsets[2].Data() + firstTrack));
+
+	/*-------------------------------------------------------------------
+	-   nlerp on the shorter arc
+	---------------------------------------------------------------------*/
+	auto dot = _mm_mul_ps(from.X, to.X);
+	dot = _mm_add_ps(dot, _mm_mul_ps(from.Y, to.Y));
+	dot = _mm_add_ps(dot, _mm_mul_ps(from.Z, to.Z));
+	dot = _mm_add_ps(dot, _mm_mul_ps(from.W, to.W));
+	const auto sign   = _mm_and_ps(_mm_cmplt_ps(dot, _mm_setzero_ps()), _mm_set1_ps(-0.0f));
+	const auto weight = _mm_set1_ps(alpha);
+
+	const auto x = _mm_add_ps(from.X, _mm_mul_ps(_mm_sub_ps(_mm_xor_ps(to.X, sign), from.X), weight));
+	const auto y = _mm_add_ps(from.Y, _mm_mul_ps(_mm_sub_ps(_mm_xor_ps(to.Y, sign), from.Y), weight));
+	const auto z = _mm_add_ps(from.Z, _mm_mul_ps(_mm_sub_ps(_mm_xor_ps(to.Z, sign), from.Z), weight));
+	const auto w = _mm_add_ps(from.W, _mm_mul_ps(_mm_sub_ps(_mm_xor_ps(to.W, sign), from.W), weight));
+
+	auto lengthSquared = _mm_mul_ps(x, x);
+	lengthSquared = _mm_add_ps(lengthSquared, _mm_mul_ps(y, y));
+	lengthSquared = _mm_add_ps(lengthSquared, _mm_mul_ps(z, z));
+	lengthSquared = _mm_add_ps(lengthSquared, _mm_mul_ps(w, w));
+	const auto inverse = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(lengthSquared));
+
+	_mm_store_ps(results[0], _mm_mul_ps(x, inverse));
+	_mm_store_ps(results[1], _mm_mul_ps(y, inverse));
+	_mm_store_ps(results[2], _mm_mul_ps(z, inverse));
+	_mm_store_ps(results[3], _mm_mul_ps(w, inverse));
+
+	for (uint32 i = 0; i < 3; ++i)
+	{
+		const auto* scale  = _translationScales [i].Data() + firstTrack;
+		const auto* offset = _translationOffsets[i].Data() + firstTrack;
+		const auto start   = Dequantize(values[0][4 + i], scale, offset);
+		const auto end     = Dequantize(values[1][4 + i], scale, offset);
+		_mm_store_ps(results[4 + i], _mm_add_ps(start, _mm_mul_ps(_mm_sub_ps(end, start), weight)));
+	}
+#else
+	for (uint32 lane = 0; lane < TRACK_ALIGNMENT; ++lane)
+	{
+		const auto track = firstTrack + lane;
+
+		gm::Float4 rotations[2] = {};
+		float translations[2][3] = {};
+		for (uint32 sample = 0; sample < 2; ++sample)
+		{
+			float slots[3] = {};
+			for (uint32 i = 0; i < 3; ++i)
+			{
+				slots[i]                = Dequantize(static_cast<uint32>(values[sample][i + 1][lane]), _rotationScales   [i][track], _rotationOffsets   [i][track]);
+				translations[sample][i] = Dequantize(static_cast<uint32>(values[sample][i + 4][lane]), _translationScales[i][track], _translationOffsets[i][track]);
+			}
+			rotations[sample] = UnpackRotation(static_cast<uint32>(values[sample][0][lane]), slots);
+		}
+
+		const auto& from = rotations[0];
+		const auto& to   = rotations[1];
+		const float sign = from.x * to.x + from.y * to.y + from.z * to.z + from.w * to.w < 0.0f ? -1.0f : 1.0f;
+		const float blended[4] =
+		{
+			from.x + (to.x * sign - from.x) * alpha,
+			from.y + (to.y * sign - from.y) * alpha,
+			from.z + (to.z * sign - from.z) * alpha,
+			from.w + (to.w * sign - from.w) * alpha,
+		};
+		const float inverse = 1.0f / std::sqrt(blended[0] * blended[0] + blended[1] * blended[1] + blended[2] * blended[2] + blended[3] * blended[3]);
+		for (uint32 i = 0; i < 4; ++i) { results[i][lane] = blended[i] * inverse; }
+		for (uint32 i = 0; i < 3; ++i) { results[4 + i][lane] = translations[0][i] + (translations[1][i] - translations[0][i]) * alpha; }
+	}
+#endif
+
+	/*-------------------------------------------------------------------
+	-   Scatter to the bones (the padded tracks have no bone)
+	---------------------------------------------------------------------*/
+	const auto trackCount = GetTrackCount();
+	const auto boneCount  = pose.GetBoneCount();
+	for (uint32 lane = 0; lane < TRACK_ALIGNMENT && firstTrack + lane < trackCount; ++lane)
+	{
+		const auto bone = binding.TrackToBone[firstTrack + lane];
+		if (bone >= boneCount) { continue; }
+
+		pose.RotationX   [bone] = results[0][lane];
+		pose.RotationY   [bone] = results[1][lane];
+		pose.RotationZ   [bone] = results[2][lane];
+		pose.RotationW   [bone] = results[3][lane];
+		pose.TranslationX[bone] = results[4][lane];
+		pose.TranslationY[bone] = results[5][lane];
+		pose.TranslationZ[bone] = results[6][lane];
+	}
+}
+#pragma endregion Protected Function
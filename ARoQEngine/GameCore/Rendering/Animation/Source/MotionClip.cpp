@@ -0,0 +1,345 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   MotionClip.cpp
+///             @brief  Bone motion converted from a VMD file for the runtime sampling.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/MotionClip.hpp"
+#include "GameCore/Rendering/Model/External/MMD/Include/VMDParser.hpp"
+#include "GameUtility/File/Include/UnicodeUtility.hpp"
+#include "GameUtility/Memory/Include/GUMemoryTracker.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace gc::animation;
+
+namespace
+{
+	using gu::uint8;
+	using gu::uint16;
+	using gu::uint32;
+	using gu::uint64;
+
+	/*-------------------------------------------------------------------
+	-   VMD name field length (Shift-JIS, padded with NUL)
+	---------------------------------------------------------------------*/
+	constexpr uint32 VMD_BONE_NAME_LENGTH = 15;
+
+	/*-------------------------------------------------------------------
+	-   Newton iterations of the Bezier solver (bisection is used if the slope is flat)
+	---------------------------------------------------------------------*/
+	constexpr uint32 BEZIER_NEWTON_ITERATIONS = 16;
+	constexpr float  BEZIER_EPSILON           = 1e-6f;
+
+	/*-------------------------------------------------------------------
+	-   Bezier control points of a channel in the 64 byte VMD interpolation block.
+	-   The first 16 bytes hold x1[4], y1[4], x2[4], y2[4] in the channel order (X, Y, Z, Rotation).
+	---------------------------------------------------------------------*/
+	struct BezierPoints
+	{
+		uint8 X1, Y1, X2, Y2;
+
+		bool IsLinear() const noexcept { return X1 == Y1 && X2 == Y2; }
+
+		uint32 Pack() const noexcept
+		{
+			return static_cast<uint32>(X1) | static_cast<uint32>(Y1) << 8 | static_cast<uint32>(X2) << 16 | static_cast<uint32>(Y2) << 24;
+		}
+	};
+
+	BezierPoints GetBezierPoints(const uint8* interpolation, const uint32 channel)
+	{
+		return { interpolation[channel], interpolation[4 + channel], interpolation[8 + channel], interpolation[12 + channel] };
+	}
+
+	/*-------------------------------------------------------------------
+	-   Power basis of the Bezier curve : p(s) = ((a * s + b) * s + c) * s
+	---------------------------------------------------------------------*/
+	void GetCoefficients(const float p1, const float p2, float* coefficients)
+	{
+		coefficients[0] = 1.0f + 3.0f * p1 - 3.0f * p2;
+		coefficients[1] = 3.0f * p2 - 6.0f * p1;
+		coefficients[2] = 3.0f * p1;
+	}
+
+	MotionCurve BakeCurve(const BezierPoints& points)
+	{
+		MotionCurve curve = {};
+		GetCoefficients(points.X1 / 127.0f, points.X2 / 127.0f, curve.XCoefficients);
+		GetCoefficients(points.Y1 / 127.0f, points.Y2 / 127.0f, curve.YCoefficients);
+
+		const auto* xc = curve.XCoefficients;
+		for (uint32 i = 0; i <= MotionCurve::TABLE_SIZE; ++i)
+		{
+			const float s = static_cast<float>(i) / static_cast<float>(MotionCurve::TABLE_SIZE);
+			curve.X[i] = ((xc[0] * s + xc[1]) * s + xc[2]) * s;
+		}
+
+		// Exact end points, and monotonic against the rounding error
+		curve.X[0]                       = 0.0f;
+		curve.X[MotionCurve::TABLE_SIZE] = 1.0f;
+		for (uint32 i = 1; i <= MotionCurve::TABLE_SIZE; ++i)
+		{
+			curve.X[i] = (std::max)(curve.X[i], curve.X[i - 1]);
+		}
+		return curve;
+	}
+
+	/*-------------------------------------------------------------------
+	-   Shift-JIS (VMD) -> UTF-8 (PMX bone name)
+	---------------------------------------------------------------------*/
+	std::string ToUtf8BoneName(const std::string& rawName, const bool isShiftJIS)
+	{
+		const auto length = (std::min)(static_cast<uint64>(std::strlen(rawName.c_str())), static_cast<uint64>(rawName.size()));
+		if (length == 0)  { return std::string(); }
+		if (!isShiftJIS)  { return std::string(rawName.c_str(), length); }
+
+		const int wideLength = MultiByteToWideChar(932, 0, rawName.c_str(), static_cast<int>(length), nullptr, 0);
+		if (wideLength <= 0) { return std::string(rawName.c_str(), length); }
+
+		std::wstring wideName(static_cast<size_t>(wideLength), L'\0');
+		MultiByteToWideChar(932, 0, rawName.c_str(), static_cast<int>(length), wideName.data(), wideLength);
+		return unicode::ToUtf8String(wideName);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+MotionClip::MotionClip(const vmd::VMDFile& file)
+{
+	Build(file.BoneFrames.data(), static_cast<uint64>(file.BoneFrames.size()), true);
+}
+
+MotionClip::MotionClip(const vmd::VMDBoneKeyFrame* frames, const gu::uint64 frameCount)
+{
+	Build(frames, frameCount, false);
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Public Function
+/****************************************************************************
+*                     Bind
+*************************************************************************//**
+*  @fn        MotionBinding MotionClip::Bind(const gu::string* boneNames, const gu::uint32 boneCount) const
+*
+*  @brief     Map each track to the skeleton bone which has the same name.
+*             The tracks of the bones the model does not have are INVALID_BONE.
+*
+*  @param[in] const gu::string* boneNames (UTF-8)
+*  @param[in] const gu::uint32 boneCount
+*
+*  @return    MotionBinding
+*****************************************************************************/
+MotionBinding MotionClip::Bind(const gu::string* boneNames, const gu::uint32 boneCount) const
+{
+	MotionBinding binding = {};
+	binding.BoneCount   = boneCount;
+	binding.TrackToBone = gu::DynamicArray<uint32>(_tracks.Size(), MotionBinding::INVALID_BONE);
+
+	std::unordered_map<std::string, uint32> boneTable = {};
+	boneTable.reserve(boneCount);
+
+	// The first bone wins if the model has the same name twice.
+	for (uint32 i = 0; i < boneCount; ++i)
+	{
+		boneTable.emplace(std::string(boneNames[i].CString(), boneNames[i].Size()), i);
+	}
+
+	for (uint64 i = 0; i < _tracks.Size(); ++i)
+	{
+		const auto found = boneTable.find(_tracks[i].BoneName);
+		if (found != boneTable.end()) { binding.TrackToBone[i] = found->second; }
+	}
+	return binding;
+}
+
+/****************************************************************************
+*                     FindTrack
+*************************************************************************//**
+*  @fn        gu::uint32 MotionClip::FindTrack(const std::string& boneName) const
+*
+*  @brief     Track index of the bone
+*
+*  @param[in] const std::string& boneName (UTF-8)
+*
+*  @return    gu::uint32 (INVALID_TRACK : not found)
+*****************************************************************************/
+gu::uint32 MotionClip::FindTrack(const std::string& boneName) const
+{
+	for (uint64 i = 0; i < _tracks.Size(); ++i)
+	{
+		if (_tracks[i].BoneName == boneName) { return static_cast<uint32>(i); }
+	}
+	return INVALID_TRACK;
+}
+
+/****************************************************************************
+*                     SolveBezier
+*************************************************************************//**
+*  @fn        float MotionClip::SolveBezier(const gu::uint8 x1, const gu::uint8 y1, const gu::uint8 x2, const gu::uint8 y2, const float t)
+*
+*  @brief     Cubic Bezier curve (0, 0) - (x1, y1) - (x2, y2) - (127, 127).
+*             Find s such that x(s) = t, then return y(s).
+*
+*  @param[in] const gu::uint8 x1, y1, x2, y2 (0 - 127)
+*  @param[in] const float t ([0, 1] time ratio)
+*
+*  @return    float [0, 1] interpolation weight
+*****************************************************************************/
+float MotionClip::SolveBezier(const gu::uint8 x1, const gu::uint8 y1, const gu::uint8 x2, const gu::uint8 y2, const float t)
+{
+	if (t <= 0.0f) { return 0.0f; }
+	if (t >= 1.0f) { return 1.0f; }
+
+	const float px1 = x1 / 127.0f, py1 = y1 / 127.0f;
+	const float px2 = x2 / 127.0f, py2 = y2 / 127.0f;
+
+	const auto Evaluate = [](const float p1, const float p2, const float s)
+	{
+		const float inverse = 1.0f - s;
+		return 3.0f * inverse * inverse * s * p1 + 3.0f * inverse * s * s * p2 + s * s * s;
+	};
+
+	const auto Derivative = [](const float p1, const float p2, const float s)
+	{
+		const float inverse = 1.0f - s;
+		return 3.0f * inverse * inverse * p1 + 6.0f * inverse * s * (p2 - p1) + 3.0f * s * s * (1.0f - p2);
+	};
+
+	/*-------------------------------------------------------------------
+	-   x(s) is monotonic because the control points are in [0, 1].
+	-   Newton steps, falling back to the bisection when a step leaves the bracket.
+	---------------------------------------------------------------------*/
+	float lower = 0.0f, upper = 1.0f;
+	float s     = t;
+	for (uint32 i = 0; i < BEZIER_NEWTON_ITERATIONS; ++i)
+	{
+		const float error = Evaluate(px1, px2, s) - t;
+		if (std::fabs(error) < BEZIER_EPSILON) { break; }
+
+		if (error > 0.0f) { upper = s; } else { lower = s; }
+
+		const float slope = Derivative(px1, px2, s);
+		float next = slope > BEZIER_EPSILON ? s - error / slope : -1.0f;
+		if (next <= lower || next >= upper) { next = 0.5f * (lower + upper); }
+		s = next;
+	}
+	return Evaluate(py1, py2, s);
+}
+#pragma endregion Public Function
+
+#pragma region Protected Function
+/****************************************************************************
+*                     Build
+*************************************************************************//**
+*  @fn        void MotionClip::Build(const vmd::VMDBoneKeyFrame* frames, const gu::uint64 frameCount, const bool isShiftJIS)
+*
+*  @brief     Group the keys by bone, sort them by frame and bake the Bezier curves.
+*             When two keys of a bone have the same frame, the later one in the file is used.
+*
+*  @param[in] const vmd::VMDBoneKeyFrame* frames
+*  @param[in] const gu::uint64 frameCount
+*  @param[in] const bool isShiftJIS (bone names in the VMD encoding)
+*
+*  @return    void
+*****************************************************************************/
+void MotionClip::Build(const vmd::VMDBoneKeyFrame* frames, const gu::uint64 frameCount, const bool isShiftJIS)
+{
+	GU_MEMORY_TAG_SCOPE(gu::MemoryTag::Animation);
+
+	/*-------------------------------------------------------------------
+	-   Group the keys by bone name (the raw name is converted once per bone)
+	---------------------------------------------------------------------*/
+	std::unordered_map<std::string, uint32> rawNameToTrack = {};
+	std::vector<std::vector<uint32>>        trackFrames    = {};
+
+	for (uint64 i = 0; i < frameCount; ++i)
+	{
+		const auto& rawName = frames[i].BoneName;
+		auto found = rawNameToTrack.find(rawName);
+		if (found == rawNameToTrack.end())
+		{
+			const auto trackIndex = static_cast<uint32>(trackFrames.size());
+			found = rawNameToTrack.emplace(rawName, trackIndex).first;
+			trackFrames.emplace_back();
+
+			MotionTrack track = {};
+			track.BoneName = ToUtf8BoneName(rawName.substr(0, (std::min)(rawName.size(), static_cast<size_t>(VMD_BONE_NAME_LENGTH))), isShiftJIS);
+			_tracks.Push(track);
+		}
+		trackFrames[found->second].push_back(static_cast<uint32>(i));
+	}
+
+	/*-------------------------------------------------------------------
+	-   Sort the keys of each track, and convert them
+	---------------------------------------------------------------------*/
+	std::unordered_map<uint32, uint16> curveTable = {};
+	_keys.Reserve(frameCount);
+	_frameCount = 0.0f;
+
+	for (uint64 trackIndex = 0; trackIndex < _tracks.Size(); ++trackIndex)
+	{
+		auto& order = trackFrames[trackIndex];
+		std::stable_sort(order.begin(), order.end(), [frames](const uint32 a, const uint32 b)
+		{
+			return frames[a].Frame < frames[b].Frame;
+		});
+
+		auto& track     = _tracks[trackIndex];
+		track.KeyOffset = static_cast<uint32>(_keys.Size());
+
+		for (uint64 i = 0; i < order.size(); ++i)
+		{
+			const auto& frame = frames[order[i]];
+
+			// Duplicated frame : keep the last key in the file
+			if (i + 1 < order.size() && frames[order[i + 1]].Frame == frame.Frame) { continue; }
+
+			MotionKey key   = {};
+			key.Frame       = static_cast<float>(frame.Frame);
+			key.Translation = frame.Translation;
+			key.Rotation    = frame.Quaternion;
+
+			for (uint32 channel = 0; channel < static_cast<uint32>(MotionChannel::CountOf); ++channel)
+			{
+				const auto points = GetBezierPoints(frame.BazierInterpolation, channel);
+				if (points.IsLinear()) { key.Curves[channel] = LINEAR_CURVE; continue; }
+
+				const auto found = curveTable.find(points.Pack());
+				if (found != curveTable.end()) { key.Curves[channel] = found->second; continue; }
+
+				// The curve index is 16 bit. The remaining curves are approximated by the linear interpolation.
+				if (GetCurveCount() + 1 > 0xFFFF) { key.Curves[channel] = LINEAR_CURVE; continue; }
+
+				/*-------------------------------------------------------------------
+				-   Bake the new curve. The curve index starts at 1 (0 : LINEAR_CURVE).
+				---------------------------------------------------------------------*/
+				const auto curveIndex = static_cast<uint16>(GetCurveCount() + 1);
+				_curves.Push(BakeCurve(points));
+				curveTable.emplace(points.Pack(), curveIndex);
+				key.Curves[channel] = curveIndex;
+			}
+
+			_keys.Push(key);
+			_frameCount = (std::max)(_frameCount, key.Frame);
+		}
+
+		track.KeyCount = static_cast<uint32>(_keys.Size()) - track.KeyOffset;
+	}
+
+	_keys  .ShrinkToFit();
+	_curves.ShrinkToFit();
+}
+#pragma endregion Protected Function
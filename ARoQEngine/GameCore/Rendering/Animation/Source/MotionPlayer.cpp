@@ -0,0 +1,339 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   MotionPlayer.cpp
+///             @brief  Per instance playback state of a MotionClip.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/MotionPlayer.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include "GameUtility/Thread/Public/Include/GUThreadPool.hpp"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace gc::animation;
+
+namespace
+{
+	using gu::uint32;
+	using gu::uint64;
+
+	/*-------------------------------------------------------------------
+	-   Quaternions closer than this are interpolated linearly (sin(theta) is too small)
+	---------------------------------------------------------------------*/
+	constexpr float SLERP_LINEAR_THRESHOLD = 0.9995f;
+
+	gm::Float4 Slerp(const gm::Float4& from, gm::Float4 to, const float t)
+	{
+		float cosine = from.x * to.x + from.y * to.y + from.z * to.z + from.w * to.w;
+		if (cosine < 0.0f)
+		{
+			cosine = -cosine;
+			to     = gm::Float4(-to.x, -to.y, -to.z, -to.w);
+		}
+
+		float fromWeight = 1.0f - t;
+		float toWeight   = t;
+		if (cosine < SLERP_LINEAR_THRESHOLD)
+		{
+			const float theta   = std::acos(cosine);
+			const float inverse = 1.0f / std::sin(theta);
+			fromWeight = std::sin(fromWeight * theta) * inverse;
+			toWeight   = std::sin(toWeight   * theta) * inverse;
+		}
+
+		gm::Float4 result(
+			from.x * fromWeight + to.x * toWeight,
+			from.y * fromWeight + to.y * toWeight,
+			from.z * fromWeight + to.z * toWeight,
+			from.w * fromWeight + to.w * toWeight);
+
+		const float length = std::sqrt(result.x * result.x + result.y * result.y + result.z * result.z + result.w * result.w);
+		if (length > 0.0f)
+		{
+			const float inverse = 1.0f / length;
+			result = gm::Float4(result.x * inverse, result.y * inverse, result.z * inverse, result.w * inverse);
+		}
+		return result;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region LocalPose
+/****************************************************************************
+*                     Resize
+*************************************************************************//**
+*  @fn        void LocalPose::Resize(const gu::uint32 boneCount)
+*
+*  @brief     Allocate the arrays and set the identity transform
+*
+*  @param[in] const gu::uint32 boneCount
+*
+*  @return    void
+*****************************************************************************/
+void LocalPose::Resize(const gu::uint32 boneCount)
+{
+	for (auto* component : { &TranslationX, &TranslationY, &TranslationZ, &RotationX, &RotationY, &RotationZ, &RotationW, &ScaleX, &ScaleY, &ScaleZ })
+	{
+		component->Clear();
+		component->Resize(boneCount);
+		component->ShrinkToFit();
+	}
+	SetIdentity();
+}
+
+/****************************************************************************
+*                     SetIdentity
+*************************************************************************//**
+*  @fn        void LocalPose::SetIdentity()
+*
+*  @brief     Zero translation, identity rotation and unit scale
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
+void LocalPose::SetIdentity()
+{
+	const auto boneCount = GetBoneCount();
+	for (uint32 i = 0; i < boneCount; ++i)
+	{
+		TranslationX[i] = 0.0f; TranslationY[i] = 0.0f; TranslationZ[i] = 0.0f;
+		RotationX[i]    = 0.0f; RotationY[i]    = 0.0f; RotationZ[i]    = 0.0f; RotationW[i] = 1.0f;
+		ScaleX[i]       = 1.0f; ScaleY[i]       = 1.0f; ScaleZ[i]       = 1.0f;
+	}
+}
+#pragma endregion LocalPose
+
+#pragma region Public Function
+/****************************************************************************
+*                     SetClip
+*************************************************************************//**
+*  @fn        void MotionPlayer::SetClip(const MotionClip* clip, const MotionBinding* binding)
+*
+*  @brief     Start the clip from the frame 0
+*
+*  @param[in] const MotionClip* clip
+*  @param[in] const MotionBinding* binding (created by clip->Bind)
+*
+*  @return    void
+*****************************************************************************/
+void MotionPlayer::SetClip(const MotionClip* clip, const MotionBinding* binding)
+{
+	Check(clip == nullptr || (binding != nullptr && binding->TrackToBone.Size() == clip->GetTrackCount()));
+
+	_clip    = clip;
+	_binding = binding;
+	_frame   = 0.0f;
+
+	_cursors.Clear();
+	_cursors.Resize(clip ? clip->GetTrackCount() : 0);
+	_pose.Resize(binding ? binding->BoneCount : 0);
+}
+
+/****************************************************************************
+*                     Advance
+*************************************************************************//**
+*  @fn        void MotionPlayer::Advance(const float deltaTime)
+*
+*  @brief     Advance the playback time. The loop wraps at the last key frame, otherwise the frame is clamped.
+*
+*  @param[in] const float deltaTime (seconds)
+*
+*  @return    void
+*****************************************************************************/
+void MotionPlayer::Advance(const float deltaTime)
+{
+	if (_clip == nullptr) { return; }
+
+	_frame += deltaTime * MotionClip::FRAME_RATE * _speed;
+
+	const float frameCount = _clip->GetFrameCount();
+	if (frameCount <= 0.0f) { _frame = 0.0f; return; }
+
+	if (_isLoop)
+	{
+		if (_frame >= frameCount || _frame < 0.0f)
+		{
+			_frame = std::fmod(_frame, frameCount);
+			if (_frame < 0.0f) { _frame += frameCount; }
+		}
+	}
+	else
+	{
+		_frame = (std::clamp)(_frame, 0.0f, frameCount);
+	}
+}
+
+/****************************************************************************
+*                     Sample
+*************************************************************************//**
+*  @fn        void MotionPlayer::Sample()
+*
+*  @brief     Interpolate the key pair of each bound track at the current frame.
+*             Translation uses the baked curve of each axis, rotation is the slerp weighted by the rotation curve.
+*             Before the first key or after the last key, the nearest key is held.
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
+void MotionPlayer::Sample()
+{
+	if (_clip == nullptr) { return; }
+
+	const auto& tracks     = _clip->GetTracks();
+	const auto* keys       = _clip->GetKeys();
+	const auto  boneCount  = _pose.GetBoneCount();
+	const auto* trackBones = _binding->TrackToBone.Data();
+
+	for (uint32 trackIndex = 0; trackIndex < static_cast<uint32>(tracks.Size()); ++trackIndex)
+	{
+		const auto  bone  = trackBones[trackIndex];
+		const auto& track = tracks[trackIndex];
+		if (bone >= boneCount || track.KeyCount == 0) { continue; }
+
+		const auto* trackKeys = keys + track.KeyOffset;
+		const auto  cursor    = FindKey(trackKeys, track.KeyCount, _cursors[trackIndex]);
+		_cursors[trackIndex]  = cursor;
+
+		const auto& from = trackKeys[cursor];
+
+		/*-------------------------------------------------------------------
+		-   Hold the key (outside of the key range)
+		---------------------------------------------------------------------*/
+		if (cursor + 1 >= track.KeyCount || _frame <= from.Frame)
+		{
+			_pose.TranslationX[bone] = from.Translation.x;
+			_pose.TranslationY[bone] = from.Translation.y;
+			_pose.TranslationZ[bone] = from.Translation.z;
+			_pose.RotationX[bone]    = from.Rotation.x;
+			_pose.RotationY[bone]    = from.Rotation.y;
+			_pose.RotationZ[bone]    = from.Rotation.z;
+			_pose.RotationW[bone]    = from.Rotation.w;
+			continue;
+		}
+
+		/*-------------------------------------------------------------------
+		-   Interpolate with the curves of the next key
+		---------------------------------------------------------------------*/
+		const auto& to = trackKeys[cursor + 1];
+		const float t  = (_frame - from.Frame) / (to.Frame - from.Frame);
+
+		const float weightX = _clip->EvaluateCurve(to.Curves[static_cast<uint32>(MotionChannel::TranslationX)], t);
+		const float weightY = _clip->EvaluateCurve(to.Curves[static_cast<uint32>(MotionChannel::TranslationY)], t);
+		const float weightZ = _clip->EvaluateCurve(to.Curves[static_cast<uint32>(MotionChannel::TranslationZ)], t);
+		const float weightR = _clip->EvaluateCurve(to.Curves[static_cast<uint32>(MotionChannel::Rotation)]    , t);
+
+		_pose.TranslationX[bone] = from.Translation.x + (to.Translation.x - from.Translation.x) * weightX;
+		_pose.TranslationY[bone] = from.Translation.y + (to.Translation.y - from.Translation.y) * weightY;
+		_pose.TranslationZ[bone] = from.Translation.z + (to.Translation.z - from.Translation.z) * weightZ;
+
+		const auto rotation = Slerp(from.Rotation, to.Rotation, weightR);
+		_pose.RotationX[bone] = rotation.x;
+		_pose.RotationY[bone] = rotation.y;
+		_pose.RotationZ[bone] = rotation.z;
+		_pose.RotationW[bone] = rotation.w;
+	}
+}
+
+/****************************************************************************
+*                     SampleAll
+*************************************************************************//**
+*  @fn        void MotionPlayer::SampleAll(MotionPlayer* const* players, const gu::uint32 playerCount, gu::ThreadPool* threadPool)
+*
+*  @brief     Split the players into contiguous batches, one for each worker and one for the calling thread,
+*             and wait until all of them are sampled. Each player writes only its own cursors and pose.
+*
+*  @param[in] MotionPlayer* const* players
+*  @param[in] const gu::uint32 playerCount
+*  @param[in] gu::ThreadPool* threadPool (nullptr : serial)
+*
+*  @return    void
+*****************************************************************************/
+void MotionPlayer::SampleAll(MotionPlayer* const* players, const gu::uint32 playerCount, gu::ThreadPool* threadPool)
+{
+	const auto SampleRange = [players](const uint32 begin, const uint32 end)
+	{
+		for (uint32 i = begin; i < end; ++i) { players[i]->Sample(); }
+	};
+
+	const uint32 maxJobCount = threadPool ? threadPool->GetThreadCount() + 1 : 1;
+	const uint32 jobCount    = (std::min)(maxJobCount, (playerCount + PARALLEL_BATCH_SIZE - 1) / PARALLEL_BATCH_SIZE);
+	if (jobCount <= 1) { SampleRange(0, playerCount); return; }
+
+	/*-------------------------------------------------------------------
+	-   Job 0 runs on the calling thread while the workers run the others
+	---------------------------------------------------------------------*/
+	const auto GetBegin = [playerCount, jobCount](const uint32 job)
+	{
+		return static_cast<uint32>(static_cast<uint64>(playerCount) * job / jobCount);
+	};
+
+	std::vector<std::future<void>> futures = {};
+	futures.reserve(jobCount - 1);
+	for (uint32 job = 1; job < jobCount; ++job)
+	{
+		const uint32 begin = GetBegin(job);
+		const uint32 end   = GetBegin(job + 1);
+		futures.push_back(threadPool->Submit([SampleRange, begin, end]() { SampleRange(begin, end); }));
+	}
+
+	SampleRange(0, GetBegin(1));
+
+	for (auto& future : futures) { future.get(); }
+}
+#pragma endregion Public Function
+
+#pragma region Protected Function
+/****************************************************************************
+*                     FindKey
+*************************************************************************//**
+*  @fn        gu::uint32 MotionPlayer::FindKey(const MotionKey* keys, const gu::uint32 keyCount, gu::uint32 cursor) const
+*
+*  @brief     Step the cursor a few keys forward (or one key back), otherwise binary search the track.
+*
+*  @param[in] const MotionKey* keys (keys of the track)
+*  @param[in] const gu::uint32 keyCount (> 0)
+*  @param[in] gu::uint32 cursor (last used key)
+*
+*  @return    gu::uint32 last key whose frame <= current frame (0 before the first key)
+*****************************************************************************/
+gu::uint32 MotionPlayer::FindKey(const MotionKey* keys, const gu::uint32 keyCount, gu::uint32 cursor) const
+{
+	if (cursor >= keyCount) { cursor = 0; }
+
+	if (keys[cursor].Frame <= _frame)
+	{
+		for (uint32 step = 0; step < CURSOR_STEP_COUNT; ++step)
+		{
+			if (cursor + 1 >= keyCount || keys[cursor + 1].Frame > _frame) { return cursor; }
+			++cursor;
+		}
+		if (cursor + 1 >= keyCount || keys[cursor + 1].Frame > _frame) { return cursor; }
+	}
+	else
+	{
+		if (cursor == 0) { return 0; }
+		if (keys[cursor - 1].Frame <= _frame) { return cursor - 1; }
+	}
+
+	/*-------------------------------------------------------------------
+	-   Seek : first key after the frame - 1
+	---------------------------------------------------------------------*/
+	const auto* found = std::upper_bound(keys, keys + keyCount, _frame, [](const float frame, const MotionKey& key)
+	{
+		return frame < key.Frame;
+	});
+	return found == keys ? 0 : static_cast<uint32>(found - keys - 1);
+}
+#pragma endregion Protected Function
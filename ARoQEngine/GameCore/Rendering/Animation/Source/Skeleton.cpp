@@ -0,0 +1,218 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   Skeleton.cpp
+///             @brief  Bone hierarchy of a skin mesh model and the skinning palette built from a local pose.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/Skeleton.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include "GameUtility/Memory/Include/GUMemoryTracker.hpp"
+#include <algorithm>
+#include <cmath>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace gc::animation;
+
+namespace
+{
+	using gu::int32;
+	using gu::uint32;
+	using gu::uint64;
+
+	using Vector     = SIMD_NAME_SPACE::Vector128Utility;
+	using Matrix     = SIMD_NAME_SPACE::Matrix128Utility;
+	using Quaternion = SIMD_NAME_SPACE::Quaternion128Utility;
+
+	/*-------------------------------------------------------------------
+	-   Resize an array which may have been used with the other bone count
+	---------------------------------------------------------------------*/
+	template<class T>
+	void ResizeExactly(gu::DynamicArray<T>& array, const uint64 size)
+	{
+		if (array.Size() == size) { return; }
+		array.Clear();
+		array.Resize(size);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+Skeleton::Skeleton(const SkeletonBone* bones, const gu::uint32 boneCount)
+{
+	GU_MEMORY_TAG_SCOPE(gu::MemoryTag::Animation);
+
+	_boneNames            .Resize(boneCount);
+	_parents              .Resize(boneCount);
+	_bindPositions        .Resize(boneCount);
+	_bindLocalTranslations.Resize(boneCount);
+
+	for (uint32 i = 0; i < boneCount; ++i)
+	{
+		const auto parent = bones[i].ParentIndex;
+		_boneNames[i]     = bones[i].Name;
+		_parents[i]       = (parent >= 0 && static_cast<uint32>(parent) < boneCount && static_cast<uint32>(parent) != i) ? parent : -1;
+		_bindPositions[i] = bones[i].Position;
+	}
+
+	/*-------------------------------------------------------------------
+	-   Depth of each bone. A bone on a parent cycle becomes a root.
+	---------------------------------------------------------------------*/
+	constexpr int32 UNVISITED = -1;
+	constexpr int32 VISITING  = -2;
+
+	gu::DynamicArray<int32> depths(boneCount, UNVISITED);
+	gu::DynamicArray<uint32> chain = {};
+
+	for (uint32 i = 0; i < boneCount; ++i)
+	{
+		// Walk up until a bone whose depth is known, then assign the depths back down
+		uint32 bone = i;
+		while (depths[bone] == UNVISITED)
+		{
+			depths[bone] = VISITING;
+			chain.Push(bone);
+			if (_parents[bone] < 0) { break; }
+			bone = static_cast<uint32>(_parents[bone]);
+		}
+
+		// The walk closed a cycle at bone: it becomes a root before the chain above it is unwound,
+		// so no bone takes its depth from a bone which is still being visited.
+		if (depths[bone] == VISITING && _parents[bone] >= 0)
+		{
+			_parents[bone] = -1;
+			depths[bone]   = 0;
+		}
+
+		while (!chain.IsEmpty())
+		{
+			const auto current = chain.Back();
+			const auto parent  = _parents[current];
+			depths[current] = parent < 0 ? 0 : depths[parent] + 1;
+			chain.Pop();
+		}
+	}
+
+	/*-------------------------------------------------------------------
+	-   Parent-before-child order (stable for the bones of the same depth)
+	---------------------------------------------------------------------*/
+	_evaluationOrder.Resize(boneCount);
+	for (uint32 i = 0; i < boneCount; ++i) { _evaluationOrder[i] = i; }
+	std::stable_sort(_evaluationOrder.Data(), _evaluationOrder.Data() + boneCount, [&depths](const uint32 a, const uint32 b)
+	{
+		return depths[a] < depths[b];
+	});
+
+	for (uint32 i = 0; i < boneCount; ++i)
+	{
+		const auto  parent   = _parents[i];
+		const auto& position = _bindPositions[i];
+		_bindLocalTranslations[i] = parent < 0 ? position : gm::Float3(
+			position.x - _bindPositions[parent].x,
+			position.y - _bindPositions[parent].y,
+			position.z - _bindPositions[parent].z);
+	}
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Public Function
+/****************************************************************************
+*                     ComputePalette
+*************************************************************************//**
+*  @fn        void Skeleton::ComputePalette(const LocalPose& pose, SkinningPalette& palette, const bool useDualQuaternions) const
+*
+*  @brief     local  = Scale * Rotation * Translation(bind local translation + pose translation)
+*             model  = local * parent model
+*             skin   = Translation(-bind position) * model
+*             The bones are processed in the evaluation order, so the parent model matrix is always ready.
+*
+*  @param[in] const LocalPose& pose
+*  @param[out]SkinningPalette& palette
+*  @param[in] const bool useDualQuaternions (SDEF / QDEF vertices need them)
+*
+*  @return    void
+*****************************************************************************/
+void Skeleton::ComputePalette(const LocalPose& pose, SkinningPalette& palette, const bool useDualQuaternions) const
+{
+	const auto boneCount = GetBoneCount();
+	Check(pose.GetBoneCount() == boneCount);
+
+	ResizeExactly(palette.BoneMatrices, boneCount);
+	ResizeExactly(palette.SkinMatrices, boneCount);
+	if (useDualQuaternions) { ResizeExactly(palette.DualQuaternions, boneCount); }
+
+	for (uint32 i = 0; i < boneCount; ++i)
+	{
+		const auto bone   = _evaluationOrder[i];
+		const auto parent = _parents[bone];
+
+		/*-------------------------------------------------------------------
+		-   Local transform
+		---------------------------------------------------------------------*/
+		const auto rotation = Vector::Set(pose.RotationX[bone], pose.RotationY[bone], pose.RotationZ[bone], pose.RotationW[bone]);
+		auto local = Matrix::RotationQuaternion(rotation);
+
+		const float scaleX = pose.ScaleX[bone], scaleY = pose.ScaleY[bone], scaleZ = pose.ScaleZ[bone];
+		if (scaleX != 1.0f || scaleY != 1.0f || scaleZ != 1.0f)
+		{
+			local = Matrix::Multiply(Matrix::Scaling(scaleX, scaleY, scaleZ), local);
+		}
+
+		const auto& bindLocal = _bindLocalTranslations[bone];
+		local.Row[3] = Vector::Set(bindLocal.x + pose.TranslationX[bone], bindLocal.y + pose.TranslationY[bone], bindLocal.z + pose.TranslationZ[bone], 1.0f);
+
+		/*-------------------------------------------------------------------
+		-   Model space
+		---------------------------------------------------------------------*/
+		const auto model = parent < 0 ? local : Matrix::Multiply(local, Matrix::LoadFloat4x4(palette.BoneMatrices[parent].u.a));
+		Matrix::StoreFloat4x4(palette.BoneMatrices[bone].u.a, model);
+
+		/*-------------------------------------------------------------------
+		-   Skin matrix : the inverse bind pose is a translation, so only the translation row changes
+		---------------------------------------------------------------------*/
+		const auto& bind = _bindPositions[bone];
+		auto translation = model.Row[3];
+		translation = Vector::NegativeMultiplySubtract(Vector::Set(bind.x), model.Row[0], translation);
+		translation = Vector::NegativeMultiplySubtract(Vector::Set(bind.y), model.Row[1], translation);
+		translation = Vector::NegativeMultiplySubtract(Vector::Set(bind.z), model.Row[2], translation);
+
+		const auto skin = Matrix::Transpose(MATRIX128(model.Row[0], model.Row[1], model.Row[2], translation));
+		auto* skinRows  = palette.SkinMatrices[bone].u.a;
+		Vector::StoreFloat4(&skinRows[0], skin.Row[0]);
+		Vector::StoreFloat4(&skinRows[4], skin.Row[1]);
+		Vector::StoreFloat4(&skinRows[8], skin.Row[2]);
+
+		if (!useDualQuaternions) { continue; }
+
+		/*-------------------------------------------------------------------
+		-   Dual quaternion (real : model rotation, dual : 0.5 * translation * real)
+		---------------------------------------------------------------------*/
+		auto& dualQuaternion = palette.DualQuaternions[bone];
+		const auto modelRotation = parent < 0 ? rotation : Quaternion::Multiply(Vector::LoadFloat4(&palette.DualQuaternions[parent].Real.x), rotation);
+
+		// renormalized in scalar to stop the drift along long chains
+		gm::Float4 q = {};
+		Vector::StoreFloat4(&q.x, modelRotation);
+		const float lengthSquared = q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w;
+		const float inverse       = lengthSquared > 0.0f ? 1.0f / std::sqrt(lengthSquared) : 0.0f;
+		q = gm::Float4(q.x * inverse, q.y * inverse, q.z * inverse, q.w * inverse);
+		dualQuaternion.Real = q;
+
+		gm::Float4 t = {};
+		Vector::StoreFloat4(&t.x, translation);
+
+		dualQuaternion.Dual = gm::Float4(
+			0.5f * ( t.x * q.w + t.y * q.z - t.z * q.y),
+			0.5f * (-t.x * q.z + t.y * q.w + t.z * q.x),
+			0.5f * ( t.x * q.y - t.y * q.x + t.z * q.w),
+			0.5f * (-t.x * q.x - t.y * q.y - t.z * q.z));
+	}
+}
+#pragma endregion Public Function
@@ -0,0 +1,148 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   BasePassClusteredLightCulling.hpp
+///             @brief  Clustered light culling binned on the CPU (scene point light and spot light)
+///                     - An alternative of LightCulling. The lights are assigned to the view frustum clusters
+///                       by LightClusterBinner, so neither the Z prepass nor the compute pass is needed.
+///                     - The cluster ranges and the light indices are written straight into
+///                       the persistently mapped upload buffers of the current frame, which grow when they are short.
+///                     - The shader side is Shader/Lighting/ShaderClusteredLighting.hlsli.
+///             How To: culling.Execute(camera, pointLights, pointCount, spotLights, spotCount, threadPool)
+///                     culling.Bind(commandList, infoIndex, rangeIndex, lightIndexIndex)
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef BASE_PASS_CLUSTERED_LIGHT_CULLING_HPP
+#define BASE_PASS_CLUSTERED_LIGHT_CULLING_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Rendering/Light/Include/LightClusterBinner.hpp"
+#include "GameUtility/Base/Include/GUSmartPointer.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+class LowLevelGraphicsEngine;
+class FrameConstantBuffer;
+namespace rhi::core
+{
+	class GPUBuffer;
+	class GPUResourceView;
+	class RHICommandList;
+}
+
+namespace gc
+{
+	class Camera;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gc::basepass
+{
+	struct ClusteredLightCullingDesc
+	{
+		rendering::LightClusterGridDesc Grid = {};
+
+		/* @brief : Initial light index capacity of each frame buffer*/
+		gu::uint32 InitialIndexCount = 16384;
+	};
+
+	/****************************************************************************
+	*				  		ClusteredLightCulling
+	*************************************************************************//**
+	*  @class     ClusteredLightCulling
+	*  @brief     Spot light and point light culling by the CPU clusters
+	*****************************************************************************/
+	class ClusteredLightCulling : public gu::NonCopyable
+	{
+	protected:
+		using LowLevelGraphicsEnginePtr = gu::SharedPointer<LowLevelGraphicsEngine>;
+		using CameraPtr                 = gu::SharedPointer<gc::Camera>;
+		using BufferPtr                 = gu::SharedPointer<rhi::core::GPUBuffer>;
+		using ResourceViewPtr           = gu::SharedPointer<rhi::core::GPUResourceView>;
+		using CommandListPtr            = gu::SharedPointer<rhi::core::RHICommandList>;
+		using ConstantBufferPtr         = gu::SharedPointer<FrameConstantBuffer>;
+
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Bin the lights in the camera clusters, and upload the result to the current frame buffers.
+		            The light indices address the light arrays given here.*/
+		void Execute(const CameraPtr& camera,
+			const rendering::PointLightData* pointLights, const gu::uint32 pointLightCount,
+			const rendering::SpotLightData*  spotLights , const gu::uint32 spotLightCount,
+			gu::ThreadPool* threadPool = nullptr);
+
+		/* @brief : Bind the cluster info (CBV), the cluster ranges (SRV) and the light indices (SRV) of the current frame*/
+		void Bind(const CommandListPtr& commandList, const gu::uint32 infoIndex, const gu::uint32 rangeIndex, const gu::uint32 lightIndexIndex);
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		ResourceViewPtr GetClusterInfoView() const;
+
+		ResourceViewPtr GetClusterRangeView() const { return _frames[_frameIndex].RangeView; }
+
+		ResourceViewPtr GetLightIndexView() const { return _frames[_frameIndex].IndexView; }
+
+		const rendering::LightClusterBinner& GetBinner() const noexcept { return _binner; }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		ClusteredLightCulling(const LowLevelGraphicsEnginePtr& engine, const ClusteredLightCullingDesc& desc = {});
+
+		~ClusteredLightCulling();
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+		void PrepareBuffer(const ClusteredLightCullingDesc& desc);
+
+		/* @brief : Replace the light index buffer of the frame with the one having at least indexCount elements*/
+		void PrepareIndexBuffer(const gu::uint32 frameIndex, const gu::uint32 indexCount);
+
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		/* @brief : Cluster info constants (same layout as the LightClusterInfo cbuffer)*/
+		struct ClusterInfo
+		{
+			gu::uint32 CountX     = 0;
+			gu::uint32 CountY     = 0;
+			gu::uint32 CountZ     = 0;
+			float      DepthScale = 0.0f;
+			float      DepthBias  = 0.0f;
+			float      TileScaleX = 0.0f;
+			float      TileScaleY = 0.0f;
+			float      Padding    = 0.0f;
+		};
+
+		/* @brief : Persistently mapped upload buffers of a frame in flight*/
+		struct FrameResource
+		{
+			BufferPtr       RangeBuffer   = nullptr;
+			BufferPtr       IndexBuffer   = nullptr;
+			ResourceViewPtr RangeView     = nullptr;
+			ResourceViewPtr IndexView     = nullptr;
+			gu::uint32      IndexCapacity = 0;
+		};
+
+		LowLevelGraphicsEnginePtr _engine = nullptr;
+
+		rendering::LightClusterBinner _binner;
+
+		gu::DynamicArray<FrameResource> _frames = {};
+
+		ConstantBufferPtr _clusterInfo = nullptr;
+
+		gu::uint32 _frameIndex = 0;
+	};
+}
+#endif
@@ -111,6 +111,9 @@ namespace gc::basepass
 		---------------------------------------------------------------------*/
 		PipelineStatePtr  _pipeline = nullptr;
 
+		/* @brief : Pipeline of the models loaded with gc::core::ModelVertexFormat::Compressed*/
+		PipelineStatePtr  _compressedPipeline = nullptr;
+
 		ResourceLayoutPtr _resourceLayout = nullptr;
 
 		RenderPassPtr _renderPass = nullptr;
@@ -0,0 +1,210 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   BasePassClusteredLightCulling.cpp
+///             @brief  Clustered light culling binned on the CPU
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/BasePassClusteredLightCulling.hpp"
+#include "GameCore/Core/Include/Camera.hpp"
+#include "GameUtility/Base/Include/Screen.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include "GraphicsCore/Engine/Include/LowLevelGraphicsEngine.hpp"
+#include "GraphicsCore/Engine/Include/FrameUploadAllocator.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUBuffer.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUResourceView.hpp"
+#include <algorithm>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi::core;
+using namespace gc::basepass;
+using namespace gc::rendering;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+ClusteredLightCulling::ClusteredLightCulling(const LowLevelGraphicsEnginePtr& engine, const ClusteredLightCullingDesc& desc)
+	: _engine(engine), _binner(desc.Grid)
+{
+	Checkf(_engine, "engine is nullptr");
+
+	PrepareBuffer(desc);
+}
+
+ClusteredLightCulling::~ClusteredLightCulling()
+{
+	for (gu::uint64 i = 0; i < _frames.Size(); ++i)
+	{
+		if (_frames[i].RangeBuffer) { _frames[i].RangeBuffer->CopyEnd(); }
+		if (_frames[i].IndexBuffer) { _frames[i].IndexBuffer->CopyEnd(); }
+	}
+	_frames.Clear();
+	_frames.ShrinkToFit();
+}
+
+#pragma endregion Constructor and Destructor
+
+#pragma region Main Function
+/****************************************************************************
+*                        Execute
+*************************************************************************//**
+*  @fn        void ClusteredLightCulling::Execute(const CameraPtr& camera,
+*                  const rendering::PointLightData* pointLights, const gu::uint32 pointLightCount,
+*                  const rendering::SpotLightData*  spotLights , const gu::uint32 spotLightCount,
+*                  gu::ThreadPool* threadPool)
+*
+*  @brief     Bin the lights on the CPU and write the result to the upload buffers of the current frame.
+*             The buffers of the frame index are no longer read by the GPU, because the engine has waited for its fence.
+*
+*  @param[in] const CameraPtr& camera (perspective)
+*  @param[in] const rendering::PointLightData* pointLights
+*  @param[in] const gu::uint32 pointLightCount
+*  @param[in] const rendering::SpotLightData* spotLights
+*  @param[in] const gu::uint32 spotLightCount
+*  @param[in] gu::ThreadPool* threadPool (nullptr : serial)
+*
+*  @return    void
+*****************************************************************************/
+void ClusteredLightCulling::Execute(const CameraPtr& camera,
+	const rendering::PointLightData* pointLights, const gu::uint32 pointLightCount,
+	const rendering::SpotLightData*  spotLights , const gu::uint32 spotLightCount,
+	gu::ThreadPool* threadPool)
+{
+	Checkf(camera, "camera is nullptr");
+
+	/*-------------------------------------------------------------------
+	-           Bin the lights
+	---------------------------------------------------------------------*/
+	LightClusterView view = {};
+	view.View        = camera->GetViewMatrix4x4f();
+	view.FovVertical = camera->GetFovVertical();
+	view.Aspect      = camera->GetAspect();
+	view.NearZ       = camera->GetNearZ();
+	view.FarZ        = camera->GetFarZ();
+
+	_binner.Bin(view, pointLights, pointLightCount, spotLights, spotLightCount, threadPool);
+
+	/*-------------------------------------------------------------------
+	-           Write to the current frame
+	---------------------------------------------------------------------*/
+	_frameIndex = _engine->GetCurrentFrameIndex();
+	if (_binner.GetIndexCount() > _frames[_frameIndex].IndexCapacity)
+	{
+		PrepareIndexBuffer(_frameIndex, _binner.GetIndexCount());
+	}
+
+	const auto& frame = _frames[_frameIndex];
+	_binner.Write(reinterpret_cast<LightClusterRange*>(frame.RangeBuffer->GetCPUMemory()),
+		reinterpret_cast<gu::uint32*>(frame.IndexBuffer->GetCPUMemory()));
+
+	/*-------------------------------------------------------------------
+	-           Cluster info
+	---------------------------------------------------------------------*/
+	const auto& grid = _binner.GetGrid();
+
+	ClusterInfo info = {};
+	info.CountX     = grid.CountX;
+	info.CountY     = grid.CountY;
+	info.CountZ     = grid.CountZ;
+	info.DepthScale = _binner.GetDepthScale();
+	info.DepthBias  = _binner.GetDepthBias();
+	info.TileScaleX = static_cast<float>(grid.CountX) / static_cast<float>((std::max)(Screen::GetScreenWidth() , 1));
+	info.TileScaleY = static_cast<float>(grid.CountY) / static_cast<float>((std::max)(Screen::GetScreenHeight(), 1));
+	_clusterInfo->SetData(&info, sizeof(info));
+}
+
+/****************************************************************************
+*                        Bind
+*************************************************************************//**
+*  @fn        void ClusteredLightCulling::Bind(const CommandListPtr& commandList, const gu::uint32 infoIndex, const gu::uint32 rangeIndex, const gu::uint32 lightIndexIndex)
+*
+*  @brief     Bind the cluster views of the current frame
+*
+*  @param[in] const CommandListPtr& commandList
+*  @param[in] const gu::uint32 infoIndex (LightClusterInfo)
+*  @param[in] const gu::uint32 rangeIndex (LightClusterRanges)
+*  @param[in] const gu::uint32 lightIndexIndex (LightClusterIndices)
+*
+*  @return    void
+*****************************************************************************/
+void ClusteredLightCulling::Bind(const CommandListPtr& commandList, const gu::uint32 infoIndex, const gu::uint32 rangeIndex, const gu::uint32 lightIndexIndex)
+{
+	_clusterInfo->GetView()->Bind(commandList, infoIndex);
+	_frames[_frameIndex].RangeView->Bind(commandList, rangeIndex);
+	_frames[_frameIndex].IndexView->Bind(commandList, lightIndexIndex);
+}
+
+ClusteredLightCulling::ResourceViewPtr ClusteredLightCulling::GetClusterInfoView() const
+{
+	return _clusterInfo->GetView();
+}
+
+#pragma endregion Main Function
+
+#pragma region Set Up Function
+/****************************************************************************
+*                        PrepareBuffer
+*************************************************************************//**
+*  @fn        void ClusteredLightCulling::PrepareBuffer(const ClusteredLightCullingDesc& desc)
+*
+*  @brief     Prepare the cluster info constant buffer and the mapped upload buffers of each frame in flight
+*
+*  @param[in] const ClusteredLightCullingDesc& desc
+*
+*  @return    void
+*****************************************************************************/
+void ClusteredLightCulling::PrepareBuffer(const ClusteredLightCullingDesc& desc)
+{
+	const auto device = _engine->GetDevice();
+
+	_clusterInfo = gu::MakeShared<FrameConstantBuffer>(_engine->GetFrameUploadAllocator(), device, sizeof(ClusterInfo));
+
+	_frames.Resize(LowLevelGraphicsEngine::FRAME_BUFFER_COUNT);
+	for (gu::uint32 i = 0; i < LowLevelGraphicsEngine::FRAME_BUFFER_COUNT; ++i)
+	{
+		auto& frame = _frames[i];
+
+		const auto metaData = GPUBufferMetaData::UploadBuffer(sizeof(LightClusterRange), _binner.GetClusterCount());
+		frame.RangeBuffer = device->CreateBuffer(metaData, SP("ClusteredLightCulling::ClusterRanges"));
+		frame.RangeBuffer->CopyStart();
+		frame.RangeView   = device->CreateResourceView(ResourceViewType::StructuredBuffer, frame.RangeBuffer, 0, 0, nullptr);
+
+		PrepareIndexBuffer(i, desc.InitialIndexCount);
+	}
+}
+
+/****************************************************************************
+*                        PrepareIndexBuffer
+*************************************************************************//**
+*  @fn        void ClusteredLightCulling::PrepareIndexBuffer(const gu::uint32 frameIndex, const gu::uint32 indexCount)
+*
+*  @brief     Replace the light index buffer of the frame with the twice larger one (at least indexCount elements)
+*
+*  @param[in] const gu::uint32 frameIndex
+*  @param[in] const gu::uint32 indexCount
+*
+*  @return    void
+*****************************************************************************/
+void ClusteredLightCulling::PrepareIndexBuffer(const gu::uint32 frameIndex, const gu::uint32 indexCount)
+{
+	const auto device = _engine->GetDevice();
+	auto& frame = _frames[frameIndex];
+
+	gu::uint32 capacity = (std::max)(frame.IndexCapacity, 1u);
+	while (capacity < indexCount) { capacity *= 2; }
+
+	if (frame.IndexBuffer) { frame.IndexBuffer->CopyEnd(); }
+
+	const auto metaData = GPUBufferMetaData::UploadBuffer(sizeof(gu::uint32), capacity);
+	frame.IndexBuffer   = device->CreateBuffer(metaData, SP("ClusteredLightCulling::LightIndices"));
+	frame.IndexBuffer->CopyStart();
+	frame.IndexView     = device->CreateResourceView(ResourceViewType::StructuredBuffer, frame.IndexBuffer, 0, 0, nullptr);
+	frame.IndexCapacity = capacity;
+}
+#pragma endregion Set Up Function
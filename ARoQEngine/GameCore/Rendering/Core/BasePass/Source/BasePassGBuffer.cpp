@@ -68,10 +68,11 @@ void GBuffer::Draw(const GPUResourceViewPtr& scene)
 	---------------------------------------------------------------------*/
 	commandList->SetDescriptorHeap(scene->GetHeap());
 	commandList->SetResourceLayout(_resourceLayout);
-	commandList->SetGraphicsPipeline(_pipeline);
 	scene->Bind(commandList, 0);
 	for (const auto& gameModel : _gameModels)
 	{
+		// The compressed vertex buffer needs its own input layout
+		commandList->SetGraphicsPipeline(gameModel->GetLoadedVertexFormat() == gc::core::ModelVertexFormat::Compressed ? _compressedPipeline : _pipeline);
 		gameModel->Draw(true);
 	}
 
@@ -117,10 +118,12 @@ void GBuffer::PreparePipelineState(const gu::tstring& name)
 	/*-------------------------------------------------------------------
 	-             Setup shader
 	---------------------------------------------------------------------*/
-	const auto vs = factory->CreateShaderState();
-	const auto ps = factory->CreateShaderState();
+	const auto vs           = factory->CreateShaderState();
+	const auto ps           = factory->CreateShaderState();
+	const auto compressedVS = factory->CreateShaderState();
 	vs->Compile(ShaderType::Vertex, SP("Shader\\Lighting\\ShaderGBuffer.hlsl"), SP("VSMain"), 6.4f, { SP("Shader\\Core") });
 	ps->Compile(ShaderType::Pixel , SP("Shader\\Lighting\\ShaderGBuffer.hlsl"), SP("PSMain"), 6.4f, { SP("Shader\\Core") });
+	compressedVS->Compile(ShaderType::Vertex, SP("Shader\\Lighting\\ShaderGBuffer.hlsl"), SP("VSMain"), 6.4f, { SP("Shader\\Core") }, { SP("USE_COMPRESSED_VERTEX") });
 
 	/*-------------------------------------------------------------------
 	-             Setup blend state (all alpha blend)
@@ -139,6 +142,19 @@ void GBuffer::PreparePipelineState(const gu::tstring& name)
 	_pipeline->SetPixelShader(ps);
 	_pipeline->CompleteSetting();
 	_pipeline->SetName(name + SP("PSO"));
+
+	/*-------------------------------------------------------------------
+	-             Compressed vertex (only the input layout and the vertex shader differ)
+	---------------------------------------------------------------------*/
+	_compressedPipeline = device->CreateGraphicPipelineState(_renderPass, _resourceLayout);
+	_compressedPipeline->SetBlendState        (factory->CreateBlendState(blends));
+	_compressedPipeline->SetRasterizerState   (factory->CreateRasterizerState(RasterizerProperty::Solid()));
+	_compressedPipeline->SetInputAssemblyState(factory->CreateInputAssemblyState(GPUInputAssemblyState::GetCompressedSkinVertexElement()));
+	_compressedPipeline->SetDepthStencilState (factory->CreateDepthStencilState());
+	_compressedPipeline->SetVertexShader(compressedVS);
+	_compressedPipeline->SetPixelShader(ps);
+	_compressedPipeline->CompleteSetting();
+	_compressedPipeline->SetName(name + SP("CompressedVertexPSO"));
 }
 
 /****************************************************************************
@@ -83,10 +83,11 @@ void ZPrepass::Draw(const GPUResourceViewPtr& scene)
 	---------------------------------------------------------------------*/
 	commandList->SetDescriptorHeap(scene->GetHeap());
 	commandList->SetResourceLayout(_resourceLayout);
-	commandList->SetGraphicsPipeline(_pipeline);
 	scene->Bind(commandList, 0); // scene constants
 	for (const auto& gameModel : _gameModels)
 	{
+		// The compressed vertex buffer needs its own input layout
+		commandList->SetGraphicsPipeline(gameModel->GetLoadedVertexFormat() == gc::core::ModelVertexFormat::Compressed ? _compressedPipeline : _pipeline);
 		gameModel->Draw(false);
 	}
 
@@ -176,10 +177,12 @@ void ZPrepass::PreparePipelineState(const gu::tstring& name)
 	/*-------------------------------------------------------------------
 	-             Set up graphic pipeline state
 	---------------------------------------------------------------------*/
-	const auto vs = factory->CreateShaderState();
-	const auto ps = factory->CreateShaderState();
+	const auto vs           = factory->CreateShaderState();
+	const auto ps           = factory->CreateShaderState();
+	const auto compressedVS = factory->CreateShaderState();
 	vs->Compile(ShaderType::Vertex, SP("Shader\\Lighting\\ShaderZPrepass.hlsl"), SP("VSMain"), 6.4f, { SP("Shader\\Core")});
 	ps->Compile(ShaderType::Pixel , SP("Shader\\Lighting\\ShaderZPrepass.hlsl"), SP("PSMain"), 6.4f, { SP("Shader\\Core") });
+	compressedVS->Compile(ShaderType::Vertex, SP("Shader\\Lighting\\ShaderZPrepass.hlsl"), SP("VSMain"), 6.4f, { SP("Shader\\Core") }, { SP("USE_COMPRESSED_VERTEX") });
 
 	/*-------------------------------------------------------------------
 	-             Set up graphic pipeline state
@@ -193,6 +196,19 @@ void ZPrepass::PreparePipelineState(const gu::tstring& name)
 	_pipeline->SetPixelShader(ps);
 	_pipeline->CompleteSetting();
 	_pipeline->SetName(name + SP("PSO"));
+
+	/*-------------------------------------------------------------------
+	-             Compressed vertex (only the input layout and the vertex shader differ)
+	---------------------------------------------------------------------*/
+	_compressedPipeline = device->CreateGraphicPipelineState(_renderPass, _resourceLayout);
+	_compressedPipeline->SetBlendState(factory->CreateSingleBlendState(BlendProperty::AlphaBlend()));
+	_compressedPipeline->SetRasterizerState   (factory->CreateRasterizerState(RasterizerProperty::Solid()));
+	_compressedPipeline->SetInputAssemblyState(factory->CreateInputAssemblyState(GPUInputAssemblyState::GetCompressedSkinVertexElement()));
+	_compressedPipeline->SetDepthStencilState(factory->CreateDepthStencilState());
+	_compressedPipeline->SetVertexShader(compressedVS);
+	_compressedPipeline->SetPixelShader(ps);
+	_compressedPipeline->CompleteSetting();
+	_compressedPipeline->SetName(name + SP("CompressedVertexPSO"));
 }
 
 /****************************************************************************
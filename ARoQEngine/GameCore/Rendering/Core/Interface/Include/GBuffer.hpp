@@ -112,6 +112,9 @@ namespace gc::rendering
 		---------------------------------------------------------------------*/
 		PipelineStatePtr _pipeline = nullptr;
 
+		/* @brief : Pipeline of the models loaded with gc::core::ModelVertexFormat::Compressed*/
+		PipelineStatePtr _compressedPipeline = nullptr;
+
 		ResourceLayoutPtr _resourceLayout = nullptr;
 
 		RenderPassPtr _renderPass = nullptr;
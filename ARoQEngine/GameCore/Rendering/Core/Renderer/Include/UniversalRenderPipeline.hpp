@@ -13,6 +13,7 @@
 //////////////////////////////////////////////////////////////////////////////////
 #include "RenderPipeline.hpp"
 #include "GameCore/Rendering/Light/Include/SceneLightBuffer.hpp"
+#include "GameCore/Rendering/Model/Include/MeshLOD.hpp"
 #include <vector>
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -86,6 +87,9 @@ namespace gc
 		template<class TLight> requires std::is_base_of_v<gc::rendering::LightData, TLight> 
 		void SetLight(const gc::rendering::LightType type, const std::uint32_t index, const TLight& light);
 
+		/* @brief : Main camera projection used by the level of detail selection (set every frame before Draw)*/
+		void SetLODView(const core::LODView& view) { _lodView = view; }
+
 		/****************************************************************************
 		**                Constructor and Destructor
 		*****************************************************************************/
@@ -120,10 +124,18 @@ namespace gc
 
 		PipelineStatePtr _pipeline = nullptr;
 
+		/* @brief : Pipeline of the models loaded with core::ModelVertexFormat::Compressed*/
+		PipelineStatePtr _compressedPipeline = nullptr;
+
 		gu::SharedPointer<GameTimer> _gameTimer = nullptr;
 
 		std::vector<GameModelPtr> _forwardModels  = {};
 
+		/* @brief : Every added model (selects the main view level of detail once a frame)*/
+		std::vector<GameModelPtr> _gameModels = {};
+
+		core::LODView _lodView = {};
+
 		ResourceViewPtr _scene = nullptr;
 
 		static constexpr std::uint32_t MAX_UI_COUNT = 1024;
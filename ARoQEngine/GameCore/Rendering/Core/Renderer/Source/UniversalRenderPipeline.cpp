@@ -58,6 +58,8 @@ URP::~URP()
 {
 	_forwardModels.clear();
 	_forwardModels.shrink_to_fit();
+	_gameModels.clear();
+	_gameModels.shrink_to_fit();
 }
 
 #pragma endregion Constructor and Destructor
@@ -72,6 +74,15 @@ bool URP::Draw()
 
 	const auto commandList = _engine->GetCommandList(CommandListType::Graphics);
 	if (!commandList->IsOpen()) { return false; }
+	/*-------------------------------------------------------------------
+	-         Level of detail of the main view (shared by the z prepass, the gbuffer and the forward pass)
+	---------------------------------------------------------------------*/
+	for (const auto& model : _gameModels)
+	{
+		if (!model->IsActive()) { continue; }
+		model->SelectLOD(core::LODViewType::Main, _lodView);
+	}
+
 	/*-------------------------------------------------------------------
 	-         Preprocess
 	---------------------------------------------------------------------*/
@@ -85,7 +96,6 @@ bool URP::Draw()
 	---------------------------------------------------------------------*/
 	_engine->BeginSwapchainRenderPass();
 	commandList->SetResourceLayout(_resourceLayout);
-	commandList->SetGraphicsPipeline(_pipeline);
 	_scene->Bind(commandList, 0);
 	_directionalLights->BindLightData(commandList, 2);
 	_cascadeShadowMap->GetShadowInfoView()->Bind(commandList, 3);
@@ -94,6 +104,9 @@ bool URP::Draw()
 		// model active check
 		if (!model->IsActive()) { continue; }
 
+		// the compressed vertex buffer needs its own input layout
+		commandList->SetGraphicsPipeline(model->GetLoadedVertexFormat() == core::ModelVertexFormat::Compressed ? _compressedPipeline : _pipeline);
+
 		// forward rendering with each materials
 		model->Draw(true, 4);
 	}
@@ -110,6 +123,7 @@ void URP::Add(const URPDrawType type, const GameModelPtr& gameModel)
 	_cascadeShadowMap->Add(gameModel);
 	_zPrepass->Add(gameModel);
 	_gBuffer ->Add(gameModel);
+	_gameModels.push_back(gameModel);
 
 	if (type & URPDrawType::Differed)
 	{
@@ -149,9 +163,11 @@ void URP::PrepareModelPipeline()
 	/*-------------------------------------------------------------------
 	-             Setup shader
 	---------------------------------------------------------------------*/
-	const auto vs = factory->CreateShaderState();
-	const auto ps = factory->CreateShaderState();
+	const auto vs           = factory->CreateShaderState();
+	const auto ps           = factory->CreateShaderState();
+	const auto compressedVS = factory->CreateShaderState();
 	vs->Compile(ShaderType::Vertex, SP("Shader\\Model\\ShaderURPForwardRendering.hlsl"), SP("VSMain"), 6.4f, { SP("Shader\\Core") });
+	compressedVS->Compile(ShaderType::Vertex, SP("Shader\\Model\\ShaderURPForwardRendering.hlsl"), SP("VSMain"), 6.4f, { SP("Shader\\Core") }, { SP("USE_COMPRESSED_VERTEX") });
 	ps->Compile(ShaderType::Pixel, SP("Shader\\Model\\ShaderURPForwardRendering.hlsl"),  SP("PSMain"), 6.4f, { SP("Shader\\Core" )}, {SP("USE_SPECULAR_F_NONE")});
 
 	/*-------------------------------------------------------------------
@@ -170,5 +186,18 @@ void URP::PrepareModelPipeline()
 	_pipeline->SetPixelShader(ps);
 	_pipeline->CompleteSetting();
 	_pipeline->SetName(SP("URP::PSO"));
+
+	/*-------------------------------------------------------------------
+	-             Compressed vertex (only the input layout and the vertex shader differ)
+	---------------------------------------------------------------------*/
+	_compressedPipeline = device->CreateGraphicPipelineState(_engine->GetRenderPass(), _resourceLayout);
+	_compressedPipeline->SetBlendState(factory->CreateSingleBlendState(blend));
+	_compressedPipeline->SetRasterizerState(factory->CreateRasterizerState(RasterizerProperty::Solid(false, FrontFace::Clockwise, CullingMode::Back)));
+	_compressedPipeline->SetInputAssemblyState(factory->CreateInputAssemblyState(GPUInputAssemblyState::GetCompressedSkinVertexElement()));
+	_compressedPipeline->SetDepthStencilState(factory->CreateDepthStencilState(depthProp));
+	_compressedPipeline->SetVertexShader(compressedVS);
+	_compressedPipeline->SetPixelShader(ps);
+	_compressedPipeline->CompleteSetting();
+	_compressedPipeline->SetName(SP("URP::CompressedVertexPSO"));
 }
 #pragma endregion SetUp
\ No newline at end of file
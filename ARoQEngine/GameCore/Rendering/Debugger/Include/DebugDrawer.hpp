@@ -99,6 +99,9 @@ namespace gc::rendering
 		-          Render Resource
 		---------------------------------------------------------------------*/
 		PipelineStatePtr _pipeline = nullptr;
+
+		/* @brief : Pipeline of the models loaded with gc::core::ModelVertexFormat::Compressed*/
+		PipelineStatePtr _compressedPipeline = nullptr;
 		
 		ResourceLayoutPtr _resourceLayout = nullptr;
 	};
@@ -68,10 +68,11 @@ void DebugDrawer::Draw(const GPUResourceViewPtr& scene)
 	---------------------------------------------------------------------*/
 	commandList->SetDescriptorHeap(scene->GetHeap());
 	commandList->SetResourceLayout(_resourceLayout);
-	commandList->SetGraphicsPipeline(_pipeline);
 	scene->Bind(commandList, 0); // sceneConstants
 	for (const auto gameModel : _gameModels)
 	{
+		// The compressed vertex buffer needs its own input layout
+		commandList->SetGraphicsPipeline(gameModel->GetLoadedVertexFormat() == gc::core::ModelVertexFormat::Compressed ? _compressedPipeline : _pipeline);
 		gameModel->Draw(false);
 	}
 #endif
@@ -138,9 +139,11 @@ void DebugDrawer::PreparePipelineState(const gu::tstring& name)
 	/*-------------------------------------------------------------------
 	-             Set up graphic pipeline state
 	---------------------------------------------------------------------*/
-	const auto vs = factory->CreateShaderState();
-	const auto ps = factory->CreateShaderState();
+	const auto vs           = factory->CreateShaderState();
+	const auto ps           = factory->CreateShaderState();
+	const auto compressedVS = factory->CreateShaderState();
 	vs->Compile(ShaderType::Vertex, SP("Shader\\Core\\ShaderDebug.hlsl"), SP("VSMain"), 6.4f, { SP("Shader\\Core") });
+	compressedVS->Compile(ShaderType::Vertex, SP("Shader\\Core\\ShaderDebug.hlsl"), SP("VSMain"), 6.4f, { SP("Shader\\Core") }, { SP("USE_COMPRESSED_VERTEX") });
 	ps->Compile(ShaderType::Pixel , SP("Shader\\Core\\ShaderDebug.hlsl"), SP("PSMain"), 6.4f, { SP("Shader\\Core") });
 
 	/*-------------------------------------------------------------------
@@ -156,6 +159,19 @@ void DebugDrawer::PreparePipelineState(const gu::tstring& name)
 	_pipeline->CompleteSetting();
 	_pipeline->SetName(name + SP("pso"));
 
+	/*-------------------------------------------------------------------
+	-             Compressed vertex (only the input layout and the vertex shader differ)
+	---------------------------------------------------------------------*/
+	_compressedPipeline = device->CreateGraphicPipelineState(_engine->GetRenderPass(), _resourceLayout);
+	_compressedPipeline->SetBlendState(factory->CreateSingleBlendState(BlendProperty::AlphaBlend()));
+	_compressedPipeline->SetRasterizerState(factory->CreateRasterizerState(RasterizerProperty::WireFrame()));
+	_compressedPipeline->SetDepthStencilState(factory->CreateDepthStencilState());
+	_compressedPipeline->SetInputAssemblyState(factory->CreateInputAssemblyState(GPUInputAssemblyState::GetCompressedSkinVertexElement()));
+	_compressedPipeline->SetVertexShader(compressedVS);
+	_compressedPipeline->SetPixelShader(ps);
+	_compressedPipeline->CompleteSetting();
+	_compressedPipeline->SetName(name + SP("compressedVertexPso"));
+
 }
 
 #pragma endregion Set up
\ No newline at end of file
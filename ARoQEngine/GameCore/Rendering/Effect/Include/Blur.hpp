@@ -64,6 +64,12 @@ namespace gc
 		};
 
 	public:
+		/****************************************************************************
+		**                Static Configuration
+		*****************************************************************************/
+		/* @brief : Source texels sampled on each side of a pixel by the x and y blur*/
+		static constexpr std::uint32_t KERNEL_RADIUS = 16;
+
 		/****************************************************************************
 		**                Public Function
 		*****************************************************************************/
@@ -74,6 +80,10 @@ namespace gc
 		void DrawCS(const ResourceViewPtr& sourceSRV, const ResourceViewPtr& destUAV);
 		
 		void DrawPS(const FrameBufferPtr& frameBuffer, const std::uint32_t renderTargetIndex = 0);
+
+		/* @brief : Blur the region (normalized left, top, right, bottom) of the source into the destination.
+		            The destination keeps the pixels outside of the region.*/
+		void DrawPS(const ResourceViewPtr& source, const FrameBufferPtr& destination, const gm::Float4& region);
 		/****************************************************************************
 		**                Public Member Variables
 		*****************************************************************************/
@@ -105,6 +115,9 @@ namespace gc
 		void PrepareResourceView();
 
 		void PrepareVertexAndIndexBuffer(const gu::tstring& addName);
+
+		/* @brief : x blur, y blur and the final pass. (region == nullptr : the whole frame buffers)*/
+		void DrawPSPasses(const ResourceViewPtr& source, const FrameBufferPtr& destination, const gm::Float4* region);
 		
 		/****************************************************************************
 		**                Protected Member Variables
@@ -21,6 +21,7 @@
 #include "GameUtility/Math/Include/GMVertex.hpp"
 #include "GameUtility/Base/Include/Screen.hpp"
 #include <iostream>
+#include <cmath>
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
@@ -38,6 +39,23 @@ namespace
 		return expf(-0.5f * (float)(r * r) / (sigma * sigma));
 	}
 
+	/* @brief : Pixels of the first render target covered by the normalized region*/
+	ScissorRect ToScissorRect(const FrameBufferPtr& frameBuffer, const gm::Float4& region)
+	{
+		const auto  texture = frameBuffer->GetRenderTarget();
+		const float width   = static_cast<float>(texture->GetWidth());
+		const float height  = static_cast<float>(texture->GetHeight());
+
+		const auto Clamp = [](const float value) { return (std::min)((std::max)(value, 0.0f), 1.0f); };
+		return ScissorRect
+		(
+			static_cast<long>(std::floor(Clamp(region.x) * width)),
+			static_cast<long>(std::floor(Clamp(region.y) * height)),
+			static_cast<long>(std::ceil (Clamp(region.z) * width)),
+			static_cast<long>(std::ceil (Clamp(region.w) * height))
+		);
+	}
+
 }
 
 GaussianBlur::GaussianBlur()
@@ -142,61 +160,28 @@ void GaussianBlur::DrawPS(const FrameBufferPtr& frameBuffer, const std::uint32_t
 {
 	Check(!_useCS);
 
-	const auto device       = _engine->GetDevice();
-	const auto commandList  = _engine->GetCommandList(CommandListType::Graphics);
-	const auto currentFrame = _engine->GetCurrentFrameIndex();
-	const auto inputImage   = frameBuffer->GetRenderTargetSRV(renderTargetIndex);
-
-	/*-------------------------------------------------------------------
-	-               Change render resource
-	---------------------------------------------------------------------*/
-	commandList->EndRenderPass();
-
-	/*-------------------------------------------------------------------
-	-               Set graphics pipeline
-	---------------------------------------------------------------------*/
-	commandList->SetDescriptorHeap(_blurParameterView->GetHeap());
-	commandList->SetGraphicsPipeline(_xBlur.Pipeline);
-	commandList->SetResourceLayout(_resourceLayout);
-		
-	/*-------------------------------------------------------------------
-	-               Bind gpu resources
-	---------------------------------------------------------------------*/
-	_blurParameterView->Bind(commandList, 0, _resourceLayout);
-	_textureSizeView  ->Bind(commandList, 1, _resourceLayout);
+	DrawPSPasses(frameBuffer->GetRenderTargetSRV(renderTargetIndex), frameBuffer, nullptr);
+}
 
-	/*-------------------------------------------------------------------
-	-               XBlur
-	---------------------------------------------------------------------*/
-	commandList->BeginRenderPass(_xBlur.RenderPass, _xBlur.FrameBuffer);
-	inputImage->Bind(commandList, 2, _resourceLayout);
-	commandList->SetVertexBuffer(_xBlur.VB[currentFrame]);
-	commandList->SetIndexBuffer(_xBlur.IB[currentFrame]);
-	commandList->DrawIndexedInstanced(6, 1, 0, 0, 0);
-	commandList->EndRenderPass();
-		
+/****************************************************************************
+*							DrawPS
+*************************************************************************//**
+*  @fn        void GaussianBlur::DrawPS(const ResourceViewPtr& source, const FrameBufferPtr& destination, const gm::Float4& region)
+*  @brief     Blur only the region of the source into the destination with the scissor rects.
+*             The x blur covers KERNEL_RADIUS more rows, which the y blur of the region reads.
+*  @param[in] const ResourceViewPtr& source (shader resource view, not the destination)
+*  @param[in] const FrameBufferPtr& destination
+*  @param[in] const gm::Float4& region (normalized left, top, right, bottom)
+*  @return @@void
+*****************************************************************************/
+void GaussianBlur::DrawPS(const ResourceViewPtr& source, const FrameBufferPtr& destination, const gm::Float4& region)
+{
+	Check(!_useCS);
+	Check(source);
 
-	/*-------------------------------------------------------------------
-	-               YBlur
-	---------------------------------------------------------------------*/
-	commandList->BeginRenderPass(_yBlur.RenderPass, _yBlur.FrameBuffer);
-	commandList->SetGraphicsPipeline(_yBlur.Pipeline);
-	_shaderResourceViews[0]->Bind(commandList, 2, _resourceLayout);
-	commandList->SetVertexBuffer(_yBlur.VB[currentFrame]);
-	commandList->SetIndexBuffer(_yBlur.IB[currentFrame]);
-	commandList->DrawIndexedInstanced(6, 1, 0, 0, 0);
-	commandList->EndRenderPass();
+	if (region.x >= region.z || region.y >= region.w) { return; }
 
-	/*-------------------------------------------------------------------
-	-               Default Path
-	---------------------------------------------------------------------*/
-	commandList->BeginRenderPass(_engine->GetDrawContinueRenderPass(), frameBuffer);
-	commandList->SetGraphicsPipeline(_graphicsPipeline);
-	_shaderResourceViews[1]->Bind(commandList, 2);
-	commandList->SetVertexBuffer(_vertexBuffers[currentFrame]);
-	commandList->SetIndexBuffer(_indexBuffers[currentFrame]);
-	commandList->DrawIndexedInstanced(6, 1, 0, 0, 0);
-	commandList->EndRenderPass();
+	DrawPSPasses(source, destination, &region);
 }
 
 void GaussianBlur::Draw(const FrameBufferPtr& frameBuffer, const std::uint32_t renderTargetIndex)
@@ -513,4 +498,98 @@ void GaussianBlur::PrepareVertexAndIndexBuffer(const gu::tstring& addName)
 		_yBlur.IB[i]->SetName(addName + SP("YVB"));
 	}
 }
+
+/****************************************************************************
+*							DrawPSPasses
+*************************************************************************//**
+*  @fn        void GaussianBlur::DrawPSPasses(const ResourceViewPtr& source, const FrameBufferPtr& destination, const gm::Float4* region)
+*  @brief     x blur -> y blur -> write to the destination
+*  @param[in] const ResourceViewPtr& source
+*  @param[in] const FrameBufferPtr& destination
+*  @param[in] const gm::Float4* region (nullptr : whole frame buffers)
+*  @return @@void
+*****************************************************************************/
+void GaussianBlur::DrawPSPasses(const ResourceViewPtr& source, const FrameBufferPtr& destination, const gm::Float4* region)
+{
+	const auto device       = _engine->GetDevice();
+	const auto commandList  = _engine->GetCommandList(CommandListType::Graphics);
+	const auto currentFrame = _engine->GetCurrentFrameIndex();
+
+	/*-------------------------------------------------------------------
+	-               Change render resource
+	---------------------------------------------------------------------*/
+	commandList->EndRenderPass();
+
+	/*-------------------------------------------------------------------
+	-               Set graphics pipeline
+	---------------------------------------------------------------------*/
+	commandList->SetDescriptorHeap(_blurParameterView->GetHeap());
+	commandList->SetGraphicsPipeline(_xBlur.Pipeline);
+	commandList->SetResourceLayout(_resourceLayout);
+		
+	/*-------------------------------------------------------------------
+	-               Bind gpu resources
+	---------------------------------------------------------------------*/
+	_blurParameterView->Bind(commandList, 0, _resourceLayout);
+	_textureSizeView  ->Bind(commandList, 1, _resourceLayout);
+
+	/*-------------------------------------------------------------------
+	-               XBlur
+	---------------------------------------------------------------------*/
+	commandList->BeginRenderPass(_xBlur.RenderPass, _xBlur.FrameBuffer);
+	if (region)
+	{
+		const float margin = static_cast<float>(KERNEL_RADIUS) / static_cast<float>((std::max)(_textureSize.OriginalTexture[1], 1u));
+		const auto  rect   = ::ToScissorRect(_xBlur.FrameBuffer, gm::Float4(region->x, region->y - margin, region->z, region->w + margin));
+		commandList->SetScissor(&rect);
+	}
+	source->Bind(commandList, 2, _resourceLayout);
+	commandList->SetVertexBuffer(_xBlur.VB[currentFrame]);
+	commandList->SetIndexBuffer(_xBlur.IB[currentFrame]);
+	commandList->DrawIndexedInstanced(6, 1, 0, 0, 0);
+	commandList->EndRenderPass();
+		
+
+	/*-------------------------------------------------------------------
+	-               YBlur
+	---------------------------------------------------------------------*/
+	commandList->BeginRenderPass(_yBlur.RenderPass, _yBlur.FrameBuffer);
+	if (region)
+	{
+		const auto rect = ::ToScissorRect(_yBlur.FrameBuffer, *region);
+		commandList->SetScissor(&rect);
+	}
+	commandList->SetGraphicsPipeline(_yBlur.Pipeline);
+	_shaderResourceViews[0]->Bind(commandList, 2, _resourceLayout);
+	commandList->SetVertexBuffer(_yBlur.VB[currentFrame]);
+	commandList->SetIndexBuffer(_yBlur.IB[currentFrame]);
+	commandList->DrawIndexedInstanced(6, 1, 0, 0, 0);
+	commandList->EndRenderPass();
+
+	/*-------------------------------------------------------------------
+	-               Default Path
+	---------------------------------------------------------------------*/
+	commandList->BeginRenderPass(_engine->GetDrawContinueRenderPass(), destination);
+	if (region)
+	{
+		const auto rect = ::ToScissorRect(destination, *region);
+		commandList->SetScissor(&rect);
+	}
+	commandList->SetGraphicsPipeline(_graphicsPipeline);
+	_shaderResourceViews[1]->Bind(commandList, 2);
+	commandList->SetVertexBuffer(_vertexBuffers[currentFrame]);
+	commandList->SetIndexBuffer(_indexBuffers[currentFrame]);
+	commandList->DrawIndexedInstanced(6, 1, 0, 0, 0);
+	commandList->EndRenderPass();
+
+	/*-------------------------------------------------------------------
+	-               Restore the screen scissor rect
+	---------------------------------------------------------------------*/
+	if (region)
+	{
+		const ScissorRect screen(0, 0, static_cast<long>(Screen::GetScreenWidth()), static_cast<long>(Screen::GetScreenHeight()));
+		commandList->SetScissor(&screen);
+	}
+}
+
 #pragma endregion Protected Function
\ No newline at end of file
@@ -18,7 +18,7 @@
 #include "GraphicsCore/RHI/InterfaceCore/PipelineState/Include/GPUPipelineFactory.hpp"
 #include "GameCore/Rendering/Model/Include/PrimitiveMesh.hpp"
 #include <iostream>
-#include "GameUtility/Math/Include/GMDistribution.hpp"
+#include "GameUtility/Math/Include/GMRandom.hpp"
 #include "GameUtility/Math/Include/GMColor.hpp"
 #include "GameCore/Rendering/Effect/Include/Blur.hpp"
 
@@ -194,13 +194,12 @@ void SSAO::PrepareSSAOSettings(const gu::tstring& name)
 	_setting.Offsets[13] = Float4(+0.0f, +0.0f, +1.0f, 0.0f);
 
 	// Create random length in [0.25f, 1.0f]
-	Random<float> random;
-	random.SetRange(0.25f, 1.0f);
+	Xoshiro256StarStar random;
 
 	// set diff
 	for (int i = 0; i < _countof(_setting.Offsets); ++i)
 	{
-		const auto randomValue = random.GetRandomValue();
+		const auto randomValue = random.NextFloat(0.25f, 1.0f);
 		Vector4f    offset     = randomValue * Normalize(_setting.Offsets[i]);
 		_setting.Offsets[i]    = offset.ToFloat4();
 	}
@@ -267,11 +266,15 @@ void SSAO::PrepareRandomTexture(const gu::tstring& name)
 	const auto metaData = GPUTextureMetaData::Texture2D(256, 256, PixelFormat::R8G8B8A8_UNORM);
 	const auto texture  = device->CreateTexture(metaData, name + SP("Random"));
 	const auto pixel    = new RGBA[256 * 256];
-	Random<float> random;
-	random.SetRange(0.0f, 1.0f);
+
+	// ͂܂Ƃ߂Đ (8vfSIMDŐ)
+	gu::DynamicArray<float> randomValues(256 * 256 * 3);
+	RandomStream random;
+	random.FillFloat(randomValues.Data(), randomValues.Size());
+
 	for (int i = 0; i < 256 * 256; ++i)
 	{
-		pixel[i] = RGBA(random.GetRandomValue(), random.GetRandomValue(), random.GetRandomValue(), 0.0f);
+		pixel[i] = RGBA(randomValues[3 * i + 0], randomValues[3 * i + 1], randomValues[3 * i + 2], 0.0f);
 	}
 
 	texture->Write(_engine->GetCommandList(CommandListType::Graphics), pixel);
@@ -16,6 +16,7 @@
 #include "GameUtility/Base/Include/GUString.hpp"
 #include "GameUtility/Container/Include/GUDynamicArray.hpp"
 #include "GameUtility/Math/Include/GMMatrix.hpp"
+#include "ShadowMap.hpp"
 
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -36,8 +37,6 @@ namespace gc::core
 //////////////////////////////////////////////////////////////////////////////////
 namespace gc::rendering
 {
-	class ShadowMap;
-
 	struct CascadeShadowDesc
 	{
 		float Near    = 200.0f;
@@ -73,17 +72,22 @@ namespace gc::rendering
 		/****************************************************************************
 		**                Public Function
 		*****************************************************************************/
-		/* @brief : Directional Lightz肵Shadow̕`*/
+		/* @brief : Directional Lightz肵Shadow̕`
+		            Each cascade selects the level of detail of the models from its texel density.
+		            The light matrices are updated only when the direction or the screen size changes.*/
 		void Draw(const gu::SharedPointer<GameTimer>& gameTimer, const gm::Float3& direction);
 
-		void Add(const GameModelPtr& gameMode);
+		void Add(const GameModelPtr& gameMode, const ShadowCasterMobility mobility = ShadowCasterMobility::Static);
 
+		void Remove(const GameModelPtr& gameModel);
 
 		/****************************************************************************
 		**                Public Member Variables
 		*****************************************************************************/
 		ResourceViewPtr GetShadowInfoView() const noexcept { return _shadowInfoView; }
 
+		/* @brief : Work of the last Draw summed over the cascades*/
+		ShadowMapStatistics GetStatistics() const noexcept;
 
 
 		/****************************************************************************
@@ -99,7 +103,8 @@ namespace gc::rendering
 		*****************************************************************************/
 		void PrepareResourceView(const gu::tstring& name);
 
-		void Update(const gu::SharedPointer<GameTimer>& gameTimer, const gm::Float3& direction);
+		/* @brief : Returns false when the light did not change*/
+		bool Update(const gu::SharedPointer<GameTimer>& gameTimer, const gm::Float3& direction);
 
 		/****************************************************************************
 		**                Protected Member Variables
@@ -122,6 +127,21 @@ namespace gc::rendering
 		CascadeShadowDesc _shadowDesc = {};
 
 		static constexpr size_t SHADOW_MAP_COUNT = 3;
+
+		/* @brief : World space width covered by each cascade (used by the LOD selection)*/
+		float _cascadeExtents[SHADOW_MAP_COUNT] = {};
+
+		/* @brief : A shadow texel hides more geometric error than a screen pixel*/
+		static constexpr float SHADOW_LOD_PIXEL_ERROR = 2.0f;
+
+		/* @brief : Light state of the uploaded matrices*/
+		gm::Float3    _lightDirection = {};
+		std::uint32_t _screenWidth    = 0;
+		std::uint32_t _screenHeight   = 0;
+		bool          _hasLightState  = false;
+
+		/* @brief : Texel snapped LVPC of each cascade. A change invalidates the cached layer of the cascade.*/
+		gm::Float4x4 _lvpcMatrices[SHADOW_MAP_COUNT] = {};
 	};
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,267 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   LightClusterBinner.hpp
+///             @brief  Clustered (froxel) light assignment computed on the CPU.
+///                     - The view frustum is divided into CountX * CountY screen tiles and CountZ
+///                       exponential depth slices. The cluster AABBs in the view space are separable
+///                       (the x range depends only on the column, the y range only on the row),
+///                       so a light computes its column and row distances once per slice (SSE)
+///                       and tests the candidate clusters 4 at a time.
+///                     - Point lights are tested as the sphere vs the cluster AABB. Spot lights are tested
+///                       as the sphere first, and then as the cone vs the bounding sphere of the cluster.
+///                     - The depth slices are binned in parallel. No depth buffer is needed,
+///                       so the forward pass can use the result without the Z prepass.
+///                     - The result is a compact list: LightClusterRange (offset, point count | spot count << 16)
+///                       for each cluster, and the light indices (point lights first, then spot lights).
+///             How To: binner.Bin(view, pointLights, pointCount, spotLights, spotCount, threadPool)
+///                     binner.Write(mappedRanges, mappedIndices) (GetClusterCount() / GetIndexCount() elements)
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef LIGHT_CLUSTER_BINNER_HPP
+#define LIGHT_CLUSTER_BINNER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "LightType.hpp"
+#include "GameUtility/Base/Include/GUClassUtility.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace gu
+{
+	class ThreadPool;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gc::rendering
+{
+	/****************************************************************************
+	*				  			LightClusterGridDesc
+	*************************************************************************//**
+	*  @struct    LightClusterGridDesc
+	*  @brief     Cluster counts of the view frustum
+	*****************************************************************************/
+	struct LightClusterGridDesc
+	{
+		/* @brief : Screen tiles (x : left to right, y : top to bottom)*/
+		gu::uint32 CountX = 16;
+		gu::uint32 CountY = 9;
+
+		/* @brief : Exponential depth slices from NearZ to FarZ*/
+		gu::uint32 CountZ = 24;
+	};
+
+	/****************************************************************************
+	*				  			LightClusterView
+	*************************************************************************//**
+	*  @struct    LightClusterView
+	*  @brief     Perspective camera of the clusters (left handed, +z forward in the view space)
+	*****************************************************************************/
+	struct LightClusterView
+	{
+		/* @brief : World to view matrix (row vector)*/
+		gm::Float4x4 View = gm::Float4x4();
+
+		/* @brief : Full vertical field of view angle [rad]*/
+		float FovVertical = 0.25f * gm::GM_PI_FLOAT;
+
+		float Aspect = 16.0f / 9.0f;
+		float NearZ  = 1.0f;
+		float FarZ   = 1000.0f;
+	};
+
+	/****************************************************************************
+	*				  			LightClusterRange
+	*************************************************************************//**
+	*  @struct    LightClusterRange
+	*  @brief     Light index range of a cluster (uint2 in the shader)
+	*****************************************************************************/
+	struct LightClusterRange
+	{
+		/* @brief : First index in the light index list*/
+		gu::uint32 Offset = 0;
+
+		/* @brief : Point light count (low 16 bits) | spot light count (high 16 bits)*/
+		gu::uint32 Counts = 0;
+
+		gu::uint32 GetPointLightCount() const noexcept { return Counts & 0xFFFF; }
+		gu::uint32 GetSpotLightCount () const noexcept { return Counts >> 16; }
+	};
+
+	/****************************************************************************
+	*				  			LightClusterStatistics
+	*************************************************************************//**
+	*  @struct    LightClusterStatistics
+	*  @brief     Result of the last Bin
+	*****************************************************************************/
+	struct LightClusterStatistics
+	{
+		/* @brief : Lights overlapping the view depth range*/
+		gu::uint32 VisiblePointLightCount = 0;
+		gu::uint32 VisibleSpotLightCount  = 0;
+
+		/* @brief : Total light indices of the clusters*/
+		gu::uint32 IndexCount = 0;
+
+		gu::uint32 NonEmptyClusterCount = 0;
+		gu::uint32 MaxLightsPerCluster  = 0;
+	};
+
+	/****************************************************************************
+	*				  			LightClusterBinner
+	*************************************************************************//**
+	*  @class     LightClusterBinner
+	*  @brief     Assign the point and spot lights to the view frustum clusters
+	*****************************************************************************/
+	class LightClusterBinner : public gu::NonCopyable
+	{
+	public:
+		/****************************************************************************
+		**                Static Configuration
+		*****************************************************************************/
+		/* @brief : Light count of each type (the counts of a cluster are packed in 16 bits)*/
+		static constexpr gu::uint32 MAX_LIGHT_COUNT = 0xFFFF;
+
+		/* @brief : Maximum CountX and CountY (the cluster in a slice is stored in 16 bits)*/
+		static constexpr gu::uint32 MAX_TILE_COUNT = 64;
+
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Assign the lights (IsUse != 0 and Range > 0) to the clusters.
+		            The depth slices are split over the thread pool (nullptr : serial).*/
+		void Bin(const LightClusterView& view,
+			const PointLightData* pointLights, const gu::uint32 pointLightCount,
+			const SpotLightData*  spotLights , const gu::uint32 spotLightCount,
+			gu::ThreadPool* threadPool = nullptr);
+
+		/* @brief : Write the result of Bin. ranges has GetClusterCount() elements and indices has GetIndexCount() elements.
+		            The cluster index is (z * CountY + y) * CountX + x.*/
+		void Write(LightClusterRange* ranges, gu::uint32* indices) const;
+
+		/* @brief : Depth slice of the view space depth (-1 : out of the clusters)*/
+		gu::int32 GetSliceIndex(const float viewZ) const;
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		const LightClusterGridDesc& GetGrid() const noexcept { return _grid; }
+
+		gu::uint32 GetClusterCount() const noexcept { return _grid.CountX * _grid.CountY * _grid.CountZ; }
+
+		gu::uint32 GetIndexCount() const noexcept { return _statistics.IndexCount; }
+
+		/* @brief : slice = floor(log(viewZ) * DepthScale + DepthBias)*/
+		float GetDepthScale() const noexcept { return _depthScale; }
+
+		float GetDepthBias() const noexcept { return _depthBias; }
+
+		const LightClusterStatistics& GetStatistics() const noexcept { return _statistics; }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		explicit LightClusterBinner(const LightClusterGridDesc& grid = {});
+
+		~LightClusterBinner() = default;
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+		/* @brief : Rebuild the cluster bounds when the projection is changed*/
+		void PrepareGrid(const LightClusterView& view);
+
+		/* @brief : Transform the lights to the view space and find their depth slices*/
+		void PrepareLights(const LightClusterView& view,
+			const PointLightData* pointLights, const gu::uint32 pointLightCount,
+			const SpotLightData*  spotLights , const gu::uint32 spotLightCount);
+
+		/* @brief : Test the lights overlapping the slice and sort the hits by the cluster*/
+		void BinSlice(const gu::uint32 slice);
+
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		/* @brief : Bounding sphere in the view space and the depth slices of a light*/
+		struct ViewLight
+		{
+			float X = 0.0f, Y = 0.0f, Z = 0.0f;
+			float Radius = 0.0f;
+
+			/* @brief : Cone axis and half angle (spot light)*/
+			float DirectionX = 0.0f, DirectionY = 0.0f, DirectionZ = 0.0f;
+			float CosAngle = -1.0f, SinAngle = 0.0f;
+
+			gu::uint32 Index      = 0;
+			gu::uint16 FirstSlice = 0;
+			gu::uint16 LastSlice  = 0;
+		};
+
+		/* @brief : Hits of a depth slice*/
+		struct SliceBins
+		{
+			/* @brief : Hits in the test order (cluster in the slice, light index).
+			            The first PointHitCount hits are the point lights.*/
+			gu::DynamicArray<gu::uint16> HitClusters = {};
+			gu::DynamicArray<gu::uint32> HitLights   = {};
+			gu::uint32 PointHitCount = 0;
+
+			/* @brief : Write positions of the point and spot lights of each cluster*/
+			gu::DynamicArray<gu::uint32> Cursors = {};
+
+			/* @brief : Light indices sorted by the cluster*/
+			gu::DynamicArray<gu::uint32> Indices = {};
+
+			gu::uint32 MaxLightsPerCluster  = 0;
+			gu::uint32 NonEmptyClusterCount = 0;
+		};
+
+		LightClusterGridDesc _grid = {};
+
+		/* @brief : Column and row counts padded to 4*/
+		gu::uint32 _paddedCountX = 0;
+		gu::uint32 _paddedCountY = 0;
+
+		/* @brief : Projection of the current cluster bounds*/
+		float _fovVertical = 0.0f;
+		float _aspect      = 0.0f;
+		float _nearZ       = 0.0f;
+		float _farZ        = 0.0f;
+
+		float _depthScale = 0.0f;
+		float _depthBias  = 0.0f;
+
+		/* @brief : Depth of the slice boundaries (CountZ + 1)*/
+		gu::DynamicArray<float> _sliceDepths = {};
+
+		/* @brief : [slice * padded count + column / row] view space bounds of the cluster AABB
+		            and the center and half extent of the cluster bounding box*/
+		gu::DynamicArray<float> _columnMin    = {};
+		gu::DynamicArray<float> _columnMax    = {};
+		gu::DynamicArray<float> _columnCenter = {};
+		gu::DynamicArray<float> _columnExtent = {};
+		gu::DynamicArray<float> _rowMin       = {};
+		gu::DynamicArray<float> _rowMax       = {};
+		gu::DynamicArray<float> _rowCenter    = {};
+		gu::DynamicArray<float> _rowExtent    = {};
+
+		gu::DynamicArray<ViewLight> _pointLights = {};
+		gu::DynamicArray<ViewLight> _spotLights  = {};
+
+		/* @brief : Cluster ranges whose Offset is local in the slice*/
+		gu::DynamicArray<LightClusterRange> _ranges = {};
+
+		gu::DynamicArray<SliceBins> _slices = {};
+
+		LightClusterStatistics _statistics = {};
+	};
+}
+
+#endif
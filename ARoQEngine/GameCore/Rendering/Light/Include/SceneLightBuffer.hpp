@@ -43,7 +43,7 @@ namespace gc::rendering
 	{
 	protected:
 		using LowLevelGraphicsEnginePtr = gu::SharedPointer<LowLevelGraphicsEngine>;
-		using BufferPtr                 = gu::SharedPointer<rhi::core::GPUBuffer>;
+		using BufferPtr                 = gu::SharedPointer<FrameConstantBuffer>;
 		using ResourceViewPtr           = gu::SharedPointer<rhi::core::GPUResourceView>;
 	public:
 		/****************************************************************************
@@ -107,7 +107,8 @@ namespace gc::rendering
 		ResourceViewPtr _hitLightIDListsInTile = nullptr;
 		std::vector<std::int32_t> _updateIDs = {};
 
-		/* Light GPU data*/
+		/* Light GPU data (placed in the per-frame upload ring)*/
+		BufferPtr       _lightData        = nullptr;
 		ResourceViewPtr _lightDataView    = nullptr;
 
 		/* Light CPU data*/
@@ -204,16 +205,11 @@ namespace gc::rendering
 	{
 		if (!_needUpdate) { return; }
 
-		// get light buffer from the resource view
-		const auto lightBuffer = _lightDataView->GetBuffer();
-
-		// clear
-		lightBuffer->CopyStart();
-		for (std::uint32_t i = 0; i < (std::uint32_t)_updateIDs.size(); ++i)
+		// the ring keeps the CPU copy, so only the changed lights are written
+		for (const auto id : _updateIDs)
 		{
-			lightBuffer->CopyData(&_lights[i], _updateIDs[i]);
+			_lightData->SetData(&_lights[id], sizeof(TLight), id);
 		}
-		lightBuffer->CopyEnd();
 
 		// clear update IDs
 		_updateIDs.clear();
@@ -240,10 +236,8 @@ namespace gc::rendering
 		-              Create Light Data View
 		---------------------------------------------------------------------*/
 		{
-			const auto bufferInfo = GPUBufferMetaData::ConstantBuffer(sizeof(TLight), count);
-			const auto buffer     = device->CreateBuffer(bufferInfo, L"LightData");
-
-			_lightDataView = device->CreateResourceView(ResourceViewType::ConstantBuffer, buffer,0,0, nullptr);
+			_lightData     = gu::MakeShared<FrameConstantBuffer>(_engine->GetFrameUploadAllocator(), device, sizeof(TLight), count);
+			_lightDataView = _lightData->GetView();
 		}
 
 		/*-------------------------------------------------------------------
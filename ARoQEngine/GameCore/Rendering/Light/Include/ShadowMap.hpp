@@ -15,6 +15,8 @@
 #include "GameUtility/Base/Include/GUClassUtility.hpp"
 #include "GameUtility/Base/Include/GUString.hpp"
 #include "GameUtility/Container/Include/GUDynamicArray.hpp"
+#include "GameUtility/Math/Include/GMMatrix.hpp"
+#include "../../Model/Include/MeshLOD.hpp"
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
@@ -33,11 +35,60 @@ namespace gc
 //////////////////////////////////////////////////////////////////////////////////
 namespace gc::rendering
 {
+	/****************************************************************************
+	*				  			   ShadowCasterMobility
+	*************************************************************************//**
+	*  @enum      ShadowCasterMobility
+	*  @brief     How the shadow map caches the caster
+	*****************************************************************************/
+	enum class ShadowCasterMobility : gu::uint8
+	{
+		Static,  // Drawn into the cached layer. Drawn every frame only while it moves (and the skinned models).
+		Movable, // Drawn on the cached layer every frame
+	};
+
+	/****************************************************************************
+	*				  			   ShadowMapStatistics
+	*************************************************************************//**
+	*  @struct    ShadowMapStatistics
+	*  @brief     Work issued by the last Draw (summed over the cascades by CascadeShadow)
+	*****************************************************************************/
+	struct ShadowMapStatistics
+	{
+		/* @brief : Casters drawn into the cached static layer (0 : the layer was reused)*/
+		gu::uint32 StaticDrawCount = 0;
+
+		/* @brief : Casters drawn on the copy of the static layer*/
+		gu::uint32 DynamicDrawCount = 0;
+
+		/* @brief : Gaussian blurs (3 full screen draws each)*/
+		gu::uint32 BlurCount = 0;
+
+		/* @brief : Draw calls issued (casters + blur passes)*/
+		gu::uint32 DrawCallCount = 0;
+
+		/* @brief : Blurred area in the ratio of the shadow map*/
+		float BlurredArea = 0.0f;
+
+		ShadowMapStatistics& operator+=(const ShadowMapStatistics& other)
+		{
+			StaticDrawCount  += other.StaticDrawCount;
+			DynamicDrawCount += other.DynamicDrawCount;
+			BlurCount        += other.BlurCount;
+			DrawCallCount    += other.DrawCallCount;
+			BlurredArea      += other.BlurredArea;
+			return *this;
+		}
+	};
+
 	/****************************************************************************
 	*				  			   ShadowMap
 	*************************************************************************//**
 	*  @class     ShadowMap
 	*  @brief     Rendering the shadow map
+	*             The static casters are cached in a layer which is drawn again only when
+	*             the light, the static casters or their level of detail change.
+	*             Each frame copies the layer, draws the dynamic casters on it and blurs the region they touched.
 	*****************************************************************************/
 	class ShadowMap : public gu::NonCopyable
 	{
@@ -46,18 +97,40 @@ namespace gc::rendering
 		using GameModelPtr              = gu::SharedPointer<gc::core::GameModel>;
 		using GaussianBlurPtr           = gu::SharedPointer<gc::GaussianBlur>;
 	public:
+		/****************************************************************************
+		**                Static Configuration
+		*****************************************************************************/
+		/* @brief : Frames a static caster stays still before it is drawn into the cached layer again*/
+		static constexpr gu::uint32 STATIC_SETTLE_FRAME_COUNT = 30;
+
+		/* @brief : The skinned pose may leave the bind pose bounding sphere*/
+		static constexpr float SKINNED_BOUNDS_SCALE = 1.5f;
+
 		/****************************************************************************
 		**                Public Function
 		*****************************************************************************/
-		void Draw(const ResourceViewPtr& scene);
+		/* @brief : Draw the models with the level of detail selected for the view*/
+		void Draw(const ResourceViewPtr& scene, const gc::core::LODViewType view = gc::core::LODViewType::ShadowCascade0);
+
+		void Add(const GameModelPtr& gameModel, const ShadowCasterMobility mobility = ShadowCasterMobility::Static);
 
-		void Add(const GameModelPtr& gameModel);
+		void Remove(const GameModelPtr& gameModel);
+
+		/* @brief : Draw the cached static layer again at the next Draw*/
+		void Invalidate() noexcept { _isStaticDirty = true; }
 
 		/****************************************************************************
 		**                Public Member Variables
 		*****************************************************************************/
+		/* @brief : Blurred shadow map*/
 		FrameBufferPtr GetFrameBuffer() const noexcept { return _frameBuffer; }
 
+		/* @brief : View projection matrix of the scene passed to Draw. It gives the dirty region of the moving casters.
+		            A different matrix invalidates the cached layer.*/
+		void SetLightViewProjection(const gm::Float4x4& viewProjection);
+
+		const ShadowMapStatistics& GetStatistics() const noexcept { return _statistics; }
+
 		ResourceViewPtr GetHalfDownSampledSRV() const noexcept;
 
 		/****************************************************************************
@@ -80,13 +153,31 @@ namespace gc::rendering
 		void PrepareRenderResource(const std::uint32_t width, const std::uint32_t height, const gu::tstring& name);
 		void PreparePipelineState(const gu::tstring& name);
 
+		/* @brief : Normalized rectangle (left, top, right, bottom) covered by the caster and the blur kernel.
+		            Returns false when the bounds are unknown.*/
+		bool ComputeRegion(const GameModelPtr& gameModel, gm::Float4& region) const;
+
 		/****************************************************************************
 		**                Protected Member Variables
 		*****************************************************************************/
+		struct ShadowCaster
+		{
+			GameModelPtr         Model           = nullptr;
+			ShadowCasterMobility Mobility        = ShadowCasterMobility::Static;
+			gm::Float4x4         World           = {};   // world matrix at the last Draw
+			gu::uint32           LODLevel        = 0;
+			gu::uint32           StillFrameCount = 0;    // frames since the last move
+			bool                 IsActive        = true;
+			bool                 HasRegion       = false;
+			gm::Float4           Region          = {};   // region at the last Draw
+
+			bool IsDynamic() const noexcept;
+		};
+
 		LowLevelGraphicsEnginePtr _engine = nullptr;
 		
 		// GPU resource binding
-		FrameBufferPtr      _frameBuffer    = nullptr;
+		FrameBufferPtr      _frameBuffer    = nullptr; // blurred result
 		RenderPassPtr       _renderPass     = nullptr;
 		GraphicsPipelinePtr _pipeline       = nullptr;
 		ResourceLayoutPtr   _resourceLayout = nullptr;
@@ -95,11 +186,23 @@ namespace gc::rendering
 		gu::DynamicArray<BufferPtr> _vertexBuffers = {};
 		gu::DynamicArray<BufferPtr> _indexBuffers = {};
 
+		// static casters (cleared at the draw) and static layer + dynamic casters (loaded at the draw)
+		FrameBufferPtr _staticFrameBuffer    = nullptr;
+		FrameBufferPtr _compositeFrameBuffer = nullptr;
+		RenderPassPtr  _compositeRenderPass  = nullptr;
+
 		// registered game models.
-		gu::DynamicArray<GameModelPtr> _gameModels = {};
+		gu::DynamicArray<ShadowCaster> _casters = {};
 
 		// gaussian blur for the VSM method.
 		GaussianBlurPtr _gaussianBlur = nullptr;
+
+		gm::Float4x4 _lightViewProjection = {};
+		bool         _hasLightViewProjection = false;
+
+		bool _isStaticDirty = true;
+
+		ShadowMapStatistics _statistics = {};
 	};
 }
 #endif
\ No newline at end of file
@@ -20,7 +20,10 @@
 #include "GraphicsCore/RHI/InterfaceCore/PipelineState/Include/GPUPipelineState.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/PipelineState/Include/GPUPipelineFactory.hpp"
 #include "GameUtility/Base/Include/Screen.hpp"
+#include "GameUtility/Math/Include/GMVectorStream.hpp"
 #include <iostream>
+#include <cstring>
+#include <cmath>
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
@@ -88,17 +91,26 @@ void CascadeShadow::Draw(const gu::SharedPointer<GameTimer>& gameTimer,const gm:
 	Check(_engine);
 
 	/*-------------------------------------------------------------------
-	-               Update light camera
+	-               Update light camera (only when the light changed)
 	---------------------------------------------------------------------*/
 	Update(gameTimer, direction);
 
 	/*-------------------------------------------------------------------
 	-               Draw shadow maps of the each resolution
 	---------------------------------------------------------------------*/
-	for (const auto& shadowMap : _shadowMaps)
+	for (size_t i = 0; i < _shadowMaps.Size(); ++i)
 	{
+		// The texel density of the cascade decides the level of detail of the models
+		const auto view       = static_cast<LODViewType>(static_cast<gu::uint32>(LODViewType::ShadowCascade0) + i);
+		const auto resolution = static_cast<float>(_shadowDesc.MaxResolution) / static_cast<float>(1u << i);
+		const auto lodView    = _cascadeExtents[i] > 0.0f ? LODView::Orthographic(resolution / _cascadeExtents[i], SHADOW_LOD_PIXEL_ERROR) : LODView();
+		for (const auto& gameModel : _gameModels)
+		{
+			gameModel->SelectLOD(view, lodView);
+		}
+
 		// shadow map + gaussian blur
-		shadowMap->Draw(_lightCamera->GetResourceView());
+		_shadowMaps[i]->Draw(_lightCamera->GetResourceView(), view);
 	}
 
 }
@@ -106,25 +118,68 @@ void CascadeShadow::Draw(const gu::SharedPointer<GameTimer>& gameTimer,const gm:
 /****************************************************************************
 *							Add
 *************************************************************************//**
-*  @fn        void CascadeShadow::Add(const GameModelPtr& gameModel)
+*  @fn        void CascadeShadow::Add(const GameModelPtr& gameModel, const ShadowCasterMobility mobility)
 *
 *  @brief     Add game models for the rendering shadow
 *
-*  @param[in] void
+*  @param[in] const GameModelPtr& gameModel
+*  @param[in] const ShadowCasterMobility mobility
 *
 *  @return @@void
 *****************************************************************************/
-void CascadeShadow::Add(const GameModelPtr& gameModel)
+void CascadeShadow::Add(const GameModelPtr& gameModel, const ShadowCasterMobility mobility)
 {
 	if (!gameModel) { return; }
 
 	for (const auto& shadowMap : _shadowMaps)
 	{
-		shadowMap->Add(gameModel);
+		shadowMap->Add(gameModel, mobility);
 	}
 
 	_gameModels.Push(gameModel);
 }
+
+/****************************************************************************
+*							Remove
+*************************************************************************//**
+*  @fn        void CascadeShadow::Remove(const GameModelPtr& gameModel)
+*
+*  @brief     Remove the game model from the shadow casters
+*
+*  @param[in] const GameModelPtr& gameModel
+*
+*  @return @@void
+*****************************************************************************/
+void CascadeShadow::Remove(const GameModelPtr& gameModel)
+{
+	for (const auto& shadowMap : _shadowMaps)
+	{
+		shadowMap->Remove(gameModel);
+	}
+
+	_gameModels.Remove(gameModel);
+}
+
+/****************************************************************************
+*							GetStatistics
+*************************************************************************//**
+*  @fn        ShadowMapStatistics CascadeShadow::GetStatistics() const noexcept
+*
+*  @brief     Work of the last Draw summed over the cascades
+*
+*  @param[in] void
+*
+*  @return @@ShadowMapStatistics
+*****************************************************************************/
+ShadowMapStatistics CascadeShadow::GetStatistics() const noexcept
+{
+	ShadowMapStatistics statistics = {};
+	for (const auto& shadowMap : _shadowMaps)
+	{
+		statistics += shadowMap->GetStatistics();
+	}
+	return statistics;
+}
 #pragma endregion Main Function
 
 #pragma region SetUp Function
@@ -153,16 +208,32 @@ void CascadeShadow::PrepareResourceView(const gu::tstring& name)
 /****************************************************************************
 *						UpdateLightCamera
 *************************************************************************//**
-*  @fn        void CascadeShadow::Update()
+*  @fn        bool CascadeShadow::Update(const gu::SharedPointer<GameTimer>& gameTimer, const gm::Float3& direction)
 *
-*  @brief     Move the directional light camera
+*  @brief     Move the directional light camera.
+*             The matrices depend only on the direction and the screen size, so nothing is updated while they stay the same.
+*             The crop offsets are snapped to the texels of each cascade, and the cascade whose LVPC changed
+*             draws its cached static layer again.
 *
 *  @param[in] const gu::SharedPointer<GameTimer>& gameTimer
+*  @param[in] const gm::Float3& direction
 *
-*  @return @@void
+*  @return @@bool (false : the light did not change)
 *****************************************************************************/
-void CascadeShadow::Update(const gu::SharedPointer<GameTimer>& gameTimer, const gm::Float3& direction)
+bool CascadeShadow::Update(const gu::SharedPointer<GameTimer>& gameTimer, const gm::Float3& direction)
 {
+	const auto screenWidth  = static_cast<std::uint32_t>(Screen::GetScreenWidth());
+	const auto screenHeight = static_cast<std::uint32_t>(Screen::GetScreenHeight());
+	if (_hasLightState && _lightDirection.x == direction.x && _lightDirection.y == direction.y && _lightDirection.z == direction.z
+		&& _screenWidth == screenWidth && _screenHeight == screenHeight)
+	{
+		return false;
+	}
+	_lightDirection = direction;
+	_screenWidth    = screenWidth;
+	_screenHeight   = screenHeight;
+	_hasLightState  = true;
+
 	/*-------------------------------------------------------------------
 	-              Update the light camera
 	-              Calculate the light view projection matrix.
@@ -179,6 +250,7 @@ void CascadeShadow::Update(const gu::SharedPointer<GameTimer>& gameTimer, const
 	const auto right   = _lightCamera->GetRight();
 	const auto up      = _lightCamera->GetUp();
 
+	const auto lightViewProjection = lvpMatrix.ToFloat4x4();
 	const float depthList[] = { _shadowDesc.Near, _shadowDesc.Medium, _shadowDesc.Far };
 	Matrix4f lvpcMatrices[SHADOW_MAP_COUNT];
 
@@ -209,25 +281,20 @@ void CascadeShadow::Update(const gu::SharedPointer<GameTimer>& gameTimer, const
 		vertices[6] = (farPosition  + up * (-farY ) + right * (+farX )).ToFloat3(); // far  right lower
 		vertices[7] = (farPosition  + up * (-farY ) + right * (-farX )).ToFloat3(); // far   left lower
 		
-		// covert the world space to the light view projection matrix
-		gm::Vector3f vMax, vMin;
-		vMax = gm::Vector3f(FLT_MAX, FLT_MAX, FLT_MAX);
-		vMin = gm::Vector3f(FLT_MAX, FLT_MAX, FLT_MAX);
-		for (auto& vertex : vertices)
-		{
-			//vertex = (lvpMatrix * vertex).GetXYZ().ToFloat3();
+		// covert the world space to the light view projection space, and calculate the AABB min max range.
+		gm::VectorStream::TransformCoordinateFloat3Stream(&vertices[0].x, sizeof(gm::Float3), &vertices[0].x, sizeof(gm::Float3), _countof(vertices), lightViewProjection.u.a);
 
-			// calculate the AABB min max range.
-			gm::Max(vMax, vertex);
-			gm::Min(vMin, vertex);
-		}
+		gm::Float3 vMin, vMax;
+		gm::VectorStream::ComputeBoundsFloat3Stream(&vMin.x, &vMax.x, &vertices[0].x, sizeof(gm::Float3), _countof(vertices));
 
 		// calculate the crop matrix
 		// The crop matrix is the matrix to pack the range from -1 to 1.
-		const float xScale = 2.0f / (vMax.GetX() - vMin.GetX());
-		const float yScale = 2.0f / (vMax.GetY() - vMin.GetY());
-		const float xOffset = (vMax.GetX() + vMin.GetX()) * (-0.5f) * xScale;
-		const float yOffset = (vMax.GetY() + vMin.GetY()) * (-0.5f) * yScale;
+		const float xScale = 2.0f / (vMax.x - vMin.x);
+		const float yScale = 2.0f / (vMax.y - vMin.y);
+		// Snap the offset to the texel grid (2 / resolution in the clip space), so that the shadow edges do not swim.
+		const float texelSize = 2.0f / (static_cast<float>(_shadowDesc.MaxResolution) / static_cast<float>(1u << areaNo));
+		const float xOffset   = std::round((vMax.x + vMin.x) * (-0.5f) * xScale / texelSize) * texelSize;
+		const float yOffset   = std::round((vMax.y + vMin.y) * (-0.5f) * yScale / texelSize) * texelSize;
 		
 		auto clopMatrix = Matrix4f();
 		clopMatrix.GetX().SetX(xScale);
@@ -238,10 +305,29 @@ void CascadeShadow::Update(const gu::SharedPointer<GameTimer>& gameTimer, const
 		// Calculate the LVPC matrix
 		lvpcMatrices[areaNo] = lvpMatrix * clopMatrix;
 
+		// The bounds are in the light clip space. The ortho lens maps the screen size to the range from -1 to 1, so half of it is the world space scale.
+		_cascadeExtents[areaNo] = (std::max)((vMax.x - vMin.x) * static_cast<float>(screenWidth) * 0.5f, (vMax.y - vMin.y) * static_cast<float>(screenHeight) * 0.5f);
+
 		// update the near depth
 		nearDepth = depthList[areaNo];
 	}
 
+	/*-------------------------------------------------------------------
+	-              Invalidate the cached layers of the moved cascades
+	---------------------------------------------------------------------*/
+	bool isChanged = false;
+	for (int i = 0; i < SHADOW_MAP_COUNT; ++i)
+	{
+		const auto lvpc = lvpcMatrices[i].ToFloat4x4();
+		_shadowMaps[i]->SetLightViewProjection(lightViewProjection);
+		if (std::memcmp(&lvpc, &_lvpcMatrices[i], sizeof(lvpc)) == 0) { continue; }
+
+		_lvpcMatrices[i] = lvpc;
+		_shadowMaps[i]->Invalidate();
+		isChanged = true;
+	}
+	if (!isChanged) { return true; }
+
 	/*-------------------------------------------------------------------
 	-              Update lvpc matrix buffer
 	---------------------------------------------------------------------*/
@@ -249,9 +335,10 @@ void CascadeShadow::Update(const gu::SharedPointer<GameTimer>& gameTimer, const
 	shadowInfo.IsSoftShadow = _shadowDesc.UseSoftShadow;
 	for (int i = 0; i < _countof(shadowInfo.LVPC); ++i)
 	{
-		shadowInfo.LVPC[i] = lvpcMatrices[i].ToFloat4x4();
+		shadowInfo.LVPC[i] = _lvpcMatrices[i];
 	}
 
 	_shadowInfoView->GetBuffer()->Update(&shadowInfo, 1);
+	return true;
 }
 #pragma endregion SetUp Function
\ No newline at end of file
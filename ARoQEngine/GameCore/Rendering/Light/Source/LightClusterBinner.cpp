@@ -0,0 +1,654 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   LightClusterBinner.cpp
+///             @brief  Clustered (froxel) light assignment computed on the CPU.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/LightClusterBinner.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include "GameUtility/Memory/Include/GUMemoryTracker.hpp"
+#include "GameUtility/Thread/Public/Include/GUThreadPool.hpp"
+#include "GameUtility/Math/Private/Simd/Include/GMSimdMacros.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#if PLATFORM_CPU_INSTRUCTION_AVX2
+	#include <immintrin.h>
+#elif PLATFORM_CPU_INSTRUCTION_SSE2
+	#include <emmintrin.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace gc::rendering;
+
+namespace
+{
+	using gu::int32;
+	using gu::uint16;
+	using gu::uint32;
+	using gu::uint64;
+
+	/* @brief : Bounds of the padded columns and rows (never hit, and the squares stay finite)*/
+	constexpr float PADDING_DISTANCE = 1.0e15f;
+
+	/*-------------------------------------------------------------------
+	-   Cluster bounds of a depth slice
+	---------------------------------------------------------------------*/
+	struct SliceGeometry
+	{
+		const float* ColumnMin    = nullptr;
+		const float* ColumnMax    = nullptr;
+		const float* ColumnCenter = nullptr;
+		const float* ColumnExtent = nullptr;
+		const float* RowMin       = nullptr;
+		const float* RowMax       = nullptr;
+		const float* RowCenter    = nullptr;
+		const float* RowExtent    = nullptr;
+
+		float MinZ    = 0.0f;
+		float MaxZ    = 0.0f;
+		float CenterZ = 0.0f;
+		float ExtentZ = 0.0f;
+
+		uint32 CountX       = 0;
+		uint32 CountY       = 0;
+		uint32 PaddedCountX = 0;
+		uint32 PaddedCountY = 0;
+	};
+
+	/*-------------------------------------------------------------------
+	-   Squared distances from the value to the intervals [min, max] (count is a multiple of 4)
+	---------------------------------------------------------------------*/
+	void SquaredDistances(const float* minimums, const float* maximums, const float value, const uint32 count, float* distances)
+	{
+	#if PLATFORM_CPU_INSTRUCTION_SSE2 || PLATFORM_CPU_INSTRUCTION_AVX2
+		const __m128 center = _mm_set1_ps(value);
+		const __m128 zero   = _mm_setzero_ps();
+		for (uint32 i = 0; i < count; i += 4)
+		{
+			const __m128 below    = _mm_sub_ps(_mm_loadu_ps(minimums + i), center);
+			const __m128 above    = _mm_sub_ps(center, _mm_loadu_ps(maximums + i));
+			const __m128 distance = _mm_max_ps(_mm_max_ps(below, above), zero);
+			_mm_storeu_ps(distances + i, _mm_mul_ps(distance, distance));
+		}
+	#else
+		for (uint32 i = 0; i < count; ++i)
+		{
+			const float distance = (std::max)((std::max)(minimums[i] - value, value - maximums[i]), 0.0f);
+			distances[i] = distance * distance;
+		}
+	#endif
+	}
+
+	/*-------------------------------------------------------------------
+	-   4 bit mask of the distances <= limit
+	---------------------------------------------------------------------*/
+	uint32 InsideMask(const float* distances, const float limit)
+	{
+	#if PLATFORM_CPU_INSTRUCTION_SSE2 || PLATFORM_CPU_INSTRUCTION_AVX2
+		return static_cast<uint32>(_mm_movemask_ps(_mm_cmple_ps(_mm_loadu_ps(distances), _mm_set1_ps(limit))));
+	#else
+		uint32 mask = 0;
+		for (uint32 i = 0; i < 4; ++i) { if (distances[i] <= limit) { mask |= 1u << i; } }
+		return mask;
+	#endif
+	}
+
+	/*-------------------------------------------------------------------
+	-   4 bit mask of the clusters [x, x + 4) in the row whose bounding sphere is not outside the cone.
+	-   The cone is culled when the closest distance from the sphere center to the cone surface exceeds the radius,
+	-   or the sphere is beyond the range or behind the apex.
+	---------------------------------------------------------------------*/
+	template<class Light>
+	uint32 ConeMask(const SliceGeometry& geometry, const Light& light, const uint32 x, const uint32 y)
+	{
+		const float offsetY      = geometry.RowCenter[y] - light.Y;
+		const float offsetZ      = geometry.CenterZ      - light.Z;
+		const float extentSquare = geometry.RowExtent[y] * geometry.RowExtent[y] + geometry.ExtentZ * geometry.ExtentZ;
+		const float axisYZ       = offsetY * light.DirectionY + offsetZ * light.DirectionZ;
+		const float lengthYZ     = offsetY * offsetY + offsetZ * offsetZ;
+
+	#if PLATFORM_CPU_INSTRUCTION_SSE2 || PLATFORM_CPU_INSTRUCTION_AVX2
+		const __m128 offsetX = _mm_sub_ps(_mm_loadu_ps(geometry.ColumnCenter + x), _mm_set1_ps(light.X));
+		const __m128 extentX = _mm_loadu_ps(geometry.ColumnExtent + x);
+		const __m128 radius  = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(extentX, extentX), _mm_set1_ps(extentSquare)));
+
+		const __m128 axis          = _mm_add_ps(_mm_mul_ps(offsetX, _mm_set1_ps(light.DirectionX)), _mm_set1_ps(axisYZ));
+		const __m128 lengthSquare  = _mm_add_ps(_mm_mul_ps(offsetX, offsetX), _mm_set1_ps(lengthYZ));
+		const __m128 perpendicular = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(lengthSquare, _mm_mul_ps(axis, axis)), _mm_setzero_ps()));
+		const __m128 closest       = _mm_sub_ps(_mm_mul_ps(perpendicular, _mm_set1_ps(light.CosAngle)), _mm_mul_ps(axis, _mm_set1_ps(light.SinAngle)));
+
+		__m128 inside = _mm_cmple_ps(closest, radius);
+		inside = _mm_and_ps(inside, _mm_cmple_ps(axis, _mm_add_ps(radius, _mm_set1_ps(light.Radius))));
+		inside = _mm_and_ps(inside, _mm_cmpge_ps(axis, _mm_sub_ps(_mm_setzero_ps(), radius)));
+		return static_cast<uint32>(_mm_movemask_ps(inside));
+	#else
+		uint32 mask = 0;
+		for (uint32 i = 0; i < 4; ++i)
+		{
+			const float offsetX       = geometry.ColumnCenter[x + i] - light.X;
+			const float radius        = std::sqrt(geometry.ColumnExtent[x + i] * geometry.ColumnExtent[x + i] + extentSquare);
+			const float axis          = offsetX * light.DirectionX + axisYZ;
+			const float perpendicular = std::sqrt((std::max)(offsetX * offsetX + lengthYZ - axis * axis, 0.0f));
+			const float closest       = perpendicular * light.CosAngle - axis * light.SinAngle;
+			if (closest <= radius && axis <= radius + light.Radius && axis >= -radius) { mask |= 1u << i; }
+		}
+		return mask;
+	#endif
+	}
+
+	/*-------------------------------------------------------------------
+	-   Append the clusters of the slice hit by the light.
+	-   The columns and the rows hit by the sphere are contiguous, because the interval bounds increase monotonically.
+	---------------------------------------------------------------------*/
+	template<bool IsSpotLight, class Light>
+	void AppendHits(const SliceGeometry& geometry, const Light& light,
+		gu::DynamicArray<uint16>& hitClusters, gu::DynamicArray<uint32>& hitLights)
+	{
+		const float distanceZ = (std::max)((std::max)(geometry.MinZ - light.Z, light.Z - geometry.MaxZ), 0.0f);
+		const float remain    = light.Radius * light.Radius - distanceZ * distanceZ;
+		if (remain < 0.0f) { return; }
+
+		alignas(16) float distanceX[gc::rendering::LightClusterBinner::MAX_TILE_COUNT];
+		alignas(16) float distanceY[gc::rendering::LightClusterBinner::MAX_TILE_COUNT];
+		SquaredDistances(geometry.ColumnMin, geometry.ColumnMax, light.X, geometry.PaddedCountX, distanceX);
+		SquaredDistances(geometry.RowMin   , geometry.RowMax   , light.Y, geometry.PaddedCountY, distanceY);
+
+		uint32 firstX = 0, lastX = geometry.CountX;
+		while (firstX < lastX && distanceX[firstX]    > remain) { ++firstX; }
+		while (lastX > firstX && distanceX[lastX - 1] > remain) { --lastX; }
+		if (firstX == lastX) { return; }
+
+		uint32 firstY = 0, lastY = geometry.CountY;
+		while (firstY < lastY && distanceY[firstY]    > remain) { ++firstY; }
+		while (lastY > firstY && distanceY[lastY - 1] > remain) { --lastY; }
+		if (firstY == lastY) { return; }
+
+		for (uint32 y = firstY; y < lastY; ++y)
+		{
+			const float rowRemain = remain - distanceY[y];
+			if (rowRemain < 0.0f) { continue; }
+
+			// the columns out of [firstX, lastX) and the padded columns fail the sphere test
+			for (uint32 x = firstX & ~3u; x < lastX; x += 4)
+			{
+				uint32 mask = InsideMask(distanceX + x, rowRemain);
+				if constexpr (IsSpotLight)
+				{
+					if (mask != 0) { mask &= ConeMask(geometry, light, x, y); }
+				}
+
+				for (uint32 bit = 0; mask != 0; ++bit, mask >>= 1)
+				{
+					if ((mask & 1) == 0) { continue; }
+					hitClusters.Push(static_cast<uint16>(y * geometry.CountX + x + bit));
+					hitLights  .Push(light.Index);
+				}
+			}
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+LightClusterBinner::LightClusterBinner(const LightClusterGridDesc& grid) : _grid(grid)
+{
+	Checkf(0 < grid.CountX && grid.CountX <= MAX_TILE_COUNT, "CountX must be in [1, MAX_TILE_COUNT]");
+	Checkf(0 < grid.CountY && grid.CountY <= MAX_TILE_COUNT, "CountY must be in [1, MAX_TILE_COUNT]");
+	Checkf(0 < grid.CountZ && grid.CountZ <= 0xFFFF, "CountZ must be in [1, 65535]");
+
+	GU_MEMORY_TAG_SCOPE(gu::MemoryTag::Graphics);
+
+	_paddedCountX = (grid.CountX + 3) & ~3u;
+	_paddedCountY = (grid.CountY + 3) & ~3u;
+
+	_sliceDepths .Resize(grid.CountZ + 1);
+	_columnMin   .Resize(grid.CountZ * _paddedCountX);
+	_columnMax   .Resize(grid.CountZ * _paddedCountX);
+	_columnCenter.Resize(grid.CountZ * _paddedCountX);
+	_columnExtent.Resize(grid.CountZ * _paddedCountX);
+	_rowMin      .Resize(grid.CountZ * _paddedCountY);
+	_rowMax      .Resize(grid.CountZ * _paddedCountY);
+	_rowCenter   .Resize(grid.CountZ * _paddedCountY);
+	_rowExtent   .Resize(grid.CountZ * _paddedCountY);
+	_ranges      .Resize(GetClusterCount());
+	_slices      .Resize(grid.CountZ);
+
+	for (uint32 slice = 0; slice < grid.CountZ; ++slice)
+	{
+		_slices[slice].Cursors.Resize(grid.CountX * grid.CountY * 2);
+	}
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Public Function
+/****************************************************************************
+*                     Bin
+*************************************************************************//**
+*  @fn        void LightClusterBinner::Bin(const LightClusterView& view,
+*                  const PointLightData* pointLights, const gu::uint32 pointLightCount,
+*                  const SpotLightData*  spotLights , const gu::uint32 spotLightCount,
+*                  gu::ThreadPool* threadPool)
+*
+*  @brief     Assign the lights to the clusters. The lights are transformed once,
+*             and the depth slices are interleaved over the jobs, because the near slices have more lights.
+*             Each slice writes only its own bins and cluster ranges.
+*
+*  @param[in] const LightClusterView& view
+*  @param[in] const PointLightData* pointLights
+*  @param[in] const gu::uint32 pointLightCount (<= MAX_LIGHT_COUNT)
+*  @param[in] const SpotLightData* spotLights
+*  @param[in] const gu::uint32 spotLightCount (<= MAX_LIGHT_COUNT)
+*  @param[in] gu::ThreadPool* threadPool (nullptr : serial)
+*
+*  @return    void
+*****************************************************************************/
+void LightClusterBinner::Bin(const LightClusterView& view,
+	const PointLightData* pointLights, const gu::uint32 pointLightCount,
+	const SpotLightData*  spotLights , const gu::uint32 spotLightCount,
+	gu::ThreadPool* threadPool)
+{
+	Checkf(pointLightCount <= MAX_LIGHT_COUNT, "Too many point lights");
+	Checkf(spotLightCount  <= MAX_LIGHT_COUNT, "Too many spot lights");
+	Checkf(0.0f < view.NearZ && view.NearZ < view.FarZ, "NearZ must be in (0, FarZ)");
+
+	GU_MEMORY_TAG_SCOPE(gu::MemoryTag::Graphics);
+
+	PrepareGrid(view);
+	PrepareLights(view, pointLights, pointLightCount, spotLights, spotLightCount);
+
+	/*-------------------------------------------------------------------
+	-   Job 0 runs on the calling thread while the workers run the others
+	---------------------------------------------------------------------*/
+	const uint32 sliceCount  = _grid.CountZ;
+	const uint32 maxJobCount = threadPool ? threadPool->GetThreadCount() + 1 : 1;
+	const uint32 jobCount    = (std::min)(maxJobCount, sliceCount);
+
+	const auto BinSlices = [this, sliceCount, jobCount](const uint32 job)
+	{
+		for (uint32 slice = job; slice < sliceCount; slice += jobCount) { BinSlice(slice); }
+	};
+
+	std::vector<std::future<void>> futures = {};
+	futures.reserve(jobCount - 1);
+	for (uint32 job = 1; job < jobCount; ++job)
+	{
+		futures.push_back(threadPool->Submit([BinSlices, job]() { BinSlices(job); }));
+	}
+
+	BinSlices(0);
+
+	for (auto& future : futures) { future.get(); }
+
+	/*-------------------------------------------------------------------
+	-   Statistics
+	---------------------------------------------------------------------*/
+	_statistics = {};
+	_statistics.VisiblePointLightCount = static_cast<uint32>(_pointLights.Size());
+	_statistics.VisibleSpotLightCount  = static_cast<uint32>(_spotLights.Size());
+	for (uint64 slice = 0; slice < _slices.Size(); ++slice)
+	{
+		const auto& bins = _slices[slice];
+		_statistics.IndexCount          += static_cast<uint32>(bins.Indices.Size());
+		_statistics.NonEmptyClusterCount += bins.NonEmptyClusterCount;
+		_statistics.MaxLightsPerCluster   = (std::max)(_statistics.MaxLightsPerCluster, bins.MaxLightsPerCluster);
+	}
+}
+
+/****************************************************************************
+*                     Write
+*************************************************************************//**
+*  @fn        void LightClusterBinner::Write(LightClusterRange* ranges, gu::uint32* indices) const
+*
+*  @brief     Write the cluster ranges and the light indices of the last Bin (e.g. to the mapped upload buffers).
+*             The index lists of the slices are placed in the slice order.
+*
+*  @param[out] LightClusterRange* ranges (GetClusterCount() elements)
+*  @param[out] gu::uint32* indices (GetIndexCount() elements)
+*
+*  @return    void
+*****************************************************************************/
+void LightClusterBinner::Write(LightClusterRange* ranges, gu::uint32* indices) const
+{
+	Check(ranges);
+	Check(indices || _statistics.IndexCount == 0);
+
+	const uint32 sliceClusterCount = _grid.CountX * _grid.CountY;
+
+	uint32 base = 0;
+	for (uint32 slice = 0; slice < _grid.CountZ; ++slice)
+	{
+		const auto& bins        = _slices[slice];
+		const auto* localRanges = _ranges.Data() + static_cast<uint64>(slice) * sliceClusterCount;
+		auto*       destination = ranges         + static_cast<uint64>(slice) * sliceClusterCount;
+
+		for (uint32 cluster = 0; cluster < sliceClusterCount; ++cluster)
+		{
+			destination[cluster].Offset = localRanges[cluster].Offset + base;
+			destination[cluster].Counts = localRanges[cluster].Counts;
+		}
+
+		if (!bins.Indices.IsEmpty())
+		{
+			std::memcpy(indices + base, bins.Indices.Data(), bins.Indices.Size() * sizeof(uint32));
+		}
+		base += static_cast<uint32>(bins.Indices.Size());
+	}
+}
+
+/****************************************************************************
+*                     GetSliceIndex
+*************************************************************************//**
+*  @fn        gu::int32 LightClusterBinner::GetSliceIndex(const float viewZ) const
+*
+*  @brief     Depth slice of the view space depth (same as the shader lookup)
+*
+*  @param[in] const float viewZ
+*
+*  @return    gu::int32 (-1 : out of [NearZ, FarZ])
+*****************************************************************************/
+gu::int32 LightClusterBinner::GetSliceIndex(const float viewZ) const
+{
+	if (viewZ < _nearZ || viewZ > _farZ) { return -1; }
+
+	const int32 slice = static_cast<int32>(std::floor(std::log(viewZ) * _depthScale + _depthBias));
+	return (std::min)((std::max)(slice, 0), static_cast<int32>(_grid.CountZ) - 1);
+}
+#pragma endregion Public Function
+
+#pragma region Protected Function
+/****************************************************************************
+*                     PrepareGrid
+*************************************************************************//**
+*  @fn        void LightClusterBinner::PrepareGrid(const LightClusterView& view)
+*
+*  @brief     Rebuild the view space bounds of the clusters when the projection is changed.
+*             The slice k covers [NearZ * (FarZ / NearZ)^(k / CountZ), NearZ * (FarZ / NearZ)^((k + 1) / CountZ)].
+*             The x range of a column is the union of its tile edges at the both slice depths (same for the rows).
+*
+*  @param[in] const LightClusterView& view
+*
+*  @return    void
+*****************************************************************************/
+void LightClusterBinner::PrepareGrid(const LightClusterView& view)
+{
+	if (view.FovVertical == _fovVertical && view.Aspect == _aspect && view.NearZ == _nearZ && view.FarZ == _farZ) { return; }
+
+	_fovVertical = view.FovVertical;
+	_aspect      = view.Aspect;
+	_nearZ       = view.NearZ;
+	_farZ        = view.FarZ;
+
+	const float tanY     = std::tan(0.5f * view.FovVertical);
+	const float tanX     = tanY * view.Aspect;
+	const float logRatio = std::log(view.FarZ / view.NearZ);
+
+	_depthScale = static_cast<float>(_grid.CountZ) / logRatio;
+	_depthBias  = -std::log(view.NearZ) * _depthScale;
+
+	for (uint32 slice = 0; slice <= _grid.CountZ; ++slice)
+	{
+		_sliceDepths[slice] = view.NearZ * std::exp(logRatio * static_cast<float>(slice) / static_cast<float>(_grid.CountZ));
+	}
+	_sliceDepths[_grid.CountZ] = view.FarZ;
+
+	const auto SetInterval = [](float* minimums, float* maximums, float* centers, float* extents, const uint32 index,
+		const float minimum, const float maximum)
+	{
+		minimums[index] = minimum;
+		maximums[index] = maximum;
+		centers [index] = 0.5f * (minimum + maximum);
+		extents [index] = 0.5f * (maximum - minimum);
+	};
+
+	for (uint32 slice = 0; slice < _grid.CountZ; ++slice)
+	{
+		const float nearDepth = _sliceDepths[slice];
+		const float farDepth  = _sliceDepths[slice + 1];
+
+		float* columnMin    = _columnMin   .Data() + slice * _paddedCountX;
+		float* columnMax    = _columnMax   .Data() + slice * _paddedCountX;
+		float* columnCenter = _columnCenter.Data() + slice * _paddedCountX;
+		float* columnExtent = _columnExtent.Data() + slice * _paddedCountX;
+		for (uint32 x = 0; x < _paddedCountX; ++x)
+		{
+			if (x >= _grid.CountX)
+			{
+				SetInterval(columnMin, columnMax, columnCenter, columnExtent, x, PADDING_DISTANCE, PADDING_DISTANCE);
+				continue;
+			}
+
+			const float left  = (-1.0f + 2.0f * static_cast<float>(x)     / static_cast<float>(_grid.CountX)) * tanX;
+			const float right = (-1.0f + 2.0f * static_cast<float>(x + 1) / static_cast<float>(_grid.CountX)) * tanX;
+			SetInterval(columnMin, columnMax, columnCenter, columnExtent, x,
+				(std::min)(left  * nearDepth, left  * farDepth),
+				(std::max)(right * nearDepth, right * farDepth));
+		}
+
+		float* rowMin    = _rowMin   .Data() + slice * _paddedCountY;
+		float* rowMax    = _rowMax   .Data() + slice * _paddedCountY;
+		float* rowCenter = _rowCenter.Data() + slice * _paddedCountY;
+		float* rowExtent = _rowExtent.Data() + slice * _paddedCountY;
+		for (uint32 y = 0; y < _paddedCountY; ++y)
+		{
+			if (y >= _grid.CountY)
+			{
+				SetInterval(rowMin, rowMax, rowCenter, rowExtent, y, PADDING_DISTANCE, PADDING_DISTANCE);
+				continue;
+			}
+
+			// row 0 is the top of the screen
+			const float top    = (1.0f - 2.0f * static_cast<float>(y)     / static_cast<float>(_grid.CountY)) * tanY;
+			const float bottom = (1.0f - 2.0f * static_cast<float>(y + 1) / static_cast<float>(_grid.CountY)) * tanY;
+			SetInterval(rowMin, rowMax, rowCenter, rowExtent, y,
+				(std::min)(bottom * nearDepth, bottom * farDepth),
+				(std::max)(top    * nearDepth, top    * farDepth));
+		}
+	}
+}
+
+/****************************************************************************
+*                     PrepareLights
+*************************************************************************//**
+*  @fn        void LightClusterBinner::PrepareLights(const LightClusterView& view,
+*                  const PointLightData* pointLights, const gu::uint32 pointLightCount,
+*                  const SpotLightData*  spotLights , const gu::uint32 spotLightCount)
+*
+*  @brief     Transform the used lights to the view space and find the depth slices overlapped by their spheres.
+*             The lights out of the depth range are dropped.
+*             A spot light with the half angle >= 90 degrees (or without the direction) is culled as the sphere
+*             (the zero axis never fails the cone test).
+*
+*  @param[in] const LightClusterView& view
+*  @param[in] const PointLightData* pointLights
+*  @param[in] const gu::uint32 pointLightCount
+*  @param[in] const SpotLightData* spotLights
+*  @param[in] const gu::uint32 spotLightCount
+*
+*  @return    void
+*****************************************************************************/
+void LightClusterBinner::PrepareLights(const LightClusterView& view,
+	const PointLightData* pointLights, const gu::uint32 pointLightCount,
+	const SpotLightData*  spotLights , const gu::uint32 spotLightCount)
+{
+	const auto& m = view.View.u.m;
+
+	const auto SetSlices = [this](ViewLight& light)
+	{
+		const float minZ = light.Z - light.Radius;
+		const float maxZ = light.Z + light.Radius;
+		if (maxZ < _nearZ || minZ > _farZ) { return false; }
+
+		const int32 lastSlice = static_cast<int32>(_grid.CountZ) - 1;
+		int32 first = minZ <= _nearZ ? 0         : (std::min)((std::max)(static_cast<int32>(std::floor(std::log(minZ) * _depthScale + _depthBias)), 0), lastSlice);
+		int32 last  = maxZ >= _farZ  ? lastSlice : (std::min)((std::max)(static_cast<int32>(std::floor(std::log(maxZ) * _depthScale + _depthBias)), 0), lastSlice);
+
+		// correct the rounding of the logarithm by the exact boundaries
+		while (first > 0         && _sliceDepths[first]    > minZ) { --first; }
+		while (last  < lastSlice && _sliceDepths[last + 1] < maxZ) { ++last; }
+
+		light.FirstSlice = static_cast<uint16>(first);
+		light.LastSlice  = static_cast<uint16>((std::max)(first, last));
+		return true;
+	};
+
+	const auto TransformPoint = [&m](ViewLight& light, const gm::Float3& position)
+	{
+		light.X = position.x * m[0][0] + position.y * m[1][0] + position.z * m[2][0] + m[3][0];
+		light.Y = position.x * m[0][1] + position.y * m[1][1] + position.z * m[2][1] + m[3][1];
+		light.Z = position.x * m[0][2] + position.y * m[1][2] + position.z * m[2][2] + m[3][2];
+	};
+
+	_pointLights.Clear();
+	for (uint32 i = 0; i < pointLightCount; ++i)
+	{
+		const auto& source = pointLights[i];
+		if (!source.IsUse || !(source.Range > 0.0f)) { continue; }
+
+		ViewLight light = {};
+		TransformPoint(light, source.Position);
+		light.Radius = source.Range;
+		light.Index  = i;
+		if (SetSlices(light)) { _pointLights.Push(light); }
+	}
+
+	_spotLights.Clear();
+	for (uint32 i = 0; i < spotLightCount; ++i)
+	{
+		const auto& source = spotLights[i];
+		if (!source.IsUse || !(source.Range > 0.0f)) { continue; }
+
+		ViewLight light = {};
+		TransformPoint(light, source.Position);
+		light.Radius = source.Range;
+		light.Index  = i;
+		if (!SetSlices(light)) { continue; }
+
+		const auto& direction = source.Direction;
+		const float x      = direction.x * m[0][0] + direction.y * m[1][0] + direction.z * m[2][0];
+		const float y      = direction.x * m[0][1] + direction.y * m[1][1] + direction.z * m[2][1];
+		const float z      = direction.x * m[0][2] + direction.y * m[1][2] + direction.z * m[2][2];
+		const float length = std::sqrt(x * x + y * y + z * z);
+		const float angle  = (std::max)(source.OuterConeAngle, 0.0f);
+		if (length > 1e-6f && angle < 0.5f * gm::GM_PI_FLOAT)
+		{
+			light.DirectionX = x / length;
+			light.DirectionY = y / length;
+			light.DirectionZ = z / length;
+			light.CosAngle   = std::cos(angle);
+			light.SinAngle   = std::sin(angle);
+		}
+		_spotLights.Push(light);
+	}
+}
+
+/****************************************************************************
+*                     BinSlice
+*************************************************************************//**
+*  @fn        void LightClusterBinner::BinSlice(const gu::uint32 slice)
+*
+*  @brief     Test the lights overlapping the slice, then sort the hits by the cluster (counting sort).
+*             The lights of a cluster keep the index order, the point lights first.
+*
+*  @param[in] const gu::uint32 slice
+*
+*  @return    void
+*****************************************************************************/
+void LightClusterBinner::BinSlice(const gu::uint32 slice)
+{
+	auto& bins = _slices[slice];
+	bins.HitClusters.Clear();
+	bins.HitLights  .Clear();
+
+	SliceGeometry geometry = {};
+	geometry.ColumnMin    = _columnMin   .Data() + slice * _paddedCountX;
+	geometry.ColumnMax    = _columnMax   .Data() + slice * _paddedCountX;
+	geometry.ColumnCenter = _columnCenter.Data() + slice * _paddedCountX;
+	geometry.ColumnExtent = _columnExtent.Data() + slice * _paddedCountX;
+	geometry.RowMin       = _rowMin      .Data() + slice * _paddedCountY;
+	geometry.RowMax       = _rowMax      .Data() + slice * _paddedCountY;
+	geometry.RowCenter    = _rowCenter   .Data() + slice * _paddedCountY;
+	geometry.RowExtent    = _rowExtent   .Data() + slice * _paddedCountY;
+	geometry.MinZ         = _sliceDepths[slice];
+	geometry.MaxZ         = _sliceDepths[slice + 1];
+	geometry.CenterZ      = 0.5f * (geometry.MinZ + geometry.MaxZ);
+	geometry.ExtentZ      = 0.5f * (geometry.MaxZ - geometry.MinZ);
+	geometry.CountX       = _grid.CountX;
+	geometry.CountY       = _grid.CountY;
+	geometry.PaddedCountX = _paddedCountX;
+	geometry.PaddedCountY = _paddedCountY;
+
+	/*-------------------------------------------------------------------
+	-   Test the lights
+	---------------------------------------------------------------------*/
+	for (uint64 i = 0; i < _pointLights.Size(); ++i)
+	{
+		const auto& light = _pointLights[i];
+		if (light.FirstSlice <= slice && slice <= light.LastSlice)
+		{
+			AppendHits<false>(geometry, light, bins.HitClusters, bins.HitLights);
+		}
+	}
+	bins.PointHitCount = static_cast<uint32>(bins.HitClusters.Size());
+
+	for (uint64 i = 0; i < _spotLights.Size(); ++i)
+	{
+		const auto& light = _spotLights[i];
+		if (light.FirstSlice <= slice && slice <= light.LastSlice)
+		{
+			AppendHits<true>(geometry, light, bins.HitClusters, bins.HitLights);
+		}
+	}
+
+	/*-------------------------------------------------------------------
+	-   Count the lights of each cluster
+	---------------------------------------------------------------------*/
+	const uint32 clusterCount = _grid.CountX * _grid.CountY;
+	const uint32 hitCount     = static_cast<uint32>(bins.HitClusters.Size());
+	LightClusterRange* ranges = _ranges.Data() + static_cast<uint64>(slice) * clusterCount;
+
+	for (uint32 cluster = 0; cluster < clusterCount; ++cluster) { ranges[cluster] = {}; }
+	for (uint32 hit = 0; hit < bins.PointHitCount; ++hit) { ranges[bins.HitClusters[hit]].Counts += 1; }
+	for (uint32 hit = bins.PointHitCount; hit < hitCount; ++hit) { ranges[bins.HitClusters[hit]].Counts += 1u << 16; }
+
+	/*-------------------------------------------------------------------
+	-   Place the lists and scatter the hits
+	---------------------------------------------------------------------*/
+	bins.MaxLightsPerCluster  = 0;
+	bins.NonEmptyClusterCount = 0;
+
+	uint32 offset = 0;
+	for (uint32 cluster = 0; cluster < clusterCount; ++cluster)
+	{
+		const uint32 pointCount = ranges[cluster].GetPointLightCount();
+		const uint32 lightCount = pointCount + ranges[cluster].GetSpotLightCount();
+
+		ranges[cluster].Offset                 = offset;
+		bins.Cursors[cluster]                  = offset;
+		bins.Cursors[clusterCount + cluster]   = offset + pointCount;
+		offset += lightCount;
+
+		bins.MaxLightsPerCluster = (std::max)(bins.MaxLightsPerCluster, lightCount);
+		if (lightCount > 0) { bins.NonEmptyClusterCount++; }
+	}
+
+	// Resize never shrinks the size
+	bins.Indices.Clear();
+	bins.Indices.Resize(offset, false);
+	for (uint32 hit = 0; hit < hitCount; ++hit)
+	{
+		const uint32 cursor = (hit < bins.PointHitCount ? 0 : clusterCount) + bins.HitClusters[hit];
+		bins.Indices[bins.Cursors[cursor]++] = bins.HitLights[hit];
+	}
+}
+#pragma endregion Protected Function
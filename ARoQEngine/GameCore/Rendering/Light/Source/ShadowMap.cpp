@@ -14,10 +14,13 @@
 #include "GraphicsCore/Engine/Include/LowLevelGraphicsEngine.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIFrameBuffer.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUBuffer.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUTexture.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUResourceView.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/PipelineState/Include/GPUPipelineState.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/PipelineState/Include/GPUPipelineFactory.hpp"
 #include "GameUtility/Math/Include/GMVertex.hpp"
+#include <cstring>
+#include <cmath>
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
@@ -28,6 +31,26 @@ using namespace gm;
 //////////////////////////////////////////////////////////////////////////////////
 //                          Implement
 //////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	/* @brief : Empty region (left > right)*/
+	const gm::Float4 EMPTY_REGION = gm::Float4(1.0f, 1.0f, 0.0f, 0.0f);
+
+	bool IsEmptyRegion(const gm::Float4& region) noexcept
+	{
+		return region.x >= region.z || region.y >= region.w;
+	}
+
+	void Union(gm::Float4& region, const gm::Float4& other) noexcept
+	{
+		if (IsEmptyRegion(other)) { return; }
+		region.x = (std::min)(region.x, other.x);
+		region.y = (std::min)(region.y, other.y);
+		region.z = (std::max)(region.z, other.z);
+		region.w = (std::max)(region.w, other.w);
+	}
+}
+
 #pragma region Constructor and Destructor 
 ShadowMap::ShadowMap(const LowLevelGraphicsEnginePtr& engine, const std::uint32_t width, const std::uint32_t height, const gu::tstring& addName)
 	: _engine(engine)
@@ -57,8 +80,8 @@ ShadowMap::ShadowMap(const LowLevelGraphicsEnginePtr& engine, const std::uint32_
 
 ShadowMap::~ShadowMap()
 {
-	_gameModels.Clear();
-	_gameModels.ShrinkToFit();
+	_casters.Clear();
+	_casters.ShrinkToFit();
 }
 
 #pragma endregion Constructor and Destructor 
@@ -67,65 +90,286 @@ ShadowMap::~ShadowMap()
 /****************************************************************************
 *                     Draw
 *************************************************************************//**
-*  @fn        void ShadowMap::Draw(const ResourceViewPtr& scene)
+*  @fn        void ShadowMap::Draw(const ResourceViewPtr& scene, const gc::core::LODViewType view)
 *
 *  @brief     Draw the shadow map to the frame buffer. 
 *             In addition, we apply the gaussian blur for the VSM method.
+*             
+*             The static casters are drawn into the cached layer only when it is invalid,
+*             a static caster moved / changed its level of detail, or a caster started or stopped moving.
+*             The dynamic casters are drawn on the copy of the layer, and the blur covers
+*             the previous and the current bounds of the changed dynamic casters.
+*             Nothing is drawn when nothing changed.
 *
 *  @param[in] const ResourceViewPtr& scene resource view of the light camera.
+*  @param[in] const gc::core::LODViewType view (level of detail selected by GameModel::SelectLOD)
 *
 *  @return @@void
 *****************************************************************************/
-void ShadowMap::Draw(const ResourceViewPtr& scene)
+void ShadowMap::Draw(const ResourceViewPtr& scene, const gc::core::LODViewType view)
 {
+	_statistics = {};
+
 	/*-------------------------------------------------------------------
-	-               Set variables
+	-               Track the casters
 	---------------------------------------------------------------------*/
-	const auto device      = _engine->GetDevice();
-	const auto commandList = _engine->GetCommandList(CommandListType::Graphics);
+	bool       refreshStatic = _isStaticDirty;
+	bool       isFullRegion  = false;
+	gm::Float4 dirtyRegion   = EMPTY_REGION;
+	gu::uint32 dynamicCount  = 0;
+
+	for (auto& caster : _casters)
+	{
+		const auto& model      = caster.Model;
+		const auto  world      = model->GetTransform().GetFloat4x4();
+		const auto  lodLevel   = model->GetLODLevel(view);
+		const bool  isActive   = model->IsActive();
+		const bool  isMoved    = std::memcmp(&world, &caster.World, sizeof(world)) != 0;
+		const bool  isChanged  = isMoved || lodLevel != caster.LODLevel || isActive != caster.IsActive;
+		const bool  wasDynamic = caster.IsDynamic();
+
+		caster.World           = world;
+		caster.LODLevel        = lodLevel;
+		caster.IsActive        = isActive;
+		caster.StillFrameCount = isMoved ? 0 : (std::min)(caster.StillFrameCount + 1, STATIC_SETTLE_FRAME_COUNT);
+
+		const bool isDynamic = caster.IsDynamic();
+
+		// The caster in the cached layer
+		if (!isDynamic)
+		{
+			if (wasDynamic || isChanged) { refreshStatic = true; }
+			caster.HasRegion = false;
+			continue;
+		}
+
+		// The caster left the cached layer
+		if (!wasDynamic) { refreshStatic = true; }
+		if (isActive)    { ++dynamicCount; }
+
+		// The previous and the current bounds of the changed caster are blurred again
+		gm::Float4 region    = EMPTY_REGION;
+		const bool hasRegion = ComputeRegion(model, region);
+		if (isChanged || model->HasSkin())
+		{
+			if (caster.HasRegion) { Union(dirtyRegion, caster.Region); }
+			if (!hasRegion)       { isFullRegion = true; }
+			else if (isActive)    { Union(dirtyRegion, region); }
+		}
+		caster.HasRegion = hasRegion;
+		caster.Region    = region;
+	}
+
+	if (refreshStatic) { isFullRegion = true; }
+
+	// The blurred shadow map of the previous frame is still valid.
+	if (!isFullRegion && IsEmptyRegion(dirtyRegion)) { return; }
 
 	/*-------------------------------------------------------------------
-	-               Change render resource
+	-               Set variables
 	---------------------------------------------------------------------*/
+	const auto commandList = _engine->GetCommandList(CommandListType::Graphics);
+
 	// if not close the render pass, we close the current render pass. 
 	commandList->EndRenderPass();
 
-	// clear previous frame rendered frame buffer.
-	commandList->BeginRenderPass(_renderPass, _frameBuffer);
+	/*-------------------------------------------------------------------
+	-               Draw the static casters into the cached layer
+	---------------------------------------------------------------------*/
+	if (refreshStatic)
+	{
+		// clear previous frame rendered frame buffer.
+		commandList->BeginRenderPass(_renderPass, _staticFrameBuffer);
+		commandList->SetGraphicsPipeline(_pipeline);
+		commandList->SetResourceLayout  (_resourceLayout);
+		scene->Bind(commandList, 0);
+		for (const auto& caster : _casters)
+		{
+			if (caster.IsDynamic() || !caster.IsActive) { continue; }
+
+			caster.Model->Draw(false, 2, view);
+			_statistics.StaticDrawCount++;
+		}
+		commandList->EndRenderPass();
+
+		_isStaticDirty = false;
+	}
 
 	/*-------------------------------------------------------------------
-	-               Draw render 
+	-               Draw the dynamic casters on the copy of the layer
 	---------------------------------------------------------------------*/
-	commandList->SetGraphicsPipeline(_pipeline);
-	commandList->SetResourceLayout  (_resourceLayout);
-	scene->Bind(commandList, 0);
-	for (size_t i = 0; i < _gameModels.Size(); ++i)
+	auto blurSource = _staticFrameBuffer;
+	if (dynamicCount > 0)
 	{
-		_gameModels[i]->Draw(false);
+		commandList->CopyResource(_compositeFrameBuffer->GetRenderTarget(), _staticFrameBuffer->GetRenderTarget());
+		commandList->CopyResource(_compositeFrameBuffer->GetDepthStencil(), _staticFrameBuffer->GetDepthStencil());
+
+		commandList->BeginRenderPass(_compositeRenderPass, _compositeFrameBuffer);
+		commandList->SetGraphicsPipeline(_pipeline);
+		commandList->SetResourceLayout  (_resourceLayout);
+		scene->Bind(commandList, 0);
+		for (const auto& caster : _casters)
+		{
+			if (!caster.IsDynamic() || !caster.IsActive) { continue; }
+
+			caster.Model->Draw(false, 2, view);
+			_statistics.DynamicDrawCount++;
+		}
+		commandList->EndRenderPass();
+
+		blurSource = _compositeFrameBuffer;
 	}
 
 	/*-------------------------------------------------------------------
 	-         Apply the gaussian blur for the VSM method.
 	---------------------------------------------------------------------*/
-	_gaussianBlur->DrawPS(_frameBuffer, 0);
+	const auto region = isFullRegion ? gm::Float4(0.0f, 0.0f, 1.0f, 1.0f) : dirtyRegion;
+	_gaussianBlur->DrawPS(blurSource->GetRenderTargetSRV(), _frameBuffer, region);
+
+	_statistics.BlurCount     = 1;
+	_statistics.BlurredArea   = (region.z - region.x) * (region.w - region.y);
+	_statistics.DrawCallCount = _statistics.StaticDrawCount + _statistics.DynamicDrawCount + 3;
 }
 
 /****************************************************************************
 *							Add
 *************************************************************************//**
-*  @fn        void ShadowMap::Add(const GameModelPtr& gameModel)
+*  @fn        void ShadowMap::Add(const GameModelPtr& gameModel, const ShadowCasterMobility mobility)
 *
 *  @brief     Add game models for the rendering shadow
 *
 *  @param[in] const GameModelPtr& gameModel shared pointer.
+*  @param[in] const ShadowCasterMobility mobility
 *
 *  @return @@void
 *****************************************************************************/
-void ShadowMap::Add(const GameModelPtr& gameModel)
+void ShadowMap::Add(const GameModelPtr& gameModel, const ShadowCasterMobility mobility)
 {
 	if (!gameModel) { return; }
 
-	_gameModels.Push(gameModel);
+	ShadowCaster caster = {};
+	caster.Model           = gameModel;
+	caster.Mobility        = mobility;
+	caster.World           = gameModel->GetTransform().GetFloat4x4();
+	caster.IsActive        = gameModel->IsActive();
+	caster.StillFrameCount = STATIC_SETTLE_FRAME_COUNT;
+	_casters.Push(caster);
+
+	_isStaticDirty = true;
+}
+
+/****************************************************************************
+*							Remove
+*************************************************************************//**
+*  @fn        void ShadowMap::Remove(const GameModelPtr& gameModel)
+*
+*  @brief     Remove the game model from the shadow casters
+*
+*  @param[in] const GameModelPtr& gameModel shared pointer.
+*
+*  @return @@void
+*****************************************************************************/
+void ShadowMap::Remove(const GameModelPtr& gameModel)
+{
+	for (gu::uint64 i = 0; i < _casters.Size(); ++i)
+	{
+		if (_casters[i].Model != gameModel) { continue; }
+
+		_casters.RemoveAt(i);
+		_isStaticDirty = true;
+		return;
+	}
+}
+
+/****************************************************************************
+*							SetLightViewProjection
+*************************************************************************//**
+*  @fn        void ShadowMap::SetLightViewProjection(const gm::Float4x4& viewProjection)
+*
+*  @brief     Set the view projection matrix of the scene. A new matrix invalidates the cached layer.
+*
+*  @param[in] const gm::Float4x4& viewProjection (row vector matrix)
+*
+*  @return @@void
+*****************************************************************************/
+void ShadowMap::SetLightViewProjection(const gm::Float4x4& viewProjection)
+{
+	if (_hasLightViewProjection && std::memcmp(&viewProjection, &_lightViewProjection, sizeof(viewProjection)) == 0) { return; }
+
+	_lightViewProjection    = viewProjection;
+	_hasLightViewProjection = true;
+	_isStaticDirty          = true;
+}
+
+/****************************************************************************
+*							IsDynamic
+*************************************************************************//**
+*  @fn        bool ShadowMap::ShadowCaster::IsDynamic() const noexcept
+*
+*  @brief     The movable casters, the skinned models and the static casters which moved recently
+*
+*  @param[in] void
+*
+*  @return @@bool
+*****************************************************************************/
+bool ShadowMap::ShadowCaster::IsDynamic() const noexcept
+{
+	return Mobility == ShadowCasterMobility::Movable || Model->HasSkin() || StillFrameCount < STATIC_SETTLE_FRAME_COUNT;
+}
+
+/****************************************************************************
+*							ComputeRegion
+*************************************************************************//**
+*  @fn        bool ShadowMap::ComputeRegion(const GameModelPtr& gameModel, gm::Float4& region) const
+*
+*  @brief     Project the bounding sphere by the light view projection matrix,
+*             and expand the rectangle by the blur kernel.
+*
+*  @param[in]  const GameModelPtr& gameModel
+*  @param[out] gm::Float4& region (normalized left, top, right, bottom)
+*
+*  @return @@bool (false : the bounds or the matrix are unknown)
+*****************************************************************************/
+bool ShadowMap::ComputeRegion(const GameModelPtr& gameModel, gm::Float4& region) const
+{
+	if (!_hasLightViewProjection) { return false; }
+
+	gm::Float3 center = {};
+	float      radius = 0.0f;
+	gameModel->GetWorldBoundingSphere(center, radius);
+	if (radius <= 0.0f) { return false; }
+	if (gameModel->HasSkin()) { radius *= SKINNED_BOUNDS_SCALE; }
+
+	/*-------------------------------------------------------------------
+	-              Clip space center (row vector matrix)
+	---------------------------------------------------------------------*/
+	const auto& m = _lightViewProjection.u.m;
+	const float x = center.x * m[0][0] + center.y * m[1][0] + center.z * m[2][0] + m[3][0];
+	const float y = center.x * m[0][1] + center.y * m[1][1] + center.z * m[2][1] + m[3][1];
+	const float w = center.x * m[0][3] + center.y * m[1][3] + center.z * m[2][3] + m[3][3];
+	if (w <= 0.0f) { return false; }
+
+	const float radiusX = radius * std::sqrt(m[0][0] * m[0][0] + m[1][0] * m[1][0] + m[2][0] * m[2][0]) / w;
+	const float radiusY = radius * std::sqrt(m[0][1] * m[0][1] + m[1][1] * m[1][1] + m[2][1] * m[2][1]) / w;
+
+	/*-------------------------------------------------------------------
+	-              Texture coordinates (v is down) + blur kernel
+	---------------------------------------------------------------------*/
+	const auto  texture = _frameBuffer->GetRenderTarget();
+	const float marginX = static_cast<float>(gc::GaussianBlur::KERNEL_RADIUS) / static_cast<float>(texture->GetWidth());
+	const float marginY = static_cast<float>(gc::GaussianBlur::KERNEL_RADIUS) / static_cast<float>(texture->GetHeight());
+	const float u       = x / w *  0.5f + 0.5f;
+	const float v       = y / w * -0.5f + 0.5f;
+
+	const auto Clamp = [](const float value) { return (std::min)((std::max)(value, 0.0f), 1.0f); };
+	region = gm::Float4
+	(
+		Clamp(u - radiusX * 0.5f - marginX),
+		Clamp(v - radiusY * 0.5f - marginY),
+		Clamp(u + radiusX * 0.5f + marginX),
+		Clamp(v + radiusY * 0.5f + marginY)
+	);
+	return true;
 }
 #pragma endregion Main Function
 
@@ -190,7 +434,7 @@ void ShadowMap::PrepareVertexAndIndexBuffer(const gu::tstring& name)
 *************************************************************************//**
 *  @fn        void ShadowMap::PrepareRenderResource(const std::uint32_t width, const std::uint32_t height, const gu::tstring& name)
 *
-*  @brief     Prepare the renderPass and frame buffer
+*  @brief     Prepare the renderPass and frame buffers (blurred result, static layer and composite)
 *
 *  @param[in] const std::uint32_t textureWidth
 *  @param[in] const std::uint32_t textureHeight
@@ -215,6 +459,11 @@ void ShadowMap::PrepareRenderResource(const std::uint32_t width, const std::uint
 	_renderPass = device->CreateRenderPass(colorAttachment, depthAttachment);
 	_renderPass->SetClearValue(clearColor, clearDepth);
 
+	// The dynamic casters are drawn on the copied static layer.
+	const auto compositeColorAttachment = Attachment::RenderTarget(renderFormat, ResourceState::RenderTarget, ResourceState::Present, AttachmentLoad::Load);
+	const auto compositeDepthAttachment = Attachment::DepthStencil(depthFormat , ResourceState::Common, ResourceState::DepthStencil, AttachmentLoad::Load);
+	_compositeRenderPass = device->CreateRenderPass(compositeColorAttachment, compositeDepthAttachment);
+
 	/*-------------------------------------------------------------------
 	-             Prepare frame buffer
 	---------------------------------------------------------------------*/
@@ -223,6 +472,17 @@ void ShadowMap::PrepareRenderResource(const std::uint32_t width, const std::uint
 	const auto renderTexture = device->CreateTexture(renderInfo, name + SP("FrameBuffer"));
 	const auto depthTexture  = device->CreateTexture(depthInfo , name + SP("FrameBufferDepth"));
 	_frameBuffer = device->CreateFrameBuffer(_renderPass, renderTexture, depthTexture);
+
+	/*-------------------------------------------------------------------
+	-             Prepare the cached static layer and the composite target
+	---------------------------------------------------------------------*/
+	_staticFrameBuffer = device->CreateFrameBuffer(_renderPass,
+		device->CreateTexture(renderInfo, name + SP("StaticLayer")),
+		device->CreateTexture(depthInfo , name + SP("StaticLayerDepth")));
+
+	_compositeFrameBuffer = device->CreateFrameBuffer(_compositeRenderPass,
+		device->CreateTexture(renderInfo, name + SP("Composite")),
+		device->CreateTexture(depthInfo , name + SP("CompositeDepth")));
 }
 
 /****************************************************************************
@@ -16,6 +16,7 @@
 #include "GameCore/Rendering/Model/External/GLTF/Private/Include/GLTFExceptions.hpp"
 #include "GameCore/Rendering/Model/External/GLTF/Private/Include/GLTFMeshPrimitiveUtils.hpp"
 #include "GameUtility/File/Include/FileSystem.hpp"
+#include "GameUtility/Memory/Include/GUMemoryTracker.hpp"
 #include <fstream>
 #include <sstream>
 
@@ -67,6 +68,8 @@ namespace
 //////////////////////////////////////////////////////////////////////////////////
 void GLTFFile::Load(const std::string& filePath)
 {
+	GU_MEMORY_TAG_SCOPE(gu::MemoryTag::GLTF);
+
 	/*-------------------------------------------------------------------
 	-                 Get Extension and Directory
 	---------------------------------------------------------------------*/
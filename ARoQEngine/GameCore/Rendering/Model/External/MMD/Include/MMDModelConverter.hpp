@@ -12,6 +12,7 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include "../../../Include/GameModelConverter.hpp"
+#include "../../../Include/MeshLOD.hpp"
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
@@ -51,9 +52,13 @@ namespace gc::core
 		/****************************************************************************
 		**                Private Function
 		*****************************************************************************/
-		void PrepareTotalMesh(const GameModelPtr model, pmx::PMXFile& file);
+		/* @brief : Returns false when an index of the file is out of range. The mesh optimization indexes the CPU arrays with them.*/
+		bool ValidateIndices(const pmx::PMXFile& file) const;
 
-		void PrepareEachMaterialMesh(const GameModelPtr model, pmx::PMXFile& file);
+		/* @brief : Returns the level of detail chain stored after LOD0 in the index buffer*/
+		gu::DynamicArray<MeshLODLevel> PrepareTotalMesh(const GameModelPtr model, pmx::PMXFile& file);
+
+		void PrepareEachMaterialMesh(const GameModelPtr model, pmx::PMXFile& file, const gu::DynamicArray<MeshLODLevel>& lods);
 	};
 
 	/****************************************************************************
@@ -15,10 +15,15 @@
 #include "../../../Include/Mesh.hpp"
 #include "../../../Include/Material.hpp"
 #include "../../../Include/MaterialType.hpp"
+#include "../../../Include/MeshOptimizer.hpp"
+#include "../../../Include/MeshSimplifier.hpp"
+#include "../../../Include/VertexCompression.hpp"
+#include "../../../../Animation/Include/CPUSkinning.hpp"
 #include "GameUtility/File/Include/UnicodeUtility.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHICommonState.hpp"
 #include "GameUtility/Math/Include/GMVertex.hpp"
 #include <string>
+#include <cstdio>
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
@@ -27,6 +32,27 @@ using namespace rhi::core;
 namespace
 {
 	constexpr std::int32_t INVALID_ID = -1;
+
+	/*-------------------------------------------------------------------
+	-  Replace the vertex references with the optimized vertex order.
+	-  The vertices no face refers to are removed by MeshOptimizer, so their references are dropped.
+	---------------------------------------------------------------------*/
+	template<class ElementType, class VertexIndexAccessor>
+	void RemapVertexReferences(gu::DynamicArray<ElementType>& elements, const gu::DynamicArray<gu::uint32>& vertexRemap, VertexIndexAccessor vertexIndexOf)
+	{
+		gu::uint64 count = 0;
+		for (gu::uint64 i = 0; i < elements.Size(); ++i)
+		{
+			const auto newIndex = vertexRemap[vertexIndexOf(elements[i])];
+			if (newIndex == MeshOptimizer::INVALID_INDEX) { continue; }
+
+			vertexIndexOf(elements[i]) = static_cast<INT32>(newIndex);
+			if (count != i) { elements[count] = elements[i]; }
+			++count;
+		}
+
+		if (count < elements.Size()) { elements.RemoveAt(count, elements.Size() - count, false); }
+	}
 }
 
 //////////////////////////////////////////////////////////////////////////////////
@@ -43,17 +69,29 @@ bool PMXConverter::Load(const gu::tstring& filePath, GameModelPtr model)
 	---------------------------------------------------------------------*/
 	pmx::PMXFile file;
 	if(!file.Load(filePath)) {return false;}
+	if (!ValidateIndices(file)) { return false; }
 
 	/*-------------------------------------------------------------------
 	-            Set up resource
 	---------------------------------------------------------------------*/
-	PrepareTotalMesh(model, file);
-	PrepareEachMaterialMesh(model, file);
+	const auto lods = PrepareTotalMesh(model, file);
+	PrepareEachMaterialMesh(model, file, lods);
 	
 	/*-------------------------------------------------------------------
 	-            Check skin mesh model
 	---------------------------------------------------------------------*/
 	model->_hasSkin = !file.Bones.IsEmpty();
+	if (model->_hasSkin)
+	{
+		gu::DynamicArray<animation::SkeletonBone> bones(file.Bones.Size());
+		for (size_t i = 0; i < file.Bones.Size(); ++i)
+		{
+			bones[i].Name        = file.Bones[i].BoneName;
+			bones[i].ParentIndex = file.Bones[i].ParentBoneIndex;
+			bones[i].Position    = file.Bones[i].Position;
+		}
+		model->_skeleton = gu::MakeShared<animation::Skeleton>(bones.Data(), static_cast<gu::uint32>(bones.Size()));
+	}
 
 	return true;
 }
@@ -78,24 +116,94 @@ bool PMDConverter::Load(const gu::tstring& filePath, GameModelPtr model)
 #pragma endregion Main Function
 
 #pragma region PMX 
+/****************************************************************************
+*					ValidateIndices
+*************************************************************************//**
+*  @fn        bool PMXConverter::ValidateIndices(const pmx::PMXFile& file) const
+*
+*  @brief     Check the face, morph and soft body vertex indices and the material face counts.
+*             A malformed file is rejected here, because the release build has no check in the mesh optimization.
+*
+*  @param[in] const pmx::PMXFile& file
+*
+*  @return @@bool
+*****************************************************************************/
+bool PMXConverter::ValidateIndices(const pmx::PMXFile& file) const
+{
+	const auto vertexCount = static_cast<gu::uint64>(file.Vertices.Size());
+	if (vertexCount >= MeshOptimizer::INVALID_INDEX) { OutputDebugStringA("pmx: too many vertices.\n"); return false; }
+
+	const auto isVertex = [vertexCount](const gu::int64 vertexIndex)
+	{
+		return 0 <= vertexIndex && static_cast<gu::uint64>(vertexIndex) < vertexCount;
+	};
+
+	/*-------------------------------------------------------------------
+	-            Faces
+	---------------------------------------------------------------------*/
+	if (file.Indices.Size() % 3 != 0) { OutputDebugStringA("pmx: the face indices are not a triangle list.\n"); return false; }
+	for (const auto index : file.Indices)
+	{
+		if (!isVertex(index)) { OutputDebugStringA("pmx: the face index is out of range.\n"); return false; }
+	}
+
+	gu::uint64 faceIndexCount = 0;
+	for (const auto& material : file.Materials)
+	{
+		if (material.FaceIndicesCount < 0 || material.FaceIndicesCount % 3 != 0) { OutputDebugStringA("pmx: the material face count is invalid.\n"); return false; }
+		faceIndexCount += static_cast<gu::uint64>(material.FaceIndicesCount);
+	}
+	if (faceIndexCount != file.Indices.Size()) { OutputDebugStringA("pmx: the material face counts differ from the face index count.\n"); return false; }
+
+	/*-------------------------------------------------------------------
+	-            Morphs and soft bodies
+	---------------------------------------------------------------------*/
+	for (const auto& morph : file.Morphs)
+	{
+		for (const auto& positionMorph : morph.PositionMorphs)
+		{
+			if (!isVertex(positionMorph.VertexIndex)) { OutputDebugStringA("pmx: the vertex morph index is out of range.\n"); return false; }
+		}
+		for (const auto& uvMorph : morph.UVMorphs)
+		{
+			if (!isVertex(uvMorph.VertexIndex)) { OutputDebugStringA("pmx: the uv morph index is out of range.\n"); return false; }
+		}
+	}
+
+	for (const auto& softBody : file.SoftBodies)
+	{
+		for (const auto vertexIndex : softBody.VertexIndices)
+		{
+			if (!isVertex(vertexIndex)) { OutputDebugStringA("pmx: the soft body vertex index is out of range.\n"); return false; }
+		}
+		for (const auto& anchor : softBody.Anchor)
+		{
+			if (!isVertex(anchor.VertexIndex)) { OutputDebugStringA("pmx: the soft body anchor index is out of range.\n"); return false; }
+		}
+	}
+	return true;
+}
+
 /****************************************************************************
 *					PrepareTotalMesh
 *************************************************************************//**
-*  @fn        void PMXConverter::PrepareTotalMesh(const GameModelPtr model, pmx::PMXFile& file)
+*  @fn        gu::DynamicArray<MeshLODLevel> PMXConverter::PrepareTotalMesh(const GameModelPtr model, pmx::PMXFile& file)
 *
-*  @brief     Prepare total mesh buffer (all material index buffer and vertex buffer)(ignore material)
+*  @brief     Prepare total mesh buffer (all material index buffer and vertex buffer)(ignore material).
+*             The vertices and the indices are optimized by MeshOptimizer and split into the meshlets of each material.
+*             The levels of detail are generated by MeshSimplifier and stored after LOD0 in the same index buffer.
 *
 *  @param[in] const GameModelPtr
 *  @param[in] pmx::PMXFile& file
 *
-*  @return @@void
+*  @return @@gu::DynamicArray<MeshLODLevel>
 *****************************************************************************/
-void PMXConverter::PrepareTotalMesh(const GameModelPtr model, pmx::PMXFile& file)
+gu::DynamicArray<MeshLODLevel> PMXConverter::PrepareTotalMesh(const GameModelPtr model, pmx::PMXFile& file)
 {
 	/*-------------------------------------------------------------------
 	-            Copy PMXvertex -> skin vertex
 	---------------------------------------------------------------------*/
-	std::unique_ptr<gm::SkinMeshVertex[]> vertices = std::make_unique<gm::SkinMeshVertex[]>(file.Vertices.Size());
+	gu::DynamicArray<gm::SkinMeshVertex> vertices(file.Vertices.Size());
 	for (size_t i = 0; i < file.Vertices.Size(); ++i)
 	{
 		const auto& pmxVertex = file.Vertices[i];
@@ -105,29 +213,176 @@ void PMXConverter::PrepareTotalMesh(const GameModelPtr model, pmx::PMXFile& file
 		vertices[i].UV       = pmxVertex.UV;
 		std::memcpy(vertices[i].BoneIndices, pmxVertex.BoneIndices, sizeof(pmxVertex.BoneIndices));
 		std::memcpy(vertices[i].BoneWeights, pmxVertex.BoneWeights, sizeof(pmxVertex.BoneWeights));
+
+		// BDEF1 stores no weight and BDEF2 / SDEF store only the first one
+		auto& weights = vertices[i].BoneWeights;
+		switch (pmxVertex.WeightType)
+		{
+			case pmx::PMXVertexWeight::BDEF1: { weights[0] = 1.0f; weights[1] = weights[2] = weights[3] = 0.0f; break; }
+			case pmx::PMXVertexWeight::BDEF2:
+			case pmx::PMXVertexWeight::SDEF : { weights[1] = 1.0f - weights[0]; weights[2] = weights[3] = 0.0f; break; }
+			default: { break; }
+		}
+	}
+
+	/*-------------------------------------------------------------------
+	-            Optimize (each material keeps its index count, so the offsets stay valid)
+	---------------------------------------------------------------------*/
+	gu::DynamicArray<gu::uint32> materialIndexCounts(file.Materials.Size());
+	for (size_t i = 0; i < file.Materials.Size(); ++i)
+	{
+		materialIndexCounts[i] = static_cast<gu::uint32>(file.Materials[i].FaceIndicesCount);
+	}
+
+	// Vertices moved by the morphs and the soft bodies are never merged with the other vertices
+	gu::DynamicArray<bool> lockedVertices(file.Vertices.Size(), false);
+	for (const auto& morph : file.Morphs)
+	{
+		for (const auto& positionMorph : morph.PositionMorphs) { lockedVertices[positionMorph.VertexIndex] = true; }
+		for (const auto& uvMorph       : morph.UVMorphs)       { lockedVertices[uvMorph.VertexIndex]       = true; }
+	}
+	for (const auto& softBody : file.SoftBodies)
+	{
+		for (const auto vertexIndex : softBody.VertexIndices) { lockedVertices[vertexIndex] = true; }
+		for (const auto& anchor     : softBody.Anchor)        { lockedVertices[anchor.VertexIndex] = true; }
+	}
+
+	// The deduplication compares only the SkinMeshVertex bytes, so the SDEF (C, R0, R1) and QDEF vertices are not merged either.
+	// They are locked only for the deduplication; the LOD simplification below may still move them.
+	gu::DynamicArray<bool> mergeLockedVertices = lockedVertices;
+	for (size_t i = 0; i < file.Vertices.Size(); ++i)
+	{
+		const auto weightType = file.Vertices[i].WeightType;
+		if (weightType == pmx::PMXVertexWeight::SDEF || weightType == pmx::PMXVertexWeight::QDEF) { mergeLockedVertices[i] = true; }
 	}
 
+	const auto meshlets = gu::MakeShared<MeshletData>();
+	gu::DynamicArray<gu::uint32> vertexRemap(file.Vertices.Size());
+
+	const auto vertexCount = MeshOptimizer::Optimize(vertices.Data(), static_cast<gu::uint32>(vertices.Size()),
+		file.Indices.Data(), static_cast<gu::uint32>(file.Indices.Size()),
+		materialIndexCounts.Data(), static_cast<gu::uint32>(materialIndexCounts.Size()),
+		model->_meshOptimizeSettings, meshlets.Get(), &model->_meshOptimizeStatistics,
+		vertexRemap.Data(), mergeLockedVertices.Data());
+
+	// Keep the vertex references of the file consistent with the new vertex order
+	for (auto& morph : file.Morphs)
+	{
+		RemapVertexReferences(morph.PositionMorphs, vertexRemap, [](auto& positionMorph) -> INT32& { return positionMorph.VertexIndex; });
+		RemapVertexReferences(morph.UVMorphs      , vertexRemap, [](auto& uvMorph)       -> INT32& { return uvMorph.VertexIndex; });
+	}
+	for (auto& softBody : file.SoftBodies)
+	{
+		RemapVertexReferences(softBody.VertexIndices, vertexRemap, [](INT32& vertexIndex) -> INT32& { return vertexIndex; });
+		RemapVertexReferences(softBody.Anchor       , vertexRemap, [](auto& anchor)       -> INT32& { return anchor.VertexIndex; });
+	}
+
+#ifdef _DEBUG
+	const auto& statistics = model->_meshOptimizeStatistics;
+	char message[256] = {};
+	std::snprintf(message, sizeof(message), "PMX mesh: vertices %u -> %u, ACMR %.3f -> %.3f, ATVR %.3f -> %.3f, meshlets %u (%.1f vertices, %.1f triangles)\n",
+		statistics.VertexCountBefore, statistics.VertexCountAfter, statistics.CacheBefore.ACMR, statistics.CacheAfter.ACMR,
+		statistics.CacheBefore.ATVR, statistics.CacheAfter.ATVR, statistics.Meshlets.MeshletCount,
+		statistics.Meshlets.AverageVertexCount, statistics.Meshlets.AverageTriangleCount);
+	OutputDebugStringA(message);
+#endif
+
+	/*-------------------------------------------------------------------
+	-            Level of detail (morph and soft body vertices stay where they are, so the morphs keep working)
+	---------------------------------------------------------------------*/
+	gu::DynamicArray<bool> lodLockedVertices(vertexCount, false);
+	for (size_t i = 0; i < vertexRemap.Size(); ++i)
+	{
+		if (lockedVertices[i] && vertexRemap[i] != MeshOptimizer::INVALID_INDEX) { lodLockedVertices[vertexRemap[i]] = true; }
+	}
+
+	gu::DynamicArray<gu::uint32> lodIndices = {};
+	const auto lods = model->PrepareLODs(lodIndices, file.Indices.Data(), static_cast<gu::uint32>(file.Indices.Size()),
+		materialIndexCounts.Data(), static_cast<gu::uint32>(materialIndexCounts.Size()),
+		vertices.Data(), vertexCount, MeshSimplifyVertexLayout::Create<gm::SkinMeshVertex>(), lodLockedVertices.Data());
+
+	for (size_t i = 0; i < lodIndices.Size(); ++i) { file.Indices.Push(lodIndices[i]); }
+
+#ifdef _DEBUG
+	for (gu::uint32 level = 0; level < lods.Size(); ++level)
+	{
+		std::snprintf(message, sizeof(message), "PMX LOD%u: triangles %u, error %.4f\n", level, lods[level].IndexCount / 3, lods[level].Error);
+		OutputDebugStringA(message);
+	}
+#endif
+
 	/*-------------------------------------------------------------------
 	-            Total mesh
 	---------------------------------------------------------------------*/
-	const auto vbData = GPUBufferMetaData::VertexBuffer(sizeof(gm::SkinMeshVertex), file.Vertices.Size(), MemoryHeap::Upload , ResourceState::Common, vertices.get());
+	// The compressed vertex buffer halves the vertex memory. The CPU skinning source below keeps the float vertices.
+	model->_loadedVertexFormat          = model->_vertexFormat;
+	model->_vertexCompressionStatistics = {};
+	gu::DynamicArray<gm::CompressedSkinMeshVertex> compressedVertices = {};
+	if (model->_loadedVertexFormat == ModelVertexFormat::Compressed)
+	{
+		compressedVertices.Resize(vertexCount);
+		VertexCompressor::Compress(compressedVertices.Data(), vertices.Data(), vertexCount, &model->_vertexCompressionStatistics);
+
+	#ifdef _DEBUG
+		const auto& compression = model->_vertexCompressionStatistics;
+		std::snprintf(message, sizeof(message), "PMX vertex compression: %llu -> %llu bytes, normal error %.4f deg, uv error %.6f, weight error %.4f\n",
+			compression.BytesBefore, compression.BytesAfter, compression.MaxNormalErrorDegree, compression.MaxUVError, compression.MaxBoneWeightError);
+		OutputDebugStringA(message);
+	#endif
+	}
+
+	const auto vbData = model->_loadedVertexFormat == ModelVertexFormat::Compressed ?
+		GPUBufferMetaData::VertexBuffer(sizeof(gm::CompressedSkinMeshVertex), vertexCount, MemoryHeap::Upload, ResourceState::Common, compressedVertices.Data()) :
+		GPUBufferMetaData::VertexBuffer(sizeof(gm::SkinMeshVertex)          , vertexCount, MemoryHeap::Upload, ResourceState::Common, vertices.Data());
 	const auto ibData = GPUBufferMetaData::IndexBuffer (sizeof(UINT32)            , file.Indices .Size(), MemoryHeap::Default, ResourceState::Common, file.Indices.Data());
 	model->_totalMesh = gu::MakeShared<Mesh>(model->_engine, vbData, ibData);	
+	model->_totalMesh->PrepareMeshlets(meshlets);
+
+	/*-------------------------------------------------------------------
+	-            CPU skinning source (SDEF / QDEF parameters follow the optimized vertex order)
+	---------------------------------------------------------------------*/
+	if (!file.Bones.IsEmpty())
+	{
+		gu::DynamicArray<animation::SkinDeformData> deforms(vertexCount);
+		for (size_t i = 0; i < vertexRemap.Size(); ++i)
+		{
+			if (vertexRemap[i] == MeshOptimizer::INVALID_INDEX) { continue; }
+
+			const auto& pmxVertex = file.Vertices[i];
+			auto&       deform    = deforms[vertexRemap[i]];
+			if (pmxVertex.WeightType == pmx::PMXVertexWeight::SDEF)
+			{
+				deform.Type   = animation::SkinDeformType::Spherical;
+				deform.SDefC  = pmxVertex.SDefC;
+				deform.SDefR0 = pmxVertex.SDefR0;
+				deform.SDefR1 = pmxVertex.SDefR1;
+			}
+			else if (pmxVertex.WeightType == pmx::PMXVertexWeight::QDEF)
+			{
+				deform.Type = animation::SkinDeformType::DualQuaternion;
+			}
+		}
+
+		model->_skinningSource = gu::MakeShared<animation::SkinningSource>(vertices.Data(), vertexCount,
+			static_cast<gu::uint32>(file.Bones.Size()), deforms.Data());
+	}
+	return lods;
 }
 
 /****************************************************************************
 *					PrepareEachMaterialMesh
 *************************************************************************//**
-*  @fn        vvoid PMXConverter::PrepareEachMaterialMesh(const GameModelPtr model, pmx::PMXFile& file)
+*  @fn        vvoid PMXConverter::PrepareEachMaterialMesh(const GameModelPtr model, pmx::PMXFile& file, const gu::DynamicArray<MeshLODLevel>& lods)
 *
 *  @brief     Prepare each material mesh
 *
 *  @param[in] const GameModelPtr
 *  @param[in] pmx::PMXFile& file
+*  @param[in] const gu::DynamicArray<MeshLODLevel>& lods
 *
 *  @return @@void
 *****************************************************************************/
-void PMXConverter::PrepareEachMaterialMesh(const GameModelPtr model, pmx::PMXFile& file)
+void PMXConverter::PrepareEachMaterialMesh(const GameModelPtr model, pmx::PMXFile& file, const gu::DynamicArray<MeshLODLevel>& lods)
 {
 	model->_materialCount = file.Materials.Size();
 	model->_meshes.Resize(file.Materials.Size());
@@ -180,7 +435,15 @@ void PMXConverter::PrepareEachMaterialMesh(const GameModelPtr model, pmx::PMXFil
 			(std::uint64_t)file.Materials[i].FaceIndicesCount,
 			(std::uint32_t)indexOffset);
 
+		if (const auto meshlets = model->_totalMesh->GetMeshlets(); meshlets && meshlets->SubMeshOffsets.Size() > i + 1)
+		{
+			mesh->SetMeshlets(meshlets, model->_totalMesh->GetMeshletBuffers(),
+				meshlets->SubMeshOffsets[i], meshlets->SubMeshOffsets[i + 1] - meshlets->SubMeshOffsets[i]);
+		}
+
 		indexOffset += file.Materials[i].FaceIndicesCount;
 	}
+
+	model->ApplyLODs(lods);
 }
 #pragma endregion PMX
\ No newline at end of file
@@ -11,6 +11,7 @@
 #include "GameCore/Rendering/Model/External/MMD/Include/PMXParser.hpp"
 #include "GameUtility/File/Include/UnicodeUtility.hpp"
 #include "GameUtility/File/Include/FileSystem.hpp"
+#include "GameUtility/Memory/Include/GUMemoryTracker.hpp"
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
@@ -22,6 +23,8 @@ bool ReadPMXIndex(FILE* filePtr, INT32* pmxIndex, UINT8 indexSize);
 //////////////////////////////////////////////////////////////////////////////////
 bool PMXFile::Load(const gu::tstring& filePath)
 {
+	GU_MEMORY_TAG_SCOPE(gu::MemoryTag::Model);
+
 	/*-------------------------------------------------------------------
 	-             Open File
 	---------------------------------------------------------------------*/
@@ -845,7 +848,9 @@ bool ReadPMXString(FILE* filePtr, gu::string* string, PMXEncode encode)
 		{
 			std::u16string utf16String(bufferSize / 2, u'\0');
 			fread_s(utf16String.data(), sizeof(char16_t) * utf16String.size(), sizeof(char16_t), utf16String.size(), filePtr);
-			if (!unicode::ConvertU16ToU8(utf16String, std::string(string->CString()))) { return false; }
+			std::string utf8String = "";
+			if (!unicode::ConvertU16ToU8(utf16String, utf8String)) { return false; }
+			*string = gu::string(utf8String.c_str());
 			break;
 		}
 		case PMXEncode::UTF8:
@@ -11,6 +11,7 @@
 #include "GameCore/Rendering/Model/External/MMD/Include/VMDParser.hpp"
 #include "GameUtility/File/Include/UnicodeUtility.hpp"
 #include "GameUtility/File/Include/FileSystem.hpp"
+#include "GameUtility/Memory/Include/GUMemoryTracker.hpp"
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
@@ -26,6 +27,8 @@ void ReadVMDString(FILE* filePtr, std::string* string, UINT32 bufferSize);
 //////////////////////////////////////////////////////////////////////////////////
 bool VMDFile::Load(const std::wstring& filePath)
 {
+	GU_MEMORY_TAG_SCOPE(gu::MemoryTag::Animation);
+
 	/*-------------------------------------------------------------------
 	-             Open File
 	---------------------------------------------------------------------*/
@@ -13,12 +13,21 @@
 //////////////////////////////////////////////////////////////////////////////////
 #include "GameCore/Core/Include/GameActor.hpp"
 #include "PrimitiveMesh.hpp"
+#include "MeshOptimizer.hpp"
+#include "MeshSimplifier.hpp"
+#include "VertexCompression.hpp"
 #include <vector>
 
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
 class LowLevelGraphicsEngine;
+
+namespace gc::animation
+{
+	class Skeleton;
+	class SkinningSource;
+}
 //////////////////////////////////////////////////////////////////////////////////
 //                         Template Class
 //////////////////////////////////////////////////////////////////////////////////
@@ -40,6 +49,8 @@ namespace gc::core
 		using MeshArrayPtr     = gu::DynamicArray<MeshPtr>; // material count array 
 		using MaterialPtr      = gu::SharedPointer<Material>;
 		using GameWorldInfoPtr = gu::SharedPointer<GameWorldInfo>;
+		using SkeletonPtr       = gu::SharedPointer<animation::Skeleton>;
+		using SkinningSourcePtr = gu::SharedPointer<animation::SkinningSource>;
 	
 	public:
 		/****************************************************************************
@@ -54,7 +65,11 @@ namespace gc::core
 		/* @brief : Update motion*/
 		virtual void Update(const float deltaTime, const bool enableUpdateChild = false) override;
 		
-		virtual void Draw(const bool isDrawingEachMaterial = true, const std::uint32_t materialOffsetID = 2);
+		/* @brief : Draw with the level of detail selected for the view by SelectLOD*/
+		virtual void Draw(const bool isDrawingEachMaterial = true, const std::uint32_t materialOffsetID = 2, const LODViewType view = LODViewType::Main);
+
+		/* @brief : Select the level of detail of the view from the projected size of the bounding sphere. Call once a frame for each view.*/
+		gu::uint32 SelectLOD(const LODViewType viewType, const LODView& view);
 
 		/****************************************************************************
 		**                Public Member Variables
@@ -69,8 +84,59 @@ namespace gc::core
 
 		bool HasSkin() const { return _hasSkin; }
 
+		/* @brief : Bone hierarchy for the motion binding and the skinning palette (nullptr : no skin)*/
+		SkeletonPtr GetSkeleton() const noexcept { return _skeleton; }
+
+		/* @brief : Bind pose vertices of the total mesh for the CPU skinning (nullptr : no skin)*/
+		SkinningSourcePtr GetSkinningSource() const noexcept { return _skinningSource; }
+
 		void SetDebugColor(const gm::Float4& color) { _debugColor = color; }
 
+		/* @brief : Mesh processing applied by the next Load*/
+		const MeshOptimizeSettings& GetMeshOptimizeSettings() const noexcept { return _meshOptimizeSettings; }
+
+		void SetMeshOptimizeSettings(const MeshOptimizeSettings& settings) { _meshOptimizeSettings = settings; }
+
+		/* @brief : ACMR / ATVR / meshlet statistics of the last Load*/
+		const MeshOptimizeStatistics& GetMeshOptimizeStatistics() const noexcept { return _meshOptimizeStatistics; }
+
+		/* @brief : Vertex buffer format requested for the next model file Load.
+		            Changing it does not convert the vertex buffer which is already loaded.*/
+		ModelVertexFormat GetVertexFormat() const noexcept { return _vertexFormat; }
+
+		void SetVertexFormat(const ModelVertexFormat format) { _vertexFormat = format; }
+
+		/* @brief : Format of the current vertex buffer. The passes select the pipeline by this format.
+		            The primitive meshes are always ModelVertexFormat::Full.*/
+		ModelVertexFormat GetLoadedVertexFormat() const noexcept { return _loadedVertexFormat; }
+
+		/* @brief : Memory and the quantization error of the last Load (zero : the full format)*/
+		const VertexCompressionStatistics& GetVertexCompressionStatistics() const noexcept { return _vertexCompressionStatistics; }
+
+		/* @brief : Level of detail chain generated by the next Load*/
+		const MeshLODSettings& GetMeshLODSettings() const noexcept { return _meshLODSettings; }
+
+		void SetMeshLODSettings(const MeshLODSettings& settings) { _meshLODSettings = settings; }
+
+		/* @brief : Level of detail count including LOD0*/
+		gu::uint32 GetLODCount() const noexcept { return _lodErrors.IsEmpty() ? 1 : static_cast<gu::uint32>(_lodErrors.Size()); }
+
+		/* @brief : Level selected by the last SelectLOD of the view*/
+		gu::uint32 GetLODLevel(const LODViewType view) const noexcept { return _lodLevels[static_cast<gu::uint32>(view)]; }
+
+		/* @brief : Object space geometric error of the level*/
+		float GetLODError(const gu::uint32 level) const noexcept { return level < _lodErrors.Size() ? _lodErrors[level] : 0.0f; }
+
+		/* @brief : World space bounding sphere of the current transform (radius 0 : the bounds are unknown).
+		            worldScale (nullable) receives the largest axis scale of the transform.*/
+		void GetWorldBoundingSphere(gm::Float3& center, float& radius, float* worldScale = nullptr) const;
+
+		/* @brief : Triangle count submitted by a draw of the level*/
+		gu::uint32 GetTriangleCount(const gu::uint32 level = 0) const noexcept 
+		{ 
+			return _lodTriangleCounts.IsEmpty() ? 0 : _lodTriangleCounts[level < _lodTriangleCounts.Size() ? level : _lodTriangleCounts.Size() - 1]; 
+		}
+
 		/****************************************************************************
 		**                Constructor and Destructor
 		*****************************************************************************/
@@ -84,9 +150,20 @@ namespace gc::core
 		/****************************************************************************
 		**                Protected Function
 		*****************************************************************************/
-		virtual void DrawWithMaterials(const std::uint32_t materialOffsetID);
+		virtual void DrawWithMaterials(const std::uint32_t materialOffsetID, const gu::uint32 lodLevel = 0);
 
-		virtual void DrawWithoutMaterial();
+		virtual void DrawWithoutMaterial(const gu::uint32 lodLevel = 0);
+
+		/* @brief : Generate the level of detail chain with _meshLODSettings, keep the errors and the bounding sphere.
+		            The indices of LOD1 or later are appended to lodIndices (store them after indices in the index buffer).*/
+		gu::DynamicArray<MeshLODLevel> PrepareLODs(gu::DynamicArray<gu::uint32>& lodIndices,
+			const gu::uint32* indices, const gu::uint32 indexCount,
+			const gu::uint32* subMeshIndexCounts, const gu::uint32 subMeshCount,
+			const void* vertices, const gu::uint32 vertexCount, const MeshSimplifyVertexLayout& layout,
+			const bool* lockedVertices = nullptr);
+
+		/* @brief : Set the index ranges of the levels to the total mesh and each material mesh*/
+		void ApplyLODs(const gu::DynamicArray<MeshLODLevel>& levels);
 
 		/****************************************************************************
 		**                Protected Member Variables
@@ -104,6 +181,29 @@ namespace gc::core
 		/* @brief : total mesh (ignore material)*/
 		MeshPtr _totalMesh = nullptr;
 
+		MeshOptimizeSettings   _meshOptimizeSettings   = {};
+		MeshOptimizeStatistics _meshOptimizeStatistics = {};
+
+		ModelVertexFormat           _vertexFormat                = ModelVertexFormat::Full; // requested
+		ModelVertexFormat           _loadedVertexFormat          = ModelVertexFormat::Full; // set by Load
+		VertexCompressionStatistics _vertexCompressionStatistics = {};
+
+		/*-------------------------------------------------------------------
+		-            Level of detail
+		---------------------------------------------------------------------*/
+		MeshLODSettings _meshLODSettings = {};
+
+		/* @brief : Object space error and triangle count of each level (empty : LOD0 only)*/
+		gu::DynamicArray<float>      _lodErrors         = {};
+		gu::DynamicArray<gu::uint32> _lodTriangleCounts = {};
+
+		/* @brief : Object space bounding sphere used by the LOD selection*/
+		gm::Float3 _boundingCenter = gm::Float3(0.0f, 0.0f, 0.0f);
+		float      _boundingRadius = 0.0f;
+
+		/* @brief : Selected level of each view*/
+		gu::uint32 _lodLevels[static_cast<gu::uint32>(LODViewType::CountOf)] = {};
+
 		/*-------------------------------------------------------------------
 		-            Material
 		---------------------------------------------------------------------*/
@@ -120,6 +220,9 @@ namespace gc::core
 		/* @brief : Uses skin mesh model (true: Has skin mesh , false : Doesn't have skin mesh)*/
 		bool _hasSkin = false;
 
+		SkeletonPtr       _skeleton       = nullptr;
+		SkinningSourcePtr _skinningSource = nullptr;
+
 	private:
 		void PrepareGameWorldBuffer(); 
 
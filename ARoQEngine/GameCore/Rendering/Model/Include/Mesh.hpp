@@ -29,6 +29,7 @@ class LowLevelGraphicsEngine;
 namespace gc::core
 {
 	struct PrimitiveMesh;
+	struct MeshletData;
 	class  Material;
 	/****************************************************************************
 	*				  			Mesh
@@ -42,12 +43,46 @@ namespace gc::core
 		using VertexBufferPtr  = BufferPtr;
 		using IndexBufferPtr   = BufferPtr;
 		using MaterialPtr      = gu::SharedPointer<Material>;
+		using MeshletDataPtr   = gu::SharedPointer<MeshletData>;
 	public:
+		/****************************************************************************
+		**                Public Struct
+		*****************************************************************************/
+		/*----------------------------------------------------------------------
+		*  @brief : Structured buffers read by the mesh shader (created only when the device supports mesh shading)
+		/*----------------------------------------------------------------------*/
+		struct MeshletBuffers
+		{
+			BufferPtr Meshlets      = nullptr; // Meshlet
+			BufferPtr Bounds        = nullptr; // MeshletBounds
+			BufferPtr VertexIndices = nullptr; // uint32
+			BufferPtr Triangles     = nullptr; // uint32 (i0 | i1 << 8 | i2 << 16)
+		};
+
+		/*----------------------------------------------------------------------
+		*  @brief : Index range of one level of detail in the shared index buffer
+		/*----------------------------------------------------------------------*/
+		struct LODRange
+		{
+			gu::uint32 IndexOffset = 0;
+			gu::uint32 IndexCount  = 0;
+		};
+
 		/****************************************************************************
 		**                Public Function
 		*****************************************************************************/
+		/* @brief : Draw the index range of the lodLevel (clamped to the coarsest level)*/
 		virtual void Draw(const gu::SharedPointer<rhi::core::RHICommandList>& graphicsCommandList, 
-			const std::uint32_t frameIndex);
+			const std::uint32_t frameIndex, const gu::uint32 lodLevel = 0);
+
+		/* @brief : Keep the meshlets of the whole mesh and upload them when the device supports mesh shading*/
+		void PrepareMeshlets(const MeshletDataPtr& meshlets, const gu::tstring& name = SP(""));
+
+		/* @brief : Share the meshlets of the total mesh. This mesh uses [meshletOffset, meshletOffset + meshletCount).*/
+		void SetMeshlets(const MeshletDataPtr& meshlets, const MeshletBuffers& buffers, const gu::uint32 meshletOffset, const gu::uint32 meshletCount);
+
+		/* @brief : Set the index ranges of the levels of detail. lods[0] replaces the index range of LOD0.*/
+		void SetLODs(const gu::DynamicArray<LODRange>& lods);
 
 		/****************************************************************************
 		**                Public Member Variables
@@ -60,6 +95,26 @@ namespace gc::core
 
 		void SetMaterial(const MaterialPtr& material) { _material = material; }
 
+		/* @brief : CPU meshlet data (nullptr : the mesh was not split into meshlets)*/
+		MeshletDataPtr GetMeshlets() const noexcept { return _meshlets; }
+
+		const MeshletBuffers& GetMeshletBuffers() const noexcept { return _meshletBuffers; }
+
+		gu::uint32 GetMeshletOffset() const noexcept { return _meshletOffset; }
+
+		gu::uint32 GetMeshletCount() const noexcept { return _meshletCount; }
+
+		bool HasMeshlets() const noexcept { return _meshletCount > 0; }
+
+		/* @brief : Level of detail count including LOD0*/
+		gu::uint32 GetLODCount() const noexcept { return _lods.IsEmpty() ? 1 : static_cast<gu::uint32>(_lods.Size()); }
+
+		gu::uint32 GetIndexCount(const gu::uint32 lodLevel = 0) const noexcept
+		{
+			if (lodLevel == 0 || _lods.IsEmpty()) { return static_cast<gu::uint32>(_indexCount); }
+			return _lods[lodLevel < GetLODCount() ? lodLevel : GetLODCount() - 1].IndexCount;
+		}
+
 		/****************************************************************************
 		**                Constructor and Destructor
 		*****************************************************************************/
@@ -112,6 +167,22 @@ namespace gc::core
 
 		bool _hasCreatedNewBuffer = false;
 
+		/*-------------------------------------------------------------------
+		-            Meshlet
+		---------------------------------------------------------------------*/
+		MeshletDataPtr _meshlets = nullptr;
+
+		MeshletBuffers _meshletBuffers = {};
+
+		/* @brief : Meshlet range of this mesh in _meshlets*/
+		gu::uint32 _meshletOffset = 0;
+		gu::uint32 _meshletCount  = 0;
+
+		/*-------------------------------------------------------------------
+		-            Level of detail
+		---------------------------------------------------------------------*/
+		/* @brief : Index ranges of the levels (empty : LOD0 only)*/
+		gu::DynamicArray<LODRange> _lods = {};
 	};
 }
 
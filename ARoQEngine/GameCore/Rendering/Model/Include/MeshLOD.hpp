@@ -0,0 +1,155 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   MeshLOD.hpp
+///             @brief  Level of detail description of a mesh and the screen space LOD selection.
+///                     The LOD chain is generated on import by MeshSimplifier. Every level keeps the vertex buffer of LOD0,
+///                     only the index range changes, so switching the level costs nothing on the GPU side.
+///             How To: Call GameModel::SelectLOD for each view (main camera, each shadow cascade) once a frame,
+///                     then GameModel::Draw with the same LODViewType.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef MESH_LOD_HPP
+#define MESH_LOD_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/Base/Include/GUClassUtility.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+#include "GameUtility/Math/Include/GMVector.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace gc::core
+{
+	/****************************************************************************
+	*				  			LODViewType
+	*************************************************************************//**
+	*  @enum      LODViewType
+	*  @brief     Views which keep their own LOD level (with their own hysteresis)
+	*****************************************************************************/
+	enum class LODViewType : gu::uint32
+	{
+		Main,
+		ShadowCascade0,
+		ShadowCascade1,
+		ShadowCascade2,
+		CountOf
+	};
+
+	/****************************************************************************
+	*				  			MeshLODSettings
+	*************************************************************************//**
+	*  @struct    MeshLODSettings
+	*  @brief     LOD chain generated on import. Errors are relative to the largest extent of the mesh bounding box.
+	*****************************************************************************/
+	struct MeshLODSettings
+	{
+		/* @brief : Level count including LOD0 (1 : no LOD)*/
+		gu::uint32 MaxLODCount = 4;
+
+		/* @brief : Target triangle ratio of a level to the previous level*/
+		float ReductionRatio = 0.5f;
+
+		/* @brief : Geometric error allowed for the coarsest level (0.05 : 5% of the mesh extent).
+		           The level i is allowed MaxError x ReductionRatio^(MaxLODCount - 1 - i).*/
+		float MaxError = 0.05f;
+
+		/* @brief : The chain ends when a level keeps more than this ratio of the previous level triangles*/
+		float StopRatio = 0.9f;
+
+		/*-------------------------------------------------------------------
+		-   Attribute penalties. A collapse which changes the attribute by 1 costs the same as a geometric error of the weight.
+		---------------------------------------------------------------------*/
+		float NormalWeight = 0.01f;
+		float UVWeight     = 0.01f;
+
+		/* @brief : Applied to the total variation distance of the bone weights ([0, 1])*/
+		float SkinWeight   = 0.05f;
+	};
+
+	/****************************************************************************
+	*				  			MeshLODLevel
+	*************************************************************************//**
+	*  @struct    MeshLODLevel
+	*  @brief     Index range of one level. The sub meshes of a level are stored one after another.
+	*****************************************************************************/
+	struct MeshLODLevel
+	{
+		/* @brief : First index of the level in the index buffer*/
+		gu::uint32 IndexOffset = 0;
+
+		/* @brief : Index count of all sub meshes*/
+		gu::uint32 IndexCount  = 0;
+
+		/* @brief : Object space deviation from LOD0*/
+		float      Error       = 0.0f;
+
+		gu::DynamicArray<gu::uint32> SubMeshIndexCounts = {};
+	};
+
+	/****************************************************************************
+	*				  			LODView
+	*************************************************************************//**
+	*  @struct    LODView
+	*  @brief     Projection of a view used by the LOD selection.
+	*             PixelScale == 0 selects LOD0 for every object.
+	*****************************************************************************/
+	struct LODView
+	{
+		gm::Float3 Position = { 0.0f, 0.0f, 0.0f };
+
+		/* @brief : Perspective : viewport height / (2 tan(fovVertical / 2)), Orthographic : pixels per world unit*/
+		float PixelScale = 0.0f;
+
+		bool IsOrthographic = false;
+
+		/* @brief : Projected error of the selected level is kept below this value (pixels)*/
+		float PixelErrorThreshold = 1.0f;
+
+		/* @brief : A coarser level is taken below (1 - Hysteresis) x threshold, the current level is kept up to (1 + Hysteresis) x threshold*/
+		float Hysteresis = 0.15f;
+
+		/* @brief : Objects whose bounding sphere is smaller than this radius (pixels) use the coarsest level*/
+		float MinScreenRadius = 2.0f;
+
+		/* @brief : fovVertical is radian*/
+		static LODView Perspective(const gm::Float3& position, const float fovVertical, const float viewportHeight, const float pixelErrorThreshold = 1.0f);
+
+		static LODView Orthographic(const float pixelsPerUnit, const float pixelErrorThreshold = 1.0f);
+	};
+
+	/****************************************************************************
+	*				  			LODSelector
+	*************************************************************************//**
+	*  @class     LODSelector
+	*  @brief     Select the coarsest level whose projected error stays below the pixel threshold
+	*****************************************************************************/
+	class LODSelector : public gu::NonCopyAndMove
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/*----------------------------------------------------------------------
+		*  @brief : Return the level to draw.
+		*           errors       : object space error of each level (errors[0] is LOD0), increasing
+		*           worldScale   : object to world scale applied to the errors
+		*           currentLevel : level selected by the previous frame for the hysteresis
+		/*----------------------------------------------------------------------*/
+		static gu::uint32 Select(const LODView& view, const gm::Float3& center, const float radius,
+			const float* errors, const gu::uint32 levelCount, const float worldScale, const gu::uint32 currentLevel);
+
+		/* @brief : Pixels per world unit at the nearest point of the bounding sphere (FLT_MAX : the view is inside the sphere)*/
+		static float ComputePixelsPerUnit(const LODView& view, const gm::Float3& center, const float radius);
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		LODSelector() = default;
+	};
+}
+
+#endif
@@ -0,0 +1,284 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   MeshOptimizer.hpp
+///             @brief  Offline mesh processing run on model import.
+///                     1. Vertex deduplication     : merge byte-identical vertices
+///                     2. Vertex cache optimization: reorder triangles for post-transform cache hits (Forsyth)
+///                     3. Overdraw optimization    : reorder the cache friendly triangle clusters from the outside in (Sander et al.)
+///                     4. Vertex fetch remapping   : reorder vertices in the first use order of the index buffer
+///                     5. Meshlet building         : split triangles into clusters (<= 64 vertices, <= 124 triangles) with bounding cones
+///             How To: Call MeshOptimizer::Optimize with the vertex array, the index array and the index count of each sub mesh (material).
+///                     The triangle count of each sub mesh is kept, so the index offsets of the materials stay valid.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef MESH_OPTIMIZER_HPP
+#define MESH_OPTIMIZER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/Base/Include/GUClassUtility.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+#include "GameUtility/Math/Include/GMVector.hpp"
+#include <cstddef>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace gc::core
+{
+	/****************************************************************************
+	*				  			Meshlet
+	*************************************************************************//**
+	*  @struct    Meshlet
+	*  @brief     Triangle cluster processed by one mesh shader thread group
+	*****************************************************************************/
+	struct Meshlet
+	{
+		gu::uint32 VertexOffset   = 0; // first element in MeshletData::VertexIndices
+		gu::uint32 TriangleOffset = 0; // first element in MeshletData::Triangles
+		gu::uint32 VertexCount    = 0;
+		gu::uint32 TriangleCount  = 0;
+	};
+
+	/****************************************************************************
+	*				  			MeshletBounds
+	*************************************************************************//**
+	*  @struct    MeshletBounds
+	*  @brief     Bounding sphere and normal cone of the meshlet.
+	*             All triangles face away from the camera when dot(normalize(ConeApex - cameraPosition), ConeAxis) >= ConeCutoff.
+	*             ConeCutoff is 1 when the normals spread too much to cull by the cone.
+	*****************************************************************************/
+	struct MeshletBounds
+	{
+		gm::Float3 Center     = { 0.0f, 0.0f, 0.0f };
+		float      Radius     = 0.0f;
+		gm::Float3 ConeApex   = { 0.0f, 0.0f, 0.0f };
+		float      ConeCutoff = 1.0f; // sin of the half angle of the back facing cone
+		gm::Float3 ConeAxis   = { 0.0f, 0.0f, 0.0f };
+		float      Padding    = 0.0f;
+
+		/* @brief : Whether the meshlet can be culled by the normal cone*/
+		bool HasCone() const noexcept { return ConeCutoff < 1.0f; }
+
+		/* @brief : Return true when every triangle faces away from the camera*/
+		bool IsBackFacing(const gm::Float3& cameraPosition) const noexcept;
+	};
+
+	/****************************************************************************
+	*				  			MeshletData
+	*************************************************************************//**
+	*  @struct    MeshletData
+	*  @brief     Meshlets of all sub meshes.
+	*             Sub mesh i uses the meshlets [SubMeshOffsets[i], SubMeshOffsets[i + 1]).
+	*****************************************************************************/
+	struct MeshletData
+	{
+		gu::DynamicArray<Meshlet>       Meshlets       = {};
+		gu::DynamicArray<MeshletBounds> Bounds         = {};
+
+		/* @brief : Vertex buffer index of each meshlet vertex*/
+		gu::DynamicArray<gu::uint32>    VertexIndices  = {};
+
+		/* @brief : One triangle per element. Meshlet local vertex index i0 | i1 << 8 | i2 << 16*/
+		gu::DynamicArray<gu::uint32>    Triangles      = {};
+
+		/* @brief : Size is sub mesh count + 1*/
+		gu::DynamicArray<gu::uint32>    SubMeshOffsets = {};
+
+		void Clear()
+		{
+			Meshlets      .Clear();
+			Bounds        .Clear();
+			VertexIndices .Clear();
+			Triangles     .Clear();
+			SubMeshOffsets.Clear();
+		}
+	};
+
+	/****************************************************************************
+	*				  			MeshOptimizeSettings
+	*************************************************************************//**
+	*  @struct    MeshOptimizeSettings
+	*  @brief     Steps executed by MeshOptimizer::Optimize
+	*****************************************************************************/
+	struct MeshOptimizeSettings
+	{
+		bool Deduplicate         = true;
+		bool OptimizeVertexCache = true;
+		bool OptimizeOverdraw    = true;
+		bool OptimizeVertexFetch = true;
+		bool BuildMeshlets       = true;
+
+		/* @brief : Allowed ACMR growth of the overdraw reordering (1.05 : 5% more vertex shader invocations)*/
+		float OverdrawThreshold = 1.05f;
+
+		gu::uint32 MaxMeshletVertices  = 64;
+		gu::uint32 MaxMeshletTriangles = 124;
+
+		/* @brief : [0, 1] Higher values keep the normals of a meshlet closer (tighter cones, slightly more meshlets)*/
+		float MeshletConeWeight = 0.25f;
+	};
+
+	/****************************************************************************
+	*				  			VertexCacheStatistics
+	*************************************************************************//**
+	*  @struct    VertexCacheStatistics
+	*  @brief     Post-transform cache simulation with a FIFO cache
+	*****************************************************************************/
+	struct VertexCacheStatistics
+	{
+		gu::uint32 VertexTransformCount = 0; // cache misses
+
+		/* @brief : Average cache miss ratio : transformed vertices per triangle (0.5 is the ideal for a large grid, 3.0 is the worst)*/
+		float ACMR = 0.0f;
+
+		/* @brief : Average transform to vertex ratio : transformed vertices per referenced vertex (1.0 is the ideal)*/
+		float ATVR = 0.0f;
+	};
+
+	/****************************************************************************
+	*				  			VertexFetchStatistics
+	*************************************************************************//**
+	*  @struct    VertexFetchStatistics
+	*  @brief     Vertex fetch simulation with a direct mapped cache of 64 byte lines
+	*****************************************************************************/
+	struct VertexFetchStatistics
+	{
+		gu::uint64 BytesFetched = 0;
+
+		/* @brief : Fetched bytes / referenced vertex bytes (1.0 is the ideal)*/
+		float Overfetch = 0.0f;
+	};
+
+	/****************************************************************************
+	*				  			MeshletStatistics
+	*************************************************************************//**
+	*  @struct    MeshletStatistics
+	*  @brief     Meshlet occupancy and cone quality
+	*****************************************************************************/
+	struct MeshletStatistics
+	{
+		gu::uint32 MeshletCount  = 0;
+		gu::uint32 TriangleCount = 0;
+
+		float AverageVertexCount   = 0.0f;
+		float AverageTriangleCount = 0.0f;
+
+		/* @brief : Meshlet vertices / unique vertices. Vertices shared by meshlets are transformed once per meshlet.*/
+		float VertexDuplication = 0.0f;
+
+		/* @brief : Ratio of the meshlets which have the cone*/
+		float ConeRatio = 0.0f;
+	};
+
+	/****************************************************************************
+	*				  			MeshOptimizeStatistics
+	*************************************************************************//**
+	*  @struct    MeshOptimizeStatistics
+	*  @brief     Statistics before and after MeshOptimizer::Optimize
+	*****************************************************************************/
+	struct MeshOptimizeStatistics
+	{
+		gu::uint32 VertexCountBefore = 0;
+		gu::uint32 VertexCountAfter  = 0;
+
+		VertexCacheStatistics CacheBefore = {};
+		VertexCacheStatistics CacheAfter  = {};
+
+		VertexFetchStatistics FetchBefore = {};
+		VertexFetchStatistics FetchAfter  = {};
+
+		MeshletStatistics Meshlets = {};
+	};
+
+	/****************************************************************************
+	*				  			MeshOptimizer
+	*************************************************************************//**
+	*  @class     MeshOptimizer
+	*  @brief     CPU mesh processing. Triangle lists with 32 bit indices.
+	*             The vertex format is free; the functions take the vertex stride and read the position (3 floats) at positionOffset.
+	*****************************************************************************/
+	class MeshOptimizer : public gu::NonCopyAndMove
+	{
+	public:
+		/****************************************************************************
+		**                Static Configuration
+		*****************************************************************************/
+		static constexpr gu::uint32 INVALID_INDEX = 0xFFFFFFFF;
+
+		static constexpr gu::uint32 MAX_MESHLET_VERTICES  = 256;
+		static constexpr gu::uint32 MAX_MESHLET_TRIANGLES = 512;
+
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/*----------------------------------------------------------------------
+		*  @brief : Run the steps enabled in the settings.
+		*           The vertices are compacted to the front of the array and the new vertex count is returned.
+		*           subMeshIndexCounts : index count of each sub mesh (nullptr : one sub mesh)
+		*           vertexRemap        : [out] old vertex -> new vertex (INVALID_INDEX : removed), size vertexCount
+		*           lockedVertices     : vertices never merged by the deduplication (e.g. referenced by morphs), size vertexCount
+		/*----------------------------------------------------------------------*/
+		static gu::uint32 Optimize(void* vertices, const gu::uint32 vertexCount, const gu::uint32 vertexStride, const gu::uint32 positionOffset,
+			gu::uint32* indices, const gu::uint32 indexCount,
+			const gu::uint32* subMeshIndexCounts, const gu::uint32 subMeshCount,
+			const MeshOptimizeSettings& settings = {},
+			MeshletData* meshlets = nullptr, MeshOptimizeStatistics* statistics = nullptr,
+			gu::uint32* vertexRemap = nullptr, const bool* lockedVertices = nullptr);
+
+		template<class TVertex>
+		static gu::uint32 Optimize(TVertex* vertices, const gu::uint32 vertexCount, gu::uint32* indices, const gu::uint32 indexCount,
+			const gu::uint32* subMeshIndexCounts, const gu::uint32 subMeshCount,
+			const MeshOptimizeSettings& settings = {},
+			MeshletData* meshlets = nullptr, MeshOptimizeStatistics* statistics = nullptr,
+			gu::uint32* vertexRemap = nullptr, const bool* lockedVertices = nullptr)
+		{
+			return Optimize(static_cast<void*>(vertices), vertexCount, sizeof(TVertex), offsetof(TVertex, Position),
+				indices, indexCount, subMeshIndexCounts, subMeshCount, settings, meshlets, statistics, vertexRemap, lockedVertices);
+		}
+
+		/*----------------------------------------------------------------------
+		*  @brief : 1. Map byte-identical vertices to one vertex in the first use order and return the unique vertex count.
+		*           Unreferenced vertices are INVALID_INDEX. indices == nullptr means an unindexed vertex array.
+		/*----------------------------------------------------------------------*/
+		static gu::uint32 GenerateVertexRemap(gu::uint32* remap, const gu::uint32* indices, const gu::uint32 indexCount,
+			const void* vertices, const gu::uint32 vertexCount, const gu::uint32 vertexStride, const bool* lockedVertices = nullptr);
+
+		static void RemapIndexBuffer(gu::uint32* destination, const gu::uint32* indices, const gu::uint32 indexCount, const gu::uint32* remap);
+
+		static void RemapVertexBuffer(void* destination, const void* vertices, const gu::uint32 vertexCount, const gu::uint32 vertexStride, const gu::uint32* remap);
+
+		/* @brief : 2. Reorder the triangles for the post-transform vertex cache. destination may be indices.*/
+		static void OptimizeVertexCache(gu::uint32* destination, const gu::uint32* indices, const gu::uint32 indexCount, const gu::uint32 vertexCount);
+
+		/* @brief : 3. Reorder the clusters of the cache optimized triangles to reduce the overdraw. Call after OptimizeVertexCache. destination may be indices.*/
+		static void OptimizeOverdraw(gu::uint32* destination, const gu::uint32* indices, const gu::uint32 indexCount,
+			const void* vertices, const gu::uint32 vertexCount, const gu::uint32 vertexStride, const gu::uint32 positionOffset, const float threshold = 1.05f);
+
+		/* @brief : 4. Generate the remap which orders the vertices by their first use. Returns the referenced vertex count.*/
+		static gu::uint32 GenerateVertexFetchRemap(gu::uint32* remap, const gu::uint32* indices, const gu::uint32 indexCount, const gu::uint32 vertexCount);
+
+		/* @brief : 5. Append the meshlets of the triangles to meshlets (SubMeshOffsets is not changed). Returns the added meshlet count.*/
+		static gu::uint32 BuildMeshlets(MeshletData& meshlets, const gu::uint32* indices, const gu::uint32 indexCount,
+			const void* vertices, const gu::uint32 vertexCount, const gu::uint32 vertexStride, const gu::uint32 positionOffset,
+			const gu::uint32 maxVertices = 64, const gu::uint32 maxTriangles = 124, const float coneWeight = 0.25f);
+
+		/*----------------------------------------------------------------------
+		*  @brief : Analysis
+		/*----------------------------------------------------------------------*/
+		static VertexCacheStatistics AnalyzeVertexCache(const gu::uint32* indices, const gu::uint32 indexCount, const gu::uint32 vertexCount, const gu::uint32 cacheSize = 16);
+
+		static VertexFetchStatistics AnalyzeVertexFetch(const gu::uint32* indices, const gu::uint32 indexCount, const gu::uint32 vertexCount, const gu::uint32 vertexStride);
+
+		static MeshletStatistics AnalyzeMeshlets(const MeshletData& meshlets, const gu::uint32 uniqueVertexCount);
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		MeshOptimizer() = default;
+	};
+}
+
+#endif
@@ -0,0 +1,108 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   MeshSimplifier.hpp
+///             @brief  Quadric error edge collapse simplification and the LOD chain generation run on model import.
+///                     The collapses move a vertex onto one of its neighbors, so the simplified index buffers reuse the vertex buffer.
+///                     - Attribute seams (vertices sharing a position) collapse only along the seam, both sides at once
+///                     - Open borders collapse only along the border
+///                     - Normal, UV and bone weight differences are added to the quadric error
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef MESH_SIMPLIFIER_HPP
+#define MESH_SIMPLIFIER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "MeshLOD.hpp"
+#include <cstddef>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace gc::core
+{
+	/****************************************************************************
+	*				  			MeshSimplifyVertexLayout
+	*************************************************************************//**
+	*  @struct    MeshSimplifyVertexLayout
+	*  @brief     Byte offsets of the vertex members read by the simplifier (INVALID_OFFSET : not used)
+	*****************************************************************************/
+	struct MeshSimplifyVertexLayout
+	{
+		static constexpr gu::uint32 INVALID_OFFSET = 0xFFFFFFFF;
+
+		gu::uint32 Stride           = 0;
+		gu::uint32 PositionOffset   = 0;              // float3
+		gu::uint32 NormalOffset     = INVALID_OFFSET; // float3
+		gu::uint32 UVOffset         = INVALID_OFFSET; // float2
+		gu::uint32 BoneIndexOffset  = INVALID_OFFSET; // int[4]
+		gu::uint32 BoneWeightOffset = INVALID_OFFSET; // float[4]
+
+		/* @brief : Layout of a vertex struct. Position is required, Normal, UV, BoneIndices and BoneWeights are used when they exist.*/
+		template<class TVertex>
+		static MeshSimplifyVertexLayout Create()
+		{
+			MeshSimplifyVertexLayout layout = {};
+			layout.Stride         = sizeof(TVertex);
+			layout.PositionOffset = offsetof(TVertex, Position);
+			if constexpr (requires { &TVertex::Normal; })      { layout.NormalOffset     = offsetof(TVertex, Normal); }
+			if constexpr (requires { &TVertex::UV; })          { layout.UVOffset         = offsetof(TVertex, UV); }
+			if constexpr (requires { &TVertex::BoneIndices; }) { layout.BoneIndexOffset  = offsetof(TVertex, BoneIndices); }
+			if constexpr (requires { &TVertex::BoneWeights; }) { layout.BoneWeightOffset = offsetof(TVertex, BoneWeights); }
+			return layout;
+		}
+	};
+
+	/****************************************************************************
+	*				  			MeshSimplifier
+	*************************************************************************//**
+	*  @class     MeshSimplifier
+	*  @brief     CPU mesh simplification. Triangle lists with 32 bit indices.
+	*****************************************************************************/
+	class MeshSimplifier : public gu::NonCopyAndMove
+	{
+	public:
+		/****************************************************************************
+		**                Static Configuration
+		*****************************************************************************/
+		static constexpr gu::uint32 INVALID_INDEX = 0xFFFFFFFF;
+
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/*----------------------------------------------------------------------
+		*  @brief : Reduce the triangles until the index count reaches targetIndexCount or the error reaches targetError.
+		*           Returns the index count written to destination (destination may be indices, the size must be indexCount).
+		*           targetError and resultError are relative to the largest extent of the vertex bounding box.
+		*           lockedVertices : vertices never moved (e.g. referenced by morphs), size vertexCount
+		/*----------------------------------------------------------------------*/
+		static gu::uint32 Simplify(gu::uint32* destination, const gu::uint32* indices, const gu::uint32 indexCount,
+			const void* vertices, const gu::uint32 vertexCount, const MeshSimplifyVertexLayout& layout,
+			const gu::uint32 targetIndexCount, const float targetError, const MeshLODSettings& settings = {},
+			const bool* lockedVertices = nullptr, float* resultError = nullptr);
+
+		/*----------------------------------------------------------------------
+		*  @brief : Generate the LOD chain of the sub meshes. Each level is simplified from the previous one.
+		*           The indices of LOD1 or later are appended to lodIndices. The level i starts at levels[i].IndexOffset
+		*           in the index buffer made of indices followed by lodIndices. levels[0] is the input.
+		*           The positions shared by several sub meshes are locked so that the sub meshes stay connected.
+		/*----------------------------------------------------------------------*/
+		static gu::DynamicArray<MeshLODLevel> GenerateLODs(gu::DynamicArray<gu::uint32>& lodIndices,
+			const gu::uint32* indices, const gu::uint32 indexCount,
+			const gu::uint32* subMeshIndexCounts, const gu::uint32 subMeshCount,
+			const void* vertices, const gu::uint32 vertexCount, const MeshSimplifyVertexLayout& layout,
+			const MeshLODSettings& settings = {}, const bool* lockedVertices = nullptr);
+
+		/* @brief : Largest extent of the vertex bounding box. Multiply the relative errors by this value to get the object space errors.*/
+		static float ComputeScale(const void* vertices, const gu::uint32 vertexCount, const MeshSimplifyVertexLayout& layout);
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		MeshSimplifier() = default;
+	};
+}
+
+#endif
@@ -0,0 +1,94 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   VertexCompression.hpp
+///             @brief  Compressed vertex formats selected on model import.
+///                     - gm::Vertex (48 byte)         -> gm::CompressedVertex (24 byte)
+///                     - gm::SkinMeshVertex (64 byte) -> gm::CompressedSkinMeshVertex (32 byte)
+///                     Position stays float32, the normal is octahedral SNORM16x2, the uv is half2,
+///                     the color and the bone weights are UNORM8x4 and the bone indices are uint16.
+///             How To: GameModel::SetVertexFormat(ModelVertexFormat::Compressed) before Load.
+///                     The passes draw the compressed models with the USE_COMPRESSED_VERTEX shaders
+///                     and GPUInputAssemblyState::GetCompressedSkinVertexElement.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef VERTEX_COMPRESSION_HPP
+#define VERTEX_COMPRESSION_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/Base/Include/GUClassUtility.hpp"
+#include "GameUtility/Math/Include/GMVertex.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace gc::core
+{
+	/****************************************************************************
+	*				  			ModelVertexFormat
+	*************************************************************************//**
+	*  @enum      ModelVertexFormat
+	*  @brief     Vertex buffer format of the imported model
+	*****************************************************************************/
+	enum class ModelVertexFormat : gu::uint8
+	{
+		Full,       // gm::SkinMeshVertex (float32)
+		Compressed, // gm::CompressedSkinMeshVertex
+	};
+
+	/****************************************************************************
+	*				  			VertexCompressionStatistics
+	*************************************************************************//**
+	*  @struct    VertexCompressionStatistics
+	*  @brief     Memory and the quantization error of the compression
+	*****************************************************************************/
+	struct VertexCompressionStatistics
+	{
+		gu::uint32 VertexCount = 0;
+
+		gu::uint64 BytesBefore = 0;
+		gu::uint64 BytesAfter  = 0;
+
+		/* @brief : Largest angle between the normalized input normal and the decoded normal*/
+		float MaxNormalErrorDegree = 0.0f;
+
+		/* @brief : Largest |uv - half(uv)|. UVs far from [0, 1] lose precision (half has 11 significant bits).*/
+		float MaxUVError = 0.0f;
+
+		/* @brief : Largest |normalized weight - weight / 255|*/
+		float MaxBoneWeightError = 0.0f;
+
+		/* @brief : Bone indices which do not fit in uint16 (clamped to 0)*/
+		gu::uint32 BoneIndexOverflowCount = 0;
+	};
+
+	/****************************************************************************
+	*				  			VertexCompressor
+	*************************************************************************//**
+	*  @class     VertexCompressor
+	*  @brief     Convert the float vertices to the compressed vertices by gm::VectorPack.
+	*             Negative bone indices (no bone) become 0, whose weight is 0.
+	*****************************************************************************/
+	class VertexCompressor : public gu::NonCopyAndMove
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Compress the vertices. statistics (nullable) also measures the error by decoding the result.*/
+		static void Compress(gm::CompressedVertex* destination, const gm::Vertex* vertices, const gu::uint32 vertexCount,
+			VertexCompressionStatistics* statistics = nullptr);
+
+		static void Compress(gm::CompressedSkinMeshVertex* destination, const gm::SkinMeshVertex* vertices, const gu::uint32 vertexCount,
+			VertexCompressionStatistics* statistics = nullptr);
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		VertexCompressor() = default;
+	};
+}
+
+#endif
@@ -12,12 +12,17 @@
 #include "../Include/PrimitiveMesh.hpp"
 #include "../Include/Mesh.hpp"
 #include "../Include/Material.hpp"
+#include "../../Animation/Include/CPUSkinning.hpp"
 #include "../../../Core/Include/GameWorldInfo.hpp"
 #include "../External/MMD/Include/MMDModelConverter.hpp"
 #include "../External/GLTF/Public/Include/GLTFModelConverter.hpp"
 #include "GraphicsCore/Engine/Include/LowLevelGraphicsEngine.hpp"
 #include "GameUtility/File/Include/FileSystem.hpp"
+#include "GameUtility/Memory/Include/GUMemoryTracker.hpp"
 #include <iostream>
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
@@ -91,9 +96,32 @@ void GameModel::Load(const PrimitiveMeshType type, const MaterialPtr& material)
         }
     }
 
+    /*-------------------------------------------------------------------
+    -              Reorder for the vertex cache, the overdraw and the vertex fetch
+    ---------------------------------------------------------------------*/
+    const auto meshlets = gu::MakeShared<MeshletData>();
+    const auto vertexCount = MeshOptimizer::Optimize(primitiveMesh.Vertices.data(), static_cast<gu::uint32>(primitiveMesh.Vertices.size()),
+        primitiveMesh.Indices.data(), static_cast<gu::uint32>(primitiveMesh.Indices.size()), nullptr, 0,
+        _meshOptimizeSettings, meshlets.Get(), &_meshOptimizeStatistics);
+    primitiveMesh.Vertices.resize(vertexCount);
+
+    /*-------------------------------------------------------------------
+    -              Level of detail (stored after LOD0 in the same index buffer)
+    ---------------------------------------------------------------------*/
+    gu::DynamicArray<gu::uint32> lodIndices = {};
+    const auto lods = PrepareLODs(lodIndices, primitiveMesh.Indices.data(), static_cast<gu::uint32>(primitiveMesh.Indices.size()), nullptr, 0,
+        primitiveMesh.Vertices.data(), vertexCount, MeshSimplifyVertexLayout::Create<gm::Vertex>());
+    primitiveMesh.Indices.insert(primitiveMesh.Indices.end(), lodIndices.Data(), lodIndices.Data() + lodIndices.Size());
+
+    // The primitive meshes are small, so they keep the float vertices
+    _loadedVertexFormat          = ModelVertexFormat::Full;
+    _vertexCompressionStatistics = {};
+
     const auto mesh = gu::MakeShared<Mesh>(_engine, primitiveMesh, material);
+    mesh->PrepareMeshlets(meshlets);
     _meshes.Push(mesh);
     _totalMesh = mesh;
+    ApplyLODs(lods);
     
     if (material) 
     {
@@ -116,6 +144,8 @@ void GameModel::Load(const PrimitiveMeshType type, const MaterialPtr& material)
 *****************************************************************************/
 void GameModel::Load(const gu::tstring& filePath)
 {
+    GU_MEMORY_TAG_SCOPE(gu::MemoryTag::Model);
+
     std::unique_ptr<IGameModelConverter> loader = nullptr;
 
     /*-------------------------------------------------------------------
@@ -146,23 +176,91 @@ void GameModel::Update(const float deltaTime, const bool enableUpdateChild)
 #endif
         };
 
-        _gameWorld->GetBuffer()->Update(&world, 1);
+        _gameWorld->Update(&world);
     }
 
     GameActor::Update(deltaTime, enableUpdateChild);
 }
 
-void GameModel::Draw(bool isDrawingEachMaterial, const std::uint32_t materialOffsetID)
+void GameModel::Draw(bool isDrawingEachMaterial, const std::uint32_t materialOffsetID, const LODViewType view)
 {
+    const auto lodLevel = _lodLevels[static_cast<gu::uint32>(view)];
+
     if (isDrawingEachMaterial)
     {
-        DrawWithMaterials(materialOffsetID);
+        DrawWithMaterials(materialOffsetID, lodLevel);
     }
     else
     {
-        DrawWithoutMaterial();
+        DrawWithoutMaterial(lodLevel);
     }
 }
+
+/****************************************************************************
+*					SelectLOD
+*************************************************************************//**
+*  @fn        gu::uint32 GameModel::SelectLOD(const LODViewType viewType, const LODView& view)
+*
+*  @brief     Select the level of detail drawn by Draw(..., viewType).
+*             The bounding sphere and the errors are moved to the world space by the model transform.
+*             The previous level of the view is used for the hysteresis.
+*
+*  @param[in] const LODViewType viewType
+*  @param[in] const LODView& view
+*
+*  @return @@gu::uint32 selected level
+*****************************************************************************/
+gu::uint32 GameModel::SelectLOD(const LODViewType viewType, const LODView& view)
+{
+    auto& level = _lodLevels[static_cast<gu::uint32>(viewType)];
+    if (_lodErrors.Size() <= 1) { level = 0; return level; }
+
+    gm::Float3 center     = {};
+    float      radius     = 0.0f;
+    float      worldScale = 0.0f;
+    GetWorldBoundingSphere(center, radius, &worldScale);
+
+    level = LODSelector::Select(view, center, radius,
+        _lodErrors.Data(), static_cast<gu::uint32>(_lodErrors.Size()), worldScale, level);
+    return level;
+}
+
+/****************************************************************************
+*					GetWorldBoundingSphere
+*************************************************************************//**
+*  @fn        void GameModel::GetWorldBoundingSphere(gm::Float3& center, float& radius, float* worldScale) const
+*
+*  @brief     Move the object space bounding sphere by the transform (row vector matrix).
+*             The radius is scaled by the largest axis scale.
+*
+*  @param[out] gm::Float3& center
+*  @param[out] float& radius
+*  @param[out] float* worldScale (nullable) largest axis scale
+*
+*  @return @@void
+*****************************************************************************/
+void GameModel::GetWorldBoundingSphere(gm::Float3& center, float& radius, float* worldScale) const
+{
+    const auto  world = _transform.GetMatrix().ToFloat4x4();
+    const auto& m     = world.u.m;
+    const auto& c     = _boundingCenter;
+
+    center = gm::Float3
+    (
+        c.x * m[0][0] + c.y * m[1][0] + c.z * m[2][0] + m[3][0],
+        c.x * m[0][1] + c.y * m[1][1] + c.z * m[2][1] + m[3][1],
+        c.x * m[0][2] + c.y * m[1][2] + c.z * m[2][2] + m[3][2]
+    );
+
+    float scale = 0.0f;
+    for (int row = 0; row < 3; ++row)
+    {
+        const float length = std::sqrt(m[row][0] * m[row][0] + m[row][1] * m[row][1] + m[row][2] * m[row][2]);
+        scale = (std::max)(scale, length);
+    }
+    radius = _boundingRadius * scale;
+    if (worldScale) { *worldScale = scale; }
+}
 #pragma endregion Main Function
 
 
@@ -187,9 +285,119 @@ void GameModel::PrepareGameWorldBuffer()
     _gameWorld = gu::MakeShared<GameWorldInfo>(_engine, 1);
 
 }
+
+/****************************************************************************
+*					PrepareLODs
+*************************************************************************//**
+*  @fn        gu::DynamicArray<MeshLODLevel> GameModel::PrepareLODs(gu::DynamicArray<gu::uint32>& lodIndices,
+*             const gu::uint32* indices, const gu::uint32 indexCount, const gu::uint32* subMeshIndexCounts, const gu::uint32 subMeshCount,
+*             const void* vertices, const gu::uint32 vertexCount, const MeshSimplifyVertexLayout& layout, const bool* lockedVertices)
+*
+*  @brief     Generate the level of detail chain on import and keep the values used by SelectLOD.
+*             Call before creating the index buffer, then ApplyLODs after creating the meshes.
+*
+*  @param[out] gu::DynamicArray<gu::uint32>& lodIndices (indices of LOD1 or later)
+*  @param[in] const gu::uint32* indices
+*  @param[in] const gu::uint32 indexCount
+*  @param[in] const gu::uint32* subMeshIndexCounts (index count of each material, nullptr : one sub mesh)
+*  @param[in] const gu::uint32 subMeshCount
+*  @param[in] const void* vertices
+*  @param[in] const gu::uint32 vertexCount
+*  @param[in] const MeshSimplifyVertexLayout& layout
+*  @param[in] const bool* lockedVertices (vertices referenced by morphs etc.)
+*
+*  @return @@gu::DynamicArray<MeshLODLevel>
+*****************************************************************************/
+gu::DynamicArray<MeshLODLevel> GameModel::PrepareLODs(gu::DynamicArray<gu::uint32>& lodIndices,
+    const gu::uint32* indices, const gu::uint32 indexCount,
+    const gu::uint32* subMeshIndexCounts, const gu::uint32 subMeshCount,
+    const void* vertices, const gu::uint32 vertexCount, const MeshSimplifyVertexLayout& layout,
+    const bool* lockedVertices)
+{
+    const auto levels = MeshSimplifier::GenerateLODs(lodIndices, indices, indexCount, subMeshIndexCounts, subMeshCount,
+        vertices, vertexCount, layout, _meshLODSettings, lockedVertices);
+
+    _lodErrors.Clear();
+    _lodTriangleCounts.Clear();
+    for (gu::uint64 i = 0; i < levels.Size(); ++i)
+    {
+        _lodErrors        .Push(levels[i].Error);
+        _lodTriangleCounts.Push(levels[i].IndexCount / 3);
+    }
+    for (auto& level : _lodLevels) { level = 0; }
+
+    /*-------------------------------------------------------------------
+    -              Bounding sphere (center of the bounding box)
+    ---------------------------------------------------------------------*/
+    const auto* bytes = static_cast<const gu::uint8*>(vertices);
+    const auto  Position = [&](const gu::uint32 index)
+    {
+        return reinterpret_cast<const float*>(bytes + static_cast<size_t>(index) * layout.Stride + layout.PositionOffset);
+    };
+
+    float minimum[3] = {  FLT_MAX,  FLT_MAX,  FLT_MAX };
+    float maximum[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+    for (gu::uint32 i = 0; i < vertexCount; ++i)
+    {
+        const auto* p = Position(i);
+        for (int k = 0; k < 3; ++k) { minimum[k] = (std::min)(minimum[k], p[k]); maximum[k] = (std::max)(maximum[k], p[k]); }
+    }
+
+    _boundingCenter = vertexCount > 0 ? gm::Float3((minimum[0] + maximum[0]) * 0.5f, (minimum[1] + maximum[1]) * 0.5f, (minimum[2] + maximum[2]) * 0.5f) : gm::Float3(0.0f, 0.0f, 0.0f);
+    _boundingRadius = 0.0f;
+    for (gu::uint32 i = 0; i < vertexCount; ++i)
+    {
+        const auto* p = Position(i);
+        const float dx = p[0] - _boundingCenter.x, dy = p[1] - _boundingCenter.y, dz = p[2] - _boundingCenter.z;
+        _boundingRadius = (std::max)(_boundingRadius, dx * dx + dy * dy + dz * dz);
+    }
+    _boundingRadius = std::sqrt(_boundingRadius);
+
+    return levels;
+}
+
+/****************************************************************************
+*					ApplyLODs
+*************************************************************************//**
+*  @fn        void GameModel::ApplyLODs(const gu::DynamicArray<MeshLODLevel>& levels)
+*
+*  @brief     The total mesh draws the whole range of a level, 
+*             each material mesh draws its own sub mesh range of the level.
+*
+*  @param[in] const gu::DynamicArray<MeshLODLevel>& levels
+*
+*  @return @@void
+*****************************************************************************/
+void GameModel::ApplyLODs(const gu::DynamicArray<MeshLODLevel>& levels)
+{
+    if (levels.IsEmpty()) { return; }
+
+    gu::DynamicArray<Mesh::LODRange> totalRanges = {};
+    for (gu::uint64 i = 0; i < levels.Size(); ++i)
+    {
+        totalRanges.Push({ levels[i].IndexOffset, levels[i].IndexCount });
+    }
+    if (_totalMesh) { _totalMesh->SetLODs(totalRanges); }
+
+    const auto subMeshCount = levels[0].SubMeshIndexCounts.Size();
+    if (subMeshCount != _meshes.Size() || (subMeshCount == 1 && _meshes[0].Get() == _totalMesh.Get())) { return; }
+
+    for (gu::uint64 s = 0; s < subMeshCount; ++s)
+    {
+        gu::DynamicArray<Mesh::LODRange> ranges = {};
+        for (gu::uint64 i = 0; i < levels.Size(); ++i)
+        {
+            gu::uint32 offset = levels[i].IndexOffset;
+            for (gu::uint64 k = 0; k < s; ++k) { offset += levels[i].SubMeshIndexCounts[k]; }
+
+            ranges.Push({ offset, levels[i].SubMeshIndexCounts[s] });
+        }
+        _meshes[s]->SetLODs(ranges);
+    }
+}
 #pragma endregion Set up
 #pragma region Draw
-void GameModel::DrawWithMaterials(const std::uint32_t materialOffsetID)
+void GameModel::DrawWithMaterials(const std::uint32_t materialOffsetID, const gu::uint32 lodLevel)
 {
     const auto frameIndex = _engine->GetCurrentFrameIndex();
     const auto commandList = _engine->GetCommandList(CommandListType::Graphics);
@@ -217,15 +425,15 @@ void GameModel::DrawWithMaterials(const std::uint32_t materialOffsetID)
     for (size_t i = 0; i < _materialCount; ++i)
     {
         _materials[i]->Bind(commandList, frameIndex, materialOffsetID, textureIDs);
-        _meshes[i]->Draw(commandList, frameIndex);
+        _meshes[i]->Draw(commandList, frameIndex, lodLevel);
     }
 }
 
-void GameModel::DrawWithoutMaterial()
+void GameModel::DrawWithoutMaterial(const gu::uint32 lodLevel)
 {
     const auto frameIndex = _engine->GetCurrentFrameIndex();
     const auto commandList = _engine->GetCommandList(CommandListType::Graphics);
     _gameWorld->Bind(commandList, 1);
-    _totalMesh->Draw(commandList, frameIndex);
+    _totalMesh->Draw(commandList, frameIndex, lodLevel);
 }
 #pragma endregion Draw
\ No newline at end of file
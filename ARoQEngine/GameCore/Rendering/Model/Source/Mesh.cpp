@@ -11,6 +11,7 @@
 //////////////////////////////////////////////////////////////////////////////////
 #include "../Include/Mesh.hpp"
 #include "../Include/PrimitiveMesh.hpp"
+#include "../Include/MeshOptimizer.hpp"
 #include "GraphicsCore/Engine/Include/LowLevelGraphicsEngine.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUBuffer.hpp"
 //////////////////////////////////////////////////////////////////////////////////
@@ -89,10 +90,11 @@ Mesh::Mesh(const LowLevelGraphicsEnginePtr& engine, const gu::DynamicArray<Verte
 * 
 *  @param[in] gu::SharedPointer<RHICommandList>& graphicsCommandList
 *  @param[in] std::uint32_t currentFrameIndex
+*  @param[in] const gu::uint32 lodLevel
 * 
 *  @return @@void
 *****************************************************************************/
-void Mesh::Draw(const gu::SharedPointer<RHICommandList>& commandList, const std::uint32_t frameIndex)
+void Mesh::Draw(const gu::SharedPointer<RHICommandList>& commandList, const std::uint32_t frameIndex, const gu::uint32 lodLevel)
 {
 #ifdef _DEBUG
 	Check(frameIndex < LowLevelGraphicsEngine::FRAME_BUFFER_COUNT);
@@ -106,7 +108,16 @@ void Mesh::Draw(const gu::SharedPointer<RHICommandList>& commandList, const std:
 		commandList->SetIndexBuffer(_indexBuffer);
 	}
 
-	commandList->DrawIndexedInstanced(static_cast<std::uint32_t>(_indexCount), 1, _indexOffset);
+	if (lodLevel == 0 || _lods.IsEmpty())
+	{
+		commandList->DrawIndexedInstanced(static_cast<std::uint32_t>(_indexCount), 1, _indexOffset);
+		return;
+	}
+
+	const auto& lod = _lods[lodLevel < _lods.Size() ? lodLevel : _lods.Size() - 1];
+	if (lod.IndexCount == 0) { return; }
+
+	commandList->DrawIndexedInstanced(lod.IndexCount, 1, lod.IndexOffset);
 }
 
 /****************************************************************************
@@ -203,4 +214,94 @@ void Mesh::Prepare(const GPUBufferMetaData& vertexInfo, const GPUBufferMetaData&
 	}
 
 	_hasCreatedNewBuffer = true;
-}
\ No newline at end of file
+}
+
+/****************************************************************************
+*					PrepareMeshlets
+*************************************************************************//**
+*  @fn        void Mesh::PrepareMeshlets(const MeshletDataPtr& meshlets, const gu::tstring& name)
+*
+*  @brief     Keep the meshlets of the whole mesh. 
+*             The structured buffers are created only when the device supports mesh shading.
+*             The CPU data is kept for the cluster culling in any case.
+*
+*  @param[in] const MeshletDataPtr& meshlets
+*  @param[in] const gu::tstring& name
+*
+*  @return @@void
+*****************************************************************************/
+void Mesh::PrepareMeshlets(const MeshletDataPtr& meshlets, const gu::tstring& name)
+{
+	_meshlets       = meshlets;
+	_meshletBuffers = {};
+	_meshletOffset  = 0;
+	_meshletCount   = meshlets ? static_cast<gu::uint32>(meshlets->Meshlets.Size()) : 0;
+
+	if (_meshletCount == 0) { return; }
+
+	const auto device = _engine->GetDevice();
+	if (!device->IsSupportedMeshShading()) { return; }
+
+	const auto copyCommandList = _engine->GetCommandList(CommandListType::Copy);
+
+	const auto CreateBuffer = [&](const size_t stride, const size_t count, void* data, const gu::tstring& bufferName)
+	{
+		auto metaData = GPUBufferMetaData::DefaultBuffer(stride, count, MemoryHeap::Default, data);
+		metaData.ResourceUsage = ResourceUsage::StructuredBuffer;
+
+		auto buffer = device->CreateBuffer(metaData);
+		buffer->SetName(name + SP("Mesh::") + bufferName);
+		buffer->Pack(data, copyCommandList);
+		return buffer;
+	};
+
+	_meshletBuffers.Meshlets      = CreateBuffer(sizeof(Meshlet)      , meshlets->Meshlets     .Size(), meshlets->Meshlets     .Data(), SP("Meshlets"));
+	_meshletBuffers.Bounds        = CreateBuffer(sizeof(MeshletBounds), meshlets->Bounds       .Size(), meshlets->Bounds       .Data(), SP("MeshletBounds"));
+	_meshletBuffers.VertexIndices = CreateBuffer(sizeof(gu::uint32)   , meshlets->VertexIndices.Size(), meshlets->VertexIndices.Data(), SP("MeshletVertexIndices"));
+	_meshletBuffers.Triangles     = CreateBuffer(sizeof(gu::uint32)   , meshlets->Triangles    .Size(), meshlets->Triangles    .Data(), SP("MeshletTriangles"));
+}
+
+/****************************************************************************
+*					SetMeshlets
+*************************************************************************//**
+*  @fn        void Mesh::SetMeshlets(const MeshletDataPtr& meshlets, const MeshletBuffers& buffers, const gu::uint32 meshletOffset, const gu::uint32 meshletCount)
+*
+*  @brief     Share the meshlets prepared by the total mesh (e.g. each material mesh of the model)
+*
+*  @param[in] const MeshletDataPtr& meshlets
+*  @param[in] const MeshletBuffers& buffers
+*  @param[in] const gu::uint32 meshletOffset
+*  @param[in] const gu::uint32 meshletCount
+*
+*  @return @@void
+*****************************************************************************/
+void Mesh::SetMeshlets(const MeshletDataPtr& meshlets, const MeshletBuffers& buffers, const gu::uint32 meshletOffset, const gu::uint32 meshletCount)
+{
+	_meshlets       = meshlets;
+	_meshletBuffers = buffers;
+	_meshletOffset  = meshletOffset;
+	_meshletCount   = meshletCount;
+}
+
+/****************************************************************************
+*					SetLODs
+*************************************************************************//**
+*  @fn        void Mesh::SetLODs(const gu::DynamicArray<LODRange>& lods)
+*
+*  @brief     Set the index ranges of the levels of detail stored after LOD0 in the index buffer.
+*             lods[0] becomes the index range of LOD0, because the index buffer created by this mesh
+*             contains every level and the index count taken from the buffer is no longer the LOD0 count.
+*
+*  @param[in] const gu::DynamicArray<LODRange>& lods
+*
+*  @return @@void
+*****************************************************************************/
+void Mesh::SetLODs(const gu::DynamicArray<LODRange>& lods)
+{
+	_lods.Clear();
+	if (lods.IsEmpty()) { return; }
+
+	_indexOffset = lods[0].IndexOffset;
+	_indexCount  = lods[0].IndexCount;
+	if (lods.Size() > 1) { _lods = lods; }
+}
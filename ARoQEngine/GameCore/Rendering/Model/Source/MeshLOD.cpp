@@ -0,0 +1,120 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   MeshLOD.cpp
+///             @brief  Screen space LOD selection
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/MeshLOD.hpp"
+#include <cfloat>
+#include <cmath>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace gc::core;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region LODView
+LODView LODView::Perspective(const gm::Float3& position, const float fovVertical, const float viewportHeight, const float pixelErrorThreshold)
+{
+	LODView view = {};
+	view.Position            = position;
+	view.PixelScale          = viewportHeight * 0.5f / std::tan(fovVertical * 0.5f);
+	view.IsOrthographic      = false;
+	view.PixelErrorThreshold = pixelErrorThreshold;
+	return view;
+}
+
+LODView LODView::Orthographic(const float pixelsPerUnit, const float pixelErrorThreshold)
+{
+	LODView view = {};
+	view.PixelScale          = pixelsPerUnit;
+	view.IsOrthographic      = true;
+	view.PixelErrorThreshold = pixelErrorThreshold;
+	return view;
+}
+#pragma endregion LODView
+
+#pragma region LODSelector
+/****************************************************************************
+*                     Select
+*************************************************************************//**
+*  @fn        gu::uint32 LODSelector::Select(const LODView& view, const gm::Float3& center, const float radius,
+*             const float* errors, const gu::uint32 levelCount, const float worldScale, const gu::uint32 currentLevel)
+*
+*  @brief     Select the coarsest level whose error projected at the nearest point of the bounding sphere is small enough.
+*             The thresholds differ by the direction of the change, so an object at the boundary does not switch every frame.
+*
+*  @param[in] const LODView& view
+*  @param[in] const gm::Float3& center (world space bounding sphere)
+*  @param[in] const float radius
+*  @param[in] const float* errors (object space error of each level)
+*  @param[in] const gu::uint32 levelCount
+*  @param[in] const float worldScale
+*  @param[in] const gu::uint32 currentLevel
+*
+*  @return    gu::uint32 level
+*****************************************************************************/
+gu::uint32 LODSelector::Select(const LODView& view, const gm::Float3& center, const float radius,
+	const float* errors, const gu::uint32 levelCount, const float worldScale, const gu::uint32 currentLevel)
+{
+	if (levelCount <= 1 || view.PixelScale <= 0.0f || errors == nullptr) { return 0; }
+
+	const float pixelsPerUnit = ComputePixelsPerUnit(view, center, radius);
+	if (pixelsPerUnit == FLT_MAX) { return 0; }
+
+	const float lower = 1.0f - view.Hysteresis;
+	const float upper = 1.0f + view.Hysteresis;
+	const auto  Allowance = [&](const gu::uint32 level)
+	{
+		return level > currentLevel ? lower : (level == currentLevel ? upper : 1.0f);
+	};
+
+	/*-------------------------------------------------------------------
+	-        Too small on the screen : the coarsest level
+	---------------------------------------------------------------------*/
+	const auto coarsest = levelCount - 1;
+	if (radius * pixelsPerUnit < view.MinScreenRadius * Allowance(coarsest)) { return coarsest; }
+
+	/*-------------------------------------------------------------------
+	-        The errors increase with the level, so the first hit from the coarsest side is the answer
+	---------------------------------------------------------------------*/
+	for (gu::uint32 level = coarsest; level > 0; --level)
+	{
+		const float pixelError = errors[level] * worldScale * pixelsPerUnit;
+		if (pixelError <= view.PixelErrorThreshold * Allowance(level)) { return level; }
+	}
+	return 0;
+}
+
+/****************************************************************************
+*                     ComputePixelsPerUnit
+*************************************************************************//**
+*  @fn        float LODSelector::ComputePixelsPerUnit(const LODView& view, const gm::Float3& center, const float radius)
+*
+*  @brief     Pixels covered by one world unit at the nearest point of the bounding sphere
+*
+*  @param[in] const LODView& view
+*  @param[in] const gm::Float3& center
+*  @param[in] const float radius
+*
+*  @return    float (FLT_MAX : the view position is inside the sphere)
+*****************************************************************************/
+float LODSelector::ComputePixelsPerUnit(const LODView& view, const gm::Float3& center, const float radius)
+{
+	if (view.IsOrthographic) { return view.PixelScale; }
+
+	const float dx = center.x - view.Position.x;
+	const float dy = center.y - view.Position.y;
+	const float dz = center.z - view.Position.z;
+	const float distance = std::sqrt(dx * dx + dy * dy + dz * dz) - radius;
+
+	return distance > 0.0f ? view.PixelScale / distance : FLT_MAX;
+}
+#pragma endregion LODSelector
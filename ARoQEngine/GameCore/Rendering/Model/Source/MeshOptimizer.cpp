@@ -0,0 +1,1160 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   MeshOptimizer.cpp
+///             @brief  Offline mesh processing run on model import
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/MeshOptimizer.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace gc::core;
+
+namespace
+{
+	using gu::uint8;
+	using gu::uint16;
+	using gu::uint32;
+	using gu::uint64;
+
+	constexpr uint32 INVALID_INDEX = MeshOptimizer::INVALID_INDEX;
+
+	/*-------------------------------------------------------------------
+	-   Vertex cache optimization (Forsyth, "Linear-Speed Vertex Cache Optimisation")
+	---------------------------------------------------------------------*/
+	constexpr uint32 FORSYTH_CACHE_SIZE    = 32;
+	constexpr uint32 FORSYTH_MAX_VALENCE   = 32;
+	constexpr float  FORSYTH_DECAY_POWER   = 1.5f;
+	constexpr float  FORSYTH_LAST_SCORE    = 0.75f;
+	constexpr float  FORSYTH_VALENCE_SCALE = 2.0f;
+
+	/*-------------------------------------------------------------------
+	-   FIFO cache used to find the cluster boundaries of the overdraw optimization
+	---------------------------------------------------------------------*/
+	constexpr uint32 OVERDRAW_CACHE_SIZE = 16;
+
+	/*-------------------------------------------------------------------
+	-   Vertex fetch analysis : direct mapped cache (64 byte x 256 lines)
+	---------------------------------------------------------------------*/
+	constexpr uint32 FETCH_CACHE_LINE_SIZE  = 64;
+	constexpr uint32 FETCH_CACHE_LINE_COUNT = 256;
+
+	/*-------------------------------------------------------------------
+	-   Meshlet builder : triangles examined when no adjacent triangle is left
+	---------------------------------------------------------------------*/
+	constexpr uint32 MESHLET_SEED_SEARCH_COUNT = 256;
+
+	constexpr uint16 INVALID_LOCAL_INDEX = 0xFFFF;
+
+	struct Position
+	{
+		float x = 0.0f;
+		float y = 0.0f;
+		float z = 0.0f;
+	};
+
+	inline Position operator+(const Position& a, const Position& b) { return { a.x + b.x, a.y + b.y, a.z + b.z }; }
+	inline Position operator-(const Position& a, const Position& b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+	inline Position operator*(const Position& a, const float s)     { return { a.x * s, a.y * s, a.z * s }; }
+
+	inline float Dot(const Position& a, const Position& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+	inline Position Cross(const Position& a, const Position& b)
+	{
+		return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+	}
+
+	inline float Length(const Position& a) { return std::sqrt(Dot(a, a)); }
+
+	/* @brief : Unit vector, or zero when the length is almost zero*/
+	inline Position Normalize(const Position& a)
+	{
+		const float length = Length(a);
+		return length > 1e-20f ? a * (1.0f / length) : Position();
+	}
+
+	inline Position LoadPosition(const uint8* vertices, const uint32 stride, const uint32 offset, const uint32 index)
+	{
+		Position position;
+		std::memcpy(&position, vertices + static_cast<uint64>(index) * stride + offset, sizeof(Position));
+		return position;
+	}
+
+	/* @brief : MurmurHash2 of the vertex bytes*/
+	uint32 HashVertex(const uint8* data, const uint32 stride)
+	{
+		constexpr uint32 m = 0x5bd1e995;
+
+		uint32 hash = stride;
+		uint32 i    = 0;
+		for (; i + 4 <= stride; i += 4)
+		{
+			uint32 k = 0;
+			std::memcpy(&k, data + i, sizeof(k));
+			k *= m; k ^= k >> 24; k *= m;
+			hash *= m; hash ^= k;
+		}
+		for (; i < stride; ++i)
+		{
+			hash ^= data[i]; hash *= m;
+		}
+
+		hash ^= hash >> 13; hash *= m; hash ^= hash >> 15;
+		return hash;
+	}
+
+	/****************************************************************************
+	*                     ForsythScoreTable
+	*************************************************************************//**
+	*  @brief     Vertex score = cache position score + valence boost.
+	*             The vertices of the last triangle get a fixed score so that the next triangle does not reuse all of them.
+	*****************************************************************************/
+	struct ForsythScoreTable
+	{
+		float Cache  [FORSYTH_CACHE_SIZE]  = {};
+		float Valence[FORSYTH_MAX_VALENCE] = {};
+
+		ForsythScoreTable()
+		{
+			for (uint32 i = 0; i < FORSYTH_CACHE_SIZE; ++i)
+			{
+				Cache[i] = i < 3 ? FORSYTH_LAST_SCORE
+					: std::pow(1.0f - static_cast<float>(i - 3) / static_cast<float>(FORSYTH_CACHE_SIZE - 3), FORSYTH_DECAY_POWER);
+			}
+
+			Valence[0] = 0.0f;
+			for (uint32 i = 1; i < FORSYTH_MAX_VALENCE; ++i)
+			{
+				Valence[i] = FORSYTH_VALENCE_SCALE / std::sqrt(static_cast<float>(i));
+			}
+		}
+
+		float Get(const uint32 cachePosition, const uint32 liveTriangleCount) const
+		{
+			if (liveTriangleCount == 0) { return -1.0f; }
+
+			const float cacheScore = cachePosition < FORSYTH_CACHE_SIZE ? Cache[cachePosition] : 0.0f;
+			return cacheScore + Valence[liveTriangleCount < FORSYTH_MAX_VALENCE ? liveTriangleCount : FORSYTH_MAX_VALENCE - 1];
+		}
+	};
+
+	/****************************************************************************
+	*                     TriangleAdjacency
+	*************************************************************************//**
+	*  @brief     Vertex -> live triangles. Emitted triangles are swap-removed, so only the live ones are visited.
+	*****************************************************************************/
+	struct TriangleAdjacency
+	{
+		gu::DynamicArray<uint32> Offsets   = {};
+		gu::DynamicArray<uint32> Counts    = {};
+		gu::DynamicArray<uint32> Triangles = {};
+
+		TriangleAdjacency(const uint32* indices, const uint32 indexCount, const uint32 vertexCount)
+			: Offsets(vertexCount + 1, 0), Counts(vertexCount, 0), Triangles(indexCount, 0)
+		{
+			for (uint32 i = 0; i < indexCount; ++i) { Counts[indices[i]]++; }
+
+			for (uint32 v = 0; v < vertexCount; ++v) { Offsets[v + 1] = Offsets[v] + Counts[v]; }
+
+			gu::DynamicArray<uint32> fill(vertexCount, 0);
+			for (uint32 i = 0; i < indexCount; ++i)
+			{
+				const auto vertex = indices[i];
+				Triangles[Offsets[vertex] + fill[vertex]++] = i / 3;
+			}
+		}
+
+		const uint32* Begin(const uint32 vertex) const { return &Triangles[0] + Offsets[vertex]; }
+		const uint32* End  (const uint32 vertex) const { return &Triangles[0] + Offsets[vertex] + Counts[vertex]; }
+
+		void Remove(const uint32 vertex, const uint32 triangle)
+		{
+			auto* triangles = &Triangles[0] + Offsets[vertex];
+			const auto count = Counts[vertex];
+			for (uint32 i = 0; i < count; ++i)
+			{
+				if (triangles[i] != triangle) { continue; }
+
+				triangles[i] = triangles[count - 1];
+				Counts[vertex]--;
+				return;
+			}
+		}
+	};
+
+	/* @brief : FIFO cache simulated with the insertion time of each vertex. Returns the miss count of the triangle.*/
+	inline uint32 UpdateFIFOCache(const uint32* triangle, gu::DynamicArray<uint32>& insertTimes, uint32& time, const uint32 cacheSize)
+	{
+		uint32 misses = 0;
+		for (uint32 k = 0; k < 3; ++k)
+		{
+			const auto vertex = triangle[k];
+			if (time - insertTimes[vertex] > cacheSize)
+			{
+				insertTimes[vertex] = time++;
+				misses++;
+			}
+		}
+		return misses;
+	}
+
+	/****************************************************************************
+	*                     ComputeMeshletBounds
+	*************************************************************************//**
+	*  @brief     Ritter bounding sphere and the normal cone of the triangles
+	*****************************************************************************/
+	MeshletBounds ComputeMeshletBounds(const MeshletData& meshlets, const Meshlet& meshlet,
+		const uint8* vertices, const uint32 stride, const uint32 positionOffset)
+	{
+		Position positions[MeshOptimizer::MAX_MESHLET_VERTICES];
+		for (uint32 i = 0; i < meshlet.VertexCount; ++i)
+		{
+			positions[i] = LoadPosition(vertices, stride, positionOffset, meshlets.VertexIndices[meshlet.VertexOffset + i]);
+		}
+
+		/*-------------------------------------------------------------------
+		-            Bounding sphere (start with the widest pair of the axis extremes)
+		---------------------------------------------------------------------*/
+		uint32 minimum[3] = { 0, 0, 0 };
+		uint32 maximum[3] = { 0, 0, 0 };
+		for (uint32 i = 1; i < meshlet.VertexCount; ++i)
+		{
+			const float* p = &positions[i].x;
+			for (uint32 axis = 0; axis < 3; ++axis)
+			{
+				if (p[axis] < (&positions[minimum[axis]].x)[axis]) { minimum[axis] = i; }
+				if (p[axis] > (&positions[maximum[axis]].x)[axis]) { maximum[axis] = i; }
+			}
+		}
+
+		uint32 widestAxis     = 0;
+		float  widestDistance = -1.0f;
+		for (uint32 axis = 0; axis < 3; ++axis)
+		{
+			const auto d = positions[maximum[axis]] - positions[minimum[axis]];
+			if (Dot(d, d) > widestDistance) { widestDistance = Dot(d, d); widestAxis = axis; }
+		}
+
+		auto  center = (positions[minimum[widestAxis]] + positions[maximum[widestAxis]]) * 0.5f;
+		float radius = std::sqrt(widestDistance) * 0.5f;
+		for (uint32 i = 0; i < meshlet.VertexCount; ++i)
+		{
+			const float distance = Length(positions[i] - center);
+			if (distance <= radius) { continue; }
+
+			const float newRadius = (radius + distance) * 0.5f;
+			center = center + (positions[i] - center) * ((newRadius - radius) / distance);
+			radius = newRadius;
+		}
+
+		MeshletBounds bounds = {};
+		bounds.Center = gm::Float3(center.x, center.y, center.z);
+		bounds.Radius = radius;
+
+		/*-------------------------------------------------------------------
+		-            Normal cone
+		---------------------------------------------------------------------*/
+		Position normals[MeshOptimizer::MAX_MESHLET_TRIANGLES];
+		Position corners[MeshOptimizer::MAX_MESHLET_TRIANGLES];
+		uint32   normalCount = 0;
+		Position axis        = {};
+		for (uint32 i = 0; i < meshlet.TriangleCount; ++i)
+		{
+			const auto packed = meshlets.Triangles[meshlet.TriangleOffset + i];
+			const auto& p0 = positions[ packed        & 0xFF];
+			const auto& p1 = positions[(packed >>  8) & 0xFF];
+			const auto& p2 = positions[(packed >> 16) & 0xFF];
+
+			const auto normal = Normalize(Cross(p1 - p0, p2 - p0));
+			if (Dot(normal, normal) == 0.0f) { continue; } // degenerate
+
+			normals[normalCount] = normal;
+			corners[normalCount] = p0;
+			normalCount++;
+			axis = axis + normal;
+		}
+
+		axis = Normalize(axis);
+		if (normalCount == 0 || Dot(axis, axis) == 0.0f) { return bounds; }
+
+		float minimumDot = 1.0f;
+		for (uint32 i = 0; i < normalCount; ++i) { minimumDot = (std::min)(minimumDot, Dot(normals[i], axis)); }
+
+		// The back facing cone is empty when the normals spread over 84 degrees from the axis
+		if (minimumDot <= 0.1f) { return bounds; }
+
+		// Move the apex back along the axis until every triangle plane is in front of it
+		float maximumT = 0.0f;
+		for (uint32 i = 0; i < normalCount; ++i)
+		{
+			const float t = Dot(center - corners[i], normals[i]) / Dot(axis, normals[i]);
+			maximumT = (std::max)(maximumT, t);
+		}
+
+		const auto apex = center - axis * maximumT;
+		bounds.ConeApex   = gm::Float3(apex.x, apex.y, apex.z);
+		bounds.ConeAxis   = gm::Float3(axis.x, axis.y, axis.z);
+		bounds.ConeCutoff = std::sqrt(1.0f - minimumDot * minimumDot);
+		return bounds;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Meshlet Bounds
+bool MeshletBounds::IsBackFacing(const gm::Float3& cameraPosition) const noexcept
+{
+	if (!HasCone()) { return false; }
+
+	const Position direction = { ConeApex.x - cameraPosition.x, ConeApex.y - cameraPosition.y, ConeApex.z - cameraPosition.z };
+	const Position axis      = { ConeAxis.x, ConeAxis.y, ConeAxis.z };
+	return Dot(direction, axis) >= ConeCutoff * Length(direction);
+}
+#pragma endregion Meshlet Bounds
+
+#pragma region Main Function
+/****************************************************************************
+*                     Optimize
+*************************************************************************//**
+*  @fn        gu::uint32 MeshOptimizer::Optimize(void* vertices, const gu::uint32 vertexCount, const gu::uint32 vertexStride, const gu::uint32 positionOffset,
+*             gu::uint32* indices, const gu::uint32 indexCount, const gu::uint32* subMeshIndexCounts, const gu::uint32 subMeshCount,
+*             const MeshOptimizeSettings& settings, MeshletData* meshlets, MeshOptimizeStatistics* statistics, gu::uint32* vertexRemap, const bool* lockedVertices)
+*
+*  @brief     Run the enabled steps in order. The deduplication and the vertex fetch remapping work on the whole vertex buffer,
+*             the triangle reordering and the meshlets work inside each sub mesh.
+*
+*  @param[in,out] void* vertices (compacted to the front)
+*  @param[in]     const gu::uint32 vertexCount
+*  @param[in]     const gu::uint32 vertexStride
+*  @param[in]     const gu::uint32 positionOffset (byte offset of the float3 position)
+*  @param[in,out] gu::uint32* indices
+*  @param[in]     const gu::uint32 indexCount
+*  @param[in]     const gu::uint32* subMeshIndexCounts (nullptr : one sub mesh)
+*  @param[in]     const gu::uint32 subMeshCount
+*  @param[in]     const MeshOptimizeSettings& settings
+*  @param[out]    MeshletData* meshlets (nullptr : no meshlet)
+*  @param[out]    MeshOptimizeStatistics* statistics
+*  @param[out]    gu::uint32* vertexRemap (old vertex -> new vertex)
+*  @param[in]     const bool* lockedVertices
+*
+*  @return    gu::uint32 new vertex count
+*****************************************************************************/
+gu::uint32 MeshOptimizer::Optimize(void* vertices, const gu::uint32 vertexCount, const gu::uint32 vertexStride, const gu::uint32 positionOffset,
+	gu::uint32* indices, const gu::uint32 indexCount,
+	const gu::uint32* subMeshIndexCounts, const gu::uint32 subMeshCount,
+	const MeshOptimizeSettings& settings,
+	MeshletData* meshlets, MeshOptimizeStatistics* statistics,
+	gu::uint32* vertexRemap, const bool* lockedVertices)
+{
+	Checkf(positionOffset + sizeof(float) * 3 <= vertexStride, "The position is out of the vertex");
+
+	auto* bytes = static_cast<uint8*>(vertices);
+
+	/*-------------------------------------------------------------------
+	-            Sub mesh ranges
+	---------------------------------------------------------------------*/
+	gu::DynamicArray<uint32> rangeOffsets = {};
+	rangeOffsets.Push(0);
+	if (subMeshIndexCounts == nullptr || subMeshCount == 0)
+	{
+		rangeOffsets.Push(indexCount);
+	}
+	else
+	{
+		for (uint32 i = 0; i < subMeshCount; ++i)
+		{
+			Checkf(subMeshIndexCounts[i] % 3 == 0, "The sub mesh is not a triangle list");
+			rangeOffsets.Push(rangeOffsets.Back() + subMeshIndexCounts[i]);
+		}
+		Checkf(rangeOffsets.Back() == indexCount, "The sum of the sub mesh index counts differs from the index count");
+	}
+	const auto rangeCount = static_cast<uint32>(rangeOffsets.Size() - 1);
+
+	if (statistics)
+	{
+		*statistics = {};
+		statistics->VertexCountBefore = vertexCount;
+		statistics->CacheBefore       = AnalyzeVertexCache(indices, indexCount, vertexCount);
+		statistics->FetchBefore       = AnalyzeVertexFetch(indices, indexCount, vertexCount, vertexStride);
+	}
+
+	/*-------------------------------------------------------------------
+	-            Old vertex -> current vertex
+	---------------------------------------------------------------------*/
+	gu::DynamicArray<uint32> totalRemap(vertexCount, 0);
+	for (uint32 i = 0; i < vertexCount; ++i) { totalRemap[i] = i; }
+
+	gu::DynamicArray<uint32> remap(vertexCount, 0);
+	gu::DynamicArray<uint8>  scratch = {};
+
+	auto currentVertexCount = vertexCount;
+
+	const auto ApplyRemap = [&](const uint32 newVertexCount)
+	{
+		scratch.Resize(static_cast<uint64>(currentVertexCount) * vertexStride);
+		std::memcpy(scratch.Data(), bytes, scratch.Size());
+
+		RemapIndexBuffer (indices, indices, indexCount, remap.Data());
+		RemapVertexBuffer(bytes, scratch.Data(), currentVertexCount, vertexStride, remap.Data());
+
+		for (uint32 i = 0; i < vertexCount; ++i)
+		{
+			if (totalRemap[i] != INVALID_INDEX) { totalRemap[i] = remap[totalRemap[i]]; }
+		}
+		currentVertexCount = newVertexCount;
+	};
+
+	/*-------------------------------------------------------------------
+	-            1. Vertex deduplication
+	---------------------------------------------------------------------*/
+	if (settings.Deduplicate && indexCount > 0)
+	{
+		ApplyRemap(GenerateVertexRemap(remap.Data(), indices, indexCount, bytes, vertexCount, vertexStride, lockedVertices));
+	}
+
+	/*-------------------------------------------------------------------
+	-            2, 3. Triangle order in each sub mesh
+	---------------------------------------------------------------------*/
+	for (uint32 r = 0; r < rangeCount; ++r)
+	{
+		auto* rangeIndices         = indices + rangeOffsets[r];
+		const auto rangeIndexCount = rangeOffsets[r + 1] - rangeOffsets[r];
+
+		if (settings.OptimizeVertexCache)
+		{
+			OptimizeVertexCache(rangeIndices, rangeIndices, rangeIndexCount, currentVertexCount);
+		}
+		if (settings.OptimizeOverdraw)
+		{
+			OptimizeOverdraw(rangeIndices, rangeIndices, rangeIndexCount, bytes, currentVertexCount, vertexStride, positionOffset, settings.OverdrawThreshold);
+		}
+	}
+
+	/*-------------------------------------------------------------------
+	-            4. Vertex fetch remapping
+	---------------------------------------------------------------------*/
+	if (settings.OptimizeVertexFetch && indexCount > 0)
+	{
+		ApplyRemap(GenerateVertexFetchRemap(remap.Data(), indices, indexCount, currentVertexCount));
+	}
+
+	/*-------------------------------------------------------------------
+	-            5. Meshlets
+	---------------------------------------------------------------------*/
+	if (meshlets && settings.BuildMeshlets)
+	{
+		meshlets->Clear();
+		meshlets->SubMeshOffsets.Push(0);
+		for (uint32 r = 0; r < rangeCount; ++r)
+		{
+			BuildMeshlets(*meshlets, indices + rangeOffsets[r], rangeOffsets[r + 1] - rangeOffsets[r],
+				bytes, currentVertexCount, vertexStride, positionOffset,
+				settings.MaxMeshletVertices, settings.MaxMeshletTriangles, settings.MeshletConeWeight);
+			meshlets->SubMeshOffsets.Push(static_cast<uint32>(meshlets->Meshlets.Size()));
+		}
+	}
+
+	if (vertexRemap) { std::memcpy(vertexRemap, totalRemap.Data(), sizeof(uint32) * vertexCount); }
+
+	if (statistics)
+	{
+		statistics->VertexCountAfter = currentVertexCount;
+		statistics->CacheAfter       = AnalyzeVertexCache(indices, indexCount, currentVertexCount);
+		statistics->FetchAfter       = AnalyzeVertexFetch(indices, indexCount, currentVertexCount, vertexStride);
+		if (meshlets && settings.BuildMeshlets)
+		{
+			statistics->Meshlets = AnalyzeMeshlets(*meshlets, currentVertexCount);
+		}
+	}
+
+	return currentVertexCount;
+}
+
+/****************************************************************************
+*                     GenerateVertexRemap
+*************************************************************************//**
+*  @fn        gu::uint32 MeshOptimizer::GenerateVertexRemap(gu::uint32* remap, const gu::uint32* indices, const gu::uint32 indexCount,
+*             const void* vertices, const gu::uint32 vertexCount, const gu::uint32 vertexStride, const bool* lockedVertices)
+*
+*  @brief     Map the byte-identical vertices to one new vertex. The new vertices are numbered in the first use order.
+*             Open addressing hash table with triangular probing (visits every slot of the power of two table).
+*
+*  @param[out] gu::uint32* remap (size vertexCount, INVALID_INDEX : unreferenced)
+*  @param[in]  const gu::uint32* indices (nullptr : unindexed)
+*  @param[in]  const gu::uint32 indexCount
+*  @param[in]  const void* vertices
+*  @param[in]  const gu::uint32 vertexCount
+*  @param[in]  const gu::uint32 vertexStride
+*  @param[in]  const bool* lockedVertices (nullptr : merge all)
+*
+*  @return    gu::uint32 unique vertex count
+*****************************************************************************/
+gu::uint32 MeshOptimizer::GenerateVertexRemap(gu::uint32* remap, const gu::uint32* indices, const gu::uint32 indexCount,
+	const void* vertices, const gu::uint32 vertexCount, const gu::uint32 vertexStride, const bool* lockedVertices)
+{
+	const auto* bytes = static_cast<const uint8*>(vertices);
+
+	std::fill(remap, remap + vertexCount, INVALID_INDEX);
+
+	uint32 tableSize = 1;
+	while (tableSize < vertexCount + vertexCount / 4) { tableSize <<= 1; }
+	const uint32 tableMask = tableSize - 1;
+
+	gu::DynamicArray<uint32> table(tableSize, INVALID_INDEX);
+
+	uint32 uniqueCount = 0;
+	const auto count = indices ? indexCount : vertexCount;
+	for (uint32 i = 0; i < count; ++i)
+	{
+		const auto vertex = indices ? indices[i] : i;
+		Check(vertex < vertexCount);
+
+		if (remap[vertex] != INVALID_INDEX) { continue; }
+
+		if (lockedVertices && lockedVertices[vertex])
+		{
+			remap[vertex] = uniqueCount++;
+			continue;
+		}
+
+		const auto* data = bytes + static_cast<uint64>(vertex) * vertexStride;
+		auto slot = HashVertex(data, vertexStride) & tableMask;
+		for (uint32 probe = 1; ; ++probe)
+		{
+			const auto candidate = table[slot];
+			if (candidate == INVALID_INDEX)
+			{
+				table[slot]   = vertex;
+				remap[vertex] = uniqueCount++;
+				break;
+			}
+			if (std::memcmp(bytes + static_cast<uint64>(candidate) * vertexStride, data, vertexStride) == 0)
+			{
+				remap[vertex] = remap[candidate];
+				break;
+			}
+			slot = (slot + probe) & tableMask;
+		}
+	}
+	return uniqueCount;
+}
+
+void MeshOptimizer::RemapIndexBuffer(gu::uint32* destination, const gu::uint32* indices, const gu::uint32 indexCount, const gu::uint32* remap)
+{
+	for (uint32 i = 0; i < indexCount; ++i)
+	{
+		destination[i] = remap[indices[i]];
+	}
+}
+
+/* @brief : destination must not overlap vertices*/
+void MeshOptimizer::RemapVertexBuffer(void* destination, const void* vertices, const gu::uint32 vertexCount, const gu::uint32 vertexStride, const gu::uint32* remap)
+{
+	auto*       dst = static_cast<uint8*>(destination);
+	const auto* src = static_cast<const uint8*>(vertices);
+
+	for (uint32 i = 0; i < vertexCount; ++i)
+	{
+		if (remap[i] == INVALID_INDEX) { continue; }
+
+		std::memcpy(dst + static_cast<uint64>(remap[i]) * vertexStride, src + static_cast<uint64>(i) * vertexStride, vertexStride);
+	}
+}
+
+/****************************************************************************
+*                     OptimizeVertexCache
+*************************************************************************//**
+*  @fn        void MeshOptimizer::OptimizeVertexCache(gu::uint32* destination, const gu::uint32* indices, const gu::uint32 indexCount, const gu::uint32 vertexCount)
+*
+*  @brief     Forsyth's greedy triangle ordering. The next triangle is the best scored one adjacent to the simulated LRU cache;
+*             the scores change only for the vertices in the cache, so the cost is linear in the triangle count.
+*
+*  @param[out] gu::uint32* destination (may be indices)
+*  @param[in]  const gu::uint32* indices
+*  @param[in]  const gu::uint32 indexCount
+*  @param[in]  const gu::uint32 vertexCount
+*
+*  @return    void
+*****************************************************************************/
+void MeshOptimizer::OptimizeVertexCache(gu::uint32* destination, const gu::uint32* indices, const gu::uint32 indexCount, const gu::uint32 vertexCount)
+{
+	static const ForsythScoreTable scoreTable;
+
+	const auto triangleCount = indexCount / 3;
+	if (triangleCount == 0) { return; }
+
+	gu::DynamicArray<uint32> source(indexCount, 0);
+	std::memcpy(source.Data(), indices, sizeof(uint32) * indexCount);
+
+	TriangleAdjacency adjacency(source.Data(), indexCount, vertexCount);
+
+	gu::DynamicArray<uint32> cachePositions(vertexCount, INVALID_INDEX);
+	gu::DynamicArray<float>  vertexScores  (vertexCount, 0.0f);
+	gu::DynamicArray<float>  triangleScores(triangleCount, 0.0f);
+	gu::DynamicArray<uint8>  isEmitted     (triangleCount, 0);
+
+	for (uint32 v = 0; v < vertexCount; ++v)
+	{
+		vertexScores[v] = scoreTable.Get(INVALID_INDEX, adjacency.Counts[v]);
+	}
+
+	uint32 bestTriangle = 0;
+	for (uint32 t = 0; t < triangleCount; ++t)
+	{
+		triangleScores[t] = vertexScores[source[t * 3]] + vertexScores[source[t * 3 + 1]] + vertexScores[source[t * 3 + 2]];
+		if (triangleScores[t] > triangleScores[bestTriangle]) { bestTriangle = t; }
+	}
+
+	uint32 cache   [FORSYTH_CACHE_SIZE + 3] = {};
+	uint32 newCache[FORSYTH_CACHE_SIZE + 3] = {};
+	uint32 cacheCount = 0;
+	uint32 cursor     = 0;
+
+	for (uint32 output = 0; output < triangleCount; ++output)
+	{
+		// No live triangle touches the cache : restart from the first remaining triangle
+		if (bestTriangle == INVALID_INDEX)
+		{
+			while (isEmitted[cursor]) { ++cursor; }
+			bestTriangle = cursor;
+		}
+
+		const uint32* triangle = &source[bestTriangle * 3];
+		destination[output * 3 + 0] = triangle[0];
+		destination[output * 3 + 1] = triangle[1];
+		destination[output * 3 + 2] = triangle[2];
+		isEmitted[bestTriangle] = 1;
+
+		for (uint32 k = 0; k < 3; ++k) { adjacency.Remove(triangle[k], bestTriangle); }
+
+		/*-------------------------------------------------------------------
+		-            Move the triangle vertices to the front of the LRU cache
+		---------------------------------------------------------------------*/
+		uint32 newCount = 0;
+		for (uint32 k = 0; k < 3; ++k)
+		{
+			if (std::find(newCache, newCache + newCount, triangle[k]) == newCache + newCount) { newCache[newCount++] = triangle[k]; }
+		}
+		for (uint32 i = 0; i < cacheCount; ++i)
+		{
+			const auto vertex = cache[i];
+			if (vertex != triangle[0] && vertex != triangle[1] && vertex != triangle[2]) { newCache[newCount++] = vertex; }
+		}
+
+		/*-------------------------------------------------------------------
+		-            Update the scores of the cached and the evicted vertices
+		---------------------------------------------------------------------*/
+		for (uint32 i = 0; i < newCount; ++i)
+		{
+			const auto vertex   = newCache[i];
+			const auto position = i < FORSYTH_CACHE_SIZE ? i : INVALID_INDEX;
+			cachePositions[vertex] = position;
+
+			const auto score = scoreTable.Get(position, adjacency.Counts[vertex]);
+			const auto delta = score - vertexScores[vertex];
+			vertexScores[vertex] = score;
+
+			for (auto* t = adjacency.Begin(vertex); t != adjacency.End(vertex); ++t) { triangleScores[*t] += delta; }
+		}
+
+		cacheCount = (std::min)(newCount, FORSYTH_CACHE_SIZE);
+		std::memcpy(cache, newCache, sizeof(uint32) * cacheCount);
+
+		bestTriangle    = INVALID_INDEX;
+		float bestScore = -FLT_MAX;
+		for (uint32 i = 0; i < cacheCount; ++i)
+		{
+			for (auto* t = adjacency.Begin(cache[i]); t != adjacency.End(cache[i]); ++t)
+			{
+				if (triangleScores[*t] > bestScore) { bestScore = triangleScores[*t]; bestTriangle = *t; }
+			}
+		}
+	}
+}
+
+/****************************************************************************
+*                     OptimizeOverdraw
+*************************************************************************//**
+*  @fn        void MeshOptimizer::OptimizeOverdraw(gu::uint32* destination, const gu::uint32* indices, const gu::uint32 indexCount,
+*             const void* vertices, const gu::uint32 vertexCount, const gu::uint32 vertexStride, const gu::uint32 positionOffset, const float threshold)
+*
+*  @brief     Sander et al. "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw".
+*             The cache optimized order is split into clusters where the cache restarts (hard boundaries)
+*             and where the ACMR of the cluster is already within threshold x the ACMR of the hard cluster (soft boundaries).
+*             The clusters are sorted by dot(cluster centroid - mesh centroid, cluster normal) in the descending order,
+*             so the outward facing clusters far from the center are drawn first and occlude the rest.
+*
+*  @param[out] gu::uint32* destination (may be indices)
+*  @param[in]  const gu::uint32* indices
+*  @param[in]  const gu::uint32 indexCount
+*  @param[in]  const void* vertices
+*  @param[in]  const gu::uint32 vertexCount
+*  @param[in]  const gu::uint32 vertexStride
+*  @param[in]  const gu::uint32 positionOffset
+*  @param[in]  const float threshold (>= 1)
+*
+*  @return    void
+*****************************************************************************/
+void MeshOptimizer::OptimizeOverdraw(gu::uint32* destination, const gu::uint32* indices, const gu::uint32 indexCount,
+	const void* vertices, const gu::uint32 vertexCount, const gu::uint32 vertexStride, const gu::uint32 positionOffset, const float threshold)
+{
+	const auto triangleCount = indexCount / 3;
+	if (triangleCount == 0) { return; }
+
+	const auto* bytes = static_cast<const uint8*>(vertices);
+
+	gu::DynamicArray<uint32> source(indexCount, 0);
+	std::memcpy(source.Data(), indices, sizeof(uint32) * indexCount);
+
+	gu::DynamicArray<uint32> insertTimes(vertexCount, 0);
+	uint32 time = OVERDRAW_CACHE_SIZE + 1;
+
+	/*-------------------------------------------------------------------
+	-            Hard boundaries : all three vertices of the triangle miss
+	-            (the first triangle always starts a cluster, even if it is degenerate)
+	---------------------------------------------------------------------*/
+	gu::DynamicArray<uint32> hardClusters = {};
+	for (uint32 t = 0; t < triangleCount; ++t)
+	{
+		const auto misses = UpdateFIFOCache(&source[t * 3], insertTimes, time, OVERDRAW_CACHE_SIZE);
+		if (t == 0 || misses == 3) { hardClusters.Push(t); }
+	}
+	hardClusters.Push(triangleCount);
+
+	/*-------------------------------------------------------------------
+	-            Soft boundaries
+	---------------------------------------------------------------------*/
+	gu::DynamicArray<uint32> clusters = {};
+	for (uint32 c = 0; c + 1 < hardClusters.Size(); ++c)
+	{
+		const auto begin = hardClusters[c];
+		const auto end   = hardClusters[c + 1];
+
+		time += OVERDRAW_CACHE_SIZE + 1;
+		uint32 clusterMisses = 0;
+		for (uint32 t = begin; t < end; ++t) { clusterMisses += UpdateFIFOCache(&source[t * 3], insertTimes, time, OVERDRAW_CACHE_SIZE); }
+
+		const float limit = threshold * static_cast<float>(clusterMisses) / static_cast<float>(end - begin);
+
+		time += OVERDRAW_CACHE_SIZE + 1;
+		clusters.Push(begin);
+
+		uint32 start  = begin;
+		uint32 misses = 0;
+		for (uint32 t = begin; t + 1 < end; ++t)
+		{
+			misses += UpdateFIFOCache(&source[t * 3], insertTimes, time, OVERDRAW_CACHE_SIZE);
+			if (static_cast<float>(misses) <= limit * static_cast<float>(t + 1 - start))
+			{
+				clusters.Push(t + 1);
+				start  = t + 1;
+				misses = 0;
+				time  += OVERDRAW_CACHE_SIZE + 1;
+			}
+		}
+	}
+	clusters.Push(triangleCount);
+
+	const auto clusterCount = static_cast<uint32>(clusters.Size() - 1);
+	if (clusterCount <= 1)
+	{
+		if (destination != indices) { std::memcpy(destination, indices, sizeof(uint32) * indexCount); }
+		return;
+	}
+
+	/*-------------------------------------------------------------------
+	-            Area weighted centroid and normal of each cluster
+	---------------------------------------------------------------------*/
+	gu::DynamicArray<Position> clusterCentroids(clusterCount, Position());
+	gu::DynamicArray<Position> clusterNormals  (clusterCount, Position());
+	Position meshCentroid = {};
+	float    meshArea     = 0.0f;
+
+	for (uint32 c = 0; c < clusterCount; ++c)
+	{
+		Position centroid = {};
+		Position normal   = {};
+		float    area     = 0.0f;
+		for (uint32 t = clusters[c]; t < clusters[c + 1]; ++t)
+		{
+			const auto p0 = LoadPosition(bytes, vertexStride, positionOffset, source[t * 3 + 0]);
+			const auto p1 = LoadPosition(bytes, vertexStride, positionOffset, source[t * 3 + 1]);
+			const auto p2 = LoadPosition(bytes, vertexStride, positionOffset, source[t * 3 + 2]);
+
+			const auto  cross        = Cross(p1 - p0, p2 - p0);
+			const float triangleArea = Length(cross);
+
+			centroid = centroid + (p0 + p1 + p2) * (triangleArea / 3.0f);
+			normal   = normal   + cross;
+			area    += triangleArea;
+		}
+
+		meshCentroid = meshCentroid + centroid;
+		meshArea    += area;
+
+		clusterCentroids[c] = area > 0.0f ? centroid * (1.0f / area) : centroid;
+		clusterNormals  [c] = Normalize(normal);
+	}
+	meshCentroid = meshArea > 0.0f ? meshCentroid * (1.0f / meshArea) : meshCentroid;
+
+	gu::DynamicArray<float>  sortKeys(clusterCount, 0.0f);
+	gu::DynamicArray<uint32> order   (clusterCount, 0);
+	for (uint32 c = 0; c < clusterCount; ++c)
+	{
+		sortKeys[c] = Dot(clusterCentroids[c] - meshCentroid, clusterNormals[c]);
+		order   [c] = c;
+	}
+
+	std::stable_sort(order.Data(), order.Data() + clusterCount, [&](const uint32 a, const uint32 b) { return sortKeys[a] > sortKeys[b]; });
+
+	uint32 output = 0;
+	for (uint32 i = 0; i < clusterCount; ++i)
+	{
+		const auto c     = order[i];
+		const auto count = (clusters[c + 1] - clusters[c]) * 3;
+		std::memcpy(destination + output, &source[clusters[c] * 3], sizeof(uint32) * count);
+		output += count;
+	}
+}
+
+/****************************************************************************
+*                     GenerateVertexFetchRemap
+*************************************************************************//**
+*  @fn        gu::uint32 MeshOptimizer::GenerateVertexFetchRemap(gu::uint32* remap, const gu::uint32* indices, const gu::uint32 indexCount, const gu::uint32 vertexCount)
+*
+*  @brief     Number the vertices in the first use order of the index buffer, so the vertex fetch walks the buffer forward.
+*             Unreferenced vertices are INVALID_INDEX and removed by RemapVertexBuffer.
+*
+*  @param[out] gu::uint32* remap (size vertexCount)
+*  @param[in]  const gu::uint32* indices
+*  @param[in]  const gu::uint32 indexCount
+*  @param[in]  const gu::uint32 vertexCount
+*
+*  @return    gu::uint32 referenced vertex count
+*****************************************************************************/
+gu::uint32 MeshOptimizer::GenerateVertexFetchRemap(gu::uint32* remap, const gu::uint32* indices, const gu::uint32 indexCount, const gu::uint32 vertexCount)
+{
+	std::fill(remap, remap + vertexCount, INVALID_INDEX);
+
+	uint32 next = 0;
+	for (uint32 i = 0; i < indexCount; ++i)
+	{
+		const auto vertex = indices[i];
+		if (remap[vertex] == INVALID_INDEX) { remap[vertex] = next++; }
+	}
+	return next;
+}
+
+/****************************************************************************
+*                     BuildMeshlets
+*************************************************************************//**
+*  @fn        gu::uint32 MeshOptimizer::BuildMeshlets(MeshletData& meshlets, const gu::uint32* indices, const gu::uint32 indexCount,
+*             const void* vertices, const gu::uint32 vertexCount, const gu::uint32 vertexStride, const gu::uint32 positionOffset,
+*             const gu::uint32 maxVertices, const gu::uint32 maxTriangles, const float coneWeight)
+*
+*  @brief     Greedy meshlet growth. The next triangle shares a vertex with the meshlet, adds the fewest new vertices,
+*             and is the closest to the meshlet centroid (the distance grows with the normal deviation by coneWeight).
+*             When no adjacent triangle is left, the closest of the next remaining triangles in the index order is taken.
+*
+*  @param[out] MeshletData& meshlets (appended)
+*  @param[in]  const gu::uint32* indices
+*  @param[in]  const gu::uint32 indexCount
+*  @param[in]  const void* vertices
+*  @param[in]  const gu::uint32 vertexCount
+*  @param[in]  const gu::uint32 vertexStride
+*  @param[in]  const gu::uint32 positionOffset
+*  @param[in]  const gu::uint32 maxVertices  [3, MAX_MESHLET_VERTICES]
+*  @param[in]  const gu::uint32 maxTriangles [1, MAX_MESHLET_TRIANGLES]
+*  @param[in]  const float coneWeight [0, 1]
+*
+*  @return    gu::uint32 added meshlet count
+*****************************************************************************/
+gu::uint32 MeshOptimizer::BuildMeshlets(MeshletData& meshlets, const gu::uint32* indices, const gu::uint32 indexCount,
+	const void* vertices, const gu::uint32 vertexCount, const gu::uint32 vertexStride, const gu::uint32 positionOffset,
+	const gu::uint32 maxVertices, const gu::uint32 maxTriangles, const float coneWeight)
+{
+	const auto vertexLimit   = (std::min)((std::max)(maxVertices , 3u), MAX_MESHLET_VERTICES);
+	const auto triangleLimit = (std::min)((std::max)(maxTriangles, 1u), MAX_MESHLET_TRIANGLES);
+
+	const auto triangleCount = indexCount / 3;
+	if (triangleCount == 0) { return 0; }
+
+	const auto* bytes = static_cast<const uint8*>(vertices);
+
+	/*-------------------------------------------------------------------
+	-            Triangle centroid and unit normal
+	---------------------------------------------------------------------*/
+	gu::DynamicArray<Position> centroids(triangleCount, Position());
+	gu::DynamicArray<Position> normals  (triangleCount, Position());
+	for (uint32 t = 0; t < triangleCount; ++t)
+	{
+		const auto p0 = LoadPosition(bytes, vertexStride, positionOffset, indices[t * 3 + 0]);
+		const auto p1 = LoadPosition(bytes, vertexStride, positionOffset, indices[t * 3 + 1]);
+		const auto p2 = LoadPosition(bytes, vertexStride, positionOffset, indices[t * 3 + 2]);
+		centroids[t] = (p0 + p1 + p2) * (1.0f / 3.0f);
+		normals  [t] = Normalize(Cross(p1 - p0, p2 - p0));
+	}
+
+	TriangleAdjacency adjacency(indices, indexCount, vertexCount);
+
+	gu::DynamicArray<uint8>  isEmitted  (triangleCount, 0);
+	gu::DynamicArray<uint16> localIndices(vertexCount, INVALID_LOCAL_INDEX);
+
+	const auto firstMeshlet = static_cast<uint32>(meshlets.Meshlets.Size());
+
+	Meshlet  meshlet     = { static_cast<uint32>(meshlets.VertexIndices.Size()), static_cast<uint32>(meshlets.Triangles.Size()), 0, 0 };
+	Position centroidSum = {};
+	Position normalSum   = {};
+
+	const auto CountNewVertices = [&](const uint32 t)
+	{
+		const auto a = indices[t * 3], b = indices[t * 3 + 1], c = indices[t * 3 + 2];
+		return static_cast<uint32>(localIndices[a] == INVALID_LOCAL_INDEX)
+			 + static_cast<uint32>(localIndices[b] == INVALID_LOCAL_INDEX && b != a)
+			 + static_cast<uint32>(localIndices[c] == INVALID_LOCAL_INDEX && c != a && c != b);
+	};
+
+	const auto Flush = [&]()
+	{
+		if (meshlet.TriangleCount == 0) { return; }
+
+		meshlets.Meshlets.Push(meshlet);
+		meshlets.Bounds  .Push(ComputeMeshletBounds(meshlets, meshlet, bytes, vertexStride, positionOffset));
+
+		for (uint32 i = 0; i < meshlet.VertexCount; ++i) { localIndices[meshlets.VertexIndices[meshlet.VertexOffset + i]] = INVALID_LOCAL_INDEX; }
+
+		meshlet     = { static_cast<uint32>(meshlets.VertexIndices.Size()), static_cast<uint32>(meshlets.Triangles.Size()), 0, 0 };
+		centroidSum = {};
+		normalSum   = {};
+	};
+
+	const auto AddTriangle = [&](const uint32 t)
+	{
+		uint32 packed = 0;
+		for (uint32 k = 0; k < 3; ++k)
+		{
+			const auto vertex = indices[t * 3 + k];
+			if (localIndices[vertex] == INVALID_LOCAL_INDEX)
+			{
+				localIndices[vertex] = static_cast<uint16>(meshlet.VertexCount++);
+				meshlets.VertexIndices.Push(vertex);
+			}
+			packed |= static_cast<uint32>(localIndices[vertex]) << (k * 8);
+			adjacency.Remove(vertex, t);
+		}
+
+		meshlets.Triangles.Push(packed);
+		meshlet.TriangleCount++;
+		isEmitted[t] = 1;
+
+		centroidSum = centroidSum + centroids[t];
+		normalSum   = normalSum   + normals[t];
+	};
+
+	uint32 cursor = 0;
+	for (uint32 emitted = 0; emitted < triangleCount; ++emitted)
+	{
+		uint32 bestTriangle = INVALID_INDEX;
+		uint32 bestExtra    = 4;
+		float  bestScore    = FLT_MAX;
+
+		if (meshlet.TriangleCount > 0)
+		{
+			const auto centroid = centroidSum * (1.0f / static_cast<float>(meshlet.TriangleCount));
+			const auto normal   = Normalize(normalSum);
+
+			const auto Score = [&](const uint32 t)
+			{
+				const auto  d = centroids[t] - centroid;
+				const float deviation = 1.0f - Dot(normals[t], normal);
+				return Dot(d, d) * (1.0f + coneWeight * deviation);
+			};
+
+			/*-------------------------------------------------------------------
+			-            Triangles sharing a vertex with the meshlet
+			---------------------------------------------------------------------*/
+			for (uint32 i = 0; i < meshlet.VertexCount; ++i)
+			{
+				const auto vertex = meshlets.VertexIndices[meshlet.VertexOffset + i];
+				for (auto* t = adjacency.Begin(vertex); t != adjacency.End(vertex); ++t)
+				{
+					const auto extra = CountNewVertices(*t);
+					if (meshlet.VertexCount + extra > vertexLimit || extra > bestExtra) { continue; }
+
+					const float score = Score(*t);
+					if (extra < bestExtra || score < bestScore)
+					{
+						bestTriangle = *t; bestExtra = extra; bestScore = score;
+					}
+				}
+			}
+
+			/*-------------------------------------------------------------------
+			-            Closest of the next remaining triangles
+			---------------------------------------------------------------------*/
+			if (bestTriangle == INVALID_INDEX)
+			{
+				while (isEmitted[cursor]) { ++cursor; }
+				for (uint32 t = cursor; t < triangleCount && t < cursor + MESHLET_SEED_SEARCH_COUNT; ++t)
+				{
+					if (isEmitted[t] || meshlet.VertexCount + CountNewVertices(t) > vertexLimit) { continue; }
+
+					const float score = Score(t);
+					if (score < bestScore) { bestTriangle = t; bestScore = score; }
+				}
+			}
+
+			if (bestTriangle == INVALID_INDEX) { Flush(); }
+		}
+
+		if (bestTriangle == INVALID_INDEX)
+		{
+			while (isEmitted[cursor]) { ++cursor; }
+			bestTriangle = cursor;
+		}
+
+		AddTriangle(bestTriangle);
+
+		if (meshlet.TriangleCount == triangleLimit) { Flush(); }
+	}
+	Flush();
+
+	return static_cast<uint32>(meshlets.Meshlets.Size()) - firstMeshlet;
+}
+#pragma endregion Main Function
+
+#pragma region Analysis
+/****************************************************************************
+*                     AnalyzeVertexCache
+*************************************************************************//**
+*  @fn        VertexCacheStatistics MeshOptimizer::AnalyzeVertexCache(const gu::uint32* indices, const gu::uint32 indexCount, const gu::uint32 vertexCount, const gu::uint32 cacheSize)
+*
+*  @brief     Simulate a FIFO post-transform cache
+*
+*  @param[in] const gu::uint32* indices
+*  @param[in] const gu::uint32 indexCount
+*  @param[in] const gu::uint32 vertexCount
+*  @param[in] const gu::uint32 cacheSize
+*
+*  @return    VertexCacheStatistics
+*****************************************************************************/
+VertexCacheStatistics MeshOptimizer::AnalyzeVertexCache(const gu::uint32* indices, const gu::uint32 indexCount, const gu::uint32 vertexCount, const gu::uint32 cacheSize)
+{
+	VertexCacheStatistics statistics = {};
+
+	const auto triangleCount = indexCount / 3;
+	if (triangleCount == 0) { return statistics; }
+
+	gu::DynamicArray<uint32> insertTimes(vertexCount, 0);
+	gu::DynamicArray<uint8>  isReferenced(vertexCount, 0);
+	uint32 time            = cacheSize + 1;
+	uint32 referencedCount = 0;
+
+	for (uint32 t = 0; t < triangleCount; ++t)
+	{
+		statistics.VertexTransformCount += UpdateFIFOCache(&indices[t * 3], insertTimes, time, cacheSize);
+
+		for (uint32 k = 0; k < 3; ++k)
+		{
+			if (!isReferenced[indices[t * 3 + k]]) { isReferenced[indices[t * 3 + k]] = 1; referencedCount++; }
+		}
+	}
+
+	statistics.ACMR = static_cast<float>(statistics.VertexTransformCount) / static_cast<float>(triangleCount);
+	statistics.ATVR = static_cast<float>(statistics.VertexTransformCount) / static_cast<float>(referencedCount);
+	return statistics;
+}
+
+/****************************************************************************
+*                     AnalyzeVertexFetch
+*************************************************************************//**
+*  @fn        VertexFetchStatistics MeshOptimizer::AnalyzeVertexFetch(const gu::uint32* indices, const gu::uint32 indexCount, const gu::uint32 vertexCount, const gu::uint32 vertexStride)
+*
+*  @brief     Simulate the vertex fetch through a direct mapped cache
+*
+*  @param[in] const gu::uint32* indices
+*  @param[in] const gu::uint32 indexCount
+*  @param[in] const gu::uint32 vertexCount
+*  @param[in] const gu::uint32 vertexStride
+*
+*  @return    VertexFetchStatistics
+*****************************************************************************/
+VertexFetchStatistics MeshOptimizer::AnalyzeVertexFetch(const gu::uint32* indices, const gu::uint32 indexCount, const gu::uint32 vertexCount, const gu::uint32 vertexStride)
+{
+	VertexFetchStatistics statistics = {};
+	if (indexCount == 0 || vertexStride == 0) { return statistics; }
+
+	uint64 lineTags[FETCH_CACHE_LINE_COUNT];
+	std::fill(lineTags, lineTags + FETCH_CACHE_LINE_COUNT, ~0ull);
+
+	gu::DynamicArray<uint8> isReferenced(vertexCount, 0);
+	uint32 referencedCount = 0;
+
+	for (uint32 i = 0; i < indexCount; ++i)
+	{
+		const auto vertex = indices[i];
+		if (!isReferenced[vertex]) { isReferenced[vertex] = 1; referencedCount++; }
+
+		const auto beginLine = static_cast<uint64>(vertex) * vertexStride / FETCH_CACHE_LINE_SIZE;
+		const auto endLine   = (static_cast<uint64>(vertex) * vertexStride + vertexStride - 1) / FETCH_CACHE_LINE_SIZE;
+		for (auto line = beginLine; line <= endLine; ++line)
+		{
+			auto& tag = lineTags[line % FETCH_CACHE_LINE_COUNT];
+			if (tag != line)
+			{
+				tag = line;
+				statistics.BytesFetched += FETCH_CACHE_LINE_SIZE;
+			}
+		}
+	}
+
+	statistics.Overfetch = static_cast<float>(statistics.BytesFetched) / static_cast<float>(static_cast<uint64>(referencedCount) * vertexStride);
+	return statistics;
+}
+
+/****************************************************************************
+*                     AnalyzeMeshlets
+*************************************************************************//**
+*  @fn        MeshletStatistics MeshOptimizer::AnalyzeMeshlets(const MeshletData& meshlets, const gu::uint32 uniqueVertexCount)
+*
+*  @brief     Meshlet occupancy, vertex duplication and cone ratio
+*
+*  @param[in] const MeshletData& meshlets
+*  @param[in] const gu::uint32 uniqueVertexCount
+*
+*  @return    MeshletStatistics
+*****************************************************************************/
+MeshletStatistics MeshOptimizer::AnalyzeMeshlets(const MeshletData& meshlets, const gu::uint32 uniqueVertexCount)
+{
+	MeshletStatistics statistics = {};
+	statistics.MeshletCount = static_cast<uint32>(meshlets.Meshlets.Size());
+	if (statistics.MeshletCount == 0) { return statistics; }
+
+	uint64 vertexCount = 0;
+	uint32 coneCount   = 0;
+	for (uint64 i = 0; i < meshlets.Meshlets.Size(); ++i)
+	{
+		vertexCount              += meshlets.Meshlets[i].VertexCount;
+		statistics.TriangleCount += meshlets.Meshlets[i].TriangleCount;
+		coneCount                += meshlets.Bounds[i].HasCone() ? 1 : 0;
+	}
+
+	const auto meshletCount = static_cast<float>(statistics.MeshletCount);
+	statistics.AverageVertexCount   = static_cast<float>(vertexCount) / meshletCount;
+	statistics.AverageTriangleCount = static_cast<float>(statistics.TriangleCount) / meshletCount;
+	statistics.VertexDuplication    = uniqueVertexCount > 0 ? static_cast<float>(vertexCount) / static_cast<float>(uniqueVertexCount) : 0.0f;
+	statistics.ConeRatio            = static_cast<float>(coneCount) / meshletCount;
+	return statistics;
+}
+#pragma endregion Analysis
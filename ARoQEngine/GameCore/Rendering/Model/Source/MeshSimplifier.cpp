@@ -0,0 +1,999 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   MeshSimplifier.cpp
+///             @brief  Quadric error edge collapse simplification and the LOD chain generation
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/MeshSimplifier.hpp"
+#include "../Include/MeshOptimizer.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace gc::core;
+
+namespace
+{
+	using gu::uint8;
+	using gu::uint32;
+	using gu::uint64;
+
+	constexpr uint32 INVALID_INDEX  = MeshSimplifier::INVALID_INDEX;
+	constexpr uint32 INVALID_OFFSET = MeshSimplifyVertexLayout::INVALID_OFFSET;
+
+	/* @brief : Weight of the planes through the border and seam edges compared to the triangle planes*/
+	constexpr float EDGE_PLANE_WEIGHT = 10.0f;
+
+	/* @brief : A pass collapses the edges up to this scale of the error at the collapse goal*/
+	constexpr double PASS_ERROR_SCALE = 1.5;
+
+	/* @brief : Collapses which rotate a triangle normal by more than about 75 degrees are rejected*/
+	constexpr float FLIP_COSINE = 0.25f;
+
+	/* @brief : Bisection steps of the error cap of a LOD level*/
+	constexpr uint32 LEVEL_SEARCH_ITERATIONS = 6;
+
+	/* @brief : The searched cap may keep 1 / LEVEL_SEARCH_TOLERANCE more indices than the whole budget*/
+	constexpr uint32 LEVEL_SEARCH_TOLERANCE = 20;
+
+	/*-------------------------------------------------------------------
+	-   Vertex kinds
+	-   Manifold : interior vertex with one attribute set
+	-   Border   : vertex on one open border loop
+	-   Seam     : two vertices with the same position on both sides of an attribute seam
+	-   Locked   : corners, complex vertices and the vertices locked by the caller
+	---------------------------------------------------------------------*/
+	enum class VertexKind : uint8
+	{
+		Manifold,
+		Border,
+		Seam,
+		Locked,
+		CountOf
+	};
+
+	constexpr uint32 KIND_COUNT = static_cast<uint32>(VertexKind::CountOf);
+
+	/* @brief : CAN_COLLAPSE[from][to]*/
+	constexpr bool CAN_COLLAPSE[KIND_COUNT][KIND_COUNT] =
+	{
+		{ true , true , true , true  },
+		{ false, true , false, false },
+		{ false, false, true , false },
+		{ false, false, false, false },
+	};
+
+	/* @brief : The edges between these kinds appear in both directions, so one direction is enough to find the candidate*/
+	constexpr bool HAS_OPPOSITE[KIND_COUNT][KIND_COUNT] =
+	{
+		{ true , true , true , true  },
+		{ true , false, true , false },
+		{ true , true , true , false },
+		{ true , false, false, false },
+	};
+
+	inline uint32 ToIndex(const VertexKind kind) { return static_cast<uint32>(kind); }
+
+	struct Position
+	{
+		float x = 0.0f;
+		float y = 0.0f;
+		float z = 0.0f;
+	};
+
+	inline Position operator-(const Position& a, const Position& b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+	inline Position operator*(const Position& a, const float s)     { return { a.x * s, a.y * s, a.z * s }; }
+
+	inline float Dot(const Position& a, const Position& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+	inline Position Cross(const Position& a, const Position& b)
+	{
+		return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+	}
+
+	inline float Length(const Position& a) { return std::sqrt(Dot(a, a)); }
+
+	inline Position Normalize(const Position& a)
+	{
+		const float length = Length(a);
+		return length > 1e-20f ? a * (1.0f / length) : Position();
+	}
+
+	inline Position LoadPosition(const uint8* vertices, const uint32 stride, const uint32 offset, const uint32 index)
+	{
+		Position position;
+		std::memcpy(&position, vertices + static_cast<uint64>(index) * stride + offset, sizeof(Position));
+		return position;
+	}
+
+	/* @brief : Bounding box minimum and the largest extent*/
+	void ComputeBounds(const uint8* vertices, const uint32 vertexCount, const MeshSimplifyVertexLayout& layout, Position& minimum, float& extent)
+	{
+		Position maximum = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+		minimum = { FLT_MAX, FLT_MAX, FLT_MAX };
+
+		for (uint32 i = 0; i < vertexCount; ++i)
+		{
+			const auto p = LoadPosition(vertices, layout.Stride, layout.PositionOffset, i);
+			minimum = { (std::min)(minimum.x, p.x), (std::min)(minimum.y, p.y), (std::min)(minimum.z, p.z) };
+			maximum = { (std::max)(maximum.x, p.x), (std::max)(maximum.y, p.y), (std::max)(maximum.z, p.z) };
+		}
+
+		extent = vertexCount == 0 ? 0.0f : (std::max)({ maximum.x - minimum.x, maximum.y - minimum.y, maximum.z - minimum.z });
+		if (vertexCount == 0) { minimum = {}; }
+	}
+
+	/****************************************************************************
+	*                     PositionRemap
+	*************************************************************************//**
+	*  @brief     Remap : the first vertex with the same position. Wedge : circular list of the vertices with the same position.
+	*             Only the used vertices are linked.
+	*****************************************************************************/
+	struct PositionRemap
+	{
+		gu::DynamicArray<uint32> Remap = {};
+		gu::DynamicArray<uint32> Wedge = {};
+
+		PositionRemap(const uint8* vertices, const uint32 vertexCount, const MeshSimplifyVertexLayout& layout, const gu::DynamicArray<uint8>& used)
+			: Remap(vertexCount, INVALID_INDEX), Wedge(vertexCount, INVALID_INDEX)
+		{
+			uint32 tableSize = 1;
+			while (tableSize < vertexCount * 2) { tableSize <<= 1; }
+			const uint32 mask = tableSize - 1;
+
+			gu::DynamicArray<uint32> table(tableSize, INVALID_INDEX);
+
+			for (uint32 v = 0; v < vertexCount; ++v)
+			{
+				if (!used[v]) { continue; }
+
+				// + 0.0f maps -0 to +0, so that the equal positions have the same hash
+				const auto p = LoadPosition(vertices, layout.Stride, layout.PositionOffset, v);
+				const float key[3] = { p.x + 0.0f, p.y + 0.0f, p.z + 0.0f };
+				uint32 bits[3] = {};
+				std::memcpy(bits, key, sizeof(bits));
+
+				uint32 bucket = ((bits[0] * 73856093u) ^ (bits[1] * 19349663u) ^ (bits[2] * 83492791u)) & mask;
+				for (uint32 probe = 0; ; ++probe)
+				{
+					const auto other = table[bucket];
+					if (other == INVALID_INDEX)
+					{
+						table[bucket] = v;
+						Remap[v] = v;
+						Wedge[v] = v;
+						break;
+					}
+
+					const auto q = LoadPosition(vertices, layout.Stride, layout.PositionOffset, other);
+					if (q.x == p.x && q.y == p.y && q.z == p.z)
+					{
+						Remap[v]     = other;
+						Wedge[v]     = Wedge[other];
+						Wedge[other] = v;
+						break;
+					}
+
+					bucket = (bucket + probe + 1) & mask;
+				}
+			}
+		}
+	};
+
+	/****************************************************************************
+	*                     EdgeAdjacency
+	*************************************************************************//**
+	*  @brief     Directed edges leaving each vertex. The edge v -> Next belongs to the triangle (v, Next, Prev).
+	*****************************************************************************/
+	struct EdgeAdjacency
+	{
+		struct Edge
+		{
+			uint32 Next = 0;
+			uint32 Prev = 0;
+		};
+
+		gu::DynamicArray<uint32> Offsets = {};
+		gu::DynamicArray<uint32> Counts  = {};
+		gu::DynamicArray<Edge>   Edges   = {};
+
+		void Build(const uint32* indices, const uint32 indexCount, const uint32 vertexCount)
+		{
+			Offsets = gu::DynamicArray<uint32>(vertexCount + 1, 0);
+			Counts  = gu::DynamicArray<uint32>(vertexCount, 0);
+			Edges   = gu::DynamicArray<Edge>(indexCount, Edge());
+
+			for (uint32 i = 0; i < indexCount; ++i) { Counts[indices[i]]++; }
+			for (uint32 v = 0; v < vertexCount; ++v) { Offsets[v + 1] = Offsets[v] + Counts[v]; Counts[v] = 0; }
+
+			for (uint32 i = 0; i < indexCount; i += 3)
+			{
+				const uint32 a = indices[i + 0], b = indices[i + 1], c = indices[i + 2];
+				Edges[Offsets[a] + Counts[a]++] = { b, c };
+				Edges[Offsets[b] + Counts[b]++] = { c, a };
+				Edges[Offsets[c] + Counts[c]++] = { a, b };
+			}
+		}
+
+		const Edge* Begin(const uint32 vertex) const { return Edges.Data() + Offsets[vertex]; }
+		const Edge* End  (const uint32 vertex) const { return Edges.Data() + Offsets[vertex] + Counts[vertex]; }
+
+		bool HasEdge(const uint32 from, const uint32 to) const
+		{
+			for (const auto* edge = Begin(from); edge != End(from); ++edge)
+			{
+				if (edge->Next == to) { return true; }
+			}
+			return false;
+		}
+	};
+
+	/****************************************************************************
+	*                     Quadric
+	*************************************************************************//**
+	*  @brief     Sum of the weighted squared plane distances. Error returns the weighted average.
+	*****************************************************************************/
+	struct Quadric
+	{
+		double A00 = 0.0, A11 = 0.0, A22 = 0.0;
+		double A10 = 0.0, A20 = 0.0, A21 = 0.0;
+		double B0  = 0.0, B1  = 0.0, B2  = 0.0;
+		double C   = 0.0;
+		double W   = 0.0;
+
+		void AddPlane(const Position& n, const float d, const double weight)
+		{
+			A00 += weight * n.x * n.x; A11 += weight * n.y * n.y; A22 += weight * n.z * n.z;
+			A10 += weight * n.y * n.x; A20 += weight * n.z * n.x; A21 += weight * n.z * n.y;
+			B0  += weight * d * n.x;   B1  += weight * d * n.y;   B2  += weight * d * n.z;
+			C   += weight * d * d;
+			W   += weight;
+		}
+
+		void Add(const Quadric& q)
+		{
+			A00 += q.A00; A11 += q.A11; A22 += q.A22;
+			A10 += q.A10; A20 += q.A20; A21 += q.A21;
+			B0  += q.B0;  B1  += q.B1;  B2  += q.B2;
+			C   += q.C;
+			W   += q.W;
+		}
+
+		double Error(const Position& p) const
+		{
+			const double x = p.x, y = p.y, z = p.z;
+			const double r = A00 * x * x + A11 * y * y + A22 * z * z
+				+ 2.0 * (A10 * x * y + A20 * x * z + A21 * y * z)
+				+ 2.0 * (B0 * x + B1 * y + B2 * z) + C;
+			return W > 0.0 ? std::abs(r) / W : 0.0;
+		}
+	};
+
+	/****************************************************************************
+	*                     VertexAttributes
+	*************************************************************************//**
+	*  @brief     Squared attribute difference between a vertex and its collapse target
+	*****************************************************************************/
+	struct VertexAttributes
+	{
+		gu::DynamicArray<Position> Normals     = {};
+		gu::DynamicArray<float>    UVs         = {};
+		gu::DynamicArray<int>      BoneIndices = {};
+		gu::DynamicArray<float>    BoneWeights = {};
+
+		double NormalWeight = 0.0;
+		double UVWeight     = 0.0;
+		double SkinWeight   = 0.0;
+
+		VertexAttributes(const uint8* vertices, const uint32 vertexCount, const MeshSimplifyVertexLayout& layout, const MeshLODSettings& settings)
+		{
+			if (layout.NormalOffset != INVALID_OFFSET && settings.NormalWeight > 0.0f)
+			{
+				NormalWeight = static_cast<double>(settings.NormalWeight) * settings.NormalWeight;
+				Normals = gu::DynamicArray<Position>(vertexCount, Position());
+				for (uint32 v = 0; v < vertexCount; ++v)
+				{
+					Normals[v] = Normalize(LoadPosition(vertices, layout.Stride, layout.NormalOffset, v));
+				}
+			}
+
+			if (layout.UVOffset != INVALID_OFFSET && settings.UVWeight > 0.0f)
+			{
+				UVWeight = static_cast<double>(settings.UVWeight) * settings.UVWeight;
+				UVs = gu::DynamicArray<float>(static_cast<uint64>(vertexCount) * 2, 0.0f);
+				for (uint32 v = 0; v < vertexCount; ++v)
+				{
+					std::memcpy(&UVs[static_cast<uint64>(v) * 2], vertices + static_cast<uint64>(v) * layout.Stride + layout.UVOffset, sizeof(float) * 2);
+				}
+			}
+
+			if (layout.BoneIndexOffset != INVALID_OFFSET && layout.BoneWeightOffset != INVALID_OFFSET && settings.SkinWeight > 0.0f)
+			{
+				SkinWeight = static_cast<double>(settings.SkinWeight) * settings.SkinWeight;
+				BoneIndices = gu::DynamicArray<int>  (static_cast<uint64>(vertexCount) * 4, 0);
+				BoneWeights = gu::DynamicArray<float>(static_cast<uint64>(vertexCount) * 4, 0.0f);
+				for (uint32 v = 0; v < vertexCount; ++v)
+				{
+					const auto* vertex = vertices + static_cast<uint64>(v) * layout.Stride;
+					std::memcpy(&BoneIndices[static_cast<uint64>(v) * 4], vertex + layout.BoneIndexOffset , sizeof(int)   * 4);
+					std::memcpy(&BoneWeights[static_cast<uint64>(v) * 4], vertex + layout.BoneWeightOffset, sizeof(float) * 4);
+				}
+			}
+		}
+
+		/* @brief : Total variation distance of the bone weights ([0, 1])*/
+		double SkinDistance(const uint32 a, const uint32 b) const
+		{
+			int   bones[8]   = {};
+			float weightA[8] = {};
+			float weightB[8] = {};
+			uint32 count = 0;
+
+			const auto Accumulate = [&](const uint32 vertex, float* weights)
+			{
+				for (uint32 i = 0; i < 4; ++i)
+				{
+					const float weight = BoneWeights[static_cast<uint64>(vertex) * 4 + i];
+					if (weight <= 0.0f) { continue; }
+
+					const int bone = BoneIndices[static_cast<uint64>(vertex) * 4 + i];
+					uint32 slot = 0;
+					while (slot < count && bones[slot] != bone) { ++slot; }
+					if (slot == count) { bones[count++] = bone; }
+					weights[slot] += weight;
+				}
+			};
+			Accumulate(a, weightA);
+			Accumulate(b, weightB);
+
+			double distance = 0.0;
+			for (uint32 i = 0; i < count; ++i) { distance += std::abs(weightA[i] - weightB[i]); }
+			return 0.5 * distance;
+		}
+
+		double Penalty(const uint32 vertex, const uint32 target) const
+		{
+			double penalty = 0.0;
+			if (NormalWeight > 0.0)
+			{
+				const auto d = Normals[vertex] - Normals[target];
+				penalty += NormalWeight * Dot(d, d);
+			}
+			if (UVWeight > 0.0)
+			{
+				const double du = UVs[static_cast<uint64>(vertex) * 2 + 0] - UVs[static_cast<uint64>(target) * 2 + 0];
+				const double dv = UVs[static_cast<uint64>(vertex) * 2 + 1] - UVs[static_cast<uint64>(target) * 2 + 1];
+				penalty += UVWeight * (du * du + dv * dv);
+			}
+			if (SkinWeight > 0.0)
+			{
+				const double distance = SkinDistance(vertex, target);
+				penalty += SkinWeight * distance * distance;
+			}
+			return penalty;
+		}
+	};
+
+	/****************************************************************************
+	*                     ClassifyVertices
+	*************************************************************************//**
+	*  @brief     The open edges (no opposite edge in the attribute topology) tell the borders and the seams apart.
+	*             OpenIncoming / OpenOutgoing : the single open neighbor, INVALID_INDEX for none, the vertex itself for several.
+	*****************************************************************************/
+	gu::DynamicArray<VertexKind> ClassifyVertices(const EdgeAdjacency& adjacency, const PositionRemap& positions,
+		const gu::DynamicArray<uint8>& used, const bool* lockedVertices, const uint32 vertexCount)
+	{
+		gu::DynamicArray<uint32> openIncoming(vertexCount, INVALID_INDEX);
+		gu::DynamicArray<uint32> openOutgoing(vertexCount, INVALID_INDEX);
+
+		for (uint32 v = 0; v < vertexCount; ++v)
+		{
+			for (const auto* edge = adjacency.Begin(v); edge != adjacency.End(v); ++edge)
+			{
+				const auto target = edge->Next;
+				if (adjacency.HasEdge(target, v)) { continue; }
+
+				openIncoming[target] = openIncoming[target] == INVALID_INDEX ? v      : target;
+				openOutgoing[v]      = openOutgoing[v]      == INVALID_INDEX ? target : v;
+			}
+		}
+
+		const auto& remap = positions.Remap;
+		const auto& wedge = positions.Wedge;
+
+		gu::DynamicArray<VertexKind> kinds(vertexCount, VertexKind::Locked);
+		for (uint32 v = 0; v < vertexCount; ++v)
+		{
+			if (!used[v] || remap[v] != v) { continue; }
+
+			if (wedge[v] == v)
+			{
+				const auto incoming = openIncoming[v];
+				const auto outgoing = openOutgoing[v];
+
+				if (incoming == INVALID_INDEX && outgoing == INVALID_INDEX)
+				{
+					kinds[v] = VertexKind::Manifold;
+				}
+				else if (incoming != INVALID_INDEX && outgoing != INVALID_INDEX && incoming != v && outgoing != v)
+				{
+					kinds[v] = VertexKind::Border;
+				}
+			}
+			else if (wedge[wedge[v]] == v)
+			{
+				// The seam edges of one side run in the opposite direction on the other side
+				const auto w = wedge[v];
+				const auto incomingV = openIncoming[v], outgoingV = openOutgoing[v];
+				const auto incomingW = openIncoming[w], outgoingW = openOutgoing[w];
+
+				if (incomingV != INVALID_INDEX && outgoingV != INVALID_INDEX && incomingV != v && outgoingV != v &&
+					incomingW != INVALID_INDEX && outgoingW != INVALID_INDEX && incomingW != w && outgoingW != w &&
+					remap[incomingV] == remap[outgoingW] && remap[outgoingV] == remap[incomingW])
+				{
+					kinds[v] = VertexKind::Seam;
+				}
+			}
+		}
+
+		if (lockedVertices)
+		{
+			for (uint32 v = 0; v < vertexCount; ++v)
+			{
+				if (used[v] && lockedVertices[v]) { kinds[remap[v]] = VertexKind::Locked; }
+			}
+		}
+
+		for (uint32 v = 0; v < vertexCount; ++v)
+		{
+			if (used[v]) { kinds[v] = kinds[remap[v]]; }
+		}
+		return kinds;
+	}
+
+	/* @brief : The other side of the seam edge vertex -> target. INVALID_INDEX when the seam does not continue on the other side.*/
+	uint32 FindSeamPartner(const EdgeAdjacency& adjacency, const PositionRemap& positions, const uint32 vertex, const uint32 target)
+	{
+		const auto w = positions.Wedge[vertex];
+		for (auto candidate = positions.Wedge[target]; candidate != target; candidate = positions.Wedge[candidate])
+		{
+			if (adjacency.HasEdge(w, candidate) || adjacency.HasEdge(candidate, w)) { return candidate; }
+		}
+		return INVALID_INDEX;
+	}
+
+	/* @brief : Whether moving vertex onto target flips or folds a remaining triangle around vertex*/
+	bool HasTriangleFlips(const EdgeAdjacency& adjacency, const gu::DynamicArray<Position>& positions,
+		const gu::DynamicArray<uint32>& collapseRemap, const gu::DynamicArray<uint32>& remap, const uint32 vertex, const uint32 target)
+	{
+		const auto& v = positions[vertex];
+		const auto& t = positions[target];
+
+		for (const auto* edge = adjacency.Begin(vertex); edge != adjacency.End(vertex); ++edge)
+		{
+			const auto a = collapseRemap[edge->Next];
+			const auto b = collapseRemap[edge->Prev];
+
+			// the triangles on the collapsed edge disappear
+			if (remap[a] == remap[target] || remap[b] == remap[target]) { continue; }
+
+			const auto before = Cross(positions[a] - v, positions[b] - v);
+			const auto after  = Cross(positions[a] - t, positions[b] - t);
+			if (Dot(before, after) <= FLIP_COSINE * std::sqrt(Dot(before, before) * Dot(after, after))) { return true; }
+		}
+		return false;
+	}
+
+	struct Collapse
+	{
+		uint32 Vertex = 0;
+		uint32 Target = 0;
+		double Error  = 0.0;
+	};
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Main Function
+/****************************************************************************
+*                     Simplify
+*************************************************************************//**
+*  @fn        gu::uint32 MeshSimplifier::Simplify(gu::uint32* destination, const gu::uint32* indices, const gu::uint32 indexCount,
+*             const void* vertices, const gu::uint32 vertexCount, const MeshSimplifyVertexLayout& layout,
+*             const gu::uint32 targetIndexCount, const float targetError, const MeshLODSettings& settings,
+*             const bool* lockedVertices, float* resultError)
+*
+*  @brief     Garland-Heckbert quadric simplification with half edge collapses.
+*             Each pass collects the cheapest collapse of every edge, sorts them and applies the ones which do not touch
+*             an already collapsed vertex, until the triangle goal or the error limit is reached.
+*
+*  @param[out] gu::uint32* destination
+*  @param[in]  const gu::uint32* indices
+*  @param[in]  const gu::uint32 indexCount
+*  @param[in]  const void* vertices
+*  @param[in]  const gu::uint32 vertexCount
+*  @param[in]  const MeshSimplifyVertexLayout& layout
+*  @param[in]  const gu::uint32 targetIndexCount
+*  @param[in]  const float targetError (relative to the mesh extent)
+*  @param[in]  const MeshLODSettings& settings (attribute weights)
+*  @param[in]  const bool* lockedVertices
+*  @param[out] float* resultError (relative to the mesh extent)
+*
+*  @return    gu::uint32 index count
+*****************************************************************************/
+gu::uint32 MeshSimplifier::Simplify(gu::uint32* destination, const gu::uint32* indices, const gu::uint32 indexCount,
+	const void* vertices, const gu::uint32 vertexCount, const MeshSimplifyVertexLayout& layout,
+	const gu::uint32 targetIndexCount, const float targetError, const MeshLODSettings& settings,
+	const bool* lockedVertices, float* resultError)
+{
+	Checkf(indexCount % 3 == 0, "The index buffer is not a triangle list");
+	Checkf(layout.PositionOffset + sizeof(float) * 3 <= layout.Stride, "The position is out of the vertex");
+
+	if (destination != indices && indexCount > 0) { std::memmove(destination, indices, sizeof(uint32) * indexCount); }
+	if (resultError) { *resultError = 0.0f; }
+
+	if (indexCount <= targetIndexCount || indexCount == 0) { return indexCount; }
+
+	const auto* bytes = static_cast<const uint8*>(vertices);
+
+	/*-------------------------------------------------------------------
+	-            Positions scaled into the unit cube, so the errors are relative
+	---------------------------------------------------------------------*/
+	Position minimum = {};
+	float    extent  = 0.0f;
+	ComputeBounds(bytes, vertexCount, layout, minimum, extent);
+	const float inverseExtent = extent > 0.0f ? 1.0f / extent : 0.0f;
+
+	gu::DynamicArray<Position> positions(vertexCount, Position());
+	for (uint32 v = 0; v < vertexCount; ++v)
+	{
+		positions[v] = (LoadPosition(bytes, layout.Stride, layout.PositionOffset, v) - minimum) * inverseExtent;
+	}
+
+	/*-------------------------------------------------------------------
+	-            Topology
+	---------------------------------------------------------------------*/
+	gu::DynamicArray<uint8> used(vertexCount, 0);
+	for (uint32 i = 0; i < indexCount; ++i)
+	{
+		Checkf(indices[i] < vertexCount, "The index is out of the vertex buffer");
+		used[indices[i]] = 1;
+	}
+
+	const PositionRemap positionRemap(bytes, vertexCount, layout, used);
+	const auto& remap = positionRemap.Remap;
+	const auto& wedge = positionRemap.Wedge;
+
+	EdgeAdjacency adjacency = {};
+	adjacency.Build(destination, indexCount, vertexCount);
+
+	const auto kinds = ClassifyVertices(adjacency, positionRemap, used, lockedVertices, vertexCount);
+	const auto KindOf = [&](const uint32 v) { return ToIndex(kinds[v]); };
+
+	const VertexAttributes attributes(bytes, vertexCount, layout, settings);
+
+	/*-------------------------------------------------------------------
+	-            Quadrics (shared by the vertices with the same position)
+	---------------------------------------------------------------------*/
+	gu::DynamicArray<Quadric> quadrics(vertexCount, Quadric());
+	for (uint32 i = 0; i < indexCount; i += 3)
+	{
+		const uint32 triangle[3] = { destination[i], destination[i + 1], destination[i + 2] };
+		const auto& p0 = positions[triangle[0]];
+		const auto& p1 = positions[triangle[1]];
+		const auto& p2 = positions[triangle[2]];
+
+		const auto  normal = Cross(p1 - p0, p2 - p0);
+		const float area   = Length(normal);
+		if (area <= 0.0f) { continue; }
+
+		const auto n = normal * (1.0f / area);
+		for (uint32 k = 0; k < 3; ++k)
+		{
+			quadrics[remap[triangle[k]]].AddPlane(n, -Dot(n, p0), area);
+		}
+
+		// Planes perpendicular to the triangle through the border and seam edges keep their shape
+		for (uint32 k = 0; k < 3; ++k)
+		{
+			const auto i0 = triangle[k];
+			const auto i1 = triangle[k == 2 ? 0 : k + 1];
+			if (kinds[i0] != kinds[i1] || (kinds[i0] != VertexKind::Border && kinds[i0] != VertexKind::Seam)) { continue; }
+			if (adjacency.HasEdge(i1, i0)) { continue; }
+
+			const auto edge       = positions[i1] - positions[i0];
+			const auto edgeNormal = Normalize(Cross(edge, n));
+			const float weight    = Dot(edge, edge) * EDGE_PLANE_WEIGHT;
+
+			quadrics[remap[i0]].AddPlane(edgeNormal, -Dot(edgeNormal, positions[i0]), weight);
+			quadrics[remap[i1]].AddPlane(edgeNormal, -Dot(edgeNormal, positions[i0]), weight);
+		}
+	}
+
+	const auto CollapseError = [&](const uint32 vertex, const uint32 target)
+	{
+		double error = quadrics[remap[vertex]].Error(positions[target]) + attributes.Penalty(vertex, target);
+		if (kinds[vertex] == VertexKind::Seam)
+		{
+			const auto partner = FindSeamPartner(adjacency, positionRemap, vertex, target);
+			if (partner == INVALID_INDEX) { return DBL_MAX; }
+
+			error += attributes.Penalty(wedge[vertex], partner);
+		}
+		return error;
+	};
+
+	/*-------------------------------------------------------------------
+	-            Collapse passes
+	---------------------------------------------------------------------*/
+	const double errorLimitSquared = static_cast<double>(targetError) * targetError;
+	double maxError = 0.0;
+
+	gu::DynamicArray<Collapse> collapses     = {};
+	gu::DynamicArray<uint32>   collapseRemap(vertexCount, 0);
+	gu::DynamicArray<uint8>    collapseLocked(vertexCount, 0);
+
+	uint32 resultCount = indexCount;
+	bool   isFirstPass = true;
+	while (resultCount > targetIndexCount)
+	{
+		if (!isFirstPass) { adjacency.Build(destination, resultCount, vertexCount); }
+		isFirstPass = false;
+
+		/*-------------------------------------------------------------------
+		-            Cheapest direction of every collapsible edge
+		---------------------------------------------------------------------*/
+		collapses.Clear();
+		for (uint32 i = 0; i < resultCount; i += 3)
+		{
+			for (uint32 k = 0; k < 3; ++k)
+			{
+				const auto i0 = destination[i + k];
+				const auto i1 = destination[i + (k == 2 ? 0 : k + 1)];
+				const auto k0 = KindOf(i0);
+				const auto k1 = KindOf(i1);
+
+				if (!CAN_COLLAPSE[k0][k1] && !CAN_COLLAPSE[k1][k0]) { continue; }
+				if (HAS_OPPOSITE[k0][k1] && remap[i1] > remap[i0])  { continue; }
+
+				// Border and seam vertices move only along their own open edge
+				if (k0 == k1 && (kinds[i0] == VertexKind::Border || kinds[i0] == VertexKind::Seam) && adjacency.HasEdge(i1, i0)) { continue; }
+
+				const double error0 = CAN_COLLAPSE[k0][k1] ? CollapseError(i0, i1) : DBL_MAX;
+				const double error1 = CAN_COLLAPSE[k1][k0] ? CollapseError(i1, i0) : DBL_MAX;
+				if (error0 == DBL_MAX && error1 == DBL_MAX) { continue; }
+
+				collapses.Push(error0 <= error1 ? Collapse{ i0, i1, error0 } : Collapse{ i1, i0, error1 });
+			}
+		}
+		if (collapses.IsEmpty()) { break; }
+
+		std::sort(collapses.Data(), collapses.Data() + collapses.Size(),
+			[](const Collapse& a, const Collapse& b) { return a.Error < b.Error; });
+
+		/*-------------------------------------------------------------------
+		-            Error limit of this pass
+		---------------------------------------------------------------------*/
+		const uint32 triangleGoal = (resultCount - targetIndexCount) / 3;
+		const uint32 edgeGoal     = triangleGoal / 2;
+		const double errorGoal    = edgeGoal < collapses.Size() ? collapses[edgeGoal].Error * PASS_ERROR_SCALE : DBL_MAX;
+		const double errorLimit   = (std::min)(errorGoal, errorLimitSquared);
+
+		for (uint32 v = 0; v < vertexCount; ++v) { collapseRemap[v] = v; collapseLocked[v] = 0; }
+
+		/*-------------------------------------------------------------------
+		-            Apply the collapses from the cheapest one
+		---------------------------------------------------------------------*/
+		uint32 triangleCollapses = 0;
+		uint32 performedCount    = 0;
+		for (uint64 c = 0; c < collapses.Size(); ++c)
+		{
+			const auto& collapse = collapses[c];
+			if (collapse.Error > errorLimit || triangleCollapses >= triangleGoal) { break; }
+
+			const auto r0 = remap[collapse.Vertex];
+			const auto r1 = remap[collapse.Target];
+			if (collapseLocked[r0] || collapseLocked[r1]) { continue; }
+
+			const bool isSeam  = kinds[collapse.Vertex] == VertexKind::Seam;
+			const auto partner = isSeam ? FindSeamPartner(adjacency, positionRemap, collapse.Vertex, collapse.Target) : INVALID_INDEX;
+			if (isSeam && partner == INVALID_INDEX) { continue; }
+
+			if (HasTriangleFlips(adjacency, positions, collapseRemap, remap, collapse.Vertex, collapse.Target)) { continue; }
+			if (isSeam && HasTriangleFlips(adjacency, positions, collapseRemap, remap, wedge[collapse.Vertex], partner)) { continue; }
+
+			collapseRemap[collapse.Vertex] = collapse.Target;
+			if (isSeam) { collapseRemap[wedge[collapse.Vertex]] = partner; }
+
+			collapseLocked[r0] = 1;
+			collapseLocked[r1] = 1;
+			quadrics[r1].Add(quadrics[r0]);
+
+			triangleCollapses += kinds[collapse.Vertex] == VertexKind::Border ? 1 : 2;
+			maxError = (std::max)(maxError, collapse.Error);
+			performedCount++;
+		}
+		if (performedCount == 0) { break; }
+
+		/*-------------------------------------------------------------------
+		-            Remove the degenerate triangles
+		---------------------------------------------------------------------*/
+		uint32 writeCount = 0;
+		for (uint32 i = 0; i < resultCount; i += 3)
+		{
+			const auto a = collapseRemap[destination[i + 0]];
+			const auto b = collapseRemap[destination[i + 1]];
+			const auto c = collapseRemap[destination[i + 2]];
+			if (a == b || b == c || c == a) { continue; }
+
+			destination[writeCount + 0] = a;
+			destination[writeCount + 1] = b;
+			destination[writeCount + 2] = c;
+			writeCount += 3;
+		}
+		resultCount = writeCount;
+	}
+
+	if (resultError) { *resultError = static_cast<float>(std::sqrt(maxError)); }
+	return resultCount;
+}
+
+/****************************************************************************
+*                     GenerateLODs
+*************************************************************************//**
+*  @fn        gu::DynamicArray<MeshLODLevel> MeshSimplifier::GenerateLODs(gu::DynamicArray<gu::uint32>& lodIndices,
+*             const gu::uint32* indices, const gu::uint32 indexCount, const gu::uint32* subMeshIndexCounts, const gu::uint32 subMeshCount,
+*             const void* vertices, const gu::uint32 vertexCount, const MeshSimplifyVertexLayout& layout,
+*             const MeshLODSettings& settings, const bool* lockedVertices)
+*
+*  @brief     Simplify every sub mesh level by level. A level simplifies the previous level, so the errors are accumulated.
+*             The triangles of a level are reordered for the vertex cache.
+*
+*  @param[out] gu::DynamicArray<gu::uint32>& lodIndices (LOD1 or later are appended)
+*  @param[in]  const gu::uint32* indices (LOD0)
+*  @param[in]  const gu::uint32 indexCount
+*  @param[in]  const gu::uint32* subMeshIndexCounts (nullptr : one sub mesh)
+*  @param[in]  const gu::uint32 subMeshCount
+*  @param[in]  const void* vertices
+*  @param[in]  const gu::uint32 vertexCount
+*  @param[in]  const MeshSimplifyVertexLayout& layout
+*  @param[in]  const MeshLODSettings& settings
+*  @param[in]  const bool* lockedVertices
+*
+*  @return    gu::DynamicArray<MeshLODLevel> levels (levels[0] is LOD0)
+*****************************************************************************/
+gu::DynamicArray<MeshLODLevel> MeshSimplifier::GenerateLODs(gu::DynamicArray<gu::uint32>& lodIndices,
+	const gu::uint32* indices, const gu::uint32 indexCount,
+	const gu::uint32* subMeshIndexCounts, const gu::uint32 subMeshCount,
+	const void* vertices, const gu::uint32 vertexCount, const MeshSimplifyVertexLayout& layout,
+	const MeshLODSettings& settings, const bool* lockedVertices)
+{
+	/*-------------------------------------------------------------------
+	-            LOD0
+	---------------------------------------------------------------------*/
+	gu::DynamicArray<MeshLODLevel> levels = {};
+	{
+		MeshLODLevel level = {};
+		level.IndexOffset = 0;
+		level.IndexCount  = indexCount;
+		if (subMeshIndexCounts == nullptr || subMeshCount == 0)
+		{
+			level.SubMeshIndexCounts.Push(indexCount);
+		}
+		else
+		{
+			uint32 total = 0;
+			for (uint32 i = 0; i < subMeshCount; ++i)
+			{
+				Checkf(subMeshIndexCounts[i] % 3 == 0, "The sub mesh is not a triangle list");
+				level.SubMeshIndexCounts.Push(subMeshIndexCounts[i]);
+				total += subMeshIndexCounts[i];
+			}
+			Checkf(total == indexCount, "The sum of the sub mesh index counts differs from the index count");
+		}
+		levels.Push(level);
+	}
+
+	if (settings.MaxLODCount <= 1 || indexCount == 0) { return levels; }
+
+	const auto* bytes        = static_cast<const uint8*>(vertices);
+	const auto  subMeshTotal = static_cast<uint32>(levels[0].SubMeshIndexCounts.Size());
+
+	/*-------------------------------------------------------------------
+	-            Lock the positions used by several sub meshes, so the sub meshes do not crack apart
+	---------------------------------------------------------------------*/
+	gu::DynamicArray<bool> locked(vertexCount, false);
+	if (lockedVertices)
+	{
+		for (uint32 v = 0; v < vertexCount; ++v) { locked[v] = lockedVertices[v]; }
+	}
+
+	if (subMeshTotal > 1)
+	{
+		constexpr uint32 SHARED = INVALID_INDEX - 1;
+
+		gu::DynamicArray<uint8> used(vertexCount, 0);
+		for (uint32 i = 0; i < indexCount; ++i) { used[indices[i]] = 1; }
+
+		const PositionRemap positionRemap(bytes, vertexCount, layout, used);
+
+		gu::DynamicArray<uint32> owners(vertexCount, INVALID_INDEX);
+		uint32 offset = 0;
+		for (uint32 s = 0; s < subMeshTotal; ++s)
+		{
+			const auto count = levels[0].SubMeshIndexCounts[s];
+			for (uint32 i = offset; i < offset + count; ++i)
+			{
+				auto& owner = owners[positionRemap.Remap[indices[i]]];
+				owner = owner == INVALID_INDEX || owner == s ? s : SHARED;
+			}
+			offset += count;
+		}
+
+		for (uint32 v = 0; v < vertexCount; ++v)
+		{
+			if (used[v] && owners[positionRemap.Remap[v]] == SHARED) { locked[v] = true; }
+		}
+	}
+
+	/*-------------------------------------------------------------------
+	-            Levels
+	---------------------------------------------------------------------*/
+	const float scale = ComputeScale(vertices, vertexCount, layout);
+
+	uint32 maxSubMeshIndexCount = 0;
+	for (uint32 s = 0; s < subMeshTotal; ++s) { maxSubMeshIndexCount = (std::max)(maxSubMeshIndexCount, levels[0].SubMeshIndexCounts[s]); }
+
+	gu::DynamicArray<uint32> scratch(maxSubMeshIndexCount, 0);
+	gu::DynamicArray<uint32> levelIndices = {};
+	gu::DynamicArray<float>  subMeshErrors(subMeshTotal, 0.0f); // accumulated relative error
+
+	/*-------------------------------------------------------------------
+	-            Simplify every sub mesh of the previous level with one error cap (relative, accumulated over the levels)
+	-            The sub meshes whose result with the whole budget is already below the cap reuse that result.
+	---------------------------------------------------------------------*/
+	gu::DynamicArray<uint32> budgetIndices = {};
+	MeshLODLevel             budgetLevel   = {};
+	gu::DynamicArray<float>  budgetErrors  = {};
+
+	const auto SimplifyLevel = [&](const MeshLODLevel& previous, const float errorCap, const bool useBudget, MeshLODLevel& level, gu::DynamicArray<float>& errors)
+	{
+		levelIndices.Clear();
+		level.IndexCount = 0;
+		level.SubMeshIndexCounts.Clear();
+		errors = subMeshErrors;
+
+		float levelError = 0.0f;
+		uint32 sourceOffset = previous.IndexOffset;
+		uint32 budgetOffset = 0;
+		for (uint32 s = 0; s < subMeshTotal; ++s)
+		{
+			const auto  sourceCount = previous.SubMeshIndexCounts[s];
+			if (useBudget && budgetErrors[s] <= errorCap)
+			{
+				const auto count = budgetLevel.SubMeshIndexCounts[s];
+				for (uint32 i = 0; i < count; ++i) { levelIndices.Push(budgetIndices[budgetOffset + i]); }
+
+				errors[s]  = budgetErrors[s];
+				levelError = (std::max)(levelError, errors[s]);
+
+				level.SubMeshIndexCounts.Push(count);
+				level.IndexCount += count;
+				sourceOffset     += sourceCount;
+				budgetOffset     += count;
+				continue;
+			}
+			budgetOffset += useBudget ? budgetLevel.SubMeshIndexCounts[s] : 0;
+
+			const auto* source      = sourceOffset < indexCount ? indices + sourceOffset : lodIndices.Data() + (sourceOffset - indexCount);
+			if (sourceCount > 0) { std::memcpy(scratch.Data(), source, sizeof(uint32) * sourceCount); }
+
+			const auto  targetCount    = static_cast<uint32>(static_cast<float>(sourceCount / 3) * settings.ReductionRatio) * 3;
+			const float remainingError = (std::max)(0.0f, errorCap - errors[s]);
+
+			float error = 0.0f;
+			const auto count = Simplify(scratch.Data(), scratch.Data(), sourceCount, vertices, vertexCount, layout,
+				targetCount, remainingError, settings, locked.Data(), &error);
+
+			for (uint32 i = 0; i < count; ++i) { levelIndices.Push(scratch[i]); }
+
+			errors[s] += error;
+			levelError = (std::max)(levelError, errors[s]);
+
+			level.SubMeshIndexCounts.Push(count);
+			level.IndexCount += count;
+			sourceOffset     += sourceCount;
+		}
+		return levelError;
+	};
+
+	for (uint32 levelIndex = 1; levelIndex < settings.MaxLODCount; ++levelIndex)
+	{
+		// Each level is allowed a part of MaxError, so that the finer levels stay usable close to the camera.
+		const float levelBudget = settings.MaxError * std::pow(settings.ReductionRatio, static_cast<float>(settings.MaxLODCount - 1 - levelIndex));
+
+		const auto previous    = levels.Back();
+		const auto targetCount = static_cast<uint32>(static_cast<float>(previous.IndexCount / 3) * settings.ReductionRatio) * 3;
+
+		MeshLODLevel level = {};
+		level.IndexOffset = indexCount + static_cast<uint32>(lodIndices.Size());
+
+		gu::DynamicArray<float> errors = {};
+		float levelError = SimplifyLevel(previous, levelBudget, false, level, errors);
+
+		budgetIndices = levelIndices;
+		budgetLevel   = level;
+		budgetErrors  = errors;
+
+		/*-------------------------------------------------------------------
+		-   A sub mesh which cannot reach its target count (locked vertices, thin parts) spends the whole budget
+		-   and sets the error of the level. Search the smallest cap which keeps nearly the same triangle count.
+		---------------------------------------------------------------------*/
+		const auto goalCount = (std::max)(targetCount, level.IndexCount + level.IndexCount / LEVEL_SEARCH_TOLERANCE);
+		float lower = previous.Error / (std::max)(scale, FLT_MIN);
+		float upper = levelError;
+		for (uint32 iteration = 0; iteration < LEVEL_SEARCH_ITERATIONS && upper > lower * 1.1f; ++iteration)
+		{
+			const float cap = 0.5f * (lower + upper);
+
+			MeshLODLevel trial = {};
+			gu::DynamicArray<float> trialErrors = {};
+			SimplifyLevel(previous, cap, true, trial, trialErrors);
+			if (trial.IndexCount <= goalCount) { upper = cap; } else { lower = cap; }
+		}
+		if (upper < levelError) { levelError = SimplifyLevel(previous, upper, true, level, errors); }
+
+		// The simplification stalled (locked vertices or the error limit). The level would only cost memory.
+		if (static_cast<float>(level.IndexCount) > static_cast<float>(previous.IndexCount) * settings.StopRatio) { break; }
+		if (level.IndexCount == 0) { break; }
+
+		uint32 subMeshOffset = 0;
+		for (uint32 s = 0; s < subMeshTotal; ++s)
+		{
+			const auto count = level.SubMeshIndexCounts[s];
+			MeshOptimizer::OptimizeVertexCache(levelIndices.Data() + subMeshOffset, levelIndices.Data() + subMeshOffset, count, vertexCount);
+			subMeshOffset += count;
+		}
+		for (uint64 i = 0; i < levelIndices.Size(); ++i) { lodIndices.Push(levelIndices[i]); }
+
+		subMeshErrors = errors;
+		level.Error   = levelError * scale;
+		levels.Push(level);
+	}
+
+	return levels;
+}
+#pragma endregion Main Function
+
+#pragma region Analysis
+/****************************************************************************
+*                     ComputeScale
+*************************************************************************//**
+*  @fn        float MeshSimplifier::ComputeScale(const void* vertices, const gu::uint32 vertexCount, const MeshSimplifyVertexLayout& layout)
+*
+*  @brief     Largest extent of the vertex bounding box
+*
+*  @param[in] const void* vertices
+*  @param[in] const gu::uint32 vertexCount
+*  @param[in] const MeshSimplifyVertexLayout& layout
+*
+*  @return    float
+*****************************************************************************/
+float MeshSimplifier::ComputeScale(const void* vertices, const gu::uint32 vertexCount, const MeshSimplifyVertexLayout& layout)
+{
+	Position minimum = {};
+	float    extent  = 0.0f;
+	ComputeBounds(static_cast<const uint8*>(vertices), vertexCount, layout, minimum, extent);
+	return extent;
+}
+#pragma endregion Analysis
@@ -0,0 +1,214 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   VertexCompression.cpp
+///             @brief  Compressed vertex formats selected on model import
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/VertexCompression.hpp"
+#include "GameUtility/Math/Include/GMVectorPack.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace gc::core;
+
+namespace
+{
+	using gu::uint8;
+	using gu::uint16;
+	using gu::uint32;
+	using gu::uint64;
+
+	/*-------------------------------------------------------------------
+	-   The contiguous conversions (uv, color) go through the buffers of this vertex count
+	---------------------------------------------------------------------*/
+	constexpr uint32 CHUNK_VERTEX_COUNT = 1024;
+
+	constexpr double RADIAN_TO_DEGREE = 57.295779513082320876798;
+
+	template<class T>
+	inline const float* AsFloats(const T& value) { return reinterpret_cast<const float*>(&value); }
+
+	/*-------------------------------------------------------------------
+	-   Position (float32), octahedral normal and half uv, which both formats have
+	---------------------------------------------------------------------*/
+	template<class TCompressed, class TVertex>
+	void CompressCommon(TCompressed* destination, const TVertex* vertices, const uint32 vertexCount, VertexCompressionStatistics* statistics)
+	{
+		for (uint32 i = 0; i < vertexCount; ++i) { destination[i].Position = vertices[i].Position; }
+
+		gm::VectorPack::EncodeOctahedralNormalStream(destination[0].Normal, sizeof(TCompressed), AsFloats(vertices[0].Normal), sizeof(TVertex), vertexCount);
+
+		float  uvs  [CHUNK_VERTEX_COUNT * 2] = {};
+		uint16 halfs[CHUNK_VERTEX_COUNT * 2] = {};
+		float  normals[CHUNK_VERTEX_COUNT * 3] = {};
+
+		for (uint32 begin = 0; begin < vertexCount; begin += CHUNK_VERTEX_COUNT)
+		{
+			const uint32 count = std::min(CHUNK_VERTEX_COUNT, vertexCount - begin);
+
+			for (uint32 i = 0; i < count; ++i) { std::memcpy(&uvs[i * 2], AsFloats(vertices[begin + i].UV), sizeof(float) * 2); }
+			gm::VectorPack::ConvertFloatToHalfStream(halfs, uvs, count * 2);
+			for (uint32 i = 0; i < count; ++i) { std::memcpy(destination[begin + i].UV, &halfs[i * 2], sizeof(uint16) * 2); }
+
+			if (statistics == nullptr) { continue; }
+
+			/*-------------------------------------------------------------------
+			-        Error of the decoded uv and normal
+			---------------------------------------------------------------------*/
+			float decodedUVs[CHUNK_VERTEX_COUNT * 2] = {};
+			gm::VectorPack::ConvertHalfToFloatStream(decodedUVs, halfs, count * 2);
+			for (uint32 i = 0; i < count * 2; ++i)
+			{
+				statistics->MaxUVError = std::max(statistics->MaxUVError, std::abs(uvs[i] - decodedUVs[i]));
+			}
+
+			gm::VectorPack::DecodeOctahedralNormalStream(normals, sizeof(float) * 3, destination[begin].Normal, sizeof(TCompressed), count);
+			for (uint32 i = 0; i < count; ++i)
+			{
+				const float* source  = AsFloats(vertices[begin + i].Normal);
+				const float* decoded = &normals[i * 3];
+				const double ax = source [0], ay = source [1], az = source [2];
+				const double bx = decoded[0], by = decoded[1], bz = decoded[2];
+				if (!(ax * ax + ay * ay + az * az > 0.0)) { continue; }
+
+				// atan2(|a x b|, a . b) keeps the precision near 0 degree, where acos does not.
+				const double cx = ay * bz - az * by, cy = az * bx - ax * bz, cz = ax * by - ay * bx;
+				const double angle = std::atan2(std::sqrt(cx * cx + cy * cy + cz * cz), ax * bx + ay * by + az * bz) * RADIAN_TO_DEGREE;
+				statistics->MaxNormalErrorDegree = std::max(statistics->MaxNormalErrorDegree, static_cast<float>(angle));
+			}
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Public Function
+/****************************************************************************
+*                     Compress
+*************************************************************************//**
+*  @fn        void VertexCompressor::Compress(gm::CompressedVertex* destination, const gm::Vertex* vertices, const gu::uint32 vertexCount,
+*             VertexCompressionStatistics* statistics)
+*
+*  @brief     Compress the static mesh vertices (48 byte -> 24 byte)
+*
+*  @param[out]    gm::CompressedVertex* destination (vertexCount elements)
+*  @param[in]     const gm::Vertex* vertices
+*  @param[in]     const gu::uint32 vertexCount
+*  @param[out]    VertexCompressionStatistics* statistics (nullable)
+*
+*  @return    void
+*****************************************************************************/
+void VertexCompressor::Compress(gm::CompressedVertex* destination, const gm::Vertex* vertices, const gu::uint32 vertexCount,
+	VertexCompressionStatistics* statistics)
+{
+	Check(vertexCount == 0 || (destination && vertices));
+	if (vertexCount == 0) { return; }
+
+	if (statistics)
+	{
+		*statistics = {};
+		statistics->VertexCount = vertexCount;
+		statistics->BytesBefore = uint64(vertexCount) * sizeof(gm::Vertex);
+		statistics->BytesAfter  = uint64(vertexCount) * sizeof(gm::CompressedVertex);
+	}
+
+	CompressCommon(destination, vertices, vertexCount, statistics);
+
+	/*-------------------------------------------------------------------
+	-        Color : UNORM8x4
+	---------------------------------------------------------------------*/
+	float colors[CHUNK_VERTEX_COUNT * 4] = {};
+	uint8 bytes [CHUNK_VERTEX_COUNT * 4] = {};
+	for (uint32 begin = 0; begin < vertexCount; begin += CHUNK_VERTEX_COUNT)
+	{
+		const uint32 count = std::min(CHUNK_VERTEX_COUNT, vertexCount - begin);
+
+		for (uint32 i = 0; i < count; ++i) { std::memcpy(&colors[i * 4], AsFloats(vertices[begin + i].Color), sizeof(float) * 4); }
+		gm::VectorPack::ConvertFloatToUNorm8Stream(bytes, colors, count * 4);
+		for (uint32 i = 0; i < count; ++i) { std::memcpy(destination[begin + i].Color, &bytes[i * 4], sizeof(uint8) * 4); }
+	}
+}
+
+/****************************************************************************
+*                     Compress
+*************************************************************************//**
+*  @fn        void VertexCompressor::Compress(gm::CompressedSkinMeshVertex* destination, const gm::SkinMeshVertex* vertices, const gu::uint32 vertexCount,
+*             VertexCompressionStatistics* statistics)
+*
+*  @brief     Compress the skin mesh vertices (64 byte -> 32 byte)
+*
+*  @param[out]    gm::CompressedSkinMeshVertex* destination (vertexCount elements)
+*  @param[in]     const gm::SkinMeshVertex* vertices
+*  @param[in]     const gu::uint32 vertexCount
+*  @param[out]    VertexCompressionStatistics* statistics (nullable)
+*
+*  @return    void
+*****************************************************************************/
+void VertexCompressor::Compress(gm::CompressedSkinMeshVertex* destination, const gm::SkinMeshVertex* vertices, const gu::uint32 vertexCount,
+	VertexCompressionStatistics* statistics)
+{
+	Check(vertexCount == 0 || (destination && vertices));
+	if (vertexCount == 0) { return; }
+
+	if (statistics)
+	{
+		*statistics = {};
+		statistics->VertexCount = vertexCount;
+		statistics->BytesBefore = uint64(vertexCount) * sizeof(gm::SkinMeshVertex);
+		statistics->BytesAfter  = uint64(vertexCount) * sizeof(gm::CompressedSkinMeshVertex);
+	}
+
+	CompressCommon(destination, vertices, vertexCount, statistics);
+
+	/*-------------------------------------------------------------------
+	-        Bone weights : UNORM8x4 whose sum is 255
+	---------------------------------------------------------------------*/
+	gm::VectorPack::NormalizeBoneWeightStream(destination[0].BoneWeights, sizeof(gm::CompressedSkinMeshVertex),
+		vertices[0].BoneWeights, sizeof(gm::SkinMeshVertex), vertexCount);
+
+	/*-------------------------------------------------------------------
+	-        Bone indices : uint16
+	---------------------------------------------------------------------*/
+	for (uint32 i = 0; i < vertexCount; ++i)
+	{
+		for (uint32 k = 0; k < 4; ++k)
+		{
+			const int boneIndex = vertices[i].BoneIndices[k];
+			if (boneIndex > 0xFFFF && statistics) { ++statistics->BoneIndexOverflowCount; }
+
+			destination[i].BoneIndices[k] = (0 <= boneIndex && boneIndex <= 0xFFFF) ? static_cast<uint16>(boneIndex) : uint16(0);
+		}
+	}
+
+	if (statistics == nullptr) { return; }
+
+	/*-------------------------------------------------------------------
+	-        Error of the weights (same clamp as NormalizeBoneWeightStream)
+	---------------------------------------------------------------------*/
+	for (uint32 i = 0; i < vertexCount; ++i)
+	{
+		float weights[4] = {};
+		for (uint32 k = 0; k < 4; ++k) { weights[k] = vertices[i].BoneWeights[k] > 0.0f ? vertices[i].BoneWeights[k] : 0.0f; }
+
+		const float sum   = (weights[0] + weights[2]) + (weights[1] + weights[3]);
+		const float scale = 255.0f / sum;
+		if (!(scale > 0.0f && scale <= FLT_MAX)) { continue; } // (255, 0, 0, 0) is not the quantized weights
+
+		for (uint32 k = 0; k < 4; ++k)
+		{
+			const float error = std::abs(weights[k] / sum - destination[i].BoneWeights[k] / 255.0f);
+			statistics->MaxBoneWeightError = std::max(statistics->MaxBoneWeightError, error);
+		}
+	}
+}
+#pragma endregion Public Function
@@ -15,6 +15,7 @@
 #include "GameUtility/Base/Include/GUClassUtility.hpp"
 #include "GameUtility/Base/Include/GUSmartPointer.hpp"
 #include "GameUtility/Base/Include/GUString.hpp"
+#include "GameUtility/Container/Include/GUSortedMap.hpp"
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
@@ -35,6 +36,8 @@ namespace gc::ui
 	*************************************************************************//**
 	*  @class     FontLoader
 	*  @brief     Font load and register static class
+	*             The font image is the one line grid of the glyphs starting from FIRST_CODEPOINT (space),
+	*             and each glyph cell has pixelPerChar.x width.
 	*****************************************************************************/
 	class Font: public gu::NonCopyable
 	{
@@ -42,6 +45,12 @@ namespace gc::ui
 		using TexturePtr      = gu::SharedPointer<rhi::core::GPUTexture>;
 		using ResourceViewPtr = gu::SharedPointer<rhi::core::GPUResourceView>;
 	public:
+		/****************************************************************************
+		**                Static Configuration
+		*****************************************************************************/
+		/* @brief : Codepoint of the first glyph cell in the font image*/
+		static constexpr gu::uint32 FIRST_CODEPOINT = 32;
+
 		/****************************************************************************
 		**                Public Function
 		*****************************************************************************/
@@ -51,6 +60,17 @@ namespace gc::ui
 		/* @brief: Reset texture resource and infomation*/
 		void Reset();
 
+		/* @brief : Texture uv range of the glyph cell (u : [left, right], v : [top, bottom]). Return false if the font has no glyph.*/
+		bool GetGlyphUV(const gu::uint32 codepoint, gm::Float2& u, gm::Float2& v) const noexcept;
+
+		/* @brief : Register the kerning of the character pair. offset is the ratio to the character width (negative : closer)*/
+		void SetKerning(const gu::uint32 left, const gu::uint32 right, const float offset);
+
+		/* @brief : Kerning of the character pair (0 if not registered)*/
+		float GetKerning(const gu::uint32 left, const gu::uint32 right) const;
+
+		bool HasKerning() const noexcept { return !_kernings.IsEmpty(); }
+
 		/****************************************************************************
 		**                Public Member Variables
 		*****************************************************************************/
@@ -61,7 +81,10 @@ namespace gc::ui
 		TexturePtr GetFontTexture() const noexcept;
 
 		/* @brief : Call load function. (Has existed texture view pointer)*/
-		bool HasLoaded() const noexcept { return !_textureView; }
+		bool HasLoaded() const noexcept { return _textureView.IsValid(); }
+
+		/* @brief : Glyph cell count in the font image*/
+		gu::uint32 GetGlyphCount() const noexcept { return _pixelPerChar.x > 0.0f ? static_cast<gu::uint32>(_imagePixelWidth / _pixelPerChar.x) : 0; }
 		
 		/* @brief : Each character pixel size*/
 		const gm::Float2& GetPixelPerChar() const { return _pixelPerChar; }
@@ -96,6 +119,9 @@ namespace gc::ui
 
 		/* @brief : Texture and texture view resource*/
 		ResourceViewPtr _textureView    = nullptr;
+
+		/* @brief : (left << 32 | right) -> kerning offset*/
+		gu::SortedMap<gu::uint64, float> _kernings = {};
 	};
 }
 #endif
\ No newline at end of file
@@ -12,6 +12,7 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include "UIImage.hpp"
+#include "UITextureAtlas.hpp"
 #include "GameUtility/Base/Include/GUClassUtility.hpp"
 #include "GameUtility/Container/Include/GUDynamicArray.hpp"
 #include "GameUtility/Base/Include/GUString.hpp"
@@ -31,6 +32,10 @@ namespace rhi::core
 	class GPUResourceView;
 }
 struct Texture;
+namespace gc::ui
+{
+	class Text;
+}
 
 //////////////////////////////////////////////////////////////////////////////////
 //                         Template Class
@@ -42,17 +47,21 @@ namespace gc::ui
 	*************************************************************************//**
 	*  @class     UIRenderer
 	*  @brief     2D Sprite
+	*             The registered sprites are sorted by (layer, texture or atlas page) and the consecutive sprites
+	*             sharing the same view are drawn with one draw call.
+	*             In the same layer the textures are drawn in the order of their first registration,
+	*             so the overlapping sprites should use the different layers (larger layer is drawn later).
 	*****************************************************************************/
 	class UIRenderer : public gu::NonCopyable
 	{
 	protected:
 		using LowLevelGraphicsEnginePtr = gu::SharedPointer<LowLevelGraphicsEngine>;
-		using VertexBufferPtr   = gu::SharedPointer<rhi::core::GPUBuffer>;
 		using IndexBufferPtr    = gu::SharedPointer<rhi::core::GPUBuffer>;
 		using PipelineStatePtr  = gu::SharedPointer<rhi::core::GPUGraphicsPipelineState>;
 		using ResourceLayoutPtr = gu::SharedPointer<rhi::core::RHIResourceLayout>;
 		using ResourceViewPtr   = gu::SharedPointer<rhi::core::GPUResourceView>;
 		using ImagePtr = gu::SharedPointer<ui::Image>;
+		using TextureAtlasPtr   = gu::SharedPointer<TextureAtlas>;
 
 	public:
 		/****************************************************************************
@@ -62,7 +71,13 @@ namespace gc::ui
 
 		/* @brief : Add frame ui objects (image, text etc...)*/
 		//void AddFrameObjects(const gu::DynamicArray<ImagePtr>& images, const ResourceViewPtr& view);
-		void AddFrameObjects(const gu::DynamicArray<ui::Image>& images, const ResourceViewPtr& view);
+		void AddFrameObjects(const gu::DynamicArray<ui::Image>& images, const ResourceViewPtr& view, const gu::uint32 layer = 0);
+
+		/* @brief : Add the rect vertices (4 per rect) already built on the update stage (RenderSnapshot::UI)*/
+		void AddFrameVertices(const gm::Vertex* vertices, const gu::uint32 imageCount, const ResourceViewPtr& view, const gu::uint32 layer = 0);
+
+		/* @brief : Add the text. The cached text copies the laid out vertices without creating the images.*/
+		void AddFrameText(const Text& text, const gu::uint32 layer = 0);
 
 		/* @brief : Render all registered frame ui objects*/
 		void Draw();
@@ -70,6 +85,13 @@ namespace gc::ui
 		/****************************************************************************
 		**                Public Member Variables
 		*****************************************************************************/
+		/* @brief : Sprites whose texture is in the atlas are drawn with the atlas page (nullptr disables the atlas)*/
+		void SetTextureAtlas(const TextureAtlasPtr& atlas) { _textureAtlas = atlas; }
+
+		const TextureAtlasPtr& GetTextureAtlas() const noexcept { return _textureAtlas; }
+
+		/* @brief : DrawIndexedInstanced count issued by the last Draw*/
+		std::uint32_t GetLastDrawCallCount() const noexcept { return _lastDrawCallCount; }
 
 		/****************************************************************************
 		**                Constructor and Destructor
@@ -90,40 +112,55 @@ namespace gc::ui
 		/* @brief: Prepare graphics pipeline state objects. */
 		void PreparePipelineState(const gu::tstring& name);
 
-		/* @brief: Clear gpu vertex buffer */
-		void ClearVertexBuffer(const std::uint32_t frameIndex, const size_t vertexCount);
-
 		/****************************************************************************
 		**                Protected Member Variables
 		*****************************************************************************/
 		LowLevelGraphicsEnginePtr _engine = nullptr;
 
-		// @brief : total rect vertex buffers (default : 1024 UI)
-		gu::DynamicArray<VertexBufferPtr> _vertexBuffers = {};
+		// @brief : rect vertices registered in this frame. Uploaded to the per-frame upload ring in Draw (default : 1024 UI)
+		gu::DynamicArray<gm::Vertex> _vertices = {};
 		// @brief : total rect index buffers (default : 1024 UI)
 		gu::DynamicArray<IndexBufferPtr>  _indexBuffers  = {};
 		
 		// @brief : Pipeline state
 		PipelineStatePtr _pipeline = nullptr;
 
-		// @brief bind resource layout and view
+		// @brief bind resource layout
 		ResourceLayoutPtr _resourceLayout = nullptr;
-		gu::DynamicArray<ResourceViewPtr> _resourceViews = {};
+
+		// @brief : sprites registered by one AddFrameObjects call
+		struct DrawBatch
+		{
+			std::uint32_t   ImageStart = 0; // first rect index in _vertices
+			std::uint32_t   ImageCount = 0;
+			std::uint32_t   Layer      = 0;
+			std::uint32_t   ViewOrder  = 0; // first registration order of View in this frame (sort key)
+			ResourceViewPtr View       = nullptr; // registered view, replaced with the atlas page view in Draw
+		};
+		gu::DynamicArray<DrawBatch> _batches = {};
+
+		// @brief : distinct views in the registration order (work buffer of Draw)
+		gu::DynamicArray<const rhi::core::GPUResourceView*> _orderedViews = {};
+
+		// @brief : draw order of _batches (sorted in Draw)
+		gu::DynamicArray<std::uint32_t> _batchOrder = {};
+
+		TextureAtlasPtr _textureAtlas = nullptr;
 		
 		/* @brief regist total image count per frame  */
 		std::uint32_t  _totalImageCount = 0;
-		std::uint32_t  _prevTotalImageCount = 0;
 
-		// @brief : call drawIndex command count per frame
-		std::uint32_t  _needCallDrawIndexCount = 0;
-		gu::DynamicArray<std::uint32_t> _imageCountList = {};
+		std::uint32_t  _lastDrawCallCount = 0;
 
 	private:
 		/****************************************************************************
 		**                Private Function
 		*****************************************************************************/
-		/* @brief : AddFrameObject function is used. count up draw image and push back resource view.s*/
-		void CountUpDrawImageAndView(const std::uint64_t arrayLength, const ResourceViewPtr& view);
+		/* @brief : AddFrameObject function is used. count up draw image and push back the draw batch*/
+		void CountUpDrawImageAndView(const std::uint64_t arrayLength, const ResourceViewPtr& view, const std::uint32_t layer);
+
+		/* @brief : Rewrite the batch UVs into the atlas page. Return false if the batch cannot use the atlas.*/
+		bool RemapToAtlas(DrawBatch& batch);
 		
 		/****************************************************************************
 		**             Private Member Variables
@@ -16,6 +16,7 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include "UIImage.hpp"
+#include "UITextLayout.hpp"
 #include "GameUtility/Container/Include/GUDynamicArray.hpp"
 #include <string>
 #include "GameUtility/Base/Include/GUSmartPointer.hpp"
@@ -68,13 +69,33 @@ namespace gc::ui
 		/****************************************************************************
 		**                Public Function
 		*****************************************************************************/
+		/* @brief : ύX܂. ̏ꍇ͉, ύXꂽꍇ͕ύXꂽȍ~̂݃CAEg܂ (LbV[ĥ)*/
+		void SetString(const std::string& string);
 
 		/****************************************************************************
 		**                Public Member Variables
 		*****************************************************************************/
-		/* @brief : Get text image list*/
+		/* @brief : Get text image list (LbV[hł͋ł)*/
 		const gu::DynamicArray<Image>& GetTextImages() const { return _images; }
 
+		/* @brief : TextLayoutCachegpč쐬ꂽ*/
+		bool IsCached() const noexcept { return _layoutCache.IsValid(); }
+
+		/* @brief : LbVꂽCAEg擾܂. ǂoĂꍇ͍ēxCAEg܂*/
+		const TextLayout* GetLayout() const;
+
+		const std::string& GetString() const noexcept { return _string; }
+
+		CoordinateType GetCoordinateType() const noexcept { return _coordinateType; }
+
+		/* @brief : ̍̈ʒu (CAEgKv͂܂)*/
+		const gm::Float3& GetStartPosition() const noexcept { return _startPosition; }
+		void SetStartPosition(const gm::Float3& position) noexcept { _startPosition = position; }
+
+		/* @brief : F (CAEgKv͂܂)*/
+		const gm::Float4& GetColor() const noexcept { return _color; }
+		void SetColor(const gm::Float4& color) noexcept { _color = color; }
+
 		const gu::SharedPointer<Font> GetFont() const noexcept { return _font; }
 
 		const gu::SharedPointer<rhi::core::GPUResourceView> GetFontView() const noexcept;
@@ -87,6 +108,9 @@ namespace gc::ui
 		/* @brief : Text number constructor*/
 		Text(const CoordinateType type, const gu::SharedPointer<Font>& font, const NumberInfo& numberInfo);
 
+		/* @brief : Cached text constructor. _UIRenderer::AddFrameTextŃCAEgLbV쐬܂*/
+		Text(const CoordinateType type, const gu::SharedPointer<TextLayoutCache>& layoutCache, const StringInfo& stringInfo);
+
 		~Text();
 	protected:
 		/****************************************************************************
@@ -100,6 +124,17 @@ namespace gc::ui
 
 		gu::SharedPointer<Font> _font = nullptr;
 
+		/* @brief : LbV[hŎgp܂*/
+		gu::SharedPointer<TextLayoutCache> _layoutCache = nullptr;
+
+		mutable TextLayoutHandle _layout = {};
+
+		std::string     _string        = {};
+		TextLayoutStyle _style         = {};
+		CoordinateType  _coordinateType = CoordinateType::NDC;
+		gm::Float3      _startPosition = { 0.0f, 0.0f, 0.0f };
+		gm::Float4      _color         = { 1.0f, 1.0f, 1.0f, 1.0f };
+
 		static constexpr std::int32_t ASCII_START_CHAR = 32;
 
 	private:
@@ -0,0 +1,262 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   UITextLayout.hpp
+///             @brief  Glyph cache and text layout cache for the UI text.
+///                     The glyphs are cached by (codepoint, character size) with the LRU eviction,
+///                     and the laid out quads of the string are cached by the string hash,
+///                     so the unchanged strings are not laid out again and the changed strings
+///                     resume the layout from the first changed character.
+///             How To: 1. Create TextLayoutCache with the loaded font and share it between the texts
+///                     2. Create Text with the layout cache and update it by Text::SetString
+///                     3. Register the text by UIRenderer::AddFrameText
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef UI_TEXT_LAYOUT_HPP
+#define UI_TEXT_LAYOUT_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/Base/Include/GUClassUtility.hpp"
+#include "GameUtility/Base/Include/GUSmartPointer.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+#include "GameUtility/Container/Include/GULRUCache.hpp"
+#include "GameUtility/Math/Include/GMVertex.hpp"
+#include <string>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Template Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gc::ui
+{
+	class Font;
+
+	/****************************************************************************
+	*				  			Glyph
+	*************************************************************************//**
+	*  @struct    Glyph
+	*  @brief     Texture region and metrics of the one character
+	*****************************************************************************/
+	struct Glyph
+	{
+		/* @brief : Texture uv range (u : [left, right], v : [top, bottom])*/
+		gm::Float2 U = { 0.0f, 0.0f };
+		gm::Float2 V = { 0.0f, 0.0f };
+
+		/* @brief : False for the white space and the characters which the font does not have (no quad is emitted)*/
+		bool HasImage = false;
+	};
+
+	/****************************************************************************
+	*				  			GlyphCache
+	*************************************************************************//**
+	*  @class     GlyphCache
+	*  @brief     (codepoint, character height) -> Glyph cache with the LRU eviction.
+	*             The current font is the fixed grid bitmap, so the miss only computes the cell uv.
+	*             When the rasterized font source is added, the miss rasterizes the glyph into the atlas page
+	*             and the evicted glyph returns its region.
+	*****************************************************************************/
+	class GlyphCache : public gu::NonCopyable
+	{
+	public:
+		/****************************************************************************
+		**                Static Configuration
+		*****************************************************************************/
+		static constexpr gu::uint32 DEFAULT_CAPACITY = 512;
+
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Return the glyph of the codepoint. The glyph is loaded on the miss.*/
+		const Glyph& Get(const gu::uint32 codepoint, const float size);
+
+		/* @brief : Remove all glyphs*/
+		void Clear();
+
+		void ResetStatistics() noexcept { _hitCount = _missCount = _evictionCount = 0; }
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		const gu::SharedPointer<Font>& GetFont() const noexcept { return _font; }
+
+		gu::uint32 GetGlyphCount() const noexcept { return _glyphs.Size(); }
+
+		gu::uint64 GetHitCount     () const noexcept { return _hitCount; }
+		gu::uint64 GetMissCount    () const noexcept { return _missCount; }
+		gu::uint64 GetEvictionCount() const noexcept { return _evictionCount; }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		GlyphCache() = default;
+
+		explicit GlyphCache(const gu::SharedPointer<Font>& font, const gu::uint32 capacity = DEFAULT_CAPACITY);
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+		/* @brief : Create the glyph from the font*/
+		Glyph Load(const gu::uint32 codepoint, const float size) const;
+
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		gu::SharedPointer<Font> _font = nullptr;
+
+		gu::LRUCache<Glyph> _glyphs = {};
+
+		gu::uint64 _hitCount      = 0;
+		gu::uint64 _missCount     = 0;
+		gu::uint64 _evictionCount = 0;
+	};
+
+	/****************************************************************************
+	*				  			TextLayoutStyle
+	*************************************************************************//**
+	*  @struct    TextLayoutStyle
+	*  @brief     Layout parameters which are included in the cache key
+	*****************************************************************************/
+	struct TextLayoutStyle
+	{
+		gm::Float2 SizePerChar = { 0.0f, 0.0f };
+		gm::Float2 Space       = { 0.0f, 0.0f };
+
+		bool operator==(const TextLayoutStyle& right) const noexcept
+		{
+			return SizePerChar.x == right.SizePerChar.x && SizePerChar.y == right.SizePerChar.y
+				&& Space.x == right.Space.x && Space.y == right.Space.y;
+		}
+	};
+
+	/****************************************************************************
+	*				  			TextLayout
+	*************************************************************************//**
+	*  @struct    TextLayout
+	*  @brief     Laid out quads of the string.
+	*             The vertex position is relative to the left upper point of the text (y is upward),
+	*             and the quad order is the same as Image, so the renderer only offsets and colors the vertices.
+	*****************************************************************************/
+	struct TextLayout
+	{
+		/* @brief : Pen state before the byte of the string. Used to resume the layout from the changed character.*/
+		struct PenState
+		{
+			float      KerningX   = 0.0f; // accumulated kerning offset on the line
+			float      MaxWidth   = 0.0f; // widest line width before the byte
+			gu::uint32 Column     = 0;
+			gu::uint32 Line       = 0;
+			gu::uint32 GlyphCount = 0;    // emitted quad count
+			gu::uint32 Previous   = 0;    // previous codepoint on the line (kerning pair)
+		};
+
+		gu::uint64      Hash   = 0;
+		std::string     String = {};
+		TextLayoutStyle Style  = {};
+
+		/* @brief : 4 vertices per glyph*/
+		gu::DynamicArray<gm::Vertex> Vertices = {};
+
+		/* @brief : String.size() + 1 elements (the last one is the state after the string)*/
+		gu::DynamicArray<PenState> Pens = {};
+
+		gu::uint32 GlyphCount = 0;
+		gu::uint32 LineCount  = 0;
+
+		/* @brief : Width and height of the text*/
+		gm::Float2 Extent = { 0.0f, 0.0f };
+	};
+
+	/****************************************************************************
+	*				  			TextLayoutHandle
+	*************************************************************************//**
+	*  @struct    TextLayoutHandle
+	*  @brief     Weak reference to the layout in TextLayoutCache. It becomes invalid when the layout is evicted.
+	*****************************************************************************/
+	struct TextLayoutHandle
+	{
+		gu::uint32 Index      = gu::LRUCache<TextLayout>::INVALID_INDEX;
+		gu::uint32 Generation = 0;
+	};
+
+	/****************************************************************************
+	*				  			TextLayoutCache
+	*************************************************************************//**
+	*  @class     TextLayoutCache
+	*  @brief     (string, style) hash -> TextLayout cache with the LRU eviction.
+	*             The slot buffers are reused after the eviction, so the steady state does not allocate.
+	*****************************************************************************/
+	class TextLayoutCache : public gu::NonCopyable
+	{
+	public:
+		/****************************************************************************
+		**                Static Configuration
+		*****************************************************************************/
+		static constexpr gu::uint32 DEFAULT_CAPACITY = 256;
+
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Return the layout of the string. On the miss, the string is laid out
+		            by resuming the previous layout of the same text from the first changed character.*/
+		TextLayoutHandle Request(const std::string& string, const TextLayoutStyle& style, const TextLayoutHandle& previous = {});
+
+		/* @brief : Return the layout and mark it as the most recently used. nullptr if the layout has been evicted.*/
+		const TextLayout* Get(const TextLayoutHandle& handle);
+
+		/* @brief : Remove all layouts (the handles become invalid)*/
+		void Clear();
+
+		void ResetStatistics() noexcept;
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		const gu::SharedPointer<Font>& GetFont() const noexcept { return _glyphCache.GetFont(); }
+
+		GlyphCache& GetGlyphCache() noexcept { return _glyphCache; }
+
+		gu::uint64 GetHitCount () const noexcept { return _hitCount; }
+		gu::uint64 GetMissCount() const noexcept { return _missCount; }
+
+		/* @brief : Glyph count laid out on the miss / copied from the previous layout*/
+		gu::uint64 GetLaidOutGlyphCount() const noexcept { return _laidOutGlyphCount; }
+		gu::uint64 GetReusedGlyphCount () const noexcept { return _reusedGlyphCount; }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		TextLayoutCache() = default;
+
+		explicit TextLayoutCache(const gu::SharedPointer<Font>& font, const gu::uint32 capacity = DEFAULT_CAPACITY,
+			const gu::uint32 glyphCapacity = GlyphCache::DEFAULT_CAPACITY);
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+		/* @brief : Lay out layout.String from the byte offset. layout.Pens[offset] and the vertices before it must be valid.*/
+		void Layout(TextLayout& layout, const gu::uint64 offset);
+
+		static gu::uint64 ComputeHash(const std::string& string, const TextLayoutStyle& style);
+
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		GlyphCache _glyphCache = {};
+
+		gu::LRUCache<TextLayout> _layouts = {};
+
+		gu::uint64 _hitCount          = 0;
+		gu::uint64 _missCount         = 0;
+		gu::uint64 _laidOutGlyphCount = 0;
+		gu::uint64 _reusedGlyphCount  = 0;
+	};
+}
+#endif
@@ -0,0 +1,233 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   UITextureAtlas.hpp
+///             @brief  Runtime texture atlas for the UI sprites.
+///                     The UI textures are packed into a few large pages with the skyline bottom-left packer,
+///                     so the sprites using different textures can be drawn with one draw call.
+///             How To: 1. Create TextureAtlas and call Add(view, graphicsCommandList) while loading the textures
+///                        (outside the render pass, after the texture upload is recorded)
+///                     2. Pass the atlas to UIRenderer::SetTextureAtlas
+///                     3. UIRenderer rewrites the sprite UVs into the atlas page automatically
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef UI_TEXTURE_ATLAS_HPP
+#define UI_TEXTURE_ATLAS_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/Base/Include/GUClassUtility.hpp"
+#include "GameUtility/Base/Include/GUSmartPointer.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+#include "GameUtility/Container/Include/GUSortedMap.hpp"
+#include "GameUtility/Math/Include/GMVector.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHICommonState.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+class LowLevelGraphicsEngine;
+namespace rhi::core
+{
+	class RHICommandList;
+	class GPUTexture;
+	class GPUResourceView;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Template Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gc::ui
+{
+	/****************************************************************************
+	*				  			SkylinePacker
+	*************************************************************************//**
+	*  @class     SkylinePacker
+	*  @brief     Skyline bottom-left rectangle packer.
+	*             The top edge of the packed rectangles is kept as a list of horizontal segments,
+	*             and the new rectangle is placed on the segment which gives the lowest top edge.
+	*****************************************************************************/
+	class SkylinePacker
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Find the position of the width x height rectangle and occupy it. Return false if it does not fit.*/
+		bool Insert(const gu::uint32 width, const gu::uint32 height, gu::uint32& outX, gu::uint32& outY);
+
+		/* @brief : Remove all rectangles*/
+		void Clear();
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		gu::uint32 GetWidth () const noexcept { return _width; }
+
+		gu::uint32 GetHeight() const noexcept { return _height; }
+
+		/* @brief : Sum of the inserted rectangle area*/
+		gu::uint64 GetUsedArea() const noexcept { return _usedArea; }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		SkylinePacker() = default;
+
+		SkylinePacker(const gu::uint32 width, const gu::uint32 height);
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+		/* @brief : Return the y position when the rectangle is placed on the index-th segment. Return false if it does not fit.*/
+		bool Fit(const gu::uint64 index, const gu::uint32 width, const gu::uint32 height, gu::uint32& outY) const;
+
+		/* @brief : Raise the skyline after the rectangle is placed on the index-th segment*/
+		void AddLevel(const gu::uint64 index, const gu::uint32 x, const gu::uint32 y, const gu::uint32 width, const gu::uint32 height);
+
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		struct Segment
+		{
+			gu::uint32 X     = 0;
+			gu::uint32 Y     = 0;
+			gu::uint32 Width = 0;
+		};
+
+		gu::DynamicArray<Segment> _skyline = {};
+
+		gu::uint32 _width  = 0;
+		gu::uint32 _height = 0;
+		gu::uint64 _usedArea = 0;
+	};
+
+	/****************************************************************************
+	*				  			AtlasRegion
+	*************************************************************************//**
+	*  @struct    AtlasRegion
+	*  @brief     Placement of the source texture in the atlas.
+	*             atlasUV = uv * UVScale + UVOffset maps [0, 1] of the source texture into the page.
+	*****************************************************************************/
+	struct AtlasRegion
+	{
+		/* @brief : Page index in the atlas*/
+		gu::uint32 Page = 0;
+
+		/* @brief : Top left pixel position in the page*/
+		gu::uint32 X = 0;
+		gu::uint32 Y = 0;
+
+		/* @brief : Pixel size of the source texture*/
+		gu::uint32 Width  = 0;
+		gu::uint32 Height = 0;
+
+		gm::Float2 UVOffset = { 0.0f, 0.0f };
+		gm::Float2 UVScale  = { 1.0f, 1.0f };
+
+		/* @brief : Keep the source texture alive because its address is used as the lookup key*/
+		gu::SharedPointer<rhi::core::GPUTexture> Source = nullptr;
+	};
+
+	/****************************************************************************
+	*				  			TextureAtlas
+	*************************************************************************//**
+	*  @class     TextureAtlas
+	*  @brief     Runtime atlas builder for the UI textures.
+	*             The pages are created for each pixel format, and only mip 0 of the source is copied.
+	*             The UVs are inset by a half texel, so the bilinear sampling does not read the padding.
+	*             The wrap addressing (uv outside [0, 1]) cannot be used with the atlas.
+	*****************************************************************************/
+	class TextureAtlas : public gu::NonCopyable
+	{
+	protected:
+		using LowLevelGraphicsEnginePtr = gu::SharedPointer<LowLevelGraphicsEngine>;
+		using CommandListPtr  = gu::SharedPointer<rhi::core::RHICommandList>;
+		using TexturePtr      = gu::SharedPointer<rhi::core::GPUTexture>;
+		using ResourceViewPtr = gu::SharedPointer<rhi::core::GPUResourceView>;
+
+	public:
+		/****************************************************************************
+		**                Static Configuration
+		*****************************************************************************/
+		static constexpr gu::uint32 DEFAULT_PAGE_SIZE = 2048;
+
+		/* @brief : Pixel gap around each texture*/
+		static constexpr gu::uint32 DEFAULT_PADDING = 2;
+
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Copy the texture of the view into the atlas.
+		            Return false if the texture cannot be placed (not 2D, array, multisample or larger than the page).
+		            The copy is recorded to the graphics command list, so call this outside the render pass.*/
+		bool Add(const ResourceViewPtr& view, const CommandListPtr& graphicsCommandList);
+
+		/* @brief : Return the region of the texture bound to the view. nullptr if the texture is not in the atlas.*/
+		const AtlasRegion* Find(const ResourceViewPtr& view) const;
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		gu::uint32 GetPageCount() const noexcept { return static_cast<gu::uint32>(_pages.Size()); }
+
+		/* @brief : Shader resource view of the page*/
+		const ResourceViewPtr& GetPageView(const gu::uint32 page) const { return _pages[page].View; }
+
+		gu::uint32 GetPageSize() const noexcept { return _pageSize; }
+
+		gu::uint32 GetRegionCount() const noexcept { return static_cast<gu::uint32>(_regions.Size()); }
+
+		/* @brief : Sum of the source texture area (without padding)*/
+		gu::uint64 GetUsedArea() const noexcept { return _usedArea; }
+
+		/* @brief : Used area / total page area*/
+		float GetPackingEfficiency() const noexcept;
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		TextureAtlas() = default;
+
+		explicit TextureAtlas(const LowLevelGraphicsEnginePtr& engine, const gu::uint32 pageSize = DEFAULT_PAGE_SIZE, const gu::uint32 padding = DEFAULT_PADDING);
+
+		~TextureAtlas();
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+		/* @brief : Create the new page of the pixel format*/
+		gu::uint32 CreatePage(const rhi::core::PixelFormat format);
+
+		/* @brief : Block compressed formats require 4 pixel aligned copy*/
+		static bool IsBlockCompressed(const rhi::core::PixelFormat format);
+
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		struct Page
+		{
+			TexturePtr            Texture = nullptr;
+			ResourceViewPtr       View    = nullptr;
+			SkylinePacker         Packer  = {};
+			rhi::core::PixelFormat Format = rhi::core::PixelFormat::Unknown;
+		};
+
+		LowLevelGraphicsEnginePtr _engine = nullptr;
+
+		gu::DynamicArray<Page> _pages = {};
+
+		gu::DynamicArray<AtlasRegion> _regions = {};
+
+		/* @brief : Source texture address -> index of _regions*/
+		gu::SortedMap<gu::uint64, gu::uint32> _regionIndices = {};
+
+		gu::uint32 _pageSize = DEFAULT_PAGE_SIZE;
+		gu::uint32 _padding  = DEFAULT_PADDING;
+		gu::uint64 _usedArea = 0;
+	};
+}
+#endif
@@ -13,6 +13,7 @@
 #include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUResourceCache.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUResourceView.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUTexture.hpp"
+#include "GameUtility/Memory/Include/GUMemoryTracker.hpp"
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
@@ -52,8 +53,10 @@ Font::~Font()
 * 
 *  @return @@bool (true : Load success, false : already loaded, error : failed to find texture image path)
 *****************************************************************************/
-bool Font::Load(const LowLevelGraphicsEnginePtr& engine, const gu::tstring& imagePath, [[maybe_unused]] const gm::Float2& pixelPerChar, [[maybe_unused]]const float imagePixelWidth)
+bool Font::Load(const LowLevelGraphicsEnginePtr& engine, const gu::tstring& imagePath, const gm::Float2& pixelPerChar, const float imagePixelWidth)
 {
+	GU_MEMORY_TAG_SCOPE(gu::MemoryTag::UI);
+
 	/*-------------------------------------------------------------------
 	-             Load check
 	---------------------------------------------------------------------*/
@@ -62,6 +65,10 @@ bool Font::Load(const LowLevelGraphicsEnginePtr& engine, const gu::tstring& imag
 	/*-------------------------------------------------------------------
 	-             Set up
 	---------------------------------------------------------------------*/
+	_engine          = engine;
+	_pixelPerChar    = pixelPerChar;
+	_imagePixelWidth = imagePixelWidth;
+
 	const auto device        = engine->GetDevice();
 	const auto commandList   = engine->GetCommandList(CommandListType::Graphics);
 	const auto resourceCache = gu::MakeShared<GPUResourceCache>(_engine->GetDevice(), commandList);
@@ -88,10 +95,71 @@ bool Font::Load(const LowLevelGraphicsEnginePtr& engine, const gu::tstring& imag
 void Font::Reset()
 {
 	_textureView.Reset();
+	_kernings.Clear();
 	_pixelPerChar    = { 0.0f, 0.0f };
 	_imagePixelWidth = 0;
 	_engine = nullptr;
 }
+
+/****************************************************************************
+*					GetGlyphUV
+*************************************************************************//**
+*  @fn        bool Font::GetGlyphUV(const gu::uint32 codepoint, gm::Float2& u, gm::Float2& v) const noexcept
+*
+*  @brief     tHg摜̕ZUV͈͂擾
+*
+*  @param[in]  const gu::uint32 codepoint
+*  @param[out] gm::Float2& u (x : left, y : right)
+*  @param[out] gm::Float2& v (x : top , y : bottom)
+*
+*  @return @@bool (false : tHg摜ɕ܂܂ĂȂ)
+*****************************************************************************/
+bool Font::GetGlyphUV(const gu::uint32 codepoint, gm::Float2& u, gm::Float2& v) const noexcept
+{
+	if (codepoint < FIRST_CODEPOINT || codepoint - FIRST_CODEPOINT >= GetGlyphCount()) { return false; }
+
+	const float cellWidth = _pixelPerChar.x / _imagePixelWidth;
+	const float index     = static_cast<float>(codepoint - FIRST_CODEPOINT);
+	u = gm::Float2(index * cellWidth, (index + 1.0f) * cellWidth);
+	v = gm::Float2(0.0f, 1.0f);
+	return true;
+}
+
+/****************************************************************************
+*					SetKerning
+*************************************************************************//**
+*  @fn        void Font::SetKerning(const gu::uint32 left, const gu::uint32 right, const float offset)
+*
+*  @brief     ̑gݍ킹ɑ΂J[jOo^
+*
+*  @param[in] const gu::uint32 left  : ̕
+*  @param[in] const gu::uint32 right : E̕
+*  @param[in] const float offset     : ɑ΂銄 (̒lŋl߂)
+*
+*  @return @@void
+*****************************************************************************/
+void Font::SetKerning(const gu::uint32 left, const gu::uint32 right, const float offset)
+{
+	_kernings[(static_cast<gu::uint64>(left) << 32) | right] = offset;
+}
+
+/****************************************************************************
+*					GetKerning
+*************************************************************************//**
+*  @fn        float Font::GetKerning(const gu::uint32 left, const gu::uint32 right) const
+*
+*  @brief     ̑gݍ킹ɑ΂J[jO擾 (o^̏ꍇ0)
+*
+*  @param[in] const gu::uint32 left
+*  @param[in] const gu::uint32 right
+*
+*  @return @@float
+*****************************************************************************/
+float Font::GetKerning(const gu::uint32 left, const gu::uint32 right) const
+{
+	const auto key = (static_cast<gu::uint64>(left) << 32) | right;
+	return _kernings.Contains(key) ? _kernings.At(key) : 0.0f;
+}
 #pragma endregion Main Function
 
 #pragma region Property
@@ -9,13 +9,18 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include "../Include/UIRenderer.hpp"
+#include "../Include/UIText.hpp"
 #include "GraphicsCore/Engine/Include/LowLevelGraphicsEngine.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIResourceLayout.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUBuffer.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUResourceView.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/PipelineState/Include/GPUPipelineState.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/PipelineState/Include/GPUPipelineFactory.hpp"
+#include "GameUtility/Memory/Include/GUMemory.hpp"
+#include "GameUtility/Base/Include/Screen.hpp"
 #include <stdexcept>
+#include <algorithm>
+#include <functional>
 
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -48,17 +53,14 @@ UIRenderer::UIRenderer(const LowLevelGraphicsEnginePtr& engine, const gu::tstrin
 
 UIRenderer::~UIRenderer()
 {
-	if (!_vertexBuffers.IsEmpty()) { _vertexBuffers.Clear(); _vertexBuffers.ShrinkToFit(); }
+	if (!_vertices     .IsEmpty()) { _vertices     .Clear(); _vertices     .ShrinkToFit(); }
 	if (!_indexBuffers .IsEmpty()) { _indexBuffers .Clear(), _indexBuffers .ShrinkToFit(); }
 } 
 
 #pragma endregion Constructor and Destructor 
 void UIRenderer::Clear()
 {
-	if (_prevTotalImageCount == 0) { return; }
-
-	const auto prevFrameIndex = (_engine->GetCurrentFrameIndex() + LowLevelGraphicsEngine::FRAME_BUFFER_COUNT - 1) % LowLevelGraphicsEngine::FRAME_BUFFER_COUNT;
-	ClearVertexBuffer(prevFrameIndex, _prevTotalImageCount);
+	// _͖t[Abv[hOɏނ, Ot[̒_obt@NAKv͂Ȃ
 }
 
 /****************************************************************************
@@ -111,7 +113,7 @@ void UIRenderer::Clear()
 //	
 //}
 
-void UIRenderer::AddFrameObjects(const gu::DynamicArray<ui::Image>& images, const ResourceViewPtr& view)
+void UIRenderer::AddFrameObjects(const gu::DynamicArray<ui::Image>& images, const ResourceViewPtr& view, const gu::uint32 layer)
 {
 	/*-------------------------------------------------------------------
 	-               sprite count check
@@ -129,29 +131,118 @@ void UIRenderer::AddFrameObjects(const gu::DynamicArray<ui::Image>& images, cons
 	/*-------------------------------------------------------------------
 	-               Add vertex data
 	---------------------------------------------------------------------*/
-	const auto  currentFrame = _engine->GetCurrentFrameIndex();
-	const auto& vertexBuffer = _vertexBuffers[currentFrame];
-	const auto  oneRectVertexCount = 4;
+	const auto oneRectVertexCount = 4;
 
-	vertexBuffer->CopyStart();
 	// _maxWritableUICount - _totalImageCount is c̓o^ł鐔
 	for (std::uint32_t i = 0; i < std::min<std::uint32_t>((std::uint32_t)images.Size(), _maxWritableUICount - _totalImageCount); ++i)
 	{
-		vertexBuffer->CopyTotalData(images[i].GetVertices(), 4, ((size_t)i + (size_t)_totalImageCount) * (size_t)oneRectVertexCount);
+		const auto vertices = images[i].GetVertices();
+		for (std::uint32_t j = 0; j < oneRectVertexCount; ++j) { _vertices.Push(vertices[j]); }
 	}
-	vertexBuffer->CopyEnd();
 
 	/*-------------------------------------------------------------------
 	-               Count sprite num
 	---------------------------------------------------------------------*/
-	CountUpDrawImageAndView(images.Size(), view);
+	CountUpDrawImageAndView(images.Size(), view, layer);
+}
+
+/****************************************************************************
+*					AddFrameVertices
+*************************************************************************//**
+*  @fn        void UIRenderer::AddFrameVertices(const gm::Vertex* vertices, const gu::uint32 imageCount, const ResourceViewPtr& view, const gu::uint32 layer)
+*
+*  @brief     쐬ς݂̋`_ (1`ɂ4_) o^܂.
+*             `XbhRenderSnapshotUIDrawListo^ۂɎgp܂.
+*
+*  @param[in] const gm::Vertex* vertices
+*  @param[in] const gu::uint32 imageCount
+*  @param[in] const ResourceViewPtr& view
+*  @param[in] const gu::uint32 layer
+*
+*  @return @@void
+*****************************************************************************/
+void UIRenderer::AddFrameVertices(const gm::Vertex* vertices, const gu::uint32 imageCount, const ResourceViewPtr& view, const gu::uint32 layer)
+{
+	if (_totalImageCount + imageCount > _maxWritableUICount)
+	{
+		throw std::runtime_error("The maximum number of sprites exceeded. \n If the maximum number is not exceeded, please check whether DrawEnd is being called. \n");
+	}
+
+	if (imageCount == 0 || vertices == nullptr) { return; }
+
+	const auto oneRectVertexCount = 4;
+	for (std::uint32_t i = 0; i < imageCount * oneRectVertexCount; ++i)
+	{
+		_vertices.Push(vertices[i]);
+	}
+
+	CountUpDrawImageAndView(imageCount, view, layer);
+}
+
+/****************************************************************************
+*					AddFrameText
+*************************************************************************//**
+*  @fn        void UIRenderer::AddFrameText(const Text& text, const gu::uint32 layer)
+* 
+*  @brief     eLXgo^܂. 
+*             LbV[h̃eLXg̓CAEgς݂̒_ɊJnʒuƐFKpăRs[邾, Image͍쐬܂. 
+*             ȊÕeLXgAddFrameObjectsƓł. 
+* 
+*  @param[in] const Text& text
+*  @param[in] const gu::uint32 layer
+* 
+*  @return @@void
+*****************************************************************************/
+void UIRenderer::AddFrameText(const Text& text, const gu::uint32 layer)
+{
+	if (!text.IsCached())
+	{
+		AddFrameObjects(text.GetTextImages(), text.GetFontView(), layer);
+		return;
+	}
+
+	const auto layout = text.GetLayout();
+	if (layout == nullptr || layout->GlyphCount == 0) { return; }
+
+	/*-------------------------------------------------------------------
+	-               sprite count check
+	---------------------------------------------------------------------*/
+	if (_totalImageCount + layout->GlyphCount > _maxWritableUICount)
+	{
+		throw std::runtime_error("The maximum number of sprites exceeded. \n If the maximum number is not exceeded, please check whether DrawEnd is being called. \n");
+	}
+
+	/*-------------------------------------------------------------------
+	-       Screen space is converted in the same way as Image::CreateInScreenSpace
+	---------------------------------------------------------------------*/
+	const bool  isScreen = text.GetCoordinateType() == CoordinateType::Screen;
+	const float scaleX   = isScreen ? 1.0f / Screen::GetScreenWidth () : 1.0f;
+	const float scaleY   = isScreen ? 1.0f / Screen::GetScreenHeight() : 1.0f;
+	const auto& start    = text.GetStartPosition();
+	const auto& color    = text.GetColor();
+
+	/*-------------------------------------------------------------------
+	-               Add vertex data
+	---------------------------------------------------------------------*/
+	const auto vertexCount = layout->Vertices.Size();
+	_vertices.Reserve(_vertices.Size() + vertexCount);
+	for (std::uint64_t i = 0; i < vertexCount; ++i)
+	{
+		gm::Vertex vertex = layout->Vertices[i];
+		vertex.Position = gm::Float3((start.x + vertex.Position.x) * scaleX, (start.y + vertex.Position.y) * scaleY, start.z);
+		vertex.Color    = color;
+		_vertices.Push(vertex);
+	}
+
+	CountUpDrawImageAndView(layout->GlyphCount, text.GetFontView(), layer);
 }
 /****************************************************************************
 *					Draw
 *************************************************************************//**
 *  @fn        void UIRenderer::Draw()
 * 
-*  @brief     Render all registered frame ui objects
+*  @brief     Render all registered frame ui objects.
+*             AgXɊ܂܂eNX`̓y[W̃r[ɒu, (C[, r[)ɕׂĘA铯r[1ŕ`悵܂
 * 
 *  @param[in] void
 * 
@@ -159,71 +250,92 @@ void UIRenderer::AddFrameObjects(const gu::DynamicArray<ui::Image>& images, cons
 *****************************************************************************/
 void UIRenderer::Draw()
 {
-	_prevTotalImageCount = _totalImageCount;
-	if (_totalImageCount == 0) { return; }
+	if (_totalImageCount == 0) { _lastDrawCallCount = 0; return; }
 
 	const std::uint32_t currentFrame = _engine->GetCurrentFrameIndex();
 	const auto commandList  = _engine->GetCommandList(core::CommandListType::Graphics);
 
 	/*-------------------------------------------------------------------
-	-                 Draw command list
+	-        Replace the view with the atlas page and sort the batches
 	---------------------------------------------------------------------*/
+	_batchOrder.Resize(_batches.Size());
+	_orderedViews.Clear();
+	for (std::uint32_t i = 0; i < _batches.Size(); ++i)
+	{
+		RemapToAtlas(_batches[i]);
+		_batchOrder[i] = i;
+
+		// The view address changes between runs, so the views are ordered by the first registration.
+		std::uint32_t viewOrder = 0;
+		while (viewOrder < _orderedViews.Size() && _orderedViews[viewOrder] != _batches[i].View.Get()) { ++viewOrder; }
+		if (viewOrder == _orderedViews.Size()) { _orderedViews.Push(_batches[i].View.Get()); }
+		_batches[i].ViewOrder = viewOrder;
+	}
+
+	// C[ł͓r[(AgXy[W)A悤ɕׂ. o^͓r[ł̂ݕێ܂
+	std::stable_sort(_batchOrder.Data(), _batchOrder.Data() + _batchOrder.Size(),
+		[this](const std::uint32_t left, const std::uint32_t right)
+		{
+			const auto& a = _batches[left];
+			const auto& b = _batches[right];
+			if (a.Layer != b.Layer) { return a.Layer < b.Layer; }
+			return a.ViewOrder < b.ViewOrder;
+		});
+
+	/*-------------------------------------------------------------------
+	-        Write the vertices to the upload ring in the draw order
+	---------------------------------------------------------------------*/
+	const auto oneRectVertexCount = 4;
+	const auto vertexByteSize = _vertices.Size() * sizeof(gm::Vertex);
+	const auto vertices       = _engine->GetFrameUploadAllocator()->Allocate(vertexByteSize, alignof(gm::Vertex));
+	
+	auto destination = reinterpret_cast<gm::Vertex*>(vertices.CPUAddress);
+	for (std::uint32_t i = 0; i < _batchOrder.Size(); ++i)
+	{
+		const auto& batch = _batches[_batchOrder[i]];
+		const auto  count = (std::uint64_t)batch.ImageCount * oneRectVertexCount;
+		gu::Memory::Copy(destination, &_vertices[(std::uint64_t)batch.ImageStart * oneRectVertexCount], count * sizeof(gm::Vertex));
+		destination += count;
+	}
+
 	commandList->SetResourceLayout(_resourceLayout);
 	commandList->SetGraphicsPipeline(_pipeline);
-	commandList->SetVertexBuffer(_vertexBuffers[currentFrame]);
+	commandList->SetVertexBuffer(vertices.Buffer, vertices.Offset, vertexByteSize, sizeof(gm::Vertex));
 	commandList->SetIndexBuffer (_indexBuffers[currentFrame]);
 
 	/*-------------------------------------------------------------------
-	-                 Draw
+	-        Draw (the consecutive batches with the same view are merged)
 	---------------------------------------------------------------------*/
-	std::uint32_t indexOffset = 0;
-	for (std::uint32_t i = 0; i < _needCallDrawIndexCount; ++i)
+	std::uint32_t imageOffset = 0;
+	_lastDrawCallCount = 0;
+	for (std::uint32_t i = 0; i < _batchOrder.Size();)
 	{
+		const auto view = _batches[_batchOrder[i]].View;
+
+		std::uint32_t imageCount = 0;
+		for (; i < _batchOrder.Size() && _batches[_batchOrder[i]].View.Get() == view.Get(); ++i)
+		{
+			imageCount += _batches[_batchOrder[i]].ImageCount;
+		}
+
 		// Regist root descriptor table 
-		commandList->SetDescriptorHeap(_resourceViews[i]->GetHeap());
-		_resourceViews[i]->Bind(commandList, 0, _resourceLayout);
+		commandList->SetDescriptorHeap(view->GetHeap());
+		view->Bind(commandList, 0, _resourceLayout);
 
-		// Draw Rects in one texture at a time
-		const std::uint32_t oneImageTotalIndexCount = 6 * _imageCountList[i];
-		commandList->DrawIndexedInstanced(oneImageTotalIndexCount, 1, indexOffset, 0, 0);
-		indexOffset += oneImageTotalIndexCount;
+		commandList->DrawIndexedInstanced(6 * imageCount, 1, 6 * imageOffset, 0, 0);
+		imageOffset += imageCount;
+		_lastDrawCallCount++;
 	}
 
 	/*-------------------------------------------------------------------
 	-               Reset Stack Count
 	---------------------------------------------------------------------*/
 	_totalImageCount = 0;
-	_needCallDrawIndexCount = 0;
-	_imageCountList.Clear(); _imageCountList.ShrinkToFit();
-	_resourceViews.Clear(); _resourceViews.ShrinkToFit();
+	_batches.Clear();
+	_vertices.Clear();
 }
 
 #pragma region Protected Function
-/****************************************************************************
-*						ClearVertexBuffer
-*************************************************************************//**
-*  @fn        void UIRenderer::ClearVertexBuffer(const std::uint32_t frameIndex, const size_t vertexCount)
-*
-*  @brief     Clear gpu vertex buffer
-*
-*  @param[in] const std::uint32_t frameIndex
-*  @param[in] const size_t vertexCount
-*
-*  @return @@void
-*****************************************************************************/
-void UIRenderer::ClearVertexBuffer(const std::uint32_t frameIndex, const size_t vertexCount)
-{
-	if (vertexCount == 0) { return; }
-
-	gu::DynamicArray<gm::Vertex> v
-	(
-		vertexCount,
-		Vertex(Float3(0, 0, 0), Float3(0, 0, 0), Float4(1, 1, 1, 1), Float2(0, 0))
-	);
-	
-	_vertexBuffers[frameIndex]->Update(v.Data(), vertexCount);
-}
-
 /****************************************************************************
 *						PrepareMaxImageBuffer
 *************************************************************************//**
@@ -261,21 +373,14 @@ void UIRenderer::PrepareMaxImageBuffer(const gu::tstring& name)
 	---------------------------------------------------------------------*/
 	const auto frameCount = LowLevelGraphicsEngine::FRAME_BUFFER_COUNT;
 	
+	// _DrawŃt[Ƃ̃Abv[hOɔzu邽, CPÜ̗̂݊mۂ
+	_vertices.Reserve((std::uint64_t)_maxWritableUICount * rectVertexCount);
+
 	// prepare frame count buffer
-	_vertexBuffers.Resize(frameCount);
 	_indexBuffers .Resize(frameCount);
 
 	for (std::uint32_t i = 0; i < frameCount; ++i)
 	{
-		{
-			const auto totalCount = _maxWritableUICount * rectVertexCount;
-			const auto vbMetaData = GPUBufferMetaData::VertexBuffer(sizeof(gm::Vertex), totalCount, core::MemoryHeap::Upload);
-			
-			_vertexBuffers[i] = device->CreateBuffer(vbMetaData);
-			_vertexBuffers[i]->SetName(name + SP("VB"));
-			ClearVertexBuffer(i, totalCount);
-		}
-
 		{
 			const auto ibMetaData = GPUBufferMetaData::IndexBuffer(sizeof(std::uint32_t), indices.Size(), MemoryHeap::Default, ResourceState::Common);
 			
@@ -335,11 +440,47 @@ void UIRenderer::PreparePipelineState(const gu::tstring& name)
 #pragma endregion Protected Function
 
 #pragma region Private Function
-void UIRenderer::CountUpDrawImageAndView(const std::uint64_t arrayLength, const ResourceViewPtr& view)
+void UIRenderer::CountUpDrawImageAndView(const std::uint64_t arrayLength, const ResourceViewPtr& view, const std::uint32_t layer)
 {
-	_needCallDrawIndexCount++;
+	_batches.Push({ _totalImageCount, static_cast<std::uint32_t>(arrayLength), layer, view });
 	_totalImageCount += static_cast<std::uint32_t>(arrayLength);
-	_imageCountList.Push(static_cast<std::uint32_t>(arrayLength));
-	_resourceViews.Push(view);
+}
+
+/****************************************************************************
+*					RemapToAtlas
+*************************************************************************//**
+*  @fn        bool UIRenderer::RemapToAtlas(DrawBatch& batch)
+* 
+*  @brief     ob`UVAgXy[WUVɏ, r[y[W̃r[ɒu.
+*             UV[0, 1]͈̔͊O̒_(WrapOƂ摜)܂ޏꍇ͌̃eNX`ŕ`悵܂
+* 
+*  @param[in] DrawBatch& batch
+* 
+*  @return @@bool
+*****************************************************************************/
+bool UIRenderer::RemapToAtlas(DrawBatch& batch)
+{
+	if (!_textureAtlas) { return false; }
+
+	const auto region = _textureAtlas->Find(batch.View);
+	if (!region) { return false; }
+
+	const std::uint64_t first = (std::uint64_t)batch.ImageStart * 4;
+	const std::uint64_t last  = first + (std::uint64_t)batch.ImageCount * 4;
+	for (std::uint64_t i = first; i < last; ++i)
+	{
+		const auto& uv = _vertices[i].UV;
+		if (uv.x < 0.0f || uv.x > 1.0f || uv.y < 0.0f || uv.y > 1.0f) { return false; }
+	}
+
+	for (std::uint64_t i = first; i < last; ++i)
+	{
+		auto& uv = _vertices[i].UV;
+		uv.x = uv.x * region->UVScale.x + region->UVOffset.x;
+		uv.y = uv.y * region->UVScale.y + region->UVOffset.y;
+	}
+
+	batch.View = _textureAtlas->GetPageView(region->Page);
+	return true;
 }
 #pragma endregion Private Function
\ No newline at end of file
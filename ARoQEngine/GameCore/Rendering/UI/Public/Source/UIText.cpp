@@ -84,6 +84,7 @@ Text::Text(const CoordinateType type, const gu::SharedPointer<Font>& font, const
 
 /* @brief : Text number constructor*/
 Text::Text(const CoordinateType type, const gu::SharedPointer<Font>& font, const NumberInfo& info)
+	: _font(font)
 {
 #ifdef _DEBUG
 	Check(info.Digit >= 1);
@@ -137,12 +138,69 @@ Text::Text(const CoordinateType type, const gu::SharedPointer<Font>& font, const
 	}
 }
 
+/* @brief : Cached text constructor*/
+Text::Text(const CoordinateType type, const gu::SharedPointer<TextLayoutCache>& layoutCache, const StringInfo& info)
+	: _font(layoutCache->GetFont()), _layoutCache(layoutCache), _string(info.String),
+	_style({ .SizePerChar = info.SizePerChar, .Space = info.Space }), _coordinateType(type),
+	_startPosition(info.StartPosition), _color(info.Color)
+{
+	if (!_font->HasLoaded()) { throw std::runtime_error("Font isn't read. You should read font."); }
+	if (type != CoordinateType::Screen && type != CoordinateType::NDC) { throw std::runtime_error("Choice wrong type"); }
+
+	_layout = _layoutCache->Request(_string, _style);
+}
+
 Text::~Text()
 {
 	_images.Clear(); _images.ShrinkToFit();
 }
 #pragma endregion Constructor and Destructor
 
+#pragma region Main Function
+/****************************************************************************
+*                       SetString
+*************************************************************************//**
+*  @fn        void Text::SetString(const std::string& string)
+*
+*  @brief     ύX܂. 
+*             ̏ꍇ͉, ύXꂽꍇ͑ÕCAEgƂ̋ʕRs[
+*             ύXꂽȍ~̂݃CAEg܂. 
+*
+*  @param[in] const std::string& string
+*
+*  @return @@void
+*****************************************************************************/
+void Text::SetString(const std::string& string)
+{
+	Check(IsCached());
+	if (_string == string) { return; }
+
+	_string = string;
+	_layout = _layoutCache->Request(_string, _style, _layout);
+}
+
+/****************************************************************************
+*                       GetLayout
+*************************************************************************//**
+*  @fn        const TextLayout* Text::GetLayout() const
+*
+*  @brief     LbVꂽCAEg擾܂. LRUŒǂoĂꍇ͍ēxCAEg܂. 
+*
+*  @param[in] void
+*
+*  @return @@const TextLayout* (LbV[hłȂꍇnullptr)
+*****************************************************************************/
+const TextLayout* Text::GetLayout() const
+{
+	if (!_layoutCache) { return nullptr; }
+
+	if (const auto layout = _layoutCache->Get(_layout)) { return layout; }
+
+	_layout = _layoutCache->Request(_string, _style);
+	return _layoutCache->Get(_layout);
+}
+#pragma endregion Main Function
+
 #pragma region Property
 const gu::SharedPointer<rhi::core::GPUResourceView> Text::GetFontView() const noexcept
 {
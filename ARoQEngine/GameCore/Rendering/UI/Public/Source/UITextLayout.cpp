@@ -0,0 +1,400 @@
+//////////////////////////////////////////////////////////////////////////////////
+//              @file   UITextLayout.cpp
+///             @brief  Glyph cache and text layout cache for the UI text
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/UITextLayout.hpp"
+#include "../Include/UIFont.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include <bit>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace gc::ui;
+
+namespace
+{
+	constexpr gu::uint64 FNV_OFFSET_BASIS = 0xcbf29ce484222325ull;
+	constexpr gu::uint64 FNV_PRIME        = 0x00000100000001b3ull;
+
+	gu::uint64 HashBytes(gu::uint64 hash, const void* data, const gu::uint64 byteSize)
+	{
+		const auto bytes = static_cast<const gu::uint8*>(data);
+		for (gu::uint64 i = 0; i < byteSize; ++i)
+		{
+			hash ^= bytes[i];
+			hash *= FNV_PRIME;
+		}
+		return hash;
+	}
+
+	/* @brief : Decode one UTF-8 character. The invalid byte is returned as it is (1 byte).*/
+	gu::uint32 DecodeUTF8(const std::string& string, const gu::uint64 offset, gu::uint32& outByteCount)
+	{
+		const auto lead = static_cast<gu::uint8>(string[offset]);
+
+		gu::uint32 count = 1;
+		gu::uint32 codepoint = lead;
+		if      ((lead & 0xE0) == 0xC0) { count = 2; codepoint = lead & 0x1F; }
+		else if ((lead & 0xF0) == 0xE0) { count = 3; codepoint = lead & 0x0F; }
+		else if ((lead & 0xF8) == 0xF0) { count = 4; codepoint = lead & 0x07; }
+
+		if (count == 1 || offset + count > string.size()) { outByteCount = 1; return lead; }
+
+		for (gu::uint32 i = 1; i < count; ++i)
+		{
+			const auto trail = static_cast<gu::uint8>(string[offset + i]);
+			if ((trail & 0xC0) != 0x80) { outByteCount = 1; return lead; }
+			codepoint = (codepoint << 6) | (trail & 0x3F);
+		}
+
+		outByteCount = count;
+		return codepoint;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          GlyphCache
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region GlyphCache
+GlyphCache::GlyphCache(const gu::SharedPointer<Font>& font, const gu::uint32 capacity)
+	: _font(font), _glyphs(capacity)
+{
+	Check(font);
+}
+
+/****************************************************************************
+*                     Get
+*************************************************************************//**
+*  @fn        const Glyph& GlyphCache::Get(const gu::uint32 codepoint, const float size)
+*
+*  @brief     Return the glyph of the codepoint and the character height.
+*             The glyph is loaded into the least recently used slot on the miss.
+*
+*  @param[in] const gu::uint32 codepoint
+*  @param[in] const float size : character height in the text coordinate
+*
+*  @return    const Glyph& : valid until the next Get call
+*****************************************************************************/
+const Glyph& GlyphCache::Get(const gu::uint32 codepoint, const float size)
+{
+	const auto key   = (static_cast<gu::uint64>(std::bit_cast<gu::uint32>(size)) << 32) | codepoint;
+	auto       index = _glyphs.Find(key);
+	if (index != gu::LRUCache<Glyph>::INVALID_INDEX)
+	{
+		_hitCount++;
+		return _glyphs.At(index);
+	}
+
+	bool evicted = false;
+	index = _glyphs.Insert(key, &evicted);
+	_glyphs.At(index) = Load(codepoint, size);
+
+	_missCount++;
+	if (evicted) { _evictionCount++; }
+	return _glyphs.At(index);
+}
+
+/****************************************************************************
+*                     Clear
+*************************************************************************//**
+*  @fn        void GlyphCache::Clear()
+*
+*  @brief     Remove all glyphs
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
+void GlyphCache::Clear()
+{
+	_glyphs.Clear();
+}
+
+/****************************************************************************
+*                     Load
+*************************************************************************//**
+*  @fn        Glyph GlyphCache::Load(const gu::uint32 codepoint, const float size) const
+*
+*  @brief     Create the glyph from the font.
+*             The bitmap font has the one cell for all sizes, so the size is not used.
+*
+*  @param[in] const gu::uint32 codepoint
+*  @param[in] const float size
+*
+*  @return    Glyph
+*****************************************************************************/
+Glyph GlyphCache::Load(const gu::uint32 codepoint, [[maybe_unused]] const float size) const
+{
+	Glyph glyph = {};
+	if (codepoint == ' ') { return glyph; }
+
+	glyph.HasImage = _font->GetGlyphUV(codepoint, glyph.U, glyph.V);
+	return glyph;
+}
+#pragma endregion GlyphCache
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          TextLayoutCache
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region TextLayoutCache
+TextLayoutCache::TextLayoutCache(const gu::SharedPointer<Font>& font, const gu::uint32 capacity, const gu::uint32 glyphCapacity)
+	: _glyphCache(font, glyphCapacity), _layouts(capacity)
+{
+
+}
+
+/****************************************************************************
+*                     Request
+*************************************************************************//**
+*  @fn        TextLayoutHandle TextLayoutCache::Request(const std::string& string, const TextLayoutStyle& style, const TextLayoutHandle& previous)
+*
+*  @brief     Return the layout of the string.
+*             On the miss, the common prefix with the previous layout is copied and
+*             only the characters after the first changed one are laid out.
+*             The previous layout is marked as the least recently used after that.
+*
+*  @param[in] const std::string& string (UTF-8)
+*  @param[in] const TextLayoutStyle& style
+*  @param[in] const TextLayoutHandle& previous : layout of the text before the change (can be invalid)
+*
+*  @return    TextLayoutHandle
+*****************************************************************************/
+TextLayoutHandle TextLayoutCache::Request(const std::string& string, const TextLayoutStyle& style, const TextLayoutHandle& previous)
+{
+	/*-------------------------------------------------------------------
+	-           Cached layout
+	---------------------------------------------------------------------*/
+	const auto hash  = ComputeHash(string, style);
+	auto       index = _layouts.Find(hash);
+	if (index != gu::LRUCache<TextLayout>::INVALID_INDEX)
+	{
+		const auto& layout = _layouts.At(index);
+		if (layout.String == string && layout.Style == style)
+		{
+			_hitCount++;
+			return { index, _layouts.GetGeneration(index) };
+		}
+		// The hash collision overwrites the slot below.
+	}
+
+	_missCount++;
+
+	/*-------------------------------------------------------------------
+	-           Keep the previous layout alive while the slot is selected
+	---------------------------------------------------------------------*/
+	const bool hasPrevious = _layouts.IsAlive(previous.Index, previous.Generation) && _layouts.At(previous.Index).Style == style;
+	if (hasPrevious) { _layouts.Touch(previous.Index); }
+
+	if (index == gu::LRUCache<TextLayout>::INVALID_INDEX) { index = _layouts.Insert(hash); }
+
+	auto& layout = _layouts.At(index);
+
+	/*-------------------------------------------------------------------
+	-           Copy the common prefix of the previous layout
+	---------------------------------------------------------------------*/
+	gu::uint64 offset = 0;
+	if (hasPrevious)
+	{
+		const auto& source    = _layouts.At(previous.Index);
+		const auto  maxOffset = source.String.size() < string.size() ? source.String.size() : string.size();
+		while (offset < maxOffset && source.String[offset] == string[offset]) { ++offset; }
+
+		// The decoding of the UTF-8 character depends on its trailing bytes,
+		// so the multi-byte character containing the last common byte is laid out again.
+		gu::uint64 lead = offset;
+		while (lead > 0 && offset - lead < 3 && (static_cast<gu::uint8>(string[lead - 1]) & 0xC0) == 0x80) { --lead; }
+		if (lead > 0 && static_cast<gu::uint8>(string[lead - 1]) >= 0xC0) { offset = lead - 1; }
+
+		const auto vertexCount = static_cast<gu::uint64>(source.Pens[offset].GlyphCount) * 4;
+		if (&source != &layout)
+		{
+			layout.Vertices.Clear();
+			layout.Pens    .Clear();
+			for (gu::uint64 i = 0; i < vertexCount; ++i) { layout.Vertices.Push(source.Vertices[i]); }
+			for (gu::uint64 i = 0; i <= offset;     ++i) { layout.Pens    .Push(source.Pens[i]); }
+		}
+		else
+		{
+			// The slot of the previous layout itself is reused (capacity 1 or hash collision)
+			if (layout.Vertices.Size() > vertexCount) { layout.Vertices.RemoveAt(vertexCount, layout.Vertices.Size() - vertexCount, false); }
+			if (layout.Pens    .Size() > offset + 1)  { layout.Pens    .RemoveAt(offset + 1 , layout.Pens    .Size() - offset - 1 , false); }
+		}
+		_reusedGlyphCount += source.Pens[offset].GlyphCount;
+	}
+	else
+	{
+		layout.Vertices.Clear();
+		layout.Pens    .Clear();
+		layout.Pens    .Push(TextLayout::PenState());
+	}
+
+	layout.Hash   = hash;
+	layout.String = string;
+	layout.Style  = style;
+	Layout(layout, offset);
+
+	// The changed text does not use the previous layout any more, so it is evicted first.
+	// (Get from the other texts sharing the layout moves it to the front again)
+	if (hasPrevious && previous.Index != index) { _layouts.Demote(previous.Index); }
+
+	return { index, _layouts.GetGeneration(index) };
+}
+
+/****************************************************************************
+*                     Get
+*************************************************************************//**
+*  @fn        const TextLayout* TextLayoutCache::Get(const TextLayoutHandle& handle)
+*
+*  @brief     Return the layout of the handle.
+*             The layout is marked as the most recently used, so the drawn texts are not evicted.
+*
+*  @param[in] const TextLayoutHandle& handle
+*
+*  @return    const TextLayout* : nullptr if the layout has been evicted
+*****************************************************************************/
+const TextLayout* TextLayoutCache::Get(const TextLayoutHandle& handle)
+{
+	if (!_layouts.IsAlive(handle.Index, handle.Generation)) { return nullptr; }
+
+	_layouts.Touch(handle.Index);
+	return &_layouts.At(handle.Index);
+}
+
+/****************************************************************************
+*                     Clear
+*************************************************************************//**
+*  @fn        void TextLayoutCache::Clear()
+*
+*  @brief     Remove all layouts and glyphs
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
+void TextLayoutCache::Clear()
+{
+	_layouts   .Clear();
+	_glyphCache.Clear();
+}
+
+void TextLayoutCache::ResetStatistics() noexcept
+{
+	_hitCount = _missCount = _laidOutGlyphCount = _reusedGlyphCount = 0;
+	_glyphCache.ResetStatistics();
+}
+
+/****************************************************************************
+*                     Layout
+*************************************************************************//**
+*  @fn        void TextLayoutCache::Layout(TextLayout& layout, const gu::uint64 offset)
+*
+*  @brief     Lay out the string from the byte offset.
+*             The rect center is the same as the Text constructor.
+*             x : (column + 0.5) * width + column * space.x + kerning
+*             y : -height - line * (height + space.y)
+*             The line feed resets the column, and the white space advances without the quad.
+*
+*  @param[in,out] TextLayout& layout
+*  @param[in]     const gu::uint64 offset (first byte of the UTF-8 character)
+*
+*  @return    void
+*****************************************************************************/
+void TextLayoutCache::Layout(TextLayout& layout, const gu::uint64 offset)
+{
+	const auto& string = layout.String;
+	const auto  size   = layout.Style.SizePerChar;
+	const auto  space  = layout.Style.Space;
+	const auto& font   = _glyphCache.GetFont();
+	const bool  hasKerning = font->HasKerning();
+
+	const gm::Float3 normal = gm::Float3(0.0f, 0.0f, 1.0f);
+	const gm::Float4 white  = gm::Float4(1.0f, 1.0f, 1.0f, 1.0f);
+	const float w2 = size.x * 0.5f;
+	const float h2 = size.y * 0.5f;
+
+	TextLayout::PenState pen = layout.Pens[offset];
+	layout.Pens    .Reserve(string.size() + 1);
+	layout.Vertices.Reserve(static_cast<gu::uint64>(pen.GlyphCount + (string.size() - offset)) * 4);
+
+	gu::uint64 byte = offset;
+	while (byte < string.size())
+	{
+		gu::uint32 byteCount = 1;
+		const auto codepoint = DecodeUTF8(string, byte, byteCount);
+
+		if (codepoint == '\n')
+		{
+			pen.Line++;
+			pen.Column   = 0;
+			pen.KerningX = 0.0f;
+			pen.Previous = 0;
+		}
+		else
+		{
+			if (hasKerning && pen.Previous != 0)
+			{
+				pen.KerningX += font->GetKerning(pen.Previous, codepoint) * size.x;
+			}
+
+			const auto& glyph = _glyphCache.Get(codepoint, size.y);
+			if (glyph.HasImage)
+			{
+				const float cx = (pen.Column + 0.5f) * size.x + pen.Column * space.x + pen.KerningX;
+				const float cy = -size.y - pen.Line * (size.y + space.y);
+
+				layout.Vertices.Push(gm::Vertex(gm::Float3(cx - w2, cy - h2, 0.0f), normal, white, gm::Float2(glyph.U.x, glyph.V.y)));
+				layout.Vertices.Push(gm::Vertex(gm::Float3(cx - w2, cy + h2, 0.0f), normal, white, gm::Float2(glyph.U.x, glyph.V.x)));
+				layout.Vertices.Push(gm::Vertex(gm::Float3(cx + w2, cy + h2, 0.0f), normal, white, gm::Float2(glyph.U.y, glyph.V.x)));
+				layout.Vertices.Push(gm::Vertex(gm::Float3(cx + w2, cy - h2, 0.0f), normal, white, gm::Float2(glyph.U.y, glyph.V.y)));
+				pen.GlyphCount++;
+				_laidOutGlyphCount++;
+			}
+
+			const float lineWidth = (pen.Column + 1) * size.x + pen.Column * space.x + pen.KerningX;
+			if (lineWidth > pen.MaxWidth) { pen.MaxWidth = lineWidth; }
+
+			pen.Column++;
+			pen.Previous = codepoint;
+		}
+
+		/*-------------------------------------------------------------------
+		-           The trailing bytes of the character keep the state before it
+		---------------------------------------------------------------------*/
+		for (gu::uint32 i = 1; i < byteCount; ++i) { layout.Pens.Push(layout.Pens[byte]); }
+		layout.Pens.Push(pen);
+		byte += byteCount;
+	}
+
+	layout.GlyphCount = pen.GlyphCount;
+	layout.LineCount  = string.empty() ? 0 : pen.Line + 1;
+	layout.Extent     = gm::Float2(pen.MaxWidth, layout.LineCount == 0 ? 0.0f : layout.LineCount * size.y + (layout.LineCount - 1) * space.y);
+}
+
+/****************************************************************************
+*                     ComputeHash
+*************************************************************************//**
+*  @fn        gu::uint64 TextLayoutCache::ComputeHash(const std::string& string, const TextLayoutStyle& style)
+*
+*  @brief     FNV-1a hash of the string and the style
+*
+*  @param[in] const std::string& string
+*  @param[in] const TextLayoutStyle& style
+*
+*  @return    gu::uint64
+*****************************************************************************/
+gu::uint64 TextLayoutCache::ComputeHash(const std::string& string, const TextLayoutStyle& style)
+{
+	gu::uint64 hash = FNV_OFFSET_BASIS;
+	hash = HashBytes(hash, string.data(), string.size());
+	hash = HashBytes(hash, &style.SizePerChar, sizeof(style.SizePerChar));
+	hash = HashBytes(hash, &style.Space, sizeof(style.Space));
+	return hash;
+}
+#pragma endregion TextLayoutCache
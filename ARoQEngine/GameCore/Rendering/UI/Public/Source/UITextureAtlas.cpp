@@ -0,0 +1,403 @@
+//////////////////////////////////////////////////////////////////////////////////
+//              @file   UITextureAtlas.cpp
+///             @brief  Runtime texture atlas for the UI sprites
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/UITextureAtlas.hpp"
+#include "GraphicsCore/Engine/Include/LowLevelGraphicsEngine.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIDevice.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHICommandList.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUTexture.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUResourceView.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::core;
+using namespace gc::ui;
+
+namespace
+{
+	gu::uint32 AlignUp(const gu::uint32 value, const gu::uint32 alignment)
+	{
+		return (value + alignment - 1) / alignment * alignment;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          SkylinePacker
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region SkylinePacker
+SkylinePacker::SkylinePacker(const gu::uint32 width, const gu::uint32 height)
+	: _width(width), _height(height)
+{
+	Clear();
+}
+
+/****************************************************************************
+*                     Clear
+*************************************************************************//**
+*  @fn        void SkylinePacker::Clear()
+*
+*  @brief     Remove all rectangles. The skyline becomes one segment on the bottom.
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
+void SkylinePacker::Clear()
+{
+	_skyline.Clear();
+	_skyline.Push({ 0, 0, _width });
+	_usedArea = 0;
+}
+
+/****************************************************************************
+*                     Insert
+*************************************************************************//**
+*  @fn        bool SkylinePacker::Insert(const gu::uint32 width, const gu::uint32 height, gu::uint32& outX, gu::uint32& outY)
+*
+*  @brief     Find the position of the rectangle with the bottom-left rule and occupy it.
+*             The segment giving the lowest top edge is selected, and the narrower segment wins the tie.
+*
+*  @param[in]  const gu::uint32 width
+*  @param[in]  const gu::uint32 height
+*  @param[out] gu::uint32& outX
+*  @param[out] gu::uint32& outY
+*
+*  @return    bool : false if the rectangle does not fit
+*****************************************************************************/
+bool SkylinePacker::Insert(const gu::uint32 width, const gu::uint32 height, gu::uint32& outX, gu::uint32& outY)
+{
+	if (width == 0 || height == 0 || width > _width || height > _height) { return false; }
+
+	gu::uint64 bestIndex  = gu::DynamicArray<Segment>::INDEX_NONE;
+	gu::uint32 bestTop    = UINT32_MAX;
+	gu::uint32 bestWidth  = UINT32_MAX;
+	gu::uint32 bestY      = 0;
+
+	for (gu::uint64 i = 0; i < _skyline.Size(); ++i)
+	{
+		gu::uint32 y = 0;
+		if (!Fit(i, width, height, y)) { continue; }
+
+		const gu::uint32 top = y + height;
+		if (top < bestTop || (top == bestTop && _skyline[i].Width < bestWidth))
+		{
+			bestIndex = i;
+			bestTop   = top;
+			bestWidth = _skyline[i].Width;
+			bestY     = y;
+		}
+	}
+
+	if (bestIndex == gu::DynamicArray<Segment>::INDEX_NONE) { return false; }
+
+	outX = _skyline[bestIndex].X;
+	outY = bestY;
+	AddLevel(bestIndex, outX, outY, width, height);
+	_usedArea += static_cast<gu::uint64>(width) * height;
+	return true;
+}
+
+/****************************************************************************
+*                     Fit
+*************************************************************************//**
+*  @fn        bool SkylinePacker::Fit(const gu::uint64 index, const gu::uint32 width, const gu::uint32 height, gu::uint32& outY) const
+*
+*  @brief     The rectangle placed at the left of the segment rests on the highest segment under its width.
+*
+*  @param[in]  const gu::uint64 index
+*  @param[in]  const gu::uint32 width
+*  @param[in]  const gu::uint32 height
+*  @param[out] gu::uint32& outY
+*
+*  @return    bool
+*****************************************************************************/
+bool SkylinePacker::Fit(const gu::uint64 index, const gu::uint32 width, const gu::uint32 height, gu::uint32& outY) const
+{
+	const gu::uint32 x = _skyline[index].X;
+	if (x + width > _width) { return false; }
+
+	gu::uint32 y         = 0;
+	gu::int64  remaining = width;
+	for (gu::uint64 i = index; remaining > 0; ++i)
+	{
+		if (i >= _skyline.Size()) { return false; }
+
+		y = _skyline[i].Y > y ? _skyline[i].Y : y;
+		if (y + height > _height) { return false; }
+
+		remaining -= _skyline[i].Width;
+	}
+
+	outY = y;
+	return true;
+}
+
+/****************************************************************************
+*                     AddLevel
+*************************************************************************//**
+*  @fn        void SkylinePacker::AddLevel(const gu::uint64 index, const gu::uint32 x, const gu::uint32 y, const gu::uint32 width, const gu::uint32 height)
+*
+*  @brief     Insert the new top segment, shrink the covered segments and merge the same height neighbours.
+*
+*  @param[in] const gu::uint64 index
+*  @param[in] const gu::uint32 x
+*  @param[in] const gu::uint32 y
+*  @param[in] const gu::uint32 width
+*  @param[in] const gu::uint32 height
+*
+*  @return    void
+*****************************************************************************/
+void SkylinePacker::AddLevel(const gu::uint64 index, const gu::uint32 x, const gu::uint32 y, const gu::uint32 width, const gu::uint32 height)
+{
+	/*-------------------------------------------------------------------
+	-           Insert the new segment at index
+	---------------------------------------------------------------------*/
+	_skyline.Push({});
+	for (gu::uint64 i = _skyline.Size() - 1; i > index; --i)
+	{
+		_skyline[i] = _skyline[i - 1];
+	}
+	_skyline[index] = { x, y + height, width };
+
+	/*-------------------------------------------------------------------
+	-           Shrink or remove the segments under the new one
+	---------------------------------------------------------------------*/
+	const gu::uint32 right = x + width;
+	for (gu::uint64 i = index + 1; i < _skyline.Size();)
+	{
+		auto& segment = _skyline[i];
+		if (segment.X >= right) { break; }
+
+		const gu::uint32 segmentRight = segment.X + segment.Width;
+		if (segmentRight <= right)
+		{
+			_skyline.RemoveAt(i, 1, false);
+			continue;
+		}
+
+		segment.Width = segmentRight - right;
+		segment.X     = right;
+		break;
+	}
+
+	/*-------------------------------------------------------------------
+	-           Merge the neighbours with the same height
+	---------------------------------------------------------------------*/
+	for (gu::uint64 i = 0; i + 1 < _skyline.Size();)
+	{
+		if (_skyline[i].Y == _skyline[i + 1].Y)
+		{
+			_skyline[i].Width += _skyline[i + 1].Width;
+			_skyline.RemoveAt(i + 1, 1, false);
+			continue;
+		}
+		++i;
+	}
+}
+#pragma endregion SkylinePacker
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          TextureAtlas
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+TextureAtlas::TextureAtlas(const LowLevelGraphicsEnginePtr& engine, const gu::uint32 pageSize, const gu::uint32 padding)
+	: _engine(engine), _pageSize(pageSize), _padding(padding)
+{
+	Check(_engine);
+	Check(_pageSize > 0);
+}
+
+TextureAtlas::~TextureAtlas()
+{
+	_regionIndices.Clear();
+	_regions.Clear(); _regions.ShrinkToFit();
+	_pages  .Clear(); _pages  .ShrinkToFit();
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Public Function
+/****************************************************************************
+*                     Add
+*************************************************************************//**
+*  @fn        bool TextureAtlas::Add(const ResourceViewPtr& view, const CommandListPtr& graphicsCommandList)
+*
+*  @brief     Copy mip 0 of the texture bound to the view into the page of the same pixel format.
+*             The new page is created when no page has the space.
+*
+*  @param[in] const ResourceViewPtr& view
+*  @param[in] const CommandListPtr& graphicsCommandList (recording, outside the render pass)
+*
+*  @return    bool : true if the texture is in the atlas
+*****************************************************************************/
+bool TextureAtlas::Add(const ResourceViewPtr& view, const CommandListPtr& graphicsCommandList)
+{
+	if (!view || !graphicsCommandList) { return false; }
+
+	const auto texture = view->GetTexture();
+	if (!texture) { return false; }
+
+	const auto key = reinterpret_cast<gu::uint64>(texture.Get());
+	if (_regionIndices.Contains(key)) { return true; }
+
+	/*-------------------------------------------------------------------
+	-           Only the single 2D texture can be packed
+	---------------------------------------------------------------------*/
+	if (texture->GetDimension() != ResourceDimension::Dimension2D || texture->IsArray() ||
+		texture->GetMultiSample() != MultiSample::Count1)
+	{
+		return false;
+	}
+
+	const auto format    = texture->GetPixelFormat();
+	const auto alignment = IsBlockCompressed(format) ? 4u : 1u;
+	const auto padding   = AlignUp(_padding, alignment);
+	const auto width     = static_cast<gu::uint32>(texture->GetWidth());
+	const auto height    = static_cast<gu::uint32>(texture->GetHeight());
+
+	// Block compressed rectangles are kept on 4 pixel boundaries
+	const auto packWidth  = AlignUp(width  + padding * 2, alignment);
+	const auto packHeight = AlignUp(height + padding * 2, alignment);
+	if (packWidth > _pageSize || packHeight > _pageSize) { return false; }
+
+	/*-------------------------------------------------------------------
+	-           Find the page which has the space
+	---------------------------------------------------------------------*/
+	gu::uint32 page = static_cast<gu::uint32>(_pages.Size());
+	gu::uint32 x = 0, y = 0;
+	for (gu::uint32 i = 0; i < _pages.Size(); ++i)
+	{
+		if (_pages[i].Format != format) { continue; }
+		if (_pages[i].Packer.Insert(packWidth, packHeight, x, y)) { page = i; break; }
+	}
+
+	if (page == _pages.Size())
+	{
+		page = CreatePage(format);
+		if (!_pages[page].Packer.Insert(packWidth, packHeight, x, y)) { return false; }
+	}
+
+	/*-------------------------------------------------------------------
+	-           Copy the texture and register the region
+	---------------------------------------------------------------------*/
+	graphicsCommandList->CopyTextureRegion(_pages[page].Texture, x + padding, y + padding, texture);
+
+	// Half texel inset keeps the bilinear filter inside the source texels
+	const float invPageSize = 1.0f / static_cast<float>(_pageSize);
+
+	AtlasRegion region = {};
+	region.Page     = page;
+	region.X        = x + padding;
+	region.Y        = y + padding;
+	region.Width    = width;
+	region.Height   = height;
+	region.UVOffset = { (region.X + 0.5f) * invPageSize, (region.Y + 0.5f) * invPageSize };
+	region.UVScale  = { (width  - 1.0f) * invPageSize, (height - 1.0f) * invPageSize };
+	region.Source   = texture;
+
+	_regionIndices.Insert({ key, static_cast<gu::uint32>(_regions.Size()) });
+	_regions.Push(region);
+	_usedArea += static_cast<gu::uint64>(width) * height;
+	return true;
+}
+
+/****************************************************************************
+*                     Find
+*************************************************************************//**
+*  @fn        const AtlasRegion* TextureAtlas::Find(const ResourceViewPtr& view) const
+*
+*  @brief     Return the region of the texture bound to the view
+*
+*  @param[in] const ResourceViewPtr& view
+*
+*  @return    const AtlasRegion* : nullptr if the texture is not in the atlas
+*****************************************************************************/
+const AtlasRegion* TextureAtlas::Find(const ResourceViewPtr& view) const
+{
+	if (!view || _regions.IsEmpty()) { return nullptr; }
+
+	const auto texture = view->GetTexture();
+	if (!texture) { return nullptr; }
+
+	const auto key = reinterpret_cast<gu::uint64>(texture.Get());
+	if (!_regionIndices.Contains(key)) { return nullptr; }
+
+	return &_regions[_regionIndices.At(key)];
+}
+
+/****************************************************************************
+*                     GetPackingEfficiency
+*************************************************************************//**
+*  @fn        float TextureAtlas::GetPackingEfficiency() const noexcept
+*
+*  @brief     Source texture area / total page area
+*
+*  @param[in] void
+*
+*  @return    float (0 if no page exists)
+*****************************************************************************/
+float TextureAtlas::GetPackingEfficiency() const noexcept
+{
+	if (_pages.IsEmpty()) { return 0.0f; }
+
+	const auto pageArea = static_cast<double>(_pageSize) * _pageSize * _pages.Size();
+	return static_cast<float>(_usedArea / pageArea);
+}
+#pragma endregion Public Function
+
+#pragma region Protected Function
+/****************************************************************************
+*                     CreatePage
+*************************************************************************//**
+*  @fn        gu::uint32 TextureAtlas::CreatePage(const rhi::core::PixelFormat format)
+*
+*  @brief     Create the page texture (one mip) and its shader resource view
+*
+*  @param[in] const rhi::core::PixelFormat format
+*
+*  @return    gu::uint32 : page index
+*****************************************************************************/
+gu::uint32 TextureAtlas::CreatePage(const rhi::core::PixelFormat format)
+{
+	const auto device = _engine->GetDevice();
+
+	Page page = {};
+	page.Format  = format;
+	page.Packer  = SkylinePacker(_pageSize, _pageSize);
+	page.Texture = device->CreateTexture(GPUTextureMetaData::Texture2D(_pageSize, _pageSize, format, 1), SP("UITextureAtlas::Page"));
+	page.View    = device->CreateResourceView(ResourceViewType::Texture, page.Texture);
+
+	_pages.Push(page);
+	return static_cast<gu::uint32>(_pages.Size() - 1);
+}
+
+bool TextureAtlas::IsBlockCompressed(const rhi::core::PixelFormat format)
+{
+	switch (format)
+	{
+		case PixelFormat::BC1_UNORM:
+		case PixelFormat::BC2_UNORM:
+		case PixelFormat::BC3_UNORM:
+		case PixelFormat::BC4_UNORM:
+		case PixelFormat::BC5_UNORM:
+		case PixelFormat::BC6H_UNORM:
+		case PixelFormat::BC7_UNORM:
+		{
+			return true;
+		}
+		default:
+		{
+			return false;
+		}
+	}
+}
+#pragma endregion Protected Function
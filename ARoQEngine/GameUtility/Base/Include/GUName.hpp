@@ -0,0 +1,127 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GUName.hpp
+///             @brief  Interned string handle for names, tags, layers and resource keys.
+///                     The string is registered into the global name table once,
+///                     and the equality check is done by comparing the integer index.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GU_NAME_HPP
+#define GU_NAME_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             HowTo
+//////////////////////////////////////////////////////////////////////////////////
+// const gu::Name player = SP("Player");          // register (or find) the string
+// if (object->GetTag() == player) { ... }        // O(1) compare
+// if (a.EqualsIgnoreCase(b))      { ... }        // O(1) compare ignoring ASCII case
+// const auto found = gu::Name::Find(SP("Enemy")); // None if the string was never registered
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GUType.hpp"
+#include "GUString.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gu
+{
+	/****************************************************************************
+	*				  			   Name
+	*************************************************************************//**
+	*  @class     Name
+	*  @brief     8 byte handle of the interned string.
+	*             The string data is stored in the global name table and is never released,
+	*             so CString() is valid until the application exits.
+	*             Registration takes the table lock, but Find / CString / GetHash do not lock.
+	*             Index 0 is the empty string (None).
+	*             operator< orders by the registration index, not by the lexical order.
+	*****************************************************************************/
+	class Name
+	{
+	public:
+		/****************************************************************************
+		**                Static Function
+		*****************************************************************************/
+		/* @brief : Return the registered name or None. The string is not registered.*/
+		static Name Find(const tchar* string);
+
+		static Name Find(const tchar* string, const uint64 length);
+
+		static Name Find(const tstring& string) { return Find(string.CString(), string.Size()); }
+
+		/* @brief : Registered string count (including None)*/
+		static uint32 GetEntryCount();
+
+		/* @brief : Byte size of the string storage*/
+		static uint64 GetStringByteSize();
+
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Compare ignoring the ASCII case ("Player" equals "PLAYER")*/
+		__forceinline bool EqualsIgnoreCase(const Name& other) const noexcept { return _caseInsensitiveIndex == other._caseInsensitiveIndex; }
+
+		/* @brief : Copy the string*/
+		tstring ToString() const { return tstring(CString(), Size()); }
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		/* @brief : Null terminated string stored in the name table*/
+		const tchar* CString() const;
+
+		/* @brief : Character count*/
+		uint64 Size() const;
+
+		/* @brief : Precomputed hash of the string*/
+		uint64 GetHash() const;
+
+		/* @brief : Precomputed hash of the lower case string*/
+		uint64 GetCaseInsensitiveHash() const;
+
+		__forceinline uint32 GetIndex() const noexcept { return _index; }
+
+		__forceinline uint32 GetCaseInsensitiveIndex() const noexcept { return _caseInsensitiveIndex; }
+
+		__forceinline bool IsNone() const noexcept { return _index == 0; }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		Name() = default;
+
+		/* @brief : Register the string (or find the registered one)*/
+		Name(const tchar* string);
+
+		Name(const tchar* string, const uint64 length);
+
+		Name(const tstring& string) : Name(string.CString(), string.Size()) {};
+
+		__forceinline bool operator==(const Name& other) const noexcept { return _index == other._index; }
+		__forceinline bool operator!=(const Name& other) const noexcept { return _index != other._index; }
+		__forceinline bool operator< (const Name& other) const noexcept { return _index <  other._index; }
+		__forceinline bool operator> (const Name& other) const noexcept { return _index >  other._index; }
+
+	private:
+		/****************************************************************************
+		**                Private Function
+		*****************************************************************************/
+		Name(const uint32 index, const uint32 caseInsensitiveIndex) : _index(index), _caseInsensitiveIndex(caseInsensitiveIndex) {};
+
+		/****************************************************************************
+		**                Private Member Variables
+		*****************************************************************************/
+		uint32 _index = 0;
+
+		// index of the lower case string
+		uint32 _caseInsensitiveIndex = 0;
+	};
+}
+#endif
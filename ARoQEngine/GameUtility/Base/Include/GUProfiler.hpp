@@ -0,0 +1,258 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GUProfiler.hpp
+///             @brief  Hierarchical CPU profiler.
+///                     Each thread writes the scoped zones into its own lock free ring buffer,
+///                     and the buffers are drained at the frame boundary.
+///                     The zones are shown as the rolling statistics (min / average / p99)
+///                     and can be exported as the Chrome trace json (chrome://tracing, Perfetto).
+///                     GU_PROFILER_ENABLED = 0 removes all of the profile macros.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GU_PROFILER_HPP
+#define GU_PROFILER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             HowTo
+//////////////////////////////////////////////////////////////////////////////////
+// void Update()
+// {
+//     GU_PROFILE_FUNCTION();                 // zone named by the function
+//     { GU_PROFILE_SCOPE("Physics"); ... }   // nested zone (the name must be the string literal)
+// }
+// gu::Profiler::Instance().StartCapture();
+// ... some frames ...
+// gu::Profiler::Instance().StopCapture();
+// gu::Profiler::Instance().ExportChromeTrace(SP("Profile.json"));
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GUType.hpp"
+#include "GUString.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+#include <atomic>
+#include <chrono>
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define GU_PROFILER_USE_RDTSC (1)
+#else
+#define GU_PROFILER_USE_RDTSC (0)
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+#ifndef GU_PROFILER_ENABLED
+#define GU_PROFILER_ENABLED (1)
+#endif
+
+#define GU_PROFILE_CONCAT_INNER(a, b) a##b
+#define GU_PROFILE_CONCAT(a, b) GU_PROFILE_CONCAT_INNER(a, b)
+
+#if GU_PROFILER_ENABLED
+	#define GU_PROFILE_SCOPE(name)        const gu::ProfileScope GU_PROFILE_CONCAT(_profileScope, __LINE__)(name)
+	#define GU_PROFILE_FUNCTION()         GU_PROFILE_SCOPE(__FUNCTION__)
+	#define GU_PROFILE_BEGIN_FRAME()      gu::Profiler::Instance().BeginFrame()
+	#define GU_PROFILE_END_FRAME()        gu::Profiler::Instance().EndFrame()
+	#define GU_PROFILE_THREAD_NAME(name)  gu::Profiler::Instance().SetThreadName(name)
+#else
+	#define GU_PROFILE_SCOPE(name)        ((void)0)
+	#define GU_PROFILE_FUNCTION()         ((void)0)
+	#define GU_PROFILE_BEGIN_FRAME()      ((void)0)
+	#define GU_PROFILE_END_FRAME()        ((void)0)
+	#define GU_PROFILE_THREAD_NAME(name)  ((void)0)
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gu
+{
+	/****************************************************************************
+	*				  			ProfileZoneStatistics
+	*************************************************************************//**
+	*  @struct    ProfileZoneStatistics
+	*  @brief     Rolling statistics of the zone over the last HISTORY_FRAME_COUNT frames.
+	*             The zone called several times in one frame is summed up per frame.
+	*****************************************************************************/
+	struct ProfileZoneStatistics
+	{
+		const char* Name = nullptr;
+
+		float LastMilliseconds    = 0.0f;
+		float MinMilliseconds     = 0.0f;
+		float AverageMilliseconds = 0.0f;
+		float P99Milliseconds     = 0.0f;
+
+		/* @brief : Call count in the last frame*/
+		uint32 CallCount = 0;
+
+		/* @brief : true : measured by the GPU timestamp query*/
+		bool IsGPU = false;
+	};
+
+	/****************************************************************************
+	*				  			   Profiler
+	*************************************************************************//**
+	*  @class     Profiler
+	*  @brief     Frame based CPU / GPU profiler.
+	*             RecordZone is lock free (the thread buffer is registered with the lock only once per thread).
+	*             BeginFrame / EndFrame / GetZoneStatistics / ExportChromeTrace must be called from one thread.
+	*             The zone name is stored as the pointer, so it must live until the application exits (string literal).
+	*****************************************************************************/
+	class Profiler
+	{
+	public:
+		/****************************************************************************
+		**                Static Configuration
+		*****************************************************************************/
+		/* @brief : Event count per thread buffer. The event is dropped when the buffer is full.*/
+		static constexpr uint32 THREAD_EVENT_CAPACITY = 16384;
+
+		/* @brief : Frame count used by the rolling statistics*/
+		static constexpr uint32 HISTORY_FRAME_COUNT = 120;
+
+		/* @brief : Max event count kept by the capture*/
+		static constexpr uint32 MAX_CAPTURE_EVENT_COUNT = 1 << 20;
+
+		/****************************************************************************
+		**                Static Function
+		*****************************************************************************/
+		static Profiler& Instance();
+
+		/*----------------------------------------------------------------------
+		*  @brief : Raw timestamp (rdtsc on x86 msvc, otherwise steady_clock nanoseconds)
+		/*----------------------------------------------------------------------*/
+		__forceinline static uint64 GetTimestamp() noexcept
+		{
+		#if GU_PROFILER_USE_RDTSC
+			return __rdtsc();
+		#else
+			return static_cast<uint64>(std::chrono::steady_clock::now().time_since_epoch().count());
+		#endif
+		}
+
+		/*----------------------------------------------------------------------
+		*  @brief : steady_clock microseconds. (the same clock as QueryPerformanceCounter on msvc)
+		/*----------------------------------------------------------------------*/
+		static uint64 GetClockMicroseconds() noexcept;
+
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Start the frame. (Call at the top of the game loop)*/
+		void BeginFrame();
+
+		/* @brief : Finish the frame, drain the thread buffers and update the statistics.*/
+		void EndFrame();
+
+		/* @brief : Name of the current thread shown in the trace. The string is copied.*/
+		void SetThreadName(const char* name);
+
+		/* @brief : Record the zone of the current thread. The ticks are returned by GetTimestamp.*/
+		void RecordZone(const char* name, const uint64 beginTick, const uint64 endTick, const uint32 depth);
+
+		/* @brief : Record the GPU zone. The time is converted to the GetClockMicroseconds timeline.*/
+		void AddGPUZone(const char* name, const uint64 beginMicroseconds, const uint64 endMicroseconds, const uint32 depth);
+
+		/* @brief : Start to keep the events for ExportChromeTrace. The previous capture is cleared.*/
+		void StartCapture();
+
+		void StopCapture();
+
+		/* @brief : Write the captured events as the Chrome trace event json*/
+		bool ExportChromeTrace(const tstring& filePath) const;
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		/* @brief : Statistics of all zones measured in the history frames*/
+		DynamicArray<ProfileZoneStatistics> GetZoneStatistics() const;
+
+		/* @brief : Event count dropped because the thread buffer was full*/
+		uint64 GetDroppedEventCount() const noexcept { return _droppedEventCount.load(std::memory_order_relaxed); }
+
+		uint64 GetFrameCount() const noexcept { return _frameCount; }
+
+		bool IsCapturing() const noexcept { return _isCapturing; }
+
+		__forceinline bool IsEnabled() const noexcept { return _isEnabled.load(std::memory_order_relaxed); }
+
+		/* @brief : Stop the recording at runtime (the macros still cost the one branch)*/
+		void SetEnabled(const bool enabled) noexcept { _isEnabled.store(enabled, std::memory_order_relaxed); }
+
+	private:
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		Profiler();
+
+		~Profiler();
+
+		Profiler(const Profiler&) = delete;
+		Profiler& operator=(const Profiler&) = delete;
+
+		/****************************************************************************
+		**                Private Member Variables
+		*****************************************************************************/
+		struct Implement;
+
+		Implement* _implement = nullptr;
+
+		std::atomic<bool> _isEnabled = true;
+
+		std::atomic<uint64> _droppedEventCount = 0;
+
+		uint64 _frameCount = 0;
+
+		bool _isCapturing = false;
+	};
+
+	/****************************************************************************
+	*				  			   ProfileScope
+	*************************************************************************//**
+	*  @class     ProfileScope
+	*  @brief     Record the zone from the constructor to the destructor. (Use GU_PROFILE_SCOPE)
+	*****************************************************************************/
+	class ProfileScope
+	{
+	public:
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		explicit ProfileScope(const char* name) noexcept
+		{
+			if (!Profiler::Instance().IsEnabled()) { return; }
+
+			_name      = name;
+			_depth     = _currentDepth++;
+			_beginTick = Profiler::GetTimestamp();
+		}
+
+		~ProfileScope()
+		{
+			if (_name == nullptr) { return; }
+
+			const auto endTick = Profiler::GetTimestamp();
+			_currentDepth--;
+			Profiler::Instance().RecordZone(_name, _beginTick, endTick, _depth);
+		}
+
+		ProfileScope(const ProfileScope&) = delete;
+		ProfileScope& operator=(const ProfileScope&) = delete;
+
+	private:
+		/****************************************************************************
+		**                Private Member Variables
+		*****************************************************************************/
+		const char* _name      = nullptr;
+		uint64      _beginTick = 0;
+		uint32      _depth     = 0;
+
+		/* @brief : Nesting depth of the current thread*/
+		static inline thread_local uint32 _currentDepth = 0;
+	};
+}
+
+#endif
@@ -7,6 +7,7 @@
 ///                     WeakPointer   : ObserverƂĎgp. L͕ێ, \[X̔jsȂ
 ///                     UniquePointer : LĂȂ. 
 /// @@@@@@@@@@@@@@@@@@@@@@@ LڏȂ, B̏Lj^C~OŃ\[Xj
+///                     IntrusivePointer : QƃJEgIuWFNgg(ReferenceCountedObject). WeakPointer͎gȂ
 ///                     
 ///             @author Toide Yutaro
 ///             @date   2022_03_16
@@ -21,6 +22,7 @@
 #include "GameUtility/Base/Private/Memory/Include/GUSharedPointer.hpp"
 #include "GameUtility/Base/Private/Memory/Include/GUWeakPointer.hpp"
 #include "GameUtility/Base/Private/Memory/Include/GUUniquePointer.hpp"
+#include "GameUtility/Base/Private/Memory/Include/GUIntrusivePointer.hpp"
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
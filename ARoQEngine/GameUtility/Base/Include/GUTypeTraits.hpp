@@ -17,6 +17,12 @@
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
+/*---------------------------------------------------------------
+	g̃AhXێȂ(|C^̕tւňړł)NXmemmoveňړ\ɂ܂
+	O[oOԂŎgpĂ. ex) GU_DECLARE_TRIVIALLY_RELOCATABLE(gu::Name)
+-----------------------------------------------------------------*/
+#define GU_DECLARE_TRIVIALLY_RELOCATABLE(Type) \
+	template<> struct gu::details::type_traits::IsTriviallyRelocatableClass<Type> : gu::details::type_traits::TrueType {};
 
 //////////////////////////////////////////////////////////////////////////////////
 //                               Class
@@ -261,6 +267,13 @@ namespace gu::type
 	template<class T>
 	constexpr bool IS_SEALED = details::type_traits::IsSealedClass<T>::Value;
 
+	/*---------------------------------------------------------------
+				memmoveňړ([u + ړ̃fXgN^)pł邩
+				DynamicArraySmallArray̍Ċm, vf폜̋lߒŎgp܂
+	-----------------------------------------------------------------*/
+	template<class T>
+	constexpr bool IS_TRIVIALLY_RELOCATABLE = details::type_traits::IsTriviallyRelocatableClass<T>::Value;
+
 	/*---------------------------------------------------------------
 					fQ[gł邩
 	-----------------------------------------------------------------*/
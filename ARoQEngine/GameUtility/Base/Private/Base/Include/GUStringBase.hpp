@@ -1008,4 +1008,11 @@ namespace gu::details::string
 
 #pragma endregion Implement
 }
+
+// SSÕobt@gւ̃|C^Ȃ, memmoveňړł
+namespace gu::details::type_traits
+{
+	template<class Char, int CharByte>
+	struct IsTriviallyRelocatableClass<string::StringBase<Char, CharByte>> : TrueType {};
+}
 #endif
\ No newline at end of file
@@ -377,6 +377,14 @@ namespace gu::details::type_traits
 	template<class T>
 	struct IsSealedClass : BoolConstant<__is_sealed(T)>{};
 
+	/*---------------------------------------------------------------
+			̃rbgRs[(memmove)ŕʂ̃AhXֈړł邩
+			ł̓grAȃRs[RXgN^ƃfXgN^^trueł. 
+			g̃AhXێȂ^͓ꉻ邱ƂŖIɗLɂł܂.
+	-----------------------------------------------------------------*/
+	template<class T>
+	struct IsTriviallyRelocatableClass : BoolConstant<__has_trivial_copy(T) && __has_trivial_destructor(T)>{};
+
 #pragma endregion      CPP Class Type
 #pragma region Delegate
 	/*---------------------------------------------------------------
@@ -0,0 +1,261 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GUIntrusivePointer.hpp
+///             @brief  Intrusive reference counted pointer.
+///                     The reference count is the member of the object, so the pointer is 8 byte
+///                     and no reference controller is allocated.
+///                     Use it for the object which does not need the weak pointer (ex. RHI resources).
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GU_INTRUSIVE_POINTER_HPP
+#define GU_INTRUSIVE_POINTER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GUReferenceControllerBase.hpp"
+#include "GameUtility/Base/Include/GUTypeCast.hpp"
+#include "GameUtility/Base/Include/GUTypeTraits.hpp"
+#include <atomic>
+#include <type_traits>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gu
+{
+	/****************************************************************************
+	*				  			ReferenceCountedObject
+	*************************************************************************//**
+	*  @class     ReferenceCountedObject
+	*  @brief     Base class holding the reference count in the object itself.
+	*             The count starts from 0, and IntrusivePointer adds the first reference.
+	*             The object is deleted when the count reaches 0 (the destructor is virtual).
+	*             Mode : ThreadSafe uses std::atomic, NotThreadSafe uses the plain integer.
+	*****************************************************************************/
+	template<SharedPointerThreadMode Mode = SHARED_POINTER_DEFAULT_THREAD_MODE>
+	class ReferenceCountedObject
+	{
+	private:
+		using ReferenceCountType = std::conditional_t<Mode == SharedPointerThreadMode::ThreadSafe, std::atomic<uint32>, uint32>;
+
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/*----------------------------------------------------------------------
+		*  @brief : Increment the reference count and return the new count.
+		/*----------------------------------------------------------------------*/
+		__forceinline uint32 AddReference() const
+		{
+			if constexpr (Mode == SharedPointerThreadMode::ThreadSafe)
+			{
+				return _referenceCount.fetch_add(1, std::memory_order_relaxed) + 1;
+			}
+			else
+			{
+				return ++_referenceCount;
+			}
+		}
+
+		/*----------------------------------------------------------------------
+		*  @brief : Decrement the reference count and return the new count. The object is deleted at 0.
+		/*----------------------------------------------------------------------*/
+		__forceinline uint32 Release() const
+		{
+			uint32 count = 0;
+			if constexpr (Mode == SharedPointerThreadMode::ThreadSafe)
+			{
+				count = _referenceCount.fetch_sub(1, std::memory_order_acq_rel) - 1;
+			}
+			else
+			{
+				count = --_referenceCount;
+			}
+
+			if (count == 0) { delete this; }
+			return count;
+		}
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		__forceinline uint32 GetReferenceCount() const
+		{
+			if constexpr (Mode == SharedPointerThreadMode::ThreadSafe)
+			{
+				return _referenceCount.load(std::memory_order_relaxed);
+			}
+			else
+			{
+				return _referenceCount;
+			}
+		}
+
+	protected:
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		ReferenceCountedObject() = default;
+
+		virtual ~ReferenceCountedObject() = default;
+
+		// The reference count belongs to the object address, so it is not copied.
+		ReferenceCountedObject(const ReferenceCountedObject&) : ReferenceCountedObject() {};
+
+		ReferenceCountedObject& operator=(const ReferenceCountedObject&) { return *this; }
+
+	private:
+		/****************************************************************************
+		**                Private Member Variables
+		*****************************************************************************/
+		mutable ReferenceCountType _referenceCount = 0;
+	};
+
+	/****************************************************************************
+	*				  			   IntrusivePointer
+	*************************************************************************//**
+	*  @class     IntrusivePointer
+	*  @brief     Handle calling AddReference / Release of the element.
+	*             ElementType needs AddReference() and Release() (ex. ReferenceCountedObject).
+	*             The handle can be made from the raw pointer at any time (ex. this pointer)
+	*             because the count is in the object.
+	*****************************************************************************/
+	template<class ElementType>
+	class IntrusivePointer
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/*----------------------------------------------------------------------
+		*  @brief : Release the reference
+		/*----------------------------------------------------------------------*/
+		__forceinline void Reset()
+		{
+			if (_elementPointer) { _elementPointer->Release(); }
+			_elementPointer = nullptr;
+		}
+
+		/*----------------------------------------------------------------------
+		*  @brief : Return the raw pointer without releasing the reference. (The caller must call Release)
+		/*----------------------------------------------------------------------*/
+		[[nodiscard]] __forceinline ElementType* Detach() noexcept
+		{
+			ElementType* element = _elementPointer;
+			_elementPointer = nullptr;
+			return element;
+		}
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		[[nodiscard]] __forceinline ElementType* Get() const noexcept { return _elementPointer; }
+
+		[[nodiscard]] __forceinline bool IsValid() const noexcept { return _elementPointer != nullptr; }
+
+		__forceinline uint32 GetReferenceCount() const { return _elementPointer ? _elementPointer->GetReferenceCount() : 0; }
+
+		__forceinline operator bool() const noexcept { return _elementPointer != nullptr; }
+
+		[[nodiscard]] __forceinline ElementType* operator->() const noexcept { return _elementPointer; }
+
+		[[nodiscard]] __forceinline ElementType& operator* () const noexcept { return *_elementPointer; }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		IntrusivePointer() = default;
+
+		IntrusivePointer(decltype(nullptr)) {};
+
+		/*----------------------------------------------------------------------
+		*  Add the reference to the raw pointer
+		/*----------------------------------------------------------------------*/
+		IntrusivePointer(ElementType* pointer) : _elementPointer(pointer)
+		{
+			if (_elementPointer) { _elementPointer->AddReference(); }
+		}
+
+		IntrusivePointer(const IntrusivePointer& pointer) : IntrusivePointer(pointer._elementPointer) {};
+
+		template<class OtherType> requires std::is_convertible_v<OtherType*, ElementType*>
+		IntrusivePointer(const IntrusivePointer<OtherType>& pointer) : IntrusivePointer(pointer.Get()) {};
+
+		IntrusivePointer(IntrusivePointer&& pointer) noexcept : _elementPointer(pointer._elementPointer)
+		{
+			pointer._elementPointer = nullptr;
+		}
+
+		template<class OtherType> requires std::is_convertible_v<OtherType*, ElementType*>
+		IntrusivePointer(IntrusivePointer<OtherType>&& pointer) noexcept : _elementPointer(pointer.Detach()) {};
+
+		~IntrusivePointer() { Reset(); }
+
+		IntrusivePointer& operator=(ElementType* pointer)
+		{
+			// Add first because the current element may own the new element.
+			if (pointer) { pointer->AddReference(); }
+			if (_elementPointer) { _elementPointer->Release(); }
+			_elementPointer = pointer;
+			return *this;
+		}
+
+		IntrusivePointer& operator=(const IntrusivePointer& pointer) { return *this = pointer._elementPointer; }
+
+		template<class OtherType> requires std::is_convertible_v<OtherType*, ElementType*>
+		IntrusivePointer& operator=(const IntrusivePointer<OtherType>& pointer) { return *this = pointer.Get(); }
+
+		IntrusivePointer& operator=(IntrusivePointer&& pointer) noexcept
+		{
+			if (this == &pointer) { return *this; }
+
+			// Detach the right value first because the current element may own it.
+			ElementType* elementPointer = pointer._elementPointer;
+			pointer._elementPointer = nullptr;
+
+			Reset();
+			_elementPointer = elementPointer;
+			return *this;
+		}
+
+		__forceinline bool operator==(const IntrusivePointer& other) const noexcept { return _elementPointer == other._elementPointer; }
+		__forceinline bool operator!=(const IntrusivePointer& other) const noexcept { return _elementPointer != other._elementPointer; }
+
+	private:
+		/****************************************************************************
+		**                Private Member Variables
+		*****************************************************************************/
+		ElementType* _elementPointer = nullptr;
+	};
+
+#pragma region Intrusive Pointer Implement
+	/*----------------------------------------------------------------------
+	*  @brief :  return the new intrusive pointer (one heap allocation)
+	/*----------------------------------------------------------------------*/
+	template<class ElementType, class... Arguments>
+	[[nodiscard]] IntrusivePointer<ElementType> MakeIntrusive(Arguments&&... arguments)
+	{
+		return IntrusivePointer<ElementType>(new ElementType(type::Forward<Arguments>(arguments)...));
+	}
+
+	template<class Element1, class Element2>
+	[[nodiscard]] IntrusivePointer<Element1> StaticPointerCast(const IntrusivePointer<Element2>& element)
+	{
+		return IntrusivePointer<Element1>(static_cast<Element1*>(element.Get()));
+	}
+#pragma endregion Intrusive Pointer Implement
+}
+
+// The handle is only the element address, so it can be moved by memmove without touching the count.
+namespace gu::details::type_traits
+{
+	template<class ElementType>
+	struct IsTriviallyRelocatableClass<IntrusivePointer<ElementType>> : TrueType {};
+}
+#endif
@@ -100,19 +100,19 @@ namespace gu::details::smart_pointer
 		*  Constructs a new observer pointer using a changable resource pointer
 		/*----------------------------------------------------------------------*/
 		template<class OtherType>
-		explicit ObserverPointerBase(OtherType* elementPointer) : _elementPointer(elementPointer), _referenceController(new ReferenceController<ElementType, DefaultDeleter<ElementType>>(elementPointer)) {};
+		explicit ObserverPointerBase(OtherType* elementPointer) : _elementPointer(elementPointer), _referenceController(new ReferenceController<OtherType, DefaultDeleter<OtherType>, Mode>(elementPointer)) {};
 
 		/*----------------------------------------------------------------------
 		*  Constructs a new observer pointer using a resource pointer and customize deleter
 		/*----------------------------------------------------------------------*/
 		template<class Deleter>
-		ObserverPointerBase(ElementType* elementPointer, Deleter deleter) : _elementPointer(elementPointer), _referenceController(new ReferenceController<ElementType, DefaultDeleter<ElementType>>(elementPointer)) {};
+		ObserverPointerBase(ElementType* elementPointer, Deleter deleter) : _elementPointer(elementPointer), _referenceController(new ReferenceController<ElementType, Deleter, Mode>(elementPointer, type::Forward<Deleter>(deleter))) {};
 
 		/*----------------------------------------------------------------------
 		*  Constructs a new observer pointer using a changable resource pointer and customize deleter
 		/*----------------------------------------------------------------------*/
 		template<class OtherType, class Deleter>
-		ObserverPointerBase(OtherType* elementPointer, Deleter deleter) : _elementPointer(elementPointer), _referenceController(new ReferenceController<ElementType, Deleter>(elementPointer)) {};
+		ObserverPointerBase(OtherType* elementPointer, Deleter deleter) : _elementPointer(elementPointer), _referenceController(new ReferenceController<OtherType, Deleter, Mode>(elementPointer, type::Forward<Deleter>(deleter))) {};
 
 		/*----------------------------------------------------------------------
 		*  Copy constructs
@@ -162,31 +162,20 @@ namespace gu::details::smart_pointer
 		__forceinline void AddObserverReference() { if (_referenceController) { _referenceController->AddObserverReference(); } }
 
 		/*----------------------------------------------------------------------
-		*  @brief : Decrement the shared reference count.
+		*  @brief : Decrement the shared reference count. 
+		*           The controller destroys the element (and itself if no weak pointer remains).
 		/*----------------------------------------------------------------------*/
 		__forceinline void ReleaseSharedReference() 
 		{
-			if (_referenceController) 
-			{ 
-				_referenceController->ReleaseSharedReference(); 
-				ReleaseObserverReference();
-			}
+			if (_referenceController) { _referenceController->ReleaseSharedReference(); }
 		}
 
 		/*----------------------------------------------------------------------
-		*  @brief : Decrement the weak + shared reference count.
+		*  @brief : Decrement the weak reference count.
 		/*----------------------------------------------------------------------*/
 		__forceinline void ReleaseObserverReference() 
 		{
-			if (_referenceController == nullptr) { return; }
-			
-			_referenceController->ReleaseObserverReference(); 
-
-			if (_referenceController->GetSharedReferenceCount() == 0)
-			{
-				delete _referenceController;
-				_referenceController = nullptr;
-			}
+			if (_referenceController) { _referenceController->ReleaseObserverReference(); }
 		}
 		/****************************************************************************
 		**                Protected Member Variables
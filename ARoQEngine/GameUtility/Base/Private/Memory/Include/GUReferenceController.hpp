@@ -12,6 +12,8 @@
 //////////////////////////////////////////////////////////////////////////////////
 #include "GUReferenceControllerBase.hpp"
 #include "GUSharedDeleter.hpp"
+#include "GameUtility/Base/Include/GUTypeCast.hpp"
+#include <new>
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
@@ -22,6 +24,11 @@
 
 namespace gu::details::smart_pointer
 {
+	/*----------------------------------------------------------------------
+	*  @brief : The pointer takes over the reference which the controller already has.
+	/*----------------------------------------------------------------------*/
+	struct AdoptReferenceTag {};
+
 	/****************************************************************************
 	*				  			 ReferenceController
 	*************************************************************************//**
@@ -73,5 +80,53 @@ namespace gu::details::smart_pointer
 		ElementType* _element = nullptr;
 		Deleter _deleter;
 	};
+
+	/****************************************************************************
+	*				  		InlineReferenceController
+	*************************************************************************//**
+	*  @class     InlineReferenceController
+	*  @brief     MakeSharedp. QƃJEgƗvf̃mۂŔzu܂. 
+	*             [vtable | shared count | observer count | element]
+	*             vfDisposeŃfXgN^̂݌Ăяo, DeleteThisł܂Ƃ߂ĉ܂.
+	*****************************************************************************/
+	template<class ElementType, SharedPointerThreadMode Mode = SHARED_POINTER_DEFAULT_THREAD_MODE>
+	class InlineReferenceController : public ReferenceControllerBase<Mode>
+	{
+	public:
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		__forceinline ElementType* GetElement() noexcept { return std::launder(reinterpret_cast<ElementType*>(_storage)); }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		template<class... Arguments>
+		explicit InlineReferenceController(Arguments&&... arguments)
+		{
+			new (static_cast<void*>(_storage)) ElementType(type::Forward<Arguments>(arguments)...);
+		}
+
+		~InlineReferenceController() = default;
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+		__forceinline void Dispose() override
+		{
+			GetElement()->~ElementType();
+		}
+
+		__forceinline void DeleteThis() override
+		{
+			delete this;
+		}
+
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		alignas(ElementType) uint8 _storage[sizeof(ElementType)];
+	};
 }
 #endif
\ No newline at end of file
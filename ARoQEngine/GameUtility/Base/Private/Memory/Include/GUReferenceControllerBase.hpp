@@ -25,7 +25,17 @@ namespace gu
 	};
 }
 
+/*----------------------------------------------------------------------
+*  ThreadSafe    : the reference count is std::atomic. The pointer can be copied and destroyed on any thread.
+*  NotThreadSafe : the reference count is the plain integer (no lock prefix instruction).
+*                  Use it for the pointer which is created, copied and destroyed on only one thread.
+*                  ex) gu::SharedPointer<T, gu::SharedPointerThreadMode::NotThreadSafe> p = gu::MakeShared<T, gu::SharedPointerThreadMode::NotThreadSafe>();
+*                  The pointer of the different mode is the different type, so they can not be converted to each other.
+*  The default mode can be overridden by defining SHARED_POINTER_DEFAULT_THREAD_MODE before including this header.
+/*----------------------------------------------------------------------*/
+#ifndef SHARED_POINTER_DEFAULT_THREAD_MODE
 #define SHARED_POINTER_DEFAULT_THREAD_MODE (SharedPointerThreadMode::ThreadSafe)
+#endif
 //////////////////////////////////////////////////////////////////////////////////
 //                               Class
 //////////////////////////////////////////////////////////////////////////////////
@@ -37,6 +47,8 @@ namespace gu::details::smart_pointer
 	*************************************************************************//**
 	*  @class     ReferenceControllerBase
 	*  @brief     QƃJEgێ邽߂̊NX
+	*             Shared count   : SharedPointer̐. 0ɂȂDispose (Element̔j)
+	*             Observer count : WeakPointer̐ + (Shared count1ȏȂ1). 0ɂȂDeleteThis (Controller̔j)
 	*****************************************************************************/
 	template<SharedPointerThreadMode Mode = SHARED_POINTER_DEFAULT_THREAD_MODE>
 	class ReferenceControllerBase
@@ -54,17 +66,22 @@ namespace gu::details::smart_pointer
 		__forceinline void AddSharedReference();
 
 		/*----------------------------------------------------------------------
-		*  @brief : Increment the weak + shared reference count.
+		*  @brief : Increment the shared reference count only if the element is still alive. (WeakPointer -> SharedPointer)
+		/*----------------------------------------------------------------------*/
+		__forceinline bool ConditionallyAddSharedReference();
+
+		/*----------------------------------------------------------------------
+		*  @brief : Increment the weak reference count.
 		/*----------------------------------------------------------------------*/
 		__forceinline void AddObserverReference();
 
 		/*----------------------------------------------------------------------
-		*  @brief : Decrement the shared reference count.
+		*  @brief : Decrement the shared reference count. The element is destroyed when the count reaches 0.
 		/*----------------------------------------------------------------------*/
 		__forceinline void ReleaseSharedReference();
 
 		/*----------------------------------------------------------------------
-		*  @brief : Decrement the weak + shared reference count.
+		*  @brief : Decrement the weak reference count. The controller is destroyed when the count reaches 0.
 		/*----------------------------------------------------------------------*/
 		__forceinline void ReleaseObserverReference();
 
@@ -87,7 +104,7 @@ namespace gu::details::smart_pointer
 		}
 
 		/*----------------------------------------------------------------------
-		*  @brief : Return the total of observer reference count in the shared and weak pointer.
+		*  @brief : Return the weak reference count (+1 while the shared pointer exists).
 		/*----------------------------------------------------------------------*/
 		__forceinline int32 GetObserverReferenceCount() const 
 		{
@@ -109,7 +126,7 @@ namespace gu::details::smart_pointer
 		/*----------------------------------------------------------------------
 		*  @brief : Return the Reference count is under 0;
 		/*----------------------------------------------------------------------*/
-		__forceinline bool EnableDelete() const { return _sharedReferenceCount <= 0; }
+		__forceinline bool EnableDelete() const { return GetSharedReferenceCount() <= 0; }
 
 		/****************************************************************************
 		**                Constructor and Destructor
@@ -139,8 +156,8 @@ namespace gu::details::smart_pointer
 		**                Protected Member Variables
 		*****************************************************************************/
 		// ThreadsafeȂAtomic<int32>, ȊOint32
-		ReferenceCountType _sharedReferenceCount   = 1;    // shared pointer count
-		ReferenceCountType _observerReferenceCount = 1; // weak + shared pointer count
+		ReferenceCountType _sharedReferenceCount   = 1; // shared pointer count
+		ReferenceCountType _observerReferenceCount = 1; // weak pointer count + 1 (all shared pointers)
 	};
 
 	/*----------------------------------------------------------------------
@@ -159,6 +176,30 @@ namespace gu::details::smart_pointer
 		}
 	}
 
+	/*----------------------------------------------------------------------
+	*  @brief : vfjĂȂΎQƃJEg𑝂₷
+	/*----------------------------------------------------------------------*/
+	template<SharedPointerThreadMode Mode>
+	__forceinline bool ReferenceControllerBase<Mode>::ConditionallyAddSharedReference()
+	{
+		if constexpr (Mode == SharedPointerThreadMode::ThreadSafe)
+		{
+			int32 count = _sharedReferenceCount.load(std::memory_order_relaxed);
+			do
+			{
+				if (count == 0) { return false; }
+			} 
+			while (!_sharedReferenceCount.compare_exchange_weak(count, count + 1, std::memory_order_relaxed));
+			return true;
+		}
+		else
+		{
+			if (_sharedReferenceCount == 0) { return false; }
+			++_sharedReferenceCount;
+			return true;
+		}
+	}
+
 	/*----------------------------------------------------------------------
 	*  @brief : QƃJEg𑝂₷
 	/*----------------------------------------------------------------------*/
@@ -176,26 +217,25 @@ namespace gu::details::smart_pointer
 	}
 
 	/*----------------------------------------------------------------------
-	*  @brief : QƃJEg炷
+	*  @brief : QƃJEg炷. 
+	*           Z0͈̔̃Ag~bNōs (ʃXbhƓ0ϑȂ)
 	/*----------------------------------------------------------------------*/
 	template<SharedPointerThreadMode Mode>
 	void ReferenceControllerBase<Mode>::ReleaseSharedReference()
 	{
-		if (_sharedReferenceCount <= 0) { return; }
-
 		if constexpr (Mode == SharedPointerThreadMode::ThreadSafe)
 		{
-			_sharedReferenceCount.fetch_sub(1, std::memory_order_acq_rel);
+			if (_sharedReferenceCount.fetch_sub(1, std::memory_order_acq_rel) != 1) { return; }
 		}
 		else
 		{
-			--_sharedReferenceCount;
+			if (--_sharedReferenceCount != 0) { return; }
 		}
 
-		if (_sharedReferenceCount == 0)
-		{
-			Dispose();
-		}
+		Dispose();
+
+		// SĂSharedPointerŕێĂobserverQƂ
+		ReleaseObserverReference();
 	}
 
 	/*----------------------------------------------------------------------
@@ -204,16 +244,16 @@ namespace gu::details::smart_pointer
 	template<SharedPointerThreadMode Mode>
 	void ReferenceControllerBase<Mode>::ReleaseObserverReference()
 	{
-		if (_observerReferenceCount <= 0) { return; }
-
 		if constexpr (Mode == SharedPointerThreadMode::ThreadSafe)
 		{
-			_observerReferenceCount.fetch_sub(1, std::memory_order_acq_rel);
+			if (_observerReferenceCount.fetch_sub(1, std::memory_order_acq_rel) != 1) { return; }
 		}
 		else
 		{
-			--_observerReferenceCount;
+			if (--_observerReferenceCount != 0) { return; }
 		}
+
+		DeleteThis();
 	}
 
 	/*----------------------------------------------------------------------
@@ -224,7 +264,7 @@ namespace gu::details::smart_pointer
 	{
 		if constexpr (Mode == SharedPointerThreadMode::ThreadSafe)
 		{
-			return _sharedReferenceCount.load(std::memory_order_acquire);
+			return _sharedReferenceCount.load(std::memory_order_acquire) == 1;
 		}
 		else
 		{
@@ -29,6 +29,8 @@ namespace gu
 	*************************************************************************//**
 	*  @class     GUSharedPointer
 	*  @brief     if the reference count is 0, the resource ownered by this will destroy.
+	*             Use MakeShared to allocate the element and the reference count in one memory block.
+	*             Mode : see SHARED_POINTER_DEFAULT_THREAD_MODE (NotThreadSafe removes the atomic operations)
 	*****************************************************************************/
 	template<class ElementType,  SharedPointerThreadMode Mode = SHARED_POINTER_DEFAULT_THREAD_MODE>
 	class SharedPointer : public details::smart_pointer::ObserverPointerBase<ElementType, Mode>
@@ -100,8 +102,12 @@ namespace gu
 		/*----------------------------------------------------------------------*/
 		explicit SharedPointer(const WeakPointer<ElementType,Mode>& pointer) : details::smart_pointer::ObserverPointerBase<ElementType, Mode>(pointer)
 		{
-			AddSharedReference();
-			AddObserverReference();
+			// the element has already been destroyed.
+			if (_referenceController && !_referenceController->ConditionallyAddSharedReference())
+			{
+				_referenceController = nullptr;
+				_elementPointer      = nullptr;
+			}
 		}
 
 		/*----------------------------------------------------------------------
@@ -111,7 +117,6 @@ namespace gu
 			: details::smart_pointer::ObserverPointerBase<ElementType, Mode>(pointer)
 		{
 			AddSharedReference();
-			AddObserverReference();
 		}
 
 		/*----------------------------------------------------------------------
@@ -122,7 +127,6 @@ namespace gu
 			: details::smart_pointer::ObserverPointerBase<ElementType, Mode>(pointer)
 		{
 			AddSharedReference();
-			AddObserverReference();
 		}
 
 		/*----------------------------------------------------------------------
@@ -131,19 +135,13 @@ namespace gu
 		template<class OtherType>
 		SharedPointer& operator=(const SharedPointer<OtherType, Mode>& right) noexcept 
 		{
-			_elementPointer      = right._elementPointer;
-			_referenceController = right._referenceController;
-			AddSharedReference();
-			AddObserverReference();
+			Assign(right._elementPointer, right._referenceController);
 			return *this;
 		}
 
 		SharedPointer& operator=(const SharedPointer& right) noexcept
 		{
-			_elementPointer      = right._elementPointer;
-			_referenceController = right._referenceController;
-			AddSharedReference();
-			AddObserverReference();
+			Assign(right._elementPointer, right._referenceController);
 			return *this;
 		}
 
@@ -158,8 +156,15 @@ namespace gu
 
 		SharedPointer& operator=(SharedPointer&& right) noexcept
 		{
-			_elementPointer = right._elementPointer; _referenceController = right._referenceController;
+			if (this == &right) { return *this; }
+
+			// Detach the right value first because the current object may own it.
+			ElementType* elementPointer = right._elementPointer;
+			details::smart_pointer::ReferenceControllerBase<Mode>* referenceController = right._referenceController;
 			right._elementPointer = nullptr; right._referenceController = nullptr;
+
+			ReleaseSharedReference();
+			_elementPointer = elementPointer; _referenceController = referenceController;
 			return *this;
 		}
 
@@ -170,13 +175,33 @@ namespace gu
 			: details::smart_pointer::ObserverPointerBase<ElementType, Mode>(pointer, referenceController)
 		{
 			AddSharedReference();
-			AddObserverReference();
 		};
 
+		/*----------------------------------------------------------------------
+		*  for MakeShared. The reference already owned by the controller is adopted. (no increment)
+		/*----------------------------------------------------------------------*/
+		SharedPointer(ElementType* pointer, details::smart_pointer::ReferenceControllerBase<Mode>* referenceController, details::smart_pointer::AdoptReferenceTag)
+			: details::smart_pointer::ObserverPointerBase<ElementType, Mode>(pointer, referenceController) {};
+
 	private:
 		/****************************************************************************
 		**                Private Function
 		*****************************************************************************/
+		/*----------------------------------------------------------------------
+		*  @brief : Add the reference of the right value first, and then release the current reference.
+		*           (the current object may own the right value)
+		/*----------------------------------------------------------------------*/
+		__forceinline void Assign(ElementType* elementPointer, details::smart_pointer::ReferenceControllerBase<Mode>* referenceController)
+		{
+			if (_referenceController != referenceController)
+			{
+				if (referenceController) { referenceController->AddSharedReference(); }
+				ReleaseSharedReference();
+				_referenceController = referenceController;
+			}
+			_elementPointer = elementPointer;
+		}
+
 		template<class OtherType, SharedPointerThreadMode OtherMode>
 		friend class WeakPointer;
 		template<class OtherType, SharedPointerThreadMode OtherMode>
@@ -258,7 +283,7 @@ namespace gu
 	template<class Element1, class Element2, SharedPointerThreadMode Mode = SHARED_POINTER_DEFAULT_THREAD_MODE>
 	[[nodiscard]] SharedPointer<Element1, Mode> StaticPointerCast(const SharedPointer<Element2, Mode>& element)
 	{
-		return SharedPointer<Element1, SHARED_POINTER_DEFAULT_THREAD_MODE>(static_cast<Element1*>(element.Get()), element.GetRawReferenceController());
+		return SharedPointer<Element1, Mode>(static_cast<Element1*>(element.Get()), element.GetRawReferenceController());
 	}
 	template<class Element1, class Element2, SharedPointerThreadMode Mode = SHARED_POINTER_DEFAULT_THREAD_MODE>
 	[[nodiscard]] SharedPointer<Element1, Mode> ConstPointerCast(const SharedPointer<Element2, Mode>& element)
@@ -278,11 +303,15 @@ namespace gu
 
 	/*----------------------------------------------------------------------
 	*  @brief :  return the new shared pointer
+	*            The element and the reference count are allocated in one memory block 
+	*            (one heap allocation, and the count is placed next to the element).
+	*            The memory is released when the last weak pointer is released.
 	/*----------------------------------------------------------------------*/
 	template<class ElementType, SharedPointerThreadMode Mode = SHARED_POINTER_DEFAULT_THREAD_MODE, class... Arguments>
 	SharedPointer<ElementType, Mode> MakeShared(Arguments&&... arguments)
 	{
-		SharedPointer<ElementType, Mode> pointer(new ElementType(type::Forward<Arguments>(arguments)...));
+		const auto controller = new details::smart_pointer::InlineReferenceController<ElementType, Mode>(type::Forward<Arguments>(arguments)...);
+		SharedPointer<ElementType, Mode> pointer(controller->GetElement(), controller, details::smart_pointer::AdoptReferenceTag());
 		
 		// EnableSharedFromThisT|[gꍇ, weak_pointerݒ肷
 		if constexpr(gu::type::IS_DERIVED_OF<ElementType, gu::EnableSharedFromThis<ElementType, Mode>>)
@@ -298,4 +327,14 @@ namespace gu
 
 }
 
+// |C^ƎQƃRg[̃AhX݂̂, QƃJEgςmemmoveňړł
+namespace gu::details::type_traits
+{
+	template<class ElementType, SharedPointerThreadMode Mode>
+	struct IsTriviallyRelocatableClass<SharedPointer<ElementType, Mode>> : TrueType {};
+
+	template<class ElementType, SharedPointerThreadMode Mode>
+	struct IsTriviallyRelocatableClass<WeakPointer<ElementType, Mode>> : TrueType {};
+}
+
 #endif
\ No newline at end of file
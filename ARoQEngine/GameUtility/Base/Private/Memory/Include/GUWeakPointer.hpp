@@ -41,7 +41,22 @@ namespace gu
 		/*----------------------------------------------------------------------
 		*  @brief : Release the observer pointer
 		/*----------------------------------------------------------------------*/
-		__forceinline void Reset() { ReleaseObserverReference(); }
+		__forceinline void Reset() 
+		{
+			ReleaseObserverReference(); 
+			_referenceController = nullptr;
+			_elementPointer      = nullptr;
+		}
+
+		/*----------------------------------------------------------------------
+		*  @brief : Return the shared pointer if the element is still alive, otherwise nullptr.
+		/*----------------------------------------------------------------------*/
+		[[nodiscard]] SharedPointer<ElementType, Mode> Lock() const { return SharedPointer<ElementType, Mode>(*this); }
+
+		/*----------------------------------------------------------------------
+		*  @brief : The element has been destroyed
+		/*----------------------------------------------------------------------*/
+		[[nodiscard]] __forceinline bool IsExpired() const { return _referenceController == nullptr || _referenceController->GetSharedReferenceCount() == 0; }
 
 
 		/****************************************************************************
@@ -86,30 +101,40 @@ namespace gu
 		*  Copy constructs have the other pointer type
 		/*----------------------------------------------------------------------*/
 		template<class OtherType>
-		WeakPointer(const WeakPointer<OtherType>& pointer)
+		WeakPointer(const WeakPointer<OtherType, Mode>& pointer)
 			: ObserverPointerBase<ElementType, Mode>(pointer) { AddObserverReference(); }
 
 		template<class OtherType>
-		WeakPointer& operator = (const WeakPointer<OtherType>& pointer)
+		WeakPointer& operator = (const WeakPointer<OtherType, Mode>& pointer)
 		{
-			_elementPointer      = pointer._elementPointer;
-			_referenceController = pointer._referenceController;
-			AddObserverReference();
+			Assign(pointer._elementPointer, pointer._referenceController);
 			return *this;
 		}
 
 		/*----------------------------------------------------------------------
 		*  Move constructs have the same weak pointer type
 		/*----------------------------------------------------------------------*/
-		WeakPointer(WeakPointer&& pointer) 
-			: details::smart_pointer::ObserverPointerBase<ElementType, Mode>(pointer) {  }
+		WeakPointer(WeakPointer&& pointer) noexcept
+			: details::smart_pointer::ObserverPointerBase<ElementType, Mode>(type::Forward<WeakPointer>(pointer)) {  }
+
+		WeakPointer& operator = (WeakPointer&& pointer) noexcept
+		{
+			if (this == &pointer) { return *this; }
+
+			ReleaseObserverReference();
+			_elementPointer      = pointer._elementPointer;
+			_referenceController = pointer._referenceController;
+			pointer._elementPointer      = nullptr;
+			pointer._referenceController = nullptr;
+			return *this;
+		}
 
 		/*----------------------------------------------------------------------
 		*  Move constructs have the other weak pointer type
 		/*----------------------------------------------------------------------*/
 		template<class OtherType>
-		WeakPointer(WeakPointer<OtherType>&& pointer) 
-			: details::smart_pointer::ObserverPointerBase<ElementType, Mode>(pointer){}
+		WeakPointer(WeakPointer<OtherType, Mode>&& pointer) noexcept
+			: details::smart_pointer::ObserverPointerBase<ElementType, Mode>(type::Forward<WeakPointer<OtherType, Mode>>(pointer)){}
 
 		~WeakPointer(){ ReleaseObserverReference(); }
 
@@ -117,6 +142,22 @@ namespace gu
 		/****************************************************************************
 		**                Private Function
 		*****************************************************************************/
+		/*----------------------------------------------------------------------
+		*  @brief : Add the new reference first, and then release the current reference.
+		/*----------------------------------------------------------------------*/
+		__forceinline void Assign(ElementType* elementPointer, details::smart_pointer::ReferenceControllerBase<Mode>* referenceController)
+		{
+			if (_referenceController != referenceController)
+			{
+				if (referenceController) { referenceController->AddObserverReference(); }
+				ReleaseObserverReference();
+				_referenceController = referenceController;
+			}
+			_elementPointer = elementPointer;
+		}
+
+		template<class OtherType, SharedPointerThreadMode OtherMode>
+		friend class WeakPointer;
 
 		/****************************************************************************
 		**                Private Member Variables
@@ -127,11 +168,7 @@ namespace gu
 	template<class ElementType, SharedPointerThreadMode Mode>
 	WeakPointer<ElementType, Mode>& WeakPointer<ElementType, Mode>::operator=(const WeakPointer<ElementType, Mode>& pointer)
 	{
-		if (*this == pointer) { return *this; }
-
-		_elementPointer      = pointer._elementPointer;
-		_referenceController = pointer._referenceController;
-		AddObserverReference();
+		Assign(pointer._elementPointer, pointer._referenceController);
 		return *this;
 	}
 
@@ -0,0 +1,340 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GUName.cpp
+///             @brief  Global name table
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/GUName.hpp"
+#include "../Include/GUAssert.hpp"
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <cstring>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace gu;
+
+namespace
+{
+	/*-------------------------------------------------------------------
+	-             Registered string
+	---------------------------------------------------------------------*/
+	struct NameEntry
+	{
+		const tchar* String = nullptr;
+		uint64       Hash   = 0;
+		uint32       Length = 0;
+		uint32       CaseInsensitiveIndex = 0;
+	};
+
+	/*-------------------------------------------------------------------
+	-   Open addressing hash index. (upper 32 bit : hash, lower 32 bit : entry index + 1)
+	---------------------------------------------------------------------*/
+	struct NameSlotArray
+	{
+		uint64 Mask = 0;
+		std::unique_ptr<std::atomic<uint64>[]> Slots = nullptr;
+	};
+
+	constexpr uint32 INVALID_INDEX          = 0xFFFFFFFF;
+	constexpr uint32 ENTRY_BLOCK_SHIFT      = 12;
+	constexpr uint32 ENTRY_BLOCK_SIZE       = 1 << ENTRY_BLOCK_SHIFT;
+	constexpr uint32 MAX_ENTRY_BLOCK_COUNT  = 1024;  // 4M names
+	constexpr uint64 STRING_PAGE_CHAR_COUNT = 16384;
+	constexpr uint64 INITIAL_SLOT_COUNT     = 1024;
+
+	/****************************************************************************
+	*				  			   NameTable
+	*************************************************************************//**
+	*  @class     NameTable
+	*  @brief     The entries and the strings are never moved or released,
+	*             so the reader only needs the acquire load of the slot and the entry block.
+	*             The writer is serialized by the mutex. The old slot arrays are kept after the rehash
+	*             because the lock free reader may still be probing them.
+	*****************************************************************************/
+	class NameTable
+	{
+	public:
+		/*-------------------------------------------------------------------
+		-  The table is never destroyed so the static Name objects can be used in the destructors.
+		---------------------------------------------------------------------*/
+		static NameTable& Get()
+		{
+			static NameTable* table = new NameTable();
+			return *table;
+		}
+
+		/*-------------------------------------------------------------------
+		-  64 bit FNV-1a
+		---------------------------------------------------------------------*/
+		static uint64 ComputeHash(const tchar* string, const uint64 length)
+		{
+			uint64 hash = 14695981039346656037ULL;
+			for (uint64 i = 0; i < length; ++i)
+			{
+				hash ^= static_cast<uint64>(string[i]);
+				hash *= 1099511628211ULL;
+			}
+			return hash;
+		}
+
+		__forceinline const NameEntry& GetEntry(const uint32 index) const
+		{
+			return _entryBlocks[index >> ENTRY_BLOCK_SHIFT].load(std::memory_order_acquire)[index & (ENTRY_BLOCK_SIZE - 1)];
+		}
+
+		uint32 Find(const tchar* string, const uint64 length, const uint64 hash) const
+		{
+			if (length == 0) { return 0; }
+
+			const NameSlotArray* slotArray = _currentSlots.load(std::memory_order_acquire);
+			const uint64         hashTag   = hash >> 32;
+
+			for (uint64 i = hash & slotArray->Mask;; i = (i + 1) & slotArray->Mask)
+			{
+				const uint64 slot = slotArray->Slots[i].load(std::memory_order_acquire);
+				if (slot == 0) { return INVALID_INDEX; }
+				if ((slot >> 32) != hashTag) { continue; }
+
+				const uint32     index = static_cast<uint32>(slot & 0xFFFFFFFF) - 1;
+				const NameEntry& entry = GetEntry(index);
+				if (entry.Length == length && std::memcmp(entry.String, string, sizeof(tchar) * length) == 0)
+				{
+					return index;
+				}
+			}
+		}
+
+		uint32 FindOrAdd(const tchar* string, const uint64 length)
+		{
+			if (length == 0) { return 0; }
+
+			const uint64 hash  = ComputeHash(string, length);
+			const uint32 index = Find(string, length, hash);
+			if (index != INVALID_INDEX) { return index; }
+
+			std::scoped_lock lock(_mutex);
+			return AddLocked(string, length, hash);
+		}
+
+		uint32 GetEntryCount() const { return _entryCount.load(std::memory_order_acquire); }
+
+		uint64 GetStringByteSize() const { return _stringByteSize.load(std::memory_order_relaxed); }
+
+	private:
+		NameTable()
+		{
+			static const tchar emptyString[1] = { 0 };
+
+			_entryBlocks[0].store(new NameEntry[ENTRY_BLOCK_SIZE], std::memory_order_release);
+			NameEntry* none = _entryBlocks[0].load(std::memory_order_relaxed);
+			none->String = emptyString;
+			none->Hash   = ComputeHash(emptyString, 0);
+			_entryCount.store(1, std::memory_order_release);
+
+			Rehash(INITIAL_SLOT_COUNT);
+		}
+
+		uint32 AddLocked(const tchar* string, const uint64 length, const uint64 hash)
+		{
+			// another thread may have registered the string while waiting the lock
+			const uint32 foundIndex = Find(string, length, hash);
+			if (foundIndex != INVALID_INDEX) { return foundIndex; }
+
+			Confirmf(length < INVALID_INDEX, "Name is too long.");
+
+			/*-------------------------------------------------------------------
+			-           Register the lower case string first
+			---------------------------------------------------------------------*/
+			uint32 caseInsensitiveIndex = INVALID_INDEX;
+			for (uint64 i = 0; i < length; ++i)
+			{
+				if (details::string::StringUtility::ToLower<tchar>(string[i]) == string[i]) { continue; }
+
+				std::vector<tchar> lower(string, string + length);
+				for (auto& ch : lower) { ch = details::string::StringUtility::ToLower<tchar>(ch); }
+				caseInsensitiveIndex = AddLocked(lower.data(), length, ComputeHash(lower.data(), length));
+				break;
+			}
+
+			/*-------------------------------------------------------------------
+			-           Create entry
+			---------------------------------------------------------------------*/
+			const uint32 index = _entryCount.load(std::memory_order_relaxed);
+			Confirmf((index >> ENTRY_BLOCK_SHIFT) < MAX_ENTRY_BLOCK_COUNT, "Name table is full.");
+
+			if ((index & (ENTRY_BLOCK_SIZE - 1)) == 0)
+			{
+				_entryBlocks[index >> ENTRY_BLOCK_SHIFT].store(new NameEntry[ENTRY_BLOCK_SIZE], std::memory_order_release);
+			}
+
+			NameEntry& entry = _entryBlocks[index >> ENTRY_BLOCK_SHIFT].load(std::memory_order_relaxed)[index & (ENTRY_BLOCK_SIZE - 1)];
+			entry.String = AllocateString(string, length);
+			entry.Hash   = hash;
+			entry.Length = static_cast<uint32>(length);
+			entry.CaseInsensitiveIndex = caseInsensitiveIndex == INVALID_INDEX ? index : caseInsensitiveIndex;
+			_entryCount.store(index + 1, std::memory_order_release);
+
+			/*-------------------------------------------------------------------
+			-           Publish to the hash index (load factor <= 0.5)
+			---------------------------------------------------------------------*/
+			NameSlotArray* slotArray = _currentSlots.load(std::memory_order_relaxed);
+			if (static_cast<uint64>(index + 1) * 2 > slotArray->Mask + 1)
+			{
+				Rehash((slotArray->Mask + 1) * 2);
+			}
+			else
+			{
+				InsertSlot(*slotArray, index, hash, std::memory_order_release);
+			}
+			return index;
+		}
+
+		void Rehash(const uint64 slotCount)
+		{
+			auto slotArray = std::make_unique<NameSlotArray>();
+			slotArray->Mask  = slotCount - 1;
+			slotArray->Slots = std::unique_ptr<std::atomic<uint64>[]>(new std::atomic<uint64>[slotCount]);
+			for (uint64 i = 0; i < slotCount; ++i) { slotArray->Slots[i].store(0, std::memory_order_relaxed); }
+
+			const uint32 entryCount = _entryCount.load(std::memory_order_relaxed);
+			for (uint32 index = 1; index < entryCount; ++index)
+			{
+				InsertSlot(*slotArray, index, GetEntry(index).Hash, std::memory_order_relaxed);
+			}
+
+			_currentSlots.store(slotArray.get(), std::memory_order_release);
+			_slotArrays.push_back(std::move(slotArray));
+		}
+
+		static void InsertSlot(NameSlotArray& slotArray, const uint32 index, const uint64 hash, const std::memory_order order)
+		{
+			uint64 i = hash & slotArray.Mask;
+			while (slotArray.Slots[i].load(std::memory_order_relaxed) != 0) { i = (i + 1) & slotArray.Mask; }
+			slotArray.Slots[i].store(((hash >> 32) << 32) | (static_cast<uint64>(index) + 1), order);
+		}
+
+		const tchar* AllocateString(const tchar* string, const uint64 length)
+		{
+			const uint64 charCount = length + 1;
+			if (charCount > _pageRemainCount)
+			{
+				const uint64 pageCharCount = charCount > STRING_PAGE_CHAR_COUNT ? charCount : STRING_PAGE_CHAR_COUNT;
+				_stringPages.push_back(std::unique_ptr<tchar[]>(new tchar[pageCharCount]));
+				_pageCurrent    = _stringPages.back().get();
+				_pageRemainCount = pageCharCount;
+				_stringByteSize.fetch_add(sizeof(tchar) * pageCharCount, std::memory_order_relaxed);
+			}
+
+			tchar* result = _pageCurrent;
+			std::memcpy(result, string, sizeof(tchar) * length);
+			result[length] = 0;
+
+			_pageCurrent     += charCount;
+			_pageRemainCount -= charCount;
+			return result;
+		}
+
+		std::atomic<NameEntry*> _entryBlocks[MAX_ENTRY_BLOCK_COUNT] = {};
+
+		std::atomic<uint32> _entryCount = 0;
+
+		std::atomic<NameSlotArray*> _currentSlots = nullptr;
+
+		std::vector<std::unique_ptr<NameSlotArray>> _slotArrays = {};
+
+		std::vector<std::unique_ptr<tchar[]>> _stringPages = {};
+
+		tchar* _pageCurrent     = nullptr;
+		uint64 _pageRemainCount = 0;
+
+		std::atomic<uint64> _stringByteSize = 0;
+
+		std::mutex _mutex = {};
+	};
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+Name::Name(const tchar* string) : Name(string, string ? details::string::StringUtility::Length(string) : 0)
+{
+
+}
+
+Name::Name(const tchar* string, const uint64 length)
+{
+	auto& table = NameTable::Get();
+	_index = table.FindOrAdd(string, length);
+	_caseInsensitiveIndex = table.GetEntry(_index).CaseInsensitiveIndex;
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Static Function
+/****************************************************************************
+*                       Find
+*************************************************************************//**
+*  @fn        Name Name::Find(const tchar* string, const uint64 length)
+*
+*  @brief     Return the registered name without registering the string.
+*
+*  @param[in] const tchar* string
+*  @param[in] const uint64 length
+*
+*  @return    Name (None if the string is not registered)
+*****************************************************************************/
+Name Name::Find(const tchar* string, const uint64 length)
+{
+	auto& table = NameTable::Get();
+
+	const uint32 index = table.Find(string, length, NameTable::ComputeHash(string, length));
+	if (index == INVALID_INDEX) { return Name(); }
+
+	return Name(index, table.GetEntry(index).CaseInsensitiveIndex);
+}
+
+Name Name::Find(const tchar* string)
+{
+	return Find(string, string ? details::string::StringUtility::Length(string) : 0);
+}
+
+uint32 Name::GetEntryCount()
+{
+	return NameTable::Get().GetEntryCount();
+}
+
+uint64 Name::GetStringByteSize()
+{
+	return NameTable::Get().GetStringByteSize();
+}
+#pragma endregion Static Function
+
+#pragma region Public Member Variables
+const tchar* Name::CString() const
+{
+	return NameTable::Get().GetEntry(_index).String;
+}
+
+uint64 Name::Size() const
+{
+	return NameTable::Get().GetEntry(_index).Length;
+}
+
+uint64 Name::GetHash() const
+{
+	return NameTable::Get().GetEntry(_index).Hash;
+}
+
+uint64 Name::GetCaseInsensitiveHash() const
+{
+	return NameTable::Get().GetEntry(_caseInsensitiveIndex).Hash;
+}
+#pragma endregion Public Member Variables
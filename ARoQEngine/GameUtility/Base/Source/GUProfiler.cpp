@@ -0,0 +1,628 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GUProfiler.cpp
+///             @brief  Hierarchical CPU profiler
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/GUProfiler.hpp"
+#include "../Include/GUAssert.hpp"
+#include "GameUtility/File/Include/FileSystem.hpp"
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <cstdio>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace gu;
+
+namespace
+{
+	/*-------------------------------------------------------------------
+	-   Zone written by the producer thread.
+	-   CPU zone : the ticks of Profiler::GetTimestamp, GPU zone : microseconds
+	---------------------------------------------------------------------*/
+	struct ProfileEvent
+	{
+		const char* Name  = nullptr;
+		uint64      Begin = 0;
+		uint64      End   = 0;
+		uint32      Depth = 0;
+		bool        IsGPU = false;
+	};
+
+	/*-------------------------------------------------------------------
+	-   Event kept by the capture (microseconds from the capture start)
+	---------------------------------------------------------------------*/
+	struct CaptureEvent
+	{
+		const char* Name                = nullptr;
+		double      BeginMicroseconds    = 0.0;
+		double      DurationMicroseconds = 0.0;
+		uint32      ThreadIndex          = 0;
+		uint32      Depth                = 0;
+		bool        IsGPU                = false;
+	};
+
+	/****************************************************************************
+	*				  			ProfileThreadBuffer
+	*************************************************************************//**
+	*  @class     ProfileThreadBuffer
+	*  @brief     Single producer (owner thread) / single consumer (EndFrame) ring buffer.
+	*             The indices are increased monotonically and masked on the access.
+	*****************************************************************************/
+	struct ProfileThreadBuffer
+	{
+		static constexpr uint64 MASK = Profiler::THREAD_EVENT_CAPACITY - 1;
+		static_assert((Profiler::THREAD_EVENT_CAPACITY & MASK) == 0, "capacity must be the power of 2");
+
+		std::unique_ptr<ProfileEvent[]> Events = std::make_unique<ProfileEvent[]>(Profiler::THREAD_EVENT_CAPACITY);
+
+		alignas(64) std::atomic<uint64> WriteIndex = 0;
+		alignas(64) std::atomic<uint64> ReadIndex  = 0;
+
+		uint32      ThreadIndex = 0;
+		std::string ThreadName  = "";
+
+		/* @brief : false after the owner thread exits. The buffer is reused by the next new thread.*/
+		std::atomic<bool> IsInUse     = true;
+		std::atomic<bool> HasGPUZone  = false;
+	};
+
+	/*-------------------------------------------------------------------
+	-   Release the buffer when the thread exits
+	---------------------------------------------------------------------*/
+	struct ProfileThreadBufferHandle
+	{
+		ProfileThreadBuffer* Buffer = nullptr;
+
+		~ProfileThreadBufferHandle()
+		{
+			if (Buffer) { Buffer->IsInUse.store(false, std::memory_order_release); }
+		}
+	};
+
+	/*-------------------------------------------------------------------
+	-   Per frame duration history of the zone
+	---------------------------------------------------------------------*/
+	struct ZoneHistory
+	{
+		float  Milliseconds[Profiler::HISTORY_FRAME_COUNT] = {};
+		uint32 SampleCount    = 0;
+		uint32 NextSample     = 0;
+
+		double CurrentMilliseconds = 0.0;
+		uint32 CurrentCallCount    = 0;
+		uint32 LastCallCount       = 0;
+		float  LastMilliseconds    = 0.0f;
+	};
+
+	constexpr uint32 FRAME_THREAD_INDEX = 0;
+	constexpr const char* FRAME_ZONE_NAME = "Frame";
+
+	/* @brief : The buffer of the current thread (registered on the first zone)*/
+	thread_local ProfileThreadBufferHandle t_threadBuffer = {};
+
+	/*-------------------------------------------------------------------
+	-   Write the json string escaping the quote and the control character
+	---------------------------------------------------------------------*/
+	void WriteJsonString(FILE* file, const char* string)
+	{
+		std::fputc('"', file);
+		for (const char* c = string ? string : ""; *c != '\0'; ++c)
+		{
+			if      (*c == '"' || *c == '\\')                   { std::fputc('\\', file); std::fputc(*c, file); }
+			else if (static_cast<unsigned char>(*c) < 0x20)    { std::fprintf(file, "\\u%04x", *c); }
+			else                                               { std::fputc(*c, file); }
+		}
+		std::fputc('"', file);
+	}
+}
+
+/****************************************************************************
+*				  			Profiler::Implement
+*************************************************************************//**
+*  @struct    Profiler::Implement
+*  @brief     The state touched only under FrameMutex (except the buffer registration)
+*****************************************************************************/
+struct Profiler::Implement
+{
+	/*-------------------------------------------------------------------
+	-   Thread buffers. They are not released but reused after the owner thread exits.
+	---------------------------------------------------------------------*/
+	std::mutex RegistryMutex;
+	std::vector<std::unique_ptr<ProfileThreadBuffer>> ThreadBuffers = {};
+
+	/*-------------------------------------------------------------------
+	-   Frame state and statistics
+	---------------------------------------------------------------------*/
+	mutable std::mutex FrameMutex;
+	std::atomic<uint64> FrameBeginTick = 0; // 0 : BeginFrame is not called after the last EndFrame
+	uint64 LastFrameEndTick = 0;
+	std::unordered_map<const char*, ZoneHistory> CPUZones = {};
+	std::unordered_map<const char*, ZoneHistory> GPUZones = {};
+
+	/*-------------------------------------------------------------------
+	-   Capture
+	---------------------------------------------------------------------*/
+	std::vector<CaptureEvent> CaptureEvents = {};
+	double CaptureBeginMicroseconds = 0.0;
+
+	/*-------------------------------------------------------------------
+	-   Tick to microseconds (micro = BaseMicroseconds + (tick - BaseTick) / TicksPerMicrosecond)
+	---------------------------------------------------------------------*/
+	uint64 BaseTick             = 0;
+	uint64 BaseMicroseconds     = 0;
+	double TicksPerMicrosecond  = 1000.0;
+
+	double ToMicroseconds(const uint64 tick) const
+	{
+		return static_cast<double>(BaseMicroseconds) + static_cast<double>(static_cast<int64>(tick - BaseTick)) / TicksPerMicrosecond;
+	}
+
+	ProfileThreadBuffer* GetThreadBuffer()
+	{
+		if (t_threadBuffer.Buffer) { return t_threadBuffer.Buffer; }
+
+		std::scoped_lock lock(RegistryMutex);
+
+		// The remaining events of the exited thread are drained as usual, so only the producer is changed.
+		for (const auto& buffer : ThreadBuffers)
+		{
+			if (buffer->IsInUse.load(std::memory_order_acquire)) { continue; }
+
+			buffer->IsInUse.store(true, std::memory_order_relaxed);
+			buffer->ThreadName   = "Thread " + std::to_string(buffer->ThreadIndex);
+			t_threadBuffer.Buffer = buffer.get();
+			return t_threadBuffer.Buffer;
+		}
+
+		auto buffer = std::make_unique<ProfileThreadBuffer>();
+		buffer->ThreadIndex = static_cast<uint32>(ThreadBuffers.size()) + 1; // 0 is the frame marker
+		buffer->ThreadName  = "Thread " + std::to_string(buffer->ThreadIndex);
+		t_threadBuffer.Buffer = buffer.get();
+		ThreadBuffers.push_back(std::move(buffer));
+		return t_threadBuffer.Buffer;
+	}
+
+	void AddSample(std::unordered_map<const char*, ZoneHistory>& zones, const char* name, const double milliseconds)
+	{
+		auto& history = zones[name];
+		history.CurrentMilliseconds += milliseconds;
+		history.CurrentCallCount++;
+	}
+
+	/*-------------------------------------------------------------------
+	-   Push the sum of this frame into the history (the zone not called in this frame is skipped)
+	---------------------------------------------------------------------*/
+	void FlushHistory(std::unordered_map<const char*, ZoneHistory>& zones)
+	{
+		for (auto& [name, history] : zones)
+		{
+			history.LastCallCount = history.CurrentCallCount;
+			if (history.CurrentCallCount == 0) { continue; }
+
+			history.LastMilliseconds = static_cast<float>(history.CurrentMilliseconds);
+			history.Milliseconds[history.NextSample] = history.LastMilliseconds;
+			history.NextSample  = (history.NextSample + 1) % HISTORY_FRAME_COUNT;
+			history.SampleCount = std::min(history.SampleCount + 1, HISTORY_FRAME_COUNT);
+
+			history.CurrentMilliseconds = 0.0;
+			history.CurrentCallCount    = 0;
+		}
+	}
+
+	void AppendStatistics(const std::unordered_map<const char*, ZoneHistory>& zones, const bool isGPU, DynamicArray<ProfileZoneStatistics>& result) const
+	{
+		float sorted[HISTORY_FRAME_COUNT] = {};
+
+		for (const auto& [name, history] : zones)
+		{
+			if (history.SampleCount == 0) { continue; }
+
+			double sum = 0.0;
+			for (uint32 i = 0; i < history.SampleCount; ++i)
+			{
+				sorted[i] = history.Milliseconds[i];
+				sum += sorted[i];
+			}
+			std::sort(sorted, sorted + history.SampleCount);
+
+			const uint32 p99Index = std::min(history.SampleCount - 1, static_cast<uint32>(history.SampleCount * 0.99f));
+
+			ProfileZoneStatistics statistics = {};
+			statistics.Name                = name;
+			statistics.LastMilliseconds    = history.LastMilliseconds;
+			statistics.MinMilliseconds     = sorted[0];
+			statistics.AverageMilliseconds = static_cast<float>(sum / history.SampleCount);
+			statistics.P99Milliseconds     = sorted[p99Index];
+			statistics.CallCount           = history.LastCallCount;
+			statistics.IsGPU               = isGPU;
+			result.Push(statistics);
+		}
+	}
+};
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+Profiler::Profiler() : _implement(new Implement())
+{
+	/*-------------------------------------------------------------------
+	-   Calibrate the rdtsc frequency (refined in EndFrame)
+	---------------------------------------------------------------------*/
+	_implement->BaseMicroseconds = GetClockMicroseconds();
+	_implement->BaseTick         = GetTimestamp();
+
+#if GU_PROFILER_USE_RDTSC
+	uint64 nowMicroseconds = _implement->BaseMicroseconds;
+	while (nowMicroseconds - _implement->BaseMicroseconds < 2000)
+	{
+		nowMicroseconds = GetClockMicroseconds();
+	}
+	_implement->TicksPerMicrosecond = static_cast<double>(GetTimestamp() - _implement->BaseTick)
+		                            / static_cast<double>(nowMicroseconds - _implement->BaseMicroseconds);
+#else
+	_implement->TicksPerMicrosecond = 1000.0;
+#endif
+
+	_implement->LastFrameEndTick = GetTimestamp();
+}
+
+Profiler::~Profiler()
+{
+	delete _implement;
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Static Function
+/****************************************************************************
+*                       Instance
+*************************************************************************//**
+*  @fn        Profiler& Profiler::Instance()
+*
+*  @brief     Return the profiler. It is never destroyed so the zones can be recorded in the static destructors.
+*
+*  @param[in] void
+*
+*  @return    Profiler&
+*****************************************************************************/
+Profiler& Profiler::Instance()
+{
+	static Profiler* profiler = new Profiler();
+	return *profiler;
+}
+
+/****************************************************************************
+*                       GetClockMicroseconds
+*************************************************************************//**
+*  @fn        uint64 Profiler::GetClockMicroseconds() noexcept
+*
+*  @brief     steady_clock microseconds. The GPU calibration timestamp uses the same clock.
+*
+*  @param[in] void
+*
+*  @return    uint64 microseconds
+*****************************************************************************/
+uint64 Profiler::GetClockMicroseconds() noexcept
+{
+	return static_cast<uint64>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+#pragma endregion Static Function
+
+#pragma region Public Function
+/****************************************************************************
+*                       BeginFrame
+*************************************************************************//**
+*  @fn        void Profiler::BeginFrame()
+*
+*  @brief     Mark the frame start. (Can be called from the other thread than EndFrame)
+*             Only the first call after EndFrame is used, so the update loop running faster than
+*             the draw loop does not shorten the frame.
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
+void Profiler::BeginFrame()
+{
+	uint64 expected = 0;
+	_implement->FrameBeginTick.compare_exchange_strong(expected, GetTimestamp(), std::memory_order_relaxed);
+}
+
+/****************************************************************************
+*                       EndFrame
+*************************************************************************//**
+*  @fn        void Profiler::EndFrame()
+*
+*  @brief     Drain all of the thread buffers and update the rolling statistics.
+*             The event recorded by the other thread during this call is drained in the next frame.
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
+void Profiler::EndFrame()
+{
+	const uint64 frameEndTick = GetTimestamp();
+
+	std::scoped_lock lock(_implement->FrameMutex);
+
+	auto& implement = *_implement;
+
+	/*-------------------------------------------------------------------
+	-   Refine the tick frequency with the longer interval
+	---------------------------------------------------------------------*/
+#if GU_PROFILER_USE_RDTSC
+	const uint64 nowMicroseconds = GetClockMicroseconds();
+	if (nowMicroseconds - implement.BaseMicroseconds > 1000000)
+	{
+		implement.TicksPerMicrosecond = static_cast<double>(frameEndTick - implement.BaseTick)
+			                          / static_cast<double>(nowMicroseconds - implement.BaseMicroseconds);
+	}
+#endif
+
+	const bool canCapture = _isCapturing && implement.CaptureEvents.size() < MAX_CAPTURE_EVENT_COUNT;
+
+	/*-------------------------------------------------------------------
+	-   Frame marker (from the previous EndFrame if BeginFrame is not called)
+	---------------------------------------------------------------------*/
+	uint64 frameBeginTick = implement.FrameBeginTick.exchange(0, std::memory_order_relaxed);
+	if (frameBeginTick == 0 || frameBeginTick > frameEndTick) { frameBeginTick = implement.LastFrameEndTick; }
+	implement.LastFrameEndTick = frameEndTick;
+
+	if (IsEnabled())
+	{
+		const double frameBegin = implement.ToMicroseconds(frameBeginTick);
+		const double frameEnd   = implement.ToMicroseconds(frameEndTick);
+		implement.AddSample(implement.CPUZones, FRAME_ZONE_NAME, (frameEnd - frameBegin) * 0.001);
+
+		if (canCapture)
+		{
+			implement.CaptureEvents.push_back({ FRAME_ZONE_NAME, frameBegin - implement.CaptureBeginMicroseconds, frameEnd - frameBegin, FRAME_THREAD_INDEX, 0, false });
+		}
+	}
+
+	/*-------------------------------------------------------------------
+	-   Drain the thread buffers
+	---------------------------------------------------------------------*/
+	std::vector<ProfileThreadBuffer*> buffers;
+	{
+		std::scoped_lock registryLock(implement.RegistryMutex);
+		buffers.reserve(implement.ThreadBuffers.size());
+		for (const auto& buffer : implement.ThreadBuffers) { buffers.push_back(buffer.get()); }
+	}
+
+	for (auto* buffer : buffers)
+	{
+		const uint64 readIndex  = buffer->ReadIndex.load(std::memory_order_relaxed);
+		const uint64 writeIndex = buffer->WriteIndex.load(std::memory_order_acquire);
+
+		for (uint64 i = readIndex; i < writeIndex; ++i)
+		{
+			const auto& event = buffer->Events[i & ProfileThreadBuffer::MASK];
+
+			const double begin = event.IsGPU ? static_cast<double>(event.Begin) : implement.ToMicroseconds(event.Begin);
+			const double end   = event.IsGPU ? static_cast<double>(event.End)   : implement.ToMicroseconds(event.End);
+
+			implement.AddSample(event.IsGPU ? implement.GPUZones : implement.CPUZones, event.Name, (end - begin) * 0.001);
+
+			if (canCapture && implement.CaptureEvents.size() < MAX_CAPTURE_EVENT_COUNT)
+			{
+				implement.CaptureEvents.push_back({ event.Name, begin - implement.CaptureBeginMicroseconds, end - begin, buffer->ThreadIndex, event.Depth, event.IsGPU });
+			}
+		}
+
+		buffer->ReadIndex.store(writeIndex, std::memory_order_release);
+	}
+
+	implement.FlushHistory(implement.CPUZones);
+	implement.FlushHistory(implement.GPUZones);
+	_frameCount++;
+}
+
+/****************************************************************************
+*                       SetThreadName
+*************************************************************************//**
+*  @fn        void Profiler::SetThreadName(const char* name)
+*
+*  @brief     Name of the current thread shown in the trace.
+*
+*  @param[in] const char* name
+*
+*  @return    void
+*****************************************************************************/
+void Profiler::SetThreadName(const char* name)
+{
+	auto* buffer = _implement->GetThreadBuffer();
+
+	std::scoped_lock lock(_implement->RegistryMutex);
+	buffer->ThreadName = name ? name : "";
+}
+
+/****************************************************************************
+*                       RecordZone
+*************************************************************************//**
+*  @fn        void Profiler::RecordZone(const char* name, const uint64 beginTick, const uint64 endTick, const uint32 depth)
+*
+*  @brief     Write the zone into the buffer of the current thread. (lock free)
+*
+*  @param[in] const char* name (string literal)
+*  @param[in] const uint64 beginTick
+*  @param[in] const uint64 endTick
+*  @param[in] const uint32 depth
+*
+*  @return    void
+*****************************************************************************/
+void Profiler::RecordZone(const char* name, const uint64 beginTick, const uint64 endTick, const uint32 depth)
+{
+	auto* buffer = _implement->GetThreadBuffer();
+
+	const uint64 writeIndex = buffer->WriteIndex.load(std::memory_order_relaxed);
+	const uint64 readIndex  = buffer->ReadIndex .load(std::memory_order_acquire);
+
+	if (writeIndex - readIndex >= THREAD_EVENT_CAPACITY)
+	{
+		_droppedEventCount.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	buffer->Events[writeIndex & ProfileThreadBuffer::MASK] = { name, beginTick, endTick, depth, false };
+	buffer->WriteIndex.store(writeIndex + 1, std::memory_order_release);
+}
+
+/****************************************************************************
+*                       AddGPUZone
+*************************************************************************//**
+*  @fn        void Profiler::AddGPUZone(const char* name, const uint64 beginMicroseconds, const uint64 endMicroseconds, const uint32 depth)
+*
+*  @brief     Record the GPU zone already converted to the GetClockMicroseconds timeline.
+*
+*  @param[in] const char* name (string literal)
+*  @param[in] const uint64 beginMicroseconds
+*  @param[in] const uint64 endMicroseconds
+*  @param[in] const uint32 depth
+*
+*  @return    void
+*****************************************************************************/
+void Profiler::AddGPUZone(const char* name, const uint64 beginMicroseconds, const uint64 endMicroseconds, const uint32 depth)
+{
+	if (!IsEnabled()) { return; }
+
+	auto* buffer = _implement->GetThreadBuffer();
+
+	const uint64 writeIndex = buffer->WriteIndex.load(std::memory_order_relaxed);
+	const uint64 readIndex  = buffer->ReadIndex .load(std::memory_order_acquire);
+
+	if (writeIndex - readIndex >= THREAD_EVENT_CAPACITY)
+	{
+		_droppedEventCount.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	buffer->HasGPUZone.store(true, std::memory_order_relaxed);
+	buffer->Events[writeIndex & ProfileThreadBuffer::MASK] = { name, beginMicroseconds, std::max(beginMicroseconds, endMicroseconds), depth, true };
+	buffer->WriteIndex.store(writeIndex + 1, std::memory_order_release);
+}
+
+/****************************************************************************
+*                       StartCapture
+*************************************************************************//**
+*  @fn        void Profiler::StartCapture()
+*
+*  @brief     Keep the drained events until StopCapture (up to MAX_CAPTURE_EVENT_COUNT)
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
+void Profiler::StartCapture()
+{
+	std::scoped_lock lock(_implement->FrameMutex);
+
+	_implement->CaptureEvents.clear();
+	_implement->CaptureBeginMicroseconds = _implement->ToMicroseconds(GetTimestamp());
+	_isCapturing = true;
+}
+
+void Profiler::StopCapture()
+{
+	std::scoped_lock lock(_implement->FrameMutex);
+	_isCapturing = false;
+}
+
+/****************************************************************************
+*                       ExportChromeTrace
+*************************************************************************//**
+*  @fn        bool Profiler::ExportChromeTrace(const tstring& filePath) const
+*
+*  @brief     Write the captured events as the trace event format.
+*             pid 1 : CPU threads (tid 0 is the frame marker), pid 2 : GPU.
+*             The zones are the complete event ("X"), so the nesting is restored by the viewer.
+*
+*  @param[in] const tstring& filePath
+*
+*  @return    bool (false : failed to open the file)
+*****************************************************************************/
+bool Profiler::ExportChromeTrace(const tstring& filePath) const
+{
+	const std::wstring path(filePath.CString(), filePath.CString() + filePath.Size());
+
+	FILE* file = file::FileSystem::OpenFile(path, "wb");
+	if (file == nullptr) { return false; }
+
+	std::scoped_lock lock(_implement->FrameMutex);
+
+	std::fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", file);
+
+	/*-------------------------------------------------------------------
+	-   Metadata (process and thread names)
+	---------------------------------------------------------------------*/
+	std::fputs("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"CPU\"}},\n", file);
+	std::fputs("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":2,\"tid\":0,\"args\":{\"name\":\"GPU\"}},\n", file);
+	std::fputs("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"Frame\"}}", file);
+	{
+		std::scoped_lock registryLock(_implement->RegistryMutex);
+		for (const auto& buffer : _implement->ThreadBuffers)
+		{
+			std::fprintf(file, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":", buffer->ThreadIndex);
+			WriteJsonString(file, buffer->ThreadName.c_str());
+			std::fputs("}}", file);
+
+			if (!buffer->HasGPUZone.load(std::memory_order_relaxed)) { continue; }
+			std::fprintf(file, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":2,\"tid\":%u,\"args\":{\"name\":", buffer->ThreadIndex);
+			WriteJsonString(file, (buffer->ThreadName + " (GPU)").c_str());
+			std::fputs("}}", file);
+		}
+	}
+
+	/*-------------------------------------------------------------------
+	-   Zones
+	---------------------------------------------------------------------*/
+	for (const auto& event : _implement->CaptureEvents)
+	{
+		std::fputs(",\n{\"name\":", file);
+		WriteJsonString(file, event.Name);
+		std::fprintf(file, ",\"ph\":\"X\",\"pid\":%d,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"depth\":%u}}",
+			event.IsGPU ? 2 : 1, event.ThreadIndex, event.BeginMicroseconds, event.DurationMicroseconds, event.Depth);
+	}
+
+	std::fputs("\n]}\n", file);
+	std::fclose(file);
+	return true;
+}
+#pragma endregion Public Function
+
+#pragma region Public Member Variables
+/****************************************************************************
+*                       GetZoneStatistics
+*************************************************************************//**
+*  @fn        DynamicArray<ProfileZoneStatistics> Profiler::GetZoneStatistics() const
+*
+*  @brief     Rolling statistics of the zones (CPU first, then GPU)
+*
+*  @param[in] void
+*
+*  @return    DynamicArray<ProfileZoneStatistics>
+*****************************************************************************/
+DynamicArray<ProfileZoneStatistics> Profiler::GetZoneStatistics() const
+{
+	std::scoped_lock lock(_implement->FrameMutex);
+
+	DynamicArray<ProfileZoneStatistics> result = {};
+	result.Reserve(_implement->CPUZones.size() + _implement->GPUZones.size());
+
+	_implement->AppendStatistics(_implement->CPUZones, false, result);
+	_implement->AppendStatistics(_implement->GPUZones, true , result);
+	return result;
+}
+#pragma endregion Public Member Variables
@@ -12,6 +12,7 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include "GameUtility/Base/Include/GUAssert.hpp"
+#include "GameUtility/Base/Include/GUTypeCast.hpp"
 #include "GameUtility/Memory/Include/GUMemory.hpp"
 #include "GameUtility/Container/Include/GUInitializerList.hpp"
 #include "GameUtility/Container/Private/Iterator/Include/GUIteratorIncludes.hpp"
@@ -37,6 +38,9 @@ namespace gu
 	public:
 		static constexpr uint64 INDEX_NONE = static_cast<uint64>(-1);
 
+		// @brief : ŏɃq[vmۂۂ̗vf (1LbVC, ȂƂ1vf)
+		static constexpr uint64 DEFAULT_GROWTH_CAPACITY = sizeof(ElementType) >= 64 ? 1 : 64 / sizeof(ElementType);
+
 		/****************************************************************************
 		**                Public Function
 		*****************************************************************************/
@@ -73,9 +77,26 @@ namespace gu
 
 		/*----------------------------------------------------------------------
 		*  @brief : zɒǉ. Capacity𒴂ꍇ, Ŝ̃2{̑傫ōĊ蓖Ăs.
+		*           z̗vfnĂĊ蓖ČɐRs[܂.
 		/*----------------------------------------------------------------------*/
-		void Push(const ElementType& element);
-		void Push(      ElementType&& element);
+		void Push(const ElementType& element) { EmplaceBack(element); }
+		void Push(      ElementType&& element) { EmplaceBack(type::Forward<ElementType>(element)); }
+
+		/*----------------------------------------------------------------------
+		*  @brief : RXgN^𒼐ڌĂяoĔžɒǉ, ǉvfԂ܂.
+		*           ꎞIuWFNg̃Rs[⃀[u܂.
+		/*----------------------------------------------------------------------*/
+		template<class... Arguments>
+		ElementType& EmplaceBack(Arguments&&... arguments)
+		{
+			if (_size < _capacity)
+			{
+				ElementType* element = new (&_data[_size]) ElementType(type::Forward<Arguments>(arguments)...);
+				++_size;
+				return *element;
+			}
+			return EmplaceBackWithGrowth(type::Forward<Arguments>(arguments)...);
+		}
 
 		/*----------------------------------------------------------------------
 		*  @brief : z납o. ̍, fXgN^Ăяo.
@@ -134,8 +155,8 @@ namespace gu
 		/*----------------------------------------------------------------------
 		*  @brief : 擪̗vf
 		/*----------------------------------------------------------------------*/
-		__forceinline       ElementType& Front()       {return _data;}
-		__forceinline const ElementType& Front() const { return _data; }
+		__forceinline       ElementType& Front()       { return _data[0]; }
+		__forceinline const ElementType& Front() const { return _data[0]; }
 
 		/*----------------------------------------------------------------------
 		*  @brief :@Ō̗vf
@@ -228,10 +249,17 @@ namespace gu
 		}
 
 		// [uRXgN^
-		DynamicArray& operator=(DynamicArray&& other)
+		DynamicArray& operator=(DynamicArray&& other) noexcept
 		{
 			if (this != &other)
 			{
+				// XĂ͉̈Ătւ
+				if (_data)
+				{
+					Memory::ForceExecuteDestructors(_data, _size);
+					Memory::Free(_data);
+				}
+
 				// q[v̈̑S͎̎Ԃ邽, ܂Ń|C^̕tւőΉ܂.
 				_data     = other._data;     other._data     = nullptr;
 				_size     = other._size;     other._size     = 0;
@@ -306,6 +334,20 @@ namespace gu
 
 		void RemoveAtImplement(const uint64 index, const uint64 count, const bool allowShrinking);
 
+		/* @brief : capacityύX, ̗vfV̈ֈړ܂ (capacity >= size)*/
+		void ChangeCapacity(const uint64 capacity);
+
+		/* @brief : ȂƂrequiredCapacity鎟capacityԂ܂*/
+		__forceinline uint64 CalculateGrowth(const uint64 requiredCapacity) const
+		{
+			const uint64 doubled = _capacity == 0 ? DEFAULT_GROWTH_CAPACITY : _capacity * 2;
+			return doubled < requiredCapacity ? requiredCapacity : doubled;
+		}
+
+		/* @brief : Ċ蓖Ă𔺂EmplaceBack. z̗vfwĂĂǂ悤, V̈Őɍ\zĂvfړ܂*/
+		template<class... Arguments>
+		ElementType& EmplaceBackWithGrowth(Arguments&&... arguments);
+
 		/****************************************************************************
 		**                Private Member Variables
 		*****************************************************************************/
@@ -365,9 +407,10 @@ namespace gu
 			}
 			else
 			{
+				// ̈̂, ł͂ȂRs[RXgN^ō\z
 				for (uint64 i = _size; i < _size + residueSize; ++i)
 				{
-					_data[i] = defaultElement;
+					new (&_data[i]) ElementType(defaultElement);
 				}
 			}
 		}
@@ -395,21 +438,56 @@ namespace gu
 		---------------------------------------------------------------------*/
 		if (capacity <= _capacity) { return; }
 
+		ChangeCapacity(capacity);
+	}
+
+	/****************************************************************************
+	*                    ChangeCapacity
+	*************************************************************************//**
+	*  @fn       @void DynamicArray<ElementType>::ChangeCapacity(const uint64 capacity)
+	*
+	*  @brief     capacityύX, ̗vfV̈ֈړ܂. 
+	*             IS_TRIVIALLY_RELOCATABLEȌ^reallocňړ邽, vfƂ̃[ufXgN^͌Ă΂܂.
+	*
+	*  @param[in] const uint64 capacity (sizeȏł邱)
+	*
+	*  @return @@void
+	*****************************************************************************/
+	template<class ElementType>
+	void DynamicArray<ElementType>::ChangeCapacity(const uint64 capacity)
+	{
+		Check(capacity >= _size);
+
 		/*-------------------------------------------------------------------
-		-           ƂƔz񂪑݂ĂΑSẴRs[ō폜
+		-           e0̏ꍇ͉̂
 		---------------------------------------------------------------------*/
-		auto newData = Memory::Allocate(capacity * sizeof(ElementType));
-
-		if (_data != nullptr && _capacity)
+		if (capacity == 0)
 		{
-			Memory::Copy(newData, _data, _capacity * sizeof(ElementType));
-			Memory::Free(_data);
+			if (_data) { Memory::Free(_data); }
+			_data     = nullptr;
+			_capacity = 0;
+			return;
 		}
 
 		/*-------------------------------------------------------------------
-		-           Data̍XV
+		-           rbgRs[ňړłꍇreallocɔC (̏Ŋgł΃Rs[Ȃ)
 		---------------------------------------------------------------------*/
-		_data     = (ElementType*)newData;
+		if constexpr (type::IS_TRIVIALLY_RELOCATABLE<ElementType>)
+		{
+			_data = (ElementType*)Memory::Reallocate(_data, capacity * sizeof(ElementType));
+		}
+		else
+		{
+			auto newData = (ElementType*)Memory::Allocate(capacity * sizeof(ElementType));
+
+			if (_data != nullptr)
+			{
+				Memory::ForceExecuteRelocateConstructors(newData, _data, _size);
+				Memory::Free(_data);
+			}
+			_data = newData;
+		}
+
 		_capacity = capacity;
 	}
 
@@ -460,56 +538,41 @@ namespace gu
 		if (_capacity == 0)     { return; }
 		if (_size >= _capacity) { return; }
 
-		/*-------------------------------------------------------------------
-		-           ̏ꍇ_capacity̕size傫ƂĂ邽, 
-		            _dataɒڑsĂ. 
-		---------------------------------------------------------------------*/
-		if (_size != 0)
-		{
-			_data = (ElementType*)Memory::Reallocate(_data, _size * sizeof(ElementType));
-		}
-		else
-		{
-			if (_data)
-			{
-				Memory::Free(_data);
-				_data = nullptr;
-			}
-		}
-		_capacity = _size;
+		ChangeCapacity(_size);
 	}
 
 	/****************************************************************************
-	*                    Push
+	*                    EmplaceBackWithGrowth
 	*************************************************************************//**
-	*  @fn       @void DynamicArray<ElementType>::ShrinkToFit()
+	*  @fn       @ElementType& DynamicArray<ElementType>::EmplaceBackWithGrowth(Arguments&&... arguments)
 	*
-	*  @brief      zɒǉ. Capacity𒴂ꍇ, Ŝ̃2{̑傫ōĊ蓖Ăs.
+	*  @brief      CapacitygĔzɒǉ. 
+	*              Push(array[0])̂悤Ɉz̗vfQƂĂꍇ邽, 
+	*              V̈ŗvf\zĂ̗vfړ, Â̈܂.
 	*
-	*  @param[in] ElementType& element
+	*  @param[in] Arguments&&... arguments RXgN^
 	*
-	*  @return @@void
+	*  @return @@ElementType& ǉvf
 	*****************************************************************************/
 	template<class ElementType>
-	void DynamicArray<ElementType>::Push(const ElementType& element)
+	template<class... Arguments>
+	ElementType& DynamicArray<ElementType>::EmplaceBackWithGrowth(Arguments&&... arguments)
 	{
-		if (_capacity <= _size)
-		{
-			Reserve(_capacity == 0 ? 1 : _size * 2);
-		}
+		const uint64 newCapacity = CalculateGrowth(_size + 1);
+		auto newData = (ElementType*)Memory::Allocate(newCapacity * sizeof(ElementType));
 
-		_data[_size] = element;
-		++_size;
-	}
-	template<class ElementType>
-	void DynamicArray<ElementType>::Push(ElementType&& element)
-	{
-		if (_capacity <= _size)
+		ElementType* element = new (&newData[_size]) ElementType(type::Forward<Arguments>(arguments)...);
+
+		if (_data != nullptr)
 		{
-			Reserve(_capacity == 0 ? 1 : _size * 2);
+			Memory::ForceExecuteRelocateConstructors(newData, _data, _size);
+			Memory::Free(_data);
 		}
-		_data[_size] = type::Forward<ElementType>(element);
+
+		_data     = newData;
+		_capacity = newCapacity;
 		++_size;
+		return *element;
 	}
 
 	/****************************************************************************
@@ -548,7 +611,7 @@ namespace gu
 	{
 		for (uint64 i = 0; i < _size; ++i)
 		{
-			if(*_data[i] == element)
+			if(_data[i] == element)
 			{
 				return true;
 			}
@@ -584,13 +647,13 @@ namespace gu
 		Memory::ForceExecuteDestructors(Data() + index, removeCount);
 
 		/*-------------------------------------------------------------------
-		-           ̈ړ
+		-           ̈ړ (IS_TRIVIALLY_RELOCATABLEłmemmovê)
 		---------------------------------------------------------------------*/
 		const auto moveCount = _size - index - removeCount;
 		
 		if (moveCount > 0)
 		{
-			Memory::Move(&_data[index], &_data[index + removeCount], moveCount * sizeof(ElementType));
+			Memory::ForceExecuteRelocateConstructors(&_data[index], &_data[index + removeCount], moveCount);
 		}
 
 		_size -= removeCount;
@@ -650,7 +713,7 @@ namespace gu
 
 			if (*data == element)
 			{
-				return static_cast<uint64>(data - start);
+				return static_cast<uint64>(data - _data);
 			}
 		}
 
@@ -672,21 +735,32 @@ namespace gu
 	template<class ElementType>
 	gu::uint64 DynamicArray<ElementType>::RemoveAll(const ElementType& element, const bool allowShrinking)
 	{
-		ElementType* start = _data;
-
-		uint64 index = 0;
-		uint64 findCounter = 0;
+		/*-------------------------------------------------------------------
+		-           cvfOɋl߂Ă, 1̑ō폜
+		---------------------------------------------------------------------*/
+		// elementz̗vfwĂĂrł悤, jړ̑OɃRs[Ă
+		const ElementType value = element;
+		uint64 writeIndex = 0;
 
-		for (ElementType* data = start; data != &_data[_size]; ++data, ++index)
+		for (uint64 readIndex = 0; readIndex < _size; ++readIndex)
 		{
-			if (*data == element)
+			if (_data[readIndex] == value)
 			{
-				RemoveAtImplement(findCounter, 1, false);
-				index--;
-				findCounter++;
+				Memory::ForceExecuteDestructors(&_data[readIndex], 1);
+			}
+			else
+			{
+				if (writeIndex != readIndex)
+				{
+					Memory::ForceExecuteRelocateConstructors(&_data[writeIndex], &_data[readIndex], 1);
+				}
+				++writeIndex;
 			}
 		}
 
+		const uint64 findCounter = _size - writeIndex;
+		_size = writeIndex;
+
 		if (findCounter && allowShrinking)
 		{
 			ShrinkToFit();
@@ -698,4 +772,11 @@ namespace gu
 #pragma endregion Implement
 }
 
+// DynamicArraŷ͐擪|C^ƃTCŶ݂, vf̌^Ɋւ炸memmoveňړł
+namespace gu::details::type_traits
+{
+	template<class ElementType>
+	struct IsTriviallyRelocatableClass<DynamicArray<ElementType>> : TrueType {};
+}
+
 #endif
\ No newline at end of file
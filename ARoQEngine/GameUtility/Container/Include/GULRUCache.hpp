@@ -0,0 +1,302 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GULRUCache.hpp
+///             @brief  Fixed capacity cache with the least recently used eviction.
+///                     The values are stored in the slot array allocated at the construction,
+///                     and the slot of the evicted key is reused by the new key.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GU_LRU_CACHE_HPP
+#define GU_LRU_CACHE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gu
+{
+	/****************************************************************************
+	*				  			   LRUCache
+	*************************************************************************//**
+	*  @class     LRUCache
+	*  @brief     64 bit key -> ValueType cache with the fixed capacity.
+	*             Find and Insert are O(1) (chained hash buckets + intrusive doubly linked list).
+	*             The slot index stays valid until the key is evicted, and the generation of the slot
+	*             is incremented on every reuse, so (index, generation) can be kept as a weak handle.
+	*             The key must be unique. When the key is a hash, compare the stored value on hit.
+	*****************************************************************************/
+	template<class ValueType>
+	class LRUCache
+	{
+	public:
+		/****************************************************************************
+		**                Static Configuration
+		*****************************************************************************/
+		static constexpr uint32 INVALID_INDEX = 0xffffffff;
+
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/*----------------------------------------------------------------------
+		*  @brief : Return the slot index of the key and mark it as the most recently used.
+		*           INVALID_INDEX if the key is not in the cache.
+		/*----------------------------------------------------------------------*/
+		uint32 Find(const uint64 key);
+
+		/*----------------------------------------------------------------------
+		*  @brief : Add the key and return its slot index (the key must not be in the cache).
+		*           If the cache is full, the least recently used key is evicted and its slot is reused.
+		*           The value of the reused slot is not reset.
+		/*----------------------------------------------------------------------*/
+		uint32 Insert(const uint64 key, bool* outEvicted = nullptr);
+
+		/*----------------------------------------------------------------------
+		*  @brief : Mark the slot as the most recently used
+		/*----------------------------------------------------------------------*/
+		void Touch(const uint32 index);
+
+		/*----------------------------------------------------------------------
+		*  @brief : Mark the slot as the least recently used (evicted by the next Insert when the cache is full)
+		/*----------------------------------------------------------------------*/
+		void Demote(const uint32 index);
+
+		/*----------------------------------------------------------------------
+		*  @brief : Remove all keys. The values are kept in the slots.
+		/*----------------------------------------------------------------------*/
+		void Clear();
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		__forceinline       ValueType& At(const uint32 index)       { Check(index < _slots.Size()); return _slots[index].Value; }
+		__forceinline const ValueType& At(const uint32 index) const { Check(index < _slots.Size()); return _slots[index].Value; }
+
+		__forceinline uint64 GetKey       (const uint32 index) const { return _slots[index].Key; }
+		__forceinline uint32 GetGeneration(const uint32 index) const { return _slots[index].Generation; }
+
+		/* @brief : True if the slot still holds the key inserted with the generation*/
+		__forceinline bool IsAlive(const uint32 index, const uint32 generation) const
+		{
+			return index < _slots.Size() && _slots[index].IsUsed && _slots[index].Generation == generation;
+		}
+
+		__forceinline uint32 Size    () const { return _size; }
+		__forceinline uint32 Capacity() const { return static_cast<uint32>(_slots.Size()); }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		LRUCache() = default;
+
+		explicit LRUCache(const uint32 capacity);
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+		__forceinline uint32 GetBucket(const uint64 key) const
+		{
+			// Fibonacci hashing spreads the sequential keys (codepoints etc.)
+			return static_cast<uint32>((key * 0x9E3779B97F4A7C15ull) >> 32) & (static_cast<uint32>(_buckets.Size()) - 1);
+		}
+
+		void Unlink(const uint32 index);
+
+		void PushFront(const uint32 index);
+
+		void PushBack(const uint32 index);
+
+		void RemoveFromBucket(const uint32 index);
+
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		struct Slot
+		{
+			ValueType Value      = {};
+			uint64    Key        = 0;
+			uint32    Previous   = INVALID_INDEX; // more recently used
+			uint32    Next       = INVALID_INDEX; // less recently used
+			uint32    BucketNext = INVALID_INDEX;
+			uint32    Generation = 0;
+			bool      IsUsed     = false;
+		};
+
+		DynamicArray<Slot>   _slots   = {};
+		DynamicArray<uint32> _buckets = {};
+
+		uint32 _head = INVALID_INDEX; // most recently used
+		uint32 _tail = INVALID_INDEX; // least recently used
+		uint32 _size = 0;
+	};
+
+#pragma region Implement
+	template<class ValueType>
+	LRUCache<ValueType>::LRUCache(const uint32 capacity)
+	{
+		Check(capacity > 0);
+
+		uint32 bucketCount = 1;
+		while (bucketCount < capacity * 2) { bucketCount <<= 1; }
+
+		_slots  .Resize(capacity);
+		_buckets.Resize(bucketCount, true, INVALID_INDEX);
+	}
+
+	template<class ValueType>
+	uint32 LRUCache<ValueType>::Find(const uint64 key)
+	{
+		if (_size == 0) { return INVALID_INDEX; }
+
+		for (uint32 index = _buckets[GetBucket(key)]; index != INVALID_INDEX; index = _slots[index].BucketNext)
+		{
+			if (_slots[index].Key == key)
+			{
+				Touch(index);
+				return index;
+			}
+		}
+		return INVALID_INDEX;
+	}
+
+	template<class ValueType>
+	uint32 LRUCache<ValueType>::Insert(const uint64 key, bool* outEvicted)
+	{
+		Check(!_slots.IsEmpty());
+
+		/*-------------------------------------------------------------------
+		-           Use the free slot or evict the least recently used one
+		---------------------------------------------------------------------*/
+		uint32 index   = INVALID_INDEX;
+		bool   evicted = false;
+		if (_size < _slots.Size())
+		{
+			index = _size++;
+		}
+		else
+		{
+			index = _tail;
+			Unlink(index);
+			RemoveFromBucket(index);
+			evicted = true;
+		}
+
+		if (outEvicted) { *outEvicted = evicted; }
+
+		/*-------------------------------------------------------------------
+		-           Register the key
+		---------------------------------------------------------------------*/
+		auto& slot = _slots[index];
+		slot.Key        = key;
+		slot.IsUsed     = true;
+		slot.Generation++;
+
+		const auto bucket = GetBucket(key);
+		slot.BucketNext   = _buckets[bucket];
+		_buckets[bucket]  = index;
+
+		PushFront(index);
+		return index;
+	}
+
+	template<class ValueType>
+	void LRUCache<ValueType>::Touch(const uint32 index)
+	{
+		if (index == _head) { return; }
+		Unlink(index);
+		PushFront(index);
+	}
+
+	template<class ValueType>
+	void LRUCache<ValueType>::Demote(const uint32 index)
+	{
+		if (index == _tail) { return; }
+		Unlink(index);
+		PushBack(index);
+	}
+
+	template<class ValueType>
+	void LRUCache<ValueType>::Clear()
+	{
+		for (uint32 i = 0; i < _slots.Size(); ++i)
+		{
+			auto& slot = _slots[i];
+			if (slot.IsUsed) { slot.Generation++; }
+			slot.IsUsed     = false;
+			slot.Previous   = INVALID_INDEX;
+			slot.Next       = INVALID_INDEX;
+			slot.BucketNext = INVALID_INDEX;
+		}
+		for (uint32 i = 0; i < _buckets.Size(); ++i) { _buckets[i] = INVALID_INDEX; }
+
+		_head = _tail = INVALID_INDEX;
+		_size = 0;
+	}
+
+	template<class ValueType>
+	void LRUCache<ValueType>::Unlink(const uint32 index)
+	{
+		auto& slot = _slots[index];
+		if (slot.Previous != INVALID_INDEX) { _slots[slot.Previous].Next = slot.Next; }
+		else                                { _head = slot.Next; }
+
+		if (slot.Next != INVALID_INDEX) { _slots[slot.Next].Previous = slot.Previous; }
+		else                            { _tail = slot.Previous; }
+
+		slot.Previous = slot.Next = INVALID_INDEX;
+	}
+
+	template<class ValueType>
+	void LRUCache<ValueType>::PushFront(const uint32 index)
+	{
+		auto& slot = _slots[index];
+		slot.Previous = INVALID_INDEX;
+		slot.Next     = _head;
+
+		if (_head != INVALID_INDEX) { _slots[_head].Previous = index; }
+		_head = index;
+
+		if (_tail == INVALID_INDEX) { _tail = index; }
+	}
+
+	template<class ValueType>
+	void LRUCache<ValueType>::PushBack(const uint32 index)
+	{
+		auto& slot = _slots[index];
+		slot.Previous = _tail;
+		slot.Next     = INVALID_INDEX;
+
+		if (_tail != INVALID_INDEX) { _slots[_tail].Next = index; }
+		_tail = index;
+
+		if (_head == INVALID_INDEX) { _head = index; }
+	}
+
+	template<class ValueType>
+	void LRUCache<ValueType>::RemoveFromBucket(const uint32 index)
+	{
+		uint32* link = &_buckets[GetBucket(_slots[index].Key)];
+		while (*link != INVALID_INDEX)
+		{
+			if (*link == index)
+			{
+				*link = _slots[index].BucketNext;
+				break;
+			}
+			link = &_slots[*link].BucketNext;
+		}
+		_slots[index].BucketNext = INVALID_INDEX;
+	}
+#pragma endregion Implement
+}
+#endif
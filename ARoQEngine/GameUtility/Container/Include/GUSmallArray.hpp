@@ -0,0 +1,656 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GUSmallArray.hpp
+///             @brief  Dynamic array with the inline storage.
+///                     Up to InlineCapacity elements are stored in the object itself,
+///                     and the heap is allocated only when the size exceeds InlineCapacity.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GU_SMALL_ARRAY_HPP
+#define GU_SMALL_ARRAY_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include "GameUtility/Base/Include/GUTypeCast.hpp"
+#include "GameUtility/Memory/Include/GUMemory.hpp"
+#include "GameUtility/Container/Include/GUInitializerList.hpp"
+#include "GameUtility/Container/Private/Iterator/Include/GUIteratorIncludes.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gu
+{
+	/****************************************************************************
+	*				  			   SmallArray
+	*************************************************************************//**
+	*  @class     SmallArray
+	*  @brief     Dynamic array which does not allocate the heap memory while Size() <= InlineCapacity.
+	*             Use it for the short lived or usually small arrays (ex. barrier batches, child lists).
+	*             The interface is the same as DynamicArray.
+	*             Note : Data() points to the inline buffer, so the pointer and the iterators are
+	*                    invalidated by the move of the array itself (unlike DynamicArray).
+	*****************************************************************************/
+	template<class ElementType, uint64 InlineCapacity>
+	class SmallArray
+	{
+		static_assert(InlineCapacity > 0, "InlineCapacity must be greater than 0. Use DynamicArray instead.");
+
+	public:
+		static constexpr uint64 INDEX_NONE = static_cast<uint64>(-1);
+
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/*----------------------------------------------------------------------
+		*  @brief : Change the size.
+		*           size <= Size() : do nothing
+		*           size >  Size() : construct the new elements by copying defaultElement
+		/*----------------------------------------------------------------------*/
+		void Resize(const uint64 size, const ElementType& defaultElement = ElementType());
+
+		/*----------------------------------------------------------------------
+		*  @brief : Allocate the memory without calling the constructors.
+		*           Nothing happens while capacity <= InlineCapacity.
+		/*----------------------------------------------------------------------*/
+		void Reserve(const uint64 capacity);
+
+		/*----------------------------------------------------------------------
+		*  @brief : Call the destructors and set the size to 0. The capacity is kept.
+		/*----------------------------------------------------------------------*/
+		void Clear();
+
+		/*----------------------------------------------------------------------
+		*  @brief : Shrink the heap memory to the size.
+		*           The elements go back to the inline buffer when Size() <= InlineCapacity.
+		/*----------------------------------------------------------------------*/
+		void ShrinkToFit();
+
+		/*----------------------------------------------------------------------
+		*  @brief : Add the element to the back. The element may be the one in this array.
+		/*----------------------------------------------------------------------*/
+		void Push(const ElementType& element) { EmplaceBack(element); }
+		void Push(      ElementType&& element) { EmplaceBack(type::Forward<ElementType>(element)); }
+
+		/*----------------------------------------------------------------------
+		*  @brief : Construct the element in place at the back and return it.
+		/*----------------------------------------------------------------------*/
+		template<class... Arguments>
+		ElementType& EmplaceBack(Arguments&&... arguments)
+		{
+			if (_size < _capacity)
+			{
+				ElementType* element = new (&_data[_size]) ElementType(type::Forward<Arguments>(arguments)...);
+				++_size;
+				return *element;
+			}
+			return EmplaceBackWithGrowth(type::Forward<Arguments>(arguments)...);
+		}
+
+		/*----------------------------------------------------------------------
+		*  @brief : Destroy the last element.
+		/*----------------------------------------------------------------------*/
+		void Pop();
+
+		/*----------------------------------------------------------------------
+		*  @brief : Return true if the element is in the array.
+		/*----------------------------------------------------------------------*/
+		bool Contains(const ElementType& element) const { return FindFromBegin(element) != INDEX_NONE; }
+
+		/*----------------------------------------------------------------------
+		*  @brief : Return the first / last index of the element, or INDEX_NONE.
+		/*----------------------------------------------------------------------*/
+		uint64 FindFromBegin(const ElementType& element) const;
+
+		uint64 FindFromEnd(const ElementType& element) const;
+
+		/*----------------------------------------------------------------------
+		*  @brief : Remove the elements and fill the gap. (memmove for the trivially relocatable type)
+		/*----------------------------------------------------------------------*/
+		void RemoveAt(const uint64 index, const uint64 removeCount = 1);
+
+		/*----------------------------------------------------------------------
+		*  @brief : Remove the first matched element.
+		/*----------------------------------------------------------------------*/
+		void Remove(const ElementType& element)
+		{
+			const auto index = FindFromBegin(element);
+			if (index != INDEX_NONE)
+			{
+				RemoveAt(index, 1);
+			}
+		}
+
+		/*----------------------------------------------------------------------
+		*  @brief : Remove the element without keeping the order (the last element fills the gap).
+		/*----------------------------------------------------------------------*/
+		void RemoveAtSwap(const uint64 index);
+
+		/*----------------------------------------------------------------------
+		*  @brief : Remove all matched elements and return the removed count.
+		/*----------------------------------------------------------------------*/
+		uint64 RemoveAll(const ElementType& element);
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		__forceinline       ElementType* Data()       { return _data; }
+		__forceinline const ElementType* Data() const { return _data; }
+
+		__forceinline       ElementType& Front()       { return _data[0]; }
+		__forceinline const ElementType& Front() const { return _data[0]; }
+
+		__forceinline       ElementType& Back()       { return _data[_size - 1]; }
+		__forceinline const ElementType& Back() const { return _data[_size - 1]; }
+
+		__forceinline bool IsEmpty() const { return _size == 0; }
+
+		__forceinline uint64 Size() const { return _size; }
+
+		__forceinline uint64 Capacity() const { return _capacity; }
+
+		__forceinline static constexpr uint64 GetInlineCapacity() { return InlineCapacity; }
+
+		__forceinline static constexpr uint32 ByteOfElement() { return sizeof(ElementType); }
+
+		/* @brief : Return true while the elements are stored in the inline buffer (no heap memory)*/
+		__forceinline bool IsInline() const { return _data == InlineData(); }
+
+		__forceinline bool InRange(const uint64 index) const { return index < _size; }
+
+		__forceinline void CheckRange(const uint64 index) const
+		{
+			Checkf(index < _size, "index is out of range. \n");
+		}
+
+		__forceinline       ElementType& At(const uint64 index)       { CheckRange(index); return _data[index]; }
+		__forceinline const ElementType& At(const uint64 index) const { CheckRange(index); return _data[index]; }
+
+#pragma region Iterator Function
+		Iterator<ElementType>             begin ()       { return Iterator<ElementType>            (_data); }
+		ConstIterator<ElementType>        begin () const { return ConstIterator<ElementType>       (_data); }
+		Iterator<ElementType>             end   ()       { return Iterator<ElementType>            (_data + _size); }
+		ConstIterator<ElementType>        end   () const { return ConstIterator<ElementType>       (_data + _size); }
+		ReverseIterator<ElementType>      rbegin()       { return ReverseIterator<ElementType>     (_data + _size); }
+		ReverseConstIterator<ElementType> rbegin() const { return ReverseConstIterator<ElementType>(_data + _size); }
+#pragma endregion Iterator Function
+
+#pragma region Operator Function
+		// No range check. Use At for the range check.
+		__forceinline       ElementType& operator[](const uint64 index)       { return _data[index]; }
+		__forceinline const ElementType& operator[](const uint64 index) const { return _data[index]; }
+
+		SmallArray& operator=(std::initializer_list<ElementType> list)
+		{
+			Clear();
+			CopyFrom(list.begin(), list.size());
+			return *this;
+		}
+
+		SmallArray& operator=(const SmallArray& other)
+		{
+			if (this != &other)
+			{
+				Clear();
+				CopyFrom(other.Data(), other.Size());
+			}
+			return *this;
+		}
+
+		SmallArray& operator=(SmallArray&& other) noexcept
+		{
+			if (this != &other)
+			{
+				Release();
+				MoveFrom(other);
+			}
+			return *this;
+		}
+#pragma endregion Operator Function
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		SmallArray() : _data(InlineData()) {};
+
+		SmallArray(const ElementType* pointer, const uint64 count) : _data(InlineData()) { CopyFrom(pointer, count); }
+
+		explicit SmallArray(const uint64 size) : _data(InlineData()) { Resize(size); }
+
+		SmallArray(const uint64 size, const ElementType& defaultElement) : _data(InlineData()) { Resize(size, defaultElement); }
+
+		SmallArray(std::initializer_list<ElementType> list) : _data(InlineData()) { CopyFrom(list.begin(), list.size()); }
+
+		SmallArray(const SmallArray& other) : _data(InlineData()) { CopyFrom(other.Data(), other.Size()); }
+
+		SmallArray(SmallArray&& other) noexcept : _data(InlineData()) { MoveFrom(other); }
+
+		~SmallArray() { Release(); }
+
+	private:
+		/****************************************************************************
+		**                Private Function
+		*****************************************************************************/
+		__forceinline       ElementType* InlineData()       { return reinterpret_cast<ElementType*>(_inlineBuffer); }
+		__forceinline const ElementType* InlineData() const { return reinterpret_cast<const ElementType*>(_inlineBuffer); }
+
+		/* @brief : Copy construct the elements at the back*/
+		void CopyFrom(const ElementType* pointer, const uint64 count);
+
+		/* @brief : Take the heap memory, or relocate the inline elements. other becomes empty.*/
+		void MoveFrom(SmallArray& other);
+
+		/* @brief : Destroy the elements and free the heap memory. The array is back to the inline state.*/
+		void Release();
+
+		/* @brief : Move the elements to the new heap memory, or to the inline buffer when capacity <= InlineCapacity*/
+		void ChangeCapacity(const uint64 capacity);
+
+		template<class... Arguments>
+		ElementType& EmplaceBackWithGrowth(Arguments&&... arguments);
+
+		/****************************************************************************
+		**                Private Member Variables
+		*****************************************************************************/
+		/* @brief : Element count*/
+		uint64 _size = 0;
+
+		/* @brief : InlineCapacity or the heap capacity*/
+		uint64 _capacity = InlineCapacity;
+
+		/* @brief : _inlineBuffer or the heap memory*/
+		ElementType* _data = nullptr;
+
+		/* @brief : Storage of the first InlineCapacity elements (the constructors are not called)*/
+		alignas(ElementType) uint8 _inlineBuffer[sizeof(ElementType) * InlineCapacity];
+	};
+
+#pragma region Implement
+	/****************************************************************************
+	*                    Resize
+	*************************************************************************//**
+	*  @fn        void SmallArray<ElementType, InlineCapacity>::Resize(const uint64 size, const ElementType& defaultElement)
+	*
+	*  @brief     Change the size. The new elements are copy constructed from defaultElement.
+	*
+	*  @param[in] const uint64 size
+	*  @param[in] const ElementType& defaultElement
+	*
+	*  @return    void
+	*****************************************************************************/
+	template<class ElementType, uint64 InlineCapacity>
+	void SmallArray<ElementType, InlineCapacity>::Resize(const uint64 size, const ElementType& defaultElement)
+	{
+		if (size <= _size) { return; }
+
+		Reserve(size);
+
+		for (uint64 i = _size; i < size; ++i)
+		{
+			new (&_data[i]) ElementType(defaultElement);
+		}
+		_size = size;
+	}
+
+	/****************************************************************************
+	*                    Reserve
+	*************************************************************************//**
+	*  @fn        void SmallArray<ElementType, InlineCapacity>::Reserve(const uint64 capacity)
+	*
+	*  @brief     Allocate the heap memory when capacity exceeds the current capacity.
+	*
+	*  @param[in] const uint64 capacity (element count)
+	*
+	*  @return    void
+	*****************************************************************************/
+	template<class ElementType, uint64 InlineCapacity>
+	void SmallArray<ElementType, InlineCapacity>::Reserve(const uint64 capacity)
+	{
+		if (capacity <= _capacity) { return; }
+
+		ChangeCapacity(capacity);
+	}
+
+	/****************************************************************************
+	*                    Clear
+	*************************************************************************//**
+	*  @fn        void SmallArray<ElementType, InlineCapacity>::Clear()
+	*
+	*  @brief     Call the destructors and set the size to 0. The capacity is kept.
+	*
+	*  @param[in] void
+	*
+	*  @return    void
+	*****************************************************************************/
+	template<class ElementType, uint64 InlineCapacity>
+	void SmallArray<ElementType, InlineCapacity>::Clear()
+	{
+		Memory::ForceExecuteDestructors(_data, _size);
+		_size = 0;
+	}
+
+	/****************************************************************************
+	*                    ShrinkToFit
+	*************************************************************************//**
+	*  @fn        void SmallArray<ElementType, InlineCapacity>::ShrinkToFit()
+	*
+	*  @brief     Shrink the heap memory to the size.
+	*             If the size is less than or equal to InlineCapacity, the heap memory is released.
+	*
+	*  @param[in] void
+	*
+	*  @return    void
+	*****************************************************************************/
+	template<class ElementType, uint64 InlineCapacity>
+	void SmallArray<ElementType, InlineCapacity>::ShrinkToFit()
+	{
+		if (IsInline() || _size == _capacity) { return; }
+
+		ChangeCapacity(_size);
+	}
+
+	/****************************************************************************
+	*                    Pop
+	*************************************************************************//**
+	*  @fn        void SmallArray<ElementType, InlineCapacity>::Pop()
+	*
+	*  @brief     Destroy the last element. The memory is not released.
+	*
+	*  @param[in] void
+	*
+	*  @return    void
+	*****************************************************************************/
+	template<class ElementType, uint64 InlineCapacity>
+	void SmallArray<ElementType, InlineCapacity>::Pop()
+	{
+		if (_size == 0) { return; }
+
+		Memory::ForceExecuteDestructors(&_data[_size - 1], 1);
+		_size--;
+	}
+
+	/****************************************************************************
+	*                    FindFromBegin
+	*************************************************************************//**
+	*  @fn        uint64 SmallArray<ElementType, InlineCapacity>::FindFromBegin(const ElementType& element) const
+	*
+	*  @brief     Return the first index of the element, or INDEX_NONE.
+	*
+	*  @param[in] const ElementType& element
+	*
+	*  @return    uint64
+	*****************************************************************************/
+	template<class ElementType, uint64 InlineCapacity>
+	uint64 SmallArray<ElementType, InlineCapacity>::FindFromBegin(const ElementType& element) const
+	{
+		for (uint64 i = 0; i < _size; ++i)
+		{
+			if (_data[i] == element) { return i; }
+		}
+		return INDEX_NONE;
+	}
+
+	/****************************************************************************
+	*                    FindFromEnd
+	*************************************************************************//**
+	*  @fn        uint64 SmallArray<ElementType, InlineCapacity>::FindFromEnd(const ElementType& element) const
+	*
+	*  @brief     Return the last index of the element, or INDEX_NONE.
+	*
+	*  @param[in] const ElementType& element
+	*
+	*  @return    uint64
+	*****************************************************************************/
+	template<class ElementType, uint64 InlineCapacity>
+	uint64 SmallArray<ElementType, InlineCapacity>::FindFromEnd(const ElementType& element) const
+	{
+		for (uint64 i = _size; i > 0; --i)
+		{
+			if (_data[i - 1] == element) { return i - 1; }
+		}
+		return INDEX_NONE;
+	}
+
+	/****************************************************************************
+	*                    RemoveAt
+	*************************************************************************//**
+	*  @fn        void SmallArray<ElementType, InlineCapacity>::RemoveAt(const uint64 index, const uint64 removeCount)
+	*
+	*  @brief     Remove the elements and fill the gap with the following elements.
+	*
+	*  @param[in] const uint64 index
+	*  @param[in] const uint64 removeCount
+	*
+	*  @return    void
+	*****************************************************************************/
+	template<class ElementType, uint64 InlineCapacity>
+	void SmallArray<ElementType, InlineCapacity>::RemoveAt(const uint64 index, const uint64 removeCount)
+	{
+		if (removeCount == 0)               { return; }
+		if (index + removeCount > _size)    { return; }
+
+		Memory::ForceExecuteDestructors(&_data[index], removeCount);
+		Memory::ForceExecuteRelocateConstructors(&_data[index], &_data[index + removeCount], _size - index - removeCount);
+		_size -= removeCount;
+	}
+
+	/****************************************************************************
+	*                    RemoveAtSwap
+	*************************************************************************//**
+	*  @fn        void SmallArray<ElementType, InlineCapacity>::RemoveAtSwap(const uint64 index)
+	*
+	*  @brief     Remove the element and move the last element to the index. (O(1), the order is not kept)
+	*
+	*  @param[in] const uint64 index
+	*
+	*  @return    void
+	*****************************************************************************/
+	template<class ElementType, uint64 InlineCapacity>
+	void SmallArray<ElementType, InlineCapacity>::RemoveAtSwap(const uint64 index)
+	{
+		if (index >= _size) { return; }
+
+		Memory::ForceExecuteDestructors(&_data[index], 1);
+		if (index != _size - 1)
+		{
+			Memory::ForceExecuteRelocateConstructors(&_data[index], &_data[_size - 1], 1);
+		}
+		_size--;
+	}
+
+	/****************************************************************************
+	*                    RemoveAll
+	*************************************************************************//**
+	*  @fn        uint64 SmallArray<ElementType, InlineCapacity>::RemoveAll(const ElementType& element)
+	*
+	*  @brief     Remove all matched elements in one pass.
+	*
+	*  @param[in] const ElementType& element
+	*
+	*  @return    uint64 removed count
+	*****************************************************************************/
+	template<class ElementType, uint64 InlineCapacity>
+	uint64 SmallArray<ElementType, InlineCapacity>::RemoveAll(const ElementType& element)
+	{
+		// element may refer into this array, so it is copied before the matched elements are destroyed or moved
+		const ElementType value = element;
+		uint64 writeIndex = 0;
+
+		for (uint64 readIndex = 0; readIndex < _size; ++readIndex)
+		{
+			if (_data[readIndex] == value)
+			{
+				Memory::ForceExecuteDestructors(&_data[readIndex], 1);
+			}
+			else
+			{
+				if (writeIndex != readIndex)
+				{
+					Memory::ForceExecuteRelocateConstructors(&_data[writeIndex], &_data[readIndex], 1);
+				}
+				++writeIndex;
+			}
+		}
+
+		const uint64 removeCount = _size - writeIndex;
+		_size = writeIndex;
+		return removeCount;
+	}
+
+	/****************************************************************************
+	*                    CopyFrom
+	*************************************************************************//**
+	*  @fn        void SmallArray<ElementType, InlineCapacity>::CopyFrom(const ElementType* pointer, const uint64 count)
+	*
+	*  @brief     Copy construct the elements at the back.
+	*
+	*  @param[in] const ElementType* pointer
+	*  @param[in] const uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	template<class ElementType, uint64 InlineCapacity>
+	void SmallArray<ElementType, InlineCapacity>::CopyFrom(const ElementType* pointer, const uint64 count)
+	{
+		if (pointer == nullptr || count == 0) { return; }
+
+		Reserve(_size + count);
+		Memory::ForceExecuteCopyConstructors(&_data[_size], pointer, count);
+		_size += count;
+	}
+
+	/****************************************************************************
+	*                    MoveFrom
+	*************************************************************************//**
+	*  @fn        void SmallArray<ElementType, InlineCapacity>::MoveFrom(SmallArray& other)
+	*
+	*  @brief     Take the heap memory of other, or relocate the inline elements of other.
+	*             This array must be empty and inline. other becomes empty and inline.
+	*
+	*  @param[in] SmallArray& other
+	*
+	*  @return    void
+	*****************************************************************************/
+	template<class ElementType, uint64 InlineCapacity>
+	void SmallArray<ElementType, InlineCapacity>::MoveFrom(SmallArray& other)
+	{
+		if (other.IsInline())
+		{
+			Memory::ForceExecuteRelocateConstructors(_data, other._data, other._size);
+			_size = other._size;
+		}
+		else
+		{
+			_data     = other._data;
+			_size     = other._size;
+			_capacity = other._capacity;
+
+			other._data     = other.InlineData();
+			other._capacity = InlineCapacity;
+		}
+		other._size = 0;
+	}
+
+	/****************************************************************************
+	*                    Release
+	*************************************************************************//**
+	*  @fn        void SmallArray<ElementType, InlineCapacity>::Release()
+	*
+	*  @brief     Destroy the elements and free the heap memory.
+	*
+	*  @param[in] void
+	*
+	*  @return    void
+	*****************************************************************************/
+	template<class ElementType, uint64 InlineCapacity>
+	void SmallArray<ElementType, InlineCapacity>::Release()
+	{
+		Memory::ForceExecuteDestructors(_data, _size);
+
+		if (!IsInline())
+		{
+			Memory::Free(_data);
+			_data     = InlineData();
+			_capacity = InlineCapacity;
+		}
+		_size = 0;
+	}
+
+	/****************************************************************************
+	*                    ChangeCapacity
+	*************************************************************************//**
+	*  @fn        void SmallArray<ElementType, InlineCapacity>::ChangeCapacity(const uint64 capacity)
+	*
+	*  @brief     Move the elements to the new heap memory, or back to the inline buffer
+	*             when capacity <= InlineCapacity.
+	*
+	*  @param[in] const uint64 capacity (greater than or equal to the size)
+	*
+	*  @return    void
+	*****************************************************************************/
+	template<class ElementType, uint64 InlineCapacity>
+	void SmallArray<ElementType, InlineCapacity>::ChangeCapacity(const uint64 capacity)
+	{
+		Check(capacity >= _size);
+
+		ElementType* oldData = _data;
+		const bool   isInline = IsInline();
+
+		if (capacity <= InlineCapacity)
+		{
+			if (isInline) { return; }
+
+			_data     = InlineData();
+			_capacity = InlineCapacity;
+		}
+		else
+		{
+			_data     = (ElementType*)Memory::Allocate(capacity * sizeof(ElementType));
+			_capacity = capacity;
+		}
+
+		Memory::ForceExecuteRelocateConstructors(_data, oldData, _size);
+
+		if (!isInline) { Memory::Free(oldData); }
+	}
+
+	/****************************************************************************
+	*                    EmplaceBackWithGrowth
+	*************************************************************************//**
+	*  @fn        ElementType& SmallArray<ElementType, InlineCapacity>::EmplaceBackWithGrowth(Arguments&&... arguments)
+	*
+	*  @brief     Double the capacity and add the element.
+	*             The element is constructed before moving the old elements,
+	*             because the arguments may refer to the element in this array.
+	*
+	*  @param[in] Arguments&&... arguments
+	*
+	*  @return    ElementType& added element
+	*****************************************************************************/
+	template<class ElementType, uint64 InlineCapacity>
+	template<class... Arguments>
+	ElementType& SmallArray<ElementType, InlineCapacity>::EmplaceBackWithGrowth(Arguments&&... arguments)
+	{
+		const uint64 newCapacity = _capacity * 2;
+		auto newData = (ElementType*)Memory::Allocate(newCapacity * sizeof(ElementType));
+
+		ElementType* element = new (&newData[_size]) ElementType(type::Forward<Arguments>(arguments)...);
+
+		Memory::ForceExecuteRelocateConstructors(newData, _data, _size);
+		if (!IsInline()) { Memory::Free(_data); }
+
+		_data     = newData;
+		_capacity = newCapacity;
+		++_size;
+		return *element;
+	}
+#pragma endregion Implement
+}
+#endif
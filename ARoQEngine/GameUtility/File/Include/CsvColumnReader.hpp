@@ -0,0 +1,230 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   CsvColumnReader.hpp
+///             @brief  Memory mapped, SIMD tokenized and multi threaded csv reader.
+///                     The whole file is parsed at once into the column arrays.
+///                     Use this reader for the large data tables instead of csv::CSVReader.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef CSV_COLUMN_READER_HPP
+#define CSV_COLUMN_READER_HPP
+//////////////////////////////////////////////////////////////////////////////////
+//                             HowTo
+//////////////////////////////////////////////////////////////////////////////////
+// csv::CSVColumnReader reader("Resources/Table.csv");
+// const auto hp   = reader.GetColumn<std::int32_t>("HP");      // typed bulk conversion
+// const auto name = reader.GetStringColumn("Name");            // unescaped strings
+// const auto raw  = reader.GetField(row, column);              // raw view into the mapped file
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "Csv.hpp"
+#include "MemoryMappedFile.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <functional>
+#include <type_traits>
+#include <limits>
+#include <cstdint>
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Template Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace csv
+{
+	/****************************************************************************
+	*				  			CSVColumnReaderDesc
+	*************************************************************************//**
+	*  @struct    CSVColumnReaderDesc
+	*  @brief     Parse setting
+	*****************************************************************************/
+	struct CSVColumnReaderDesc
+	{
+		char          Separator   = ',';
+		char          Quote       = '"';
+		bool          HasHeader   = true;
+		std::uint32_t ThreadCount = 0;        // 0 : std::thread::hardware_concurrency
+		std::uint64_t MinChunkByteSize = 1 << 20; // the file is not split into the chunk smaller than this
+	};
+
+	/****************************************************************************
+	*				  			CSVColumnReader
+	*************************************************************************//**
+	*  @class     CSVColumnReader
+	*  @brief     Columnar csv reader.
+	*             1. The file is memory mapped (no copy through ByteSourceBase).
+	*             2. Quote, separator and newline are found 64 bytes at a time with the SSE2 / AVX2 / NEON bitmask.
+	*             3. The file is split at quote safe row boundaries and each chunk is tokenized by the worker thread.
+	*             4. Typed numeric conversion is done column by column in parallel.
+	*             Empty lines are skipped. The quote escape follows RFC4180 (the quote in the quoted field is doubled).
+	*****************************************************************************/
+	class CSVColumnReader
+	{
+	public:
+		/*-------------------------------------------------------------------
+		-  Position of the field in the source data
+		---------------------------------------------------------------------*/
+		struct FieldSpan
+		{
+			std::uint64_t Offset = 0;
+			std::uint32_t Length = 0;
+		};
+
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Convert whole column to the arithmetic type. Leading / trailing spaces and the quote are ignored.*/
+		template<class T> requires std::is_arithmetic_v<T>
+		std::vector<T> GetColumn(const std::uint32_t columnIndex) const;
+
+		template<class T> requires std::is_arithmetic_v<T>
+		std::vector<T> GetColumn(const std::string& columnName) const { return GetColumn<T>(GetColumnIndex(columnName)); }
+
+		/* @brief : Unescaped string of the whole column*/
+		std::vector<std::string> GetStringColumn(const std::uint32_t columnIndex) const;
+
+		std::vector<std::string> GetStringColumn(const std::string& columnName) const { return GetStringColumn(GetColumnIndex(columnName)); }
+
+		/* @brief : Raw field (the quote is not removed). The view is valid while the reader is alive*/
+		std::string_view GetField(const std::uint64_t row, const std::uint32_t columnIndex) const;
+
+		/* @brief : Unescaped field*/
+		std::string GetString(const std::uint64_t row, const std::uint32_t columnIndex) const;
+
+		/* @brief : Throw error::MissingColumnInHeader if the column does not exist*/
+		std::uint32_t GetColumnIndex(const std::string& columnName) const;
+
+		bool HasColumn(const std::string& columnName) const;
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		std::uint64_t GetRowCount() const { return _rowCount; }
+
+		std::uint32_t GetColumnCount() const { return static_cast<std::uint32_t>(_columnNames.size()); }
+
+		const std::string& GetColumnName(const std::uint32_t columnIndex) const { return _columnNames[columnIndex]; }
+
+		const std::vector<FieldSpan>& GetFieldSpans(const std::uint32_t columnIndex) const { return _columns[columnIndex]; }
+
+		std::uint32_t GetUsedChunkCount() const { return _chunkCount; }
+
+		const char* GetTruncatedFileName() const { return _fileName.c_str(); }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		CSVColumnReader() = delete;
+
+		CSVColumnReader(const CSVColumnReader&) = delete;
+
+		CSVColumnReader& operator=(const CSVColumnReader&) = delete;
+
+		/* @brief : Memory map the file and parse*/
+		explicit CSVColumnReader(const std::string& fileName, const CSVColumnReaderDesc& desc = CSVColumnReaderDesc());
+
+		/* @brief : Parse the user buffer (not copied. The buffer must outlive the reader)*/
+		CSVColumnReader(const std::string& fileName, const char* dataBegin, const char* dataEnd, const CSVColumnReaderDesc& desc = CSVColumnReaderDesc());
+
+		~CSVColumnReader() = default;
+
+	private:
+		/****************************************************************************
+		**                Private Function
+		*****************************************************************************/
+		void Parse();
+
+		std::uint64_t ParseHeader(const std::uint64_t begin);
+
+		void ParallelFor(const std::uint32_t taskCount, const std::function<void(std::uint32_t)>& function) const;
+
+		void ConvertField(const std::uint64_t row, const std::uint32_t columnIndex, std::int32_t & value) const;
+		void ConvertField(const std::uint64_t row, const std::uint32_t columnIndex, std::uint32_t& value) const;
+		void ConvertField(const std::uint64_t row, const std::uint32_t columnIndex, std::int64_t & value) const;
+		void ConvertField(const std::uint64_t row, const std::uint32_t columnIndex, std::uint64_t& value) const;
+		void ConvertField(const std::uint64_t row, const std::uint32_t columnIndex, float        & value) const;
+		void ConvertField(const std::uint64_t row, const std::uint32_t columnIndex, double       & value) const;
+
+		/****************************************************************************
+		**                Private Member Variables
+		*****************************************************************************/
+		std::string _fileName = "";
+
+		CSVColumnReaderDesc _desc = {};
+
+		file::MemoryMappedFile _mappedFile;
+
+		const char*   _data = nullptr;
+		std::uint64_t _size = 0;
+
+		std::vector<std::string> _columnNames = {};
+
+		// _columns[columnIndex][row]
+		std::vector<std::vector<FieldSpan>> _columns = {};
+
+		std::uint64_t _rowCount = 0;
+
+		std::uint32_t _threadCount = 1;
+
+		std::uint32_t _chunkCount  = 1;
+
+		// line offset of the first data row (header and BOM)
+		std::uint32_t _firstDataLine = 1;
+	};
+
+#pragma region Implement
+	/****************************************************************************
+	*                       GetColumn
+	*************************************************************************//**
+	*  @fn        template<class T> std::vector<T> CSVColumnReader::GetColumn(const std::uint32_t columnIndex) const
+	*  @brief     Typed bulk conversion. The rows are split into the worker threads.
+	*  @param[in] const std::uint32_t columnIndex
+	*  @return    std::vector<T>
+	*****************************************************************************/
+	template<class T> requires std::is_arithmetic_v<T>
+	std::vector<T> CSVColumnReader::GetColumn(const std::uint32_t columnIndex) const
+	{
+		using ConvertType = std::conditional_t<std::is_floating_point_v<T>,
+			std::conditional_t<(sizeof(T) > sizeof(float)), double, float>,
+			std::conditional_t<std::is_signed_v<T>,
+				std::conditional_t<(sizeof(T) > 4), std::int64_t, std::int32_t>,
+				std::conditional_t<(sizeof(T) > 4), std::uint64_t, std::uint32_t>>>;
+
+		std::vector<T> result(_rowCount);
+
+		const std::uint64_t taskCount = (std::min<std::uint64_t>)(_threadCount, (_rowCount + 4095) / 4096);
+		if (taskCount == 0) { return result; }
+
+		ParallelFor(static_cast<std::uint32_t>(taskCount), [&](const std::uint32_t task)
+		{
+			const std::uint64_t begin = _rowCount * task / taskCount;
+			const std::uint64_t end   = _rowCount * (task + 1) / taskCount;
+			for (std::uint64_t row = begin; row < end; ++row)
+			{
+				ConvertType value = 0;
+				ConvertField(row, columnIndex, value);
+
+				if constexpr (std::is_integral_v<T> && sizeof(T) < sizeof(ConvertType))
+				{
+					if (value > static_cast<ConvertType>((std::numeric_limits<T>::max)()) || value < static_cast<ConvertType>((std::numeric_limits<T>::min)()))
+					{
+						error::IntergerOverflow err;
+						err.SetFileName(_fileName.c_str());
+						err.SetFileLine(static_cast<int>(row) + _firstDataLine);
+						err.SetColumnName(_columnNames[columnIndex].c_str());
+						throw err;
+					}
+				}
+				result[row] = static_cast<T>(value);
+			}
+		});
+		return result;
+	}
+#pragma endregion Implement
+}
+#endif
@@ -2,8 +2,9 @@
 ///             @file   Json.hpp
 ///             @brief  Json reader and writer:
 ///                     How To : Load -> std::map like Object->call["name"] or Array->call[index]-> Save etc
+///                     Large files : LoadInSitu / JsonMemoryArena / ParseSAX / JsonPullReader / LoadWithCache
 ///             @author Toide Yutaro (dependency : rapidjson)
-///             @date   2022_05_12  
+///             @date   2022_05_12
 //////////////////////////////////////////////////////////////////////////////////
 #pragma once
 #ifndef JSON_HPP
@@ -13,7 +14,13 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include "GameUtility/File/External/rapidjson/document.h"
+#include "GameUtility/File/External/rapidjson/memorystream.h"
+#include "GameUtility/File/Include/MemoryMappedFile.hpp"
 #include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <cstdint>
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
@@ -23,12 +30,71 @@
 //////////////////////////////////////////////////////////////////////////////////
 namespace json
 {
+	/****************************************************************************
+	*				  			JsonMemoryArena
+	*************************************************************************//**
+	*  @class     JsonMemoryArena
+	*  @brief     Reusable allocator for the json values.
+	*             The first chunk is the arena owned buffer, so the document fitting in the buffer does not call malloc.
+	*             On Reset, the buffer grows to the high water mark of the previous load.
+	*             Only one document can use the arena at a time (the arena is reset on every load).
+	*****************************************************************************/
+	class JsonMemoryArena
+	{
+	public:
+		using AllocatorType = rapidjson::MemoryPoolAllocator<rapidjson::CrtAllocator>;
+
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Release all values. The values allocated from the arena are invalid after this call*/
+		void Reset();
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		AllocatorType& GetAllocator() { return *_allocator; }
+
+		/* @brief : Used byte size of the current load*/
+		std::uint64_t GetUsedByteSize() const { return _allocator->Size(); }
+
+		/* @brief : Max used byte size through all loads*/
+		std::uint64_t GetHighWaterByteSize() const;
+
+		std::uint64_t GetBufferByteSize() const { return _buffer.size(); }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		explicit JsonMemoryArena(const std::uint64_t initialByteSize = 1 << 20);
+
+		JsonMemoryArena(const JsonMemoryArena&) = delete;
+
+		JsonMemoryArena& operator=(const JsonMemoryArena&) = delete;
+
+		~JsonMemoryArena() = default;
+
+	private:
+		/****************************************************************************
+		**                Private Member Variables
+		*****************************************************************************/
+		std::vector<std::uint8_t> _buffer = {};
+
+		// The document keeps the pointer to the allocator, so the object address must not change.
+		std::unique_ptr<AllocatorType> _allocator = nullptr;
+
+		std::uint64_t _highWaterByteSize = 0;
+	};
 
 	/****************************************************************************
 	*				  			JsonDocument
 	*************************************************************************//**
 	*  @class     JsonDocument
 	*  @brief     Document
+	*             Load         : the file is memory mapped and the strings are copied into the document.
+	*             LoadInSitu   : the file is read into the owned buffer and the strings point into the buffer.
+	*             LoadWithCache: the parsed document is stored as the binary file keyed by the content hash.
+	*             ParseSAX     : no DOM is built. The handler receives the rapidjson SAX events.
 	*****************************************************************************/
 	class JsonDocument
 	{
@@ -38,17 +104,53 @@ namespace json
 		*****************************************************************************/
 		bool   Load(const std::string& filePath);
 		void   Save(const std::string& filePath);
+
+		/* @brief : Parse the file in place (the strings are not copied)*/
+		bool   LoadInSitu(const std::string& filePath);
+
+		/* @brief : Parse the user buffer in place. The null terminated buffer is modified and must outlive the document.*/
+		bool   ParseInSitu(char* buffer);
+
+		/* @brief : Parse the text (the strings are copied)*/
+		bool   Parse(const char* text, const std::uint64_t length);
+
+		/* @brief : Use "<cacheDirectory>/<content hash>.jbin" if it exists, otherwise parse the text and write the cache*/
+		bool   LoadWithCache(const std::string& filePath, const std::string& cacheDirectory);
+
+		/* @brief : Compact binary representation of the document (used by LoadWithCache)*/
+		std::vector<std::uint8_t> SaveBinary(const std::uint64_t contentHash = 0) const;
+
+		/* @brief : Load the SaveBinary output. The strings point into the copied binary.*/
+		bool   LoadBinary(const std::uint8_t* data, const std::uint64_t byteSize, const std::uint64_t contentHash = 0);
+
+		/* @brief : Stream the file into the rapidjson SAX handler without building the DOM.*/
+		template<class Handler>
+		static bool ParseSAX(const std::string& filePath, Handler& handler);
+
+		/* @brief : 64 bit content hash used as the cache key*/
+		static std::uint64_t ComputeContentHash(const char* data, const std::uint64_t byteSize);
+
 		inline rapidjson::Document& Ref() { return _document; }
 
 		/****************************************************************************
 		**                Public Member Variables
 		*****************************************************************************/
-		
+		bool HasParseError() const { return _document.HasParseError(); }
+
+		/* @brief : Memory used by the values and the owned source buffer*/
+		std::uint64_t GetUsedMemoryByteSize();
+
+		/* @brief : True if the last LoadWithCache read the binary cache*/
+		bool IsLoadedFromCache() const { return _isLoadedFromCache; }
+
 		/****************************************************************************
 		**                Constructor and Destructor
 		*****************************************************************************/
 		JsonDocument();
 		explicit JsonDocument(const std::string& filePath);
+
+		/* @brief : Allocate the values from the arena. The arena must outlive the document.*/
+		explicit JsonDocument(JsonMemoryArena& arena);
 		~JsonDocument();
 
 		      rapidjson::Value& operator[](unsigned int index)       { return _document[index]; }
@@ -59,13 +161,137 @@ namespace json
 		/****************************************************************************
 		**                Protected Function
 		*****************************************************************************/
-		
+		/* @brief : Release the previous values before the next load*/
+		void ResetDocument();
+
 		/****************************************************************************
 		**                Protected Member Variables
 		*****************************************************************************/
 		rapidjson::Document _document;
+
+		JsonMemoryArena* _arena = nullptr;
+
+		// Referenced by the string values (in situ parse and binary cache)
+		std::vector<char> _buffer = {};
+
+		bool _isLoadedFromCache = false;
 	};
 
+	/****************************************************************************
+	*				  			JsonTokenType
+	*************************************************************************//**
+	*  @enum      JsonTokenType
+	*  @brief     Token kind of JsonPullReader
+	*****************************************************************************/
+	enum class JsonTokenType : std::uint8_t
+	{
+		None,
+		Null,
+		Bool,
+		Int64,
+		Uint64,
+		Double,
+		String,
+		Key,
+		StartObject,
+		EndObject,
+		StartArray,
+		EndArray
+	};
+
+	/****************************************************************************
+	*				  			JsonToken
+	*************************************************************************//**
+	*  @struct    JsonToken
+	*  @brief     String is valid until the next JsonPullReader::Next call.
+	*             Count is the member / element count of EndObject and EndArray.
+	*****************************************************************************/
+	struct JsonToken
+	{
+		JsonTokenType    Type   = JsonTokenType::None;
+		bool             Bool   = false;
+		std::int64_t     Int64  = 0;
+		std::uint64_t    Uint64 = 0;
+		double           Double = 0.0;
+		std::string_view String = {};
+		std::uint32_t    Count  = 0;
+	};
+
+	/****************************************************************************
+	*				  			JsonPullReader
+	*************************************************************************//**
+	*  @class     JsonPullReader
+	*  @brief     Pull parser over the memory mapped file (rapidjson iterative parsing).
+	*             The caller asks for one token at a time, so the huge array can be read without the DOM.
+	*****************************************************************************/
+	class JsonPullReader
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		bool Open(const std::string& filePath);
+
+		/* @brief : Read from the user buffer (not copied)*/
+		void Open(const char* text, const std::uint64_t length);
+
+		/* @brief : Return false at the end of the document or on the parse error*/
+		bool Next(JsonToken& token);
+
+		/* @brief : Skip the value starting at the current token (StartObject / StartArray skip the whole container)*/
+		bool SkipValue(const JsonToken& current);
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		bool HasParseError() const { return _reader.HasParseError(); }
+
+		std::uint64_t GetErrorOffset() const { return _reader.GetErrorOffset(); }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		JsonPullReader() = default;
+
+		JsonPullReader(const JsonPullReader&) = delete;
+
+		JsonPullReader& operator=(const JsonPullReader&) = delete;
+
+		~JsonPullReader() = default;
+
+	private:
+		/****************************************************************************
+		**                Private Member Variables
+		*****************************************************************************/
+		file::MemoryMappedFile _mappedFile;
+
+		std::unique_ptr<rapidjson::MemoryStream> _stream = nullptr;
+
+		rapidjson::Reader _reader;
+	};
+
+#pragma region Implement
+	/****************************************************************************
+	*                       ParseSAX
+	*************************************************************************//**
+	*  @fn        template<class Handler> bool JsonDocument::ParseSAX(const std::string& filePath, Handler& handler)
+	*  @brief     Stream the memory mapped file into the rapidjson SAX handler
+	*  @param[in] const std::string& filePath
+	*  @param[in] Handler& handler (rapidjson Handler concept)
+	*  @return    bool
+	*****************************************************************************/
+	template<class Handler>
+	bool JsonDocument::ParseSAX(const std::string& filePath, Handler& handler)
+	{
+		file::MemoryMappedFile file;
+		if (!file.Open(filePath)) { return false; }
+
+		rapidjson::MemoryStream stream(file.GetData() != nullptr ? file.GetData() : "", static_cast<size_t>(file.GetSize()));
+		rapidjson::EncodedInputStream<rapidjson::UTF8<>, rapidjson::MemoryStream> encodedStream(stream);
 
+		rapidjson::Reader reader;
+		return !reader.Parse(encodedStream, handler).IsError();
+	}
+#pragma endregion Implement
 }
-#endif
\ No newline at end of file
+#endif
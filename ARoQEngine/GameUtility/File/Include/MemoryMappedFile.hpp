@@ -0,0 +1,92 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   MemoryMappedFile.hpp
+///             @brief  Read only memory mapped file
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef MEMORY_MAPPED_FILE_HPP
+#define MEMORY_MAPPED_FILE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include <string>
+#include <cstdint>
+#include <utility>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Template Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace file
+{
+	/****************************************************************************
+	*				  			MemoryMappedFile
+	*************************************************************************//**
+	*  @class     MemoryMappedFile
+	*  @brief     Map the whole file into the address space (read only).
+	*             The file content is paged in on demand by the OS, so no copy to the user buffer is made.
+	*             Empty file is valid and returns nullptr data with the zero size.
+	*****************************************************************************/
+	class MemoryMappedFile
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Map the file. Return false if the file can not be opened.*/
+		bool Open(const std::string& filePath);
+
+		bool Open(const std::wstring& filePath);
+
+		/* @brief : Unmap the file and close the handle*/
+		void Close();
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		const char* GetData() const { return _data; }
+
+		std::uint64_t GetSize() const { return _size; }
+
+		bool IsOpen() const { return _isOpen; }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		MemoryMappedFile() = default;
+
+		MemoryMappedFile(const MemoryMappedFile&) = delete;
+
+		MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+		MemoryMappedFile(MemoryMappedFile&& other) noexcept { *this = std::move(other); }
+
+		MemoryMappedFile& operator=(MemoryMappedFile&& other) noexcept;
+
+		~MemoryMappedFile() { Close(); }
+
+	private:
+		/****************************************************************************
+		**                Private Function
+		*****************************************************************************/
+		bool MapOpenedFile();
+
+		/****************************************************************************
+		**                Private Member Variables
+		*****************************************************************************/
+		const char*   _data   = nullptr;
+		std::uint64_t _size   = 0;
+		bool          _isOpen = false;
+
+		// Platform handles (HANDLE on Windows, file descriptor otherwise)
+		void* _fileHandle    = nullptr;
+		void* _mappingHandle = nullptr;
+		int   _fileDescriptor = -1;
+	};
+}
+#endif
@@ -12,6 +12,7 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include <string>
+#include <cstdint>
 #include "GameUtility/Container/Include/GUStaticArray.hpp"
 
 //////////////////////////////////////////////////////////////////////////////////
@@ -23,6 +24,20 @@
 //////////////////////////////////////////////////////////////////////////////////
 namespace unicode
 {
+	/****************************************************************************
+	*				  			ConvertResult
+	*************************************************************************//**
+	*  @struct    ConvertResult
+	*  @brief     Result of the bulk conversion.
+	*             On failure, ReadCount is the position of the invalid sequence (or the first unit that did not fit in the output).
+	*****************************************************************************/
+	struct ConvertResult
+	{
+		bool          IsSucceeded  = false;
+		std::uint64_t ReadCount    = 0; // code units read from the source
+		std::uint64_t WrittenCount = 0; // code units written to the destination
+	};
+
 	std::wstring ToWString(const std::string& utf8String);
 	std::string  ToUtf8String(const std::wstring& wString);
 
@@ -47,7 +62,34 @@ namespace unicode
 	bool ConvertU32ToU8(const std::u32string& u32String, std::string& u8String);
 	bool ConvertU32ToU16(const std::u32string& u32String, std::u16string& u16String);
 
+	/*-------------------------------------------------------------------
+	-  Bulk conversion into the caller buffer (no allocation).
+	-  The input is validated (overlong form, surrogate code point, unpaired surrogate and out of range are rejected).
+	-  ASCII and the runs of the same sequence length are converted with SSE2 / SSSE3 / AVX2 / NEON.
+	---------------------------------------------------------------------*/
+	ConvertResult ConvertU8ToU16(const char*     u8String , const std::uint64_t length, char16_t* u16String, const std::uint64_t capacity);
+	ConvertResult ConvertU8ToU32(const char*     u8String , const std::uint64_t length, char32_t* u32String, const std::uint64_t capacity);
+	ConvertResult ConvertU16ToU8(const char16_t* u16String, const std::uint64_t length, char*     u8String , const std::uint64_t capacity);
+	ConvertResult ConvertU16ToU32(const char16_t* u16String, const std::uint64_t length, char32_t* u32String, const std::uint64_t capacity);
+	ConvertResult ConvertU32ToU8(const char32_t* u32String, const std::uint64_t length, char*     u8String , const std::uint64_t capacity);
+	ConvertResult ConvertU32ToU16(const char32_t* u32String, const std::uint64_t length, char16_t* u16String, const std::uint64_t capacity);
+
+	/*-------------------------------------------------------------------
+	-  Output length for sizing the buffer. The input is assumed to be valid (not validated).
+	---------------------------------------------------------------------*/
+	std::uint64_t GetU16LengthFromU8 (const char*     u8String , const std::uint64_t length);
+	std::uint64_t GetU32LengthFromU8 (const char*     u8String , const std::uint64_t length);
+	std::uint64_t GetU8LengthFromU16 (const char16_t* u16String, const std::uint64_t length);
+	std::uint64_t GetU32LengthFromU16(const char16_t* u16String, const std::uint64_t length);
+	std::uint64_t GetU8LengthFromU32 (const char32_t* u32String, const std::uint64_t length);
+	std::uint64_t GetU16LengthFromU32(const char32_t* u32String, const std::uint64_t length);
 
+	/*-------------------------------------------------------------------
+	-  Validation only
+	---------------------------------------------------------------------*/
+	bool IsValidU8 (const char*     u8String , const std::uint64_t length);
+	bool IsValidU16(const char16_t* u16String, const std::uint64_t length);
+	bool IsValidU32(const char32_t* u32String, const std::uint64_t length);
 
 }
 #endif
\ No newline at end of file
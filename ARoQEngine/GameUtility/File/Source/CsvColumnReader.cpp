@@ -0,0 +1,705 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   CsvColumnReader.cpp
+///             @brief  Memory mapped, SIMD tokenized and multi threaded csv reader.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/File/Include/CsvColumnReader.hpp"
+#include "GameUtility/Math/Private/Simd/Include/GMSimdMacros.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <exception>
+#ifndef CSV_IO_NO_THREAD
+#include <thread>
+#endif
+
+#if PLATFORM_CPU_INSTRUCTION_AVX2
+	#include <immintrin.h>
+#elif PLATFORM_CPU_INSTRUCTION_SSE2
+	#include <emmintrin.h>
+#elif PLATFORM_CPU_INSTRUCTION_NEON
+	#include <arm_neon.h>
+#endif
+
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace csv;
+
+namespace
+{
+	constexpr std::uint64_t BLOCK_SIZE = 64;
+
+	/*-------------------------------------------------------------------
+	-   Bit i is set when block[i] is the quote / separator / '\n'
+	---------------------------------------------------------------------*/
+	struct BlockMask
+	{
+		std::uint64_t Quote     = 0;
+		std::uint64_t Separator = 0;
+		std::uint64_t NewLine   = 0;
+	};
+
+	/****************************************************************************
+	*                       ClassifyBlock
+	*************************************************************************//**
+	*  @fn        BlockMask ClassifyBlock(const char* block, const char separator, const char quote)
+	*  @brief     Compare 64 bytes with the structural characters at once
+	*  @param[in] const char* block (64 bytes readable)
+	*  @param[in] const char separator
+	*  @param[in] const char quote
+	*  @return    BlockMask
+	*****************************************************************************/
+	inline BlockMask ClassifyBlock(const char* block, const char separator, const char quote)
+	{
+		BlockMask mask = {};
+#if PLATFORM_CPU_INSTRUCTION_AVX2
+		const __m256i quoteVector     = _mm256_set1_epi8(quote);
+		const __m256i separatorVector = _mm256_set1_epi8(separator);
+		const __m256i newLineVector   = _mm256_set1_epi8('\n');
+
+		for (std::uint64_t i = 0; i < 2; ++i)
+		{
+			const __m256i data  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 32 * i));
+			const auto    shift = 32 * i;
+			mask.Quote     |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(data, quoteVector))))     << shift;
+			mask.Separator |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(data, separatorVector)))) << shift;
+			mask.NewLine   |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(data, newLineVector))))   << shift;
+		}
+#elif PLATFORM_CPU_INSTRUCTION_SSE2
+		const __m128i quoteVector     = _mm_set1_epi8(quote);
+		const __m128i separatorVector = _mm_set1_epi8(separator);
+		const __m128i newLineVector   = _mm_set1_epi8('\n');
+
+		for (std::uint64_t i = 0; i < 4; ++i)
+		{
+			const __m128i data  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 16 * i));
+			const auto    shift = 16 * i;
+			mask.Quote     |= static_cast<std::uint64_t>(static_cast<std::uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(data, quoteVector))))     << shift;
+			mask.Separator |= static_cast<std::uint64_t>(static_cast<std::uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(data, separatorVector)))) << shift;
+			mask.NewLine   |= static_cast<std::uint64_t>(static_cast<std::uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(data, newLineVector))))   << shift;
+		}
+#elif PLATFORM_CPU_INSTRUCTION_NEON && (defined(__aarch64__) || defined(_M_ARM64))
+		// NEON has no movemask : each lane keeps its own bit weight and the halves are summed horizontally.
+		static const std::uint8_t bitWeight[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+		const uint8x16_t weight = vld1q_u8(bitWeight);
+
+		const auto MoveMask = [&weight](const uint8x16_t compare) -> std::uint64_t
+		{
+			const uint8x16_t masked = vandq_u8(compare, weight);
+			return static_cast<std::uint64_t>(vaddv_u8(vget_low_u8(masked))) | (static_cast<std::uint64_t>(vaddv_u8(vget_high_u8(masked))) << 8);
+		};
+
+		for (std::uint64_t i = 0; i < 4; ++i)
+		{
+			const uint8x16_t data  = vld1q_u8(reinterpret_cast<const std::uint8_t*>(block + 16 * i));
+			const auto       shift = 16 * i;
+			mask.Quote     |= MoveMask(vceqq_u8(data, vdupq_n_u8(static_cast<std::uint8_t>(quote))))     << shift;
+			mask.Separator |= MoveMask(vceqq_u8(data, vdupq_n_u8(static_cast<std::uint8_t>(separator)))) << shift;
+			mask.NewLine   |= MoveMask(vceqq_u8(data, vdupq_n_u8(static_cast<std::uint8_t>('\n'))))      << shift;
+		}
+#else
+		for (std::uint64_t i = 0; i < BLOCK_SIZE; ++i)
+		{
+			const std::uint64_t bit = 1ull << i;
+			if      (block[i] == quote)     { mask.Quote     |= bit; }
+			else if (block[i] == separator) { mask.Separator |= bit; }
+			else if (block[i] == '\n')      { mask.NewLine   |= bit; }
+		}
+#endif
+		return mask;
+	}
+
+	/*-------------------------------------------------------------------
+	-   Bit i = XOR of bits [0, i]. Marks the bytes inside the quote.
+	---------------------------------------------------------------------*/
+	inline std::uint64_t PrefixXor(std::uint64_t bits)
+	{
+		bits ^= bits << 1;
+		bits ^= bits << 2;
+		bits ^= bits << 4;
+		bits ^= bits << 8;
+		bits ^= bits << 16;
+		bits ^= bits << 32;
+		return bits;
+	}
+
+	inline std::uint32_t CountTrailingZeros(const std::uint64_t bits)
+	{
+#if defined(_MSC_VER)
+		unsigned long index = 0;
+		_BitScanForward64(&index, bits);
+		return static_cast<std::uint32_t>(index);
+#else
+		return static_cast<std::uint32_t>(__builtin_ctzll(bits));
+#endif
+	}
+
+	inline std::uint32_t PopCount(const std::uint64_t bits)
+	{
+#if defined(_MSC_VER) && PLATFORM_CPU_X86_FAMILY
+		return static_cast<std::uint32_t>(__popcnt64(bits));
+#elif defined(_MSC_VER)
+		std::uint64_t value = bits; std::uint32_t count = 0;
+		while (value) { value &= value - 1; ++count; }
+		return count;
+#else
+		return static_cast<std::uint32_t>(__builtin_popcountll(bits));
+#endif
+	}
+
+	/*-------------------------------------------------------------------
+	-   Load the block. The tail is copied into the zero padded buffer.
+	---------------------------------------------------------------------*/
+	inline const char* LoadBlock(const char* data, const std::uint64_t position, const std::uint64_t end, char (&padding)[BLOCK_SIZE], std::uint64_t& validMask)
+	{
+		const std::uint64_t remain = end - position;
+		if (remain >= BLOCK_SIZE)
+		{
+			validMask = ~0ull;
+			return data + position;
+		}
+
+		std::memset(padding, 0, BLOCK_SIZE);
+		std::memcpy(padding, data + position, remain);
+		validMask = (1ull << remain) - 1;
+		return padding;
+	}
+
+	std::string_view Trim(std::string_view field)
+	{
+		while (!field.empty() && (field.front() == ' ' || field.front() == '\t')) { field.remove_prefix(1); }
+		while (!field.empty() && (field.back()  == ' ' || field.back()  == '\t' || field.back() == '\r')) { field.remove_suffix(1); }
+		return field;
+	}
+
+	std::string Unescape(std::string_view field, const char quote)
+	{
+		field = Trim(field);
+		if (field.size() < 2 || field.front() != quote || field.back() != quote) { return std::string(field); }
+
+		field = field.substr(1, field.size() - 2);
+
+		std::string result;
+		result.reserve(field.size());
+		for (std::uint64_t i = 0; i < field.size(); ++i)
+		{
+			if (field[i] == quote && i + 1 < field.size() && field[i + 1] == quote) { ++i; }
+			result.push_back(field[i]);
+		}
+		return result;
+	}
+
+	/*-------------------------------------------------------------------
+	-   Error raised in the worker thread. Rethrown by the main thread with the global line number
+	---------------------------------------------------------------------*/
+	enum class ChunkErrorType
+	{
+		None,
+		TooFewColumns,
+		TooManyColumns,
+		EscapedStringNotClosed
+	};
+
+	struct ChunkResult
+	{
+		std::vector<std::vector<CSVColumnReader::FieldSpan>> Columns = {};
+		std::uint64_t  RowCount  = 0;
+		ChunkErrorType Error     = ChunkErrorType::None;
+		std::uint64_t  ErrorRow  = 0;
+	};
+
+	/****************************************************************************
+	*                       TokenizeChunk
+	*************************************************************************//**
+	*  @fn        void TokenizeChunk(const char* data, std::uint64_t begin, std::uint64_t end, ...)
+	*  @brief     Tokenize [begin, end). begin must be the row head outside the quote.
+	*  @param[in] const char* data
+	*  @param[in] const std::uint64_t begin
+	*  @param[in] const std::uint64_t end
+	*  @param[in] const std::uint32_t columnCount
+	*  @param[in] const char separator
+	*  @param[in] const char quote
+	*  @param[out]ChunkResult& result
+	*  @return    void
+	*****************************************************************************/
+	void TokenizeChunk(const char* data, const std::uint64_t begin, const std::uint64_t end, const std::uint32_t columnCount,
+		const char separator, const char quote, ChunkResult& result)
+	{
+		result.Columns.resize(columnCount);
+		for (auto& column : result.Columns) { column.reserve((end - begin) / (8 * static_cast<std::uint64_t>(columnCount)) + 1); }
+
+		std::uint64_t fieldBegin  = begin;
+		std::uint32_t columnIndex = 0;
+		std::uint64_t insideCarry = 0; // all bits set while the previous block ended inside the quote
+
+		const auto PushField = [&](const std::uint64_t fieldEnd) -> bool
+		{
+			if (columnIndex >= columnCount) { return false; }
+			result.Columns[columnIndex++].push_back({ fieldBegin, static_cast<std::uint32_t>(fieldEnd - fieldBegin) });
+			fieldBegin = fieldEnd + 1;
+			return true;
+		};
+
+		const auto FinishRow = [&](const std::uint64_t fieldEnd) -> bool
+		{
+			// Remove '\r' of the CRLF
+			const std::uint64_t trimmedEnd = (fieldEnd > fieldBegin && data[fieldEnd - 1] == '\r') ? fieldEnd - 1 : fieldEnd;
+
+			// Empty line
+			if (columnIndex == 0 && trimmedEnd == fieldBegin)
+			{
+				fieldBegin = fieldEnd + 1;
+				return true;
+			}
+
+			if (!PushField(trimmedEnd)) { result.Error = ChunkErrorType::TooManyColumns; result.ErrorRow = result.RowCount; return false; }
+			fieldBegin = fieldEnd + 1;
+
+			if (columnIndex < columnCount) { result.Error = ChunkErrorType::TooFewColumns; result.ErrorRow = result.RowCount; return false; }
+
+			columnIndex = 0;
+			++result.RowCount;
+			return true;
+		};
+
+		char padding[BLOCK_SIZE] = {};
+		for (std::uint64_t position = begin; position < end; position += BLOCK_SIZE)
+		{
+			std::uint64_t validMask = 0;
+			const char*   block     = LoadBlock(data, position, end, padding, validMask);
+			const auto    mask      = ClassifyBlock(block, separator, quote);
+
+			const std::uint64_t inside = PrefixXor(mask.Quote & validMask) ^ insideCarry;
+			insideCarry = 0ull - (inside >> 63);
+
+			std::uint64_t structural = (mask.Separator | mask.NewLine) & ~inside & validMask;
+			while (structural)
+			{
+				const std::uint32_t bit      = CountTrailingZeros(structural);
+				const std::uint64_t fieldEnd = position + bit;
+				structural &= structural - 1;
+
+				if ((mask.NewLine >> bit) & 1)
+				{
+					if (!FinishRow(fieldEnd)) { return; }
+				}
+				else if (!PushField(fieldEnd))
+				{
+					result.Error = ChunkErrorType::TooManyColumns; result.ErrorRow = result.RowCount; return;
+				}
+			}
+		}
+
+		if (insideCarry) { result.Error = ChunkErrorType::EscapedStringNotClosed; result.ErrorRow = result.RowCount; return; }
+
+		// Last line without the newline
+		if (fieldBegin < end || columnIndex > 0) { FinishRow(end); }
+	}
+
+	/*-------------------------------------------------------------------
+	-   Number of quotes in [begin, end)
+	---------------------------------------------------------------------*/
+	std::uint64_t CountQuotes(const char* data, const std::uint64_t begin, const std::uint64_t end, const char separator, const char quote)
+	{
+		std::uint64_t count = 0;
+		char padding[BLOCK_SIZE] = {};
+		for (std::uint64_t position = begin; position < end; position += BLOCK_SIZE)
+		{
+			std::uint64_t validMask = 0;
+			const char*   block     = LoadBlock(data, position, end, padding, validMask);
+			count += PopCount(ClassifyBlock(block, separator, quote).Quote & validMask);
+		}
+		return count;
+	}
+
+	/*-------------------------------------------------------------------
+	-   Next row head after position. isInsideQuote is the quote state at position.
+	---------------------------------------------------------------------*/
+	std::uint64_t FindRowHead(const char* data, std::uint64_t position, const std::uint64_t end, bool isInsideQuote, const char quote)
+	{
+		for (; position < end; ++position)
+		{
+			if      (data[position] == quote)                 { isInsideQuote = !isInsideQuote; }
+			else if (data[position] == '\n' && !isInsideQuote) { return position + 1; }
+		}
+		return end;
+	}
+}
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+CSVColumnReader::CSVColumnReader(const std::string& fileName, const CSVColumnReaderDesc& desc)
+	: _fileName(fileName), _desc(desc)
+{
+	if (!_mappedFile.Open(fileName))
+	{
+		error::CannotOpenFile err;
+		err.SetErrorNo(errno);
+		err.SetFileName(fileName.c_str());
+		throw err;
+	}
+
+	_data = _mappedFile.GetData();
+	_size = _mappedFile.GetSize();
+	Parse();
+}
+
+CSVColumnReader::CSVColumnReader(const std::string& fileName, const char* dataBegin, const char* dataEnd, const CSVColumnReaderDesc& desc)
+	: _fileName(fileName), _desc(desc), _data(dataBegin), _size(static_cast<std::uint64_t>(dataEnd - dataBegin))
+{
+	Parse();
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Main Function
+/****************************************************************************
+*							Parse
+*************************************************************************//**
+*  @fn        void CSVColumnReader::Parse()
+*  @brief     1. Count the quotes of each chunk in parallel to know the quote state at the chunk head.
+*             2. Move the chunk head to the next row head outside the quote.
+*             3. Tokenize each chunk in parallel.
+*             4. Concatenate the chunk columns.
+*  @param[in] void
+*  @return    void
+*****************************************************************************/
+void CSVColumnReader::Parse()
+{
+#ifdef CSV_IO_NO_THREAD
+	_threadCount = 1;
+#else
+	_threadCount = _desc.ThreadCount != 0 ? _desc.ThreadCount : (std::max)(1u, std::thread::hardware_concurrency());
+#endif
+
+	/*-------------------------------------------------------------------
+	-                 Ignore UTF-8 BOM and read the header
+	---------------------------------------------------------------------*/
+	std::uint64_t begin = 0;
+	if (_size >= 3 && _data[0] == '\xEF' && _data[1] == '\xBB' && _data[2] == '\xBF') { begin = 3; }
+
+	begin = ParseHeader(begin);
+	if (_columnNames.empty()) { return; }
+
+	/*-------------------------------------------------------------------
+	-                 Split the data into the chunks
+	---------------------------------------------------------------------*/
+	const std::uint64_t dataSize   = _size - begin;
+	const std::uint64_t maxChunk   = (std::max<std::uint64_t>)(1, dataSize / (std::max<std::uint64_t>)(1, _desc.MinChunkByteSize));
+	_chunkCount = static_cast<std::uint32_t>((std::min<std::uint64_t>)(_threadCount, maxChunk));
+
+	std::vector<std::uint64_t> chunkHeads(_chunkCount + 1);
+	for (std::uint32_t i = 0; i <= _chunkCount; ++i) { chunkHeads[i] = begin + dataSize * i / _chunkCount; }
+
+	// Quote parity at each nominal chunk head
+	std::vector<std::uint64_t> quoteCounts(_chunkCount, 0);
+	ParallelFor(_chunkCount, [&](const std::uint32_t chunk)
+	{
+		quoteCounts[chunk] = CountQuotes(_data, chunkHeads[chunk], chunkHeads[chunk + 1], _desc.Separator, _desc.Quote);
+	});
+
+	std::uint64_t quoteParity = 0;
+	for (std::uint32_t i = 1; i < _chunkCount; ++i)
+	{
+		quoteParity  += quoteCounts[i - 1];
+		chunkHeads[i] = FindRowHead(_data, chunkHeads[i], _size, (quoteParity & 1) != 0, _desc.Quote);
+		// quote count of the skipped bytes belongs to the previous chunk
+		chunkHeads[i] = (std::max)(chunkHeads[i], chunkHeads[i - 1]);
+	}
+	// Parity is recomputed from the adjusted heads in TokenizeChunk, so only the row head matters here.
+
+	/*-------------------------------------------------------------------
+	-                 Tokenize
+	---------------------------------------------------------------------*/
+	const auto columnCount = GetColumnCount();
+	std::vector<ChunkResult> chunkResults(_chunkCount);
+	ParallelFor(_chunkCount, [&](const std::uint32_t chunk)
+	{
+		TokenizeChunk(_data, chunkHeads[chunk], chunkHeads[chunk + 1], columnCount, _desc.Separator, _desc.Quote, chunkResults[chunk]);
+	});
+
+	/*-------------------------------------------------------------------
+	-                 Error check (report the first error in the file order)
+	---------------------------------------------------------------------*/
+	std::vector<std::uint64_t> rowOffsets(_chunkCount + 1, 0);
+	for (std::uint32_t i = 0; i < _chunkCount; ++i)
+	{
+		const auto& chunk = chunkResults[i];
+		const int   line  = static_cast<int>(rowOffsets[i] + chunk.ErrorRow) + _firstDataLine;
+		switch (chunk.Error)
+		{
+			case ChunkErrorType::TooFewColumns:          { error::TooFewColumns          err; err.SetFileName(_fileName.c_str()); err.SetFileLine(line); throw err; }
+			case ChunkErrorType::TooManyColumns:         { error::TooManyColumns         err; err.SetFileName(_fileName.c_str()); err.SetFileLine(line); throw err; }
+			case ChunkErrorType::EscapedStringNotClosed: { error::EscapedStringNotClosed err; err.SetFileName(_fileName.c_str()); err.SetFileLine(line); throw err; }
+			default: break;
+		}
+		rowOffsets[i + 1] = rowOffsets[i] + chunk.RowCount;
+	}
+	_rowCount = rowOffsets[_chunkCount];
+
+	/*-------------------------------------------------------------------
+	-                 Concatenate the columns
+	---------------------------------------------------------------------*/
+	_columns.resize(columnCount);
+	if (_chunkCount == 1)
+	{
+		_columns = std::move(chunkResults[0].Columns);
+		return;
+	}
+
+	for (auto& column : _columns) { column.resize(_rowCount); }
+	ParallelFor(_chunkCount, [&](const std::uint32_t chunk)
+	{
+		for (std::uint32_t column = 0; column < columnCount; ++column)
+		{
+			const auto& source = chunkResults[chunk].Columns[column];
+			if (source.empty()) { continue; }
+			std::memcpy(&_columns[column][rowOffsets[chunk]], source.data(), source.size() * sizeof(FieldSpan));
+		}
+	});
+}
+
+/****************************************************************************
+*							ParseHeader
+*************************************************************************//**
+*  @fn        std::uint64_t CSVColumnReader::ParseHeader(const std::uint64_t begin)
+*  @brief     Read the column names from the first non empty line.
+*             Without the header, only the column count is taken from the first line ("col1", "col2", ...).
+*  @param[in] const std::uint64_t begin
+*  @return    std::uint64_t head of the data rows
+*****************************************************************************/
+std::uint64_t CSVColumnReader::ParseHeader(std::uint64_t begin)
+{
+	// Skip the empty lines before the header
+	while (begin < _size && (_data[begin] == '\n' || _data[begin] == '\r'))
+	{
+		if (_data[begin] == '\n') { ++_firstDataLine; }
+		++begin;
+	}
+
+	if (begin >= _size)
+	{
+		if (_desc.HasHeader)
+		{
+			error::HeaderMissing err;
+			err.SetFileName(_fileName.c_str());
+			throw err;
+		}
+		return begin;
+	}
+
+	const std::uint64_t lineEnd = FindRowHead(_data, begin, _size, false, _desc.Quote);
+
+	/*-------------------------------------------------------------------
+	-                 Split the first line
+	---------------------------------------------------------------------*/
+	std::vector<std::string> names = {};
+	bool          isInsideQuote = false;
+	std::uint64_t fieldBegin    = begin;
+	for (std::uint64_t i = begin; i <= lineEnd; ++i)
+	{
+		const bool isLineEnd = (i == lineEnd) || (_data[i] == '\n' && !isInsideQuote);
+		if (i < lineEnd && _data[i] == _desc.Quote) { isInsideQuote = !isInsideQuote; continue; }
+		if (!isLineEnd && !(_data[i] == _desc.Separator && !isInsideQuote)) { continue; }
+
+		names.push_back(Unescape(std::string_view(_data + fieldBegin, i - fieldBegin), _desc.Quote));
+		fieldBegin = i + 1;
+		if (isLineEnd) { break; }
+	}
+
+	_columnNames.resize(names.size());
+	for (std::uint64_t i = 0; i < names.size(); ++i)
+	{
+		_columnNames[i] = _desc.HasHeader ? names[i] : "col" + std::to_string(i + 1);
+
+		for (std::uint64_t j = 0; j < i && _desc.HasHeader; ++j)
+		{
+			if (_columnNames[j] != _columnNames[i]) { continue; }
+
+			error::DuplicatedColumnInHeader err;
+			err.SetFileName(_fileName.c_str());
+			err.SetColumnName(_columnNames[i].c_str());
+			throw err;
+		}
+	}
+
+	if (!_desc.HasHeader) { return begin; }
+
+	++_firstDataLine;
+	return lineEnd;
+}
+
+/****************************************************************************
+*							ParallelFor
+*************************************************************************//**
+*  @fn        void CSVColumnReader::ParallelFor(const std::uint32_t taskCount, const std::function<void(std::uint32_t)>& function) const
+*  @brief     Run tasks on the worker threads (task 0 runs on the calling thread).
+*             The first exception is rethrown after all tasks finished.
+*  @param[in] const std::uint32_t taskCount
+*  @param[in] const std::function<void(std::uint32_t)>& function
+*  @return    void
+*****************************************************************************/
+void CSVColumnReader::ParallelFor(const std::uint32_t taskCount, const std::function<void(std::uint32_t)>& function) const
+{
+	std::vector<std::exception_ptr> errors(taskCount);
+
+	const auto Run = [&](const std::uint32_t task)
+	{
+		try                { function(task); }
+		catch (...)        { errors[task] = std::current_exception(); }
+	};
+
+#ifdef CSV_IO_NO_THREAD
+	for (std::uint32_t task = 0; task < taskCount; ++task) { Run(task); }
+#else
+	std::vector<std::thread> threads;
+	threads.reserve(taskCount);
+	for (std::uint32_t task = 1; task < taskCount; ++task) { threads.emplace_back(Run, task); }
+	if (taskCount > 0) { Run(0); }
+	for (auto& thread : threads) { thread.join(); }
+#endif
+
+	for (const auto& error : errors)
+	{
+		if (error) { std::rethrow_exception(error); }
+	}
+}
+
+/****************************************************************************
+*							GetField
+*************************************************************************//**
+*  @fn        std::string_view CSVColumnReader::GetField(const std::uint64_t row, const std::uint32_t columnIndex) const
+*  @brief     Raw field in the source data
+*  @param[in] const std::uint64_t row
+*  @param[in] const std::uint32_t columnIndex
+*  @return    std::string_view
+*****************************************************************************/
+std::string_view CSVColumnReader::GetField(const std::uint64_t row, const std::uint32_t columnIndex) const
+{
+	const auto& span = _columns[columnIndex][row];
+	return std::string_view(_data + span.Offset, span.Length);
+}
+
+std::string CSVColumnReader::GetString(const std::uint64_t row, const std::uint32_t columnIndex) const
+{
+	return Unescape(GetField(row, columnIndex), _desc.Quote);
+}
+
+std::vector<std::string> CSVColumnReader::GetStringColumn(const std::uint32_t columnIndex) const
+{
+	std::vector<std::string> result(_rowCount);
+	for (std::uint64_t row = 0; row < _rowCount; ++row)
+	{
+		result[row] = GetString(row, columnIndex);
+	}
+	return result;
+}
+
+/****************************************************************************
+*							GetColumnIndex
+*************************************************************************//**
+*  @fn        std::uint32_t CSVColumnReader::GetColumnIndex(const std::string& columnName) const
+*  @brief     Find the column by name
+*  @param[in] const std::string& columnName
+*  @return    std::uint32_t
+*****************************************************************************/
+std::uint32_t CSVColumnReader::GetColumnIndex(const std::string& columnName) const
+{
+	const auto iterator = std::find(_columnNames.begin(), _columnNames.end(), columnName);
+	if (iterator == _columnNames.end())
+	{
+		error::MissingColumnInHeader err;
+		err.SetFileName(_fileName.c_str());
+		err.SetColumnName(columnName.c_str());
+		throw err;
+	}
+	return static_cast<std::uint32_t>(iterator - _columnNames.begin());
+}
+
+bool CSVColumnReader::HasColumn(const std::string& columnName) const
+{
+	return std::find(_columnNames.begin(), _columnNames.end(), columnName) != _columnNames.end();
+}
+#pragma endregion Main Function
+
+#pragma region Convert
+/****************************************************************************
+*							ConvertField
+*************************************************************************//**
+*  @fn        void CSVColumnReader::ConvertField(const std::uint64_t row, const std::uint32_t columnIndex, T& value) const
+*  @brief     std::from_chars based conversion (locale independent, no allocation)
+*  @param[in] const std::uint64_t row
+*  @param[in] const std::uint32_t columnIndex
+*  @param[out]T& value
+*  @return    void
+*****************************************************************************/
+namespace
+{
+	template<class T>
+	void ConvertNumber(const std::string_view rawField, const char quote, T& value, const char* fileName, const int line, const char* columnName)
+	{
+		auto field = Trim(rawField);
+		if (field.size() >= 2 && field.front() == quote && field.back() == quote) { field = Trim(field.substr(1, field.size() - 2)); }
+		if (!field.empty() && field.front() == '+') { field.remove_prefix(1); }
+
+		const auto [pointer, errorCode] = std::from_chars(field.data(), field.data() + field.size(), value);
+		if (errorCode == std::errc() && pointer == field.data() + field.size()) { return; }
+
+		const auto ThrowError = [&](auto&& err)
+		{
+			const std::string content(field);
+			err.SetFileName(fileName);
+			err.SetFileLine(line);
+			err.SetColumnName(columnName);
+			err.SetColumnContent(content.c_str());
+			throw err;
+		};
+
+		if (errorCode == std::errc::result_out_of_range) { ThrowError(error::IntergerOverflow()); }
+		if constexpr (std::is_unsigned_v<T>)
+		{
+			if (!field.empty() && field.front() == '-') { ThrowError(error::IntegerMustBePositive()); }
+		}
+		ThrowError(error::NoDigit());
+	}
+}
+
+void CSVColumnReader::ConvertField(const std::uint64_t row, const std::uint32_t columnIndex, std::int32_t& value) const
+{
+	ConvertNumber(GetField(row, columnIndex), _desc.Quote, value, _fileName.c_str(), static_cast<int>(row) + _firstDataLine, _columnNames[columnIndex].c_str());
+}
+
+void CSVColumnReader::ConvertField(const std::uint64_t row, const std::uint32_t columnIndex, std::uint32_t& value) const
+{
+	ConvertNumber(GetField(row, columnIndex), _desc.Quote, value, _fileName.c_str(), static_cast<int>(row) + _firstDataLine, _columnNames[columnIndex].c_str());
+}
+
+void CSVColumnReader::ConvertField(const std::uint64_t row, const std::uint32_t columnIndex, std::int64_t& value) const
+{
+	ConvertNumber(GetField(row, columnIndex), _desc.Quote, value, _fileName.c_str(), static_cast<int>(row) + _firstDataLine, _columnNames[columnIndex].c_str());
+}
+
+void CSVColumnReader::ConvertField(const std::uint64_t row, const std::uint32_t columnIndex, std::uint64_t& value) const
+{
+	ConvertNumber(GetField(row, columnIndex), _desc.Quote, value, _fileName.c_str(), static_cast<int>(row) + _firstDataLine, _columnNames[columnIndex].c_str());
+}
+
+void CSVColumnReader::ConvertField(const std::uint64_t row, const std::uint32_t columnIndex, float& value) const
+{
+	ConvertNumber(GetField(row, columnIndex), _desc.Quote, value, _fileName.c_str(), static_cast<int>(row) + _firstDataLine, _columnNames[columnIndex].c_str());
+}
+
+void CSVColumnReader::ConvertField(const std::uint64_t row, const std::uint32_t columnIndex, double& value) const
+{
+	ConvertNumber(GetField(row, columnIndex), _desc.Quote, value, _fileName.c_str(), static_cast<int>(row) + _firstDataLine, _columnNames[columnIndex].c_str());
+}
+#pragma endregion Convert
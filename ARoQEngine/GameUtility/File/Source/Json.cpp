@@ -15,22 +15,311 @@
 #include "GameUtility/File/External/rapidjson/prettywriter.h"
 #include <iostream>
 #include <fstream>
+#include <filesystem>
+#include <algorithm>
+#include <cstring>
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
 using namespace json;
 using namespace rapidjson;
+
+namespace
+{
+	/*-------------------------------------------------------------------
+	-   Binary cache format : header + value tree
+	-   value = tag (1 byte) + payload. Integer and length use LEB128.
+	-   String payload keeps the null terminator to be referenced without copy.
+	---------------------------------------------------------------------*/
+	constexpr std::uint32_t BINARY_MAGIC   = 0x4E49424A; // "JBIN"
+	constexpr std::uint32_t BINARY_VERSION = 1;
+
+	struct BinaryHeader
+	{
+		std::uint32_t Magic       = BINARY_MAGIC;
+		std::uint32_t Version     = BINARY_VERSION;
+		std::uint64_t ContentHash = 0;
+	};
+
+	enum BinaryTag : std::uint8_t
+	{
+		Tag_Null,
+		Tag_False,
+		Tag_True,
+		Tag_Int64,
+		Tag_Uint64,
+		Tag_Double,
+		Tag_String,
+		Tag_Array,
+		Tag_Object
+	};
+
+	void WriteVarUint(std::vector<std::uint8_t>& output, std::uint64_t value)
+	{
+		while (value >= 0x80)
+		{
+			output.push_back(static_cast<std::uint8_t>(value | 0x80));
+			value >>= 7;
+		}
+		output.push_back(static_cast<std::uint8_t>(value));
+	}
+
+	void WriteString(std::vector<std::uint8_t>& output, const char* string, const std::uint64_t length)
+	{
+		WriteVarUint(output, length);
+		output.insert(output.end(), string, string + length);
+		output.push_back(0);
+	}
+
+	void WriteValue(std::vector<std::uint8_t>& output, const Value& value)
+	{
+		switch (value.GetType())
+		{
+			case kNullType : { output.push_back(Tag_Null);  break; }
+			case kFalseType: { output.push_back(Tag_False); break; }
+			case kTrueType : { output.push_back(Tag_True);  break; }
+			case kStringType:
+			{
+				output.push_back(Tag_String);
+				WriteString(output, value.GetString(), value.GetStringLength());
+				break;
+			}
+			case kNumberType:
+			{
+				if (value.IsDouble())
+				{
+					const double number = value.GetDouble();
+					output.push_back(Tag_Double);
+					const auto bytes = reinterpret_cast<const std::uint8_t*>(&number);
+					output.insert(output.end(), bytes, bytes + sizeof(double));
+				}
+				else if (value.IsInt64())
+				{
+					// zigzag
+					const std::int64_t number = value.GetInt64();
+					output.push_back(Tag_Int64);
+					WriteVarUint(output, (static_cast<std::uint64_t>(number) << 1) ^ static_cast<std::uint64_t>(number >> 63));
+				}
+				else
+				{
+					output.push_back(Tag_Uint64);
+					WriteVarUint(output, value.GetUint64());
+				}
+				break;
+			}
+			case kArrayType:
+			{
+				output.push_back(Tag_Array);
+				WriteVarUint(output, value.Size());
+				for (const auto& element : value.GetArray()) { WriteValue(output, element); }
+				break;
+			}
+			case kObjectType:
+			{
+				output.push_back(Tag_Object);
+				WriteVarUint(output, value.MemberCount());
+				for (const auto& member : value.GetObject())
+				{
+					WriteString(output, member.name.GetString(), member.name.GetStringLength());
+					WriteValue(output, member.value);
+				}
+				break;
+			}
+		}
+	}
+
+	/****************************************************************************
+	*				  			BinaryGenerator
+	*************************************************************************//**
+	*  @class     BinaryGenerator
+	*  @brief     Replay the binary as the SAX events for GenericDocument::Populate.
+	*             The strings are passed without copy (the binary must outlive the document).
+	*****************************************************************************/
+	class BinaryGenerator
+	{
+	public:
+		BinaryGenerator(const char* begin, const char* end) : _current(begin), _end(end) {}
+
+		template<class Handler>
+		bool operator()(Handler& handler)
+		{
+			_isSucceeded = ReadValue(handler, 0) && _current == _end;
+			return _isSucceeded;
+		}
+
+		bool IsSucceeded() const { return _isSucceeded; }
+
+	private:
+		static constexpr std::uint32_t MAX_DEPTH = 512;
+
+		bool ReadVarUint(std::uint64_t& value)
+		{
+			value = 0;
+			for (std::uint32_t shift = 0; shift < 64; shift += 7)
+			{
+				if (_current >= _end) { return false; }
+				const auto byte = static_cast<std::uint8_t>(*_current++);
+				value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+				if ((byte & 0x80) == 0) { return true; }
+			}
+			return false;
+		}
+
+		bool ReadString(const char*& string, SizeType& length)
+		{
+			std::uint64_t size = 0;
+			if (!ReadVarUint(size) || static_cast<std::uint64_t>(_end - _current) < size + 1) { return false; }
+			string  = _current;
+			length  = static_cast<SizeType>(size);
+			_current += size + 1;
+			return string[size] == '\0';
+		}
+
+		template<class Handler>
+		bool ReadValue(Handler& handler, const std::uint32_t depth)
+		{
+			if (_current >= _end || depth > MAX_DEPTH) { return false; }
+
+			switch (static_cast<std::uint8_t>(*_current++))
+			{
+				case Tag_Null : { return handler.Null(); }
+				case Tag_False: { return handler.Bool(false); }
+				case Tag_True : { return handler.Bool(true); }
+				case Tag_Int64:
+				{
+					std::uint64_t zigzag = 0;
+					if (!ReadVarUint(zigzag)) { return false; }
+					return handler.Int64(static_cast<std::int64_t>((zigzag >> 1) ^ (0 - (zigzag & 1))));
+				}
+				case Tag_Uint64:
+				{
+					std::uint64_t number = 0;
+					return ReadVarUint(number) && handler.Uint64(number);
+				}
+				case Tag_Double:
+				{
+					if (_end - _current < static_cast<std::ptrdiff_t>(sizeof(double))) { return false; }
+					double number = 0.0;
+					std::memcpy(&number, _current, sizeof(double));
+					_current += sizeof(double);
+					return handler.Double(number);
+				}
+				case Tag_String:
+				{
+					const char* string = nullptr; SizeType length = 0;
+					return ReadString(string, length) && handler.String(string, length, false);
+				}
+				case Tag_Array:
+				{
+					std::uint64_t count = 0;
+					if (!ReadVarUint(count) || !handler.StartArray()) { return false; }
+					for (std::uint64_t i = 0; i < count; ++i)
+					{
+						if (!ReadValue(handler, depth + 1)) { return false; }
+					}
+					return handler.EndArray(static_cast<SizeType>(count));
+				}
+				case Tag_Object:
+				{
+					std::uint64_t count = 0;
+					if (!ReadVarUint(count) || !handler.StartObject()) { return false; }
+					for (std::uint64_t i = 0; i < count; ++i)
+					{
+						const char* key = nullptr; SizeType length = 0;
+						if (!ReadString(key, length) || !handler.Key(key, length, false)) { return false; }
+						if (!ReadValue(handler, depth + 1)) { return false; }
+					}
+					return handler.EndObject(static_cast<SizeType>(count));
+				}
+				default: { return false; }
+			}
+		}
+
+		const char* _current = nullptr;
+		const char* _end     = nullptr;
+		bool _isSucceeded    = false;
+	};
+
+	/*-------------------------------------------------------------------
+	-   Pull reader handler : keep the last event as the token
+	---------------------------------------------------------------------*/
+	struct TokenHandler : public BaseReaderHandler<UTF8<>, TokenHandler>
+	{
+		JsonToken* Token = nullptr;
+
+		bool Null()                     { Token->Type = JsonTokenType::Null;   return true; }
+		bool Bool(bool value)           { Token->Type = JsonTokenType::Bool;   Token->Bool   = value; return true; }
+		bool Int(int value)             { return Int64(value); }
+		bool Uint(unsigned value)       { return Uint64(value); }
+		bool Int64(std::int64_t value)  { Token->Type = JsonTokenType::Int64;  Token->Int64  = value; Token->Double = static_cast<double>(value); return true; }
+		bool Uint64(std::uint64_t value){ Token->Type = JsonTokenType::Uint64; Token->Uint64 = value; Token->Double = static_cast<double>(value); return true; }
+		bool Double(double value)       { Token->Type = JsonTokenType::Double; Token->Double = value; return true; }
+		bool String(const char* value, SizeType length, bool) { Token->Type = JsonTokenType::String; Token->String = std::string_view(value, length); return true; }
+		bool Key   (const char* value, SizeType length, bool) { Token->Type = JsonTokenType::Key;    Token->String = std::string_view(value, length); return true; }
+		bool StartObject()              { Token->Type = JsonTokenType::StartObject; return true; }
+		bool EndObject(SizeType count)  { Token->Type = JsonTokenType::EndObject;   Token->Count = count; return true; }
+		bool StartArray()               { Token->Type = JsonTokenType::StartArray;  return true; }
+		bool EndArray(SizeType count)   { Token->Type = JsonTokenType::EndArray;    Token->Count = count; return true; }
+	};
+
+	constexpr unsigned int PULL_PARSE_FLAGS = kParseIterativeFlag;
+
+	bool HasUTF8BOM(const char* text, const std::uint64_t length)
+	{
+		return text != nullptr && length >= 3 && std::memcmp(text, "\xEF\xBB\xBF", 3) == 0;
+	}
+}
 //////////////////////////////////////////////////////////////////////////////////
 //                          Implement
 //////////////////////////////////////////////////////////////////////////////////
+#pragma region JsonMemoryArena
+JsonMemoryArena::JsonMemoryArena(const std::uint64_t initialByteSize)
+	: _buffer((std::max<std::uint64_t>)(initialByteSize, 4096))
+{
+	_allocator = std::make_unique<AllocatorType>(_buffer.data(), _buffer.size());
+}
+
+/****************************************************************************
+*							Reset
+*************************************************************************//**
+*  @fn        void JsonMemoryArena::Reset()
+*  @brief     Release the values. If the previous load overflowed the buffer,
+*             the buffer is enlarged so that the next load of the same size does not call malloc.
+*  @param[in] void
+*  @return    void
+*****************************************************************************/
+void JsonMemoryArena::Reset()
+{
+	const std::uint64_t usedByteSize = _allocator->Size();
+	_highWaterByteSize = (std::max)(_highWaterByteSize, usedByteSize);
+
+	// Allocator header is in the buffer, so keep a small margin.
+	const std::uint64_t requiredByteSize = usedByteSize + usedByteSize / 4 + 256;
+	if (requiredByteSize <= _buffer.size())
+	{
+		_allocator->Clear();
+		return;
+	}
+
+	std::vector<std::uint8_t> buffer(requiredByteSize);
+	*_allocator = AllocatorType(buffer.data(), buffer.size());
+	_buffer.swap(buffer);
+}
+
+std::uint64_t JsonMemoryArena::GetHighWaterByteSize() const
+{
+	return (std::max<std::uint64_t>)(_highWaterByteSize, _allocator->Size());
+}
+#pragma endregion JsonMemoryArena
+
 #pragma region JsonDocument
 JsonDocument::JsonDocument() : _document(rapidjson::Document())
 {
-	
+
 }
 JsonDocument::~JsonDocument()
 {
-	
+
 }
 
 JsonDocument::JsonDocument(const std::string& filePath)
@@ -38,14 +327,202 @@ JsonDocument::JsonDocument(const std::string& filePath)
 	Load(filePath);
 }
 
+JsonDocument::JsonDocument(JsonMemoryArena& arena) : _document(&arena.GetAllocator()), _arena(&arena)
+{
+
+}
+
+/****************************************************************************
+*							Load
+*************************************************************************//**
+*  @fn        bool JsonDocument::Load(const std::string& filePath)
+*  @brief     Memory map the file and parse it (the strings are copied into the document)
+*  @param[in] const std::string& filePath
+*  @return    bool
+*****************************************************************************/
 bool JsonDocument::Load(const std::string& filePath)
 {
-	std::ifstream  ifStream(filePath);
-	IStreamWrapper iStream(ifStream);
-	_document.ParseStream(iStream);
+	file::MemoryMappedFile file;
+	if (!file.Open(filePath)) { return false; }
+
+	return Parse(file.GetData(), file.GetSize());
+}
+
+bool JsonDocument::Parse(const char* text, const std::uint64_t length)
+{
+	ResetDocument();
+	_document.Parse(text != nullptr ? text : "", static_cast<size_t>(length));
+	return !_document.HasParseError();
+}
+
+/****************************************************************************
+*							LoadInSitu
+*************************************************************************//**
+*  @fn        bool JsonDocument::LoadInSitu(const std::string& filePath)
+*  @brief     Read the file into the owned buffer and parse in place.
+*             The string values point into the buffer, so only the value nodes are allocated.
+*  @param[in] const std::string& filePath
+*  @return    bool
+*****************************************************************************/
+bool JsonDocument::LoadInSitu(const std::string& filePath)
+{
+	file::MemoryMappedFile file;
+	if (!file.Open(filePath)) { return false; }
+
+	// The in situ stream does not take the BOM.
+	const char*   text   = file.GetData();
+	std::uint64_t length = file.GetSize();
+	if (HasUTF8BOM(text, length)) { text += 3; length -= 3; }
+
+	ResetDocument();
+	_buffer.resize(length + 1);
+	if (length > 0) { std::memcpy(_buffer.data(), text, length); }
+	_buffer.back() = '\0';
+	file.Close();
+
+	_document.ParseInsitu(_buffer.data());
 	return !_document.HasParseError();
 }
 
+bool JsonDocument::ParseInSitu(char* buffer)
+{
+	if (buffer != nullptr && HasUTF8BOM(buffer, 3)) { buffer += 3; }
+
+	ResetDocument();
+	_document.ParseInsitu(buffer);
+	return !_document.HasParseError();
+}
+
+/****************************************************************************
+*							LoadWithCache
+*************************************************************************//**
+*  @fn        bool JsonDocument::LoadWithCache(const std::string& filePath, const std::string& cacheDirectory)
+*  @brief     Load the binary cache keyed by the content hash of the file.
+*             If there is no valid cache, parse the text and write the cache.
+*  @param[in] const std::string& filePath
+*  @param[in] const std::string& cacheDirectory
+*  @return    bool
+*****************************************************************************/
+bool JsonDocument::LoadWithCache(const std::string& filePath, const std::string& cacheDirectory)
+{
+	_isLoadedFromCache = false;
+
+	file::MemoryMappedFile file;
+	if (!file.Open(filePath)) { return false; }
+
+	const auto contentHash = ComputeContentHash(file.GetData(), file.GetSize());
+
+	char hashName[17] = {};
+	for (int i = 0; i < 16; ++i) { hashName[i] = "0123456789abcdef"[(contentHash >> (60 - 4 * i)) & 0xF]; }
+	const auto cachePath = std::filesystem::path(cacheDirectory) / (std::string(hashName) + ".jbin");
+
+	/*-------------------------------------------------------------------
+	-                 Cache hit
+	---------------------------------------------------------------------*/
+	{
+		file::MemoryMappedFile cacheFile;
+		if (cacheFile.Open(cachePath.string()) &&
+			LoadBinary(reinterpret_cast<const std::uint8_t*>(cacheFile.GetData()), cacheFile.GetSize(), contentHash))
+		{
+			_isLoadedFromCache = true;
+			return true;
+		}
+	}
+
+	/*-------------------------------------------------------------------
+	-                 Cache miss : parse and write the cache
+	---------------------------------------------------------------------*/
+	if (!Parse(file.GetData(), file.GetSize())) { return false; }
+
+	std::error_code errorCode;
+	std::filesystem::create_directories(cacheDirectory, errorCode);
+
+	const auto binary = SaveBinary(contentHash);
+	std::ofstream ofStream(cachePath, std::ios::binary | std::ios::trunc);
+	ofStream.write(reinterpret_cast<const char*>(binary.data()), static_cast<std::streamsize>(binary.size()));
+	return true;
+}
+
+/****************************************************************************
+*							SaveBinary
+*************************************************************************//**
+*  @fn        std::vector<std::uint8_t> JsonDocument::SaveBinary(const std::uint64_t contentHash) const
+*  @brief     Serialize the document into the compact binary
+*  @param[in] const std::uint64_t contentHash
+*  @return    std::vector<std::uint8_t>
+*****************************************************************************/
+std::vector<std::uint8_t> JsonDocument::SaveBinary(const std::uint64_t contentHash) const
+{
+	std::vector<std::uint8_t> output(sizeof(BinaryHeader));
+
+	BinaryHeader header = {};
+	header.ContentHash  = contentHash;
+	std::memcpy(output.data(), &header, sizeof(BinaryHeader));
+
+	WriteValue(output, _document);
+	return output;
+}
+
+/****************************************************************************
+*							LoadBinary
+*************************************************************************//**
+*  @fn        bool JsonDocument::LoadBinary(const std::uint8_t* data, const std::uint64_t byteSize, const std::uint64_t contentHash)
+*  @brief     Build the document from the SaveBinary output. Numbers are not reparsed and strings are not copied.
+*  @param[in] const std::uint8_t* data
+*  @param[in] const std::uint64_t byteSize
+*  @param[in] const std::uint64_t contentHash (must match the saved hash)
+*  @return    bool
+*****************************************************************************/
+bool JsonDocument::LoadBinary(const std::uint8_t* data, const std::uint64_t byteSize, const std::uint64_t contentHash)
+{
+	if (data == nullptr || byteSize < sizeof(BinaryHeader)) { return false; }
+
+	BinaryHeader header = {};
+	std::memcpy(&header, data, sizeof(BinaryHeader));
+	if (header.Magic != BINARY_MAGIC || header.Version != BINARY_VERSION || header.ContentHash != contentHash) { return false; }
+
+	ResetDocument();
+	_buffer.assign(reinterpret_cast<const char*>(data) + sizeof(BinaryHeader), reinterpret_cast<const char*>(data) + byteSize);
+
+	BinaryGenerator generator(_buffer.data(), _buffer.data() + _buffer.size());
+	_document.Populate(generator);
+	if (!generator.IsSucceeded())
+	{
+		ResetDocument();
+		return false;
+	}
+	return true;
+}
+
+/****************************************************************************
+*							ComputeContentHash
+*************************************************************************//**
+*  @fn        std::uint64_t JsonDocument::ComputeContentHash(const char* data, const std::uint64_t byteSize)
+*  @brief     FNV-1a over 8 byte words (the tail is processed bytewise)
+*  @param[in] const char* data
+*  @param[in] const std::uint64_t byteSize
+*  @return    std::uint64_t
+*****************************************************************************/
+std::uint64_t JsonDocument::ComputeContentHash(const char* data, const std::uint64_t byteSize)
+{
+	constexpr std::uint64_t FNV_OFFSET = 14695981039346656037ull;
+	constexpr std::uint64_t FNV_PRIME  = 1099511628211ull;
+
+	std::uint64_t hash  = FNV_OFFSET ^ byteSize;
+	std::uint64_t index = 0;
+	for (; index + 8 <= byteSize; index += 8)
+	{
+		std::uint64_t word = 0;
+		std::memcpy(&word, data + index, 8);
+		hash = (hash ^ word) * FNV_PRIME;
+	}
+	for (; index < byteSize; ++index)
+	{
+		hash = (hash ^ static_cast<std::uint8_t>(data[index])) * FNV_PRIME;
+	}
+	return hash;
+}
+
 void JsonDocument::Save(const std::string& filePath)
 {
 	std::ofstream ofstream(filePath);
@@ -53,4 +530,99 @@ void JsonDocument::Save(const std::string& filePath)
 	PrettyWriter<OStreamWrapper> writer(ostreamWrapper);
 	_document.Accept(writer);
 }
-#pragma endregion JsonDocument
\ No newline at end of file
+
+std::uint64_t JsonDocument::GetUsedMemoryByteSize()
+{
+	return static_cast<std::uint64_t>(_document.GetAllocator().Size()) + _buffer.capacity();
+}
+
+/****************************************************************************
+*							ResetDocument
+*************************************************************************//**
+*  @fn        void JsonDocument::ResetDocument()
+*  @brief     The owned pool allocator is replaced (the pool memory is not released by SetNull).
+*             With the arena, the arena is reset instead.
+*  @param[in] void
+*  @return    void
+*****************************************************************************/
+void JsonDocument::ResetDocument()
+{
+	if (_arena)
+	{
+		_document.SetNull();
+		_arena->Reset();
+	}
+	else
+	{
+		rapidjson::Document().Swap(_document);
+	}
+	_buffer.clear();
+	_buffer.shrink_to_fit();
+}
+#pragma endregion JsonDocument
+
+#pragma region JsonPullReader
+bool JsonPullReader::Open(const std::string& filePath)
+{
+	if (!_mappedFile.Open(filePath)) { return false; }
+
+	Open(_mappedFile.GetData(), _mappedFile.GetSize());
+	return true;
+}
+
+void JsonPullReader::Open(const char* text, const std::uint64_t length)
+{
+	if (HasUTF8BOM(text, length))
+	{
+		text += 3;
+		_stream = std::make_unique<MemoryStream>(text, static_cast<size_t>(length - 3));
+	}
+	else
+	{
+		_stream = std::make_unique<MemoryStream>(text != nullptr ? text : "", static_cast<size_t>(length));
+	}
+	_reader.IterativeParseInit();
+}
+
+/****************************************************************************
+*							Next
+*************************************************************************//**
+*  @fn        bool JsonPullReader::Next(JsonToken& token)
+*  @brief     Read the next token
+*  @param[out]JsonToken& token
+*  @return    bool
+*****************************************************************************/
+bool JsonPullReader::Next(JsonToken& token)
+{
+	token = JsonToken();
+	if (!_stream || _reader.IterativeParseComplete()) { return false; }
+
+	TokenHandler handler = {};
+	handler.Token = &token;
+	return _reader.IterativeParseNext<PULL_PARSE_FLAGS>(*_stream, handler) && token.Type != JsonTokenType::None;
+}
+
+/****************************************************************************
+*							SkipValue
+*************************************************************************//**
+*  @fn        bool JsonPullReader::SkipValue(const JsonToken& current)
+*  @brief     If current starts the container, read until the matching end
+*  @param[in] const JsonToken& current
+*  @return    bool
+*****************************************************************************/
+bool JsonPullReader::SkipValue(const JsonToken& current)
+{
+	if (current.Type != JsonTokenType::StartObject && current.Type != JsonTokenType::StartArray) { return true; }
+
+	std::uint64_t depth = 1;
+	JsonToken token = {};
+	while (depth > 0)
+	{
+		if (!Next(token)) { return false; }
+
+		if      (token.Type == JsonTokenType::StartObject || token.Type == JsonTokenType::StartArray) { ++depth; }
+		else if (token.Type == JsonTokenType::EndObject   || token.Type == JsonTokenType::EndArray)   { --depth; }
+	}
+	return true;
+}
+#pragma endregion JsonPullReader
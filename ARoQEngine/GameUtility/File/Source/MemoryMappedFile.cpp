@@ -0,0 +1,145 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   MemoryMappedFile.cpp
+///             @brief  Read only memory mapped file
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/File/Include/MemoryMappedFile.hpp"
+#include <utility>
+
+// Platform specific
+#if defined(_WIN32) || defined(_WIN64)
+	#include <Windows.h>
+#else
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace file;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& other) noexcept
+{
+	if (this != &other)
+	{
+		Close();
+		_data           = std::exchange(other._data, nullptr);
+		_size           = std::exchange(other._size, 0);
+		_isOpen         = std::exchange(other._isOpen, false);
+		_fileHandle     = std::exchange(other._fileHandle, nullptr);
+		_mappingHandle  = std::exchange(other._mappingHandle, nullptr);
+		_fileDescriptor = std::exchange(other._fileDescriptor, -1);
+	}
+	return *this;
+}
+
+/****************************************************************************
+*							Open
+*************************************************************************//**
+*  @fn        bool MemoryMappedFile::Open(const std::string& filePath)
+*  @brief     Open and map the file
+*  @param[in] const std::string& filePath
+*  @return    bool
+*****************************************************************************/
+bool MemoryMappedFile::Open(const std::string& filePath)
+{
+	Close();
+
+#if defined(_WIN32) || defined(_WIN64)
+	const HANDLE file = ::CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (file == INVALID_HANDLE_VALUE) { return false; }
+	_fileHandle = file;
+#else
+	_fileDescriptor = ::open(filePath.c_str(), O_RDONLY);
+	if (_fileDescriptor < 0) { return false; }
+#endif
+	return MapOpenedFile();
+}
+
+bool MemoryMappedFile::Open(const std::wstring& filePath)
+{
+	Close();
+
+#if defined(_WIN32) || defined(_WIN64)
+	const HANDLE file = ::CreateFileW(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (file == INVALID_HANDLE_VALUE) { return false; }
+	_fileHandle = file;
+	return MapOpenedFile();
+#else
+	// wide path is only used on Windows
+	return Open(std::string(filePath.begin(), filePath.end()));
+#endif
+}
+
+/****************************************************************************
+*							MapOpenedFile
+*************************************************************************//**
+*  @fn        bool MemoryMappedFile::MapOpenedFile()
+*  @brief     Create the read only view of the whole file
+*  @param[in] void
+*  @return    bool
+*****************************************************************************/
+bool MemoryMappedFile::MapOpenedFile()
+{
+#if defined(_WIN32) || defined(_WIN64)
+	LARGE_INTEGER fileSize = {};
+	if (!::GetFileSizeEx(static_cast<HANDLE>(_fileHandle), &fileSize)) { Close(); return false; }
+	_size   = static_cast<std::uint64_t>(fileSize.QuadPart);
+	_isOpen = true;
+	if (_size == 0) { return true; } // CreateFileMapping fails for the empty file
+
+	_mappingHandle = ::CreateFileMappingW(static_cast<HANDLE>(_fileHandle), nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (_mappingHandle == nullptr) { Close(); return false; }
+
+	_data = static_cast<const char*>(::MapViewOfFile(static_cast<HANDLE>(_mappingHandle), FILE_MAP_READ, 0, 0, 0));
+	if (_data == nullptr) { Close(); return false; }
+#else
+	struct stat status = {};
+	if (::fstat(_fileDescriptor, &status) != 0) { Close(); return false; }
+	_size   = static_cast<std::uint64_t>(status.st_size);
+	_isOpen = true;
+	if (_size == 0) { return true; }
+
+	void* data = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, _fileDescriptor, 0);
+	if (data == MAP_FAILED) { Close(); return false; }
+	::madvise(data, _size, MADV_SEQUENTIAL);
+	_data = static_cast<const char*>(data);
+#endif
+	return true;
+}
+
+/****************************************************************************
+*							Close
+*************************************************************************//**
+*  @fn        void MemoryMappedFile::Close()
+*  @brief     Unmap the view and close the handles
+*  @param[in] void
+*  @return    void
+*****************************************************************************/
+void MemoryMappedFile::Close()
+{
+#if defined(_WIN32) || defined(_WIN64)
+	if (_data)          { ::UnmapViewOfFile(_data); }
+	if (_mappingHandle) { ::CloseHandle(static_cast<HANDLE>(_mappingHandle)); }
+	if (_fileHandle)    { ::CloseHandle(static_cast<HANDLE>(_fileHandle)); }
+#else
+	if (_data)                { ::munmap(const_cast<char*>(_data), _size); }
+	if (_fileDescriptor >= 0) { ::close(_fileDescriptor); }
+#endif
+	_data           = nullptr;
+	_size           = 0;
+	_isOpen         = false;
+	_fileHandle     = nullptr;
+	_mappingHandle  = nullptr;
+	_fileDescriptor = -1;
+}
@@ -8,7 +8,21 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include "GameUtility/File/Include/UnicodeUtility.hpp"
+#include "GameUtility/Math/Private/Simd/Include/GMSimdMacros.hpp"
 #include <stdexcept>
+#include <cstring>
+
+#if PLATFORM_CPU_INSTRUCTION_SSSE3
+	#include <tmmintrin.h>
+#elif PLATFORM_CPU_INSTRUCTION_SSE2
+	#include <emmintrin.h>
+#elif PLATFORM_CPU_INSTRUCTION_NEON
+	#include <arm_neon.h>
+#endif
+
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
@@ -43,6 +57,592 @@ namespace unicode
 		{ 
 			return 0xDC00 <= ch && ch < 0xE000; 
 		}
+
+		/*-------------------------------------------------------------------
+		-   Strict decode of one UTF-8 sequence (Unicode Table 3-7).
+		-   Return the byte count, or 0 for the invalid sequence.
+		---------------------------------------------------------------------*/
+		inline std::uint32_t DecodeU8(const std::uint8_t* u8, const std::uint64_t remain, char32_t& u32Char)
+		{
+			const std::uint32_t b0 = u8[0];
+			if (b0 < 0x80) { u32Char = b0; return 1; }
+			if (b0 < 0xC2) { return 0; }
+
+			if (b0 < 0xE0)
+			{
+				if (remain < 2 || (u8[1] & 0xC0) != 0x80) { return 0; }
+				u32Char = ((b0 & 0x1F) << 6) | (u8[1] & 0x3F);
+				return 2;
+			}
+			if (b0 < 0xF0)
+			{
+				if (remain < 3 || (u8[1] & 0xC0) != 0x80 || (u8[2] & 0xC0) != 0x80) { return 0; }
+				u32Char = ((b0 & 0x0F) << 12) | ((u8[1] & 0x3F) << 6) | (u8[2] & 0x3F);
+				if (u32Char < 0x800 || (0xD800 <= u32Char && u32Char < 0xE000)) { return 0; }
+				return 3;
+			}
+			if (b0 < 0xF5)
+			{
+				if (remain < 4 || (u8[1] & 0xC0) != 0x80 || (u8[2] & 0xC0) != 0x80 || (u8[3] & 0xC0) != 0x80) { return 0; }
+				u32Char = ((b0 & 0x07) << 18) | ((u8[1] & 0x3F) << 12) | ((u8[2] & 0x3F) << 6) | (u8[3] & 0x3F);
+				if (u32Char < 0x10000 || u32Char > 0x10FFFF) { return 0; }
+				return 4;
+			}
+			return 0;
+		}
+
+		/*-------------------------------------------------------------------
+		-   Encode the valid code point. Return the byte count.
+		---------------------------------------------------------------------*/
+		inline std::uint32_t EncodeU8(const char32_t u32Char, char* u8)
+		{
+			if (u32Char < 0x80)    { u8[0] = char(u32Char); return 1; }
+			if (u32Char < 0x800)   { u8[0] = char(0xC0 | (u32Char >> 6)); u8[1] = char(0x80 | (u32Char & 0x3F)); return 2; }
+			if (u32Char < 0x10000)
+			{
+				u8[0] = char(0xE0 | (u32Char >> 12));
+				u8[1] = char(0x80 | ((u32Char >> 6) & 0x3F));
+				u8[2] = char(0x80 | (u32Char & 0x3F));
+				return 3;
+			}
+			u8[0] = char(0xF0 | (u32Char >> 18));
+			u8[1] = char(0x80 | ((u32Char >> 12) & 0x3F));
+			u8[2] = char(0x80 | ((u32Char >> 6) & 0x3F));
+			u8[3] = char(0x80 | (u32Char & 0x3F));
+			return 4;
+		}
+
+		inline std::uint32_t GetU8ByteCountFromU32(const char32_t u32Char)
+		{
+			return 1 + (u32Char >= 0x80) + (u32Char >= 0x800) + (u32Char >= 0x10000);
+		}
+
+		/*-------------------------------------------------------------------
+		-   Strict decode of one UTF-16 code point. Return the unit count, or 0 for the unpaired surrogate.
+		---------------------------------------------------------------------*/
+		inline std::uint32_t DecodeU16(const char16_t* u16, const std::uint64_t remain, char32_t& u32Char)
+		{
+			const char16_t c0 = u16[0];
+			if (!IsU16HighSurrogate(c0) && !IsU16LowSurrogate(c0)) { u32Char = c0; return 1; }
+			if (IsU16LowSurrogate(c0) || remain < 2 || !IsU16LowSurrogate(u16[1])) { return 0; }
+
+			u32Char = 0x10000 + ((char32_t(c0) - 0xD800) << 10) + (char32_t(u16[1]) - 0xDC00);
+			return 2;
+		}
+
+		inline bool IsValidCodePoint(const char32_t u32Char)
+		{
+			return u32Char <= 0x10FFFF && !(0xD800 <= u32Char && u32Char < 0xE000);
+		}
+
+		inline std::uint32_t CountTrailingZeros(const std::uint32_t bits)
+		{
+#if defined(_MSC_VER)
+			unsigned long index = 0;
+			_BitScanForward(&index, bits);
+			return static_cast<std::uint32_t>(index);
+#else
+			return static_cast<std::uint32_t>(__builtin_ctz(bits));
+#endif
+		}
+
+		inline std::uint32_t PopCount(const std::uint32_t bits)
+		{
+#if defined(_MSC_VER) && PLATFORM_CPU_X86_FAMILY
+			return static_cast<std::uint32_t>(__popcnt(bits));
+#elif defined(_MSC_VER)
+			std::uint32_t value = bits, count = 0;
+			while (value) { value &= value - 1; ++count; }
+			return count;
+#else
+			return static_cast<std::uint32_t>(__builtin_popcount(bits));
+#endif
+		}
+
+		/*-------------------------------------------------------------------
+		-                    SIMD kernels
+		-   Each kernel returns false if the block can not be processed, and the caller falls back to the scalar path.
+		---------------------------------------------------------------------*/
+		constexpr std::uint32_t SIMD_BYTE_COUNT = 16;
+
+#if PLATFORM_CPU_INSTRUCTION_NEON && (defined(__aarch64__) || defined(_M_ARM64))
+		#define UNICODE_SIMD_NEON 1
+		inline std::uint32_t MoveMask(const uint8x16_t compare)
+		{
+			static const std::uint8_t bitWeight[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+			const uint8x16_t masked = vandq_u8(compare, vld1q_u8(bitWeight));
+			return static_cast<std::uint32_t>(vaddv_u8(vget_low_u8(masked))) | (static_cast<std::uint32_t>(vaddv_u8(vget_high_u8(masked))) << 8);
+		}
+#else
+		#define UNICODE_SIMD_NEON 0
+#endif
+
+		/*-------------------------------------------------------------------
+		-   Bit i is set when u8[i] is not ASCII (16 bytes)
+		---------------------------------------------------------------------*/
+		inline std::uint32_t GetNonAsciiMask(const char* u8)
+		{
+#if PLATFORM_CPU_INSTRUCTION_SSE2
+			return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(u8))));
+#elif UNICODE_SIMD_NEON
+			return MoveMask(vcgeq_u8(vld1q_u8(reinterpret_cast<const std::uint8_t*>(u8)), vdupq_n_u8(0x80)));
+#else
+			std::uint32_t mask = 0;
+			for (std::uint32_t i = 0; i < SIMD_BYTE_COUNT; ++i) { mask |= static_cast<std::uint32_t>(std::uint8_t(u8[i]) >> 7) << i; }
+			return mask;
+#endif
+		}
+
+		/*-------------------------------------------------------------------
+		-   16 ASCII bytes -> 16 code units
+		---------------------------------------------------------------------*/
+		inline void WidenAscii(const char* u8, char16_t* u16)
+		{
+#if PLATFORM_CPU_INSTRUCTION_SSE2
+			const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(u8));
+			const __m128i zero  = _mm_setzero_si128();
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(u16)    , _mm_unpacklo_epi8(value, zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(u16 + 8), _mm_unpackhi_epi8(value, zero));
+#elif UNICODE_SIMD_NEON
+			const uint8x16_t value = vld1q_u8(reinterpret_cast<const std::uint8_t*>(u8));
+			vst1q_u16(reinterpret_cast<std::uint16_t*>(u16)    , vmovl_u8(vget_low_u8(value)));
+			vst1q_u16(reinterpret_cast<std::uint16_t*>(u16 + 8), vmovl_u8(vget_high_u8(value)));
+#else
+			for (std::uint32_t i = 0; i < SIMD_BYTE_COUNT; ++i) { u16[i] = char16_t(std::uint8_t(u8[i])); }
+#endif
+		}
+
+		inline void WidenAscii(const char* u8, char32_t* u32)
+		{
+#if PLATFORM_CPU_INSTRUCTION_SSE2
+			const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(u8));
+			const __m128i zero  = _mm_setzero_si128();
+			const __m128i low   = _mm_unpacklo_epi8(value, zero);
+			const __m128i high  = _mm_unpackhi_epi8(value, zero);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(u32)     , _mm_unpacklo_epi16(low , zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(u32 + 4) , _mm_unpackhi_epi16(low , zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(u32 + 8) , _mm_unpacklo_epi16(high, zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(u32 + 12), _mm_unpackhi_epi16(high, zero));
+#elif UNICODE_SIMD_NEON
+			const uint8x16_t value = vld1q_u8(reinterpret_cast<const std::uint8_t*>(u8));
+			const uint16x8_t low   = vmovl_u8(vget_low_u8(value));
+			const uint16x8_t high  = vmovl_u8(vget_high_u8(value));
+			auto destination = reinterpret_cast<std::uint32_t*>(u32);
+			vst1q_u32(destination     , vmovl_u16(vget_low_u16(low)));
+			vst1q_u32(destination + 4 , vmovl_u16(vget_high_u16(low)));
+			vst1q_u32(destination + 8 , vmovl_u16(vget_low_u16(high)));
+			vst1q_u32(destination + 12, vmovl_u16(vget_high_u16(high)));
+#else
+			for (std::uint32_t i = 0; i < SIMD_BYTE_COUNT; ++i) { u32[i] = char32_t(std::uint8_t(u8[i])); }
+#endif
+		}
+
+		/*-------------------------------------------------------------------
+		-   16 bytes of eight 2 byte sequences -> 8 code points (U+0080 - U+07FF)
+		---------------------------------------------------------------------*/
+		inline bool DecodeTwoByteRun(const char* u8, char16_t* u16)
+		{
+#if PLATFORM_CPU_INSTRUCTION_SSE2
+			// 16 bit lane = lead | trail << 8
+			const __m128i lane  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(u8));
+			const __m128i check = _mm_cmpeq_epi16(_mm_and_si128(lane, _mm_set1_epi16(short(0xC0E0))), _mm_set1_epi16(short(0x80C0)));
+			// overlong : lead byte 0xC0 or 0xC1
+			const __m128i overlong = _mm_cmpeq_epi16(_mm_and_si128(lane, _mm_set1_epi16(0x1E)), _mm_setzero_si128());
+			if (_mm_movemask_epi8(_mm_andnot_si128(overlong, check)) != 0xFFFF) { return false; }
+
+			const __m128i u32Char = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(lane, _mm_set1_epi16(0x1F)), 6), _mm_and_si128(_mm_srli_epi16(lane, 8), _mm_set1_epi16(0x3F)));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(u16), u32Char);
+			return true;
+#elif UNICODE_SIMD_NEON
+			const uint16x8_t lane  = vreinterpretq_u16_u8(vld1q_u8(reinterpret_cast<const std::uint8_t*>(u8)));
+			const uint16x8_t check = vceqq_u16(vandq_u16(lane, vdupq_n_u16(0xC0E0)), vdupq_n_u16(0x80C0));
+			const uint16x8_t valid = vandq_u16(check, vtstq_u16(lane, vdupq_n_u16(0x1E)));
+			if (vminvq_u16(valid) != 0xFFFF) { return false; }
+
+			vst1q_u16(reinterpret_cast<std::uint16_t*>(u16), vorrq_u16(vshlq_n_u16(vandq_u16(lane, vdupq_n_u16(0x1F)), 6), vandq_u16(vshrq_n_u16(lane, 8), vdupq_n_u16(0x3F))));
+			return true;
+#else
+			(void)u8; (void)u16;
+			return false;
+#endif
+		}
+
+		/*-------------------------------------------------------------------
+		-   12 bytes of four 3 byte sequences -> 4 code points (U+0800 - U+FFFF, no surrogate). 16 bytes must be readable.
+		-   Kana and CJK are in this range, so the Japanese text mostly goes through here.
+		---------------------------------------------------------------------*/
+#if PLATFORM_CPU_INSTRUCTION_SSSE3 || UNICODE_SIMD_NEON
+		#define UNICODE_SIMD_THREE_BYTE 1
+#else
+		#define UNICODE_SIMD_THREE_BYTE 0
+#endif
+
+		template<class CharType>
+		inline bool DecodeThreeByteRun(const char* u8, CharType* output)
+		{
+#if PLATFORM_CPU_INSTRUCTION_SSSE3
+			// 32 bit lane = trail | middle << 8 | lead << 16
+			const __m128i shuffle = _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1);
+			const __m128i lane    = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(u8)), shuffle);
+			const __m128i check   = _mm_cmpeq_epi32(_mm_and_si128(lane, _mm_set1_epi32(0xF0C0C0)), _mm_set1_epi32(0xE08080));
+
+			const __m128i u32Char = _mm_or_si128(_mm_or_si128(
+				_mm_and_si128(lane, _mm_set1_epi32(0x3F)),
+				_mm_and_si128(_mm_srli_epi32(lane, 2), _mm_set1_epi32(0xFC0))),
+				_mm_and_si128(_mm_srli_epi32(lane, 4), _mm_set1_epi32(0xF000)));
+
+			const __m128i overlong  = _mm_cmplt_epi32(u32Char, _mm_set1_epi32(0x800));
+			const __m128i surrogate = _mm_cmpeq_epi32(_mm_and_si128(u32Char, _mm_set1_epi32(0xF800)), _mm_set1_epi32(0xD800));
+			if (_mm_movemask_epi8(_mm_andnot_si128(_mm_or_si128(overlong, surrogate), check)) != 0xFFFF) { return false; }
+
+			if constexpr (sizeof(CharType) == sizeof(char16_t))
+			{
+				const __m128i pack = _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1);
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(output), _mm_shuffle_epi8(u32Char, pack));
+			}
+			else
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(output), u32Char);
+			}
+			return true;
+#elif UNICODE_SIMD_NEON
+			static const std::uint8_t shuffleTable[16] = { 2, 1, 0, 0xFF, 5, 4, 3, 0xFF, 8, 7, 6, 0xFF, 11, 10, 9, 0xFF };
+			const uint32x4_t lane  = vreinterpretq_u32_u8(vqtbl1q_u8(vld1q_u8(reinterpret_cast<const std::uint8_t*>(u8)), vld1q_u8(shuffleTable)));
+			const uint32x4_t check = vceqq_u32(vandq_u32(lane, vdupq_n_u32(0xF0C0C0)), vdupq_n_u32(0xE08080));
+
+			const uint32x4_t u32Char = vorrq_u32(vorrq_u32(
+				vandq_u32(lane, vdupq_n_u32(0x3F)),
+				vandq_u32(vshrq_n_u32(lane, 2), vdupq_n_u32(0xFC0))),
+				vandq_u32(vshrq_n_u32(lane, 4), vdupq_n_u32(0xF000)));
+
+			const uint32x4_t overlong  = vcltq_u32(u32Char, vdupq_n_u32(0x800));
+			const uint32x4_t surrogate = vceqq_u32(vandq_u32(u32Char, vdupq_n_u32(0xF800)), vdupq_n_u32(0xD800));
+			if (vminvq_u32(vbicq_u32(check, vorrq_u32(overlong, surrogate))) != 0xFFFFFFFF) { return false; }
+
+			if constexpr (sizeof(CharType) == sizeof(char16_t))
+			{
+				vst1_u16(reinterpret_cast<std::uint16_t*>(output), vmovn_u32(u32Char));
+			}
+			else
+			{
+				vst1q_u32(reinterpret_cast<std::uint32_t*>(output), u32Char);
+			}
+			return true;
+#else
+			(void)u8; (void)output;
+			return false;
+#endif
+		}
+
+		/*-------------------------------------------------------------------
+		-   8 UTF-16 code units without surrogate -> UTF-8.
+		-   The bytes of each code point are built in the 32 bit lane, then stored with the variable stride.
+		-   Return the written byte count, or 0 if the block has the surrogate. 25 bytes must be writable.
+		---------------------------------------------------------------------*/
+		inline std::uint32_t EncodeU16BlockToU8(const char16_t* u16, char* u8)
+		{
+			alignas(16) std::uint32_t words  [8] = {};
+			alignas(16) std::uint32_t lengths[8] = {};
+#if PLATFORM_CPU_INSTRUCTION_SSE2
+			const __m128i value     = _mm_loadu_si128(reinterpret_cast<const __m128i*>(u16));
+			const __m128i surrogate = _mm_cmpeq_epi16(_mm_and_si128(value, _mm_set1_epi16(short(0xF800))), _mm_set1_epi16(short(0xD800)));
+			if (_mm_movemask_epi8(surrogate) != 0) { return 0; }
+
+			// ASCII
+			if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(value, _mm_set1_epi16(short(0xFF80))), _mm_setzero_si128())) == 0xFFFF)
+			{
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(u8), _mm_packus_epi16(value, value));
+				return 8;
+			}
+
+			const __m128i zero = _mm_setzero_si128();
+			for (int half = 0; half < 2; ++half)
+			{
+				const __m128i c      = half == 0 ? _mm_unpacklo_epi16(value, zero) : _mm_unpackhi_epi16(value, zero);
+				const __m128i byte0  = _mm_and_si128(c, _mm_set1_epi32(0x3F));
+				const __m128i byte1  = _mm_and_si128(_mm_srli_epi32(c, 6), _mm_set1_epi32(0x3F));
+				const __m128i two    = _mm_or_si128(_mm_or_si128(_mm_set1_epi32(0x80C0), _mm_srli_epi32(c, 6)), _mm_slli_epi32(byte0, 8));
+				const __m128i three  = _mm_or_si128(_mm_or_si128(_mm_set1_epi32(0x8080E0), _mm_srli_epi32(c, 12)),
+				                       _mm_or_si128(_mm_slli_epi32(byte1, 8), _mm_slli_epi32(byte0, 16)));
+				const __m128i isOne  = _mm_cmplt_epi32(c, _mm_set1_epi32(0x80));
+				const __m128i isTwo  = _mm_cmplt_epi32(c, _mm_set1_epi32(0x800));
+
+				const __m128i word   = _mm_or_si128(_mm_and_si128(isOne, c),
+				                       _mm_or_si128(_mm_and_si128(_mm_andnot_si128(isOne, isTwo), two), _mm_andnot_si128(isTwo, three)));
+				const __m128i length = _mm_add_epi32(_mm_set1_epi32(3), _mm_add_epi32(isOne, isTwo));
+				_mm_store_si128(reinterpret_cast<__m128i*>(words   + 4 * half), word);
+				_mm_store_si128(reinterpret_cast<__m128i*>(lengths + 4 * half), length);
+			}
+#elif UNICODE_SIMD_NEON
+			const uint16x8_t value = vld1q_u16(reinterpret_cast<const std::uint16_t*>(u16));
+			if (vmaxvq_u16(vceqq_u16(vandq_u16(value, vdupq_n_u16(0xF800)), vdupq_n_u16(0xD800))) != 0) { return 0; }
+
+			if (vmaxvq_u16(value) < 0x80)
+			{
+				vst1_u8(reinterpret_cast<std::uint8_t*>(u8), vmovn_u16(value));
+				return 8;
+			}
+
+			for (int half = 0; half < 2; ++half)
+			{
+				const uint32x4_t c      = half == 0 ? vmovl_u16(vget_low_u16(value)) : vmovl_u16(vget_high_u16(value));
+				const uint32x4_t byte0  = vandq_u32(c, vdupq_n_u32(0x3F));
+				const uint32x4_t byte1  = vandq_u32(vshrq_n_u32(c, 6), vdupq_n_u32(0x3F));
+				const uint32x4_t two    = vorrq_u32(vorrq_u32(vdupq_n_u32(0x80C0), vshrq_n_u32(c, 6)), vshlq_n_u32(byte0, 8));
+				const uint32x4_t three  = vorrq_u32(vorrq_u32(vdupq_n_u32(0x8080E0), vshrq_n_u32(c, 12)), vorrq_u32(vshlq_n_u32(byte1, 8), vshlq_n_u32(byte0, 16)));
+				const uint32x4_t isOne  = vcltq_u32(c, vdupq_n_u32(0x80));
+				const uint32x4_t isTwo  = vcltq_u32(c, vdupq_n_u32(0x800));
+
+				const uint32x4_t word   = vbslq_u32(isOne, c, vbslq_u32(isTwo, two, three));
+				const uint32x4_t length = vaddq_u32(vdupq_n_u32(3), vaddq_u32(isOne, isTwo));
+				vst1q_u32(words   + 4 * half, word);
+				vst1q_u32(lengths + 4 * half, length);
+			}
+#else
+			for (int i = 0; i < 8; ++i)
+			{
+				const char32_t c = u16[i];
+				if (0xD800 <= c && c < 0xE000) { return 0; }
+				lengths[i] = EncodeU8(c, reinterpret_cast<char*>(&words[i]));
+			}
+#endif
+			std::uint32_t written = 0;
+			for (int i = 0; i < 8; ++i)
+			{
+				std::memcpy(u8 + written, &words[i], sizeof(std::uint32_t));
+				written += lengths[i];
+			}
+			return written;
+		}
+
+		/*-------------------------------------------------------------------
+		-   4 UTF-32 code points -> UTF-8. Return 0 if the block has the invalid code point. 17 bytes must be writable.
+		---------------------------------------------------------------------*/
+		inline std::uint32_t EncodeU32BlockToU8(const char32_t* u32, char* u8)
+		{
+			alignas(16) std::uint32_t words  [4] = {};
+			alignas(16) std::uint32_t lengths[4] = {};
+#if PLATFORM_CPU_INSTRUCTION_SSE2
+			const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(u32));
+			// unsigned range check : c >> 16 fits in the signed compare
+			const __m128i outOfRange = _mm_cmpgt_epi32(_mm_srli_epi32(c, 16), _mm_set1_epi32(0x10));
+			const __m128i surrogate  = _mm_cmpeq_epi32(_mm_and_si128(c, _mm_set1_epi32(int(0xFFFFF800))), _mm_set1_epi32(0xD800));
+			if (_mm_movemask_epi8(_mm_or_si128(outOfRange, surrogate)) != 0) { return 0; }
+
+			const __m128i byte0  = _mm_and_si128(c, _mm_set1_epi32(0x3F));
+			const __m128i byte1  = _mm_and_si128(_mm_srli_epi32(c, 6) , _mm_set1_epi32(0x3F));
+			const __m128i byte2  = _mm_and_si128(_mm_srli_epi32(c, 12), _mm_set1_epi32(0x3F));
+			const __m128i two    = _mm_or_si128(_mm_or_si128(_mm_set1_epi32(0x80C0), _mm_srli_epi32(c, 6)), _mm_slli_epi32(byte0, 8));
+			const __m128i three  = _mm_or_si128(_mm_or_si128(_mm_set1_epi32(0x8080E0), _mm_srli_epi32(c, 12)),
+			                       _mm_or_si128(_mm_slli_epi32(byte1, 8), _mm_slli_epi32(byte0, 16)));
+			const __m128i four   = _mm_or_si128(_mm_or_si128(_mm_set1_epi32(int(0x808080F0)), _mm_srli_epi32(c, 18)),
+			                       _mm_or_si128(_mm_slli_epi32(byte2, 8), _mm_or_si128(_mm_slli_epi32(byte1, 16), _mm_slli_epi32(byte0, 24))));
+			const __m128i isOne   = _mm_cmplt_epi32(c, _mm_set1_epi32(0x80));
+			const __m128i isTwo   = _mm_cmplt_epi32(c, _mm_set1_epi32(0x800));
+			const __m128i isThree = _mm_cmplt_epi32(c, _mm_set1_epi32(0x10000));
+
+			const __m128i word = _mm_or_si128(
+				_mm_or_si128(_mm_and_si128(isOne, c), _mm_and_si128(_mm_andnot_si128(isOne, isTwo), two)),
+				_mm_or_si128(_mm_and_si128(_mm_andnot_si128(isTwo, isThree), three), _mm_andnot_si128(isThree, four)));
+			const __m128i length = _mm_add_epi32(_mm_set1_epi32(4), _mm_add_epi32(isOne, _mm_add_epi32(isTwo, isThree)));
+			_mm_store_si128(reinterpret_cast<__m128i*>(words)  , word);
+			_mm_store_si128(reinterpret_cast<__m128i*>(lengths), length);
+#elif UNICODE_SIMD_NEON
+			const uint32x4_t c = vld1q_u32(reinterpret_cast<const std::uint32_t*>(u32));
+			const uint32x4_t outOfRange = vcgtq_u32(c, vdupq_n_u32(0x10FFFF));
+			const uint32x4_t surrogate  = vceqq_u32(vandq_u32(c, vdupq_n_u32(0xFFFFF800)), vdupq_n_u32(0xD800));
+			if (vmaxvq_u32(vorrq_u32(outOfRange, surrogate)) != 0) { return 0; }
+
+			const uint32x4_t byte0  = vandq_u32(c, vdupq_n_u32(0x3F));
+			const uint32x4_t byte1  = vandq_u32(vshrq_n_u32(c, 6) , vdupq_n_u32(0x3F));
+			const uint32x4_t byte2  = vandq_u32(vshrq_n_u32(c, 12), vdupq_n_u32(0x3F));
+			const uint32x4_t two    = vorrq_u32(vorrq_u32(vdupq_n_u32(0x80C0), vshrq_n_u32(c, 6)), vshlq_n_u32(byte0, 8));
+			const uint32x4_t three  = vorrq_u32(vorrq_u32(vdupq_n_u32(0x8080E0), vshrq_n_u32(c, 12)), vorrq_u32(vshlq_n_u32(byte1, 8), vshlq_n_u32(byte0, 16)));
+			const uint32x4_t four   = vorrq_u32(vorrq_u32(vdupq_n_u32(0x808080F0), vshrq_n_u32(c, 18)),
+			                          vorrq_u32(vshlq_n_u32(byte2, 8), vorrq_u32(vshlq_n_u32(byte1, 16), vshlq_n_u32(byte0, 24))));
+			const uint32x4_t isOne   = vcltq_u32(c, vdupq_n_u32(0x80));
+			const uint32x4_t isTwo   = vcltq_u32(c, vdupq_n_u32(0x800));
+			const uint32x4_t isThree = vcltq_u32(c, vdupq_n_u32(0x10000));
+
+			vst1q_u32(words  , vbslq_u32(isOne, c, vbslq_u32(isTwo, two, vbslq_u32(isThree, three, four))));
+			vst1q_u32(lengths, vaddq_u32(vdupq_n_u32(4), vaddq_u32(isOne, vaddq_u32(isTwo, isThree))));
+#else
+			for (int i = 0; i < 4; ++i)
+			{
+				if (!IsValidCodePoint(u32[i])) { return 0; }
+				lengths[i] = EncodeU8(u32[i], reinterpret_cast<char*>(&words[i]));
+			}
+#endif
+			std::uint32_t written = 0;
+			for (int i = 0; i < 4; ++i)
+			{
+				std::memcpy(u8 + written, &words[i], sizeof(std::uint32_t));
+				written += lengths[i];
+			}
+			return written;
+		}
+
+		/*-------------------------------------------------------------------
+		-   8 UTF-16 code units without surrogate -> 8 code points
+		---------------------------------------------------------------------*/
+		inline bool WidenU16Block(const char16_t* u16, char32_t* u32)
+		{
+#if PLATFORM_CPU_INSTRUCTION_SSE2
+			const __m128i value     = _mm_loadu_si128(reinterpret_cast<const __m128i*>(u16));
+			const __m128i surrogate = _mm_cmpeq_epi16(_mm_and_si128(value, _mm_set1_epi16(short(0xF800))), _mm_set1_epi16(short(0xD800)));
+			if (_mm_movemask_epi8(surrogate) != 0) { return false; }
+
+			const __m128i zero = _mm_setzero_si128();
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(u32)    , _mm_unpacklo_epi16(value, zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(u32 + 4), _mm_unpackhi_epi16(value, zero));
+			return true;
+#elif UNICODE_SIMD_NEON
+			const uint16x8_t value = vld1q_u16(reinterpret_cast<const std::uint16_t*>(u16));
+			if (vmaxvq_u16(vceqq_u16(vandq_u16(value, vdupq_n_u16(0xF800)), vdupq_n_u16(0xD800))) != 0) { return false; }
+
+			vst1q_u32(reinterpret_cast<std::uint32_t*>(u32)    , vmovl_u16(vget_low_u16(value)));
+			vst1q_u32(reinterpret_cast<std::uint32_t*>(u32 + 4), vmovl_u16(vget_high_u16(value)));
+			return true;
+#else
+			for (int i = 0; i < 8; ++i)
+			{
+				if (0xD800 <= u16[i] && u16[i] < 0xE000) { return false; }
+			}
+			for (int i = 0; i < 8; ++i) { u32[i] = u16[i]; }
+			return true;
+#endif
+		}
+
+		/*-------------------------------------------------------------------
+		-   8 BMP code points (no surrogate) -> 8 UTF-16 code units
+		---------------------------------------------------------------------*/
+		inline bool NarrowU32Block(const char32_t* u32, char16_t* u16)
+		{
+#if PLATFORM_CPU_INSTRUCTION_SSE2
+			const __m128i low  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(u32));
+			const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(u32 + 4));
+			const __m128i mask = _mm_set1_epi32(int(0xFFFFF800));
+			const __m128i invalid = _mm_or_si128(
+				_mm_or_si128(_mm_cmpeq_epi32(_mm_and_si128(low , mask), _mm_set1_epi32(0xD800)), _mm_cmpeq_epi32(_mm_and_si128(high, mask), _mm_set1_epi32(0xD800))),
+				_mm_xor_si128(_mm_cmpeq_epi32(_mm_srli_epi32(_mm_or_si128(low, high), 16), _mm_setzero_si128()), _mm_set1_epi32(-1)));
+			if (_mm_movemask_epi8(invalid) != 0) { return false; }
+
+			// values fit in 16 bit : sign trick for packs_epi32 (SSE2 has no unsigned pack)
+			const __m128i bias = _mm_set1_epi32(0x8000);
+			const __m128i pack = _mm_packs_epi32(_mm_sub_epi32(low, bias), _mm_sub_epi32(high, bias));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(u16), _mm_add_epi16(pack, _mm_set1_epi16(short(0x8000))));
+			return true;
+#elif UNICODE_SIMD_NEON
+			const uint32x4_t low  = vld1q_u32(reinterpret_cast<const std::uint32_t*>(u32));
+			const uint32x4_t high = vld1q_u32(reinterpret_cast<const std::uint32_t*>(u32 + 4));
+			const uint32x4_t mask = vdupq_n_u32(0xFFFFF800);
+			const uint32x4_t invalid = vorrq_u32(
+				vorrq_u32(vceqq_u32(vandq_u32(low, mask), vdupq_n_u32(0xD800)), vceqq_u32(vandq_u32(high, mask), vdupq_n_u32(0xD800))),
+				vcgtq_u32(vorrq_u32(low, high), vdupq_n_u32(0xFFFF)));
+			if (vmaxvq_u32(invalid) != 0) { return false; }
+
+			vst1q_u16(reinterpret_cast<std::uint16_t*>(u16), vcombine_u16(vmovn_u32(low), vmovn_u32(high)));
+			return true;
+#else
+			for (int i = 0; i < 8; ++i)
+			{
+				if (u32[i] > 0xFFFF || (0xD800 <= u32[i] && u32[i] < 0xE000)) { return false; }
+			}
+			for (int i = 0; i < 8; ++i) { u16[i] = char16_t(u32[i]); }
+			return true;
+#endif
+		}
+
+		/*-------------------------------------------------------------------
+		-   UTF-8 -> UTF-16 / UTF-32 common loop
+		---------------------------------------------------------------------*/
+		template<class CharType>
+		ConvertResult DecodeU8String(const char* u8String, const std::uint64_t length, CharType* output, const std::uint64_t capacity)
+		{
+			constexpr bool IS_U16 = sizeof(CharType) == sizeof(char16_t);
+
+			ConvertResult result = {};
+			std::uint64_t read    = 0;
+			std::uint64_t written = 0;
+
+			while (read < length)
+			{
+				/*-------------------------------------------------------------------
+				-             SIMD block
+				---------------------------------------------------------------------*/
+				if (length - read >= SIMD_BYTE_COUNT)
+				{
+					const std::uint32_t nonAscii = GetNonAsciiMask(u8String + read);
+					if (nonAscii == 0)
+					{
+						if (capacity - written < SIMD_BYTE_COUNT) { break; }
+						WidenAscii(u8String + read, output + written);
+						read += SIMD_BYTE_COUNT; written += SIMD_BYTE_COUNT;
+						continue;
+					}
+
+					// Leading ASCII
+					const std::uint32_t asciiCount = CountTrailingZeros(nonAscii);
+					if (asciiCount > 0)
+					{
+						if (capacity - written < asciiCount) { break; }
+						for (std::uint32_t i = 0; i < asciiCount; ++i) { output[written + i] = CharType(std::uint8_t(u8String[read + i])); }
+						read += asciiCount; written += asciiCount;
+						continue;
+					}
+
+					const std::uint8_t lead = std::uint8_t(u8String[read]);
+					if constexpr (IS_U16)
+					{
+						if ((lead & 0xE0) == 0xC0 && capacity - written >= 8 && DecodeTwoByteRun(u8String + read, output + written))
+						{
+							read += 16; written += 8;
+							continue;
+						}
+					}
+#if UNICODE_SIMD_THREE_BYTE
+					if ((lead & 0xF0) == 0xE0 && capacity - written >= 4 && DecodeThreeByteRun(u8String + read, output + written))
+					{
+						read += 12; written += 4;
+						continue;
+					}
+#endif
+				}
+
+				/*-------------------------------------------------------------------
+				-             Scalar : one sequence
+				---------------------------------------------------------------------*/
+				char32_t u32Char = 0;
+				const auto byteCount = DecodeU8(reinterpret_cast<const std::uint8_t*>(u8String + read), length - read, u32Char);
+				if (byteCount == 0) { break; }
+
+				if constexpr (IS_U16)
+				{
+					if (u32Char >= 0x10000)
+					{
+						if (capacity - written < 2) { break; }
+						output[written++] = char16_t(((u32Char - 0x10000) >> 10) + 0xD800);
+						output[written++] = char16_t(((u32Char - 0x10000) & 0x3FF) + 0xDC00);
+					}
+					else
+					{
+						if (capacity - written < 1) { break; }
+						output[written++] = char16_t(u32Char);
+					}
+				}
+				else
+				{
+					if (capacity - written < 1) { break; }
+					output[written++] = u32Char;
+				}
+				read += byteCount;
+			}
+
+			result.IsSucceeded  = read == length;
+			result.ReadCount    = read;
+			result.WrittenCount = written;
+			return result;
+		}
 	}
 
 	/****************************************************************************
@@ -95,33 +695,27 @@ namespace unicode
 		/*-------------------------------------------------------------------
 		-              wchar_t <=> char_16_t
 		---------------------------------------------------------------------*/
-		size_t wcharSize = 0; wcharSize = sizeof(wchar_t);
-		if (wcharSize == sizeof(char16_t))
+		if constexpr (sizeof(wchar_t) == sizeof(char16_t))
 		{
-			std::u16string utf16String;
-			if (!ConvertU8ToU16(utf8String, utf16String))
-			{
-				return false;
-			}
-			wString = reinterpret_cast<const wchar_t*>(utf16String.c_str());
+			wString.resize(GetU16LengthFromU8(utf8String.data(), utf8String.size()));
+			const auto result = ConvertU8ToU16(utf8String.data(), utf8String.size(), reinterpret_cast<char16_t*>(wString.data()), wString.size());
+			wString.resize(result.WrittenCount);
+			return result.IsSucceeded;
 		}
 		/*-------------------------------------------------------------------
 		-              wchar_t <=> char_32_t
 		---------------------------------------------------------------------*/
-		else if (wcharSize == sizeof(char32_t))
+		else if constexpr (sizeof(wchar_t) == sizeof(char32_t))
 		{
-			std::u32string utf32String;
-			if (!ConvertU8ToU32(utf8String, utf32String))
-			{
-				return false;
-			}
-			wString = reinterpret_cast<const wchar_t*>(utf32String.c_str());
+			wString.resize(GetU32LengthFromU8(utf8String.data(), utf8String.size()));
+			const auto result = ConvertU8ToU32(utf8String.data(), utf8String.size(), reinterpret_cast<char32_t*>(wString.data()), wString.size());
+			wString.resize(result.WrittenCount);
+			return result.IsSucceeded;
 		}
 		/*-------------------------------------------------------------------
 		-              Error check
 		---------------------------------------------------------------------*/
 		else { return false; }
-		return true;
 	}
 
 	/****************************************************************************
@@ -140,28 +734,27 @@ namespace unicode
 		---------------------------------------------------------------------*/
 		if constexpr(sizeof(wchar_t) == sizeof(char16_t))
 		{
-			const char16_t* utf16String = reinterpret_cast<const char16_t*>(wString.c_str());
-			if (!ConvertU16ToU8(utf16String, utf8String))
-			{
-				return false;
-			}
+			const char16_t* utf16String = reinterpret_cast<const char16_t*>(wString.data());
+			utf8String.resize(GetU8LengthFromU16(utf16String, wString.size()));
+			const auto result = ConvertU16ToU8(utf16String, wString.size(), utf8String.data(), utf8String.size());
+			utf8String.resize(result.WrittenCount);
+			return result.IsSucceeded;
 		}
 		/*-------------------------------------------------------------------
 		-              wchar_t <=> char_32_t
 		---------------------------------------------------------------------*/
 		else if constexpr(sizeof(wchar_t) == sizeof(char32_t))
 		{
-			const char32_t* utf32String = reinterpret_cast<const char32_t*>(wString.c_str());
-			if (!ConvertU32ToU8(utf32String, utf8String))
-			{
-				return false;
-			}
+			const char32_t* utf32String = reinterpret_cast<const char32_t*>(wString.data());
+			utf8String.resize(GetU8LengthFromU32(utf32String, wString.size()));
+			const auto result = ConvertU32ToU8(utf32String, wString.size(), utf8String.data(), utf8String.size());
+			utf8String.resize(result.WrittenCount);
+			return result.IsSucceeded;
 		}
 		/*-------------------------------------------------------------------
 		-              Error check
 		---------------------------------------------------------------------*/
 		else{ return false; }
-		return true;
 	}
 
 	/****************************************************************************
@@ -402,30 +995,10 @@ namespace unicode
 	*****************************************************************************/
 	bool ConvertU8ToU16(const std::string& u8String, std::u16string& u16String)
 	{
-		for (auto u8It = u8String.begin(); u8It != u8String.end(); ++u8It)
-		{
-			auto numBytes = GetU8ByteCount((*u8It));
-			if (numBytes == 0) { return false; }
-
-			gu::StaticArray<char, 4> u8Char = {};
-			u8Char[0] = (*u8It);
-			for (int i = 1; i < numBytes; i++)
-			{
-				++u8It;
-				if (u8It == u8String.end()) { return false; }
-				u8Char[i] = (*u8It);
-			}
-
-			gu::StaticArray<char16_t, 2> u16Char;
-			if (!ConvertCharU8ToU16(u8Char, u16Char)) { return false; }
-
-			u16String.push_back(u16Char[0]);
-			if (u16Char[1] != 0)
-			{
-				u16String.push_back(u16Char[1]);
-			}
-		}
-		return true;
+		u16String.resize(GetU16LengthFromU8(u8String.data(), u8String.size()));
+		const auto result = ConvertU8ToU16(u8String.data(), u8String.size(), u16String.data(), u16String.size());
+		u16String.resize(result.WrittenCount);
+		return result.IsSucceeded;
 	}
 
 	/****************************************************************************
@@ -439,26 +1012,10 @@ namespace unicode
 	*****************************************************************************/
 	bool ConvertU8ToU32(const std::string& u8String, std::u32string& u32String)
 	{
-		for (auto u8It = u8String.begin(); u8It != u8String.end(); ++u8It)
-		{
-			auto numBytes = GetU8ByteCount((*u8It));
-			if (numBytes == 0) { return false; }
-
-			gu::StaticArray<char, 4> u8Char = {};
-			u8Char[0] = (*u8It);
-			for (int i = 1; i < numBytes; i++)
-			{
-				++u8It;
-				if (u8It == u8String.end()){ return false; }
-				u8Char[i] = (*u8It);
-			}
-
-			char32_t u32Char;
-			if (!ConvertCharU8ToU32(u8Char, u32Char)) { return false; }
-
-			u32String.push_back(u32Char);
-		}
-		return true;
+		u32String.resize(GetU32LengthFromU8(u8String.data(), u8String.size()));
+		const auto result = ConvertU8ToU32(u8String.data(), u8String.size(), u32String.data(), u32String.size());
+		u32String.resize(result.WrittenCount);
+		return result.IsSucceeded;
 	}
 
 	/****************************************************************************
@@ -472,30 +1029,10 @@ namespace unicode
 	*****************************************************************************/
 	bool ConvertU16ToU8(const std::u16string& u16String, std::string& u8String)
 	{
-		for (auto u16It = u16String.begin(); u16It != u16String.end(); ++u16It)
-		{
-			gu::StaticArray<char16_t, 2> u16Char = {};
-			if (IsU16HighSurrogate((*u16It)))
-			{
-				u16Char[0] = (*u16It);
-				++u16It;
-				if (u16It == u16String.end()) { return false; }
-				u16Char[1] = (*u16It);
-			}
-			else
-			{
-				u16Char[0] = (*u16It);
-				u16Char[1] = 0;
-			}
-
-			gu::StaticArray<char, 4> u8Char;
-			if (!ConvertCharU16ToU8(u16Char, u8Char)){ return false; }
-			if (u8Char[0] != 0) { u8String.push_back(u8Char[0]); }
-			if (u8Char[1] != 0) { u8String.push_back(u8Char[1]); }
-			if (u8Char[2] != 0) { u8String.push_back(u8Char[2]); }
-			if (u8Char[3] != 0) { u8String.push_back(u8Char[3]); }
-		}
-		return true;
+		u8String.resize(GetU8LengthFromU16(u16String.data(), u16String.size()));
+		const auto result = ConvertU16ToU8(u16String.data(), u16String.size(), u8String.data(), u8String.size());
+		u8String.resize(result.WrittenCount);
+		return result.IsSucceeded;
 	}
 
 	/****************************************************************************
@@ -509,27 +1046,10 @@ namespace unicode
 	*****************************************************************************/
 	bool ConvertU16ToU32(const std::u16string& u16String, std::u32string& u32String)
 	{
-		for (auto u16It = u16String.begin(); u16It != u16String.end(); ++u16It)
-		{
-			gu::StaticArray<char16_t, 2> u16Char = {};
-			if (IsU16HighSurrogate((*u16It)))
-			{
-				u16Char[0] = (*u16It);
-				++u16It;
-				if (u16It == u16String.end()) { return false; }
-				u16Char[1] = (*u16It);
-			}
-			else
-			{
-				u16Char[0] = (*u16It);
-				u16Char[1] = 0;
-			}
-
-			char32_t u32Char;
-			if (!ConvertCharU16ToU32(u16Char, u32Char)) { return false; }
-			u32String.push_back(u32Char);
-		}
-		return true;
+		u32String.resize(GetU32LengthFromU16(u16String.data(), u16String.size()));
+		const auto result = ConvertU16ToU32(u16String.data(), u16String.size(), u32String.data(), u32String.size());
+		u32String.resize(result.WrittenCount);
+		return result.IsSucceeded;
 	}
 
 	/****************************************************************************
@@ -543,17 +1063,10 @@ namespace unicode
 	*****************************************************************************/
 	bool ConvertU32ToU8(const std::u32string& u32String, std::string& u8String)
 	{
-		for (auto u32It = u32String.begin(); u32It != u32String.end(); ++u32It)
-		{
-			gu::StaticArray<char, 4> u8Char;
-			if (!ConvertCharU32ToU8((*u32It), u8Char)) { return false; }
-
-			if (u8Char[0] != 0) { u8String.push_back(u8Char[0]); }
-			if (u8Char[1] != 0) { u8String.push_back(u8Char[1]); }
-			if (u8Char[2] != 0) { u8String.push_back(u8Char[2]); }
-			if (u8Char[3] != 0) { u8String.push_back(u8Char[3]); }
-		}
-		return true;
+		u8String.resize(GetU8LengthFromU32(u32String.data(), u32String.size()));
+		const auto result = ConvertU32ToU8(u32String.data(), u32String.size(), u8String.data(), u8String.size());
+		u8String.resize(result.WrittenCount);
+		return result.IsSucceeded;
 	}
 
 	/****************************************************************************
@@ -567,20 +1080,325 @@ namespace unicode
 	*****************************************************************************/
 	bool ConvertU32ToU16(const std::u32string& u32String, std::u16string& u16String)
 	{
-		for (auto u32It = u32String.begin(); u32It != u32String.end(); ++u32It)
+		u16String.resize(GetU16LengthFromU32(u32String.data(), u32String.size()));
+		const auto result = ConvertU32ToU16(u32String.data(), u32String.size(), u16String.data(), u16String.size());
+		u16String.resize(result.WrittenCount);
+		return result.IsSucceeded;
+	}
+
+	/****************************************************************************
+	*                            ConvertU8ToU16
+	*************************************************************************//**
+	*  @fn         ConvertResult ConvertU8ToU16(const char* u8String, const std::uint64_t length, char16_t* u16String, const std::uint64_t capacity)
+	*  @brief      Bulk UTF-8 -> UTF-16 into the caller buffer
+	*  @param[in]  const char* u8String
+	*  @param[in]  const std::uint64_t length
+	*  @param[out] char16_t* u16String
+	*  @param[in]  const std::uint64_t capacity
+	*  @return @@ ConvertResult
+	*****************************************************************************/
+	ConvertResult ConvertU8ToU16(const char* u8String, const std::uint64_t length, char16_t* u16String, const std::uint64_t capacity)
+	{
+		return DecodeU8String(u8String, length, u16String, capacity);
+	}
+
+	ConvertResult ConvertU8ToU32(const char* u8String, const std::uint64_t length, char32_t* u32String, const std::uint64_t capacity)
+	{
+		return DecodeU8String(u8String, length, u32String, capacity);
+	}
+
+	/****************************************************************************
+	*                            ConvertU16ToU8
+	*************************************************************************//**
+	*  @fn         ConvertResult ConvertU16ToU8(const char16_t* u16String, const std::uint64_t length, char* u8String, const std::uint64_t capacity)
+	*  @brief      Bulk UTF-16 -> UTF-8 into the caller buffer
+	*  @param[in]  const char16_t* u16String
+	*  @param[in]  const std::uint64_t length
+	*  @param[out] char* u8String
+	*  @param[in]  const std::uint64_t capacity
+	*  @return @@ ConvertResult
+	*****************************************************************************/
+	ConvertResult ConvertU16ToU8(const char16_t* u16String, const std::uint64_t length, char* u8String, const std::uint64_t capacity)
+	{
+		std::uint64_t read    = 0;
+		std::uint64_t written = 0;
+
+		while (read < length)
 		{
-			gu::StaticArray<char16_t, 2> u16Char;
-			if (!ConvertCharU32ToU16((*u32It), u16Char)) { return false; }
+			if (length - read >= 8 && capacity - written >= 25)
+			{
+				const auto byteCount = EncodeU16BlockToU8(u16String + read, u8String + written);
+				if (byteCount != 0)
+				{
+					read += 8; written += byteCount;
+					continue;
+				}
+			}
+
+			char32_t u32Char = 0;
+			const auto unitCount = DecodeU16(u16String + read, length - read, u32Char);
+			if (unitCount == 0) { break; }
 
-			if (u16Char[0] != 0)
+			const auto byteCount = GetU8ByteCountFromU32(u32Char);
+			if (capacity - written < byteCount) { break; }
+
+			EncodeU8(u32Char, u8String + written);
+			read += unitCount; written += byteCount;
+		}
+		return { read == length, read, written };
+	}
+
+	ConvertResult ConvertU16ToU32(const char16_t* u16String, const std::uint64_t length, char32_t* u32String, const std::uint64_t capacity)
+	{
+		std::uint64_t read    = 0;
+		std::uint64_t written = 0;
+
+		while (read < length)
+		{
+			if (length - read >= 8 && capacity - written >= 8 && WidenU16Block(u16String + read, u32String + written))
 			{
-				u16String.push_back(u16Char[0]);
+				read += 8; written += 8;
+				continue;
 			}
-			if (u16Char[1] != 0)
+
+			char32_t u32Char = 0;
+			const auto unitCount = DecodeU16(u16String + read, length - read, u32Char);
+			if (unitCount == 0 || capacity - written < 1) { break; }
+
+			u32String[written++] = u32Char;
+			read += unitCount;
+		}
+		return { read == length, read, written };
+	}
+
+	/****************************************************************************
+	*                            ConvertU32ToU8
+	*************************************************************************//**
+	*  @fn         ConvertResult ConvertU32ToU8(const char32_t* u32String, const std::uint64_t length, char* u8String, const std::uint64_t capacity)
+	*  @brief      Bulk UTF-32 -> UTF-8 into the caller buffer
+	*  @param[in]  const char32_t* u32String
+	*  @param[in]  const std::uint64_t length
+	*  @param[out] char* u8String
+	*  @param[in]  const std::uint64_t capacity
+	*  @return @@ ConvertResult
+	*****************************************************************************/
+	ConvertResult ConvertU32ToU8(const char32_t* u32String, const std::uint64_t length, char* u8String, const std::uint64_t capacity)
+	{
+		std::uint64_t read    = 0;
+		std::uint64_t written = 0;
+
+		while (read < length)
+		{
+			if (length - read >= 4 && capacity - written >= 17)
 			{
-				u16String.push_back(u16Char[1]);
+				const auto byteCount = EncodeU32BlockToU8(u32String + read, u8String + written);
+				if (byteCount != 0)
+				{
+					read += 4; written += byteCount;
+					continue;
+				}
+			}
+
+			const char32_t u32Char = u32String[read];
+			if (!IsValidCodePoint(u32Char)) { break; }
+
+			const auto byteCount = GetU8ByteCountFromU32(u32Char);
+			if (capacity - written < byteCount) { break; }
+
+			EncodeU8(u32Char, u8String + written);
+			read += 1; written += byteCount;
+		}
+		return { read == length, read, written };
+	}
+
+	ConvertResult ConvertU32ToU16(const char32_t* u32String, const std::uint64_t length, char16_t* u16String, const std::uint64_t capacity)
+	{
+		std::uint64_t read    = 0;
+		std::uint64_t written = 0;
+
+		while (read < length)
+		{
+			if (length - read >= 8 && capacity - written >= 8 && NarrowU32Block(u32String + read, u16String + written))
+			{
+				read += 8; written += 8;
+				continue;
+			}
+
+			const char32_t u32Char = u32String[read];
+			if (!IsValidCodePoint(u32Char)) { break; }
+
+			if (u32Char >= 0x10000)
+			{
+				if (capacity - written < 2) { break; }
+				u16String[written++] = char16_t(((u32Char - 0x10000) >> 10) + 0xD800);
+				u16String[written++] = char16_t(((u32Char - 0x10000) & 0x3FF) + 0xDC00);
 			}
+			else
+			{
+				if (capacity - written < 1) { break; }
+				u16String[written++] = char16_t(u32Char);
+			}
+			read += 1;
+		}
+		return { read == length, read, written };
+	}
+
+	/****************************************************************************
+	*                            GetU16LengthFromU8
+	*************************************************************************//**
+	*  @fn         std::uint64_t GetU16LengthFromU8(const char* u8String, const std::uint64_t length)
+	*  @brief      Lead bytes + 4 byte lead bytes (surrogate pair). The input must be valid UTF-8.
+	*  @param[in]  const char* u8String
+	*  @param[in]  const std::uint64_t length
+	*  @return @@ std::uint64_t
+	*****************************************************************************/
+	std::uint64_t GetU16LengthFromU8(const char* u8String, const std::uint64_t length)
+	{
+		std::uint64_t count = 0;
+		std::uint64_t index = 0;
+#if PLATFORM_CPU_INSTRUCTION_SSE2
+		for (; index + SIMD_BYTE_COUNT <= length; index += SIMD_BYTE_COUNT)
+		{
+			const __m128i value        = _mm_loadu_si128(reinterpret_cast<const __m128i*>(u8String + index));
+			// signed byte : continuation is [-128, -65], 4 byte lead is [-16, -1]
+			const __m128i continuation = _mm_cmplt_epi8(value, _mm_set1_epi8(-64));
+			const __m128i fourByteLead = _mm_and_si128(_mm_cmpgt_epi8(value, _mm_set1_epi8(-17)), _mm_cmplt_epi8(value, _mm_setzero_si128()));
+			count += SIMD_BYTE_COUNT - PopCount(static_cast<std::uint32_t>(_mm_movemask_epi8(continuation)))
+			       + PopCount(static_cast<std::uint32_t>(_mm_movemask_epi8(fourByteLead)));
+		}
+#elif UNICODE_SIMD_NEON
+		for (; index + SIMD_BYTE_COUNT <= length; index += SIMD_BYTE_COUNT)
+		{
+			const uint8x16_t value        = vld1q_u8(reinterpret_cast<const std::uint8_t*>(u8String + index));
+			const uint8x16_t lead         = vshrq_n_u8(vmvnq_u8(vceqq_u8(vandq_u8(value, vdupq_n_u8(0xC0)), vdupq_n_u8(0x80))), 7);
+			const uint8x16_t fourByteLead = vshrq_n_u8(vcgeq_u8(value, vdupq_n_u8(0xF0)), 7);
+			count += vaddvq_u8(vaddq_u8(lead, fourByteLead));
+		}
+#endif
+		for (; index < length; ++index)
+		{
+			const std::uint8_t byte = std::uint8_t(u8String[index]);
+			count += ((byte & 0xC0) != 0x80) + (byte >= 0xF0);
+		}
+		return count;
+	}
+
+	std::uint64_t GetU32LengthFromU8(const char* u8String, const std::uint64_t length)
+	{
+		std::uint64_t count = 0;
+		std::uint64_t index = 0;
+#if PLATFORM_CPU_INSTRUCTION_SSE2
+		for (; index + SIMD_BYTE_COUNT <= length; index += SIMD_BYTE_COUNT)
+		{
+			const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(u8String + index));
+			count += SIMD_BYTE_COUNT - PopCount(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmplt_epi8(value, _mm_set1_epi8(-64)))));
+		}
+#elif UNICODE_SIMD_NEON
+		for (; index + SIMD_BYTE_COUNT <= length; index += SIMD_BYTE_COUNT)
+		{
+			const uint8x16_t value = vld1q_u8(reinterpret_cast<const std::uint8_t*>(u8String + index));
+			count += vaddvq_u8(vshrq_n_u8(vmvnq_u8(vceqq_u8(vandq_u8(value, vdupq_n_u8(0xC0)), vdupq_n_u8(0x80))), 7));
+		}
+#endif
+		for (; index < length; ++index)
+		{
+			count += (std::uint8_t(u8String[index]) & 0xC0) != 0x80;
+		}
+		return count;
+	}
+
+	/*-------------------------------------------------------------------
+	-   Branchless loops. Each surrogate of the pair counts 2 bytes (4 bytes in total).
+	---------------------------------------------------------------------*/
+	std::uint64_t GetU8LengthFromU16(const char16_t* u16String, const std::uint64_t length)
+	{
+		std::uint64_t count = 0;
+		for (std::uint64_t i = 0; i < length; ++i)
+		{
+			const char16_t c = u16String[i];
+			count += 1 + (c >= 0x80) + (c >= 0x800) - ((c & 0xF800) == 0xD800);
+		}
+		return count;
+	}
+
+	std::uint64_t GetU32LengthFromU16(const char16_t* u16String, const std::uint64_t length)
+	{
+		std::uint64_t count = 0;
+		for (std::uint64_t i = 0; i < length; ++i)
+		{
+			count += (u16String[i] & 0xFC00) != 0xDC00;
+		}
+		return count;
+	}
+
+	std::uint64_t GetU8LengthFromU32(const char32_t* u32String, const std::uint64_t length)
+	{
+		std::uint64_t count = 0;
+		for (std::uint64_t i = 0; i < length; ++i)
+		{
+			count += GetU8ByteCountFromU32(u32String[i]);
+		}
+		return count;
+	}
+
+	std::uint64_t GetU16LengthFromU32(const char32_t* u32String, const std::uint64_t length)
+	{
+		std::uint64_t count = 0;
+		for (std::uint64_t i = 0; i < length; ++i)
+		{
+			count += 1 + (u32String[i] >= 0x10000);
+		}
+		return count;
+	}
+
+	/****************************************************************************
+	*                            IsValidU8
+	*************************************************************************//**
+	*  @fn         bool IsValidU8(const char* u8String, const std::uint64_t length)
+	*  @brief      ASCII blocks are skipped with SIMD, the others are checked by the strict decoder
+	*  @param[in]  const char* u8String
+	*  @param[in]  const std::uint64_t length
+	*  @return @@ bool
+	*****************************************************************************/
+	bool IsValidU8(const char* u8String, const std::uint64_t length)
+	{
+		std::uint64_t index = 0;
+		while (index < length)
+		{
+			if (length - index >= SIMD_BYTE_COUNT)
+			{
+				const auto nonAscii = GetNonAsciiMask(u8String + index);
+				if (nonAscii == 0) { index += SIMD_BYTE_COUNT; continue; }
+				index += CountTrailingZeros(nonAscii);
+			}
+
+			char32_t u32Char = 0;
+			const auto byteCount = DecodeU8(reinterpret_cast<const std::uint8_t*>(u8String + index), length - index, u32Char);
+			if (byteCount == 0) { return false; }
+			index += byteCount;
+		}
+		return true;
+	}
+
+	bool IsValidU16(const char16_t* u16String, const std::uint64_t length)
+	{
+		std::uint64_t index = 0;
+		while (index < length)
+		{
+			char32_t u32Char = 0;
+			const auto unitCount = DecodeU16(u16String + index, length - index, u32Char);
+			if (unitCount == 0) { return false; }
+			index += unitCount;
+		}
+		return true;
+	}
+
+	bool IsValidU32(const char32_t* u32String, const std::uint64_t length)
+	{
+		for (std::uint64_t i = 0; i < length; ++i)
+		{
+			if (!IsValidCodePoint(u32String[i])) { return false; }
 		}
 		return true;
 	}
-}
\ No newline at end of file
+}
@@ -11,6 +11,7 @@
 //////////////////////////////////////////////////////////////////////////////////
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
+#include "GMRandom.hpp"
 #include <random>
 
 //////////////////////////////////////////////////////////////////////////////////
@@ -51,20 +52,19 @@ namespace gm
 			_uniformDist = std::uniform_real_distribution<T>(min, max);
 		}
 
+		/* @brief : Same seed gives the same sequence*/
+		void SetSeed(const gu::uint64 seed) { _engine.Seed(seed); }
+
 		/****************************************************************************
 		**                Constructor and Destructor
 		*****************************************************************************/
 		Random()
 		{
-			std::mt19937 engine(_seed());
-			_engine      = engine;
 			_uniformDist = std::uniform_real_distribution<T>(0.0f, 1.0f);
 		}
 
 		Random(T min, T max)
 		{
-			std::mt19937 engine(_seed());
-			_engine      = engine;
 			_uniformDist = std::uniform_real_distribution<T>(min, max);
 		}
 		~Random() {};
@@ -77,8 +77,7 @@ namespace gm
 		/****************************************************************************
 		**                Private Member Variables
 		*****************************************************************************/
-		std::random_device _seed;
-		std::mt19937       _engine;
+		Xoshiro256StarStar _engine; // 32 bytes state seeded by GenerateRandomSeed
 		std::uniform_real_distribution<T> _uniformDist;
 	};
 
@@ -107,19 +106,18 @@ namespace gm
 			_uniformDist = std::uniform_int_distribution<>(min, max);
 		}
 
+		/* @brief : Same seed gives the same sequence*/
+		void SetSeed(const gu::uint64 seed) { _engine.Seed(seed); }
+
 		/****************************************************************************
 		**                Constructor and Destructor
 		*****************************************************************************/
 		RandomInt()
 		{
-			std::mt19937 engine(_seed());
-			_engine = engine;
 			_uniformDist = std::uniform_int_distribution<>(0, 1);
 		}
 		RandomInt(int min, int max)
 		{
-			std::mt19937 engine(_seed());
-			_engine = engine;
 			_uniformDist = std::uniform_int_distribution<int>(min, max);
 		}
 		~RandomInt() {};
@@ -132,8 +130,7 @@ namespace gm
 		/****************************************************************************
 		**                Private Member Variables
 		*****************************************************************************/
-		std::random_device _seed;
-		std::mt19937       _engine;
+		Xoshiro256StarStar _engine; // 32 bytes state seeded by GenerateRandomSeed
 		std::uniform_int_distribution<> _uniformDist;
 	};
 
@@ -149,15 +146,13 @@ namespace gm
 	{
 	public:
 
-		Distribution()
-		{
-			std::mt19937 engine(_seed());
-			this->_engine = engine;
-		}
+		Distribution() = default;
+
+		/* @brief : Same seed gives the same sequence*/
+		void SetSeed(const gu::uint64 seed) { _engine.Seed(seed); }
 
 	protected:
-		std::random_device _seed;
-		std::mt19937       _engine;
+		Xoshiro256StarStar _engine; // 32 bytes state seeded by GenerateRandomSeed
 
 	};
 
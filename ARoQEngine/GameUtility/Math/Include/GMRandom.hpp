@@ -0,0 +1,387 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMRandom.hpp
+///             @brief  Small state, seedable random number generators and batch samplers.
+///                     Xoshiro256StarStar : 64 bit output, 32 bytes state, jump for the independent streams.
+///                     PCG32              : 32 bit output, 16 bytes state, 2^63 selectable streams.
+///                     RandomStream       : 8 lane xoshiro128** which fills the arrays 4 - 8 values at a time (SSE2 / AVX2 / NEON).
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GM_RANDOM_HPP
+#define GM_RANDOM_HPP
+//////////////////////////////////////////////////////////////////////////////////
+//                             HowTo
+//////////////////////////////////////////////////////////////////////////////////
+// gm::Xoshiro256StarStar random(1234);          // the same seed gives the same sequence on every platform
+// const float u = random.NextFloat(0.0f, 1.0f);
+// const auto  workerRandom = random.Split();    // independent stream for another thread
+//
+// gm::RandomStream stream(1234);
+// stream.FillFloat (values, count, -1.0f, 1.0f); // 8 values per step
+// stream.FillNormal(values, count, 0.0f, 1.0f);  // ziggurat
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/Base/Include/GUType.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gm
+{
+	/*----------------------------------------------------------------------
+	*  @brief : Returns a different non deterministic seed every call.
+	*           std::random_device is read only once in the process.
+	/*----------------------------------------------------------------------*/
+	gu::uint64 GenerateRandomSeed();
+
+	namespace details::random
+	{
+		inline constexpr gu::uint64 RotateLeft(const gu::uint64 x, const int k) noexcept { return (x << k) | (x >> (64 - k)); }
+		inline constexpr gu::uint32 RotateLeft(const gu::uint32 x, const int k) noexcept { return (x << k) | (x >> (32 - k)); }
+
+		/* @brief : [0, 1) with the 24 bit resolution*/
+		inline constexpr float ToFloat(const gu::uint32 x) noexcept { return static_cast<float>(x >> 8) * (1.0f / 16777216.0f); }
+
+		/* @brief : [0, 1) with the 53 bit resolution*/
+		inline constexpr double ToDouble(const gu::uint64 x) noexcept { return static_cast<double>(x >> 11) * (1.0 / 9007199254740992.0); }
+
+		/* @brief : Unbiased [0, range) by the multiply and reject method (Lemire 2019). range == 0 returns the full 32 bits.*/
+		template<class Engine>
+		gu::uint32 Bounded(Engine& engine, const gu::uint32 range)
+		{
+			if (range == 0) { return engine.NextUInt32(); }
+
+			gu::uint64 m   = static_cast<gu::uint64>(engine.NextUInt32()) * range;
+			gu::uint32 low = static_cast<gu::uint32>(m);
+			if (low < range)
+			{
+				const gu::uint32 threshold = (0u - range) % range;
+				while (low < threshold)
+				{
+					m   = static_cast<gu::uint64>(engine.NextUInt32()) * range;
+					low = static_cast<gu::uint32>(m);
+				}
+			}
+			return static_cast<gu::uint32>(m >> 32);
+		}
+
+		/* @brief : Inclusive [min, max]*/
+		template<class Engine>
+		gu::int32 BoundedInt(Engine& engine, const gu::int32 min, const gu::int32 max)
+		{
+			if (max <= min) { return min; }
+			const auto range = static_cast<gu::uint32>(static_cast<gu::int64>(max) - min + 1); // 0 for the full 32 bit range
+			return static_cast<gu::int32>(static_cast<gu::uint32>(min) + Bounded(engine, range));
+		}
+	}
+
+	/****************************************************************************
+	*				  			SplitMix64
+	*************************************************************************//**
+	*  @class     SplitMix64
+	*  @brief     Expands one 64 bit seed into the well mixed state words of the other generators
+	*****************************************************************************/
+	class SplitMix64
+	{
+	public:
+		gu::uint64 Next() noexcept
+		{
+			gu::uint64 z = (_state += 0x9e3779b97f4a7c15ull);
+			z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+			z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+			return z ^ (z >> 31);
+		}
+
+		explicit SplitMix64(const gu::uint64 seed) noexcept : _state(seed) {};
+
+	private:
+		gu::uint64 _state = 0;
+	};
+
+	/****************************************************************************
+	*				  			Xoshiro256StarStar
+	*************************************************************************//**
+	*  @class     Xoshiro256StarStar
+	*  @brief     xoshiro256** (Blackman and Vigna 2018). Period 2^256 - 1.
+	*             Satisfies the UniformRandomBitGenerator requirement, so it can drive the std distributions.
+	*             Split() returns the current stream and jumps this generator 2^128 steps ahead,
+	*             so the split generators never overlap.
+	*****************************************************************************/
+	class Xoshiro256StarStar
+	{
+	public:
+		using result_type = gu::uint64;
+
+		// (min) and (max) avoid the windows.h macros
+		static constexpr result_type (min)() noexcept { return 0; }
+		static constexpr result_type (max)() noexcept { return ~result_type(0); }
+
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		void Seed(const gu::uint64 seed) noexcept
+		{
+			SplitMix64 splitMix(seed);
+			for (auto& state : _state) { state = splitMix.Next(); }
+		}
+
+		gu::uint64 Next() noexcept
+		{
+			const gu::uint64 result = details::random::RotateLeft(_state[1] * 5, 7) * 9;
+			const gu::uint64 t      = _state[1] << 17;
+
+			_state[2] ^= _state[0];
+			_state[3] ^= _state[1];
+			_state[1] ^= _state[2];
+			_state[0] ^= _state[3];
+			_state[2] ^= t;
+			_state[3] = details::random::RotateLeft(_state[3], 45);
+			return result;
+		}
+
+		result_type operator()() noexcept { return Next(); }
+
+		/* @brief : The upper bits are the strongest ones*/
+		gu::uint32 NextUInt32() noexcept { return static_cast<gu::uint32>(Next() >> 32); }
+
+		/* @brief : [0, 1)*/
+		float  NextFloat () noexcept { return details::random::ToFloat(NextUInt32()); }
+		double NextDouble() noexcept { return details::random::ToDouble(Next()); }
+
+		/* @brief : [min, max)*/
+		float NextFloat(const float min, const float max) noexcept { return min + (max - min) * NextFloat(); }
+
+		/* @brief : [min, max] without the modulo bias*/
+		gu::int32 NextInt(const gu::int32 min, const gu::int32 max) { return details::random::BoundedInt(*this, min, max); }
+
+		/* @brief : Advance 2^128 steps (2^128 non overlapping streams)*/
+		void Jump() noexcept;
+
+		/* @brief : Advance 2^192 steps (for the stream of the streams)*/
+		void LongJump() noexcept;
+
+		/* @brief : Return the generator of the current stream and move this generator to the next stream*/
+		Xoshiro256StarStar Split() noexcept
+		{
+			const auto result = *this;
+			Jump();
+			return result;
+		}
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		Xoshiro256StarStar() noexcept { Seed(GenerateRandomSeed()); }
+
+		explicit Xoshiro256StarStar(const gu::uint64 seed) noexcept { Seed(seed); }
+
+	private:
+		/****************************************************************************
+		**                Private Function
+		*****************************************************************************/
+		void ApplyJump(const gu::uint64 (&polynomial)[4]) noexcept;
+
+		/****************************************************************************
+		**                Private Member Variables
+		*****************************************************************************/
+		gu::uint64 _state[4] = {};
+	};
+
+	/****************************************************************************
+	*				  			PCG32
+	*************************************************************************//**
+	*  @class     PCG32
+	*  @brief     pcg32 (XSH RR 64/32, O'Neill 2014). Period 2^64 per stream, 2^63 streams.
+	*             The same (seed, stream) pair gives the same sequence as the reference pcg32_srandom_r.
+	*****************************************************************************/
+	class PCG32
+	{
+	public:
+		using result_type = gu::uint32;
+
+		static constexpr result_type (min)() noexcept { return 0; }
+		static constexpr result_type (max)() noexcept { return ~result_type(0); }
+
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		void Seed(const gu::uint64 seed, const gu::uint64 stream = 0) noexcept
+		{
+			_state     = 0;
+			_increment = (stream << 1) | 1;
+			Next();
+			_state += seed;
+			Next();
+		}
+
+		gu::uint32 Next() noexcept
+		{
+			const gu::uint64 old = _state;
+			_state = old * MULTIPLIER + _increment;
+
+			const auto xorShifted = static_cast<gu::uint32>(((old >> 18) ^ old) >> 27);
+			const auto rotation   = static_cast<gu::uint32>(old >> 59);
+			return (xorShifted >> rotation) | (xorShifted << ((0u - rotation) & 31));
+		}
+
+		result_type operator()() noexcept { return Next(); }
+
+		gu::uint32 NextUInt32() noexcept { return Next(); }
+
+		/* @brief : [0, 1)*/
+		float NextFloat() noexcept { return details::random::ToFloat(Next()); }
+
+		/* @brief : [min, max)*/
+		float NextFloat(const float min, const float max) noexcept { return min + (max - min) * NextFloat(); }
+
+		/* @brief : [min, max] without the modulo bias*/
+		gu::int32 NextInt(const gu::int32 min, const gu::int32 max) { return details::random::BoundedInt(*this, min, max); }
+
+		/* @brief : Skip delta outputs in O(log delta)*/
+		void Advance(gu::uint64 delta) noexcept;
+
+		/* @brief : Generator on a different stream seeded from this one*/
+		PCG32 Split() noexcept
+		{
+			// The outputs are read in sequence, because the operands of | have no evaluation order
+			const gu::uint64 seedHigh   = Next();
+			const gu::uint64 seedLow    = Next();
+			const gu::uint64 streamHigh = Next();
+			const gu::uint64 streamLow  = Next();
+			return PCG32((seedHigh << 32) | seedLow, (streamHigh << 32) | streamLow);
+		}
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		PCG32() noexcept { Seed(GenerateRandomSeed()); }
+
+		explicit PCG32(const gu::uint64 seed, const gu::uint64 stream = 0) noexcept { Seed(seed, stream); }
+
+	private:
+		static constexpr gu::uint64 MULTIPLIER = 6364136223846793005ull;
+
+		gu::uint64 _state     = 0;
+		gu::uint64 _increment = 1;
+	};
+
+	/****************************************************************************
+	*				  			DiscreteDistribution
+	*************************************************************************//**
+	*  @class     DiscreteDistribution
+	*  @brief     Alias table (Vose) for the weighted index in O(1) per sample.
+	*             Negative weights are treated as 0. All zero weights give the uniform distribution.
+	*****************************************************************************/
+	class DiscreteDistribution
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		void SetWeights(const float* weights, const gu::uint32 count);
+
+		/* @brief : Map one uniform 32 bit word to the index (the upper bits choose the column, the lower bits the coin)*/
+		gu::uint32 Sample(const gu::uint32 word) const noexcept
+		{
+			const auto m      = static_cast<gu::uint64>(word) * _thresholds.Size();
+			const auto column = static_cast<gu::uint32>(m >> 32);
+			const auto alias  = _aliases[column]; // loaded unconditionally so the select has no branch
+			return static_cast<gu::uint32>(m) < _thresholds[column] ? column : alias;
+		}
+
+		template<class Engine>
+		gu::uint32 operator()(Engine& engine) const { return Sample(engine.NextUInt32()); }
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		gu::uint32 Size() const noexcept { return static_cast<gu::uint32>(_thresholds.Size()); }
+
+		bool IsEmpty() const noexcept { return _thresholds.IsEmpty(); }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		DiscreteDistribution() = default;
+
+		DiscreteDistribution(const float* weights, const gu::uint32 count) { SetWeights(weights, count); }
+
+	private:
+		/* @brief : The column keeps its own index when the lower 32 bits are below the threshold*/
+		gu::DynamicArray<gu::uint32> _thresholds = {};
+		gu::DynamicArray<gu::uint32> _aliases    = {};
+	};
+
+	/****************************************************************************
+	*				  			RandomStream
+	*************************************************************************//**
+	*  @class     RandomStream
+	*  @brief     8 independent xoshiro128** lanes (lane i is the base state jumped i * 2^64 steps),
+	*             stepped together with AVX2 (8 lanes), SSE2 / NEON (2 x 4 lanes) or the scalar loop.
+	*             Every path gives the same output, so the result does not depend on the instruction set.
+	*             One step produces 8 words in the lane order. A fill call consumes whole steps
+	*             (the values of the last partial step are discarded).
+	*             Use one stream per thread (Split) because the state is not shared safely.
+	*****************************************************************************/
+	class RandomStream
+	{
+	public:
+		static constexpr gu::uint32 LANE_COUNT = 8;
+
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		void Seed(const gu::uint64 seed) noexcept;
+
+		/* @brief : Return the stream of the current state and move this stream 2^96 steps ahead*/
+		RandomStream Split() noexcept;
+
+		/* @brief : Uniform 32 bit words*/
+		void FillUInt32(gu::uint32* output, const gu::uint64 count) noexcept;
+
+		/* @brief : Uniform [min, max) with the 24 bit resolution*/
+		void FillFloat(float* output, const gu::uint64 count, const float min = 0.0f, const float max = 1.0f) noexcept;
+
+		/* @brief : Uniform [min, max] by the multiply shift (bias < (max - min + 1) / 2^32, use Xoshiro256StarStar::NextInt for the exact one)*/
+		void FillInt(gu::int32* output, const gu::uint64 count, const gu::int32 min, const gu::int32 max) noexcept;
+
+		/* @brief : Normal distribution by the ziggurat method (Marsaglia and Tsang 2000, 128 layers)*/
+		void FillNormal(float* output, const gu::uint64 count, const float mean = 0.0f, const float standardDeviation = 1.0f) noexcept;
+
+		/* @brief : Exponential distribution p(x) = lambda * exp(-lambda * x) by the ziggurat method (256 layers)*/
+		void FillExponential(float* output, const gu::uint64 count, const float lambda = 1.0f) noexcept;
+
+		/* @brief : Index sampled from the alias table*/
+		void FillDiscrete(gu::uint32* output, const gu::uint64 count, const DiscreteDistribution& distribution) noexcept;
+
+		/* @brief : Advance all lanes one step and write LANE_COUNT words*/
+		void NextBlock(gu::uint32* output) noexcept;
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		RandomStream() noexcept { Seed(GenerateRandomSeed()); }
+
+		explicit RandomStream(const gu::uint64 seed) noexcept { Seed(seed); }
+
+	private:
+		/****************************************************************************
+		**                Private Function
+		*****************************************************************************/
+		void ApplyJump(const gu::uint32 lane, const gu::uint32 (&polynomial)[4]) noexcept;
+
+		/****************************************************************************
+		**                Private Member Variables
+		*****************************************************************************/
+		/* @brief : Structure of arrays : _state[word][lane]*/
+		alignas(32) gu::uint32 _state[4][LANE_COUNT] = {};
+	};
+}
+#endif
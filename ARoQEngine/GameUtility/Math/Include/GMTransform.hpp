@@ -25,6 +25,7 @@
 //////////////////////////////////////////////////////////////////////////////////
 #include "GMMatrix.hpp"
 #include "GameUtility/Container/Include/GUDynamicArray.hpp"
+#include "GameUtility/Container/Include/GUSmallArray.hpp"
 
 
 //////////////////////////////////////////////////////////////////////////////////
@@ -135,7 +136,8 @@ namespace gm
 		**                Private Member Variables
 		*****************************************************************************/
 		Transform* _parent = nullptr;
-		gu::DynamicArray<Transform*> _children = {};
+		// @brief : q͖̐wǂ̏ꍇȂ, 4܂ł̓q[vmۂsȂ
+		gu::SmallArray<Transform*, 4> _children = {};
 	};
 
 }
@@ -0,0 +1,28 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMVectorPack.hpp
+///             @brief  Bulk conversions between float and the compressed vertex formats by the selected SIMD backend.
+///                     - float <-> half, float <-> SNORM / UNORM 8 / 16, octahedral normals and UNORM8 bone weights.
+///                     - Every backend returns the same bits as gm::simd::non::PackUtility (including the NaN payloads of half).
+///             How To: gm::VectorPack::ConvertFloatToHalfStream(output, input, count)
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GM_VECTOR_PACK_HPP
+#define GM_VECTOR_PACK_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/Math/Private/Simd/Include/GMSimdMacros.hpp"
+#include SIMD_COMPILED_HEADER(GameUtility/Math/Private/Simd/Include, GMSimdPack)
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace gm
+{
+	using VectorPack = SIMD_NAME_SPACE::PackUtility;
+}
+
+#endif
@@ -0,0 +1,29 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMVectorStream.hpp
+///             @brief  Batched transforms of the Float3 / Float4 / Float4x4 arrays by the selected SIMD backend.
+///                     - The matrix is Float4x4 (row vector, v * M). The strides are in bytes,
+///                       so the positions in the interleaved vertex buffers can be transformed in place.
+///                     - gm::simd::non::StreamUtility is the scalar reference of the same functions.
+///             How To: gm::VectorStream::TransformFloat3Stream(&output[0].x, sizeof(Float3), &input[0].x, sizeof(Float3), count, matrix.u.a)
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GM_VECTOR_STREAM_HPP
+#define GM_VECTOR_STREAM_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/Math/Private/Simd/Include/GMSimdMacros.hpp"
+#include SIMD_COMPILED_HEADER(GameUtility/Math/Private/Simd/Include, GMSimdStream)
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace gm
+{
+	using VectorStream = SIMD_NAME_SPACE::StreamUtility;
+}
+
+#endif
@@ -12,6 +12,7 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include "GMVector.hpp"
+#include "GameUtility/Base/Include/GUType.hpp"
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
@@ -84,6 +85,46 @@ namespace gm
 		};
 	};
 
+	/****************************************************************************
+	*							 CompressedVertex
+	*************************************************************************//**
+	*  @struct    CompressedVertex
+	*  @brief     24 byte version of Vertex. Position is kept in float32.
+	*             Normal is the octahedral SNORM16x2, Color is UNORM8x4 and UV is half2.
+	*****************************************************************************/
+	struct CompressedVertex
+	{
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		gm::Float3 Position;           /// Position (R32G32B32_FLOAT)
+		gu::int16  Normal[2]   = {0};  /// Octahedral normal (R16G16_SNORM)
+		gu::uint8  Color[4]    = {0};  /// Color (R8G8B8A8_UNORM)
+		gu::uint16 UV[2]       = {0};  /// UV (R16G16_FLOAT)
+	};
+
+	/****************************************************************************
+	*							 CompressedSkinMeshVertex
+	*************************************************************************//**
+	*  @struct    CompressedSkinMeshVertex
+	*  @brief     32 byte version of SkinMeshVertex. Position is kept in float32.
+	*             Normal is the octahedral SNORM16x2, UV is half2, the bone indices are uint16
+	*             and the bone weights are UNORM8x4 whose sum is always 255.
+	*****************************************************************************/
+	struct CompressedSkinMeshVertex
+	{
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		gm::Float3 Position;               /// Position (R32G32B32_FLOAT)
+		gu::int16  Normal[2]      = {0};   /// Octahedral normal (R16G16_SNORM)
+		gu::uint16 UV[2]          = {0};   /// UV (R16G16_FLOAT)
+		gu::uint16 BoneIndices[4] = {0};   /// Bone indices (R16G16B16A16_UINT)
+		gu::uint8  BoneWeights[4] = {0};   /// Bone weights (R8G8B8A8_UNORM)
+	};
+
+	static_assert(sizeof(CompressedVertex)         == 24, "CompressedVertex must be 24 bytes");
+	static_assert(sizeof(CompressedSkinMeshVertex) == 32, "CompressedSkinMeshVertex must be 32 bytes");
 }
 
 #endif
\ No newline at end of file
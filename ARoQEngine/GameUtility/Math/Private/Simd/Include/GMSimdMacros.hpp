@@ -26,6 +26,13 @@ namespace gm::simd
 		#define USE_F16C_SIMD_INSTRUCTION
 	#endif
 
+	/*----------------------------------------------------------------------
+	*             F16C (float <-> half) is available on all the AVX2 CPUs
+	*----------------------------------------------------------------------*/
+	#if !defined(USE_F16C_SIMD_INSTRUCTION) && !defined(PLATFORM_NOT_USE_SIMD_INSTRUCTION) && (defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__)))
+		#define USE_F16C_SIMD_INSTRUCTION
+	#endif
+
 	/*----------------------------------------------------------------------
 	*             ̈܂Ƃ߂ĒڒlnɂVectorCall̎gps
 	*----------------------------------------------------------------------*/
@@ -0,0 +1,141 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMSimdPackAVX.hpp
+///             @brief  Bulk conversions between float and the compressed vertex formats by AVX.
+///                     - Same functions as gm::simd::non::PackUtility.
+///                     - float <-> half uses F16C (8 elements per instruction) when USE_F16C_SIMD_INSTRUCTION is defined.
+///                       NaN becomes quiet and keeps the upper payload bits, which the other backends also follow.
+///                     - AVX has no 256 bit integer operations, so the other conversions are the SSE implementation.
+///             How To: PackUtility::ConvertFloatToHalfStream(output, input, count)
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GM_SIMD_PACK_AVX_HPP
+#define GM_SIMD_PACK_AVX_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GMSimdMacros.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+#if PLATFORM_CPU_INSTRUCTION_AVX && !defined(PLATFORM_CPU_INSTRUCTION_NOT_USE)
+#include "GMSimdPackSSE4.hpp"
+#include <immintrin.h>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gm::simd::avx
+{
+	/****************************************************************************
+	*				  			   PackUtility
+	*************************************************************************//**
+	*  @class     PackUtility
+	*  @brief     AVX pack / unpack operations (F16C)
+	*****************************************************************************/
+	class PackUtility : public gm::simd::sse4::PackUtility
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+	#ifdef USE_F16C_SIMD_INSTRUCTION
+		#pragma region Half
+		/*----------------------------------------------------------------------
+		*  @brief : float -> half. Overflow becomes infinity and NaN stays NaN.
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION ConvertFloatToHalfStream(gu::uint16* output, const float* input, const gu::uint64 count) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : half -> float (exact)
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION ConvertHalfToFloatStream(float* output, const gu::uint16* input, const gu::uint64 count) noexcept;
+		#pragma endregion Half
+	#endif
+	};
+
+#pragma region Implement
+#ifdef USE_F16C_SIMD_INSTRUCTION
+	#pragma region Half
+	/****************************************************************************
+	*                       ConvertFloatToHalfStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToHalfStream(gu::uint16* output, const float* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the float array to the half array by F16C (16 elements per iteration)
+	*
+	*  @param[out] gu::uint16* output
+	*  @param[in]  const float* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToHalfStream(gu::uint16* output, const float* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		gu::uint64 i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			const __m128i low  = _mm256_cvtps_ph(_mm256_loadu_ps(input + i    ), _MM_FROUND_TO_NEAREST_INT);
+			const __m128i high = _mm256_cvtps_ph(_mm256_loadu_ps(input + i + 8), _MM_FROUND_TO_NEAREST_INT);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(output + i    ), low);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(output + i + 8), high);
+		}
+
+		for (; i < count; i += 4)
+		{
+			const gu::uint64 rest = count - i < 4 ? count - i : 4;
+			alignas(16) float      source[4]      = {};
+			alignas(16) gu::uint16 destination[8] = {};
+			memcpy(source, input + i, rest * sizeof(float));
+
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(destination), _mm_cvtps_ph(_mm_load_ps(source), _MM_FROUND_TO_NEAREST_INT));
+			memcpy(output + i, destination, rest * sizeof(gu::uint16));
+		}
+	}
+
+	/****************************************************************************
+	*                       ConvertHalfToFloatStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertHalfToFloatStream(float* output, const gu::uint16* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the half array to the float array by F16C (16 elements per iteration)
+	*
+	*  @param[out] float* output
+	*  @param[in]  const gu::uint16* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertHalfToFloatStream(float* output, const gu::uint16* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		gu::uint64 i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			_mm256_storeu_ps(output + i    , _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i    ))));
+			_mm256_storeu_ps(output + i + 8, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 8))));
+		}
+
+		for (; i < count; i += 4)
+		{
+			const gu::uint64 rest = count - i < 4 ? count - i : 4;
+			alignas(16) gu::uint16 source[8]      = {};
+			alignas(16) float      destination[4] = {};
+			memcpy(source, input + i, rest * sizeof(gu::uint16));
+
+			_mm_store_ps(destination, _mm_cvtph_ps(_mm_load_si128(reinterpret_cast<const __m128i*>(source))));
+			memcpy(output + i, destination, rest * sizeof(float));
+		}
+	}
+	#pragma endregion Half
+#endif
+#pragma endregion Implement
+}
+#endif
+#endif
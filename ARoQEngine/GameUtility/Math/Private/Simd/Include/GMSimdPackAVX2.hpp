@@ -0,0 +1,603 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMSimdPackAVX2.hpp
+///             @brief  Bulk conversions between float and the compressed vertex formats by AVX2.
+///                     - Same functions and same results as gm::simd::non::PackUtility
+///                       (float <-> half is the AVX implementation).
+///                     - The normalized integer conversions use the 256 bit integer packs (8 floats per register),
+///                       and the octahedral normals and the bone weights are processed 8 vertices at a time (SoA).
+///                     - The remaining elements are processed by the SSE implementation.
+///             How To: PackUtility::ConvertFloatToSNorm16Stream(output, input, count)
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GM_SIMD_PACK_AVX2_HPP
+#define GM_SIMD_PACK_AVX2_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GMSimdMacros.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+#if PLATFORM_CPU_INSTRUCTION_AVX2 && !defined(PLATFORM_CPU_INSTRUCTION_NOT_USE)
+#include "GMSimdPackAVX.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gm::simd::avx2
+{
+	/****************************************************************************
+	*				  			   PackUtility
+	*************************************************************************//**
+	*  @class     PackUtility
+	*  @brief     AVX2 pack / unpack operations (8 floats per register)
+	*****************************************************************************/
+	class PackUtility : public gm::simd::avx::PackUtility
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		#pragma region Normalized Integer
+		/*----------------------------------------------------------------------
+		*  @brief : [-1, 1] <-> [-32767, 32767] (-32768 is also -1)
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION ConvertFloatToSNorm16Stream(gu::int16* output, const float* input, const gu::uint64 count) noexcept;
+
+		inline static void SIMD_CALL_CONVENTION ConvertSNorm16ToFloatStream(float* output, const gu::int16* input, const gu::uint64 count) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : [0, 1] <-> [0, 65535]
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION ConvertFloatToUNorm16Stream(gu::uint16* output, const float* input, const gu::uint64 count) noexcept;
+
+		inline static void SIMD_CALL_CONVENTION ConvertUNorm16ToFloatStream(float* output, const gu::uint16* input, const gu::uint64 count) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : [-1, 1] <-> [-127, 127] (-128 is also -1)
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION ConvertFloatToSNorm8Stream(gu::int8* output, const float* input, const gu::uint64 count) noexcept;
+
+		inline static void SIMD_CALL_CONVENTION ConvertSNorm8ToFloatStream(float* output, const gu::int8* input, const gu::uint64 count) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : [0, 1] <-> [0, 255]
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION ConvertFloatToUNorm8Stream(gu::uint8* output, const float* input, const gu::uint64 count) noexcept;
+
+		inline static void SIMD_CALL_CONVENTION ConvertUNorm8ToFloatStream(float* output, const gu::uint8* input, const gu::uint64 count) noexcept;
+		#pragma endregion Normalized Integer
+
+		#pragma region Vertex Attribute
+		/*----------------------------------------------------------------------
+		*  @brief : Float3 normal -> octahedral SNORM16x2. The input does not have to be a unit vector.
+		*           The zero vector is encoded as (0, 0), which is decoded as (0, 0, 1).
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION EncodeOctahedralNormalStream(gu::int16* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : Octahedral SNORM16x2 -> Float3 unit normal
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION DecodeOctahedralNormalStream(float* output, const gu::uint64 outputStride,
+			const gu::int16* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : float[4] bone weights -> UNORM8x4. The weights are normalized and the rounding error is
+		*           moved to the largest weight, so the sum is always 255. Negative and NaN weights are 0,
+		*           and the vertex without the valid weight (the sum is 0 or overflows) gets (255, 0, 0, 0).
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION NormalizeBoneWeightStream(gu::uint8* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept;
+		#pragma endregion Vertex Attribute
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+		/*----------------------------------------------------------------------
+		*  @brief : NaN -> 0, clamp [minimum, 1], scale and round to nearest even
+		/*----------------------------------------------------------------------*/
+		__forceinline static __m256i SIMD_CALL_CONVENTION Quantize(const __m256 value, const __m256 minimum, const __m256 scale) noexcept
+		{
+			__m256 result = _mm256_and_ps(value, _mm256_cmp_ps(value, value, _CMP_ORD_Q));
+			result = _mm256_min_ps(_mm256_max_ps(result, minimum), _mm256_set1_ps(1.0f));
+			return _mm256_cvtps_epi32(_mm256_mul_ps(result, scale));
+		}
+
+		__forceinline static __m256 SIMD_CALL_CONVENTION Dequantize(const __m256i value, const __m256 reciprocalScale) noexcept
+		{
+			return _mm256_max_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(value), reciprocalScale), _mm256_set1_ps(-1.0f));
+		}
+
+		__forceinline static __m256 SIMD_CALL_CONVENTION Abs(const __m256 value) noexcept
+		{
+			return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), value);
+		}
+
+		/*----------------------------------------------------------------------
+		*  @brief : (x >= 0 ? 1 : -1) like the scalar comparison (-0 is 1)
+		/*----------------------------------------------------------------------*/
+		__forceinline static __m256 SIMD_CALL_CONVENTION SignNotZero(const __m256 value) noexcept
+		{
+			return _mm256_blendv_ps(_mm256_set1_ps(-1.0f), _mm256_set1_ps(1.0f), _mm256_cmp_ps(value, _mm256_setzero_ps(), _CMP_GE_OQ));
+		}
+
+		/*----------------------------------------------------------------------
+		*  @brief : Store the 32 bit lane i to the vertex i
+		/*----------------------------------------------------------------------*/
+		__forceinline static void StoreUInt32x8(void* output, const gu::uint64 stride, const __m256i value) noexcept
+		{
+			alignas(32) gu::uint32 lanes[8];
+			_mm256_store_si256(reinterpret_cast<__m256i*>(lanes), value);
+			for (gu::uint32 i = 0; i < 8; ++i)
+			{
+				memcpy(At(static_cast<gu::uint8*>(output), stride, i), &lanes[i], sizeof(gu::uint32));
+			}
+		}
+	};
+
+#pragma region Implement
+	#pragma region Normalized Integer
+	/****************************************************************************
+	*                       ConvertFloatToSNorm16Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToSNorm16Stream(gu::int16* output, const float* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the float array to the SNORM16 array (16 elements per iteration)
+	*
+	*  @param[out] gu::int16* output
+	*  @param[in]  const float* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToSNorm16Stream(gu::int16* output, const float* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const __m256 minimum = _mm256_set1_ps(-1.0f);
+		const __m256 scale   = _mm256_set1_ps(32767.0f);
+
+		gu::uint64 i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			const __m256i low  = Quantize(_mm256_loadu_ps(input + i    ), minimum, scale);
+			const __m256i high = Quantize(_mm256_loadu_ps(input + i + 8), minimum, scale);
+
+			// the packs work in each 128 bit lane, so the 64 bit blocks are reordered
+			const __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(low, high), _MM_SHUFFLE(3, 1, 2, 0));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), packed);
+		}
+
+		sse4::PackUtility::ConvertFloatToSNorm16Stream(output + i, input + i, count - i);
+	}
+
+	/****************************************************************************
+	*                       ConvertSNorm16ToFloatStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertSNorm16ToFloatStream(float* output, const gu::int16* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the SNORM16 array to the float array (16 elements per iteration)
+	*
+	*  @param[out] float* output
+	*  @param[in]  const gu::int16* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertSNorm16ToFloatStream(float* output, const gu::int16* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const __m256 reciprocalScale = _mm256_set1_ps(1.0f / 32767.0f);
+
+		gu::uint64 i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			const __m128i low  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i    ));
+			const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 8));
+			_mm256_storeu_ps(output + i    , Dequantize(_mm256_cvtepi16_epi32(low ), reciprocalScale));
+			_mm256_storeu_ps(output + i + 8, Dequantize(_mm256_cvtepi16_epi32(high), reciprocalScale));
+		}
+
+		sse4::PackUtility::ConvertSNorm16ToFloatStream(output + i, input + i, count - i);
+	}
+
+	/****************************************************************************
+	*                       ConvertFloatToUNorm16Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToUNorm16Stream(gu::uint16* output, const float* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the float array to the UNORM16 array (16 elements per iteration)
+	*
+	*  @param[out] gu::uint16* output
+	*  @param[in]  const float* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToUNorm16Stream(gu::uint16* output, const float* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const __m256 minimum = _mm256_setzero_ps();
+		const __m256 scale   = _mm256_set1_ps(65535.0f);
+
+		gu::uint64 i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			const __m256i low  = Quantize(_mm256_loadu_ps(input + i    ), minimum, scale);
+			const __m256i high = Quantize(_mm256_loadu_ps(input + i + 8), minimum, scale);
+
+			const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(low, high), _MM_SHUFFLE(3, 1, 2, 0));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), packed);
+		}
+
+		sse4::PackUtility::ConvertFloatToUNorm16Stream(output + i, input + i, count - i);
+	}
+
+	/****************************************************************************
+	*                       ConvertUNorm16ToFloatStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertUNorm16ToFloatStream(float* output, const gu::uint16* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the UNORM16 array to the float array (16 elements per iteration)
+	*
+	*  @param[out] float* output
+	*  @param[in]  const gu::uint16* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertUNorm16ToFloatStream(float* output, const gu::uint16* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const __m256 reciprocalScale = _mm256_set1_ps(1.0f / 65535.0f);
+
+		gu::uint64 i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			const __m128i low  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i    ));
+			const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 8));
+			_mm256_storeu_ps(output + i    , _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(low )), reciprocalScale));
+			_mm256_storeu_ps(output + i + 8, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(high)), reciprocalScale));
+		}
+
+		sse4::PackUtility::ConvertUNorm16ToFloatStream(output + i, input + i, count - i);
+	}
+
+	/****************************************************************************
+	*                       ConvertFloatToSNorm8Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToSNorm8Stream(gu::int8* output, const float* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the float array to the SNORM8 array (32 elements per iteration)
+	*
+	*  @param[out] gu::int8* output
+	*  @param[in]  const float* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToSNorm8Stream(gu::int8* output, const float* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const __m256  minimum = _mm256_set1_ps(-1.0f);
+		const __m256  scale   = _mm256_set1_ps(127.0f);
+		const __m256i order   = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+		gu::uint64 i = 0;
+		for (; i + 32 <= count; i += 32)
+		{
+			const __m256i v0 = Quantize(_mm256_loadu_ps(input + i     ), minimum, scale);
+			const __m256i v1 = Quantize(_mm256_loadu_ps(input + i +  8), minimum, scale);
+			const __m256i v2 = Quantize(_mm256_loadu_ps(input + i + 16), minimum, scale);
+			const __m256i v3 = Quantize(_mm256_loadu_ps(input + i + 24), minimum, scale);
+
+			// each 32 bit block holds 4 successive elements after the in-lane packs
+			const __m256i packed = _mm256_packs_epi16(_mm256_packs_epi32(v0, v1), _mm256_packs_epi32(v2, v3));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), _mm256_permutevar8x32_epi32(packed, order));
+		}
+
+		sse4::PackUtility::ConvertFloatToSNorm8Stream(output + i, input + i, count - i);
+	}
+
+	/****************************************************************************
+	*                       ConvertSNorm8ToFloatStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertSNorm8ToFloatStream(float* output, const gu::int8* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the SNORM8 array to the float array (16 elements per iteration)
+	*
+	*  @param[out] float* output
+	*  @param[in]  const gu::int8* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertSNorm8ToFloatStream(float* output, const gu::int8* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const __m256 reciprocalScale = _mm256_set1_ps(1.0f / 127.0f);
+
+		gu::uint64 i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+			_mm256_storeu_ps(output + i    , Dequantize(_mm256_cvtepi8_epi32(value)                    , reciprocalScale));
+			_mm256_storeu_ps(output + i + 8, Dequantize(_mm256_cvtepi8_epi32(_mm_srli_si128(value, 8)), reciprocalScale));
+		}
+
+		sse4::PackUtility::ConvertSNorm8ToFloatStream(output + i, input + i, count - i);
+	}
+
+	/****************************************************************************
+	*                       ConvertFloatToUNorm8Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToUNorm8Stream(gu::uint8* output, const float* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the float array to the UNORM8 array (32 elements per iteration)
+	*
+	*  @param[out] gu::uint8* output
+	*  @param[in]  const float* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToUNorm8Stream(gu::uint8* output, const float* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const __m256  minimum = _mm256_setzero_ps();
+		const __m256  scale   = _mm256_set1_ps(255.0f);
+		const __m256i order   = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+		gu::uint64 i = 0;
+		for (; i + 32 <= count; i += 32)
+		{
+			const __m256i v0 = Quantize(_mm256_loadu_ps(input + i     ), minimum, scale);
+			const __m256i v1 = Quantize(_mm256_loadu_ps(input + i +  8), minimum, scale);
+			const __m256i v2 = Quantize(_mm256_loadu_ps(input + i + 16), minimum, scale);
+			const __m256i v3 = Quantize(_mm256_loadu_ps(input + i + 24), minimum, scale);
+
+			const __m256i packed = _mm256_packus_epi16(_mm256_packs_epi32(v0, v1), _mm256_packs_epi32(v2, v3));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), _mm256_permutevar8x32_epi32(packed, order));
+		}
+
+		sse4::PackUtility::ConvertFloatToUNorm8Stream(output + i, input + i, count - i);
+	}
+
+	/****************************************************************************
+	*                       ConvertUNorm8ToFloatStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertUNorm8ToFloatStream(float* output, const gu::uint8* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the UNORM8 array to the float array (16 elements per iteration)
+	*
+	*  @param[out] float* output
+	*  @param[in]  const gu::uint8* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertUNorm8ToFloatStream(float* output, const gu::uint8* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const __m256 reciprocalScale = _mm256_set1_ps(1.0f / 255.0f);
+
+		gu::uint64 i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+			_mm256_storeu_ps(output + i    , _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(value))                    , reciprocalScale));
+			_mm256_storeu_ps(output + i + 8, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(value, 8))), reciprocalScale));
+		}
+
+		sse4::PackUtility::ConvertUNorm8ToFloatStream(output + i, input + i, count - i);
+	}
+	#pragma endregion Normalized Integer
+
+	#pragma region Vertex Attribute
+	/****************************************************************************
+	*                       EncodeOctahedralNormalStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::EncodeOctahedralNormalStream(gu::int16* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	*
+	*  @brief     Project the normals onto the octahedron (8 normals per iteration)
+	*
+	*  @param[out] gu::int16* output (int16[2])
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float3)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::EncodeOctahedralNormalStream(gu::int16* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const __m256 zero = _mm256_setzero_ps();
+		const __m256 one  = _mm256_set1_ps(1.0f);
+
+		gu::uint64 i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			__m128 x0, y0, z0, x1, y1, z1;
+			LoadFloat3x4(At(input, inputStride, i    ), inputStride, x0, y0, z0);
+			LoadFloat3x4(At(input, inputStride, i + 4), inputStride, x1, y1, z1);
+			const __m256 x = _mm256_set_m128(x1, x0);
+			const __m256 y = _mm256_set_m128(y1, y0);
+			const __m256 z = _mm256_set_m128(z1, z0);
+
+			const __m256 length           = _mm256_add_ps(_mm256_add_ps(Abs(x), Abs(y)), Abs(z));
+			const __m256 isPositive       = _mm256_cmp_ps(length, zero, _CMP_GT_OQ);
+			const __m256 reciprocalLength = _mm256_and_ps(isPositive, _mm256_div_ps(one, length));
+
+			const __m256 projectedU = _mm256_mul_ps(x, reciprocalLength);
+			const __m256 projectedV = _mm256_mul_ps(y, reciprocalLength);
+			const __m256 foldU      = _mm256_mul_ps(_mm256_sub_ps(one, Abs(projectedV)), SignNotZero(projectedU));
+			const __m256 foldV      = _mm256_mul_ps(_mm256_sub_ps(one, Abs(projectedU)), SignNotZero(projectedV));
+			const __m256 isLower    = _mm256_cmp_ps(z, zero, _CMP_LT_OQ);
+
+			const __m256  minimum = _mm256_set1_ps(-1.0f);
+			const __m256  scale   = _mm256_set1_ps(32767.0f);
+			const __m256i u = Quantize(_mm256_blendv_ps(projectedU, foldU, isLower), minimum, scale);
+			const __m256i v = Quantize(_mm256_blendv_ps(projectedV, foldV, isLower), minimum, scale);
+
+			StoreUInt32x8(At(output, outputStride, i), outputStride, _mm256_or_si256(_mm256_and_si256(u, _mm256_set1_epi32(0xffff)), _mm256_slli_epi32(v, 16)));
+		}
+
+		sse4::PackUtility::EncodeOctahedralNormalStream(At(output, outputStride, i), outputStride, At(input, inputStride, i), inputStride, count - i);
+	}
+
+	/****************************************************************************
+	*                       DecodeOctahedralNormalStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::DecodeOctahedralNormalStream(float* output, const gu::uint64 outputStride,
+	*             const gu::int16* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	*
+	*  @brief     Fold the square back onto the octahedron and normalize (8 normals per iteration)
+	*
+	*  @param[out] float* output (Float3)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const gu::int16* input (int16[2])
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::DecodeOctahedralNormalStream(float* output, const gu::uint64 outputStride,
+		const gu::int16* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const __m256 zero = _mm256_setzero_ps();
+		const __m256 one  = _mm256_set1_ps(1.0f);
+		const __m256 sign = _mm256_set1_ps(-0.0f);
+
+		gu::uint64 i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			alignas(32) gu::int32 lanes[8];
+			for (gu::uint64 j = 0; j < 8; ++j) { memcpy(&lanes[j], At(input, inputStride, i + j), sizeof(gu::int32)); }
+
+			const __m256i packed = _mm256_load_si256(reinterpret_cast<const __m256i*>(lanes));
+			const __m256  reciprocalScale = _mm256_set1_ps(1.0f / 32767.0f);
+			__m256 x = Dequantize(_mm256_srai_epi32(_mm256_slli_epi32(packed, 16), 16), reciprocalScale);
+			__m256 y = Dequantize(_mm256_srai_epi32(packed, 16), reciprocalScale);
+			__m256 z = _mm256_sub_ps(_mm256_sub_ps(one, Abs(x)), Abs(y));
+
+			const __m256 fold = _mm256_max_ps(_mm256_sub_ps(zero, z), zero);
+			x = _mm256_add_ps(x, _mm256_xor_ps(fold, _mm256_and_ps(_mm256_cmp_ps(x, zero, _CMP_GE_OQ), sign)));
+			y = _mm256_add_ps(y, _mm256_xor_ps(fold, _mm256_and_ps(_mm256_cmp_ps(y, zero, _CMP_GE_OQ), sign)));
+
+			const __m256 normSquared    = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)), _mm256_mul_ps(z, z));
+			const __m256 reciprocalNorm = _mm256_div_ps(one, _mm256_sqrt_ps(normSquared));
+
+			alignas(32) float xs[8], ys[8], zs[8];
+			_mm256_store_ps(xs, _mm256_mul_ps(x, reciprocalNorm));
+			_mm256_store_ps(ys, _mm256_mul_ps(y, reciprocalNorm));
+			_mm256_store_ps(zs, _mm256_mul_ps(z, reciprocalNorm));
+			for (gu::uint64 j = 0; j < 8; ++j)
+			{
+				float* destination = At(output, outputStride, i + j);
+				destination[0] = xs[j];
+				destination[1] = ys[j];
+				destination[2] = zs[j];
+			}
+		}
+
+		sse4::PackUtility::DecodeOctahedralNormalStream(At(output, outputStride, i), outputStride, At(input, inputStride, i), inputStride, count - i);
+	}
+
+	/****************************************************************************
+	*                       NormalizeBoneWeightStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::NormalizeBoneWeightStream(gu::uint8* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	*
+	*  @brief     Quantize the bone weights keeping the sum 255 (8 vertices per iteration)
+	*
+	*  @param[out] gu::uint8* output (uint8[4])
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (float[4])
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::NormalizeBoneWeightStream(gu::uint8* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const __m256 zero = _mm256_setzero_ps();
+
+		gu::uint64 i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			// vertex j and j + 4 share a register, so the transpose gives the SoA of the 8 vertices
+			__m256 w0 = _mm256_set_m128(_mm_loadu_ps(At(input, inputStride, i + 4)), _mm_loadu_ps(At(input, inputStride, i + 0)));
+			__m256 w1 = _mm256_set_m128(_mm_loadu_ps(At(input, inputStride, i + 5)), _mm_loadu_ps(At(input, inputStride, i + 1)));
+			__m256 w2 = _mm256_set_m128(_mm_loadu_ps(At(input, inputStride, i + 6)), _mm_loadu_ps(At(input, inputStride, i + 2)));
+			__m256 w3 = _mm256_set_m128(_mm_loadu_ps(At(input, inputStride, i + 7)), _mm_loadu_ps(At(input, inputStride, i + 3)));
+
+			const __m256 t0 = _mm256_unpacklo_ps(w0, w1);
+			const __m256 t1 = _mm256_unpacklo_ps(w2, w3);
+			const __m256 t2 = _mm256_unpackhi_ps(w0, w1);
+			const __m256 t3 = _mm256_unpackhi_ps(w2, w3);
+			w0 = _mm256_max_ps(_mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0)), zero);
+			w1 = _mm256_max_ps(_mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2)), zero);
+			w2 = _mm256_max_ps(_mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0)), zero);
+			w3 = _mm256_max_ps(_mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2)), zero);
+
+			const __m256 sum   = _mm256_add_ps(_mm256_add_ps(w0, w2), _mm256_add_ps(w1, w3));
+			const __m256 scale = _mm256_div_ps(_mm256_set1_ps(255.0f), sum);
+
+			__m256i q0 = _mm256_cvtps_epi32(_mm256_mul_ps(w0, scale));
+			__m256i q1 = _mm256_cvtps_epi32(_mm256_mul_ps(w1, scale));
+			__m256i q2 = _mm256_cvtps_epi32(_mm256_mul_ps(w2, scale));
+			__m256i q3 = _mm256_cvtps_epi32(_mm256_mul_ps(w3, scale));
+
+			// first largest lane (the same tie break as the scalar loop)
+			const __m256i is1     = _mm256_cmpgt_epi32(q1, q0);
+			const __m256i is2     = _mm256_cmpgt_epi32(q2, _mm256_max_epi32(q0, q1));
+			const __m256i is3     = _mm256_cmpgt_epi32(q3, _mm256_max_epi32(_mm256_max_epi32(q0, q1), q2));
+			const __m256i select2 = _mm256_andnot_si256(is3, is2);
+			const __m256i select1 = _mm256_andnot_si256(_mm256_or_si256(is3, is2), is1);
+			const __m256i select0 = _mm256_andnot_si256(_mm256_or_si256(_mm256_or_si256(is3, is2), is1), _mm256_set1_epi32(-1));
+
+			const __m256i total = _mm256_add_epi32(_mm256_add_epi32(q0, q1), _mm256_add_epi32(q2, q3));
+			const __m256i error = _mm256_sub_epi32(_mm256_set1_epi32(255), total);
+			q0 = _mm256_add_epi32(q0, _mm256_and_si256(select0, error));
+			q1 = _mm256_add_epi32(q1, _mm256_and_si256(select1, error));
+			q2 = _mm256_add_epi32(q2, _mm256_and_si256(select2, error));
+			q3 = _mm256_add_epi32(q3, _mm256_and_si256(is3    , error));
+
+			const __m256i packed    = _mm256_or_si256(_mm256_or_si256(q0, _mm256_slli_epi32(q1, 8)), _mm256_or_si256(_mm256_slli_epi32(q2, 16), _mm256_slli_epi32(q3, 24)));
+			const __m256i hasWeight = _mm256_castps_si256(_mm256_and_ps(_mm256_cmp_ps(scale, zero, _CMP_GT_OQ), _mm256_cmp_ps(scale, _mm256_set1_ps(FLT_MAX), _CMP_LE_OQ)));
+			const __m256i result    = _mm256_blendv_epi8(_mm256_set1_epi32(255), packed, hasWeight);
+
+			// lane j holds the vertex j (0..3) and j + 4 (4..7) in the 128 bit halves
+			StoreUInt32x8(At(output, outputStride, i), outputStride, result);
+		}
+
+		sse4::PackUtility::NormalizeBoneWeightStream(At(output, outputStride, i), outputStride, At(input, inputStride, i), inputStride, count - i);
+	}
+	#pragma endregion Vertex Attribute
+#pragma endregion Implement
+}
+#endif
+#endif
@@ -0,0 +1,755 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMSimdPackNeon.hpp
+///             @brief  Bulk conversions between float and the compressed vertex formats by NEON.
+///                     - Same functions and same results as gm::simd::non::PackUtility.
+///                     - float <-> half uses vcvt_f16_f32 / vcvt_f32_f16 when the half precision conversion is available
+///                       (always on ARM64). Otherwise the scalar implementation is used.
+///                     - The octahedral normals and the bone weights are processed 4 vertices at a time (SoA).
+///                     - The remaining elements are processed by the scalar implementation.
+///             How To: PackUtility::ConvertFloatToSNorm16Stream(output, input, count)
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GM_SIMD_PACK_NEON_HPP
+#define GM_SIMD_PACK_NEON_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GMSimdMacros.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+#if PLATFORM_CPU_INSTRUCTION_NEON && !defined(PLATFORM_CPU_INSTRUCTION_NOT_USE)
+
+#if defined(_MSC_VER) && !defined(__clang__) && (defined(_M_ARM64) || defined(_M_HYBRID_X86_ARM64) || defined(_M_ARM64EC))
+	#include <arm64_neon.h>
+#else
+	#include <arm_neon.h>
+#endif
+#include "GMSimdPackNon.hpp"
+
+#if defined(__aarch64__) || defined(_M_ARM64) || defined(_M_HYBRID_X86_ARM64) || defined(_M_ARM64EC)
+	#define GM_SIMD_PACK_NEON_ARM64 1
+#else
+	#define GM_SIMD_PACK_NEON_ARM64 0
+#endif
+
+#if GM_SIMD_PACK_NEON_ARM64 || (defined(__ARM_FP) && (__ARM_FP & 2))
+	#define GM_SIMD_PACK_NEON_HALF 1
+#else
+	#define GM_SIMD_PACK_NEON_HALF 0
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gm::simd::neon
+{
+	/****************************************************************************
+	*				  			   PackUtility
+	*************************************************************************//**
+	*  @class     PackUtility
+	*  @brief     NEON pack / unpack operations
+	*****************************************************************************/
+	class PackUtility
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		#pragma region Half
+		/*----------------------------------------------------------------------
+		*  @brief : float -> half (round to nearest even). Overflow becomes infinity and NaN stays NaN.
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION ConvertFloatToHalfStream(gu::uint16* output, const float* input, const gu::uint64 count) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : half -> float (exact)
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION ConvertHalfToFloatStream(float* output, const gu::uint16* input, const gu::uint64 count) noexcept;
+		#pragma endregion Half
+
+		#pragma region Normalized Integer
+		/*----------------------------------------------------------------------
+		*  @brief : [-1, 1] <-> [-32767, 32767] (-32768 is also -1)
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION ConvertFloatToSNorm16Stream(gu::int16* output, const float* input, const gu::uint64 count) noexcept;
+
+		inline static void SIMD_CALL_CONVENTION ConvertSNorm16ToFloatStream(float* output, const gu::int16* input, const gu::uint64 count) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : [0, 1] <-> [0, 65535]
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION ConvertFloatToUNorm16Stream(gu::uint16* output, const float* input, const gu::uint64 count) noexcept;
+
+		inline static void SIMD_CALL_CONVENTION ConvertUNorm16ToFloatStream(float* output, const gu::uint16* input, const gu::uint64 count) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : [-1, 1] <-> [-127, 127] (-128 is also -1)
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION ConvertFloatToSNorm8Stream(gu::int8* output, const float* input, const gu::uint64 count) noexcept;
+
+		inline static void SIMD_CALL_CONVENTION ConvertSNorm8ToFloatStream(float* output, const gu::int8* input, const gu::uint64 count) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : [0, 1] <-> [0, 255]
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION ConvertFloatToUNorm8Stream(gu::uint8* output, const float* input, const gu::uint64 count) noexcept;
+
+		inline static void SIMD_CALL_CONVENTION ConvertUNorm8ToFloatStream(float* output, const gu::uint8* input, const gu::uint64 count) noexcept;
+		#pragma endregion Normalized Integer
+
+		#pragma region Vertex Attribute
+		/*----------------------------------------------------------------------
+		*  @brief : Float3 normal -> octahedral SNORM16x2. The input does not have to be a unit vector.
+		*           The zero vector is encoded as (0, 0), which is decoded as (0, 0, 1).
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION EncodeOctahedralNormalStream(gu::int16* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : Octahedral SNORM16x2 -> Float3 unit normal
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION DecodeOctahedralNormalStream(float* output, const gu::uint64 outputStride,
+			const gu::int16* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : float[4] bone weights -> UNORM8x4. The weights are normalized and the rounding error is
+		*           moved to the largest weight, so the sum is always 255. Negative and NaN weights are 0,
+		*           and the vertex without the valid weight (the sum is 0 or overflows) gets (255, 0, 0, 0).
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION NormalizeBoneWeightStream(gu::uint8* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept;
+		#pragma endregion Vertex Attribute
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+		template<typename T>
+		__forceinline static const T* At(const T* base, const gu::uint64 stride, const gu::uint64 index) noexcept
+		{
+			return reinterpret_cast<const T*>(reinterpret_cast<const gu::uint8*>(base) + stride * index);
+		}
+
+		template<typename T>
+		__forceinline static T* At(T* base, const gu::uint64 stride, const gu::uint64 index) noexcept
+		{
+			return reinterpret_cast<T*>(reinterpret_cast<gu::uint8*>(base) + stride * index);
+		}
+
+		/*----------------------------------------------------------------------
+		*  @brief : Round to nearest even (same as lrintf in the default rounding mode)
+		/*----------------------------------------------------------------------*/
+		__forceinline static int32x4_t RoundToInt(const float32x4_t value) noexcept
+		{
+		#if GM_SIMD_PACK_NEON_ARM64
+			return vcvtnq_s32_f32(value);
+		#else
+			// ARMv7 converts by truncation. The values are less than 2^22, so adding 1.5 * 2^23 rounds them.
+			const float32x4_t magic = vdupq_n_f32(12582912.0f);
+			return vcvtq_s32_f32(vsubq_f32(vaddq_f32(value, magic), magic));
+		#endif
+		}
+
+		/*----------------------------------------------------------------------
+		*  @brief : NaN -> 0, clamp [minimum, 1], scale and round to nearest even
+		/*----------------------------------------------------------------------*/
+		__forceinline static int32x4_t Quantize(const float32x4_t value, const float32x4_t minimum, const float32x4_t scale) noexcept
+		{
+			const uint32x4_t isOrdered = vceqq_f32(value, value);
+			float32x4_t result = vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(value), isOrdered));
+			result = vminq_f32(vmaxq_f32(result, minimum), vdupq_n_f32(1.0f));
+			return RoundToInt(vmulq_f32(result, scale));
+		}
+
+		__forceinline static float32x4_t Dequantize(const int32x4_t value, const float32x4_t reciprocalScale) noexcept
+		{
+			return vmaxq_f32(vmulq_f32(vcvtq_f32_s32(value), reciprocalScale), vdupq_n_f32(-1.0f));
+		}
+
+		/*----------------------------------------------------------------------
+		*  @brief : Exact division (ARMv7 has no vector division, so the lanes are divided one by one)
+		/*----------------------------------------------------------------------*/
+		__forceinline static float32x4_t Divide(const float32x4_t left, const float32x4_t right) noexcept
+		{
+		#if GM_SIMD_PACK_NEON_ARM64
+			return vdivq_f32(left, right);
+		#else
+			float l[4], r[4];
+			vst1q_f32(l, left);
+			vst1q_f32(r, right);
+			for (gu::uint32 i = 0; i < 4; ++i) { l[i] = l[i] / r[i]; }
+			return vld1q_f32(l);
+		#endif
+		}
+
+		__forceinline static float32x4_t Sqrt(const float32x4_t value) noexcept
+		{
+		#if GM_SIMD_PACK_NEON_ARM64
+			return vsqrtq_f32(value);
+		#else
+			float v[4];
+			vst1q_f32(v, value);
+			for (gu::uint32 i = 0; i < 4; ++i) { v[i] = sqrtf(v[i]); }
+			return vld1q_f32(v);
+		#endif
+		}
+
+		/*----------------------------------------------------------------------
+		*  @brief : (x >= 0 ? 1 : -1) like the scalar comparison (-0 is 1)
+		/*----------------------------------------------------------------------*/
+		__forceinline static float32x4_t SignNotZero(const float32x4_t value) noexcept
+		{
+			return vbslq_f32(vcgeq_f32(value, vdupq_n_f32(0.0f)), vdupq_n_f32(1.0f), vdupq_n_f32(-1.0f));
+		}
+
+		/*----------------------------------------------------------------------
+		*  @brief : Load 4 Float3 with the stride as SoA
+		/*----------------------------------------------------------------------*/
+		__forceinline static void LoadFloat3x4(const float* input, const gu::uint64 stride, float32x4_t& x, float32x4_t& y, float32x4_t& z) noexcept
+		{
+			if (stride == sizeof(float) * 3)
+			{
+				const float32x4x3_t vector = vld3q_f32(input);
+				x = vector.val[0]; y = vector.val[1]; z = vector.val[2];
+				return;
+			}
+
+			float xs[4], ys[4], zs[4];
+			for (gu::uint64 i = 0; i < 4; ++i)
+			{
+				const float* source = At(input, stride, i);
+				xs[i] = source[0]; ys[i] = source[1]; zs[i] = source[2];
+			}
+			x = vld1q_f32(xs); y = vld1q_f32(ys); z = vld1q_f32(zs);
+		}
+
+		/*----------------------------------------------------------------------
+		*  @brief : Store the 32 bit lane i to the vertex i
+		/*----------------------------------------------------------------------*/
+		__forceinline static void StoreUInt32x4(void* output, const gu::uint64 stride, const uint32x4_t value) noexcept
+		{
+			gu::uint32 lanes[4];
+			vst1q_u32(lanes, value);
+			for (gu::uint32 i = 0; i < 4; ++i)
+			{
+				memcpy(At(static_cast<gu::uint8*>(output), stride, i), &lanes[i], sizeof(gu::uint32));
+			}
+		}
+	};
+
+#pragma region Implement
+	#pragma region Half
+	/****************************************************************************
+	*                       ConvertFloatToHalfStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToHalfStream(gu::uint16* output, const float* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the float array to the half array (8 elements per iteration)
+	*
+	*  @param[out] gu::uint16* output
+	*  @param[in]  const float* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToHalfStream(gu::uint16* output, const float* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		gu::uint64 i = 0;
+	#if GM_SIMD_PACK_NEON_HALF
+		for (; i + 8 <= count; i += 8)
+		{
+			const uint16x4_t low  = vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(input + i    )));
+			const uint16x4_t high = vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(input + i + 4)));
+			vst1q_u16(output + i, vcombine_u16(low, high));
+		}
+	#endif
+
+		non::PackUtility::ConvertFloatToHalfStream(output + i, input + i, count - i);
+	}
+
+	/****************************************************************************
+	*                       ConvertHalfToFloatStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertHalfToFloatStream(float* output, const gu::uint16* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the half array to the float array (8 elements per iteration)
+	*
+	*  @param[out] float* output
+	*  @param[in]  const gu::uint16* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertHalfToFloatStream(float* output, const gu::uint16* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		gu::uint64 i = 0;
+	#if GM_SIMD_PACK_NEON_HALF
+		for (; i + 8 <= count; i += 8)
+		{
+			const uint16x8_t value = vld1q_u16(input + i);
+			vst1q_f32(output + i    , vcvt_f32_f16(vreinterpret_f16_u16(vget_low_u16 (value))));
+			vst1q_f32(output + i + 4, vcvt_f32_f16(vreinterpret_f16_u16(vget_high_u16(value))));
+		}
+	#endif
+
+		non::PackUtility::ConvertHalfToFloatStream(output + i, input + i, count - i);
+	}
+	#pragma endregion Half
+
+	#pragma region Normalized Integer
+	/****************************************************************************
+	*                       ConvertFloatToSNorm16Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToSNorm16Stream(gu::int16* output, const float* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the float array to the SNORM16 array (8 elements per iteration)
+	*
+	*  @param[out] gu::int16* output
+	*  @param[in]  const float* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToSNorm16Stream(gu::int16* output, const float* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const float32x4_t minimum = vdupq_n_f32(-1.0f);
+		const float32x4_t scale   = vdupq_n_f32(32767.0f);
+
+		gu::uint64 i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			const int32x4_t low  = Quantize(vld1q_f32(input + i    ), minimum, scale);
+			const int32x4_t high = Quantize(vld1q_f32(input + i + 4), minimum, scale);
+			vst1q_s16(output + i, vcombine_s16(vmovn_s32(low), vmovn_s32(high)));
+		}
+
+		non::PackUtility::ConvertFloatToSNorm16Stream(output + i, input + i, count - i);
+	}
+
+	/****************************************************************************
+	*                       ConvertSNorm16ToFloatStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertSNorm16ToFloatStream(float* output, const gu::int16* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the SNORM16 array to the float array (8 elements per iteration)
+	*
+	*  @param[out] float* output
+	*  @param[in]  const gu::int16* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertSNorm16ToFloatStream(float* output, const gu::int16* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const float32x4_t reciprocalScale = vdupq_n_f32(1.0f / 32767.0f);
+
+		gu::uint64 i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			const int16x8_t value = vld1q_s16(input + i);
+			vst1q_f32(output + i    , Dequantize(vmovl_s16(vget_low_s16 (value)), reciprocalScale));
+			vst1q_f32(output + i + 4, Dequantize(vmovl_s16(vget_high_s16(value)), reciprocalScale));
+		}
+
+		non::PackUtility::ConvertSNorm16ToFloatStream(output + i, input + i, count - i);
+	}
+
+	/****************************************************************************
+	*                       ConvertFloatToUNorm16Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToUNorm16Stream(gu::uint16* output, const float* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the float array to the UNORM16 array (8 elements per iteration)
+	*
+	*  @param[out] gu::uint16* output
+	*  @param[in]  const float* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToUNorm16Stream(gu::uint16* output, const float* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const float32x4_t minimum = vdupq_n_f32(0.0f);
+		const float32x4_t scale   = vdupq_n_f32(65535.0f);
+
+		gu::uint64 i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			const uint32x4_t low  = vreinterpretq_u32_s32(Quantize(vld1q_f32(input + i    ), minimum, scale));
+			const uint32x4_t high = vreinterpretq_u32_s32(Quantize(vld1q_f32(input + i + 4), minimum, scale));
+			vst1q_u16(output + i, vcombine_u16(vmovn_u32(low), vmovn_u32(high)));
+		}
+
+		non::PackUtility::ConvertFloatToUNorm16Stream(output + i, input + i, count - i);
+	}
+
+	/****************************************************************************
+	*                       ConvertUNorm16ToFloatStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertUNorm16ToFloatStream(float* output, const gu::uint16* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the UNORM16 array to the float array (8 elements per iteration)
+	*
+	*  @param[out] float* output
+	*  @param[in]  const gu::uint16* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertUNorm16ToFloatStream(float* output, const gu::uint16* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const float32x4_t reciprocalScale = vdupq_n_f32(1.0f / 65535.0f);
+
+		gu::uint64 i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			const uint16x8_t value = vld1q_u16(input + i);
+			vst1q_f32(output + i    , vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16 (value))), reciprocalScale));
+			vst1q_f32(output + i + 4, vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(value))), reciprocalScale));
+		}
+
+		non::PackUtility::ConvertUNorm16ToFloatStream(output + i, input + i, count - i);
+	}
+
+	/****************************************************************************
+	*                       ConvertFloatToSNorm8Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToSNorm8Stream(gu::int8* output, const float* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the float array to the SNORM8 array (8 elements per iteration)
+	*
+	*  @param[out] gu::int8* output
+	*  @param[in]  const float* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToSNorm8Stream(gu::int8* output, const float* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const float32x4_t minimum = vdupq_n_f32(-1.0f);
+		const float32x4_t scale   = vdupq_n_f32(127.0f);
+
+		gu::uint64 i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			const int32x4_t low  = Quantize(vld1q_f32(input + i    ), minimum, scale);
+			const int32x4_t high = Quantize(vld1q_f32(input + i + 4), minimum, scale);
+			vst1_s8(output + i, vmovn_s16(vcombine_s16(vmovn_s32(low), vmovn_s32(high))));
+		}
+
+		non::PackUtility::ConvertFloatToSNorm8Stream(output + i, input + i, count - i);
+	}
+
+	/****************************************************************************
+	*                       ConvertSNorm8ToFloatStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertSNorm8ToFloatStream(float* output, const gu::int8* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the SNORM8 array to the float array (8 elements per iteration)
+	*
+	*  @param[out] float* output
+	*  @param[in]  const gu::int8* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertSNorm8ToFloatStream(float* output, const gu::int8* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const float32x4_t reciprocalScale = vdupq_n_f32(1.0f / 127.0f);
+
+		gu::uint64 i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			const int16x8_t value = vmovl_s8(vld1_s8(input + i));
+			vst1q_f32(output + i    , Dequantize(vmovl_s16(vget_low_s16 (value)), reciprocalScale));
+			vst1q_f32(output + i + 4, Dequantize(vmovl_s16(vget_high_s16(value)), reciprocalScale));
+		}
+
+		non::PackUtility::ConvertSNorm8ToFloatStream(output + i, input + i, count - i);
+	}
+
+	/****************************************************************************
+	*                       ConvertFloatToUNorm8Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToUNorm8Stream(gu::uint8* output, const float* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the float array to the UNORM8 array (8 elements per iteration)
+	*
+	*  @param[out] gu::uint8* output
+	*  @param[in]  const float* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToUNorm8Stream(gu::uint8* output, const float* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const float32x4_t minimum = vdupq_n_f32(0.0f);
+		const float32x4_t scale   = vdupq_n_f32(255.0f);
+
+		gu::uint64 i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			const uint32x4_t low  = vreinterpretq_u32_s32(Quantize(vld1q_f32(input + i    ), minimum, scale));
+			const uint32x4_t high = vreinterpretq_u32_s32(Quantize(vld1q_f32(input + i + 4), minimum, scale));
+			vst1_u8(output + i, vmovn_u16(vcombine_u16(vmovn_u32(low), vmovn_u32(high))));
+		}
+
+		non::PackUtility::ConvertFloatToUNorm8Stream(output + i, input + i, count - i);
+	}
+
+	/****************************************************************************
+	*                       ConvertUNorm8ToFloatStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertUNorm8ToFloatStream(float* output, const gu::uint8* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the UNORM8 array to the float array (8 elements per iteration)
+	*
+	*  @param[out] float* output
+	*  @param[in]  const gu::uint8* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertUNorm8ToFloatStream(float* output, const gu::uint8* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const float32x4_t reciprocalScale = vdupq_n_f32(1.0f / 255.0f);
+
+		gu::uint64 i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			const uint16x8_t value = vmovl_u8(vld1_u8(input + i));
+			vst1q_f32(output + i    , vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16 (value))), reciprocalScale));
+			vst1q_f32(output + i + 4, vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(value))), reciprocalScale));
+		}
+
+		non::PackUtility::ConvertUNorm8ToFloatStream(output + i, input + i, count - i);
+	}
+	#pragma endregion Normalized Integer
+
+	#pragma region Vertex Attribute
+	/****************************************************************************
+	*                       EncodeOctahedralNormalStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::EncodeOctahedralNormalStream(gu::int16* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	*
+	*  @brief     Project the normals onto the octahedron (4 normals per iteration)
+	*
+	*  @param[out] gu::int16* output (int16[2])
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float3)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::EncodeOctahedralNormalStream(gu::int16* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const float32x4_t zero    = vdupq_n_f32(0.0f);
+		const float32x4_t one     = vdupq_n_f32(1.0f);
+		const float32x4_t minimum = vdupq_n_f32(-1.0f);
+		const float32x4_t scale   = vdupq_n_f32(32767.0f);
+
+		gu::uint64 i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			float32x4_t x, y, z;
+			LoadFloat3x4(At(input, inputStride, i), inputStride, x, y, z);
+
+			const float32x4_t length           = vaddq_f32(vaddq_f32(vabsq_f32(x), vabsq_f32(y)), vabsq_f32(z));
+			const uint32x4_t  isPositive       = vcgtq_f32(length, zero);
+			const float32x4_t reciprocalLength = vreinterpretq_f32_u32(vandq_u32(isPositive, vreinterpretq_u32_f32(Divide(one, length))));
+
+			const float32x4_t projectedU = vmulq_f32(x, reciprocalLength);
+			const float32x4_t projectedV = vmulq_f32(y, reciprocalLength);
+			const float32x4_t foldU      = vmulq_f32(vsubq_f32(one, vabsq_f32(projectedV)), SignNotZero(projectedU));
+			const float32x4_t foldV      = vmulq_f32(vsubq_f32(one, vabsq_f32(projectedU)), SignNotZero(projectedV));
+			const uint32x4_t  isLower    = vcltq_f32(z, zero);
+
+			const uint32x4_t u = vreinterpretq_u32_s32(Quantize(vbslq_f32(isLower, foldU, projectedU), minimum, scale));
+			const uint32x4_t v = vreinterpretq_u32_s32(Quantize(vbslq_f32(isLower, foldV, projectedV), minimum, scale));
+
+			StoreUInt32x4(At(output, outputStride, i), outputStride, vorrq_u32(vandq_u32(u, vdupq_n_u32(0xffff)), vshlq_n_u32(v, 16)));
+		}
+
+		non::PackUtility::EncodeOctahedralNormalStream(At(output, outputStride, i), outputStride, At(input, inputStride, i), inputStride, count - i);
+	}
+
+	/****************************************************************************
+	*                       DecodeOctahedralNormalStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::DecodeOctahedralNormalStream(float* output, const gu::uint64 outputStride,
+	*             const gu::int16* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	*
+	*  @brief     Fold the square back onto the octahedron and normalize (4 normals per iteration)
+	*
+	*  @param[out] float* output (Float3)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const gu::int16* input (int16[2])
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::DecodeOctahedralNormalStream(float* output, const gu::uint64 outputStride,
+		const gu::int16* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const float32x4_t zero            = vdupq_n_f32(0.0f);
+		const float32x4_t one             = vdupq_n_f32(1.0f);
+		const float32x4_t reciprocalScale = vdupq_n_f32(1.0f / 32767.0f);
+
+		gu::uint64 i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			gu::int32 lanes[4];
+			for (gu::uint64 j = 0; j < 4; ++j) { memcpy(&lanes[j], At(input, inputStride, i + j), sizeof(gu::int32)); }
+
+			const int32x4_t packed = vld1q_s32(lanes);
+			float32x4_t x = Dequantize(vshrq_n_s32(vshlq_n_s32(packed, 16), 16), reciprocalScale);
+			float32x4_t y = Dequantize(vshrq_n_s32(packed, 16), reciprocalScale);
+			float32x4_t z = vsubq_f32(vsubq_f32(one, vabsq_f32(x)), vabsq_f32(y));
+
+			const float32x4_t fold = vmaxq_f32(vsubq_f32(zero, z), zero);
+			x = vaddq_f32(x, vbslq_f32(vcgeq_f32(x, zero), vnegq_f32(fold), fold));
+			y = vaddq_f32(y, vbslq_f32(vcgeq_f32(y, zero), vnegq_f32(fold), fold));
+
+			// vmlaq may be fused on ARM64, so the products are rounded separately like the scalar implementation
+			const float32x4_t normSquared    = vaddq_f32(vaddq_f32(vmulq_f32(x, x), vmulq_f32(y, y)), vmulq_f32(z, z));
+			const float32x4_t reciprocalNorm = Divide(one, Sqrt(normSquared));
+
+			float xs[4], ys[4], zs[4];
+			vst1q_f32(xs, vmulq_f32(x, reciprocalNorm));
+			vst1q_f32(ys, vmulq_f32(y, reciprocalNorm));
+			vst1q_f32(zs, vmulq_f32(z, reciprocalNorm));
+			for (gu::uint64 j = 0; j < 4; ++j)
+			{
+				float* destination = At(output, outputStride, i + j);
+				destination[0] = xs[j];
+				destination[1] = ys[j];
+				destination[2] = zs[j];
+			}
+		}
+
+		non::PackUtility::DecodeOctahedralNormalStream(At(output, outputStride, i), outputStride, At(input, inputStride, i), inputStride, count - i);
+	}
+
+	/****************************************************************************
+	*                       NormalizeBoneWeightStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::NormalizeBoneWeightStream(gu::uint8* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	*
+	*  @brief     Quantize the bone weights keeping the sum 255 (4 vertices per iteration)
+	*
+	*  @param[out] gu::uint8* output (uint8[4])
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (float[4])
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::NormalizeBoneWeightStream(gu::uint8* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const float32x4_t zero = vdupq_n_f32(0.0f);
+
+		gu::uint64 i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			float32x4x4_t weight;
+			if (inputStride == sizeof(float) * 4)
+			{
+				weight = vld4q_f32(At(input, inputStride, i));
+			}
+			else
+			{
+				float32x4x2_t low  = vzipq_f32(vld1q_f32(At(input, inputStride, i + 0)), vld1q_f32(At(input, inputStride, i + 2)));
+				float32x4x2_t high = vzipq_f32(vld1q_f32(At(input, inputStride, i + 1)), vld1q_f32(At(input, inputStride, i + 3)));
+				const float32x4x2_t even = vzipq_f32(low.val[0], high.val[0]);
+				const float32x4x2_t odd  = vzipq_f32(low.val[1], high.val[1]);
+				weight.val[0] = even.val[0]; weight.val[1] = even.val[1];
+				weight.val[2] = odd.val[0];  weight.val[3] = odd.val[1];
+			}
+
+			// vmaxq_f32 keeps NaN, so the NaN lanes are cleared first
+			float32x4_t w[4];
+			for (gu::uint32 k = 0; k < 4; ++k)
+			{
+				const uint32x4_t isPositive = vcgtq_f32(weight.val[k], zero);
+				w[k] = vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(weight.val[k]), isPositive));
+			}
+
+			const float32x4_t sum   = vaddq_f32(vaddq_f32(w[0], w[2]), vaddq_f32(w[1], w[3]));
+			const float32x4_t scale = Divide(vdupq_n_f32(255.0f), sum);
+
+			int32x4_t q0 = RoundToInt(vmulq_f32(w[0], scale));
+			int32x4_t q1 = RoundToInt(vmulq_f32(w[1], scale));
+			int32x4_t q2 = RoundToInt(vmulq_f32(w[2], scale));
+			int32x4_t q3 = RoundToInt(vmulq_f32(w[3], scale));
+
+			// first largest lane (the same tie break as the scalar loop)
+			const uint32x4_t is1     = vcgtq_s32(q1, q0);
+			const uint32x4_t is2     = vcgtq_s32(q2, vmaxq_s32(q0, q1));
+			const uint32x4_t is3     = vcgtq_s32(q3, vmaxq_s32(vmaxq_s32(q0, q1), q2));
+			const uint32x4_t select2 = vbicq_u32(is2, is3);
+			const uint32x4_t select1 = vbicq_u32(is1, vorrq_u32(is3, is2));
+			const uint32x4_t select0 = vmvnq_u32(vorrq_u32(vorrq_u32(is3, is2), is1));
+
+			const int32x4_t total = vaddq_s32(vaddq_s32(q0, q1), vaddq_s32(q2, q3));
+			const int32x4_t error = vsubq_s32(vdupq_n_s32(255), total);
+			q0 = vaddq_s32(q0, vandq_s32(vreinterpretq_s32_u32(select0), error));
+			q1 = vaddq_s32(q1, vandq_s32(vreinterpretq_s32_u32(select1), error));
+			q2 = vaddq_s32(q2, vandq_s32(vreinterpretq_s32_u32(select2), error));
+			q3 = vaddq_s32(q3, vandq_s32(vreinterpretq_s32_u32(is3)    , error));
+
+			const uint32x4_t packed = vorrq_u32(
+				vorrq_u32(vreinterpretq_u32_s32(q0), vshlq_n_u32(vreinterpretq_u32_s32(q1), 8)),
+				vorrq_u32(vshlq_n_u32(vreinterpretq_u32_s32(q2), 16), vshlq_n_u32(vreinterpretq_u32_s32(q3), 24)));
+			const uint32x4_t hasWeight = vandq_u32(vcgtq_f32(scale, zero), vcleq_f32(scale, vdupq_n_f32(FLT_MAX)));
+
+			StoreUInt32x4(At(output, outputStride, i), outputStride, vbslq_u32(hasWeight, packed, vdupq_n_u32(255)));
+		}
+
+		non::PackUtility::NormalizeBoneWeightStream(At(output, outputStride, i), outputStride, At(input, inputStride, i), inputStride, count - i);
+	}
+	#pragma endregion Vertex Attribute
+#pragma endregion Implement
+}
+
+#undef GM_SIMD_PACK_NEON_HALF
+#undef GM_SIMD_PACK_NEON_ARM64
+#endif
+#endif
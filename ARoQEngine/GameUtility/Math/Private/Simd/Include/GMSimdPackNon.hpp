@@ -0,0 +1,653 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMSimdPackNon.hpp
+///             @brief  Bulk conversions between float and the compressed vertex formats without SIMD.
+///                     - float <-> half (IEEE 754 binary16, round to nearest even)
+///                     - float <-> SNORM / UNORM 8 / 16 bit (D3D rules: NaN is 0, clamped, round to nearest even)
+///                     - Float3 normal <-> octahedral SNORM16x2
+///                     - float[4] bone weights -> UNORM8x4 whose sum is exactly 255
+///                     - The scalar conversions take the element count of the contiguous arrays.
+///                       The vertex attribute conversions take the strides in bytes.
+///                     - This backend is always compiled, because it is the reference of the SIMD backends.
+///             How To: PackUtility::ConvertFloatToHalfStream(output, input, count)
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GM_SIMD_PACK_NON_HPP
+#define GM_SIMD_PACK_NON_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GMSimdMacros.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gm::simd::non
+{
+	/****************************************************************************
+	*				  			   PackUtility
+	*************************************************************************//**
+	*  @class     PackUtility
+	*  @brief     Scalar pack / unpack operations
+	*****************************************************************************/
+	class PackUtility
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		#pragma region Half
+		/*----------------------------------------------------------------------
+		*  @brief : float -> half. Overflow becomes infinity and NaN stays NaN.
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION ConvertFloatToHalfStream(gu::uint16* output, const float* input, const gu::uint64 count) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : half -> float (exact)
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION ConvertHalfToFloatStream(float* output, const gu::uint16* input, const gu::uint64 count) noexcept;
+		#pragma endregion Half
+
+		#pragma region Normalized Integer
+		/*----------------------------------------------------------------------
+		*  @brief : [-1, 1] <-> [-32767, 32767] (-32768 is also -1)
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION ConvertFloatToSNorm16Stream(gu::int16* output, const float* input, const gu::uint64 count) noexcept;
+
+		inline static void SIMD_CALL_CONVENTION ConvertSNorm16ToFloatStream(float* output, const gu::int16* input, const gu::uint64 count) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : [0, 1] <-> [0, 65535]
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION ConvertFloatToUNorm16Stream(gu::uint16* output, const float* input, const gu::uint64 count) noexcept;
+
+		inline static void SIMD_CALL_CONVENTION ConvertUNorm16ToFloatStream(float* output, const gu::uint16* input, const gu::uint64 count) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : [-1, 1] <-> [-127, 127] (-128 is also -1)
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION ConvertFloatToSNorm8Stream(gu::int8* output, const float* input, const gu::uint64 count) noexcept;
+
+		inline static void SIMD_CALL_CONVENTION ConvertSNorm8ToFloatStream(float* output, const gu::int8* input, const gu::uint64 count) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : [0, 1] <-> [0, 255]
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION ConvertFloatToUNorm8Stream(gu::uint8* output, const float* input, const gu::uint64 count) noexcept;
+
+		inline static void SIMD_CALL_CONVENTION ConvertUNorm8ToFloatStream(float* output, const gu::uint8* input, const gu::uint64 count) noexcept;
+		#pragma endregion Normalized Integer
+
+		#pragma region Vertex Attribute
+		/*----------------------------------------------------------------------
+		*  @brief : Float3 normal -> octahedral SNORM16x2. The input does not have to be a unit vector.
+		*           The zero vector is encoded as (0, 0), which is decoded as (0, 0, 1).
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION EncodeOctahedralNormalStream(gu::int16* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : Octahedral SNORM16x2 -> Float3 unit normal
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION DecodeOctahedralNormalStream(float* output, const gu::uint64 outputStride,
+			const gu::int16* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : float[4] bone weights -> UNORM8x4. The weights are normalized and the rounding error is
+		*           moved to the largest weight, so the sum is always 255. Negative and NaN weights are 0,
+		*           and the vertex without the valid weight (the sum is 0 or overflows) gets (255, 0, 0, 0).
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION NormalizeBoneWeightStream(gu::uint8* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept;
+		#pragma endregion Vertex Attribute
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+		template<typename T>
+		__forceinline static const T* At(const T* base, const gu::uint64 stride, const gu::uint64 index) noexcept
+		{
+			return reinterpret_cast<const T*>(reinterpret_cast<const gu::uint8*>(base) + stride * index);
+		}
+
+		template<typename T>
+		__forceinline static T* At(T* base, const gu::uint64 stride, const gu::uint64 index) noexcept
+		{
+			return reinterpret_cast<T*>(reinterpret_cast<gu::uint8*>(base) + stride * index);
+		}
+
+		__forceinline static gu::uint32 AsUInt(const float value) noexcept { gu::uint32 result; memcpy(&result, &value, sizeof(result)); return result; }
+
+		__forceinline static float AsFloat(const gu::uint32 value) noexcept { float result; memcpy(&result, &value, sizeof(result)); return result; }
+
+		/*----------------------------------------------------------------------
+		*  @brief : NaN -> 0, clamp and scale, then round to nearest even (the SIMD conversion rounding)
+		/*----------------------------------------------------------------------*/
+		__forceinline static gu::int32 Quantize(const float value, const float minimum, const float scale) noexcept
+		{
+			float result = value == value ? value : 0.0f;
+			result = result < minimum ? minimum : result;
+			result = result > 1.0f    ? 1.0f    : result;
+			return static_cast<gu::int32>(lrintf(result * scale));
+		}
+
+		__forceinline static float Dequantize(const gu::int32 value, const float reciprocalScale) noexcept
+		{
+			const float result = static_cast<float>(value) * reciprocalScale;
+			return result < -1.0f ? -1.0f : result;
+		}
+
+		inline static gu::uint16 FloatToHalf(const float value) noexcept;
+
+		inline static float HalfToFloat(const gu::uint16 value) noexcept;
+
+		inline static void EncodeOctahedral(const float x, const float y, const float z, gu::int16* output) noexcept;
+
+		inline static void DecodeOctahedral(const gu::int16* input, float* output) noexcept;
+
+		inline static void NormalizeBoneWeight(const float* weights, gu::uint8* output) noexcept;
+
+		static constexpr float SNORM16_SCALE = 32767.0f;
+		static constexpr float UNORM16_SCALE = 65535.0f;
+		static constexpr float SNORM8_SCALE  = 127.0f;
+		static constexpr float UNORM8_SCALE  = 255.0f;
+	};
+
+#pragma region Implement
+	#pragma region Half
+	/****************************************************************************
+	*                       ConvertFloatToHalfStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToHalfStream(gu::uint16* output, const float* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the float array to the half array
+	*
+	*  @param[out] gu::uint16* output
+	*  @param[in]  const float* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToHalfStream(gu::uint16* output, const float* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		for (gu::uint64 i = 0; i < count; ++i)
+		{
+			output[i] = FloatToHalf(input[i]);
+		}
+	}
+
+	/****************************************************************************
+	*                       ConvertHalfToFloatStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertHalfToFloatStream(float* output, const gu::uint16* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the half array to the float array
+	*
+	*  @param[out] float* output
+	*  @param[in]  const gu::uint16* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertHalfToFloatStream(float* output, const gu::uint16* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		for (gu::uint64 i = 0; i < count; ++i)
+		{
+			output[i] = HalfToFloat(input[i]);
+		}
+	}
+
+	/****************************************************************************
+	*                       FloatToHalf
+	*************************************************************************//**
+	*  @fn        inline gu::uint16 PackUtility::FloatToHalf(const float value) noexcept
+	*
+	*  @brief     float -> half (round to nearest even).
+	*             The denormal results are rounded by the float addition of the magic number,
+	*             and the normal results by adding the rounding bias to the bit pattern.
+	*
+	*  @param[in] const float value
+	*
+	*  @return    gu::uint16
+	*****************************************************************************/
+	inline gu::uint16 PackUtility::FloatToHalf(const float value) noexcept
+	{
+		constexpr gu::uint32 FLOAT_INFINITY = 255u << 23;
+		constexpr gu::uint32 HALF_MAX       = (127u + 16u) << 23;           // the float values >= this round to infinity
+		constexpr gu::uint32 MIN_NORMAL     = (127u - 14u) << 23;           // the smallest float which is the normal half
+		constexpr gu::uint32 DENORMAL_MAGIC = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+		gu::uint32 bits = AsUInt(value);
+		const gu::uint32 sign = bits & 0x80000000u;
+		bits ^= sign;
+
+		gu::uint32 result = 0;
+		if (bits >= HALF_MAX)
+		{
+			// NaN keeps the upper payload bits and becomes quiet (the same as F16C and NEON)
+			result = bits > FLOAT_INFINITY ? 0x7e00u | ((bits >> 13) & 0x3ffu) : 0x7c00u;
+		}
+		else if (bits < MIN_NORMAL)
+		{
+			result = AsUInt(AsFloat(bits) + AsFloat(DENORMAL_MAGIC)) - DENORMAL_MAGIC;
+		}
+		else
+		{
+			const gu::uint32 mantissaOdd = (bits >> 13) & 1u;
+			result = (bits + (0xfffu - ((127u - 15u) << 23)) + mantissaOdd) >> 13;
+		}
+		return static_cast<gu::uint16>(result | (sign >> 16));
+	}
+
+	/****************************************************************************
+	*                       HalfToFloat
+	*************************************************************************//**
+	*  @fn        inline float PackUtility::HalfToFloat(const gu::uint16 value) noexcept
+	*
+	*  @brief     half -> float. The exponent is rebiased by multiplying 2^112,
+	*             which also normalizes the denormal halves.
+	*
+	*  @param[in] const gu::uint16 value
+	*
+	*  @return    float
+	*****************************************************************************/
+	inline float PackUtility::HalfToFloat(const gu::uint16 value) noexcept
+	{
+		constexpr gu::uint32 MAGIC = (254u - 15u) << 23;
+
+		const gu::uint32 exponentMantissa = value & 0x7fffu;
+		const gu::uint32 sign             = (value & 0x8000u) << 16;
+
+		gu::uint32 result = AsUInt(AsFloat(exponentMantissa << 13) * AsFloat(MAGIC));
+		if (exponentMantissa > 0x7bffu) { result |= 255u << 23; }   // infinity and NaN
+		if (exponentMantissa > 0x7c00u) { result |= 0x00400000u; } // quiet NaN (the same as F16C and NEON)
+		return AsFloat(result | sign);
+	}
+	#pragma endregion Half
+
+	#pragma region Normalized Integer
+	/****************************************************************************
+	*                       ConvertFloatToSNorm16Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToSNorm16Stream(gu::int16* output, const float* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the float array to the SNORM16 array
+	*
+	*  @param[out] gu::int16* output
+	*  @param[in]  const float* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToSNorm16Stream(gu::int16* output, const float* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		for (gu::uint64 i = 0; i < count; ++i)
+		{
+			output[i] = static_cast<gu::int16>(Quantize(input[i], -1.0f, SNORM16_SCALE));
+		}
+	}
+
+	/****************************************************************************
+	*                       ConvertSNorm16ToFloatStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertSNorm16ToFloatStream(float* output, const gu::int16* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the SNORM16 array to the float array
+	*
+	*  @param[out] float* output
+	*  @param[in]  const gu::int16* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertSNorm16ToFloatStream(float* output, const gu::int16* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		for (gu::uint64 i = 0; i < count; ++i)
+		{
+			output[i] = Dequantize(input[i], 1.0f / SNORM16_SCALE);
+		}
+	}
+
+	/****************************************************************************
+	*                       ConvertFloatToUNorm16Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToUNorm16Stream(gu::uint16* output, const float* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the float array to the UNORM16 array
+	*
+	*  @param[out] gu::uint16* output
+	*  @param[in]  const float* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToUNorm16Stream(gu::uint16* output, const float* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		for (gu::uint64 i = 0; i < count; ++i)
+		{
+			output[i] = static_cast<gu::uint16>(Quantize(input[i], 0.0f, UNORM16_SCALE));
+		}
+	}
+
+	/****************************************************************************
+	*                       ConvertUNorm16ToFloatStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertUNorm16ToFloatStream(float* output, const gu::uint16* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the UNORM16 array to the float array
+	*
+	*  @param[out] float* output
+	*  @param[in]  const gu::uint16* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertUNorm16ToFloatStream(float* output, const gu::uint16* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		for (gu::uint64 i = 0; i < count; ++i)
+		{
+			output[i] = static_cast<float>(input[i]) * (1.0f / UNORM16_SCALE);
+		}
+	}
+
+	/****************************************************************************
+	*                       ConvertFloatToSNorm8Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToSNorm8Stream(gu::int8* output, const float* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the float array to the SNORM8 array
+	*
+	*  @param[out] gu::int8* output
+	*  @param[in]  const float* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToSNorm8Stream(gu::int8* output, const float* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		for (gu::uint64 i = 0; i < count; ++i)
+		{
+			output[i] = static_cast<gu::int8>(Quantize(input[i], -1.0f, SNORM8_SCALE));
+		}
+	}
+
+	/****************************************************************************
+	*                       ConvertSNorm8ToFloatStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertSNorm8ToFloatStream(float* output, const gu::int8* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the SNORM8 array to the float array
+	*
+	*  @param[out] float* output
+	*  @param[in]  const gu::int8* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertSNorm8ToFloatStream(float* output, const gu::int8* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		for (gu::uint64 i = 0; i < count; ++i)
+		{
+			output[i] = Dequantize(input[i], 1.0f / SNORM8_SCALE);
+		}
+	}
+
+	/****************************************************************************
+	*                       ConvertFloatToUNorm8Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToUNorm8Stream(gu::uint8* output, const float* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the float array to the UNORM8 array
+	*
+	*  @param[out] gu::uint8* output
+	*  @param[in]  const float* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToUNorm8Stream(gu::uint8* output, const float* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		for (gu::uint64 i = 0; i < count; ++i)
+		{
+			output[i] = static_cast<gu::uint8>(Quantize(input[i], 0.0f, UNORM8_SCALE));
+		}
+	}
+
+	/****************************************************************************
+	*                       ConvertUNorm8ToFloatStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertUNorm8ToFloatStream(float* output, const gu::uint8* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the UNORM8 array to the float array
+	*
+	*  @param[out] float* output
+	*  @param[in]  const gu::uint8* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertUNorm8ToFloatStream(float* output, const gu::uint8* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		for (gu::uint64 i = 0; i < count; ++i)
+		{
+			output[i] = static_cast<float>(input[i]) * (1.0f / UNORM8_SCALE);
+		}
+	}
+	#pragma endregion Normalized Integer
+
+	#pragma region Vertex Attribute
+	/****************************************************************************
+	*                       EncodeOctahedralNormalStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::EncodeOctahedralNormalStream(gu::int16* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	*
+	*  @brief     Project the normals onto the octahedron and unfold the lower half into the square
+	*
+	*  @param[out] gu::int16* output (int16[2])
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float3)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::EncodeOctahedralNormalStream(gu::int16* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		for (gu::uint64 i = 0; i < count; ++i)
+		{
+			const float* source = At(input, inputStride, i);
+			EncodeOctahedral(source[0], source[1], source[2], At(output, outputStride, i));
+		}
+	}
+
+	/****************************************************************************
+	*                       DecodeOctahedralNormalStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::DecodeOctahedralNormalStream(float* output, const gu::uint64 outputStride,
+	*             const gu::int16* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	*
+	*  @brief     Fold the square back onto the octahedron and normalize
+	*
+	*  @param[out] float* output (Float3)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const gu::int16* input (int16[2])
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::DecodeOctahedralNormalStream(float* output, const gu::uint64 outputStride,
+		const gu::int16* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		for (gu::uint64 i = 0; i < count; ++i)
+		{
+			DecodeOctahedral(At(input, inputStride, i), At(output, outputStride, i));
+		}
+	}
+
+	/****************************************************************************
+	*                       NormalizeBoneWeightStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::NormalizeBoneWeightStream(gu::uint8* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	*
+	*  @brief     Quantize the four bone weights of each vertex to UNORM8 keeping the sum 255
+	*
+	*  @param[out] gu::uint8* output (uint8[4])
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (float[4])
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::NormalizeBoneWeightStream(gu::uint8* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		for (gu::uint64 i = 0; i < count; ++i)
+		{
+			NormalizeBoneWeight(At(input, inputStride, i), At(output, outputStride, i));
+		}
+	}
+
+	/****************************************************************************
+	*                       EncodeOctahedral
+	*************************************************************************//**
+	*  @fn        inline void PackUtility::EncodeOctahedral(const float x, const float y, const float z, gu::int16* output) noexcept
+	*
+	*  @brief     Encode one normal. The SIMD backends follow the same operation order.
+	*
+	*  @param[in]  const float x
+	*  @param[in]  const float y
+	*  @param[in]  const float z
+	*  @param[out] gu::int16* output (int16[2])
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void PackUtility::EncodeOctahedral(const float x, const float y, const float z, gu::int16* output) noexcept
+	{
+		const float length            = (fabsf(x) + fabsf(y)) + fabsf(z);
+		const float reciprocalLength  = length > 0.0f ? 1.0f / length : 0.0f;
+
+		float u = x * reciprocalLength;
+		float v = y * reciprocalLength;
+		if (z < 0.0f)
+		{
+			const float foldU = (1.0f - fabsf(v)) * (u >= 0.0f ? 1.0f : -1.0f);
+			const float foldV = (1.0f - fabsf(u)) * (v >= 0.0f ? 1.0f : -1.0f);
+			u = foldU;
+			v = foldV;
+		}
+
+		output[0] = static_cast<gu::int16>(Quantize(u, -1.0f, SNORM16_SCALE));
+		output[1] = static_cast<gu::int16>(Quantize(v, -1.0f, SNORM16_SCALE));
+	}
+
+	/****************************************************************************
+	*                       DecodeOctahedral
+	*************************************************************************//**
+	*  @fn        inline void PackUtility::DecodeOctahedral(const gu::int16* input, float* output) noexcept
+	*
+	*  @brief     Decode one normal. The SIMD backends follow the same operation order.
+	*
+	*  @param[in]  const gu::int16* input (int16[2])
+	*  @param[out] float* output (Float3)
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void PackUtility::DecodeOctahedral(const gu::int16* input, float* output) noexcept
+	{
+		float x = Dequantize(input[0], 1.0f / SNORM16_SCALE);
+		float y = Dequantize(input[1], 1.0f / SNORM16_SCALE);
+		const float z = (1.0f - fabsf(x)) - fabsf(y);
+
+		// the lower hemisphere (z < 0) is unfolded from the corners of the square
+		const float fold = -z > 0.0f ? -z : 0.0f;
+		x += x >= 0.0f ? -fold : fold;
+		y += y >= 0.0f ? -fold : fold;
+
+		const float reciprocalNorm = 1.0f / sqrtf((x * x + y * y) + z * z);
+		output[0] = x * reciprocalNorm;
+		output[1] = y * reciprocalNorm;
+		output[2] = z * reciprocalNorm;
+	}
+
+	/****************************************************************************
+	*                       NormalizeBoneWeight
+	*************************************************************************//**
+	*  @fn        inline void PackUtility::NormalizeBoneWeight(const float* weights, gu::uint8* output) noexcept
+	*
+	*  @brief     Quantize the weights of one vertex. The SIMD backends follow the same operation order.
+	*
+	*  @param[in]  const float* weights (float[4])
+	*  @param[out] gu::uint8* output (uint8[4])
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void PackUtility::NormalizeBoneWeight(const float* weights, gu::uint8* output) noexcept
+	{
+		float w[4] = {};
+		for (gu::uint32 i = 0; i < 4; ++i) { w[i] = weights[i] > 0.0f ? weights[i] : 0.0f; }
+
+		// the zero sum (scale = inf), the infinity sum (scale = 0) and the NaN sum have no valid weight
+		const float sum   = (w[0] + w[2]) + (w[1] + w[3]);
+		const float scale = UNORM8_SCALE / sum;
+		if (!(scale > 0.0f && scale <= FLT_MAX))
+		{
+			output[0] = 255; output[1] = output[2] = output[3] = 0;
+			return;
+		}
+
+		gu::int32 quantized[4] = {};
+		gu::int32 total        = 0;
+		gu::uint32 largest     = 0;
+		for (gu::uint32 i = 0; i < 4; ++i)
+		{
+			quantized[i] = static_cast<gu::int32>(lrintf(w[i] * scale));
+			total += quantized[i];
+			if (quantized[i] > quantized[largest]) { largest = i; }
+		}
+
+		quantized[largest] += 255 - total;
+		for (gu::uint32 i = 0; i < 4; ++i) { output[i] = static_cast<gu::uint8>(quantized[i]); }
+	}
+	#pragma endregion Vertex Attribute
+#pragma endregion Implement
+}
+
+#endif
@@ -0,0 +1,907 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMSimdPackSSE.hpp
+///             @brief  Bulk conversions between float and the compressed vertex formats by SSE2.
+///                     - Same functions and same results as gm::simd::non::PackUtility.
+///                     - float -> half is computed by the integer operations (no F16C),
+///                       half -> float by multiplying the shifted bits with 2^112.
+///                     - The octahedral normals and the bone weights are processed 4 vertices at a time (SoA).
+///                     - Only SSE (without SSE2) uses the scalar implementation.
+///             How To: PackUtility::ConvertFloatToHalfStream(output, input, count)
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GM_SIMD_PACK_SSE_HPP
+#define GM_SIMD_PACK_SSE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GMSimdMacros.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+#if PLATFORM_CPU_INSTRUCTION_SSE && !defined(PLATFORM_CPU_INSTRUCTION_NOT_USE)
+#include "GMSimdPackNon.hpp"
+
+#if PLATFORM_CPU_INSTRUCTION_SSE2
+#include <emmintrin.h>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gm::simd::sse
+{
+	/****************************************************************************
+	*				  			   PackUtility
+	*************************************************************************//**
+	*  @class     PackUtility
+	*  @brief     SSE2 pack / unpack operations
+	*****************************************************************************/
+	class PackUtility
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		#pragma region Half
+		/*----------------------------------------------------------------------
+		*  @brief : float -> half. Overflow becomes infinity and NaN stays NaN.
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION ConvertFloatToHalfStream(gu::uint16* output, const float* input, const gu::uint64 count) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : half -> float (exact)
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION ConvertHalfToFloatStream(float* output, const gu::uint16* input, const gu::uint64 count) noexcept;
+		#pragma endregion Half
+
+		#pragma region Normalized Integer
+		/*----------------------------------------------------------------------
+		*  @brief : [-1, 1] <-> [-32767, 32767] (-32768 is also -1)
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION ConvertFloatToSNorm16Stream(gu::int16* output, const float* input, const gu::uint64 count) noexcept;
+
+		inline static void SIMD_CALL_CONVENTION ConvertSNorm16ToFloatStream(float* output, const gu::int16* input, const gu::uint64 count) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : [0, 1] <-> [0, 65535]
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION ConvertFloatToUNorm16Stream(gu::uint16* output, const float* input, const gu::uint64 count) noexcept;
+
+		inline static void SIMD_CALL_CONVENTION ConvertUNorm16ToFloatStream(float* output, const gu::uint16* input, const gu::uint64 count) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : [-1, 1] <-> [-127, 127] (-128 is also -1)
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION ConvertFloatToSNorm8Stream(gu::int8* output, const float* input, const gu::uint64 count) noexcept;
+
+		inline static void SIMD_CALL_CONVENTION ConvertSNorm8ToFloatStream(float* output, const gu::int8* input, const gu::uint64 count) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : [0, 1] <-> [0, 255]
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION ConvertFloatToUNorm8Stream(gu::uint8* output, const float* input, const gu::uint64 count) noexcept;
+
+		inline static void SIMD_CALL_CONVENTION ConvertUNorm8ToFloatStream(float* output, const gu::uint8* input, const gu::uint64 count) noexcept;
+		#pragma endregion Normalized Integer
+
+		#pragma region Vertex Attribute
+		/*----------------------------------------------------------------------
+		*  @brief : Float3 normal -> octahedral SNORM16x2. The input does not have to be a unit vector.
+		*           The zero vector is encoded as (0, 0), which is decoded as (0, 0, 1).
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION EncodeOctahedralNormalStream(gu::int16* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : Octahedral SNORM16x2 -> Float3 unit normal
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION DecodeOctahedralNormalStream(float* output, const gu::uint64 outputStride,
+			const gu::int16* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : float[4] bone weights -> UNORM8x4. The weights are normalized and the rounding error is
+		*           moved to the largest weight, so the sum is always 255. Negative and NaN weights are 0,
+		*           and the vertex without the valid weight (the sum is 0 or overflows) gets (255, 0, 0, 0).
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION NormalizeBoneWeightStream(gu::uint8* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept;
+		#pragma endregion Vertex Attribute
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+		template<typename T>
+		__forceinline static const T* At(const T* base, const gu::uint64 stride, const gu::uint64 index) noexcept
+		{
+			return reinterpret_cast<const T*>(reinterpret_cast<const gu::uint8*>(base) + stride * index);
+		}
+
+		template<typename T>
+		__forceinline static T* At(T* base, const gu::uint64 stride, const gu::uint64 index) noexcept
+		{
+			return reinterpret_cast<T*>(reinterpret_cast<gu::uint8*>(base) + stride * index);
+		}
+
+		/*----------------------------------------------------------------------
+		*  @brief : 4 floats -> 4 halves in the low 16 bits of the 32 bit lanes (sign extended)
+		/*----------------------------------------------------------------------*/
+		__forceinline static __m128i SIMD_CALL_CONVENTION FloatToHalf(const __m128 value) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : 4 halves in the 32 bit lanes (zero extended) -> 4 floats
+		/*----------------------------------------------------------------------*/
+		__forceinline static __m128 SIMD_CALL_CONVENTION HalfToFloat(const __m128i value) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : NaN -> 0, clamp [minimum, 1], scale and round to nearest even
+		/*----------------------------------------------------------------------*/
+		__forceinline static __m128i SIMD_CALL_CONVENTION Quantize(const __m128 value, const __m128 minimum, const __m128 scale) noexcept
+		{
+			__m128 result = _mm_and_ps(value, _mm_cmpord_ps(value, value));
+			result = _mm_min_ps(_mm_max_ps(result, minimum), _mm_set1_ps(1.0f));
+			return _mm_cvtps_epi32(_mm_mul_ps(result, scale));
+		}
+
+		__forceinline static __m128 SIMD_CALL_CONVENTION Dequantize(const __m128i value, const __m128 reciprocalScale) noexcept
+		{
+			return _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(value), reciprocalScale), _mm_set1_ps(-1.0f));
+		}
+
+		/*----------------------------------------------------------------------
+		*  @brief : (x >= 0 ? 1 : -1) like the scalar comparison (-0 is 1)
+		/*----------------------------------------------------------------------*/
+		__forceinline static __m128 SIMD_CALL_CONVENTION SignNotZero(const __m128 value) noexcept
+		{
+			return Select(_mm_cmpge_ps(value, _mm_setzero_ps()), _mm_set1_ps(1.0f), _mm_set1_ps(-1.0f));
+		}
+
+		__forceinline static __m128 SIMD_CALL_CONVENTION Abs(const __m128 value) noexcept
+		{
+			return _mm_andnot_ps(_mm_set1_ps(-0.0f), value);
+		}
+
+		__forceinline static __m128 SIMD_CALL_CONVENTION Select(const __m128 mask, const __m128 ifTrue, const __m128 ifFalse) noexcept
+		{
+			return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse));
+		}
+
+		__forceinline static __m128i SIMD_CALL_CONVENTION Select(const __m128i mask, const __m128i ifTrue, const __m128i ifFalse) noexcept
+		{
+			return _mm_or_si128(_mm_and_si128(mask, ifTrue), _mm_andnot_si128(mask, ifFalse));
+		}
+
+		/*----------------------------------------------------------------------
+		*  @brief : Load the Float3 of 4 vertices as x, y, z registers
+		/*----------------------------------------------------------------------*/
+		__forceinline static void LoadFloat3x4(const float* input, const gu::uint64 stride, __m128& x, __m128& y, __m128& z) noexcept
+		{
+			const float* p0 = At(input, stride, 0);
+			const float* p1 = At(input, stride, 1);
+			const float* p2 = At(input, stride, 2);
+			const float* p3 = At(input, stride, 3);
+			x = _mm_setr_ps(p0[0], p1[0], p2[0], p3[0]);
+			y = _mm_setr_ps(p0[1], p1[1], p2[1], p3[1]);
+			z = _mm_setr_ps(p0[2], p1[2], p2[2], p3[2]);
+		}
+
+		/*----------------------------------------------------------------------
+		*  @brief : Store the 32 bit lane i to the vertex i
+		/*----------------------------------------------------------------------*/
+		__forceinline static void StoreUInt32x4(void* output, const gu::uint64 stride, const __m128i value) noexcept
+		{
+			alignas(16) gu::uint32 lanes[4];
+			_mm_store_si128(reinterpret_cast<__m128i*>(lanes), value);
+			for (gu::uint32 i = 0; i < 4; ++i)
+			{
+				memcpy(At(static_cast<gu::uint8*>(output), stride, i), &lanes[i], sizeof(gu::uint32));
+			}
+		}
+
+		/*----------------------------------------------------------------------
+		*  @brief : Octahedral encoding of the 4 normals (x, y, z) -> SNORM16 (u, v) in the 32 bit lanes
+		/*----------------------------------------------------------------------*/
+		__forceinline static void SIMD_CALL_CONVENTION EncodeOctahedral(const __m128 x, const __m128 y, const __m128 z, __m128i& u, __m128i& v) noexcept
+		{
+			const __m128 length           = _mm_add_ps(_mm_add_ps(Abs(x), Abs(y)), Abs(z));
+			const __m128 isPositive       = _mm_cmpgt_ps(length, _mm_setzero_ps());
+			const __m128 reciprocalLength = _mm_and_ps(isPositive, _mm_div_ps(_mm_set1_ps(1.0f), length));
+
+			const __m128 projectedU = _mm_mul_ps(x, reciprocalLength);
+			const __m128 projectedV = _mm_mul_ps(y, reciprocalLength);
+			const __m128 foldU      = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(1.0f), Abs(projectedV)), SignNotZero(projectedU));
+			const __m128 foldV      = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(1.0f), Abs(projectedU)), SignNotZero(projectedV));
+			const __m128 isLower    = _mm_cmplt_ps(z, _mm_setzero_ps());
+
+			const __m128 minimum = _mm_set1_ps(-1.0f);
+			const __m128 scale   = _mm_set1_ps(32767.0f);
+			u = Quantize(Select(isLower, foldU, projectedU), minimum, scale);
+			v = Quantize(Select(isLower, foldV, projectedV), minimum, scale);
+		}
+
+		/*----------------------------------------------------------------------
+		*  @brief : Octahedral decoding of the 4 normals. u and v are the sign extended SNORM16.
+		/*----------------------------------------------------------------------*/
+		__forceinline static void SIMD_CALL_CONVENTION DecodeOctahedral(const __m128i u, const __m128i v, __m128& x, __m128& y, __m128& z) noexcept
+		{
+			const __m128 reciprocalScale = _mm_set1_ps(1.0f / 32767.0f);
+			x = Dequantize(u, reciprocalScale);
+			y = Dequantize(v, reciprocalScale);
+			z = _mm_sub_ps(_mm_sub_ps(_mm_set1_ps(1.0f), Abs(x)), Abs(y));
+
+			const __m128 fold = _mm_max_ps(_mm_sub_ps(_mm_setzero_ps(), z), _mm_setzero_ps());
+			x = _mm_add_ps(x, _mm_xor_ps(fold, _mm_and_ps(_mm_cmpge_ps(x, _mm_setzero_ps()), _mm_set1_ps(-0.0f))));
+			y = _mm_add_ps(y, _mm_xor_ps(fold, _mm_and_ps(_mm_cmpge_ps(y, _mm_setzero_ps()), _mm_set1_ps(-0.0f))));
+
+			const __m128 normSquared    = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+			const __m128 reciprocalNorm = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(normSquared));
+			x = _mm_mul_ps(x, reciprocalNorm);
+			y = _mm_mul_ps(y, reciprocalNorm);
+			z = _mm_mul_ps(z, reciprocalNorm);
+		}
+
+		/*----------------------------------------------------------------------
+		*  @brief : Bone weights of the 4 vertices (w0 .. w3 are the SoA registers) -> UNORM8x4 in the 32 bit lanes
+		/*----------------------------------------------------------------------*/
+		__forceinline static __m128i SIMD_CALL_CONVENTION NormalizeBoneWeight(__m128 w0, __m128 w1, __m128 w2, __m128 w3) noexcept;
+	};
+
+#pragma region Implement
+	#pragma region Half
+	/****************************************************************************
+	*                       ConvertFloatToHalfStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToHalfStream(gu::uint16* output, const float* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the float array to the half array (8 elements per iteration)
+	*
+	*  @param[out] gu::uint16* output
+	*  @param[in]  const float* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToHalfStream(gu::uint16* output, const float* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		gu::uint64 i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m128i low  = FloatToHalf(_mm_loadu_ps(input + i));
+			const __m128i high = FloatToHalf(_mm_loadu_ps(input + i + 4));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_packs_epi32(low, high));
+		}
+
+		for (; i < count; i += 4)
+		{
+			const gu::uint64 rest = count - i < 4 ? count - i : 4;
+			alignas(16) float      source[4]      = {};
+			alignas(16) gu::uint16 destination[8] = {};
+			memcpy(source, input + i, rest * sizeof(float));
+
+			const __m128i half = FloatToHalf(_mm_load_ps(source));
+			_mm_store_si128(reinterpret_cast<__m128i*>(destination), _mm_packs_epi32(half, half));
+			memcpy(output + i, destination, rest * sizeof(gu::uint16));
+		}
+	}
+
+	/****************************************************************************
+	*                       ConvertHalfToFloatStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertHalfToFloatStream(float* output, const gu::uint16* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the half array to the float array (8 elements per iteration)
+	*
+	*  @param[out] float* output
+	*  @param[in]  const gu::uint16* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertHalfToFloatStream(float* output, const gu::uint16* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		gu::uint64 i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m128i half = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+			_mm_storeu_ps(output + i    , HalfToFloat(_mm_unpacklo_epi16(half, _mm_setzero_si128())));
+			_mm_storeu_ps(output + i + 4, HalfToFloat(_mm_unpackhi_epi16(half, _mm_setzero_si128())));
+		}
+
+		for (; i < count; i += 4)
+		{
+			const gu::uint64 rest = count - i < 4 ? count - i : 4;
+			alignas(16) gu::uint16 source[8]      = {};
+			alignas(16) float      destination[4] = {};
+			memcpy(source, input + i, rest * sizeof(gu::uint16));
+
+			const __m128i half = _mm_load_si128(reinterpret_cast<const __m128i*>(source));
+			_mm_store_ps(destination, HalfToFloat(_mm_unpacklo_epi16(half, _mm_setzero_si128())));
+			memcpy(output + i, destination, rest * sizeof(float));
+		}
+	}
+
+	/****************************************************************************
+	*                       FloatToHalf
+	*************************************************************************//**
+	*  @fn        __forceinline __m128i SIMD_CALL_CONVENTION PackUtility::FloatToHalf(const __m128 value) noexcept
+	*
+	*  @brief     Branchless version of non::PackUtility::FloatToHalf.
+	*             The denormal, the normal and the infinity / NaN results are computed and selected by the masks.
+	*
+	*  @param[in] const __m128 value
+	*
+	*  @return    __m128i
+	*****************************************************************************/
+	__forceinline __m128i SIMD_CALL_CONVENTION PackUtility::FloatToHalf(const __m128 value) noexcept
+	{
+		const __m128i denormalMagic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+
+		const __m128  sign     = _mm_and_ps(value, _mm_set1_ps(-0.0f));
+		const __m128  absolute = _mm_xor_ps(value, sign);
+		const __m128i bits     = _mm_castps_si128(absolute);
+
+		const __m128i isRegular  = _mm_cmpgt_epi32(_mm_set1_epi32((127 + 16) << 23), bits);
+		const __m128i isDenormal = _mm_cmpgt_epi32(_mm_set1_epi32((127 - 14) << 23), bits);
+		const __m128i isNaN      = _mm_castps_si128(_mm_cmpunord_ps(absolute, absolute));
+		const __m128i payload    = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(bits, 13), _mm_set1_epi32(0x3ff)), _mm_set1_epi32(0x200));
+		const __m128i special    = _mm_or_si128(_mm_and_si128(isNaN, payload), _mm_set1_epi32(0x7c00));
+
+		// denormal : the float addition rounds the mantissa
+		const __m128i denormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(absolute, _mm_castsi128_ps(denormalMagic))), denormalMagic);
+
+		// normal : rebias the exponent, and add 0xfff (+ 1 when the result mantissa is odd) to round to nearest even
+		const __m128i mantissaOdd = _mm_and_si128(_mm_srli_epi32(bits, 13), _mm_set1_epi32(1));
+		const __m128i normal      = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(bits, _mm_set1_epi32(0xfff - ((127 - 15) << 23))), mantissaOdd), 13);
+
+		const __m128i finite = Select(isDenormal, denormal, normal);
+		const __m128i result = Select(isRegular , finite  , special);
+		return _mm_or_si128(result, _mm_srai_epi32(_mm_castps_si128(sign), 16));
+	}
+
+	/****************************************************************************
+	*                       HalfToFloat
+	*************************************************************************//**
+	*  @fn        __forceinline __m128 SIMD_CALL_CONVENTION PackUtility::HalfToFloat(const __m128i value) noexcept
+	*
+	*  @brief     Branchless version of non::PackUtility::HalfToFloat
+	*
+	*  @param[in] const __m128i value
+	*
+	*  @return    __m128
+	*****************************************************************************/
+	__forceinline __m128 SIMD_CALL_CONVENTION PackUtility::HalfToFloat(const __m128i value) noexcept
+	{
+		const __m128i exponentMantissa = _mm_and_si128(value, _mm_set1_epi32(0x7fff));
+		const __m128i sign             = _mm_slli_epi32(_mm_xor_si128(value, exponentMantissa), 16);
+
+		const __m128  scaled   = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(exponentMantissa, 13)), _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23)));
+		const __m128i isInfNaN = _mm_cmpgt_epi32(exponentMantissa, _mm_set1_epi32(0x7bff));
+		const __m128i isNaN    = _mm_cmpgt_epi32(exponentMantissa, _mm_set1_epi32(0x7c00));
+		const __m128i special  = _mm_or_si128(_mm_or_si128(_mm_and_si128(isInfNaN, _mm_set1_epi32(255 << 23)), _mm_and_si128(isNaN, _mm_set1_epi32(0x00400000))), sign);
+		return _mm_or_ps(scaled, _mm_castsi128_ps(special));
+	}
+	#pragma endregion Half
+
+	#pragma region Normalized Integer
+	/****************************************************************************
+	*                       ConvertFloatToSNorm16Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToSNorm16Stream(gu::int16* output, const float* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the float array to the SNORM16 array (8 elements per iteration)
+	*
+	*  @param[out] gu::int16* output
+	*  @param[in]  const float* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToSNorm16Stream(gu::int16* output, const float* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const __m128 minimum = _mm_set1_ps(-1.0f);
+		const __m128 scale   = _mm_set1_ps(32767.0f);
+
+		gu::uint64 i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m128i low  = Quantize(_mm_loadu_ps(input + i    ), minimum, scale);
+			const __m128i high = Quantize(_mm_loadu_ps(input + i + 4), minimum, scale);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_packs_epi32(low, high));
+		}
+
+		for (; i < count; ++i)
+		{
+			const __m128i value = Quantize(_mm_set_ss(input[i]), minimum, scale);
+			output[i] = static_cast<gu::int16>(_mm_cvtsi128_si32(value));
+		}
+	}
+
+	/****************************************************************************
+	*                       ConvertSNorm16ToFloatStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertSNorm16ToFloatStream(float* output, const gu::int16* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the SNORM16 array to the float array (8 elements per iteration)
+	*
+	*  @param[out] float* output
+	*  @param[in]  const gu::int16* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertSNorm16ToFloatStream(float* output, const gu::int16* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const __m128 reciprocalScale = _mm_set1_ps(1.0f / 32767.0f);
+
+		gu::uint64 i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+			_mm_storeu_ps(output + i    , Dequantize(_mm_srai_epi32(_mm_unpacklo_epi16(value, value), 16), reciprocalScale));
+			_mm_storeu_ps(output + i + 4, Dequantize(_mm_srai_epi32(_mm_unpackhi_epi16(value, value), 16), reciprocalScale));
+		}
+
+		for (; i < count; ++i)
+		{
+			_mm_store_ss(output + i, Dequantize(_mm_cvtsi32_si128(input[i]), reciprocalScale));
+		}
+	}
+
+	/****************************************************************************
+	*                       ConvertFloatToUNorm16Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToUNorm16Stream(gu::uint16* output, const float* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the float array to the UNORM16 array (8 elements per iteration).
+	*             SSE2 has no unsigned saturation from 32 bit, so the values are biased by -32768 and packed as signed.
+	*
+	*  @param[out] gu::uint16* output
+	*  @param[in]  const float* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToUNorm16Stream(gu::uint16* output, const float* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const __m128  minimum = _mm_setzero_ps();
+		const __m128  scale   = _mm_set1_ps(65535.0f);
+		const __m128i bias    = _mm_set1_epi32(32768);
+
+		gu::uint64 i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m128i low  = _mm_sub_epi32(Quantize(_mm_loadu_ps(input + i    ), minimum, scale), bias);
+			const __m128i high = _mm_sub_epi32(Quantize(_mm_loadu_ps(input + i + 4), minimum, scale), bias);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_xor_si128(_mm_packs_epi32(low, high), _mm_set1_epi16(-32768)));
+		}
+
+		for (; i < count; ++i)
+		{
+			const __m128i value = Quantize(_mm_set_ss(input[i]), minimum, scale);
+			output[i] = static_cast<gu::uint16>(_mm_cvtsi128_si32(value));
+		}
+	}
+
+	/****************************************************************************
+	*                       ConvertUNorm16ToFloatStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertUNorm16ToFloatStream(float* output, const gu::uint16* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the UNORM16 array to the float array (8 elements per iteration)
+	*
+	*  @param[out] float* output
+	*  @param[in]  const gu::uint16* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertUNorm16ToFloatStream(float* output, const gu::uint16* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const __m128 reciprocalScale = _mm_set1_ps(1.0f / 65535.0f);
+
+		gu::uint64 i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+			_mm_storeu_ps(output + i    , _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(value, _mm_setzero_si128())), reciprocalScale));
+			_mm_storeu_ps(output + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(value, _mm_setzero_si128())), reciprocalScale));
+		}
+
+		for (; i < count; ++i)
+		{
+			_mm_store_ss(output + i, _mm_mul_ss(_mm_cvtepi32_ps(_mm_cvtsi32_si128(input[i])), reciprocalScale));
+		}
+	}
+
+	/****************************************************************************
+	*                       ConvertFloatToSNorm8Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToSNorm8Stream(gu::int8* output, const float* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the float array to the SNORM8 array (16 elements per iteration)
+	*
+	*  @param[out] gu::int8* output
+	*  @param[in]  const float* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToSNorm8Stream(gu::int8* output, const float* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const __m128 minimum = _mm_set1_ps(-1.0f);
+		const __m128 scale   = _mm_set1_ps(127.0f);
+
+		gu::uint64 i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			const __m128i v0 = Quantize(_mm_loadu_ps(input + i     ), minimum, scale);
+			const __m128i v1 = Quantize(_mm_loadu_ps(input + i +  4), minimum, scale);
+			const __m128i v2 = Quantize(_mm_loadu_ps(input + i +  8), minimum, scale);
+			const __m128i v3 = Quantize(_mm_loadu_ps(input + i + 12), minimum, scale);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_packs_epi16(_mm_packs_epi32(v0, v1), _mm_packs_epi32(v2, v3)));
+		}
+
+		for (; i < count; ++i)
+		{
+			const __m128i value = Quantize(_mm_set_ss(input[i]), minimum, scale);
+			output[i] = static_cast<gu::int8>(_mm_cvtsi128_si32(value));
+		}
+	}
+
+	/****************************************************************************
+	*                       ConvertSNorm8ToFloatStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertSNorm8ToFloatStream(float* output, const gu::int8* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the SNORM8 array to the float array (16 elements per iteration)
+	*
+	*  @param[out] float* output
+	*  @param[in]  const gu::int8* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertSNorm8ToFloatStream(float* output, const gu::int8* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const __m128 reciprocalScale = _mm_set1_ps(1.0f / 127.0f);
+
+		gu::uint64 i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+			const __m128i low   = _mm_unpacklo_epi8(value, value);
+			const __m128i high  = _mm_unpackhi_epi8(value, value);
+			_mm_storeu_ps(output + i     , Dequantize(_mm_srai_epi32(_mm_unpacklo_epi16(low , low ), 24), reciprocalScale));
+			_mm_storeu_ps(output + i +  4, Dequantize(_mm_srai_epi32(_mm_unpackhi_epi16(low , low ), 24), reciprocalScale));
+			_mm_storeu_ps(output + i +  8, Dequantize(_mm_srai_epi32(_mm_unpacklo_epi16(high, high), 24), reciprocalScale));
+			_mm_storeu_ps(output + i + 12, Dequantize(_mm_srai_epi32(_mm_unpackhi_epi16(high, high), 24), reciprocalScale));
+		}
+
+		for (; i < count; ++i)
+		{
+			_mm_store_ss(output + i, Dequantize(_mm_cvtsi32_si128(input[i]), reciprocalScale));
+		}
+	}
+
+	/****************************************************************************
+	*                       ConvertFloatToUNorm8Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToUNorm8Stream(gu::uint8* output, const float* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the float array to the UNORM8 array (16 elements per iteration)
+	*
+	*  @param[out] gu::uint8* output
+	*  @param[in]  const float* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertFloatToUNorm8Stream(gu::uint8* output, const float* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const __m128 minimum = _mm_setzero_ps();
+		const __m128 scale   = _mm_set1_ps(255.0f);
+
+		gu::uint64 i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			const __m128i v0 = Quantize(_mm_loadu_ps(input + i     ), minimum, scale);
+			const __m128i v1 = Quantize(_mm_loadu_ps(input + i +  4), minimum, scale);
+			const __m128i v2 = Quantize(_mm_loadu_ps(input + i +  8), minimum, scale);
+			const __m128i v3 = Quantize(_mm_loadu_ps(input + i + 12), minimum, scale);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_packus_epi16(_mm_packs_epi32(v0, v1), _mm_packs_epi32(v2, v3)));
+		}
+
+		for (; i < count; ++i)
+		{
+			const __m128i value = Quantize(_mm_set_ss(input[i]), minimum, scale);
+			output[i] = static_cast<gu::uint8>(_mm_cvtsi128_si32(value));
+		}
+	}
+
+	/****************************************************************************
+	*                       ConvertUNorm8ToFloatStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::ConvertUNorm8ToFloatStream(float* output, const gu::uint8* input, const gu::uint64 count) noexcept
+	*
+	*  @brief     Convert the UNORM8 array to the float array (16 elements per iteration)
+	*
+	*  @param[out] float* output
+	*  @param[in]  const gu::uint8* input
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::ConvertUNorm8ToFloatStream(float* output, const gu::uint8* input, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const __m128  reciprocalScale = _mm_set1_ps(1.0f / 255.0f);
+		const __m128i zero            = _mm_setzero_si128();
+
+		gu::uint64 i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+			const __m128i low   = _mm_unpacklo_epi8(value, zero);
+			const __m128i high  = _mm_unpackhi_epi8(value, zero);
+			_mm_storeu_ps(output + i     , _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(low , zero)), reciprocalScale));
+			_mm_storeu_ps(output + i +  4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(low , zero)), reciprocalScale));
+			_mm_storeu_ps(output + i +  8, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(high, zero)), reciprocalScale));
+			_mm_storeu_ps(output + i + 12, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(high, zero)), reciprocalScale));
+		}
+
+		for (; i < count; ++i)
+		{
+			_mm_store_ss(output + i, _mm_mul_ss(_mm_cvtepi32_ps(_mm_cvtsi32_si128(input[i])), reciprocalScale));
+		}
+	}
+	#pragma endregion Normalized Integer
+
+	#pragma region Vertex Attribute
+	/****************************************************************************
+	*                       EncodeOctahedralNormalStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::EncodeOctahedralNormalStream(gu::int16* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	*
+	*  @brief     Project the normals onto the octahedron (4 normals per iteration)
+	*
+	*  @param[out] gu::int16* output (int16[2])
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float3)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::EncodeOctahedralNormalStream(gu::int16* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		gu::uint64 i = 0;
+		for (; i < count; i += 4)
+		{
+			__m128 x, y, z;
+			const gu::uint64 rest = count - i < 4 ? count - i : 4;
+			if (rest == 4)
+			{
+				LoadFloat3x4(At(input, inputStride, i), inputStride, x, y, z);
+			}
+			else
+			{
+				alignas(16) float source[12] = {};
+				for (gu::uint64 j = 0; j < rest; ++j) { memcpy(source + j * 3, At(input, inputStride, i + j), sizeof(float) * 3); }
+				LoadFloat3x4(source, sizeof(float) * 3, x, y, z);
+			}
+
+			__m128i u, v;
+			EncodeOctahedral(x, y, z, u, v);
+			const __m128i packed = _mm_or_si128(_mm_and_si128(u, _mm_set1_epi32(0xffff)), _mm_slli_epi32(v, 16));
+			if (rest == 4)
+			{
+				StoreUInt32x4(At(output, outputStride, i), outputStride, packed);
+			}
+			else
+			{
+				alignas(16) gu::uint32 lanes[4];
+				_mm_store_si128(reinterpret_cast<__m128i*>(lanes), packed);
+				for (gu::uint64 j = 0; j < rest; ++j) { memcpy(At(output, outputStride, i + j), &lanes[j], sizeof(gu::uint32)); }
+			}
+		}
+	}
+
+	/****************************************************************************
+	*                       DecodeOctahedralNormalStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::DecodeOctahedralNormalStream(float* output, const gu::uint64 outputStride,
+	*             const gu::int16* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	*
+	*  @brief     Fold the square back onto the octahedron and normalize (4 normals per iteration)
+	*
+	*  @param[out] float* output (Float3)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const gu::int16* input (int16[2])
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::DecodeOctahedralNormalStream(float* output, const gu::uint64 outputStride,
+		const gu::int16* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		for (gu::uint64 i = 0; i < count; i += 4)
+		{
+			const gu::uint64 rest = count - i < 4 ? count - i : 4;
+
+			alignas(16) gu::int32 lanes[4] = {};
+			for (gu::uint64 j = 0; j < rest; ++j) { memcpy(&lanes[j], At(input, inputStride, i + j), sizeof(gu::int32)); }
+
+			const __m128i packed = _mm_load_si128(reinterpret_cast<const __m128i*>(lanes));
+			const __m128i u      = _mm_srai_epi32(_mm_slli_epi32(packed, 16), 16);
+			const __m128i v      = _mm_srai_epi32(packed, 16);
+
+			__m128 x, y, z;
+			DecodeOctahedral(u, v, x, y, z);
+
+			alignas(16) float xs[4], ys[4], zs[4];
+			_mm_store_ps(xs, x);
+			_mm_store_ps(ys, y);
+			_mm_store_ps(zs, z);
+			for (gu::uint64 j = 0; j < rest; ++j)
+			{
+				float* destination = At(output, outputStride, i + j);
+				destination[0] = xs[j];
+				destination[1] = ys[j];
+				destination[2] = zs[j];
+			}
+		}
+	}
+
+	/****************************************************************************
+	*                       NormalizeBoneWeightStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION PackUtility::NormalizeBoneWeightStream(gu::uint8* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	*
+	*  @brief     Quantize the bone weights keeping the sum 255 (4 vertices per iteration)
+	*
+	*  @param[out] gu::uint8* output (uint8[4])
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (float[4])
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION PackUtility::NormalizeBoneWeightStream(gu::uint8* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		for (gu::uint64 i = 0; i < count; i += 4)
+		{
+			const gu::uint64 rest = count - i < 4 ? count - i : 4;
+
+			__m128 w0, w1, w2, w3;
+			if (rest == 4)
+			{
+				w0 = _mm_loadu_ps(At(input, inputStride, i + 0));
+				w1 = _mm_loadu_ps(At(input, inputStride, i + 1));
+				w2 = _mm_loadu_ps(At(input, inputStride, i + 2));
+				w3 = _mm_loadu_ps(At(input, inputStride, i + 3));
+			}
+			else
+			{
+				alignas(16) float source[16] = {};
+				for (gu::uint64 j = 0; j < rest; ++j) { memcpy(source + j * 4, At(input, inputStride, i + j), sizeof(float) * 4); }
+				w0 = _mm_load_ps(source + 0);
+				w1 = _mm_load_ps(source + 4);
+				w2 = _mm_load_ps(source + 8);
+				w3 = _mm_load_ps(source + 12);
+			}
+			_MM_TRANSPOSE4_PS(w0, w1, w2, w3);
+
+			const __m128i packed = NormalizeBoneWeight(w0, w1, w2, w3);
+			if (rest == 4)
+			{
+				StoreUInt32x4(At(output, outputStride, i), outputStride, packed);
+			}
+			else
+			{
+				alignas(16) gu::uint32 lanes[4];
+				_mm_store_si128(reinterpret_cast<__m128i*>(lanes), packed);
+				for (gu::uint64 j = 0; j < rest; ++j) { memcpy(At(output, outputStride, i + j), &lanes[j], sizeof(gu::uint32)); }
+			}
+		}
+	}
+
+	/****************************************************************************
+	*                       NormalizeBoneWeight
+	*************************************************************************//**
+	*  @fn        __forceinline __m128i SIMD_CALL_CONVENTION PackUtility::NormalizeBoneWeight(__m128 w0, __m128 w1, __m128 w2, __m128 w3) noexcept
+	*
+	*  @brief     Branchless version of non::PackUtility::NormalizeBoneWeight.
+	*             The rounding error is added to the first lane that has the largest quantized weight.
+	*
+	*  @param[in] __m128 w0 (first weight of the 4 vertices)
+	*  @param[in] __m128 w1
+	*  @param[in] __m128 w2
+	*  @param[in] __m128 w3
+	*
+	*  @return    __m128i (w0 | w1 << 8 | w2 << 16 | w3 << 24)
+	*****************************************************************************/
+	__forceinline __m128i SIMD_CALL_CONVENTION PackUtility::NormalizeBoneWeight(__m128 w0, __m128 w1, __m128 w2, __m128 w3) noexcept
+	{
+		const __m128 zero = _mm_setzero_ps();
+		w0 = _mm_max_ps(w0, zero);
+		w1 = _mm_max_ps(w1, zero);
+		w2 = _mm_max_ps(w2, zero);
+		w3 = _mm_max_ps(w3, zero);
+
+		const __m128 sum   = _mm_add_ps(_mm_add_ps(w0, w2), _mm_add_ps(w1, w3));
+		const __m128 scale = _mm_div_ps(_mm_set1_ps(255.0f), sum);
+
+		__m128i q0 = _mm_cvtps_epi32(_mm_mul_ps(w0, scale));
+		__m128i q1 = _mm_cvtps_epi32(_mm_mul_ps(w1, scale));
+		__m128i q2 = _mm_cvtps_epi32(_mm_mul_ps(w2, scale));
+		__m128i q3 = _mm_cvtps_epi32(_mm_mul_ps(w3, scale));
+
+		// first largest lane (the same tie break as the scalar loop)
+		const __m128i is1     = _mm_cmpgt_epi32(q1, q0);
+		const __m128i max01   = Select(is1, q1, q0);
+		const __m128i is2     = _mm_cmpgt_epi32(q2, max01);
+		const __m128i max012  = Select(is2, q2, max01);
+		const __m128i is3     = _mm_cmpgt_epi32(q3, max012);
+		const __m128i select3 = is3;
+		const __m128i select2 = _mm_andnot_si128(is3, is2);
+		const __m128i select1 = _mm_andnot_si128(_mm_or_si128(is3, is2), is1);
+		const __m128i select0 = _mm_andnot_si128(_mm_or_si128(_mm_or_si128(is3, is2), is1), _mm_set1_epi32(-1));
+
+		const __m128i total = _mm_add_epi32(_mm_add_epi32(q0, q1), _mm_add_epi32(q2, q3));
+		const __m128i error = _mm_sub_epi32(_mm_set1_epi32(255), total);
+		q0 = _mm_add_epi32(q0, _mm_and_si128(select0, error));
+		q1 = _mm_add_epi32(q1, _mm_and_si128(select1, error));
+		q2 = _mm_add_epi32(q2, _mm_and_si128(select2, error));
+		q3 = _mm_add_epi32(q3, _mm_and_si128(select3, error));
+
+		const __m128i packed = _mm_or_si128(_mm_or_si128(q0, _mm_slli_epi32(q1, 8)), _mm_or_si128(_mm_slli_epi32(q2, 16), _mm_slli_epi32(q3, 24)));
+
+		// the vertex without the valid weight (the scale is 0, infinity or NaN)
+		const __m128i hasWeight = _mm_castps_si128(_mm_and_ps(_mm_cmpgt_ps(scale, zero), _mm_cmple_ps(scale, _mm_set1_ps(FLT_MAX))));
+		return Select(hasWeight, packed, _mm_set1_epi32(255));
+	}
+	#pragma endregion Vertex Attribute
+#pragma endregion Implement
+}
+#else
+namespace gm::simd::sse
+{
+	using PackUtility = gm::simd::non::PackUtility;
+}
+#endif
+#endif
+#endif
@@ -0,0 +1,31 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMSimdPackSSE2.hpp
+///             @brief  Bulk conversions between float and the compressed vertex formats by SSE2.
+///                     The same implementation as SSE.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GM_SIMD_PACK_SSE2_HPP
+#define GM_SIMD_PACK_SSE2_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GMSimdMacros.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+#if PLATFORM_CPU_INSTRUCTION_SSE2 && !defined(PLATFORM_CPU_INSTRUCTION_NOT_USE)
+#include "GMSimdPackSSE.hpp"
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+
+namespace gm::simd::sse2
+{
+	using PackUtility = gm::simd::sse::PackUtility;
+}
+#endif
+#endif
@@ -0,0 +1,31 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMSimdPackSSE3.hpp
+///             @brief  Bulk conversions between float and the compressed vertex formats by SSE3.
+///                     The same implementation as SSE.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GM_SIMD_PACK_SSE3_HPP
+#define GM_SIMD_PACK_SSE3_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GMSimdMacros.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+#if PLATFORM_CPU_INSTRUCTION_SSE3 && !defined(PLATFORM_CPU_INSTRUCTION_NOT_USE)
+#include "GMSimdPackSSE2.hpp"
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+
+namespace gm::simd::sse3
+{
+	using PackUtility = gm::simd::sse2::PackUtility;
+}
+#endif
+#endif
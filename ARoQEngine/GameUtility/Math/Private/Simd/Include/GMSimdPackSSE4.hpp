@@ -0,0 +1,31 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMSimdPackSSE4.hpp
+///             @brief  Bulk conversions between float and the compressed vertex formats by SSE4.
+///                     The same implementation as SSE.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GM_SIMD_PACK_SSE4_HPP
+#define GM_SIMD_PACK_SSE4_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GMSimdMacros.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+#if PLATFORM_CPU_INSTRUCTION_SSE4_1 && !defined(PLATFORM_CPU_INSTRUCTION_NOT_USE)
+#include "GMSimdPackSSE3.hpp"
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+
+namespace gm::simd::sse4
+{
+	using PackUtility = gm::simd::sse3::PackUtility;
+}
+#endif
+#endif
@@ -0,0 +1,716 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMSimdStreamAVX.hpp
+///             @brief  Batched (stream) operations of the float arrays by AVX.
+///                     - The tightly packed Float3 arrays (stride 12) are processed 8 at a time.
+///                       The 128 bit lanes hold the points 0-3 and 4-7, so the SSE transpose works in each lane.
+///                     - The other strides are processed 2 elements per register (one element per 128 bit lane).
+///                     - The rest of the elements are processed by the SSE implementation.
+///             How To: StreamUtility::TransformFloat3Stream(output, sizeof(Float3), input, sizeof(Float3), count, matrix)
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GM_SIMD_STREAM_AVX_HPP
+#define GM_SIMD_STREAM_AVX_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GMSimdMacros.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+#if PLATFORM_CPU_INSTRUCTION_AVX && !defined(PLATFORM_CPU_INSTRUCTION_NOT_USE)
+#include "GMSimdStreamSSE4.hpp"
+#include <immintrin.h>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gm::simd::avx
+{
+	/****************************************************************************
+	*				  			   StreamUtility
+	*************************************************************************//**
+	*  @class     StreamUtility
+	*  @brief     AVX stream operations (8 floats per register)
+	*****************************************************************************/
+	class StreamUtility : public gm::simd::sse4::StreamUtility
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		#pragma region Transform
+		/*----------------------------------------------------------------------
+		*  @brief : (x, y, z, 1) * matrix. The w column of the matrix is ignored.
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION TransformFloat3Stream(float* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : (x, y, z, 1) * matrix, and divide xyz by w (projection)
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION TransformCoordinateFloat3Stream(float* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : (x, y, z, 0) * matrix (direction and normal)
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION TransformNormalFloat3Stream(float* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : (x, y, z, w) * matrix
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION TransformFloat4Stream(float* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : output[i] = left[i] * right[i] (float[16] each).
+		*           A stride of 0 uses the same matrix for all the elements.
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION MultiplyStream(float* output, const gu::uint64 outputStride,
+			const float* left, const gu::uint64 leftStride, const float* right, const gu::uint64 rightStride, const gu::uint64 count) noexcept;
+		#pragma endregion Transform
+
+		#pragma region Math
+		/*----------------------------------------------------------------------
+		*  @brief : Unit vectors (the zero vector stays zero)
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION NormalizeFloat3Stream(float* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept;
+
+		inline static void SIMD_CALL_CONVENTION NormalizeFloat4Stream(float* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : AABB of the points (minimum and maximum are float[3]).
+		*           The empty array returns FLT_MAX as the minimum and -FLT_MAX as the maximum.
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION ComputeBoundsFloat3Stream(float* minimum, float* maximum,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept;
+		#pragma endregion Math
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+		/* @brief : The transforms shared with AVX2 (UseFma : fused multiply add)*/
+		template<TransformMode Mode, bool UseFma>
+		inline static void TransformFloat3Wide(float* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept;
+
+		template<bool UseFma>
+		inline static void TransformFloat4Wide(float* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept;
+
+		template<bool UseFma>
+		inline static void MultiplyWide(float* output, const gu::uint64 outputStride,
+			const float* left, const gu::uint64 leftStride, const float* right, const gu::uint64 rightStride, const gu::uint64 count) noexcept;
+
+		/* @brief : a * b + c*/
+		template<bool UseFma>
+		__forceinline static __m256 MultiplyAdd(const __m256 a, const __m256 b, const __m256 c) noexcept
+		{
+			if constexpr (UseFma) { return _mm256_fmadd_ps(a, b, c); }
+			else                  { return _mm256_add_ps(_mm256_mul_ps(a, b), c); }
+		}
+
+		/* @brief : 4 floats of low and high to the 128 bit lanes*/
+		__forceinline static __m256 LoadFloat4x2(const float* low, const float* high) noexcept
+		{
+			return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(low)), _mm_loadu_ps(high), 1);
+		}
+
+		__forceinline static void StoreFloat4x2(float* low, float* high, const __m256 vector) noexcept
+		{
+			_mm_storeu_ps(low , _mm256_castps256_ps128(vector));
+			_mm_storeu_ps(high, _mm256_extractf128_ps(vector, 1));
+		}
+
+		__forceinline static __m256 LoadFloat3x2(const float* low, const float* high) noexcept
+		{
+			return _mm256_insertf128_ps(_mm256_castps128_ps256(LoadFloat3(low)), LoadFloat3(high), 1);
+		}
+
+		__forceinline static void StoreFloat3x2(float* low, float* high, const __m256 vector) noexcept
+		{
+			StoreFloat3(low , _mm256_castps256_ps128(vector));
+			StoreFloat3(high, _mm256_extractf128_ps(vector, 1));
+		}
+
+		/* @brief : TransposeFloat3x4 in each 128 bit lane (8 packed points starting at source)*/
+		__forceinline static void LoadTransposeFloat3x8(const float* source, __m256& x, __m256& y, __m256& z) noexcept
+		{
+			const __m256 a = LoadFloat4x2(source    , source + 12);
+			const __m256 b = LoadFloat4x2(source + 4, source + 16);
+			const __m256 c = LoadFloat4x2(source + 8, source + 20);
+
+			const __m256 x23 = _mm256_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2));
+			const __m256 y01 = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));
+			const __m256 y23 = _mm256_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3));
+			const __m256 z01 = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2));
+			x = _mm256_shuffle_ps(a  , x23, _MM_SHUFFLE(2, 0, 3, 0));
+			y = _mm256_shuffle_ps(y01, y23, _MM_SHUFFLE(2, 0, 2, 0));
+			z = _mm256_shuffle_ps(z01, c  , _MM_SHUFFLE(3, 0, 2, 0));
+		}
+
+		/* @brief : Inverse of LoadTransposeFloat3x8*/
+		__forceinline static void UntransposeStoreFloat3x8(float* destination, const __m256 x, const __m256 y, const __m256 z) noexcept
+		{
+			const __m256 x0y0 = _mm256_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0));
+			const __m256 z0x1 = _mm256_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0));
+			const __m256 y1z1 = _mm256_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1));
+			const __m256 x2y2 = _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2));
+			const __m256 z2x3 = _mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2));
+			const __m256 y3z3 = _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3));
+			StoreFloat4x2(destination    , destination + 12, _mm256_shuffle_ps(x0y0, z0x1, _MM_SHUFFLE(2, 0, 2, 0)));
+			StoreFloat4x2(destination + 4, destination + 16, _mm256_shuffle_ps(y1z1, x2y2, _MM_SHUFFLE(2, 0, 2, 0)));
+			StoreFloat4x2(destination + 8, destination + 20, _mm256_shuffle_ps(z2x3, y3z3, _MM_SHUFFLE(2, 0, 2, 0)));
+		}
+
+		/* @brief : Broadcast the 4 floats to the both lanes*/
+		__forceinline static __m256 BroadcastFloat4(const float* source) noexcept
+		{
+			return _mm256_broadcast_ps(reinterpret_cast<const __m128*>(source));
+		}
+	};
+
+#pragma region Implement
+	#pragma region Transform
+	/****************************************************************************
+	*                       TransformFloat3Wide
+	*************************************************************************//**
+	*  @fn        inline void StreamUtility::TransformFloat3Wide(float* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	*
+	*  @brief     Transform the Float3 array. The packed arrays are transformed 8 at a time as SoA.
+	*
+	*  @param[out] float* output (Float3)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float3)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*  @param[in]  const float* matrix (float[16])
+	*
+	*  @return    void
+	*****************************************************************************/
+	template<StreamUtility::TransformMode Mode, bool UseFma>
+	inline void StreamUtility::TransformFloat3Wide(float* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	{
+		Check(count == 0 || (output && input && matrix));
+
+		gu::uint64 i = 0;
+
+		/*-------------------------------------------------------------------
+		-        Packed arrays : 8 points per iteration
+		---------------------------------------------------------------------*/
+		if (inputStride == sizeof(float) * 3 && outputStride == sizeof(float) * 3 && count >= 8)
+		{
+			const __m256 m00 = _mm256_set1_ps(matrix[0]) , m01 = _mm256_set1_ps(matrix[1]) , m02 = _mm256_set1_ps(matrix[2]);
+			const __m256 m10 = _mm256_set1_ps(matrix[4]) , m11 = _mm256_set1_ps(matrix[5]) , m12 = _mm256_set1_ps(matrix[6]);
+			const __m256 m20 = _mm256_set1_ps(matrix[8]) , m21 = _mm256_set1_ps(matrix[9]) , m22 = _mm256_set1_ps(matrix[10]);
+			const __m256 m30 = _mm256_set1_ps(matrix[12]), m31 = _mm256_set1_ps(matrix[13]), m32 = _mm256_set1_ps(matrix[14]);
+
+			for (; i + 8 <= count; i += 8)
+			{
+				__m256 x, y, z;
+				LoadTransposeFloat3x8(input + i * 3, x, y, z);
+
+				__m256 rx = MultiplyAdd<UseFma>(z, m20, MultiplyAdd<UseFma>(y, m10, _mm256_mul_ps(x, m00)));
+				__m256 ry = MultiplyAdd<UseFma>(z, m21, MultiplyAdd<UseFma>(y, m11, _mm256_mul_ps(x, m01)));
+				__m256 rz = MultiplyAdd<UseFma>(z, m22, MultiplyAdd<UseFma>(y, m12, _mm256_mul_ps(x, m02)));
+
+				if constexpr (Mode != TransformMode::Normal)
+				{
+					rx = _mm256_add_ps(rx, m30);
+					ry = _mm256_add_ps(ry, m31);
+					rz = _mm256_add_ps(rz, m32);
+				}
+
+				if constexpr (Mode == TransformMode::Coordinate)
+				{
+					__m256 rw = MultiplyAdd<UseFma>(z, _mm256_set1_ps(matrix[11]), MultiplyAdd<UseFma>(y, _mm256_set1_ps(matrix[7]), _mm256_mul_ps(x, _mm256_set1_ps(matrix[3]))));
+					rw = _mm256_add_ps(rw, _mm256_set1_ps(matrix[15]));
+					rx = _mm256_div_ps(rx, rw);
+					ry = _mm256_div_ps(ry, rw);
+					rz = _mm256_div_ps(rz, rw);
+				}
+
+				UntransposeStoreFloat3x8(output + i * 3, rx, ry, rz);
+			}
+		}
+		else
+		{
+			/*-------------------------------------------------------------------
+			-        Other strides : 2 points per iteration
+			---------------------------------------------------------------------*/
+			const __m256 row0 = BroadcastFloat4(&matrix[0]);
+			const __m256 row1 = BroadcastFloat4(&matrix[4]);
+			const __m256 row2 = BroadcastFloat4(&matrix[8]);
+			const __m256 row3 = BroadcastFloat4(&matrix[12]);
+
+			for (; i + 2 <= count; i += 2)
+			{
+				const __m256 vector = LoadFloat3x2(At(input, inputStride, i), At(input, inputStride, i + 1));
+
+				__m256 result = _mm256_mul_ps(_mm256_shuffle_ps(vector, vector, _MM_SHUFFLE(0, 0, 0, 0)), row0);
+				result = MultiplyAdd<UseFma>(_mm256_shuffle_ps(vector, vector, _MM_SHUFFLE(1, 1, 1, 1)), row1, result);
+				result = MultiplyAdd<UseFma>(_mm256_shuffle_ps(vector, vector, _MM_SHUFFLE(2, 2, 2, 2)), row2, result);
+
+				if constexpr (Mode != TransformMode::Normal)
+				{
+					result = _mm256_add_ps(result, row3);
+				}
+
+				if constexpr (Mode == TransformMode::Coordinate)
+				{
+					result = _mm256_div_ps(result, _mm256_shuffle_ps(result, result, _MM_SHUFFLE(3, 3, 3, 3)));
+				}
+
+				StoreFloat3x2(At(output, outputStride, i), At(output, outputStride, i + 1), result);
+			}
+		}
+
+		/*-------------------------------------------------------------------
+		-        The rest
+		---------------------------------------------------------------------*/
+		if (i < count)
+		{
+			TransformFloat3Internal<Mode>(At(output, outputStride, i), outputStride, At(input, inputStride, i), inputStride, count - i, matrix);
+		}
+	}
+
+	/****************************************************************************
+	*                       TransformFloat4Wide
+	*************************************************************************//**
+	*  @fn        inline void StreamUtility::TransformFloat4Wide(float* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	*
+	*  @brief     Transform the 4D vectors 2 at a time
+	*
+	*  @param[out] float* output (Float4)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float4)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*  @param[in]  const float* matrix (float[16])
+	*
+	*  @return    void
+	*****************************************************************************/
+	template<bool UseFma>
+	inline void StreamUtility::TransformFloat4Wide(float* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	{
+		Check(count == 0 || (output && input && matrix));
+
+		const __m256 row0 = BroadcastFloat4(&matrix[0]);
+		const __m256 row1 = BroadcastFloat4(&matrix[4]);
+		const __m256 row2 = BroadcastFloat4(&matrix[8]);
+		const __m256 row3 = BroadcastFloat4(&matrix[12]);
+
+		gu::uint64 i = 0;
+		for (; i + 2 <= count; i += 2)
+		{
+			const __m256 vector = LoadFloat4x2(At(input, inputStride, i), At(input, inputStride, i + 1));
+
+			__m256 result = _mm256_mul_ps(_mm256_shuffle_ps(vector, vector, _MM_SHUFFLE(0, 0, 0, 0)), row0);
+			result = MultiplyAdd<UseFma>(_mm256_shuffle_ps(vector, vector, _MM_SHUFFLE(1, 1, 1, 1)), row1, result);
+			result = MultiplyAdd<UseFma>(_mm256_shuffle_ps(vector, vector, _MM_SHUFFLE(2, 2, 2, 2)), row2, result);
+			result = MultiplyAdd<UseFma>(_mm256_shuffle_ps(vector, vector, _MM_SHUFFLE(3, 3, 3, 3)), row3, result);
+
+			StoreFloat4x2(At(output, outputStride, i), At(output, outputStride, i + 1), result);
+		}
+
+		if (i < count)
+		{
+			sse4::StreamUtility::TransformFloat4Stream(At(output, outputStride, i), outputStride, At(input, inputStride, i), inputStride, count - i, matrix);
+		}
+	}
+
+	/****************************************************************************
+	*                       MultiplyWide
+	*************************************************************************//**
+	*  @fn        inline void StreamUtility::MultiplyWide(float* output, const gu::uint64 outputStride,
+	*             const float* left, const gu::uint64 leftStride, const float* right, const gu::uint64 rightStride, const gu::uint64 count) noexcept
+	*
+	*  @brief     Multiply the matrix arrays 2 rows at a time
+	*
+	*  @param[out] float* output (float[16])
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* left (float[16])
+	*  @param[in]  const gu::uint64 leftStride (byte, 0 : the same matrix)
+	*  @param[in]  const float* right (float[16])
+	*  @param[in]  const gu::uint64 rightStride (byte, 0 : the same matrix)
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	template<bool UseFma>
+	inline void StreamUtility::MultiplyWide(float* output, const gu::uint64 outputStride,
+		const float* left, const gu::uint64 leftStride, const float* right, const gu::uint64 rightStride, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && left && right));
+
+		for (gu::uint64 i = 0; i < count; ++i)
+		{
+			const float* l = At(left , leftStride , i);
+			const float* r = At(right, rightStride, i);
+
+			// Rows 0 and 1, rows 2 and 3 of the left matrix
+			const __m256 t0 = _mm256_loadu_ps(&l[0]);
+			const __m256 t1 = _mm256_loadu_ps(&l[8]);
+
+			const __m256 row0 = BroadcastFloat4(&r[0]);
+			const __m256 row1 = BroadcastFloat4(&r[4]);
+			const __m256 row2 = BroadcastFloat4(&r[8]);
+			const __m256 row3 = BroadcastFloat4(&r[12]);
+
+			__m256 c0 = _mm256_mul_ps(_mm256_shuffle_ps(t0, t0, _MM_SHUFFLE(0, 0, 0, 0)), row0);
+			__m256 c1 = _mm256_mul_ps(_mm256_shuffle_ps(t1, t1, _MM_SHUFFLE(0, 0, 0, 0)), row0);
+			c0 = MultiplyAdd<UseFma>(_mm256_shuffle_ps(t0, t0, _MM_SHUFFLE(1, 1, 1, 1)), row1, c0);
+			c1 = MultiplyAdd<UseFma>(_mm256_shuffle_ps(t1, t1, _MM_SHUFFLE(1, 1, 1, 1)), row1, c1);
+			c0 = MultiplyAdd<UseFma>(_mm256_shuffle_ps(t0, t0, _MM_SHUFFLE(2, 2, 2, 2)), row2, c0);
+			c1 = MultiplyAdd<UseFma>(_mm256_shuffle_ps(t1, t1, _MM_SHUFFLE(2, 2, 2, 2)), row2, c1);
+			c0 = MultiplyAdd<UseFma>(_mm256_shuffle_ps(t0, t0, _MM_SHUFFLE(3, 3, 3, 3)), row3, c0);
+			c1 = MultiplyAdd<UseFma>(_mm256_shuffle_ps(t1, t1, _MM_SHUFFLE(3, 3, 3, 3)), row3, c1);
+
+			float* destination = At(output, outputStride, i);
+			_mm256_storeu_ps(&destination[0], c0);
+			_mm256_storeu_ps(&destination[8], c1);
+		}
+	}
+
+	/****************************************************************************
+	*                       TransformFloat3Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::TransformFloat3Stream(float* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	*
+	*  @brief     Transform the points by the affine matrix
+	*
+	*  @param[out] float* output (Float3)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float3)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*  @param[in]  const float* matrix (float[16])
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::TransformFloat3Stream(float* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	{
+		TransformFloat3Wide<TransformMode::Point, false>(output, outputStride, input, inputStride, count, matrix);
+	}
+
+	/****************************************************************************
+	*                       TransformCoordinateFloat3Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::TransformCoordinateFloat3Stream(float* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	*
+	*  @brief     Transform the points by the projective matrix and divide them by w
+	*
+	*  @param[out] float* output (Float3)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float3)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*  @param[in]  const float* matrix (float[16])
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::TransformCoordinateFloat3Stream(float* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	{
+		TransformFloat3Wide<TransformMode::Coordinate, false>(output, outputStride, input, inputStride, count, matrix);
+	}
+
+	/****************************************************************************
+	*                       TransformNormalFloat3Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::TransformNormalFloat3Stream(float* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	*
+	*  @brief     Transform the directions without the translation
+	*
+	*  @param[out] float* output (Float3)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float3)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*  @param[in]  const float* matrix (float[16])
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::TransformNormalFloat3Stream(float* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	{
+		TransformFloat3Wide<TransformMode::Normal, false>(output, outputStride, input, inputStride, count, matrix);
+	}
+
+	/****************************************************************************
+	*                       TransformFloat4Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::TransformFloat4Stream(float* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	*
+	*  @brief     Transform the 4D vectors
+	*
+	*  @param[out] float* output (Float4)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float4)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*  @param[in]  const float* matrix (float[16])
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::TransformFloat4Stream(float* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	{
+		TransformFloat4Wide<false>(output, outputStride, input, inputStride, count, matrix);
+	}
+
+	/****************************************************************************
+	*                       MultiplyStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::MultiplyStream(float* output, const gu::uint64 outputStride,
+	*             const float* left, const gu::uint64 leftStride, const float* right, const gu::uint64 rightStride, const gu::uint64 count) noexcept
+	*
+	*  @brief     Multiply the matrix arrays (output[i] = left[i] * right[i])
+	*
+	*  @param[out] float* output (float[16])
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* left (float[16])
+	*  @param[in]  const gu::uint64 leftStride (byte, 0 : the same matrix)
+	*  @param[in]  const float* right (float[16])
+	*  @param[in]  const gu::uint64 rightStride (byte, 0 : the same matrix)
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::MultiplyStream(float* output, const gu::uint64 outputStride,
+		const float* left, const gu::uint64 leftStride, const float* right, const gu::uint64 rightStride, const gu::uint64 count) noexcept
+	{
+		MultiplyWide<false>(output, outputStride, left, leftStride, right, rightStride, count);
+	}
+	#pragma endregion Transform
+
+	#pragma region Math
+	/****************************************************************************
+	*                       NormalizeFloat3Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::NormalizeFloat3Stream(float* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	*
+	*  @brief     Normalize the 3D vectors
+	*
+	*  @param[out] float* output (Float3)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float3)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::NormalizeFloat3Stream(float* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const __m256 zero = _mm256_setzero_ps();
+		const __m256 one  = _mm256_set1_ps(1.0f);
+
+		gu::uint64 i = 0;
+
+		/*-------------------------------------------------------------------
+		-        Packed arrays : 8 vectors per iteration
+		---------------------------------------------------------------------*/
+		if (inputStride == sizeof(float) * 3 && outputStride == sizeof(float) * 3)
+		{
+			for (; i + 8 <= count; i += 8)
+			{
+				__m256 x, y, z;
+				LoadTransposeFloat3x8(input + i * 3, x, y, z);
+
+				const __m256 squareNorm = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)), _mm256_mul_ps(z, z));
+				const __m256 norm       = _mm256_sqrt_ps(squareNorm);
+
+				// 0 for the zero vectors
+				const __m256 reciprocalNorm = _mm256_and_ps(_mm256_div_ps(one, norm), _mm256_cmp_ps(norm, zero, _CMP_GT_OQ));
+
+				UntransposeStoreFloat3x8(output + i * 3, _mm256_mul_ps(x, reciprocalNorm), _mm256_mul_ps(y, reciprocalNorm), _mm256_mul_ps(z, reciprocalNorm));
+			}
+		}
+		else
+		{
+			/*-------------------------------------------------------------------
+			-        Other strides : 2 vectors per iteration
+			---------------------------------------------------------------------*/
+			for (; i + 2 <= count; i += 2)
+			{
+				const __m256 vector = LoadFloat3x2(At(input, inputStride, i), At(input, inputStride, i + 1));
+
+				__m256 squareNorm = _mm256_mul_ps(vector, vector);
+				squareNorm = _mm256_add_ps(squareNorm, _mm256_shuffle_ps(squareNorm, squareNorm, _MM_SHUFFLE(2, 3, 0, 1)));
+				squareNorm = _mm256_add_ps(squareNorm, _mm256_shuffle_ps(squareNorm, squareNorm, _MM_SHUFFLE(1, 0, 3, 2)));
+
+				const __m256 norm           = _mm256_sqrt_ps(squareNorm);
+				const __m256 reciprocalNorm = _mm256_and_ps(_mm256_div_ps(one, norm), _mm256_cmp_ps(norm, zero, _CMP_GT_OQ));
+
+				StoreFloat3x2(At(output, outputStride, i), At(output, outputStride, i + 1), _mm256_mul_ps(vector, reciprocalNorm));
+			}
+		}
+
+		if (i < count)
+		{
+			sse4::StreamUtility::NormalizeFloat3Stream(At(output, outputStride, i), outputStride, At(input, inputStride, i), inputStride, count - i);
+		}
+	}
+
+	/****************************************************************************
+	*                       NormalizeFloat4Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::NormalizeFloat4Stream(float* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	*
+	*  @brief     Normalize the 4D vectors 2 at a time
+	*
+	*  @param[out] float* output (Float4)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float4)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::NormalizeFloat4Stream(float* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const __m256 zero = _mm256_setzero_ps();
+		const __m256 one  = _mm256_set1_ps(1.0f);
+
+		gu::uint64 i = 0;
+		for (; i + 2 <= count; i += 2)
+		{
+			const __m256 vector = LoadFloat4x2(At(input, inputStride, i), At(input, inputStride, i + 1));
+
+			__m256 squareNorm = _mm256_mul_ps(vector, vector);
+			squareNorm = _mm256_add_ps(squareNorm, _mm256_shuffle_ps(squareNorm, squareNorm, _MM_SHUFFLE(2, 3, 0, 1)));
+			squareNorm = _mm256_add_ps(squareNorm, _mm256_shuffle_ps(squareNorm, squareNorm, _MM_SHUFFLE(1, 0, 3, 2)));
+
+			const __m256 norm           = _mm256_sqrt_ps(squareNorm);
+			const __m256 reciprocalNorm = _mm256_and_ps(_mm256_div_ps(one, norm), _mm256_cmp_ps(norm, zero, _CMP_GT_OQ));
+
+			StoreFloat4x2(At(output, outputStride, i), At(output, outputStride, i + 1), _mm256_mul_ps(vector, reciprocalNorm));
+		}
+
+		if (i < count)
+		{
+			sse4::StreamUtility::NormalizeFloat4Stream(At(output, outputStride, i), outputStride, At(input, inputStride, i), inputStride, count - i);
+		}
+	}
+
+	/****************************************************************************
+	*                       ComputeBoundsFloat3Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::ComputeBoundsFloat3Stream(float* minimum, float* maximum,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	*
+	*  @brief     Compute the axis aligned bounding box of the points.
+	*             The packed array is read as 3 float8 per 8 points. The 128 bit halves are folded
+	*             into the 3 float4 of the SSE layout ([x y z x] [y z x y] [z x y z]).
+	*
+	*  @param[out] float* minimum (float[3])
+	*  @param[out] float* maximum (float[3])
+	*  @param[in]  const float* input (Float3)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::ComputeBoundsFloat3Stream(float* minimum, float* maximum,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	{
+		Check(minimum && maximum);
+		Check(count == 0 || input);
+
+		__m128 resultMin = _mm_set1_ps( FLT_MAX);
+		__m128 resultMax = _mm_set1_ps(-FLT_MAX);
+
+		gu::uint64 i = 0;
+
+		if (inputStride == sizeof(float) * 3 && count >= 8)
+		{
+			/*-------------------------------------------------------------------
+			-        Packed arrays : 8 points per iteration
+			---------------------------------------------------------------------*/
+			__m256 min0 = _mm256_set1_ps(FLT_MAX), min1 = min0, min2 = min0;
+			__m256 max0 = _mm256_set1_ps(-FLT_MAX), max1 = max0, max2 = max0;
+
+			for (; i + 8 <= count; i += 8)
+			{
+				const float* source = input + i * 3;
+				const __m256 a = _mm256_loadu_ps(source);
+				const __m256 b = _mm256_loadu_ps(source + 8);
+				const __m256 c = _mm256_loadu_ps(source + 16);
+				min0 = _mm256_min_ps(min0, a); max0 = _mm256_max_ps(max0, a);
+				min1 = _mm256_min_ps(min1, b); max1 = _mm256_max_ps(max1, b);
+				min2 = _mm256_min_ps(min2, c); max2 = _mm256_max_ps(max2, c);
+			}
+
+			// floats 0-3 and 12-15, 4-7 and 16-19, 8-11 and 20-23 have the same axis order
+			resultMin = ReduceMinFloat3x4(
+				_mm_min_ps(_mm256_castps256_ps128(min0)   , _mm256_extractf128_ps(min1, 1)),
+				_mm_min_ps(_mm256_extractf128_ps(min0, 1), _mm256_castps256_ps128(min2)),
+				_mm_min_ps(_mm256_castps256_ps128(min1)   , _mm256_extractf128_ps(min2, 1)));
+			resultMax = ReduceMaxFloat3x4(
+				_mm_max_ps(_mm256_castps256_ps128(max0)   , _mm256_extractf128_ps(max1, 1)),
+				_mm_max_ps(_mm256_extractf128_ps(max0, 1), _mm256_castps256_ps128(max2)),
+				_mm_max_ps(_mm256_castps256_ps128(max1)   , _mm256_extractf128_ps(max2, 1)));
+		}
+		else if (inputStride != sizeof(float) * 3)
+		{
+			/*-------------------------------------------------------------------
+			-        Other strides : 2 points per iteration
+			---------------------------------------------------------------------*/
+			__m256 min0 = _mm256_set1_ps(FLT_MAX);
+			__m256 max0 = _mm256_set1_ps(-FLT_MAX);
+
+			for (; i + 2 <= count; i += 2)
+			{
+				const __m256 vector = LoadFloat3x2(At(input, inputStride, i), At(input, inputStride, i + 1));
+				min0 = _mm256_min_ps(min0, vector);
+				max0 = _mm256_max_ps(max0, vector);
+			}
+
+			resultMin = _mm_min_ps(_mm256_castps256_ps128(min0), _mm256_extractf128_ps(min0, 1));
+			resultMax = _mm_max_ps(_mm256_castps256_ps128(max0), _mm256_extractf128_ps(max0, 1));
+		}
+
+		/*-------------------------------------------------------------------
+		-        The rest
+		---------------------------------------------------------------------*/
+		for (; i < count; ++i)
+		{
+			const __m128 vector = LoadFloat3(At(input, inputStride, i));
+			resultMin = _mm_min_ps(resultMin, vector);
+			resultMax = _mm_max_ps(resultMax, vector);
+		}
+
+		StoreFloat3(minimum, resultMin);
+		StoreFloat3(maximum, resultMax);
+	}
+	#pragma endregion Math
+#pragma endregion Implement
+}
+
+#endif
+#endif
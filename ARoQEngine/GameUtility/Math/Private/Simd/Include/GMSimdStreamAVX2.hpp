@@ -0,0 +1,197 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMSimdStreamAVX2.hpp
+///             @brief  Batched (stream) operations of the float arrays by AVX2.
+///                     The transforms and the matrix products of the AVX implementation with the fused multiply add.
+///             How To: StreamUtility::TransformFloat3Stream(output, sizeof(Float3), input, sizeof(Float3), count, matrix)
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GM_SIMD_STREAM_AVX2_HPP
+#define GM_SIMD_STREAM_AVX2_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GMSimdMacros.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+#if PLATFORM_CPU_INSTRUCTION_AVX2 && !defined(PLATFORM_CPU_INSTRUCTION_NOT_USE)
+#include "GMSimdStreamAVX.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gm::simd::avx2
+{
+	/****************************************************************************
+	*				  			   StreamUtility
+	*************************************************************************//**
+	*  @class     StreamUtility
+	*  @brief     AVX2 stream operations (FMA)
+	*****************************************************************************/
+	class StreamUtility : public gm::simd::avx::StreamUtility
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		#pragma region Transform
+		/*----------------------------------------------------------------------
+		*  @brief : (x, y, z, 1) * matrix. The w column of the matrix is ignored.
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION TransformFloat3Stream(float* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : (x, y, z, 1) * matrix, and divide xyz by w (projection)
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION TransformCoordinateFloat3Stream(float* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : (x, y, z, 0) * matrix (direction and normal)
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION TransformNormalFloat3Stream(float* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : (x, y, z, w) * matrix
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION TransformFloat4Stream(float* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : output[i] = left[i] * right[i] (float[16] each).
+		*           A stride of 0 uses the same matrix for all the elements.
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION MultiplyStream(float* output, const gu::uint64 outputStride,
+			const float* left, const gu::uint64 leftStride, const float* right, const gu::uint64 rightStride, const gu::uint64 count) noexcept;
+		#pragma endregion Transform
+	};
+
+#pragma region Implement
+	#pragma region Transform
+	/****************************************************************************
+	*                       TransformFloat3Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::TransformFloat3Stream(float* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	*
+	*  @brief     Transform the points by the affine matrix
+	*
+	*  @param[out] float* output (Float3)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float3)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*  @param[in]  const float* matrix (float[16])
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::TransformFloat3Stream(float* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	{
+		TransformFloat3Wide<TransformMode::Point, true>(output, outputStride, input, inputStride, count, matrix);
+	}
+
+	/****************************************************************************
+	*                       TransformCoordinateFloat3Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::TransformCoordinateFloat3Stream(float* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	*
+	*  @brief     Transform the points by the projective matrix and divide them by w
+	*
+	*  @param[out] float* output (Float3)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float3)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*  @param[in]  const float* matrix (float[16])
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::TransformCoordinateFloat3Stream(float* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	{
+		TransformFloat3Wide<TransformMode::Coordinate, true>(output, outputStride, input, inputStride, count, matrix);
+	}
+
+	/****************************************************************************
+	*                       TransformNormalFloat3Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::TransformNormalFloat3Stream(float* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	*
+	*  @brief     Transform the directions without the translation
+	*
+	*  @param[out] float* output (Float3)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float3)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*  @param[in]  const float* matrix (float[16])
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::TransformNormalFloat3Stream(float* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	{
+		TransformFloat3Wide<TransformMode::Normal, true>(output, outputStride, input, inputStride, count, matrix);
+	}
+
+	/****************************************************************************
+	*                       TransformFloat4Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::TransformFloat4Stream(float* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	*
+	*  @brief     Transform the 4D vectors
+	*
+	*  @param[out] float* output (Float4)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float4)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*  @param[in]  const float* matrix (float[16])
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::TransformFloat4Stream(float* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	{
+		TransformFloat4Wide<true>(output, outputStride, input, inputStride, count, matrix);
+	}
+
+	/****************************************************************************
+	*                       MultiplyStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::MultiplyStream(float* output, const gu::uint64 outputStride,
+	*             const float* left, const gu::uint64 leftStride, const float* right, const gu::uint64 rightStride, const gu::uint64 count) noexcept
+	*
+	*  @brief     Multiply the matrix arrays (output[i] = left[i] * right[i])
+	*
+	*  @param[out] float* output (float[16])
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* left (float[16])
+	*  @param[in]  const gu::uint64 leftStride (byte, 0 : the same matrix)
+	*  @param[in]  const float* right (float[16])
+	*  @param[in]  const gu::uint64 rightStride (byte, 0 : the same matrix)
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::MultiplyStream(float* output, const gu::uint64 outputStride,
+		const float* left, const gu::uint64 leftStride, const float* right, const gu::uint64 rightStride, const gu::uint64 count) noexcept
+	{
+		MultiplyWide<true>(output, outputStride, left, leftStride, right, rightStride, count);
+	}
+	#pragma endregion Transform
+#pragma endregion Implement
+}
+
+#endif
+#endif
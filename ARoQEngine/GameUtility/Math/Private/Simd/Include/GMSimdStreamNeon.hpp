@@ -0,0 +1,606 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMSimdStreamNeon.hpp
+///             @brief  Batched (stream) operations of the float arrays by NEON.
+///                     - Same functions as gm::simd::non::StreamUtility.
+///                     - The tightly packed Float3 arrays (stride 12) are deinterleaved by vld3q / vst3q,
+///                       and processed 4 at a time as SoA. The other strides are processed one element per register.
+///                     - ARMv7 has no vector division and square root, so the reciprocal estimates
+///                       are refined by two Newton-Raphson steps there.
+///             How To: StreamUtility::TransformFloat3Stream(output, sizeof(Float3), input, sizeof(Float3), count, matrix)
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GM_SIMD_STREAM_NEON_HPP
+#define GM_SIMD_STREAM_NEON_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GMSimdMacros.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+#if PLATFORM_CPU_INSTRUCTION_NEON && !defined(PLATFORM_CPU_INSTRUCTION_NOT_USE)
+
+#if defined(_MSC_VER) && !defined(__clang__) && (defined(_M_ARM64) || defined(_M_HYBRID_X86_ARM64) || defined(_M_ARM64EC))
+	#include <arm64_neon.h>
+#else
+	#include <arm_neon.h>
+#endif
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include <float.h>
+
+#if defined(__aarch64__) || defined(_M_ARM64) || defined(_M_HYBRID_X86_ARM64) || defined(_M_ARM64EC)
+	#define GM_SIMD_STREAM_NEON_ARM64 1
+#else
+	#define GM_SIMD_STREAM_NEON_ARM64 0
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gm::simd::neon
+{
+	/****************************************************************************
+	*				  			   StreamUtility
+	*************************************************************************//**
+	*  @class     StreamUtility
+	*  @brief     NEON stream operations
+	*****************************************************************************/
+	class StreamUtility
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		#pragma region Transform
+		/*----------------------------------------------------------------------
+		*  @brief : (x, y, z, 1) * matrix. The w column of the matrix is ignored.
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION TransformFloat3Stream(float* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : (x, y, z, 1) * matrix, and divide xyz by w (projection)
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION TransformCoordinateFloat3Stream(float* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : (x, y, z, 0) * matrix (direction and normal)
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION TransformNormalFloat3Stream(float* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : (x, y, z, w) * matrix
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION TransformFloat4Stream(float* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : output[i] = left[i] * right[i] (float[16] each).
+		*           A stride of 0 uses the same matrix for all the elements.
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION MultiplyStream(float* output, const gu::uint64 outputStride,
+			const float* left, const gu::uint64 leftStride, const float* right, const gu::uint64 rightStride, const gu::uint64 count) noexcept;
+		#pragma endregion Transform
+
+		#pragma region Math
+		/*----------------------------------------------------------------------
+		*  @brief : Unit vectors (the zero vector stays zero)
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION NormalizeFloat3Stream(float* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept;
+
+		inline static void SIMD_CALL_CONVENTION NormalizeFloat4Stream(float* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : AABB of the points (minimum and maximum are float[3]).
+		*           The empty array returns FLT_MAX as the minimum and -FLT_MAX as the maximum.
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION ComputeBoundsFloat3Stream(float* minimum, float* maximum,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept;
+		#pragma endregion Math
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+		/* @brief : w of the Float3 transforms*/
+		enum class TransformMode : gu::uint8
+		{
+			Point,      // w = 1
+			Coordinate, // w = 1, and divide by the transformed w
+			Normal      // w = 0
+		};
+
+		template<TransformMode Mode>
+		inline static void TransformFloat3Internal(float* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept;
+
+		__forceinline static const float* At(const float* base, const gu::uint64 stride, const gu::uint64 index) noexcept
+		{
+			return reinterpret_cast<const float*>(reinterpret_cast<const gu::uint8*>(base) + stride * index);
+		}
+
+		__forceinline static float* At(float* base, const gu::uint64 stride, const gu::uint64 index) noexcept
+		{
+			return reinterpret_cast<float*>(reinterpret_cast<gu::uint8*>(base) + stride * index);
+		}
+
+		/* @brief : (x, y, z, 0) without reading the 4th float*/
+		__forceinline static float32x4_t LoadFloat3(const float* source) noexcept
+		{
+			return vcombine_f32(vld1_f32(source), vld1_lane_f32(&source[2], vdup_n_f32(0.0f), 0));
+		}
+
+		__forceinline static void StoreFloat3(float* destination, const float32x4_t vector) noexcept
+		{
+			vst1_f32(destination, vget_low_f32(vector));
+			vst1q_lane_f32(&destination[2], vector, 2);
+		}
+
+		/* @brief : row0 * v.x + row1 * v.y + row2 * v.z (+ row3 * v.w)*/
+		__forceinline static float32x4_t Multiply3(const float32x4_t vector, const float32x4_t row0, const float32x4_t row1, const float32x4_t row2) noexcept
+		{
+			float32x4_t result = vmulq_lane_f32(row0, vget_low_f32(vector), 0);
+			result = vmlaq_lane_f32(result, row1, vget_low_f32(vector), 1);
+			return vmlaq_lane_f32(result, row2, vget_high_f32(vector), 0);
+		}
+
+		__forceinline static float32x4_t Multiply4(const float32x4_t vector, const float32x4_t row0, const float32x4_t row1, const float32x4_t row2, const float32x4_t row3) noexcept
+		{
+			return vmlaq_lane_f32(Multiply3(vector, row0, row1, row2), row3, vget_high_f32(vector), 1);
+		}
+
+		__forceinline static float32x4_t Divide(const float32x4_t left, const float32x4_t right) noexcept
+		{
+		#if GM_SIMD_STREAM_NEON_ARM64
+			return vdivq_f32(left, right);
+		#else
+			float32x4_t reciprocal = vrecpeq_f32(right);
+			reciprocal = vmulq_f32(vrecpsq_f32(right, reciprocal), reciprocal);
+			reciprocal = vmulq_f32(vrecpsq_f32(right, reciprocal), reciprocal);
+			return vmulq_f32(left, reciprocal);
+		#endif
+		}
+
+		/* @brief : 1 / sqrt(squareNorm), and 0 for the zero vectors*/
+		__forceinline static float32x4_t ReciprocalNorm(const float32x4_t squareNorm) noexcept
+		{
+		#if GM_SIMD_STREAM_NEON_ARM64
+			const float32x4_t reciprocal = vdivq_f32(vdupq_n_f32(1.0f), vsqrtq_f32(squareNorm));
+		#else
+			float32x4_t reciprocal = vrsqrteq_f32(squareNorm);
+			reciprocal = vmulq_f32(vrsqrtsq_f32(vmulq_f32(squareNorm, reciprocal), reciprocal), reciprocal);
+			reciprocal = vmulq_f32(vrsqrtsq_f32(vmulq_f32(squareNorm, reciprocal), reciprocal), reciprocal);
+		#endif
+			const uint32x4_t nonZero = vcgtq_f32(squareNorm, vdupq_n_f32(0.0f));
+			return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(reciprocal), nonZero));
+		}
+
+		/* @brief : Sum of the 4 elements in all the elements*/
+		__forceinline static float32x4_t HorizontalAdd(const float32x4_t vector) noexcept
+		{
+			float32x2_t sum = vadd_f32(vget_low_f32(vector), vget_high_f32(vector));
+			sum = vpadd_f32(sum, sum);
+			return vcombine_f32(sum, sum);
+		}
+
+		__forceinline static float HorizontalMin(const float32x4_t vector) noexcept
+		{
+			float32x2_t result = vpmin_f32(vget_low_f32(vector), vget_high_f32(vector));
+			return vget_lane_f32(vpmin_f32(result, result), 0);
+		}
+
+		__forceinline static float HorizontalMax(const float32x4_t vector) noexcept
+		{
+			float32x2_t result = vpmax_f32(vget_low_f32(vector), vget_high_f32(vector));
+			return vget_lane_f32(vpmax_f32(result, result), 0);
+		}
+	};
+
+#pragma region Implement
+	#pragma region Transform
+	/****************************************************************************
+	*                       TransformFloat3Internal
+	*************************************************************************//**
+	*  @fn        inline void StreamUtility::TransformFloat3Internal(float* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	*
+	*  @brief     Transform the Float3 array. The packed arrays are transformed 4 at a time as SoA.
+	*
+	*  @param[out] float* output (Float3)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float3)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*  @param[in]  const float* matrix (float[16])
+	*
+	*  @return    void
+	*****************************************************************************/
+	template<StreamUtility::TransformMode Mode>
+	inline void StreamUtility::TransformFloat3Internal(float* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	{
+		Check(count == 0 || (output && input && matrix));
+
+		gu::uint64 i = 0;
+
+		/*-------------------------------------------------------------------
+		-        Packed arrays : 4 points per iteration
+		---------------------------------------------------------------------*/
+		if (inputStride == sizeof(float) * 3 && outputStride == sizeof(float) * 3)
+		{
+			for (; i + 4 <= count; i += 4)
+			{
+				const float32x4x3_t vector = vld3q_f32(input + i * 3);
+				const float32x4_t x = vector.val[0], y = vector.val[1], z = vector.val[2];
+
+				float32x4x3_t result = {};
+				for (gu::uint32 axis = 0; axis < 3; ++axis)
+				{
+					float32x4_t value = vmulq_n_f32(x, matrix[axis]);
+					value = vmlaq_n_f32(value, y, matrix[4 + axis]);
+					value = vmlaq_n_f32(value, z, matrix[8 + axis]);
+					if constexpr (Mode != TransformMode::Normal)
+					{
+						value = vaddq_f32(value, vdupq_n_f32(matrix[12 + axis]));
+					}
+					result.val[axis] = value;
+				}
+
+				if constexpr (Mode == TransformMode::Coordinate)
+				{
+					float32x4_t w = vmulq_n_f32(x, matrix[3]);
+					w = vmlaq_n_f32(w, y, matrix[7]);
+					w = vmlaq_n_f32(w, z, matrix[11]);
+					w = vaddq_f32(w, vdupq_n_f32(matrix[15]));
+					result.val[0] = Divide(result.val[0], w);
+					result.val[1] = Divide(result.val[1], w);
+					result.val[2] = Divide(result.val[2], w);
+				}
+
+				vst3q_f32(output + i * 3, result);
+			}
+		}
+
+		/*-------------------------------------------------------------------
+		-        Other strides and the rest : 1 point per iteration
+		---------------------------------------------------------------------*/
+		if (i >= count) { return; }
+
+		const float32x4_t row0 = vld1q_f32(&matrix[0]);
+		const float32x4_t row1 = vld1q_f32(&matrix[4]);
+		const float32x4_t row2 = vld1q_f32(&matrix[8]);
+		const float32x4_t row3 = vld1q_f32(&matrix[12]);
+
+		for (; i < count; ++i)
+		{
+			float32x4_t result = Multiply3(LoadFloat3(At(input, inputStride, i)), row0, row1, row2);
+
+			if constexpr (Mode != TransformMode::Normal)
+			{
+				result = vaddq_f32(result, row3);
+			}
+
+			if constexpr (Mode == TransformMode::Coordinate)
+			{
+				result = Divide(result, vdupq_lane_f32(vget_high_f32(result), 1));
+			}
+
+			StoreFloat3(At(output, outputStride, i), result);
+		}
+	}
+
+	/****************************************************************************
+	*                       TransformFloat3Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::TransformFloat3Stream(float* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	*
+	*  @brief     Transform the points by the affine matrix
+	*
+	*  @param[out] float* output (Float3)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float3)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*  @param[in]  const float* matrix (float[16])
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::TransformFloat3Stream(float* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	{
+		TransformFloat3Internal<TransformMode::Point>(output, outputStride, input, inputStride, count, matrix);
+	}
+
+	/****************************************************************************
+	*                       TransformCoordinateFloat3Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::TransformCoordinateFloat3Stream(float* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	*
+	*  @brief     Transform the points by the projective matrix and divide them by w
+	*
+	*  @param[out] float* output (Float3)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float3)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*  @param[in]  const float* matrix (float[16])
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::TransformCoordinateFloat3Stream(float* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	{
+		TransformFloat3Internal<TransformMode::Coordinate>(output, outputStride, input, inputStride, count, matrix);
+	}
+
+	/****************************************************************************
+	*                       TransformNormalFloat3Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::TransformNormalFloat3Stream(float* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	*
+	*  @brief     Transform the directions without the translation
+	*
+	*  @param[out] float* output (Float3)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float3)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*  @param[in]  const float* matrix (float[16])
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::TransformNormalFloat3Stream(float* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	{
+		TransformFloat3Internal<TransformMode::Normal>(output, outputStride, input, inputStride, count, matrix);
+	}
+
+	/****************************************************************************
+	*                       TransformFloat4Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::TransformFloat4Stream(float* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	*
+	*  @brief     Transform the 4D vectors
+	*
+	*  @param[out] float* output (Float4)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float4)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*  @param[in]  const float* matrix (float[16])
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::TransformFloat4Stream(float* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	{
+		Check(count == 0 || (output && input && matrix));
+
+		const float32x4_t row0 = vld1q_f32(&matrix[0]);
+		const float32x4_t row1 = vld1q_f32(&matrix[4]);
+		const float32x4_t row2 = vld1q_f32(&matrix[8]);
+		const float32x4_t row3 = vld1q_f32(&matrix[12]);
+
+		for (gu::uint64 i = 0; i < count; ++i)
+		{
+			const float32x4_t vector = vld1q_f32(At(input, inputStride, i));
+			vst1q_f32(At(output, outputStride, i), Multiply4(vector, row0, row1, row2, row3));
+		}
+	}
+
+	/****************************************************************************
+	*                       MultiplyStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::MultiplyStream(float* output, const gu::uint64 outputStride,
+	*             const float* left, const gu::uint64 leftStride, const float* right, const gu::uint64 rightStride, const gu::uint64 count) noexcept
+	*
+	*  @brief     Multiply the matrix arrays (output[i] = left[i] * right[i])
+	*
+	*  @param[out] float* output (float[16])
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* left (float[16])
+	*  @param[in]  const gu::uint64 leftStride (byte, 0 : the same matrix)
+	*  @param[in]  const float* right (float[16])
+	*  @param[in]  const gu::uint64 rightStride (byte, 0 : the same matrix)
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::MultiplyStream(float* output, const gu::uint64 outputStride,
+		const float* left, const gu::uint64 leftStride, const float* right, const gu::uint64 rightStride, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && left && right));
+
+		for (gu::uint64 i = 0; i < count; ++i)
+		{
+			const float* l = At(left , leftStride , i);
+			const float* r = At(right, rightStride, i);
+
+			// Load the both matrices first, because the output may be the same as one of them.
+			const float32x4_t row0 = vld1q_f32(&r[0]);
+			const float32x4_t row1 = vld1q_f32(&r[4]);
+			const float32x4_t row2 = vld1q_f32(&r[8]);
+			const float32x4_t row3 = vld1q_f32(&r[12]);
+			const float32x4_t left0 = vld1q_f32(&l[0]);
+			const float32x4_t left1 = vld1q_f32(&l[4]);
+			const float32x4_t left2 = vld1q_f32(&l[8]);
+			const float32x4_t left3 = vld1q_f32(&l[12]);
+
+			float* destination = At(output, outputStride, i);
+			vst1q_f32(&destination[0] , Multiply4(left0, row0, row1, row2, row3));
+			vst1q_f32(&destination[4] , Multiply4(left1, row0, row1, row2, row3));
+			vst1q_f32(&destination[8] , Multiply4(left2, row0, row1, row2, row3));
+			vst1q_f32(&destination[12], Multiply4(left3, row0, row1, row2, row3));
+		}
+	}
+	#pragma endregion Transform
+
+	#pragma region Math
+	/****************************************************************************
+	*                       NormalizeFloat3Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::NormalizeFloat3Stream(float* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	*
+	*  @brief     Normalize the 3D vectors
+	*
+	*  @param[out] float* output (Float3)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float3)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::NormalizeFloat3Stream(float* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		gu::uint64 i = 0;
+
+		/*-------------------------------------------------------------------
+		-        Packed arrays : 4 vectors per iteration
+		---------------------------------------------------------------------*/
+		if (inputStride == sizeof(float) * 3 && outputStride == sizeof(float) * 3)
+		{
+			for (; i + 4 <= count; i += 4)
+			{
+				float32x4x3_t vector = vld3q_f32(input + i * 3);
+
+				float32x4_t squareNorm = vmulq_f32(vector.val[0], vector.val[0]);
+				squareNorm = vmlaq_f32(squareNorm, vector.val[1], vector.val[1]);
+				squareNorm = vmlaq_f32(squareNorm, vector.val[2], vector.val[2]);
+
+				const float32x4_t reciprocalNorm = ReciprocalNorm(squareNorm);
+				vector.val[0] = vmulq_f32(vector.val[0], reciprocalNorm);
+				vector.val[1] = vmulq_f32(vector.val[1], reciprocalNorm);
+				vector.val[2] = vmulq_f32(vector.val[2], reciprocalNorm);
+
+				vst3q_f32(output + i * 3, vector);
+			}
+		}
+
+		/*-------------------------------------------------------------------
+		-        Other strides and the rest
+		---------------------------------------------------------------------*/
+		for (; i < count; ++i)
+		{
+			const float32x4_t vector = LoadFloat3(At(input, inputStride, i));
+			const float32x4_t reciprocalNorm = ReciprocalNorm(HorizontalAdd(vmulq_f32(vector, vector)));
+			StoreFloat3(At(output, outputStride, i), vmulq_f32(vector, reciprocalNorm));
+		}
+	}
+
+	/****************************************************************************
+	*                       NormalizeFloat4Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::NormalizeFloat4Stream(float* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	*
+	*  @brief     Normalize the 4D vectors
+	*
+	*  @param[out] float* output (Float4)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float4)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::NormalizeFloat4Stream(float* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		for (gu::uint64 i = 0; i < count; ++i)
+		{
+			const float32x4_t vector = vld1q_f32(At(input, inputStride, i));
+			const float32x4_t reciprocalNorm = ReciprocalNorm(HorizontalAdd(vmulq_f32(vector, vector)));
+			vst1q_f32(At(output, outputStride, i), vmulq_f32(vector, reciprocalNorm));
+		}
+	}
+
+	/****************************************************************************
+	*                       ComputeBoundsFloat3Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::ComputeBoundsFloat3Stream(float* minimum, float* maximum,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	*
+	*  @brief     Compute the axis aligned bounding box of the points
+	*
+	*  @param[out] float* minimum (float[3])
+	*  @param[out] float* maximum (float[3])
+	*  @param[in]  const float* input (Float3)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::ComputeBoundsFloat3Stream(float* minimum, float* maximum,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	{
+		Check(minimum && maximum);
+		Check(count == 0 || input);
+
+		float32x4_t resultMin = vdupq_n_f32( FLT_MAX);
+		float32x4_t resultMax = vdupq_n_f32(-FLT_MAX);
+
+		gu::uint64 i = 0;
+
+		/*-------------------------------------------------------------------
+		-        Packed arrays : 4 points per iteration
+		---------------------------------------------------------------------*/
+		if (inputStride == sizeof(float) * 3 && count >= 4)
+		{
+			float32x4x3_t axisMin = { { resultMin, resultMin, resultMin } };
+			float32x4x3_t axisMax = { { resultMax, resultMax, resultMax } };
+
+			for (; i + 4 <= count; i += 4)
+			{
+				const float32x4x3_t vector = vld3q_f32(input + i * 3);
+				for (gu::uint32 axis = 0; axis < 3; ++axis)
+				{
+					axisMin.val[axis] = vminq_f32(axisMin.val[axis], vector.val[axis]);
+					axisMax.val[axis] = vmaxq_f32(axisMax.val[axis], vector.val[axis]);
+				}
+			}
+
+			const float packedMin[4] = { HorizontalMin(axisMin.val[0]), HorizontalMin(axisMin.val[1]), HorizontalMin(axisMin.val[2]), FLT_MAX };
+			const float packedMax[4] = { HorizontalMax(axisMax.val[0]), HorizontalMax(axisMax.val[1]), HorizontalMax(axisMax.val[2]), -FLT_MAX };
+			resultMin = vld1q_f32(packedMin);
+			resultMax = vld1q_f32(packedMax);
+		}
+
+		/*-------------------------------------------------------------------
+		-        Other strides and the rest
+		---------------------------------------------------------------------*/
+		for (; i < count; ++i)
+		{
+			const float32x4_t vector = LoadFloat3(At(input, inputStride, i));
+			resultMin = vminq_f32(resultMin, vector);
+			resultMax = vmaxq_f32(resultMax, vector);
+		}
+
+		StoreFloat3(minimum, resultMin);
+		StoreFloat3(maximum, resultMax);
+	}
+	#pragma endregion Math
+#pragma endregion Implement
+}
+
+#undef GM_SIMD_STREAM_NEON_ARM64
+#endif
+#endif
@@ -0,0 +1,412 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMSimdStreamNon.hpp
+///             @brief  Batched (stream) operations of the float arrays without SIMD.
+///                     - Transform the Float3 / Float4 arrays by one matrix, multiply the matrix arrays,
+///                       normalize the vector arrays and compute the AABB of the point arrays.
+///                     - The matrix is a row major float[16] (Float4x4), and the vectors are the row vectors (v * M).
+///                     - The strides are in bytes. An input stride of 0 repeats the same element.
+///                       The output may be the same array as the input.
+///                     - This backend is always compiled, because it is the reference of the SIMD backends.
+///             How To: StreamUtility::TransformFloat3Stream(output, sizeof(Float3), input, sizeof(Float3), count, matrix)
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GM_SIMD_STREAM_NON_HPP
+#define GM_SIMD_STREAM_NON_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GMSimdMacros.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include <math.h>
+#include <float.h>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gm::simd::non
+{
+	/****************************************************************************
+	*				  			   StreamUtility
+	*************************************************************************//**
+	*  @class     StreamUtility
+	*  @brief     Scalar stream operations
+	*****************************************************************************/
+	class StreamUtility
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		#pragma region Transform
+		/*----------------------------------------------------------------------
+		*  @brief : (x, y, z, 1) * matrix. The w column of the matrix is ignored.
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION TransformFloat3Stream(float* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : (x, y, z, 1) * matrix, and divide xyz by w (projection)
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION TransformCoordinateFloat3Stream(float* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : (x, y, z, 0) * matrix (direction and normal)
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION TransformNormalFloat3Stream(float* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : (x, y, z, w) * matrix
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION TransformFloat4Stream(float* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : output[i] = left[i] * right[i] (float[16] each).
+		*           A stride of 0 uses the same matrix for all the elements.
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION MultiplyStream(float* output, const gu::uint64 outputStride,
+			const float* left, const gu::uint64 leftStride, const float* right, const gu::uint64 rightStride, const gu::uint64 count) noexcept;
+		#pragma endregion Transform
+
+		#pragma region Math
+		/*----------------------------------------------------------------------
+		*  @brief : Unit vectors (the zero vector stays zero)
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION NormalizeFloat3Stream(float* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept;
+
+		inline static void SIMD_CALL_CONVENTION NormalizeFloat4Stream(float* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : AABB of the points (minimum and maximum are float[3]).
+		*           The empty array returns FLT_MAX as the minimum and -FLT_MAX as the maximum.
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION ComputeBoundsFloat3Stream(float* minimum, float* maximum,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept;
+		#pragma endregion Math
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+		__forceinline static const float* At(const float* base, const gu::uint64 stride, const gu::uint64 index) noexcept
+		{
+			return reinterpret_cast<const float*>(reinterpret_cast<const gu::uint8*>(base) + stride * index);
+		}
+
+		__forceinline static float* At(float* base, const gu::uint64 stride, const gu::uint64 index) noexcept
+		{
+			return reinterpret_cast<float*>(reinterpret_cast<gu::uint8*>(base) + stride * index);
+		}
+	};
+
+#pragma region Implement
+	#pragma region Transform
+	/****************************************************************************
+	*                       TransformFloat3Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::TransformFloat3Stream(float* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	*
+	*  @brief     Transform the points by the affine matrix
+	*
+	*  @param[out] float* output (Float3)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float3)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*  @param[in]  const float* matrix (float[16])
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::TransformFloat3Stream(float* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	{
+		Check(count == 0 || (output && input && matrix));
+
+		for (gu::uint64 i = 0; i < count; ++i)
+		{
+			const float* source = At(input, inputStride, i);
+			const float x = source[0], y = source[1], z = source[2];
+
+			float* destination = At(output, outputStride, i);
+			destination[0] = x * matrix[0] + y * matrix[4] + z * matrix[8]  + matrix[12];
+			destination[1] = x * matrix[1] + y * matrix[5] + z * matrix[9]  + matrix[13];
+			destination[2] = x * matrix[2] + y * matrix[6] + z * matrix[10] + matrix[14];
+		}
+	}
+
+	/****************************************************************************
+	*                       TransformCoordinateFloat3Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::TransformCoordinateFloat3Stream(float* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	*
+	*  @brief     Transform the points by the projective matrix and divide them by w
+	*
+	*  @param[out] float* output (Float3)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float3)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*  @param[in]  const float* matrix (float[16])
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::TransformCoordinateFloat3Stream(float* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	{
+		Check(count == 0 || (output && input && matrix));
+
+		for (gu::uint64 i = 0; i < count; ++i)
+		{
+			const float* source = At(input, inputStride, i);
+			const float x = source[0], y = source[1], z = source[2];
+			const float w = x * matrix[3] + y * matrix[7] + z * matrix[11] + matrix[15];
+
+			float* destination = At(output, outputStride, i);
+			destination[0] = (x * matrix[0] + y * matrix[4] + z * matrix[8]  + matrix[12]) / w;
+			destination[1] = (x * matrix[1] + y * matrix[5] + z * matrix[9]  + matrix[13]) / w;
+			destination[2] = (x * matrix[2] + y * matrix[6] + z * matrix[10] + matrix[14]) / w;
+		}
+	}
+
+	/****************************************************************************
+	*                       TransformNormalFloat3Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::TransformNormalFloat3Stream(float* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	*
+	*  @brief     Transform the directions without the translation
+	*
+	*  @param[out] float* output (Float3)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float3)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*  @param[in]  const float* matrix (float[16])
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::TransformNormalFloat3Stream(float* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	{
+		Check(count == 0 || (output && input && matrix));
+
+		for (gu::uint64 i = 0; i < count; ++i)
+		{
+			const float* source = At(input, inputStride, i);
+			const float x = source[0], y = source[1], z = source[2];
+
+			float* destination = At(output, outputStride, i);
+			destination[0] = x * matrix[0] + y * matrix[4] + z * matrix[8];
+			destination[1] = x * matrix[1] + y * matrix[5] + z * matrix[9];
+			destination[2] = x * matrix[2] + y * matrix[6] + z * matrix[10];
+		}
+	}
+
+	/****************************************************************************
+	*                       TransformFloat4Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::TransformFloat4Stream(float* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	*
+	*  @brief     Transform the 4D vectors
+	*
+	*  @param[out] float* output (Float4)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float4)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*  @param[in]  const float* matrix (float[16])
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::TransformFloat4Stream(float* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	{
+		Check(count == 0 || (output && input && matrix));
+
+		for (gu::uint64 i = 0; i < count; ++i)
+		{
+			const float* source = At(input, inputStride, i);
+			const float x = source[0], y = source[1], z = source[2], w = source[3];
+
+			float* destination = At(output, outputStride, i);
+			for (gu::uint32 column = 0; column < 4; ++column)
+			{
+				destination[column] = x * matrix[column] + y * matrix[4 + column] + z * matrix[8 + column] + w * matrix[12 + column];
+			}
+		}
+	}
+
+	/****************************************************************************
+	*                       MultiplyStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::MultiplyStream(float* output, const gu::uint64 outputStride,
+	*             const float* left, const gu::uint64 leftStride, const float* right, const gu::uint64 rightStride, const gu::uint64 count) noexcept
+	*
+	*  @brief     Multiply the matrix arrays (output[i] = left[i] * right[i])
+	*
+	*  @param[out] float* output (float[16])
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* left (float[16])
+	*  @param[in]  const gu::uint64 leftStride (byte, 0 : the same matrix)
+	*  @param[in]  const float* right (float[16])
+	*  @param[in]  const gu::uint64 rightStride (byte, 0 : the same matrix)
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::MultiplyStream(float* output, const gu::uint64 outputStride,
+		const float* left, const gu::uint64 leftStride, const float* right, const gu::uint64 rightStride, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && left && right));
+
+		for (gu::uint64 i = 0; i < count; ++i)
+		{
+			const float* l = At(left , leftStride , i);
+			const float* r = At(right, rightStride, i);
+
+			float result[16] = {};
+			for (gu::uint32 row = 0; row < 4; ++row)
+			{
+				for (gu::uint32 column = 0; column < 4; ++column)
+				{
+					result[row * 4 + column] = l[row * 4 + 0] * r[column]     + l[row * 4 + 1] * r[4 + column]
+						                     + l[row * 4 + 2] * r[8 + column] + l[row * 4 + 3] * r[12 + column];
+				}
+			}
+
+			float* destination = At(output, outputStride, i);
+			for (gu::uint32 j = 0; j < 16; ++j) { destination[j] = result[j]; }
+		}
+	}
+	#pragma endregion Transform
+
+	#pragma region Math
+	/****************************************************************************
+	*                       NormalizeFloat3Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::NormalizeFloat3Stream(float* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	*
+	*  @brief     Normalize the 3D vectors
+	*
+	*  @param[out] float* output (Float3)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float3)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::NormalizeFloat3Stream(float* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		for (gu::uint64 i = 0; i < count; ++i)
+		{
+			const float* source = At(input, inputStride, i);
+			const float x = source[0], y = source[1], z = source[2];
+
+			const float norm           = sqrtf(x * x + y * y + z * z);
+			const float reciprocalNorm = norm > 0 ? 1.0f / norm : 0.0f;
+
+			float* destination = At(output, outputStride, i);
+			destination[0] = x * reciprocalNorm;
+			destination[1] = y * reciprocalNorm;
+			destination[2] = z * reciprocalNorm;
+		}
+	}
+
+	/****************************************************************************
+	*                       NormalizeFloat4Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::NormalizeFloat4Stream(float* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	*
+	*  @brief     Normalize the 4D vectors
+	*
+	*  @param[out] float* output (Float4)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float4)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::NormalizeFloat4Stream(float* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		for (gu::uint64 i = 0; i < count; ++i)
+		{
+			const float* source = At(input, inputStride, i);
+			const float x = source[0], y = source[1], z = source[2], w = source[3];
+
+			const float norm           = sqrtf(x * x + y * y + z * z + w * w);
+			const float reciprocalNorm = norm > 0 ? 1.0f / norm : 0.0f;
+
+			float* destination = At(output, outputStride, i);
+			destination[0] = x * reciprocalNorm;
+			destination[1] = y * reciprocalNorm;
+			destination[2] = z * reciprocalNorm;
+			destination[3] = w * reciprocalNorm;
+		}
+	}
+
+	/****************************************************************************
+	*                       ComputeBoundsFloat3Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::ComputeBoundsFloat3Stream(float* minimum, float* maximum,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	*
+	*  @brief     Compute the axis aligned bounding box of the points
+	*
+	*  @param[out] float* minimum (float[3])
+	*  @param[out] float* maximum (float[3])
+	*  @param[in]  const float* input (Float3)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::ComputeBoundsFloat3Stream(float* minimum, float* maximum,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	{
+		Check(minimum && maximum);
+		Check(count == 0 || input);
+
+		float resultMin[3] = {  FLT_MAX,  FLT_MAX,  FLT_MAX };
+		float resultMax[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+		for (gu::uint64 i = 0; i < count; ++i)
+		{
+			const float* source = At(input, inputStride, i);
+			for (gu::uint32 axis = 0; axis < 3; ++axis)
+			{
+				resultMin[axis] = resultMin[axis] < source[axis] ? resultMin[axis] : source[axis];
+				resultMax[axis] = resultMax[axis] > source[axis] ? resultMax[axis] : source[axis];
+			}
+		}
+
+		for (gu::uint32 axis = 0; axis < 3; ++axis)
+		{
+			minimum[axis] = resultMin[axis];
+			maximum[axis] = resultMax[axis];
+		}
+	}
+	#pragma endregion Math
+#pragma endregion Implement
+}
+
+#endif
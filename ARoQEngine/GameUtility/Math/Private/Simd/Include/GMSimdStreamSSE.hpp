@@ -0,0 +1,633 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMSimdStreamSSE.hpp
+///             @brief  Batched (stream) operations of the float arrays by SSE.
+///                     - Same functions as gm::simd::non::StreamUtility.
+///                     - The tightly packed Float3 arrays (stride 12) are processed 4 at a time
+///                       by transposing 3 loads into x, y, z registers (SoA). The other strides
+///                       are processed one element per register.
+///             How To: StreamUtility::TransformFloat3Stream(output, sizeof(Float3), input, sizeof(Float3), count, matrix)
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GM_SIMD_STREAM_SSE_HPP
+#define GM_SIMD_STREAM_SSE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GMSimdMacros.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+#if PLATFORM_CPU_INSTRUCTION_SSE && !defined(PLATFORM_CPU_INSTRUCTION_NOT_USE)
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include <xmmintrin.h>
+#include <float.h>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gm::simd::sse
+{
+	/****************************************************************************
+	*				  			   StreamUtility
+	*************************************************************************//**
+	*  @class     StreamUtility
+	*  @brief     SSE stream operations
+	*****************************************************************************/
+	class StreamUtility
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		#pragma region Transform
+		/*----------------------------------------------------------------------
+		*  @brief : (x, y, z, 1) * matrix. The w column of the matrix is ignored.
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION TransformFloat3Stream(float* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : (x, y, z, 1) * matrix, and divide xyz by w (projection)
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION TransformCoordinateFloat3Stream(float* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : (x, y, z, 0) * matrix (direction and normal)
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION TransformNormalFloat3Stream(float* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : (x, y, z, w) * matrix
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION TransformFloat4Stream(float* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : output[i] = left[i] * right[i] (float[16] each).
+		*           A stride of 0 uses the same matrix for all the elements.
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION MultiplyStream(float* output, const gu::uint64 outputStride,
+			const float* left, const gu::uint64 leftStride, const float* right, const gu::uint64 rightStride, const gu::uint64 count) noexcept;
+		#pragma endregion Transform
+
+		#pragma region Math
+		/*----------------------------------------------------------------------
+		*  @brief : Unit vectors (the zero vector stays zero)
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION NormalizeFloat3Stream(float* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept;
+
+		inline static void SIMD_CALL_CONVENTION NormalizeFloat4Stream(float* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept;
+
+		/*----------------------------------------------------------------------
+		*  @brief : AABB of the points (minimum and maximum are float[3]).
+		*           The empty array returns FLT_MAX as the minimum and -FLT_MAX as the maximum.
+		/*----------------------------------------------------------------------*/
+		inline static void SIMD_CALL_CONVENTION ComputeBoundsFloat3Stream(float* minimum, float* maximum,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept;
+		#pragma endregion Math
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+		/* @brief : w of the Float3 transforms*/
+		enum class TransformMode : gu::uint8
+		{
+			Point,      // w = 1
+			Coordinate, // w = 1, and divide by the transformed w
+			Normal      // w = 0
+		};
+
+		template<TransformMode Mode>
+		inline static void TransformFloat3Internal(float* output, const gu::uint64 outputStride,
+			const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept;
+
+		__forceinline static const float* At(const float* base, const gu::uint64 stride, const gu::uint64 index) noexcept
+		{
+			return reinterpret_cast<const float*>(reinterpret_cast<const gu::uint8*>(base) + stride * index);
+		}
+
+		__forceinline static float* At(float* base, const gu::uint64 stride, const gu::uint64 index) noexcept
+		{
+			return reinterpret_cast<float*>(reinterpret_cast<gu::uint8*>(base) + stride * index);
+		}
+
+		/* @brief : (x, y, z, 0) without reading the 4th float.
+		            The xy pair is accessed as __m64 (not double), which may alias the float array.*/
+		__forceinline static __m128 LoadFloat3(const float* source) noexcept
+		{
+			const __m128 xy = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(source));
+			return _mm_movelh_ps(xy, _mm_load_ss(&source[2]));
+		}
+
+		__forceinline static void StoreFloat3(float* destination, const __m128 vector) noexcept
+		{
+			_mm_storel_pi(reinterpret_cast<__m64*>(destination), vector);
+			_mm_store_ss(&destination[2], _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(2, 2, 2, 2)));
+		}
+
+		/* @brief : [x0 y0 z0 x1] [y1 z1 x2 y2] [z2 x3 y3 z3] -> [x0 x1 x2 x3] [y0 y1 y2 y3] [z0 z1 z2 z3]*/
+		__forceinline static void TransposeFloat3x4(const __m128 a, const __m128 b, const __m128 c, __m128& x, __m128& y, __m128& z) noexcept
+		{
+			const __m128 x23 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)); // x2 x2 x3 x3
+			const __m128 y01 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)); // y0 y0 y1 y1
+			const __m128 y23 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)); // y2 y2 y3 y3
+			const __m128 z01 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)); // z0 z0 z1 z1
+			x = _mm_shuffle_ps(a  , x23, _MM_SHUFFLE(2, 0, 3, 0));
+			y = _mm_shuffle_ps(y01, y23, _MM_SHUFFLE(2, 0, 2, 0));
+			z = _mm_shuffle_ps(z01, c  , _MM_SHUFFLE(3, 0, 2, 0));
+		}
+
+		/* @brief : Inverse of TransposeFloat3x4*/
+		__forceinline static void UntransposeFloat3x4(const __m128 x, const __m128 y, const __m128 z, __m128& a, __m128& b, __m128& c) noexcept
+		{
+			const __m128 x0y0 = _mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)); // x0 x0 y0 y0
+			const __m128 z0x1 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)); // z0 z0 x1 x1
+			const __m128 y1z1 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)); // y1 y1 z1 z1
+			const __m128 x2y2 = _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)); // x2 x2 y2 y2
+			const __m128 z2x3 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)); // z2 z2 x3 x3
+			const __m128 y3z3 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)); // y3 y3 z3 z3
+			a = _mm_shuffle_ps(x0y0, z0x1, _MM_SHUFFLE(2, 0, 2, 0));
+			b = _mm_shuffle_ps(y1z1, x2y2, _MM_SHUFFLE(2, 0, 2, 0));
+			c = _mm_shuffle_ps(z2x3, y3z3, _MM_SHUFFLE(2, 0, 2, 0));
+		}
+
+		/* @brief : Per axis minimum of [x0 y0 z0 x1] [y1 z1 x2 y2] [z2 x3 y3 z3] -> (x, y, z, z)*/
+		__forceinline static __m128 ReduceMinFloat3x4(const __m128 a, const __m128 b, const __m128 c) noexcept
+		{
+			__m128 x, y, z;
+			TransposeFloat3x4(a, b, c, x, y, z);
+			__m128 xy = _mm_min_ps(_mm_unpacklo_ps(x, y), _mm_unpackhi_ps(x, y)); // x0|x2, y0|y2, x1|x3, y1|y3
+			xy = _mm_min_ps(xy, _mm_shuffle_ps(xy, xy, _MM_SHUFFLE(1, 0, 3, 2)));
+			z  = _mm_min_ps(z , _mm_shuffle_ps(z , z , _MM_SHUFFLE(1, 0, 3, 2)));
+			z  = _mm_min_ps(z , _mm_shuffle_ps(z , z , _MM_SHUFFLE(2, 3, 0, 1)));
+			return _mm_movelh_ps(xy, z);
+		}
+
+		/* @brief : Per axis maximum of [x0 y0 z0 x1] [y1 z1 x2 y2] [z2 x3 y3 z3] -> (x, y, z, z)*/
+		__forceinline static __m128 ReduceMaxFloat3x4(const __m128 a, const __m128 b, const __m128 c) noexcept
+		{
+			__m128 x, y, z;
+			TransposeFloat3x4(a, b, c, x, y, z);
+			__m128 xy = _mm_max_ps(_mm_unpacklo_ps(x, y), _mm_unpackhi_ps(x, y));
+			xy = _mm_max_ps(xy, _mm_shuffle_ps(xy, xy, _MM_SHUFFLE(1, 0, 3, 2)));
+			z  = _mm_max_ps(z , _mm_shuffle_ps(z , z , _MM_SHUFFLE(1, 0, 3, 2)));
+			z  = _mm_max_ps(z , _mm_shuffle_ps(z , z , _MM_SHUFFLE(2, 3, 0, 1)));
+			return _mm_movelh_ps(xy, z);
+		}
+	};
+
+#pragma region Implement
+	#pragma region Transform
+	/****************************************************************************
+	*                       TransformFloat3Internal
+	*************************************************************************//**
+	*  @fn        inline void StreamUtility::TransformFloat3Internal(float* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	*
+	*  @brief     Transform the Float3 array. The packed arrays are transformed 4 at a time as SoA.
+	*
+	*  @param[out] float* output (Float3)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float3)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*  @param[in]  const float* matrix (float[16])
+	*
+	*  @return    void
+	*****************************************************************************/
+	template<StreamUtility::TransformMode Mode>
+	inline void StreamUtility::TransformFloat3Internal(float* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	{
+		Check(count == 0 || (output && input && matrix));
+
+		gu::uint64 i = 0;
+
+		/*-------------------------------------------------------------------
+		-        Packed arrays : 4 points per iteration
+		---------------------------------------------------------------------*/
+		if (inputStride == sizeof(float) * 3 && outputStride == sizeof(float) * 3 && count >= 4)
+		{
+			const __m128 m00 = _mm_set1_ps(matrix[0]), m01 = _mm_set1_ps(matrix[1]), m02 = _mm_set1_ps(matrix[2]);
+			const __m128 m10 = _mm_set1_ps(matrix[4]), m11 = _mm_set1_ps(matrix[5]), m12 = _mm_set1_ps(matrix[6]);
+			const __m128 m20 = _mm_set1_ps(matrix[8]), m21 = _mm_set1_ps(matrix[9]), m22 = _mm_set1_ps(matrix[10]);
+			const __m128 m30 = _mm_set1_ps(matrix[12]), m31 = _mm_set1_ps(matrix[13]), m32 = _mm_set1_ps(matrix[14]);
+
+			for (; i + 4 <= count; i += 4)
+			{
+				const float* source = input + i * 3;
+				__m128 x, y, z;
+				TransposeFloat3x4(_mm_loadu_ps(source), _mm_loadu_ps(source + 4), _mm_loadu_ps(source + 8), x, y, z);
+
+				__m128 rx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m00), _mm_mul_ps(y, m10)), _mm_mul_ps(z, m20));
+				__m128 ry = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m01), _mm_mul_ps(y, m11)), _mm_mul_ps(z, m21));
+				__m128 rz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m02), _mm_mul_ps(y, m12)), _mm_mul_ps(z, m22));
+
+				if constexpr (Mode != TransformMode::Normal)
+				{
+					rx = _mm_add_ps(rx, m30);
+					ry = _mm_add_ps(ry, m31);
+					rz = _mm_add_ps(rz, m32);
+				}
+
+				if constexpr (Mode == TransformMode::Coordinate)
+				{
+					__m128 rw = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(matrix[3])), _mm_mul_ps(y, _mm_set1_ps(matrix[7]))), _mm_mul_ps(z, _mm_set1_ps(matrix[11])));
+					rw = _mm_add_ps(rw, _mm_set1_ps(matrix[15]));
+					rx = _mm_div_ps(rx, rw);
+					ry = _mm_div_ps(ry, rw);
+					rz = _mm_div_ps(rz, rw);
+				}
+
+				__m128 a, b, c;
+				UntransposeFloat3x4(rx, ry, rz, a, b, c);
+
+				float* destination = output + i * 3;
+				_mm_storeu_ps(destination    , a);
+				_mm_storeu_ps(destination + 4, b);
+				_mm_storeu_ps(destination + 8, c);
+			}
+		}
+
+		/*-------------------------------------------------------------------
+		-        Other strides and the rest : 1 point per iteration
+		---------------------------------------------------------------------*/
+		if (i >= count) { return; }
+
+		const __m128 row0 = _mm_loadu_ps(&matrix[0]);
+		const __m128 row1 = _mm_loadu_ps(&matrix[4]);
+		const __m128 row2 = _mm_loadu_ps(&matrix[8]);
+		const __m128 row3 = _mm_loadu_ps(&matrix[12]);
+
+		for (; i < count; ++i)
+		{
+			const __m128 vector = LoadFloat3(At(input, inputStride, i));
+
+			__m128 result = _mm_mul_ps(_mm_shuffle_ps(vector, vector, _MM_SHUFFLE(0, 0, 0, 0)), row0);
+			result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(vector, vector, _MM_SHUFFLE(1, 1, 1, 1)), row1));
+			result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(vector, vector, _MM_SHUFFLE(2, 2, 2, 2)), row2));
+
+			if constexpr (Mode != TransformMode::Normal)
+			{
+				result = _mm_add_ps(result, row3);
+			}
+
+			if constexpr (Mode == TransformMode::Coordinate)
+			{
+				result = _mm_div_ps(result, _mm_shuffle_ps(result, result, _MM_SHUFFLE(3, 3, 3, 3)));
+			}
+
+			StoreFloat3(At(output, outputStride, i), result);
+		}
+	}
+
+	/****************************************************************************
+	*                       TransformFloat3Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::TransformFloat3Stream(float* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	*
+	*  @brief     Transform the points by the affine matrix
+	*
+	*  @param[out] float* output (Float3)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float3)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*  @param[in]  const float* matrix (float[16])
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::TransformFloat3Stream(float* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	{
+		TransformFloat3Internal<TransformMode::Point>(output, outputStride, input, inputStride, count, matrix);
+	}
+
+	/****************************************************************************
+	*                       TransformCoordinateFloat3Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::TransformCoordinateFloat3Stream(float* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	*
+	*  @brief     Transform the points by the projective matrix and divide them by w
+	*
+	*  @param[out] float* output (Float3)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float3)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*  @param[in]  const float* matrix (float[16])
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::TransformCoordinateFloat3Stream(float* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	{
+		TransformFloat3Internal<TransformMode::Coordinate>(output, outputStride, input, inputStride, count, matrix);
+	}
+
+	/****************************************************************************
+	*                       TransformNormalFloat3Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::TransformNormalFloat3Stream(float* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	*
+	*  @brief     Transform the directions without the translation
+	*
+	*  @param[out] float* output (Float3)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float3)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*  @param[in]  const float* matrix (float[16])
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::TransformNormalFloat3Stream(float* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	{
+		TransformFloat3Internal<TransformMode::Normal>(output, outputStride, input, inputStride, count, matrix);
+	}
+
+	/****************************************************************************
+	*                       TransformFloat4Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::TransformFloat4Stream(float* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	*
+	*  @brief     Transform the 4D vectors
+	*
+	*  @param[out] float* output (Float4)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float4)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*  @param[in]  const float* matrix (float[16])
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::TransformFloat4Stream(float* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count, const float* matrix) noexcept
+	{
+		Check(count == 0 || (output && input && matrix));
+
+		const __m128 row0 = _mm_loadu_ps(&matrix[0]);
+		const __m128 row1 = _mm_loadu_ps(&matrix[4]);
+		const __m128 row2 = _mm_loadu_ps(&matrix[8]);
+		const __m128 row3 = _mm_loadu_ps(&matrix[12]);
+
+		for (gu::uint64 i = 0; i < count; ++i)
+		{
+			const __m128 vector = _mm_loadu_ps(At(input, inputStride, i));
+
+			__m128 result = _mm_mul_ps(_mm_shuffle_ps(vector, vector, _MM_SHUFFLE(0, 0, 0, 0)), row0);
+			result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(vector, vector, _MM_SHUFFLE(1, 1, 1, 1)), row1));
+			result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(vector, vector, _MM_SHUFFLE(2, 2, 2, 2)), row2));
+			result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(vector, vector, _MM_SHUFFLE(3, 3, 3, 3)), row3));
+
+			_mm_storeu_ps(At(output, outputStride, i), result);
+		}
+	}
+
+	/****************************************************************************
+	*                       MultiplyStream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::MultiplyStream(float* output, const gu::uint64 outputStride,
+	*             const float* left, const gu::uint64 leftStride, const float* right, const gu::uint64 rightStride, const gu::uint64 count) noexcept
+	*
+	*  @brief     Multiply the matrix arrays (output[i] = left[i] * right[i])
+	*
+	*  @param[out] float* output (float[16])
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* left (float[16])
+	*  @param[in]  const gu::uint64 leftStride (byte, 0 : the same matrix)
+	*  @param[in]  const float* right (float[16])
+	*  @param[in]  const gu::uint64 rightStride (byte, 0 : the same matrix)
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::MultiplyStream(float* output, const gu::uint64 outputStride,
+		const float* left, const gu::uint64 leftStride, const float* right, const gu::uint64 rightStride, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && left && right));
+
+		for (gu::uint64 i = 0; i < count; ++i)
+		{
+			const float* l = At(left , leftStride , i);
+			const float* r = At(right, rightStride, i);
+
+			// Load the whole right matrix first, because the output may be the same as the right one.
+			const __m128 row0 = _mm_loadu_ps(&r[0]);
+			const __m128 row1 = _mm_loadu_ps(&r[4]);
+			const __m128 row2 = _mm_loadu_ps(&r[8]);
+			const __m128 row3 = _mm_loadu_ps(&r[12]);
+
+			float* destination = At(output, outputStride, i);
+			for (gu::uint32 row = 0; row < 4; ++row)
+			{
+				const __m128 vector = _mm_loadu_ps(&l[row * 4]);
+
+				__m128 result = _mm_mul_ps(_mm_shuffle_ps(vector, vector, _MM_SHUFFLE(0, 0, 0, 0)), row0);
+				result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(vector, vector, _MM_SHUFFLE(1, 1, 1, 1)), row1));
+				result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(vector, vector, _MM_SHUFFLE(2, 2, 2, 2)), row2));
+				result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(vector, vector, _MM_SHUFFLE(3, 3, 3, 3)), row3));
+
+				_mm_storeu_ps(&destination[row * 4], result);
+			}
+		}
+	}
+	#pragma endregion Transform
+
+	#pragma region Math
+	/****************************************************************************
+	*                       NormalizeFloat3Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::NormalizeFloat3Stream(float* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	*
+	*  @brief     Normalize the 3D vectors
+	*
+	*  @param[out] float* output (Float3)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float3)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::NormalizeFloat3Stream(float* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 one  = _mm_set1_ps(1.0f);
+
+		gu::uint64 i = 0;
+
+		/*-------------------------------------------------------------------
+		-        Packed arrays : 4 vectors per iteration
+		---------------------------------------------------------------------*/
+		if (inputStride == sizeof(float) * 3 && outputStride == sizeof(float) * 3)
+		{
+			for (; i + 4 <= count; i += 4)
+			{
+				const float* source = input + i * 3;
+				__m128 x, y, z;
+				TransposeFloat3x4(_mm_loadu_ps(source), _mm_loadu_ps(source + 4), _mm_loadu_ps(source + 8), x, y, z);
+
+				const __m128 squareNorm = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+				const __m128 norm       = _mm_sqrt_ps(squareNorm);
+
+				// 0 for the zero vectors
+				const __m128 reciprocalNorm = _mm_and_ps(_mm_div_ps(one, norm), _mm_cmpgt_ps(norm, zero));
+
+				__m128 a, b, c;
+				UntransposeFloat3x4(_mm_mul_ps(x, reciprocalNorm), _mm_mul_ps(y, reciprocalNorm), _mm_mul_ps(z, reciprocalNorm), a, b, c);
+
+				float* destination = output + i * 3;
+				_mm_storeu_ps(destination    , a);
+				_mm_storeu_ps(destination + 4, b);
+				_mm_storeu_ps(destination + 8, c);
+			}
+		}
+
+		/*-------------------------------------------------------------------
+		-        Other strides and the rest
+		---------------------------------------------------------------------*/
+		for (; i < count; ++i)
+		{
+			const __m128 vector = LoadFloat3(At(input, inputStride, i));
+
+			// x*x + y*y + z*z in all the elements (w is 0)
+			__m128 squareNorm = _mm_mul_ps(vector, vector);
+			squareNorm = _mm_add_ps(squareNorm, _mm_shuffle_ps(squareNorm, squareNorm, _MM_SHUFFLE(2, 3, 0, 1)));
+			squareNorm = _mm_add_ps(squareNorm, _mm_shuffle_ps(squareNorm, squareNorm, _MM_SHUFFLE(1, 0, 3, 2)));
+
+			const __m128 norm           = _mm_sqrt_ps(squareNorm);
+			const __m128 reciprocalNorm = _mm_and_ps(_mm_div_ps(one, norm), _mm_cmpgt_ps(norm, zero));
+
+			StoreFloat3(At(output, outputStride, i), _mm_mul_ps(vector, reciprocalNorm));
+		}
+	}
+
+	/****************************************************************************
+	*                       NormalizeFloat4Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::NormalizeFloat4Stream(float* output, const gu::uint64 outputStride,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	*
+	*  @brief     Normalize the 4D vectors
+	*
+	*  @param[out] float* output (Float4)
+	*  @param[in]  const gu::uint64 outputStride (byte)
+	*  @param[in]  const float* input (Float4)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::NormalizeFloat4Stream(float* output, const gu::uint64 outputStride,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	{
+		Check(count == 0 || (output && input));
+
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 one  = _mm_set1_ps(1.0f);
+
+		for (gu::uint64 i = 0; i < count; ++i)
+		{
+			const __m128 vector = _mm_loadu_ps(At(input, inputStride, i));
+
+			__m128 squareNorm = _mm_mul_ps(vector, vector);
+			squareNorm = _mm_add_ps(squareNorm, _mm_shuffle_ps(squareNorm, squareNorm, _MM_SHUFFLE(2, 3, 0, 1)));
+			squareNorm = _mm_add_ps(squareNorm, _mm_shuffle_ps(squareNorm, squareNorm, _MM_SHUFFLE(1, 0, 3, 2)));
+
+			const __m128 norm           = _mm_sqrt_ps(squareNorm);
+			const __m128 reciprocalNorm = _mm_and_ps(_mm_div_ps(one, norm), _mm_cmpgt_ps(norm, zero));
+
+			_mm_storeu_ps(At(output, outputStride, i), _mm_mul_ps(vector, reciprocalNorm));
+		}
+	}
+
+	/****************************************************************************
+	*                       ComputeBoundsFloat3Stream
+	*************************************************************************//**
+	*  @fn        inline void SIMD_CALL_CONVENTION StreamUtility::ComputeBoundsFloat3Stream(float* minimum, float* maximum,
+	*             const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	*
+	*  @brief     Compute the axis aligned bounding box of the points.
+	*             The packed array is read as 3 float4 per 4 points, so the n-th float of the 3 accumulators is the (n % 3) axis.
+	*
+	*  @param[out] float* minimum (float[3])
+	*  @param[out] float* maximum (float[3])
+	*  @param[in]  const float* input (Float3)
+	*  @param[in]  const gu::uint64 inputStride (byte)
+	*  @param[in]  const gu::uint64 count
+	*
+	*  @return    void
+	*****************************************************************************/
+	inline void SIMD_CALL_CONVENTION StreamUtility::ComputeBoundsFloat3Stream(float* minimum, float* maximum,
+		const float* input, const gu::uint64 inputStride, const gu::uint64 count) noexcept
+	{
+		Check(minimum && maximum);
+		Check(count == 0 || input);
+
+		__m128 resultMin = _mm_set1_ps( FLT_MAX);
+		__m128 resultMax = _mm_set1_ps(-FLT_MAX);
+
+		gu::uint64 i = 0;
+
+		/*-------------------------------------------------------------------
+		-        Packed arrays : 4 points per iteration
+		---------------------------------------------------------------------*/
+		if (inputStride == sizeof(float) * 3 && count >= 4)
+		{
+			__m128 min0 = resultMin, min1 = resultMin, min2 = resultMin;
+			__m128 max0 = resultMax, max1 = resultMax, max2 = resultMax;
+
+			for (; i + 4 <= count; i += 4)
+			{
+				const float* source = input + i * 3;
+				const __m128 a = _mm_loadu_ps(source);
+				const __m128 b = _mm_loadu_ps(source + 4);
+				const __m128 c = _mm_loadu_ps(source + 8);
+				min0 = _mm_min_ps(min0, a); max0 = _mm_max_ps(max0, a);
+				min1 = _mm_min_ps(min1, b); max1 = _mm_max_ps(max1, b);
+				min2 = _mm_min_ps(min2, c); max2 = _mm_max_ps(max2, c);
+			}
+
+			resultMin = ReduceMinFloat3x4(min0, min1, min2);
+			resultMax = ReduceMaxFloat3x4(max0, max1, max2);
+		}
+
+		/*-------------------------------------------------------------------
+		-        Other strides and the rest
+		---------------------------------------------------------------------*/
+		for (; i < count; ++i)
+		{
+			const __m128 vector = LoadFloat3(At(input, inputStride, i));
+			resultMin = _mm_min_ps(resultMin, vector);
+			resultMax = _mm_max_ps(resultMax, vector);
+		}
+
+		StoreFloat3(minimum, resultMin);
+		StoreFloat3(maximum, resultMax);
+	}
+	#pragma endregion Math
+#pragma endregion Implement
+}
+
+#endif
+#endif
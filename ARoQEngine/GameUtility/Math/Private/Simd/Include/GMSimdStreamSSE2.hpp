@@ -0,0 +1,31 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMSimdStreamSSE2.hpp
+///             @brief  Batched (stream) operations of the float arrays by SSE2.
+///                     The same implementation as SSE.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GM_SIMD_STREAM_SSE2_HPP
+#define GM_SIMD_STREAM_SSE2_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GMSimdMacros.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+#if PLATFORM_CPU_INSTRUCTION_SSE2 && !defined(PLATFORM_CPU_INSTRUCTION_NOT_USE)
+#include "GMSimdStreamSSE.hpp"
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+
+namespace gm::simd::sse2
+{
+	using StreamUtility = gm::simd::sse::StreamUtility;
+}
+#endif
+#endif
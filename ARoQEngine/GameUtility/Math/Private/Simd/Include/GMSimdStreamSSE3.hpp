@@ -0,0 +1,31 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMSimdStreamSSE3.hpp
+///             @brief  Batched (stream) operations of the float arrays by SSE3.
+///                     The same implementation as SSE.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GM_SIMD_STREAM_SSE3_HPP
+#define GM_SIMD_STREAM_SSE3_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GMSimdMacros.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+#if PLATFORM_CPU_INSTRUCTION_SSE3 && !defined(PLATFORM_CPU_INSTRUCTION_NOT_USE)
+#include "GMSimdStreamSSE2.hpp"
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+
+namespace gm::simd::sse3
+{
+	using StreamUtility = gm::simd::sse2::StreamUtility;
+}
+#endif
+#endif
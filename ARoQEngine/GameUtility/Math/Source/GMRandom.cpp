@@ -0,0 +1,847 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GMRandom.cpp
+///             @brief  Small state random number generators and batch samplers
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/Math/Include/GMRandom.hpp"
+#include "GameUtility/Math/Private/Simd/Include/GMSimdMacros.hpp"
+#include <atomic>
+#include <cmath>
+#include <random>
+
+#if PLATFORM_CPU_INSTRUCTION_AVX2
+	#include <immintrin.h>
+#elif PLATFORM_CPU_INSTRUCTION_SSE2
+	#include <emmintrin.h>
+#elif PLATFORM_CPU_INSTRUCTION_NEON
+	#include <arm_neon.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace gm;
+using namespace gm::details::random;
+
+namespace
+{
+	/*-------------------------------------------------------------------
+	-   Jump polynomials (Blackman and Vigna)
+	---------------------------------------------------------------------*/
+	constexpr gu::uint64 XOSHIRO256_JUMP     [4] = { 0x180ec6d33cfd0abaull, 0xd5a61266f0c9392cull, 0xa9582618e03fc9aaull, 0x39abdc4529b1661cull }; // 2^128
+	constexpr gu::uint64 XOSHIRO256_LONG_JUMP[4] = { 0x76e15d3efefdcbbfull, 0xc5004e441c522fb3ull, 0x77710069854ee241ull, 0x39109bb02acbe635ull }; // 2^192
+	constexpr gu::uint32 XOSHIRO128_JUMP     [4] = { 0x8764000b, 0xf542d2d3, 0x6fa035c3, 0x77f2db5b }; // 2^64
+	constexpr gu::uint32 XOSHIRO128_LONG_JUMP[4] = { 0xb523952e, 0x0b6f099f, 0xccf5a0ef, 0x1c580662 }; // 2^96
+
+	/* @brief : Words generated at once by the samplers which consume a variable count of words*/
+	constexpr gu::uint32 SAMPLER_BUFFER_SIZE = 256;
+
+	/*-------------------------------------------------------------------
+	-   xoshiro128** step of one lane (scalar fallback and jump)
+	---------------------------------------------------------------------*/
+	inline gu::uint32 StepLane(gu::uint32& s0, gu::uint32& s1, gu::uint32& s2, gu::uint32& s3) noexcept
+	{
+		const gu::uint32 result = RotateLeft(s1 * 5, 7) * 9;
+		const gu::uint32 t      = s1 << 9;
+
+		s2 ^= s0;
+		s3 ^= s1;
+		s1 ^= s2;
+		s0 ^= s3;
+		s2 ^= t;
+		s3 = RotateLeft(s3, 11);
+		return result;
+	}
+
+	/* @brief : (0, 1] for the logarithm*/
+	inline float ToOpenFloat(const gu::uint32 word) noexcept
+	{
+		return static_cast<float>((word >> 8) + 1) * (1.0f / 16777216.0f);
+	}
+
+#pragma region SIMD Lanes
+	/****************************************************************************
+	*                       Lanes
+	*************************************************************************//**
+	*  @struct    Lanes
+	*  @brief     8 lane xoshiro128** state loaded in the registers.
+	*             Step() returns the 8 output words, Store*() write them to the memory.
+	*             x * 5 and x * 9 are done by the shift and add, so no 32 bit multiply is needed.
+	*****************************************************************************/
+#if PLATFORM_CPU_INSTRUCTION_AVX2
+	struct Lanes
+	{
+		using Block = __m256i;
+
+		__m256i S[4];
+
+		static __m256i RotateLeft(const __m256i x, const int k) noexcept
+		{
+			return _mm256_or_si256(_mm256_slli_epi32(x, k), _mm256_srli_epi32(x, 32 - k));
+		}
+
+		explicit Lanes(const gu::uint32 (&state)[4][RandomStream::LANE_COUNT]) noexcept
+		{
+			for (int i = 0; i < 4; ++i) { S[i] = _mm256_load_si256(reinterpret_cast<const __m256i*>(state[i])); }
+		}
+
+		void Store(gu::uint32 (&state)[4][RandomStream::LANE_COUNT]) const noexcept
+		{
+			for (int i = 0; i < 4; ++i) { _mm256_store_si256(reinterpret_cast<__m256i*>(state[i]), S[i]); }
+		}
+
+		Block Step() noexcept
+		{
+			const __m256i times5 = _mm256_add_epi32(_mm256_slli_epi32(S[1], 2), S[1]);
+			const __m256i rotate = RotateLeft(times5, 7);
+			const __m256i result = _mm256_add_epi32(_mm256_slli_epi32(rotate, 3), rotate);
+			const __m256i t      = _mm256_slli_epi32(S[1], 9);
+
+			S[2] = _mm256_xor_si256(S[2], S[0]);
+			S[3] = _mm256_xor_si256(S[3], S[1]);
+			S[1] = _mm256_xor_si256(S[1], S[2]);
+			S[0] = _mm256_xor_si256(S[0], S[3]);
+			S[2] = _mm256_xor_si256(S[2], t);
+			S[3] = RotateLeft(S[3], 11);
+			return result;
+		}
+
+		static void StoreUInt32(gu::uint32* output, const Block& words) noexcept
+		{
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(output), words);
+		}
+
+		static void StoreFloat(float* output, const Block& words, const float scale, const float offset) noexcept
+		{
+			const __m256 value = _mm256_cvtepi32_ps(_mm256_srli_epi32(words, 8));
+			_mm256_storeu_ps(output, _mm256_add_ps(_mm256_mul_ps(value, _mm256_set1_ps(scale)), _mm256_set1_ps(offset)));
+		}
+
+		/* @brief : offset + (words * range) >> 32*/
+		static void StoreInt(gu::int32* output, const Block& words, const gu::uint32 range, const gu::int32 offset) noexcept
+		{
+			const __m256i rangeVector = _mm256_set1_epi32(static_cast<int>(range));
+			const __m256i even        = _mm256_srli_epi64(_mm256_mul_epu32(words, rangeVector), 32);
+			const __m256i odd         = _mm256_mul_epu32(_mm256_srli_epi64(words, 32), rangeVector);
+			const __m256i high        = _mm256_blend_epi32(even, odd, 0xAA);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(output), _mm256_add_epi32(high, _mm256_set1_epi32(offset)));
+		}
+	};
+#elif PLATFORM_CPU_INSTRUCTION_SSE2
+	struct Lanes
+	{
+		struct Block { __m128i V[2]; };
+
+		__m128i S[4][2];
+
+		static __m128i RotateLeft(const __m128i x, const int k) noexcept
+		{
+			return _mm_or_si128(_mm_slli_epi32(x, k), _mm_srli_epi32(x, 32 - k));
+		}
+
+		explicit Lanes(const gu::uint32 (&state)[4][RandomStream::LANE_COUNT]) noexcept
+		{
+			for (int i = 0; i < 4; ++i)
+			{
+				S[i][0] = _mm_load_si128(reinterpret_cast<const __m128i*>(state[i]));
+				S[i][1] = _mm_load_si128(reinterpret_cast<const __m128i*>(state[i] + 4));
+			}
+		}
+
+		void Store(gu::uint32 (&state)[4][RandomStream::LANE_COUNT]) const noexcept
+		{
+			for (int i = 0; i < 4; ++i)
+			{
+				_mm_store_si128(reinterpret_cast<__m128i*>(state[i])    , S[i][0]);
+				_mm_store_si128(reinterpret_cast<__m128i*>(state[i] + 4), S[i][1]);
+			}
+		}
+
+		Block Step() noexcept
+		{
+			Block block = {};
+			for (int h = 0; h < 2; ++h)
+			{
+				const __m128i times5 = _mm_add_epi32(_mm_slli_epi32(S[1][h], 2), S[1][h]);
+				const __m128i rotate = RotateLeft(times5, 7);
+				const __m128i t      = _mm_slli_epi32(S[1][h], 9);
+				block.V[h] = _mm_add_epi32(_mm_slli_epi32(rotate, 3), rotate);
+
+				S[2][h] = _mm_xor_si128(S[2][h], S[0][h]);
+				S[3][h] = _mm_xor_si128(S[3][h], S[1][h]);
+				S[1][h] = _mm_xor_si128(S[1][h], S[2][h]);
+				S[0][h] = _mm_xor_si128(S[0][h], S[3][h]);
+				S[2][h] = _mm_xor_si128(S[2][h], t);
+				S[3][h] = RotateLeft(S[3][h], 11);
+			}
+			return block;
+		}
+
+		static void StoreUInt32(gu::uint32* output, const Block& words) noexcept
+		{
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(output)    , words.V[0]);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(output + 4), words.V[1]);
+		}
+
+		static void StoreFloat(float* output, const Block& words, const float scale, const float offset) noexcept
+		{
+			const __m128 scaleVector  = _mm_set1_ps(scale);
+			const __m128 offsetVector = _mm_set1_ps(offset);
+			for (int h = 0; h < 2; ++h)
+			{
+				const __m128 value = _mm_cvtepi32_ps(_mm_srli_epi32(words.V[h], 8));
+				_mm_storeu_ps(output + 4 * h, _mm_add_ps(_mm_mul_ps(value, scaleVector), offsetVector));
+			}
+		}
+
+		/* @brief : offset + (words * range) >> 32*/
+		static void StoreInt(gu::int32* output, const Block& words, const gu::uint32 range, const gu::int32 offset) noexcept
+		{
+			const __m128i rangeVector = _mm_set1_epi32(static_cast<int>(range));
+			const __m128i highMask    = _mm_set_epi32(-1, 0, -1, 0);
+			for (int h = 0; h < 2; ++h)
+			{
+				const __m128i even = _mm_srli_epi64(_mm_mul_epu32(words.V[h], rangeVector), 32);
+				const __m128i odd  = _mm_and_si128(_mm_mul_epu32(_mm_srli_epi64(words.V[h], 32), rangeVector), highMask);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(output + 4 * h), _mm_add_epi32(_mm_or_si128(even, odd), _mm_set1_epi32(offset)));
+			}
+		}
+	};
+#elif PLATFORM_CPU_INSTRUCTION_NEON
+	struct Lanes
+	{
+		struct Block { uint32x4_t V[2]; };
+
+		uint32x4_t S[4][2];
+
+		template<int K>
+		static uint32x4_t RotateLeft(const uint32x4_t x) noexcept
+		{
+			return vorrq_u32(vshlq_n_u32(x, K), vshrq_n_u32(x, 32 - K));
+		}
+
+		explicit Lanes(const gu::uint32 (&state)[4][RandomStream::LANE_COUNT]) noexcept
+		{
+			for (int i = 0; i < 4; ++i)
+			{
+				S[i][0] = vld1q_u32(state[i]);
+				S[i][1] = vld1q_u32(state[i] + 4);
+			}
+		}
+
+		void Store(gu::uint32 (&state)[4][RandomStream::LANE_COUNT]) const noexcept
+		{
+			for (int i = 0; i < 4; ++i)
+			{
+				vst1q_u32(state[i]    , S[i][0]);
+				vst1q_u32(state[i] + 4, S[i][1]);
+			}
+		}
+
+		Block Step() noexcept
+		{
+			Block block = {};
+			for (int h = 0; h < 2; ++h)
+			{
+				const uint32x4_t times5 = vaddq_u32(vshlq_n_u32(S[1][h], 2), S[1][h]);
+				const uint32x4_t rotate = RotateLeft<7>(times5);
+				const uint32x4_t t      = vshlq_n_u32(S[1][h], 9);
+				block.V[h] = vaddq_u32(vshlq_n_u32(rotate, 3), rotate);
+
+				S[2][h] = veorq_u32(S[2][h], S[0][h]);
+				S[3][h] = veorq_u32(S[3][h], S[1][h]);
+				S[1][h] = veorq_u32(S[1][h], S[2][h]);
+				S[0][h] = veorq_u32(S[0][h], S[3][h]);
+				S[2][h] = veorq_u32(S[2][h], t);
+				S[3][h] = RotateLeft<11>(S[3][h]);
+			}
+			return block;
+		}
+
+		static void StoreUInt32(gu::uint32* output, const Block& words) noexcept
+		{
+			vst1q_u32(output    , words.V[0]);
+			vst1q_u32(output + 4, words.V[1]);
+		}
+
+		static void StoreFloat(float* output, const Block& words, const float scale, const float offset) noexcept
+		{
+			for (int h = 0; h < 2; ++h)
+			{
+				const float32x4_t value = vcvtq_f32_u32(vshrq_n_u32(words.V[h], 8));
+				vst1q_f32(output + 4 * h, vaddq_f32(vmulq_n_f32(value, scale), vdupq_n_f32(offset)));
+			}
+		}
+
+		/* @brief : offset + (words * range) >> 32*/
+		static void StoreInt(gu::int32* output, const Block& words, const gu::uint32 range, const gu::int32 offset) noexcept
+		{
+			const uint32x2_t rangeVector = vdup_n_u32(range);
+			for (int h = 0; h < 2; ++h)
+			{
+				const uint32x2_t low  = vshrn_n_u64(vmull_u32(vget_low_u32 (words.V[h]), rangeVector), 32);
+				const uint32x2_t high = vshrn_n_u64(vmull_u32(vget_high_u32(words.V[h]), rangeVector), 32);
+				const uint32x4_t value = vaddq_u32(vcombine_u32(low, high), vdupq_n_u32(static_cast<gu::uint32>(offset)));
+				vst1q_s32(output + 4 * h, vreinterpretq_s32_u32(value));
+			}
+		}
+	};
+#else
+	struct Lanes
+	{
+		struct Block { gu::uint32 V[RandomStream::LANE_COUNT]; };
+
+		gu::uint32 S[4][RandomStream::LANE_COUNT];
+
+		explicit Lanes(const gu::uint32 (&state)[4][RandomStream::LANE_COUNT]) noexcept
+		{
+			for (int i = 0; i < 4; ++i)
+			{
+				for (gu::uint32 lane = 0; lane < RandomStream::LANE_COUNT; ++lane) { S[i][lane] = state[i][lane]; }
+			}
+		}
+
+		void Store(gu::uint32 (&state)[4][RandomStream::LANE_COUNT]) const noexcept
+		{
+			for (int i = 0; i < 4; ++i)
+			{
+				for (gu::uint32 lane = 0; lane < RandomStream::LANE_COUNT; ++lane) { state[i][lane] = S[i][lane]; }
+			}
+		}
+
+		Block Step() noexcept
+		{
+			Block block = {};
+			for (gu::uint32 lane = 0; lane < RandomStream::LANE_COUNT; ++lane)
+			{
+				block.V[lane] = StepLane(S[0][lane], S[1][lane], S[2][lane], S[3][lane]);
+			}
+			return block;
+		}
+
+		static void StoreUInt32(gu::uint32* output, const Block& words) noexcept
+		{
+			for (gu::uint32 i = 0; i < RandomStream::LANE_COUNT; ++i) { output[i] = words.V[i]; }
+		}
+
+		static void StoreFloat(float* output, const Block& words, const float scale, const float offset) noexcept
+		{
+			for (gu::uint32 i = 0; i < RandomStream::LANE_COUNT; ++i)
+			{
+				output[i] = static_cast<float>(words.V[i] >> 8) * scale + offset;
+			}
+		}
+
+		/* @brief : offset + (words * range) >> 32*/
+		static void StoreInt(gu::int32* output, const Block& words, const gu::uint32 range, const gu::int32 offset) noexcept
+		{
+			for (gu::uint32 i = 0; i < RandomStream::LANE_COUNT; ++i)
+			{
+				const auto high = static_cast<gu::uint32>((static_cast<gu::uint64>(words.V[i]) * range) >> 32);
+				output[i] = static_cast<gu::int32>(high + static_cast<gu::uint32>(offset));
+			}
+		}
+	};
+#endif
+#pragma endregion SIMD Lanes
+
+	/****************************************************************************
+	*                       FillLanes
+	*************************************************************************//**
+	*  @fn        template<class T, class Function> void FillLanes(gu::uint32 (&state)[4][8], T* output, const gu::uint64 count, const Function& store)
+	*  @brief     Step the lanes count / 8 times (rounded up) and store every block.
+	*             The last partial block goes through the local buffer.
+	*  @param[in] state  : lane state (updated)
+	*  @param[out] output
+	*  @param[in] count
+	*  @param[in] store  : void(T* output, const Lanes::Block& words)
+	*  @return    void
+	*****************************************************************************/
+	template<class T, class Function>
+	void FillLanes(gu::uint32 (&state)[4][RandomStream::LANE_COUNT], T* output, const gu::uint64 count, const Function& store) noexcept
+	{
+		if (count == 0 || output == nullptr) { return; }
+
+		Lanes lanes(state);
+
+		const gu::uint64 fullCount = count - count % RandomStream::LANE_COUNT;
+		for (gu::uint64 i = 0; i < fullCount; i += RandomStream::LANE_COUNT)
+		{
+			store(output + i, lanes.Step());
+		}
+
+		if (fullCount < count)
+		{
+			T rest[RandomStream::LANE_COUNT] = {};
+			store(rest, lanes.Step());
+			for (gu::uint64 i = fullCount; i < count; ++i) { output[i] = rest[i - fullCount]; }
+		}
+
+		lanes.Store(state);
+	}
+
+#pragma region Ziggurat
+	/****************************************************************************
+	*                       ZigguratTable
+	*************************************************************************//**
+	*  @struct    ZigguratTable
+	*  @brief     Layer tables of Marsaglia and Tsang (2000).
+	*             The lower bits of the word choose the layer and are masked out of the value,
+	*             so the layer and the value do not share the bits (Doornik 2005).
+	*****************************************************************************/
+	struct ZigguratTable
+	{
+		static constexpr gu::uint32 NORMAL_LAYER_COUNT      = 128;
+		static constexpr gu::uint32 EXPONENTIAL_LAYER_COUNT = 256;
+		static constexpr double     NORMAL_TAIL             = 3.442619855899;
+		static constexpr double     EXPONENTIAL_TAIL        = 7.697117470131487;
+
+		gu::uint32 NormalK[NORMAL_LAYER_COUNT] = {};
+		float      NormalW[NORMAL_LAYER_COUNT] = {};
+		float      NormalF[NORMAL_LAYER_COUNT] = {};
+
+		gu::uint32 ExponentialK[EXPONENTIAL_LAYER_COUNT] = {};
+		float      ExponentialW[EXPONENTIAL_LAYER_COUNT] = {};
+		float      ExponentialF[EXPONENTIAL_LAYER_COUNT] = {};
+
+		ZigguratTable()
+		{
+			/*-------------------------------------------------------------------
+			-   Normal : |x| = |int32| * W, 2^31 scale
+			---------------------------------------------------------------------*/
+			{
+				constexpr double m1 = 2147483648.0;
+				constexpr double vn = 9.91256303526217e-3;
+
+				double dn = NORMAL_TAIL;
+				double tn = dn;
+				const double q = vn / std::exp(-0.5 * dn * dn);
+
+				NormalK[0] = static_cast<gu::uint32>((dn / q) * m1);
+				NormalK[1] = 0;
+				NormalW[0] = static_cast<float>(q / m1);
+				NormalW[NORMAL_LAYER_COUNT - 1] = static_cast<float>(dn / m1);
+				NormalF[0] = 1.0f;
+				NormalF[NORMAL_LAYER_COUNT - 1] = static_cast<float>(std::exp(-0.5 * dn * dn));
+
+				for (gu::uint32 i = NORMAL_LAYER_COUNT - 2; i >= 1; --i)
+				{
+					dn = std::sqrt(-2.0 * std::log(vn / dn + std::exp(-0.5 * dn * dn)));
+					NormalK[i + 1] = static_cast<gu::uint32>((dn / tn) * m1);
+					tn = dn;
+					NormalF[i] = static_cast<float>(std::exp(-0.5 * dn * dn));
+					NormalW[i] = static_cast<float>(dn / m1);
+				}
+			}
+
+			/*-------------------------------------------------------------------
+			-   Exponential : x = uint32 * W, 2^32 scale
+			---------------------------------------------------------------------*/
+			{
+				constexpr double m2 = 4294967296.0;
+				constexpr double ve = 3.949659822581572e-3;
+
+				double de = EXPONENTIAL_TAIL;
+				double te = de;
+				const double q = ve / std::exp(-de);
+
+				ExponentialK[0] = static_cast<gu::uint32>((de / q) * m2);
+				ExponentialK[1] = 0;
+				ExponentialW[0] = static_cast<float>(q / m2);
+				ExponentialW[EXPONENTIAL_LAYER_COUNT - 1] = static_cast<float>(de / m2);
+				ExponentialF[0] = 1.0f;
+				ExponentialF[EXPONENTIAL_LAYER_COUNT - 1] = static_cast<float>(std::exp(-de));
+
+				for (gu::uint32 i = EXPONENTIAL_LAYER_COUNT - 2; i >= 1; --i)
+				{
+					de = -std::log(ve / de + std::exp(-de));
+					ExponentialK[i + 1] = static_cast<gu::uint32>((de / te) * m2);
+					te = de;
+					ExponentialF[i] = static_cast<float>(std::exp(-de));
+					ExponentialW[i] = static_cast<float>(de / m2);
+				}
+			}
+		}
+
+		static const ZigguratTable& Get()
+		{
+			static const ZigguratTable table;
+			return table;
+		}
+	};
+
+	/*-------------------------------------------------------------------
+	-   Buffered words for the samplers which may reject
+	---------------------------------------------------------------------*/
+	class WordBuffer
+	{
+	public:
+		gu::uint32 Next() noexcept
+		{
+			if (_index == SAMPLER_BUFFER_SIZE)
+			{
+				_stream.FillUInt32(_words, SAMPLER_BUFFER_SIZE);
+				_index = 0;
+			}
+			return _words[_index++];
+		}
+
+		explicit WordBuffer(RandomStream& stream) noexcept : _stream(stream) {};
+
+	private:
+		RandomStream& _stream;
+		gu::uint32    _words[SAMPLER_BUFFER_SIZE] = {};
+		gu::uint32    _index = SAMPLER_BUFFER_SIZE;
+	};
+
+	float SampleNormal(const ZigguratTable& table, WordBuffer& words) noexcept
+	{
+		constexpr float tail = static_cast<float>(ZigguratTable::NORMAL_TAIL);
+
+		for (;;)
+		{
+			const gu::uint32 word     = words.Next();
+			const gu::uint32 layer    = word & (ZigguratTable::NORMAL_LAYER_COUNT - 1);
+			const gu::int32  value    = static_cast<gu::int32>(word & ~(ZigguratTable::NORMAL_LAYER_COUNT - 1));
+			const gu::uint32 absValue = value < 0 ? 0u - static_cast<gu::uint32>(value) : static_cast<gu::uint32>(value);
+			const float      x        = static_cast<float>(value) * table.NormalW[layer];
+
+			// inside the rectangle (about 99 %)
+			if (absValue < table.NormalK[layer]) { return x; }
+
+			// tail (Marsaglia 1964)
+			if (layer == 0)
+			{
+				float tailX = 0.0f;
+				float tailY = 0.0f;
+				do
+				{
+					tailX = -std::log(ToOpenFloat(words.Next())) / tail;
+					tailY = -std::log(ToOpenFloat(words.Next()));
+				} while (tailY + tailY < tailX * tailX);
+				return value > 0 ? tail + tailX : -tail - tailX;
+			}
+
+			// wedge
+			const float f = table.NormalF[layer] + ToOpenFloat(words.Next()) * (table.NormalF[layer - 1] - table.NormalF[layer]);
+			if (f < std::exp(-0.5f * x * x)) { return x; }
+		}
+	}
+
+	float SampleExponential(const ZigguratTable& table, WordBuffer& words) noexcept
+	{
+		constexpr float tail = static_cast<float>(ZigguratTable::EXPONENTIAL_TAIL);
+
+		for (;;)
+		{
+			const gu::uint32 word  = words.Next();
+			const gu::uint32 layer = word & (ZigguratTable::EXPONENTIAL_LAYER_COUNT - 1);
+			const gu::uint32 value = word & ~(ZigguratTable::EXPONENTIAL_LAYER_COUNT - 1);
+			const float      x     = static_cast<float>(value) * table.ExponentialW[layer];
+
+			if (value < table.ExponentialK[layer]) { return x; }
+
+			// the tail of the exponential is the shifted exponential
+			if (layer == 0) { return tail - std::log(ToOpenFloat(words.Next())); }
+
+			const float f = table.ExponentialF[layer] + ToOpenFloat(words.Next()) * (table.ExponentialF[layer - 1] - table.ExponentialF[layer]);
+			if (f < std::exp(-x)) { return x; }
+		}
+	}
+#pragma endregion Ziggurat
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+/****************************************************************************
+*                       GenerateRandomSeed
+*************************************************************************//**
+*  @fn        gu::uint64 gm::GenerateRandomSeed()
+*  @brief     The random device is read once, later calls mix the counter by SplitMix64
+*  @param[in] void
+*  @return    gu::uint64
+*****************************************************************************/
+gu::uint64 gm::GenerateRandomSeed()
+{
+	static const gu::uint64 base = []()
+	{
+		std::random_device device;
+		return (static_cast<gu::uint64>(device()) << 32) ^ device();
+	}();
+
+	static std::atomic<gu::uint64> counter = 0;
+	return SplitMix64(base + counter.fetch_add(0x9e3779b97f4a7c15ull, std::memory_order_relaxed)).Next();
+}
+
+#pragma region Xoshiro256StarStar
+void Xoshiro256StarStar::Jump() noexcept
+{
+	ApplyJump(XOSHIRO256_JUMP);
+}
+
+void Xoshiro256StarStar::LongJump() noexcept
+{
+	ApplyJump(XOSHIRO256_LONG_JUMP);
+}
+
+/****************************************************************************
+*                       ApplyJump
+*************************************************************************//**
+*  @fn        void Xoshiro256StarStar::ApplyJump(const gu::uint64 (&polynomial)[4]) noexcept
+*  @brief     Multiply the state by the jump polynomial (x^(2^n) mod the characteristic polynomial)
+*  @param[in] const gu::uint64 (&polynomial)[4]
+*  @return    void
+*****************************************************************************/
+void Xoshiro256StarStar::ApplyJump(const gu::uint64 (&polynomial)[4]) noexcept
+{
+	gu::uint64 state[4] = {};
+	for (const auto word : polynomial)
+	{
+		for (int bit = 0; bit < 64; ++bit)
+		{
+			if (word & (1ull << bit))
+			{
+				for (int i = 0; i < 4; ++i) { state[i] ^= _state[i]; }
+			}
+			Next();
+		}
+	}
+	for (int i = 0; i < 4; ++i) { _state[i] = state[i]; }
+}
+#pragma endregion Xoshiro256StarStar
+
+#pragma region PCG32
+/****************************************************************************
+*                       Advance
+*************************************************************************//**
+*  @fn        void PCG32::Advance(gu::uint64 delta) noexcept
+*  @brief     Jump ahead of the LCG by the binary exponentiation (Brown 1994)
+*  @param[in] gu::uint64 delta
+*  @return    void
+*****************************************************************************/
+void PCG32::Advance(gu::uint64 delta) noexcept
+{
+	gu::uint64 currentMultiplier = MULTIPLIER;
+	gu::uint64 currentIncrement  = _increment;
+	gu::uint64 multiplier        = 1;
+	gu::uint64 increment         = 0;
+
+	while (delta > 0)
+	{
+		if (delta & 1)
+		{
+			multiplier *= currentMultiplier;
+			increment   = increment * currentMultiplier + currentIncrement;
+		}
+		currentIncrement   = (currentMultiplier + 1) * currentIncrement;
+		currentMultiplier *= currentMultiplier;
+		delta >>= 1;
+	}
+	_state = multiplier * _state + increment;
+}
+#pragma endregion PCG32
+
+#pragma region DiscreteDistribution
+/****************************************************************************
+*                       SetWeights
+*************************************************************************//**
+*  @fn        void DiscreteDistribution::SetWeights(const float* weights, const gu::uint32 count)
+*  @brief     Build the alias table by Vose's method
+*  @param[in] const float* weights
+*  @param[in] const gu::uint32 count
+*  @return    void
+*****************************************************************************/
+void DiscreteDistribution::SetWeights(const float* weights, const gu::uint32 count)
+{
+	_thresholds.Clear();
+	_aliases   .Clear();
+	if (weights == nullptr || count == 0) { return; }
+
+	/*-------------------------------------------------------------------
+	-   Every column keeps itself by default
+	---------------------------------------------------------------------*/
+	_thresholds.Resize(count, true, 0xffffffffu);
+	_aliases   .Resize(count, true, 0u);
+	for (gu::uint32 i = 0; i < count; ++i) { _aliases[i] = i; }
+
+	double sum = 0.0;
+	for (gu::uint32 i = 0; i < count; ++i) { sum += weights[i] > 0.0f ? weights[i] : 0.0f; }
+	if (sum <= 0.0) { return; }
+
+	/*-------------------------------------------------------------------
+	-   Scale the mean to 1 and pair the small columns with the large ones
+	---------------------------------------------------------------------*/
+	gu::DynamicArray<double>     scaled(count, 0.0);
+	gu::DynamicArray<gu::uint32> smallColumns;
+	gu::DynamicArray<gu::uint32> largeColumns;
+	smallColumns.Reserve(count);
+	largeColumns.Reserve(count);
+
+	for (gu::uint32 i = 0; i < count; ++i)
+	{
+		scaled[i] = (weights[i] > 0.0f ? weights[i] : 0.0f) * count / sum;
+		if (scaled[i] < 1.0) { smallColumns.Push(i); }
+		else                 { largeColumns.Push(i); }
+	}
+
+	while (!smallColumns.IsEmpty() && !largeColumns.IsEmpty())
+	{
+		const auto smallIndex = smallColumns.Back(); smallColumns.Pop();
+		const auto largeIndex = largeColumns.Back(); largeColumns.Pop();
+
+		_thresholds[smallIndex] = static_cast<gu::uint32>(scaled[smallIndex] * 4294967296.0);
+		_aliases   [smallIndex] = largeIndex;
+
+		scaled[largeIndex] = (scaled[largeIndex] + scaled[smallIndex]) - 1.0;
+		if (scaled[largeIndex] < 1.0) { smallColumns.Push(largeIndex); }
+		else                          { largeColumns.Push(largeIndex); }
+	}
+	// The rest is 1 except for the rounding error and keeps the default (always itself)
+}
+#pragma endregion DiscreteDistribution
+
+#pragma region RandomStream
+/****************************************************************************
+*                       Seed
+*************************************************************************//**
+*  @fn        void RandomStream::Seed(const gu::uint64 seed) noexcept
+*  @brief     Lane 0 is seeded by SplitMix64, lane i is lane i - 1 jumped 2^64 steps.
+*  @param[in] const gu::uint64 seed
+*  @return    void
+*****************************************************************************/
+void RandomStream::Seed(const gu::uint64 seed) noexcept
+{
+	SplitMix64 splitMix(seed);
+	const auto low  = splitMix.Next();
+	const auto high = splitMix.Next();
+
+	_state[0][0] = static_cast<gu::uint32>(low);
+	_state[1][0] = static_cast<gu::uint32>(low >> 32);
+	_state[2][0] = static_cast<gu::uint32>(high);
+	_state[3][0] = static_cast<gu::uint32>(high >> 32);
+	if ((low | high) == 0) { _state[0][0] = 1; } // the all zero state is the fixed point
+
+	for (gu::uint32 lane = 1; lane < LANE_COUNT; ++lane)
+	{
+		for (int i = 0; i < 4; ++i) { _state[i][lane] = _state[i][lane - 1]; }
+		ApplyJump(lane, XOSHIRO128_JUMP);
+	}
+}
+
+RandomStream RandomStream::Split() noexcept
+{
+	const auto result = *this;
+	for (gu::uint32 lane = 0; lane < LANE_COUNT; ++lane)
+	{
+		ApplyJump(lane, XOSHIRO128_LONG_JUMP);
+	}
+	return result;
+}
+
+void RandomStream::NextBlock(gu::uint32* output) noexcept
+{
+	FillUInt32(output, LANE_COUNT);
+}
+
+void RandomStream::FillUInt32(gu::uint32* output, const gu::uint64 count) noexcept
+{
+	FillLanes(_state, output, count, [](gu::uint32* out, const Lanes::Block& words) { Lanes::StoreUInt32(out, words); });
+}
+
+void RandomStream::FillFloat(float* output, const gu::uint64 count, const float min, const float max) noexcept
+{
+	const float scale = (max - min) * (1.0f / 16777216.0f);
+	FillLanes(_state, output, count, [scale, min](float* out, const Lanes::Block& words) { Lanes::StoreFloat(out, words, scale, min); });
+}
+
+void RandomStream::FillInt(gu::int32* output, const gu::uint64 count, const gu::int32 min, const gu::int32 max) noexcept
+{
+	if (max <= min)
+	{
+		for (gu::uint64 i = 0; i < count; ++i) { output[i] = min; }
+		return;
+	}
+
+	// range == 0 is the full 32 bit range
+	const auto range = static_cast<gu::uint32>(static_cast<gu::int64>(max) - min + 1);
+	if (range == 0)
+	{
+		FillUInt32(reinterpret_cast<gu::uint32*>(output), count);
+		return;
+	}
+
+	FillLanes(_state, output, count, [range, min](gu::int32* out, const Lanes::Block& words) { Lanes::StoreInt(out, words, range, min); });
+}
+
+void RandomStream::FillNormal(float* output, const gu::uint64 count, const float mean, const float standardDeviation) noexcept
+{
+	const auto& table = ZigguratTable::Get();
+	WordBuffer words(*this);
+
+	for (gu::uint64 i = 0; i < count; ++i)
+	{
+		output[i] = mean + standardDeviation * SampleNormal(table, words);
+	}
+}
+
+void RandomStream::FillExponential(float* output, const gu::uint64 count, const float lambda) noexcept
+{
+	const auto& table = ZigguratTable::Get();
+	const float scale = 1.0f / lambda;
+	WordBuffer words(*this);
+
+	for (gu::uint64 i = 0; i < count; ++i)
+	{
+		output[i] = SampleExponential(table, words) * scale;
+	}
+}
+
+void RandomStream::FillDiscrete(gu::uint32* output, const gu::uint64 count, const DiscreteDistribution& distribution) noexcept
+{
+	if (distribution.IsEmpty()) { return; }
+
+	FillUInt32(output, count);
+	for (gu::uint64 i = 0; i < count; ++i)
+	{
+		output[i] = distribution.Sample(output[i]);
+	}
+}
+
+/****************************************************************************
+*                       ApplyJump
+*************************************************************************//**
+*  @fn        void RandomStream::ApplyJump(const gu::uint32 lane, const gu::uint32 (&polynomial)[4]) noexcept
+*  @brief     Jump one lane by the xoshiro128 jump polynomial
+*  @param[in] const gu::uint32 lane
+*  @param[in] const gu::uint32 (&polynomial)[4]
+*  @return    void
+*****************************************************************************/
+void RandomStream::ApplyJump(const gu::uint32 lane, const gu::uint32 (&polynomial)[4]) noexcept
+{
+	gu::uint32 s0 = _state[0][lane], s1 = _state[1][lane], s2 = _state[2][lane], s3 = _state[3][lane];
+	gu::uint32 j0 = 0, j1 = 0, j2 = 0, j3 = 0;
+
+	for (const auto word : polynomial)
+	{
+		for (int bit = 0; bit < 32; ++bit)
+		{
+			if (word & (1u << bit))
+			{
+				j0 ^= s0; j1 ^= s1; j2 ^= s2; j3 ^= s3;
+			}
+			StepLane(s0, s1, s2, s3);
+		}
+	}
+
+	_state[0][lane] = j0;
+	_state[1][lane] = j1;
+	_state[2][lane] = j2;
+	_state[3][lane] = j3;
+}
+#pragma endregion RandomStream
@@ -120,6 +120,13 @@ namespace gu
 		template<class ElementType>
 		static void ForceExecuteMoveAssignOperators(ElementType* destination, const ElementType* source, const uint64 count);
 
+		/*---------------------------------------------------------------
+			@brief :  source̗vf𖢏̈destinationֈړ, source̎I܂. 
+			          ̈̏dȂ͋܂. IS_TRIVIALLY_RELOCATABLEłmemmovê݂ōs܂.
+		-----------------------------------------------------------------*/
+		template<class ElementType>
+		static void ForceExecuteRelocateConstructors(ElementType* destination, ElementType* source, const uint64 count);
+
 #pragma endregion Force Class Function
 		/****************************************************************************
 		**                Public Member Variables
@@ -162,7 +169,7 @@ namespace gu
 	{
 		if constexpr (type::HAS_TRIVIAL_CONSTRUCTOR<ElementType>)
 		{
-			Memory::Set(address, 0, sizeof(ElementType) * count)
+			Memory::Set(address, 0, sizeof(ElementType) * count);
 		}
 		else 
 		{
@@ -222,7 +229,7 @@ namespace gu
 	{
 		if constexpr (type::HAS_TRIVIAL_ASSIGN_OPERATOR<ElementType>)
 		{
-			Memory::Copy(destination, source, sizeof(ElementType) * count)
+			Memory::Copy(destination, source, sizeof(ElementType) * count);
 		}
 		else
 		{
@@ -273,11 +280,11 @@ namespace gu
 		@brief :  IɃ[u
 	-----------------------------------------------------------------*/
 	template<class ElementType>
-	static void Memory::ForceExecuteMoveConstructors(ElementType* destination, const ElementType* source, const uint64 count)
+	void Memory::ForceExecuteMoveConstructors(ElementType* destination, const ElementType* source, const uint64 count)
 	{
 		if constexpr (type::HAS_TRIVIAL_COPY_CONSTRUCTOR<ElementType>) // [u̔肪Ȃ
 		{
-			Memory::Move(destination, move, sizeof(ElementType) * count)
+			Memory::Move(destination, source, sizeof(ElementType) * count);
 		}
 		else
 		{
@@ -295,11 +302,11 @@ namespace gu
 		@brief :  IɃ[u
 	-----------------------------------------------------------------*/
 	template<class ElementType>
-	static void Memory::ForceExecuteMoveAssignOperators(ElementType* destination, const ElementType* source, const uint64 count)
+	void Memory::ForceExecuteMoveAssignOperators(ElementType* destination, const ElementType* source, const uint64 count)
 	{
 		if constexpr (type::HAS_TRIVIAL_ASSIGN_OPERATOR<ElementType>) // [u̔肪Ȃ
 		{
-			Memory::Move(destination, move, sizeof(ElementType) * count)
+			Memory::Move(destination, source, sizeof(ElementType) * count);
 		}
 		else
 		{
@@ -312,6 +319,54 @@ namespace gu
 			}
 		}
 	}
+
+	/****************************************************************************
+	*                    ForceExecuteRelocateConstructors
+	*************************************************************************//**
+	*  @fn       @void Memory::ForceExecuteRelocateConstructors(ElementType* destination, ElementType* source, const uint64 count)
+	*
+	*  @brief     source̗vf𖢏̈destinationֈړ, sourcẽfXgN^Ăяo܂.
+	*             IS_TRIVIALLY_RELOCATABLEȌ^memmoveōς܂, ȊO̓[uRXgN^ + fXgN^1vfړ܂.
+	*             Oɋl߂ꍇƌɂ炷ꍇ̗ŗ̈悪dȂĂĂ肠܂.
+	*
+	*  @param[in] ElementType* ړ (̈)
+	*  @param[in] ElementType* ړ (ړ͖̈ƂĈ܂)
+	*  @param[in] uint64 z̃TCY
+	*
+	*  @return @@void
+	*****************************************************************************/
+	template<class ElementType>
+	void Memory::ForceExecuteRelocateConstructors(ElementType* destination, ElementType* source, const uint64 count)
+	{
+		if (count == 0 || destination == source) { return; }
+
+		if constexpr (type::IS_TRIVIALLY_RELOCATABLE<ElementType>)
+		{
+			Memory::Move(destination, source, sizeof(ElementType) * count);
+		}
+		else
+		{
+			using DestructItemsElementType = ElementType;
+
+			// ɂ炷ꍇ͏dȂvfɏ㏑Ȃ悤ɖړ
+			if (destination > source)
+			{
+				for (uint64 i = count; i > 0; --i)
+				{
+					new (destination + i - 1) ElementType((ElementType&&)source[i - 1]);
+					source[i - 1].DestructItemsElementType::~DestructItemsElementType();
+				}
+			}
+			else
+			{
+				for (uint64 i = 0; i < count; ++i)
+				{
+					new (destination + i) ElementType((ElementType&&)source[i]);
+					source[i].DestructItemsElementType::~DestructItemsElementType();
+				}
+			}
+		}
+	}
 #pragma endregion Implement
 }
 
@@ -0,0 +1,264 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GUMemoryTracker.hpp
+///             @brief  Opt-in allocation tracker.
+///                     gu::Memory and the global operator new report every allocation here.
+///                     While the tracking is enabled, the live bytes / counts and the peak are kept per tag,
+///                     the allocation count is kept per frame, the live allocations can be reported
+///                     at shutdown, and the binary trace stream with the sampled call stacks can be written.
+///                     While the tracking is disabled, each allocation costs one relaxed atomic load.
+///                     GU_MEMORY_TRACKING_ENABLED = 0 removes the hooks completely.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GU_MEMORY_TRACKER_HPP
+#define GU_MEMORY_TRACKER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             HowTo
+//////////////////////////////////////////////////////////////////////////////////
+// gu::MemoryTracker::Instance().Enable({ .TraceFilePath = SP("Memory.gumt"), .StackSampleRate = 64 });
+// {
+//     GU_MEMORY_TAG_SCOPE(gu::MemoryTag::Model); // allocations of this thread are tagged as Model
+//     model.Load(path);
+// }
+// gu::MemoryTracker::Instance().EndFrame();
+// gu::MemoryTracker::Instance().ReportLiveAllocations(stdout);
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/Base/Include/GUType.hpp"
+#include <atomic>
+#include <cstdio>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+#ifndef GU_MEMORY_TRACKING_ENABLED
+#define GU_MEMORY_TRACKING_ENABLED (1)
+#endif
+
+// Replace the global operator new / delete so that std containers, std::make_shared and raw new are tracked.
+#ifndef GU_MEMORY_TRACK_GLOBAL_NEW
+#define GU_MEMORY_TRACK_GLOBAL_NEW GU_MEMORY_TRACKING_ENABLED
+#endif
+
+#if GU_MEMORY_TRACKING_ENABLED
+	#define GU_MEMORY_TAG_SCOPE(tag) const gu::MemoryTagScope GU_MEMORY_TAG_CONCAT(_memoryTagScope, __LINE__)(tag)
+	#define GU_MEMORY_TAG_CONCAT_INNER(a, b) a##b
+	#define GU_MEMORY_TAG_CONCAT(a, b) GU_MEMORY_TAG_CONCAT_INNER(a, b)
+
+	#define GU_MEMORY_TRACK_ALLOCATE(pointer, byteLength) \
+		do { if (gu::MemoryTracker::IsTracking()) { gu::MemoryTracker::Instance().OnAllocate(pointer, byteLength); } } while (0)
+	#define GU_MEMORY_TRACK_FREE(pointer) \
+		do { if (gu::MemoryTracker::HasTrackedAllocation()) { gu::MemoryTracker::Instance().OnFree(pointer); } } while (0)
+	#define GU_MEMORY_END_FRAME() \
+		do { if (gu::MemoryTracker::HasTrackedAllocation()) { gu::MemoryTracker::Instance().EndFrame(); } } while (0)
+#else
+	#define GU_MEMORY_TAG_SCOPE(tag)                      ((void)0)
+	#define GU_MEMORY_TRACK_ALLOCATE(pointer, byteLength) ((void)0)
+	#define GU_MEMORY_TRACK_FREE(pointer)                 ((void)0)
+	#define GU_MEMORY_END_FRAME()                         ((void)0)
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gu
+{
+	/****************************************************************************
+	*				  			   MemoryTag
+	*************************************************************************//**
+	*  @enum      MemoryTag
+	*  @brief     Subsystem owning the allocation. Set by GU_MEMORY_TAG_SCOPE for the current thread.
+	*****************************************************************************/
+	enum class MemoryTag : uint8
+	{
+		Untagged,
+		Engine,
+		Graphics,
+		Texture,
+		Model,
+		Animation,
+		GLTF,
+		Audio,
+		UI,
+		Physics,
+		Scene,
+		CountOf
+	};
+
+	/****************************************************************************
+	*				  			MemoryTrackerSetting
+	*************************************************************************//**
+	*  @struct    MemoryTrackerSetting
+	*  @brief     Option of MemoryTracker::Enable
+	*****************************************************************************/
+	struct MemoryTrackerSetting
+	{
+		/* @brief : Binary trace file (nullptr : no trace). The layout is described in GUMemoryTracker.cpp*/
+		const tchar* TraceFilePath = nullptr;
+
+		/* @brief : Capture the call stack of every N-th allocation (0 : no call stack)*/
+		uint32 StackSampleRate = 0;
+	};
+
+	/****************************************************************************
+	*				  			MemoryTagStatistics
+	*************************************************************************//**
+	*  @struct    MemoryTagStatistics
+	*  @brief     Snapshot of the tag. (The allocations before Enable are not counted)
+	*****************************************************************************/
+	struct MemoryTagStatistics
+	{
+		MemoryTag Tag = MemoryTag::Untagged;
+
+		uint64 LiveBytes  = 0;
+		uint64 LiveCount  = 0;
+		uint64 PeakBytes  = 0;
+
+		/* @brief : Total allocation count since Enable*/
+		uint64 TotalCount = 0;
+
+		/* @brief : Allocation count in the last finished frame*/
+		uint64 LastFrameCount = 0;
+	};
+
+	/****************************************************************************
+	*				  			   MemoryTracker
+	*************************************************************************//**
+	*  @class     MemoryTracker
+	*  @brief     Keep the live allocation table and the per tag counters.
+	*             The counters are lock free. The live table is sharded by the address and each shard has the lock.
+	*             The allocations of the tracker itself are not tracked (thread local reentrant guard).
+	*****************************************************************************/
+	class MemoryTracker
+	{
+	public:
+		/****************************************************************************
+		**                Static Function
+		*****************************************************************************/
+		static MemoryTracker& Instance();
+
+		/* @brief : true : the allocation is recorded*/
+		__forceinline static bool IsTracking() noexcept { return _isTracking.load(std::memory_order_relaxed); }
+
+		/* @brief : true : the tracking has been enabled once, so the free must be looked up*/
+		__forceinline static bool HasTrackedAllocation() noexcept { return _hasTrackedAllocation.load(std::memory_order_relaxed); }
+
+		static const char* GetTagName(const MemoryTag tag);
+
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Start the tracking. Return false if the trace file cannot be opened (the tracking still starts).*/
+		bool Enable(const MemoryTrackerSetting& setting = {});
+
+		/* @brief : Stop recording the new allocations. The tracked allocations are still removed when freed.*/
+		void Disable();
+
+		/* @brief : Close the per frame counters and write the frame marker to the trace*/
+		void EndFrame();
+
+		/* @brief : Write the per tag summary and the largest live allocations (with the sampled call stacks)*/
+		void ReportLiveAllocations(FILE* file, const uint32 maxAllocationCount = 32) const;
+
+		void OnAllocate(void* pointer, const uint64 byteLength);
+
+		void OnFree(void* pointer);
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		MemoryTagStatistics GetTagStatistics(const MemoryTag tag) const;
+
+		uint64 GetLiveBytes() const noexcept { return _liveBytes.load(std::memory_order_relaxed); }
+
+		uint64 GetPeakBytes() const noexcept { return _peakBytes.load(std::memory_order_relaxed); }
+
+		uint64 GetLastFrameAllocationCount() const noexcept { return _lastFrameAllocationCount; }
+
+		uint64 GetLastFrameAllocationBytes() const noexcept { return _lastFrameAllocationBytes; }
+
+		uint64 GetFrameIndex() const noexcept { return _frameIndex.load(std::memory_order_relaxed); }
+
+		/* @brief : Current tag of this thread*/
+		static MemoryTag GetCurrentTag() noexcept { return _currentTag; }
+
+	private:
+		friend class MemoryTagScope;
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		MemoryTracker();
+
+		~MemoryTracker() = default;
+
+		MemoryTracker(const MemoryTracker&) = delete;
+		MemoryTracker& operator=(const MemoryTracker&) = delete;
+
+		/****************************************************************************
+		**                Private Member Variables
+		*****************************************************************************/
+		static constexpr uint32 TAG_COUNT = static_cast<uint32>(MemoryTag::CountOf);
+
+		struct TagCounter
+		{
+			std::atomic<uint64> LiveBytes  = 0;
+			std::atomic<uint64> LiveCount  = 0;
+			std::atomic<uint64> PeakBytes  = 0;
+			std::atomic<uint64> TotalCount = 0;
+			std::atomic<uint64> FrameCount = 0;
+			uint64 LastFrameCount = 0;
+		};
+
+		struct Implement;
+
+		Implement* _implement = nullptr;
+
+		TagCounter _tagCounters[TAG_COUNT] = {};
+
+		std::atomic<uint64> _liveBytes  = 0;
+		std::atomic<uint64> _peakBytes  = 0;
+		std::atomic<uint64> _frameIndex = 0;
+		std::atomic<uint64> _frameAllocationCount = 0;
+		std::atomic<uint64> _frameAllocationBytes = 0;
+		std::atomic<uint64> _allocationIndex      = 0;
+
+		uint64 _lastFrameAllocationCount = 0;
+		uint64 _lastFrameAllocationBytes = 0;
+
+		uint32 _stackSampleRate = 0;
+
+		static inline std::atomic<bool> _isTracking           = false;
+		static inline std::atomic<bool> _hasTrackedAllocation = false;
+
+		static inline thread_local MemoryTag _currentTag = MemoryTag::Untagged;
+	};
+
+	/****************************************************************************
+	*				  			   MemoryTagScope
+	*************************************************************************//**
+	*  @class     MemoryTagScope
+	*  @brief     Set the tag of the current thread until the end of the scope. (Use GU_MEMORY_TAG_SCOPE)
+	*****************************************************************************/
+	class MemoryTagScope
+	{
+	public:
+		explicit MemoryTagScope(const MemoryTag tag) noexcept : _previousTag(MemoryTracker::_currentTag)
+		{
+			MemoryTracker::_currentTag = tag;
+		}
+
+		~MemoryTagScope() { MemoryTracker::_currentTag = _previousTag; }
+
+		MemoryTagScope(const MemoryTagScope&) = delete;
+		MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+
+	private:
+		MemoryTag _previousTag = MemoryTag::Untagged;
+	};
+}
+
+#endif
@@ -0,0 +1,305 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GUOffsetAllocator.hpp
+///             @brief  Allocators handing out offsets into a memory range owned by someone else.
+///                     They never touch the memory, so they are used for GPU heaps, descriptor ranges and so on.
+///                     TLSFAllocator      : general purpose, O(1) allocate / free with low fragmentation
+///                     BuddyAllocator     : power of two blocks, O(log n) and no external fragmentation build up
+///                     LinearAllocator    : bump pointer, freed all at once by Reset (per frame data)
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GU_OFFSET_ALLOCATOR_HPP
+#define GU_OFFSET_ALLOCATOR_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/Base/Include/GUClassUtility.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gu
+{
+	/****************************************************************************
+	*				  			OffsetAllocation
+	*************************************************************************//**
+	*  @struct    OffsetAllocation
+	*  @brief     Result of the offset allocators. Pass it back to Free as it is.
+	*****************************************************************************/
+	struct OffsetAllocation
+	{
+		static constexpr uint64 INVALID_OFFSET   = static_cast<uint64>(-1);
+		static constexpr uint32 INVALID_METADATA = static_cast<uint32>(-1);
+
+		/* @brief : Byte offset from the beginning of the range*/
+		uint64 Offset = INVALID_OFFSET;
+
+		/* @brief : Reserved byte size (rounded up by the allocator)*/
+		uint64 Size = 0;
+
+		/* @brief : Allocator specific value (TLSF : node index, Buddy : order)*/
+		uint32 Metadata = INVALID_METADATA;
+
+		bool IsValid() const noexcept { return Offset != INVALID_OFFSET; }
+	};
+
+	/****************************************************************************
+	*				  			OffsetAllocatorStatistics
+	*************************************************************************//**
+	*  @struct    OffsetAllocatorStatistics
+	*  @brief     Usage snapshot of the offset allocator
+	*****************************************************************************/
+	struct OffsetAllocatorStatistics
+	{
+		uint64 Capacity        = 0;
+		uint64 UsedSize        = 0;
+		uint64 FreeSize        = 0;
+		uint64 LargestFreeSize = 0;
+		uint32 AllocationCount = 0;
+		uint32 FreeRegionCount = 0;
+
+		/* @brief : 0 : all free bytes are contiguous, 1 : the free bytes are scattered into small pieces*/
+		float GetFragmentation() const noexcept
+		{
+			return FreeSize == 0 ? 0.0f : 1.0f - static_cast<float>(static_cast<double>(LargestFreeSize) / static_cast<double>(FreeSize));
+		}
+
+		/* @brief : UsedSize / Capacity*/
+		float GetUtilization() const noexcept
+		{
+			return Capacity == 0 ? 0.0f : static_cast<float>(static_cast<double>(UsedSize) / static_cast<double>(Capacity));
+		}
+	};
+
+	/****************************************************************************
+	*				  			   TLSFAllocator
+	*************************************************************************//**
+	*  @class     TLSFAllocator
+	*  @brief     Two-Level Segregated Fit allocator.
+	*             The free regions are kept in the lists indexed by (log2(size), 32 linear subdivisions),
+	*             and two bitmaps find the smallest non-empty list in constant time.
+	*             All sizes and offsets are multiples of the granularity.
+	*****************************************************************************/
+	class TLSFAllocator : public NonCopyable
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Reserve the range. alignment must be the power of two. Return the invalid allocation if no region fits.*/
+		OffsetAllocation Allocate(const uint64 byteSize, const uint64 alignment = 1);
+
+		/* @brief : Return the range and merge it with the free neighbours*/
+		void Free(const OffsetAllocation& allocation);
+
+		/* @brief : Free all allocations at once*/
+		void Reset();
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		OffsetAllocatorStatistics GetStatistics() const;
+
+		uint64 GetCapacity() const noexcept { return _capacity; }
+
+		uint64 GetUsedSize() const noexcept { return _usedSize; }
+
+		uint64 GetGranularity() const noexcept { return _granularity; }
+
+		uint32 GetAllocationCount() const noexcept { return _allocationCount; }
+
+		bool IsEmpty() const noexcept { return _allocationCount == 0; }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		TLSFAllocator() = default;
+
+		/* @brief : capacity is rounded down to the granularity. granularity must be the power of two.*/
+		explicit TLSFAllocator(const uint64 capacity, const uint64 granularity = 1);
+
+	private:
+		/****************************************************************************
+		**                Private Function
+		*****************************************************************************/
+		struct Node
+		{
+			uint64 Offset       = 0;
+			uint64 Size         = 0;
+			uint32 PrevPhysical = INVALID_NODE;
+			uint32 NextPhysical = INVALID_NODE;
+			uint32 PrevFree     = INVALID_NODE;
+			uint32 NextFree     = INVALID_NODE;
+			bool   IsFree       = false;
+		};
+
+		uint32 CreateNode(const uint64 offset, const uint64 size);
+
+		void ReleaseNode(const uint32 nodeIndex);
+
+		void InsertFreeNode(const uint32 nodeIndex);
+
+		void RemoveFreeNode(const uint32 nodeIndex);
+
+		uint32 FindFreeNode(const uint64 byteSize, const uint64 alignment) const;
+
+		static void MapSize(const uint64 byteSize, uint32& firstLevel, uint32& secondLevel);
+
+		/****************************************************************************
+		**                Private Member Variables
+		*****************************************************************************/
+		static constexpr uint32 INVALID_NODE       = static_cast<uint32>(-1);
+		static constexpr uint32 SECOND_LEVEL_LOG2  = 5;
+		static constexpr uint32 SECOND_LEVEL_COUNT = 1u << SECOND_LEVEL_LOG2;
+		static constexpr uint32 FIRST_LEVEL_COUNT  = 64 - SECOND_LEVEL_LOG2 + 1;
+
+		DynamicArray<Node>   _nodes       = {};
+		DynamicArray<uint32> _unusedNodes = {};
+
+		uint64 _firstLevelBitmap = 0;
+		uint32 _secondLevelBitmaps[FIRST_LEVEL_COUNT] = {};
+		uint32 _freeHeads[FIRST_LEVEL_COUNT][SECOND_LEVEL_COUNT] = {};
+
+		uint64 _capacity    = 0;
+		uint64 _granularity = 1;
+		uint64 _usedSize    = 0;
+
+		uint32 _allocationCount = 0;
+		uint32 _freeNodeCount   = 0;
+	};
+
+	/****************************************************************************
+	*				  			   BuddyAllocator
+	*************************************************************************//**
+	*  @class     BuddyAllocator
+	*  @brief     Binary buddy allocator. Every block is a power of two multiple of the min block size
+	*             and is aligned to its own size. Freed blocks are merged with their buddy immediately.
+	*             Suited to the render targets, which are large and are recreated together on resize.
+	*****************************************************************************/
+	class BuddyAllocator : public NonCopyable
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Reserve the smallest power of two block holding byteSize (alignment up to the block size is free)*/
+		OffsetAllocation Allocate(const uint64 byteSize, const uint64 alignment = 1);
+
+		void Free(const OffsetAllocation& allocation);
+
+		void Reset();
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		OffsetAllocatorStatistics GetStatistics() const;
+
+		uint64 GetCapacity() const noexcept { return _minBlockSize << _maxOrder; }
+
+		uint64 GetUsedSize() const noexcept { return _usedSize; }
+
+		uint64 GetMinBlockSize() const noexcept { return _minBlockSize; }
+
+		uint32 GetAllocationCount() const noexcept { return _allocationCount; }
+
+		bool IsEmpty() const noexcept { return _allocationCount == 0; }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		BuddyAllocator() = default;
+
+		/* @brief : capacity is rounded down to the power of two. minBlockSize must be the power of two.*/
+		BuddyAllocator(const uint64 capacity, const uint64 minBlockSize);
+
+	private:
+		/****************************************************************************
+		**                Private Function
+		*****************************************************************************/
+		bool IsFreeBlock(const uint32 order, const uint64 blockIndex) const;
+
+		void SetFreeBlock(const uint32 order, const uint64 blockIndex, const bool isFree);
+
+		/****************************************************************************
+		**                Private Member Variables
+		*****************************************************************************/
+		static constexpr uint32 MAX_ORDER_COUNT = 48;
+
+		/* @brief : One bit per block of each order (1 : free)*/
+		DynamicArray<uint64> _freeBits[MAX_ORDER_COUNT] = {};
+
+		uint32 _freeCounts[MAX_ORDER_COUNT] = {};
+
+		uint64 _minBlockSize    = 0;
+		uint32 _minBlockLog2    = 0;
+		uint32 _maxOrder        = 0;
+		uint64 _usedSize        = 0;
+		uint32 _allocationCount = 0;
+	};
+
+	/****************************************************************************
+	*				  			   LinearAllocator
+	*************************************************************************//**
+	*  @class     LinearAllocator
+	*  @brief     Bump pointer allocator. Individual allocations cannot be freed, Reset frees everything.
+	*****************************************************************************/
+	class LinearAllocator
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : alignment must be the power of two*/
+		OffsetAllocation Allocate(const uint64 byteSize, const uint64 alignment = 1) noexcept
+		{
+			const uint64 offset = (_offset + alignment - 1) & ~(alignment - 1);
+			if (offset > _capacity || byteSize > _capacity - offset) { return OffsetAllocation(); }
+
+			_offset = offset + byteSize;
+			_allocationCount++;
+			return OffsetAllocation{ offset, byteSize, 0 };
+		}
+
+		void Reset() noexcept { _offset = 0; _allocationCount = 0; }
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		OffsetAllocatorStatistics GetStatistics() const noexcept
+		{
+			return OffsetAllocatorStatistics{ _capacity, _offset, _capacity - _offset, _capacity - _offset, _allocationCount, _offset < _capacity ? 1u : 0u };
+		}
+
+		uint64 GetCapacity() const noexcept { return _capacity; }
+
+		uint64 GetUsedSize() const noexcept { return _offset; }
+
+		uint32 GetAllocationCount() const noexcept { return _allocationCount; }
+
+		bool IsEmpty() const noexcept { return _allocationCount == 0; }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		LinearAllocator() = default;
+
+		explicit LinearAllocator(const uint64 capacity) noexcept : _capacity(capacity) {}
+
+	private:
+		/****************************************************************************
+		**                Private Member Variables
+		*****************************************************************************/
+		uint64 _capacity        = 0;
+		uint64 _offset          = 0;
+		uint32 _allocationCount = 0;
+	};
+}
+
+#endif
@@ -9,6 +9,7 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include "../Include/GUMemory.hpp"
+#include "../Include/GUMemoryTracker.hpp"
 #include <string.h>
 #include <malloc.h>
 //////////////////////////////////////////////////////////////////////////////////
@@ -77,28 +78,43 @@ bool Memory::IsZero(const void* pointer, const uint64 byteLength)
 	return true;
 }
 
+/*---------------------------------------------------------------
+	@brief :  mۂƉMemoryTrackerɒʒm܂ (gbLOatomic load̂)
+-----------------------------------------------------------------*/
 void* Memory::Allocate(const uint64 byteLength)
 {
-	return ::malloc(byteLength);
+	void* pointer = ::malloc(byteLength);
+	GU_MEMORY_TRACK_ALLOCATE(pointer, byteLength);
+	return pointer;
 }
 
 void* Memory::Reallocate(void* pointer, const uint64 byteLength)
 {
-	return realloc(pointer, byteLength);
+	// ꂽAhX͑Xbhőɍėpꂤ邽, realloc̑Oɉʒm܂.
+	// (sŎsꍇ, ̗̈̓gbLOΏۊOɂȂ܂)
+	GU_MEMORY_TRACK_FREE(pointer);
+
+	void* newPointer = realloc(pointer, byteLength);
+	GU_MEMORY_TRACK_ALLOCATE(newPointer, byteLength);
+	return newPointer;
 }
 
 void* Memory::AllocateAligned(const uint64 byteLength, const uint64 alignment)
 {
-	return ::_aligned_malloc(byteLength, alignment);
+	void* pointer = ::_aligned_malloc(byteLength, alignment);
+	GU_MEMORY_TRACK_ALLOCATE(pointer, byteLength);
+	return pointer;
 }
 
 void Memory::Free(void* pointer)
 {
+	GU_MEMORY_TRACK_FREE(pointer);
 	::free(pointer);
 }
 
 void Memory::FreeAligned(void* pointer)
 {
+	GU_MEMORY_TRACK_FREE(pointer);
 	::_aligned_free(pointer);
 }
 #pragma endregion Main Function
\ No newline at end of file
@@ -0,0 +1,718 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GUMemoryTracker.cpp
+///             @brief  Opt-in allocation tracker
+///                     Binary trace layout (little endian)
+///                       header : char[4] "GUMT", uint32 version
+///                       record : TraceRecord (40 byte)
+///                                Allocate / Free / Frame : one record
+///                                CallStack : one record (Size = frame count) + uint64 x frame count
+///                                Module    : one record (Address = base address of the executable for symbolization)
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/GUMemoryTracker.hpp"
+#include "GameUtility/File/Include/FileSystem.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#if defined(_WIN32)
+#include <Windows.h>
+#include <malloc.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace gu;
+
+namespace
+{
+	constexpr uint32 SHARD_COUNT_SHIFT = 6;
+	constexpr uint32 SHARD_COUNT       = 1 << SHARD_COUNT_SHIFT;
+	constexpr uint32 MAX_STACK_DEPTH   = 32;
+	constexpr uint32 TRACE_VERSION     = 1;
+	constexpr uint64 TRACE_BUFFER_SIZE = 64 * 1024;
+
+	/*-------------------------------------------------------------------
+	-             Live allocation
+	---------------------------------------------------------------------*/
+	struct AllocationRecord
+	{
+		uint64    ByteLength = 0;
+		uint64    FrameIndex = 0;
+		uint32    StackID    = 0; // 0 : not sampled
+		MemoryTag Tag        = MemoryTag::Untagged;
+	};
+
+	struct alignas(64) AllocationShard
+	{
+		std::mutex Mutex;
+		std::unordered_map<const void*, AllocationRecord> Records = {};
+	};
+
+	struct CallStack
+	{
+		uint32 Count = 0;
+		void*  Frames[MAX_STACK_DEPTH] = {};
+	};
+
+	/*-------------------------------------------------------------------
+	-             Binary trace record
+	---------------------------------------------------------------------*/
+	enum class TraceRecordType : uint8
+	{
+		Allocate  = 1,
+		Free      = 2,
+		CallStack = 3,
+		Frame     = 4,
+		Module    = 5,
+	};
+
+	struct TraceRecord
+	{
+		TraceRecordType Type     = TraceRecordType::Allocate;
+		MemoryTag       Tag      = MemoryTag::Untagged;
+		uint16          Reserved = 0;
+		uint32          ThreadID = 0;
+		uint64          Nanoseconds = 0;
+		uint64          Address  = 0;
+		uint64          Size     = 0;
+		uint32          StackID  = 0;
+		uint32          Reserved2 = 0;
+	};
+	static_assert(sizeof(TraceRecord) == 40, "trace record layout must be fixed");
+
+	/* @brief : true while the tracker itself is allocating (the allocation is not tracked)*/
+	thread_local bool t_isInsideTracker = false;
+
+	std::atomic<uint32> g_nextThreadID = 1;
+	thread_local uint32 t_threadID     = 0;
+
+	/****************************************************************************
+	*				  			ReentrantGuard
+	*************************************************************************//**
+	*  @class     ReentrantGuard
+	*  @brief     Skip the hooks called from the tracker (the map nodes use the global new)
+	*****************************************************************************/
+	struct ReentrantGuard
+	{
+		ReentrantGuard() : IsOutermost(!t_isInsideTracker) { t_isInsideTracker = true; }
+		~ReentrantGuard() { if (IsOutermost) { t_isInsideTracker = false; } }
+
+		const bool IsOutermost;
+	};
+
+	uint32 GetShardIndex(const void* pointer)
+	{
+		const uint64 value = reinterpret_cast<uint64>(pointer) * 0x9E3779B97F4A7C15ULL;
+		return static_cast<uint32>(value >> (64 - SHARD_COUNT_SHIFT));
+	}
+
+	uint32 GetThreadID()
+	{
+		if (t_threadID == 0) { t_threadID = g_nextThreadID.fetch_add(1, std::memory_order_relaxed); }
+		return t_threadID;
+	}
+
+	uint64 GetNanoseconds()
+	{
+		return static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+	}
+
+	void UpdatePeak(std::atomic<uint64>& peak, const uint64 value)
+	{
+		uint64 current = peak.load(std::memory_order_relaxed);
+		while (current < value && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+	}
+
+	/*-------------------------------------------------------------------
+	-   Call stack of the caller (skip the tracker frames)
+	---------------------------------------------------------------------*/
+	uint32 CaptureCallStack(CallStack& stack)
+	{
+	#if defined(_WIN32)
+		stack.Count = ::RtlCaptureStackBackTrace(3, MAX_STACK_DEPTH, stack.Frames, nullptr);
+	#else
+		stack.Count = 0;
+	#endif
+		return stack.Count;
+	}
+
+	constexpr const char* TAG_NAMES[] =
+	{
+		"Untagged", "Engine", "Graphics", "Texture", "Model", "Animation", "GLTF", "Audio", "UI", "Physics", "Scene"
+	};
+	static_assert(sizeof(TAG_NAMES) / sizeof(TAG_NAMES[0]) == static_cast<size_t>(MemoryTag::CountOf), "TAG_NAMES must match MemoryTag");
+}
+
+/****************************************************************************
+*				  			MemoryTracker::Implement
+*************************************************************************//**
+*  @struct    MemoryTracker::Implement
+*  @brief     Live allocation table, call stack table and trace stream
+*****************************************************************************/
+struct MemoryTracker::Implement
+{
+	AllocationShard Shards[SHARD_COUNT];
+
+	/*-------------------------------------------------------------------
+	-   Sampled call stacks (id = index + 1)
+	---------------------------------------------------------------------*/
+	mutable std::mutex StackMutex;
+	std::unordered_map<uint64, uint32> StackIDs = {};
+	std::vector<CallStack> Stacks = {};
+
+	/*-------------------------------------------------------------------
+	-   Trace stream
+	---------------------------------------------------------------------*/
+	std::mutex TraceMutex;
+	FILE* TraceFile = nullptr;
+	std::vector<uint8> TraceBuffer = {};
+
+	/* @brief : true while the trace file is open (the record is not built without the trace)*/
+	std::atomic<bool> IsTraceOpen = false;
+
+	void WriteTrace(const void* data, const uint64 byteLength)
+	{
+		if (TraceBuffer.size() + byteLength > TRACE_BUFFER_SIZE) { FlushTrace(); }
+
+		const auto bytes = static_cast<const uint8*>(data);
+		TraceBuffer.insert(TraceBuffer.end(), bytes, bytes + byteLength);
+	}
+
+	void WriteTraceRecord(const TraceRecord& record)
+	{
+		std::scoped_lock lock(TraceMutex);
+		if (TraceFile == nullptr) { return; }
+		WriteTrace(&record, sizeof(record));
+	}
+
+	void FlushTrace()
+	{
+		if (TraceFile == nullptr || TraceBuffer.empty()) { return; }
+		std::fwrite(TraceBuffer.data(), 1, TraceBuffer.size(), TraceFile);
+		TraceBuffer.clear();
+	}
+
+	/*-------------------------------------------------------------------
+	-   Register the call stack and return the id. The new stack is written to the trace.
+	---------------------------------------------------------------------*/
+	uint32 RegisterCallStack(const CallStack& stack)
+	{
+		if (stack.Count == 0) { return 0; }
+
+		uint64 hash = 14695981039346656037ULL;
+		for (uint32 i = 0; i < stack.Count; ++i)
+		{
+			hash = (hash ^ reinterpret_cast<uint64>(stack.Frames[i])) * 1099511628211ULL;
+		}
+
+		uint32 id = 0;
+		{
+			std::scoped_lock lock(StackMutex);
+			const auto found = StackIDs.find(hash);
+			if (found != StackIDs.end()) { return found->second; }
+
+			Stacks.push_back(stack);
+			id = static_cast<uint32>(Stacks.size());
+			StackIDs.emplace(hash, id);
+		}
+
+		std::scoped_lock lock(TraceMutex);
+		if (TraceFile == nullptr) { return id; }
+
+		TraceRecord record = {};
+		record.Type    = TraceRecordType::CallStack;
+		record.StackID = id;
+		record.Size    = stack.Count;
+		WriteTrace(&record, sizeof(record));
+		for (uint32 i = 0; i < stack.Count; ++i)
+		{
+			const uint64 address = reinterpret_cast<uint64>(stack.Frames[i]);
+			WriteTrace(&address, sizeof(address));
+		}
+		return id;
+	}
+};
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+MemoryTracker::MemoryTracker()
+{
+	ReentrantGuard guard;
+	_implement = new Implement();
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Static Function
+/****************************************************************************
+*                       Instance
+*************************************************************************//**
+*  @fn        MemoryTracker& MemoryTracker::Instance()
+*
+*  @brief     Return the tracker. It is never destroyed because the static objects are freed after main.
+*
+*  @param[in] void
+*
+*  @return    MemoryTracker&
+*****************************************************************************/
+MemoryTracker& MemoryTracker::Instance()
+{
+	static MemoryTracker* tracker = [] { ReentrantGuard guard; return new MemoryTracker(); }();
+	return *tracker;
+}
+
+const char* MemoryTracker::GetTagName(const MemoryTag tag)
+{
+	return static_cast<uint32>(tag) < TAG_COUNT ? TAG_NAMES[static_cast<uint32>(tag)] : "Unknown";
+}
+#pragma endregion Static Function
+
+#pragma region Public Function
+/****************************************************************************
+*                       Enable
+*************************************************************************//**
+*  @fn        bool MemoryTracker::Enable(const MemoryTrackerSetting& setting)
+*
+*  @brief     Start the tracking. Call it once at the start up before the worker threads allocate.
+*
+*  @param[in] const MemoryTrackerSetting& setting
+*
+*  @return    bool (false : the trace file cannot be opened)
+*****************************************************************************/
+bool MemoryTracker::Enable(const MemoryTrackerSetting& setting)
+{
+	if (IsTracking()) { return true; }
+
+	bool result = true;
+	{
+		ReentrantGuard guard;
+
+		_stackSampleRate = setting.StackSampleRate;
+
+		if (setting.TraceFilePath != nullptr)
+		{
+			const std::basic_string<tchar> tracePath(setting.TraceFilePath);
+			const std::wstring path(tracePath.begin(), tracePath.end());
+
+			std::scoped_lock lock(_implement->TraceMutex);
+			_implement->TraceFile = file::FileSystem::OpenFile(path, "wb");
+			result = _implement->TraceFile != nullptr;
+
+			if (_implement->TraceFile)
+			{
+				_implement->TraceBuffer.reserve(TRACE_BUFFER_SIZE);
+
+				const char   magic[4] = { 'G', 'U', 'M', 'T' };
+				const uint32 version  = TRACE_VERSION;
+				_implement->WriteTrace(magic, sizeof(magic));
+				_implement->WriteTrace(&version, sizeof(version));
+
+				TraceRecord module = {};
+				module.Type        = TraceRecordType::Module;
+				module.Nanoseconds = GetNanoseconds();
+			#if defined(_WIN32)
+				module.Address     = reinterpret_cast<uint64>(::GetModuleHandleW(nullptr));
+			#endif
+				_implement->WriteTrace(&module, sizeof(module));
+				_implement->IsTraceOpen.store(true, std::memory_order_release);
+			}
+		}
+	}
+
+	_hasTrackedAllocation.store(true, std::memory_order_release);
+	_isTracking.store(true, std::memory_order_release);
+	return result;
+}
+
+/****************************************************************************
+*                       Disable
+*************************************************************************//**
+*  @fn        void MemoryTracker::Disable()
+*
+*  @brief     Stop recording the new allocations and close the trace stream.
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
+void MemoryTracker::Disable()
+{
+	_isTracking.store(false, std::memory_order_release);
+
+	ReentrantGuard guard;
+	std::scoped_lock lock(_implement->TraceMutex);
+	if (_implement->TraceFile)
+	{
+		_implement->IsTraceOpen.store(false, std::memory_order_release);
+		_implement->FlushTrace();
+		std::fclose(_implement->TraceFile);
+		_implement->TraceFile = nullptr;
+	}
+}
+
+/****************************************************************************
+*                       EndFrame
+*************************************************************************//**
+*  @fn        void MemoryTracker::EndFrame()
+*
+*  @brief     Close the per frame allocation counters.
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
+void MemoryTracker::EndFrame()
+{
+	ReentrantGuard guard;
+
+	for (auto& counter : _tagCounters)
+	{
+		counter.LastFrameCount = counter.FrameCount.exchange(0, std::memory_order_relaxed);
+	}
+	_lastFrameAllocationCount = _frameAllocationCount.exchange(0, std::memory_order_relaxed);
+	_lastFrameAllocationBytes = _frameAllocationBytes.exchange(0, std::memory_order_relaxed);
+
+	TraceRecord record = {};
+	record.Type        = TraceRecordType::Frame;
+	record.ThreadID    = GetThreadID();
+	record.Nanoseconds = GetNanoseconds();
+	record.Size        = _frameIndex.fetch_add(1, std::memory_order_relaxed);
+	_implement->WriteTraceRecord(record);
+}
+
+/****************************************************************************
+*                       OnAllocate
+*************************************************************************//**
+*  @fn        void MemoryTracker::OnAllocate(void* pointer, const uint64 byteLength)
+*
+*  @brief     Record the allocation with the tag of the current thread.
+*
+*  @param[in] void* pointer
+*  @param[in] const uint64 byteLength
+*
+*  @return    void
+*****************************************************************************/
+void MemoryTracker::OnAllocate(void* pointer, const uint64 byteLength)
+{
+	if (pointer == nullptr || t_isInsideTracker) { return; }
+
+	ReentrantGuard guard;
+
+	const auto tag = _currentTag;
+	auto& counter  = _tagCounters[static_cast<uint32>(tag)];
+
+	/*-------------------------------------------------------------------
+	-   Sample the call stack
+	---------------------------------------------------------------------*/
+	uint32 stackID = 0;
+	if (_stackSampleRate != 0 && _allocationIndex.fetch_add(1, std::memory_order_relaxed) % _stackSampleRate == 0)
+	{
+		CallStack stack = {};
+		CaptureCallStack(stack);
+		stackID = _implement->RegisterCallStack(stack);
+	}
+
+	/*-------------------------------------------------------------------
+	-   Live table
+	---------------------------------------------------------------------*/
+	const AllocationRecord record = { byteLength, _frameIndex.load(std::memory_order_relaxed), stackID, tag };
+	AllocationRecord replaced = {};
+	bool hasReplaced = false;
+	{
+		auto& shard = _implement->Shards[GetShardIndex(pointer)];
+		std::scoped_lock lock(shard.Mutex);
+
+		auto [iterator, isInserted] = shard.Records.try_emplace(pointer, record);
+		if (!isInserted)
+		{
+			// The previous owner of the address was freed through the path not tracked.
+			replaced    = iterator->second;
+			hasReplaced = true;
+			iterator->second = record;
+		}
+	}
+
+	if (hasReplaced)
+	{
+		auto& replacedCounter = _tagCounters[static_cast<uint32>(replaced.Tag)];
+		replacedCounter.LiveBytes.fetch_sub(replaced.ByteLength, std::memory_order_relaxed);
+		replacedCounter.LiveCount.fetch_sub(1, std::memory_order_relaxed);
+		_liveBytes.fetch_sub(replaced.ByteLength, std::memory_order_relaxed);
+	}
+
+	/*-------------------------------------------------------------------
+	-   Counters
+	---------------------------------------------------------------------*/
+	UpdatePeak(counter.PeakBytes, counter.LiveBytes.fetch_add(byteLength, std::memory_order_relaxed) + byteLength);
+	counter.LiveCount .fetch_add(1, std::memory_order_relaxed);
+	counter.TotalCount.fetch_add(1, std::memory_order_relaxed);
+	counter.FrameCount.fetch_add(1, std::memory_order_relaxed);
+
+	UpdatePeak(_peakBytes, _liveBytes.fetch_add(byteLength, std::memory_order_relaxed) + byteLength);
+	_frameAllocationCount.fetch_add(1, std::memory_order_relaxed);
+	_frameAllocationBytes.fetch_add(byteLength, std::memory_order_relaxed);
+
+	/*-------------------------------------------------------------------
+	-   Trace
+	---------------------------------------------------------------------*/
+	if (!_implement->IsTraceOpen.load(std::memory_order_relaxed)) { return; }
+
+	TraceRecord traceRecord = {};
+	traceRecord.Type        = TraceRecordType::Allocate;
+	traceRecord.Tag         = tag;
+	traceRecord.ThreadID    = GetThreadID();
+	traceRecord.Nanoseconds = GetNanoseconds();
+	traceRecord.Address     = reinterpret_cast<uint64>(pointer);
+	traceRecord.Size        = byteLength;
+	traceRecord.StackID     = stackID;
+	_implement->WriteTraceRecord(traceRecord);
+}
+
+/****************************************************************************
+*                       OnFree
+*************************************************************************//**
+*  @fn        void MemoryTracker::OnFree(void* pointer)
+*
+*  @brief     Remove the allocation. The pointer allocated before Enable is ignored.
+*
+*  @param[in] void* pointer
+*
+*  @return    void
+*****************************************************************************/
+void MemoryTracker::OnFree(void* pointer)
+{
+	if (pointer == nullptr || t_isInsideTracker) { return; }
+
+	ReentrantGuard guard;
+
+	AllocationRecord record = {};
+	{
+		auto& shard = _implement->Shards[GetShardIndex(pointer)];
+		std::scoped_lock lock(shard.Mutex);
+
+		const auto found = shard.Records.find(pointer);
+		if (found == shard.Records.end()) { return; }
+
+		record = found->second;
+		shard.Records.erase(found);
+	}
+
+	auto& counter = _tagCounters[static_cast<uint32>(record.Tag)];
+	counter.LiveBytes.fetch_sub(record.ByteLength, std::memory_order_relaxed);
+	counter.LiveCount.fetch_sub(1, std::memory_order_relaxed);
+	_liveBytes.fetch_sub(record.ByteLength, std::memory_order_relaxed);
+
+	if (!_implement->IsTraceOpen.load(std::memory_order_relaxed)) { return; }
+
+	TraceRecord traceRecord = {};
+	traceRecord.Type        = TraceRecordType::Free;
+	traceRecord.Tag         = record.Tag;
+	traceRecord.ThreadID    = GetThreadID();
+	traceRecord.Nanoseconds = GetNanoseconds();
+	traceRecord.Address     = reinterpret_cast<uint64>(pointer);
+	traceRecord.Size        = record.ByteLength;
+	_implement->WriteTraceRecord(traceRecord);
+}
+
+/****************************************************************************
+*                       ReportLiveAllocations
+*************************************************************************//**
+*  @fn        void MemoryTracker::ReportLiveAllocations(FILE* file, const uint32 maxAllocationCount) const
+*
+*  @brief     Write the per tag summary and the largest live allocations.
+*             Called at shutdown, the remaining allocations are the leak candidates.
+*             The call stack addresses are symbolized offline with the module base address in the trace.
+*
+*  @param[in] FILE* file
+*  @param[in] const uint32 maxAllocationCount
+*
+*  @return    void
+*****************************************************************************/
+void MemoryTracker::ReportLiveAllocations(FILE* file, const uint32 maxAllocationCount) const
+{
+	if (file == nullptr) { return; }
+
+	ReentrantGuard guard;
+
+	/*-------------------------------------------------------------------
+	-   Per tag summary
+	---------------------------------------------------------------------*/
+	std::fprintf(file, "[MemoryTracker] live %llu bytes, peak %llu bytes, frame %llu\n",
+		GetLiveBytes(), GetPeakBytes(), GetFrameIndex());
+	std::fprintf(file, "  %-10s %14s %10s %14s %12s\n", "Tag", "LiveBytes", "LiveCount", "PeakBytes", "TotalCount");
+
+	for (uint32 i = 0; i < TAG_COUNT; ++i)
+	{
+		const auto statistics = GetTagStatistics(static_cast<MemoryTag>(i));
+		if (statistics.TotalCount == 0) { continue; }
+
+		std::fprintf(file, "  %-10s %14llu %10llu %14llu %12llu\n", GetTagName(statistics.Tag),
+			statistics.LiveBytes, statistics.LiveCount, statistics.PeakBytes, statistics.TotalCount);
+	}
+
+	/*-------------------------------------------------------------------
+	-   Largest live allocations
+	---------------------------------------------------------------------*/
+	std::vector<std::pair<const void*, AllocationRecord>> records;
+	for (auto& shard : _implement->Shards)
+	{
+		std::scoped_lock lock(shard.Mutex);
+		records.insert(records.end(), shard.Records.begin(), shard.Records.end());
+	}
+
+	const auto count = std::min<uint64>(records.size(), maxAllocationCount);
+	std::partial_sort(records.begin(), records.begin() + count, records.end(),
+		[](const auto& left, const auto& right) { return left.second.ByteLength > right.second.ByteLength; });
+
+	std::fprintf(file, "  %llu live allocations (largest %llu)\n", static_cast<uint64>(records.size()), count);
+
+	std::scoped_lock lock(_implement->StackMutex);
+	for (uint64 i = 0; i < count; ++i)
+	{
+		const auto& [pointer, record] = records[i];
+		std::fprintf(file, "  %p %12llu bytes  %-10s frame %llu\n", pointer, record.ByteLength, GetTagName(record.Tag), record.FrameIndex);
+
+		if (record.StackID == 0 || record.StackID > _implement->Stacks.size()) { continue; }
+
+		const auto& stack = _implement->Stacks[record.StackID - 1];
+		for (uint32 frame = 0; frame < stack.Count; ++frame)
+		{
+			std::fprintf(file, "      #%02u %p\n", frame, stack.Frames[frame]);
+		}
+	}
+	std::fflush(file);
+}
+#pragma endregion Public Function
+
+#pragma region Public Member Variables
+MemoryTagStatistics MemoryTracker::GetTagStatistics(const MemoryTag tag) const
+{
+	const auto& counter = _tagCounters[static_cast<uint32>(tag)];
+
+	MemoryTagStatistics statistics = {};
+	statistics.Tag            = tag;
+	statistics.LiveBytes      = counter.LiveBytes .load(std::memory_order_relaxed);
+	statistics.LiveCount      = counter.LiveCount .load(std::memory_order_relaxed);
+	statistics.PeakBytes      = counter.PeakBytes .load(std::memory_order_relaxed);
+	statistics.TotalCount     = counter.TotalCount.load(std::memory_order_relaxed);
+	statistics.LastFrameCount = counter.LastFrameCount;
+	return statistics;
+}
+#pragma endregion Public Member Variables
+
+#if GU_MEMORY_TRACKING_ENABLED && GU_MEMORY_TRACK_GLOBAL_NEW
+#pragma region Global Operator New
+/*-------------------------------------------------------------------
+-   Replace the global new / delete. While the tracking is disabled, the cost is one atomic load.
+---------------------------------------------------------------------*/
+namespace
+{
+	void* AllocateForOperatorNew(std::size_t byteLength)
+	{
+		if (byteLength == 0) { byteLength = 1; }
+
+		for (;;)
+		{
+			if (void* pointer = std::malloc(byteLength))
+			{
+				GU_MEMORY_TRACK_ALLOCATE(pointer, byteLength);
+				return pointer;
+			}
+
+			const auto handler = std::get_new_handler();
+			if (handler == nullptr) { throw std::bad_alloc(); }
+			handler();
+		}
+	}
+
+	void* AllocateAlignedForOperatorNew(std::size_t byteLength, const std::align_val_t alignment)
+	{
+		if (byteLength == 0) { byteLength = 1; }
+
+		const auto alignmentValue = static_cast<std::size_t>(alignment);
+		for (;;)
+		{
+		#if defined(_WIN32)
+			void* pointer = ::_aligned_malloc(byteLength, alignmentValue);
+		#else
+			void* pointer = std::aligned_alloc(alignmentValue, (byteLength + alignmentValue - 1) / alignmentValue * alignmentValue);
+		#endif
+			if (pointer)
+			{
+				GU_MEMORY_TRACK_ALLOCATE(pointer, byteLength);
+				return pointer;
+			}
+
+			const auto handler = std::get_new_handler();
+			if (handler == nullptr) { throw std::bad_alloc(); }
+			handler();
+		}
+	}
+
+	void FreeForOperatorDelete(void* pointer) noexcept
+	{
+		GU_MEMORY_TRACK_FREE(pointer);
+		std::free(pointer);
+	}
+
+	void FreeAlignedForOperatorDelete(void* pointer) noexcept
+	{
+		GU_MEMORY_TRACK_FREE(pointer);
+	#if defined(_WIN32)
+		::_aligned_free(pointer);
+	#else
+		std::free(pointer);
+	#endif
+	}
+}
+
+void* operator new  (std::size_t byteLength) { return AllocateForOperatorNew(byteLength); }
+void* operator new[](std::size_t byteLength) { return AllocateForOperatorNew(byteLength); }
+
+void* operator new  (std::size_t byteLength, const std::nothrow_t&) noexcept
+{
+	try { return AllocateForOperatorNew(byteLength); } catch (...) { return nullptr; }
+}
+void* operator new[](std::size_t byteLength, const std::nothrow_t&) noexcept
+{
+	try { return AllocateForOperatorNew(byteLength); } catch (...) { return nullptr; }
+}
+
+void* operator new  (std::size_t byteLength, std::align_val_t alignment) { return AllocateAlignedForOperatorNew(byteLength, alignment); }
+void* operator new[](std::size_t byteLength, std::align_val_t alignment) { return AllocateAlignedForOperatorNew(byteLength, alignment); }
+
+void* operator new  (std::size_t byteLength, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+	try { return AllocateAlignedForOperatorNew(byteLength, alignment); } catch (...) { return nullptr; }
+}
+void* operator new[](std::size_t byteLength, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+	try { return AllocateAlignedForOperatorNew(byteLength, alignment); } catch (...) { return nullptr; }
+}
+
+void operator delete  (void* pointer) noexcept                                     { FreeForOperatorDelete(pointer); }
+void operator delete[](void* pointer) noexcept                                     { FreeForOperatorDelete(pointer); }
+void operator delete  (void* pointer, std::size_t) noexcept                        { FreeForOperatorDelete(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept                        { FreeForOperatorDelete(pointer); }
+void operator delete  (void* pointer, const std::nothrow_t&) noexcept              { FreeForOperatorDelete(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept              { FreeForOperatorDelete(pointer); }
+void operator delete  (void* pointer, std::align_val_t) noexcept                   { FreeAlignedForOperatorDelete(pointer); }
+void operator delete[](void* pointer, std::align_val_t) noexcept                   { FreeAlignedForOperatorDelete(pointer); }
+void operator delete  (void* pointer, std::size_t, std::align_val_t) noexcept      { FreeAlignedForOperatorDelete(pointer); }
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept      { FreeAlignedForOperatorDelete(pointer); }
+void operator delete  (void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { FreeAlignedForOperatorDelete(pointer); }
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { FreeAlignedForOperatorDelete(pointer); }
+#pragma endregion Global Operator New
+#endif
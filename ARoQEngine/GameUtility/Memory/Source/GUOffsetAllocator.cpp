@@ -0,0 +1,556 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GUOffsetAllocator.cpp
+///             @brief  TLSF and buddy offset allocators
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/GUOffsetAllocator.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace gu;
+
+namespace
+{
+	/* @brief : bits must not be 0*/
+	inline uint32 CountTrailingZeros(const uint64 bits)
+	{
+#if defined(_MSC_VER)
+		unsigned long index = 0;
+		_BitScanForward64(&index, bits);
+		return static_cast<uint32>(index);
+#else
+		return static_cast<uint32>(__builtin_ctzll(bits));
+#endif
+	}
+
+	/* @brief : floor(log2(value)). value must not be 0*/
+	inline uint32 FloorLog2(const uint64 value)
+	{
+#if defined(_MSC_VER)
+		unsigned long index = 0;
+		_BitScanReverse64(&index, value);
+		return static_cast<uint32>(index);
+#else
+		return 63u - static_cast<uint32>(__builtin_clzll(value));
+#endif
+	}
+
+	inline bool IsPowerOfTwo(const uint64 value) { return value != 0 && (value & (value - 1)) == 0; }
+
+	inline uint64 AlignUp(const uint64 value, const uint64 alignment) { return (value + alignment - 1) & ~(alignment - 1); }
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          TLSFAllocator
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region TLSF Constructor and Destructor
+TLSFAllocator::TLSFAllocator(const uint64 capacity, const uint64 granularity)
+	: _capacity(capacity & ~(granularity - 1)), _granularity(granularity)
+{
+	Check(IsPowerOfTwo(granularity));
+	Reset();
+}
+#pragma endregion TLSF Constructor and Destructor
+
+#pragma region TLSF Public Function
+/****************************************************************************
+*                       Allocate
+*************************************************************************//**
+*  @fn        OffsetAllocation TLSFAllocator::Allocate(const uint64 byteSize, const uint64 alignment)
+*
+*  @brief     Take the smallest free region which surely holds the request, and split the remainder.
+*             The alignment larger than the granularity is handled by splitting the front padding as the free region.
+*
+*  @param[in] const uint64 byteSize
+*  @param[in] const uint64 alignment (power of two)
+*
+*  @return    OffsetAllocation (invalid : no region fits)
+*****************************************************************************/
+OffsetAllocation TLSFAllocator::Allocate(const uint64 byteSize, const uint64 alignment)
+{
+	Check(IsPowerOfTwo(alignment));
+
+	const uint64 size             = AlignUp(byteSize == 0 ? 1 : byteSize, _granularity);
+	const uint64 requireAlignment = alignment > _granularity ? alignment : _granularity;
+	if (byteSize > _capacity || size > _capacity - _usedSize) { return OffsetAllocation(); }
+
+	const uint32 nodeIndex = FindFreeNode(size, requireAlignment);
+	if (nodeIndex == INVALID_NODE) { return OffsetAllocation(); }
+
+	RemoveFreeNode(nodeIndex);
+
+	/*-------------------------------------------------------------------
+	-   Split the front padding (the offset is aligned to the granularity, so the padding is a valid region)
+	---------------------------------------------------------------------*/
+	const uint64 alignedOffset = AlignUp(_nodes[nodeIndex].Offset, requireAlignment);
+	const uint64 padding       = alignedOffset - _nodes[nodeIndex].Offset;
+	if (padding > 0)
+	{
+		const uint32 paddingIndex = CreateNode(_nodes[nodeIndex].Offset, padding);
+		Node& paddingNode = _nodes[paddingIndex];
+		Node& node        = _nodes[nodeIndex];
+
+		paddingNode.PrevPhysical = node.PrevPhysical;
+		paddingNode.NextPhysical = nodeIndex;
+		if (node.PrevPhysical != INVALID_NODE) { _nodes[node.PrevPhysical].NextPhysical = paddingIndex; }
+		node.PrevPhysical = paddingIndex;
+		node.Offset       = alignedOffset;
+		node.Size        -= padding;
+
+		InsertFreeNode(paddingIndex);
+	}
+
+	/*-------------------------------------------------------------------
+	-   Split the remainder
+	---------------------------------------------------------------------*/
+	if (_nodes[nodeIndex].Size > size)
+	{
+		const uint32 remainIndex = CreateNode(_nodes[nodeIndex].Offset + size, _nodes[nodeIndex].Size - size);
+		Node& remainNode = _nodes[remainIndex];
+		Node& node       = _nodes[nodeIndex];
+
+		remainNode.PrevPhysical = nodeIndex;
+		remainNode.NextPhysical = node.NextPhysical;
+		if (node.NextPhysical != INVALID_NODE) { _nodes[node.NextPhysical].PrevPhysical = remainIndex; }
+		node.NextPhysical = remainIndex;
+		node.Size         = size;
+
+		InsertFreeNode(remainIndex);
+	}
+
+	_usedSize += size;
+	_allocationCount++;
+	return OffsetAllocation{ _nodes[nodeIndex].Offset, size, nodeIndex };
+}
+
+/****************************************************************************
+*                       Free
+*************************************************************************//**
+*  @fn        void TLSFAllocator::Free(const OffsetAllocation& allocation)
+*
+*  @brief     Return the region and merge it with the free physical neighbours.
+*
+*  @param[in] const OffsetAllocation& allocation
+*
+*  @return    void
+*****************************************************************************/
+void TLSFAllocator::Free(const OffsetAllocation& allocation)
+{
+	if (!allocation.IsValid()) { return; }
+
+	uint32 nodeIndex = allocation.Metadata;
+	Check(nodeIndex < _nodes.Size() && !_nodes[nodeIndex].IsFree && _nodes[nodeIndex].Offset == allocation.Offset);
+
+	_usedSize -= _nodes[nodeIndex].Size;
+	_allocationCount--;
+
+	/*-------------------------------------------------------------------
+	-   Merge with the next region
+	---------------------------------------------------------------------*/
+	const uint32 nextIndex = _nodes[nodeIndex].NextPhysical;
+	if (nextIndex != INVALID_NODE && _nodes[nextIndex].IsFree)
+	{
+		RemoveFreeNode(nextIndex);
+
+		Node& node = _nodes[nodeIndex];
+		node.Size        += _nodes[nextIndex].Size;
+		node.NextPhysical = _nodes[nextIndex].NextPhysical;
+		if (node.NextPhysical != INVALID_NODE) { _nodes[node.NextPhysical].PrevPhysical = nodeIndex; }
+
+		ReleaseNode(nextIndex);
+	}
+
+	/*-------------------------------------------------------------------
+	-   Merge with the previous region
+	---------------------------------------------------------------------*/
+	const uint32 prevIndex = _nodes[nodeIndex].PrevPhysical;
+	if (prevIndex != INVALID_NODE && _nodes[prevIndex].IsFree)
+	{
+		RemoveFreeNode(prevIndex);
+
+		Node& prevNode = _nodes[prevIndex];
+		prevNode.Size        += _nodes[nodeIndex].Size;
+		prevNode.NextPhysical = _nodes[nodeIndex].NextPhysical;
+		if (prevNode.NextPhysical != INVALID_NODE) { _nodes[prevNode.NextPhysical].PrevPhysical = prevIndex; }
+
+		ReleaseNode(nodeIndex);
+		nodeIndex = prevIndex;
+	}
+
+	InsertFreeNode(nodeIndex);
+}
+
+/****************************************************************************
+*                       Reset
+*************************************************************************//**
+*  @fn        void TLSFAllocator::Reset()
+*
+*  @brief     Free all allocations. The whole range becomes one free region.
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
+void TLSFAllocator::Reset()
+{
+	_nodes.Clear();
+	_unusedNodes.Clear();
+	_firstLevelBitmap = 0;
+	for (uint32 i = 0; i < FIRST_LEVEL_COUNT; ++i)
+	{
+		_secondLevelBitmaps[i] = 0;
+		for (uint32 j = 0; j < SECOND_LEVEL_COUNT; ++j) { _freeHeads[i][j] = INVALID_NODE; }
+	}
+
+	_usedSize        = 0;
+	_allocationCount = 0;
+	_freeNodeCount   = 0;
+
+	if (_capacity > 0) { InsertFreeNode(CreateNode(0, _capacity)); }
+}
+#pragma endregion TLSF Public Function
+
+#pragma region TLSF Public Member Variables
+OffsetAllocatorStatistics TLSFAllocator::GetStatistics() const
+{
+	OffsetAllocatorStatistics statistics = {};
+	statistics.Capacity        = _capacity;
+	statistics.UsedSize        = _usedSize;
+	statistics.FreeSize        = _capacity - _usedSize;
+	statistics.AllocationCount = _allocationCount;
+	statistics.FreeRegionCount = _freeNodeCount;
+
+	/*-------------------------------------------------------------------
+	-   The largest region is in the highest non-empty list
+	---------------------------------------------------------------------*/
+	if (_firstLevelBitmap != 0)
+	{
+		const uint32 firstLevel  = FloorLog2(_firstLevelBitmap);
+		const uint32 secondLevel = FloorLog2(_secondLevelBitmaps[firstLevel]);
+		for (uint32 index = _freeHeads[firstLevel][secondLevel]; index != INVALID_NODE; index = _nodes[index].NextFree)
+		{
+			if (_nodes[index].Size > statistics.LargestFreeSize) { statistics.LargestFreeSize = _nodes[index].Size; }
+		}
+	}
+	return statistics;
+}
+#pragma endregion TLSF Public Member Variables
+
+#pragma region TLSF Private Function
+uint32 TLSFAllocator::CreateNode(const uint64 offset, const uint64 size)
+{
+	uint32 index = INVALID_NODE;
+	if (!_unusedNodes.IsEmpty())
+	{
+		index = _unusedNodes.Back();
+		_unusedNodes.Pop();
+		_nodes[index] = Node();
+	}
+	else
+	{
+		index = static_cast<uint32>(_nodes.Size());
+		_nodes.Push(Node());
+	}
+
+	_nodes[index].Offset = offset;
+	_nodes[index].Size   = size;
+	return index;
+}
+
+void TLSFAllocator::ReleaseNode(const uint32 nodeIndex)
+{
+	_nodes[nodeIndex].IsFree = false;
+	_unusedNodes.Push(nodeIndex);
+}
+
+/****************************************************************************
+*                       MapSize
+*************************************************************************//**
+*  @fn        void TLSFAllocator::MapSize(const uint64 byteSize, uint32& firstLevel, uint32& secondLevel)
+*
+*  @brief     size < 32 : (0, size), otherwise (log2(size) - 4, next 5 bits below the top bit)
+*
+*  @param[in]  const uint64 byteSize
+*  @param[out] uint32& firstLevel
+*  @param[out] uint32& secondLevel
+*
+*  @return    void
+*****************************************************************************/
+void TLSFAllocator::MapSize(const uint64 byteSize, uint32& firstLevel, uint32& secondLevel)
+{
+	if (byteSize < SECOND_LEVEL_COUNT)
+	{
+		firstLevel  = 0;
+		secondLevel = static_cast<uint32>(byteSize);
+		return;
+	}
+
+	const uint32 log2 = FloorLog2(byteSize);
+	firstLevel  = log2 - SECOND_LEVEL_LOG2 + 1;
+	secondLevel = static_cast<uint32>(byteSize >> (log2 - SECOND_LEVEL_LOG2)) ^ SECOND_LEVEL_COUNT;
+}
+
+void TLSFAllocator::InsertFreeNode(const uint32 nodeIndex)
+{
+	uint32 firstLevel = 0, secondLevel = 0;
+	MapSize(_nodes[nodeIndex].Size, firstLevel, secondLevel);
+
+	const uint32 head = _freeHeads[firstLevel][secondLevel];
+	Node& node = _nodes[nodeIndex];
+	node.IsFree   = true;
+	node.PrevFree = INVALID_NODE;
+	node.NextFree = head;
+	if (head != INVALID_NODE) { _nodes[head].PrevFree = nodeIndex; }
+
+	_freeHeads[firstLevel][secondLevel] = nodeIndex;
+	_secondLevelBitmaps[firstLevel]    |= 1u << secondLevel;
+	_firstLevelBitmap                  |= 1ull << firstLevel;
+	_freeNodeCount++;
+}
+
+void TLSFAllocator::RemoveFreeNode(const uint32 nodeIndex)
+{
+	uint32 firstLevel = 0, secondLevel = 0;
+	MapSize(_nodes[nodeIndex].Size, firstLevel, secondLevel);
+
+	Node& node = _nodes[nodeIndex];
+	if (node.PrevFree != INVALID_NODE) { _nodes[node.PrevFree].NextFree = node.NextFree; }
+	else                               { _freeHeads[firstLevel][secondLevel] = node.NextFree; }
+	if (node.NextFree != INVALID_NODE) { _nodes[node.NextFree].PrevFree = node.PrevFree; }
+
+	if (_freeHeads[firstLevel][secondLevel] == INVALID_NODE)
+	{
+		_secondLevelBitmaps[firstLevel] &= ~(1u << secondLevel);
+		if (_secondLevelBitmaps[firstLevel] == 0) { _firstLevelBitmap &= ~(1ull << firstLevel); }
+	}
+
+	node.IsFree   = false;
+	node.PrevFree = INVALID_NODE;
+	node.NextFree = INVALID_NODE;
+	_freeNodeCount--;
+}
+
+/****************************************************************************
+*                       FindFreeNode
+*************************************************************************//**
+*  @fn        uint32 TLSFAllocator::FindFreeNode(const uint64 byteSize, const uint64 alignment) const
+*
+*  @brief     Good fit search. The size is rounded up to the next list, so any region of the found list is large enough.
+*             If no such list exists, the list of the exact size class is scanned as the last resort.
+*
+*  @param[in] const uint64 byteSize (multiple of the granularity)
+*  @param[in] const uint64 alignment (>= granularity)
+*
+*  @return    uint32 node index (INVALID_NODE : not found)
+*****************************************************************************/
+uint32 TLSFAllocator::FindFreeNode(const uint64 byteSize, const uint64 alignment) const
+{
+	const uint64 searchSize = byteSize + (alignment - _granularity);
+
+	/*-------------------------------------------------------------------
+	-   Round up to the next list
+	---------------------------------------------------------------------*/
+	uint64 roundedSize = searchSize;
+	if (searchSize >= SECOND_LEVEL_COUNT)
+	{
+		const uint64 step = 1ull << (FloorLog2(searchSize) - SECOND_LEVEL_LOG2);
+		roundedSize = searchSize + step - 1;
+	}
+
+	uint32 firstLevel = 0, secondLevel = 0;
+	MapSize(roundedSize, firstLevel, secondLevel);
+
+	uint32 secondLevelMap = firstLevel < FIRST_LEVEL_COUNT ? _secondLevelBitmaps[firstLevel] & (~0u << secondLevel) : 0;
+	if (secondLevelMap == 0)
+	{
+		const uint64 firstLevelMap = firstLevel + 1 < 64 ? _firstLevelBitmap & (~0ull << (firstLevel + 1)) : 0;
+		if (firstLevelMap != 0)
+		{
+			firstLevel     = CountTrailingZeros(firstLevelMap);
+			secondLevelMap = _secondLevelBitmaps[firstLevel];
+		}
+	}
+
+	if (secondLevelMap != 0)
+	{
+		return _freeHeads[firstLevel][CountTrailingZeros(secondLevelMap)];
+	}
+
+	/*-------------------------------------------------------------------
+	-   Last resort : the regions in the same list may still fit
+	---------------------------------------------------------------------*/
+	MapSize(byteSize, firstLevel, secondLevel);
+	for (uint32 index = _freeHeads[firstLevel][secondLevel]; index != INVALID_NODE; index = _nodes[index].NextFree)
+	{
+		const Node&  node    = _nodes[index];
+		const uint64 padding = AlignUp(node.Offset, alignment) - node.Offset;
+		if (node.Size >= padding && node.Size - padding >= byteSize) { return index; }
+	}
+	return INVALID_NODE;
+}
+#pragma endregion TLSF Private Function
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          BuddyAllocator
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Buddy Constructor and Destructor
+BuddyAllocator::BuddyAllocator(const uint64 capacity, const uint64 minBlockSize)
+	: _minBlockSize(minBlockSize)
+{
+	Check(IsPowerOfTwo(minBlockSize));
+	Check(capacity >= minBlockSize);
+
+	_minBlockLog2 = FloorLog2(minBlockSize);
+	_maxOrder     = FloorLog2(capacity) - _minBlockLog2;
+	Check(_maxOrder < MAX_ORDER_COUNT);
+
+	for (uint32 order = 0; order <= _maxOrder; ++order)
+	{
+		const uint64 blockCount = 1ull << (_maxOrder - order);
+		_freeBits[order].Resize((blockCount + 63) / 64, true, 0);
+	}
+	Reset();
+}
+#pragma endregion Buddy Constructor and Destructor
+
+#pragma region Buddy Public Function
+/****************************************************************************
+*                       Allocate
+*************************************************************************//**
+*  @fn        OffsetAllocation BuddyAllocator::Allocate(const uint64 byteSize, const uint64 alignment)
+*
+*  @brief     Find the smallest free order that can hold the request and split it down.
+*
+*  @param[in] const uint64 byteSize
+*  @param[in] const uint64 alignment (power of two)
+*
+*  @return    OffsetAllocation (Metadata : order)
+*****************************************************************************/
+OffsetAllocation BuddyAllocator::Allocate(const uint64 byteSize, const uint64 alignment)
+{
+	Check(IsPowerOfTwo(alignment));
+	if (_minBlockSize == 0) { return OffsetAllocation(); }
+
+	const uint64 requireSize = byteSize > alignment ? byteSize : alignment;
+	if (requireSize > GetCapacity()) { return OffsetAllocation(); }
+
+	uint32 order = 0;
+	while ((_minBlockSize << order) < requireSize) { ++order; }
+
+	/*-------------------------------------------------------------------
+	-   Smallest order having the free block
+	---------------------------------------------------------------------*/
+	uint32 foundOrder = order;
+	while (foundOrder <= _maxOrder && _freeCounts[foundOrder] == 0) { ++foundOrder; }
+	if (foundOrder > _maxOrder) { return OffsetAllocation(); }
+
+	uint64 blockIndex = 0;
+	const auto& bits = _freeBits[foundOrder];
+	for (uint64 word = 0; word < bits.Size(); ++word)
+	{
+		if (bits[word] != 0) { blockIndex = word * 64 + CountTrailingZeros(bits[word]); break; }
+	}
+	SetFreeBlock(foundOrder, blockIndex, false);
+
+	/*-------------------------------------------------------------------
+	-   Split : keep the left half, the right half becomes free
+	---------------------------------------------------------------------*/
+	while (foundOrder > order)
+	{
+		--foundOrder;
+		blockIndex <<= 1;
+		SetFreeBlock(foundOrder, blockIndex | 1, true);
+	}
+
+	const uint64 blockSize = _minBlockSize << order;
+	_usedSize += blockSize;
+	_allocationCount++;
+	return OffsetAllocation{ blockIndex << (_minBlockLog2 + order), blockSize, order };
+}
+
+/****************************************************************************
+*                       Free
+*************************************************************************//**
+*  @fn        void BuddyAllocator::Free(const OffsetAllocation& allocation)
+*
+*  @brief     Return the block and merge it while its buddy is free.
+*
+*  @param[in] const OffsetAllocation& allocation
+*
+*  @return    void
+*****************************************************************************/
+void BuddyAllocator::Free(const OffsetAllocation& allocation)
+{
+	if (!allocation.IsValid()) { return; }
+
+	uint32 order      = allocation.Metadata;
+	uint64 blockIndex = allocation.Offset >> (_minBlockLog2 + order);
+	Check(order <= _maxOrder && !IsFreeBlock(order, blockIndex));
+
+	_usedSize -= _minBlockSize << order;
+	_allocationCount--;
+
+	while (order < _maxOrder && IsFreeBlock(order, blockIndex ^ 1))
+	{
+		SetFreeBlock(order, blockIndex ^ 1, false);
+		blockIndex >>= 1;
+		++order;
+	}
+	SetFreeBlock(order, blockIndex, true);
+}
+
+void BuddyAllocator::Reset()
+{
+	for (uint32 order = 0; order <= _maxOrder && _minBlockSize != 0; ++order)
+	{
+		for (auto& word : _freeBits[order]) { word = 0; }
+		_freeCounts[order] = 0;
+	}
+
+	_usedSize        = 0;
+	_allocationCount = 0;
+	if (_minBlockSize != 0) { SetFreeBlock(_maxOrder, 0, true); }
+}
+#pragma endregion Buddy Public Function
+
+#pragma region Buddy Public Member Variables
+OffsetAllocatorStatistics BuddyAllocator::GetStatistics() const
+{
+	OffsetAllocatorStatistics statistics = {};
+	statistics.Capacity        = GetCapacity();
+	statistics.UsedSize        = _usedSize;
+	statistics.FreeSize        = statistics.Capacity - _usedSize;
+	statistics.AllocationCount = _allocationCount;
+
+	for (uint32 order = 0; order <= _maxOrder && _minBlockSize != 0; ++order)
+	{
+		statistics.FreeRegionCount += _freeCounts[order];
+		if (_freeCounts[order] > 0) { statistics.LargestFreeSize = _minBlockSize << order; }
+	}
+	return statistics;
+}
+#pragma endregion Buddy Public Member Variables
+
+#pragma region Buddy Private Function
+bool BuddyAllocator::IsFreeBlock(const uint32 order, const uint64 blockIndex) const
+{
+	return (_freeBits[order][blockIndex / 64] >> (blockIndex % 64)) & 1;
+}
+
+void BuddyAllocator::SetFreeBlock(const uint32 order, const uint64 blockIndex, const bool isFree)
+{
+	const uint64 mask = 1ull << (blockIndex % 64);
+	if (isFree) { _freeBits[order][blockIndex / 64] |=  mask; _freeCounts[order]++; }
+	else        { _freeBits[order][blockIndex / 64] &= ~mask; _freeCounts[order]--; }
+}
+#pragma endregion Buddy Private Function
@@ -0,0 +1,268 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   FrameUploadAllocator.hpp
+///             @brief  Per-frame linear upload ring for the dynamic constant / vertex data.
+///                     One persistently mapped upload buffer is kept for each frame in flight,
+///                     and the allocation is a bump of the head offset (no Map / Unmap in the frame).
+///             How To: 1. LowLevelGraphicsEngine calls BeginFrame(frameIndex) when the frame index is changed
+///                     2. Allocate(byteSize) and write the data to CPUAddress, then bind Buffer with Offset
+///                     3. LowLevelGraphicsEngine calls EndFrame(fence, fenceValue) after the graphics queue signal
+///                     For the constant buffer updated every frame, use FrameConstantBuffer.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef FRAME_UPLOAD_ALLOCATOR_HPP
+#define FRAME_UPLOAD_ALLOCATOR_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/Base/Include/GUClassUtility.hpp"
+#include "GameUtility/Base/Include/GUSmartPointer.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+#include <mutex>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::core
+{
+	class RHIDevice;
+	class RHIFence;
+	class GPUBuffer;
+	class GPUResourceView;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+class FrameConstantBuffer;
+
+/****************************************************************************
+*				  			   FrameUploadAllocation
+*************************************************************************//**
+*  @struct    FrameUploadAllocation
+*  @brief     The range in the upload ring. It is valid until the same frame index is used again.
+*****************************************************************************/
+struct FrameUploadAllocation
+{
+	/* @brief : Upload buffer including this range*/
+	gu::SharedPointer<rhi::core::GPUBuffer> Buffer = nullptr;
+
+	/* @brief : Byte offset from the head of the buffer*/
+	gu::uint64 Offset = 0;
+
+	/* @brief : Requested byte size*/
+	gu::uint64 Size = 0;
+
+	/* @brief : Mapped CPU address of the range (write only)*/
+	gu::uint8* CPUAddress = nullptr;
+
+	/* @brief : GPU virtual address of the range (0 if the API does not expose it)*/
+	gu::uint64 GPUAddress = 0;
+
+	/* @brief : Frame index used to allocate this range*/
+	gu::uint32 FrameIndex = 0;
+
+	bool IsValid() const noexcept { return CPUAddress != nullptr; }
+};
+
+/****************************************************************************
+*				  			   FrameUploadAllocator
+*************************************************************************//**
+*  @class     FrameUploadAllocator
+*  @brief     Linear allocator over one persistently mapped upload buffer per frame in flight.
+*             The region of the frame is reused after the fence value recorded in EndFrame is completed.
+*             If the region is full, the buffer of the frame is replaced with the twice larger one,
+*             and the old buffer is kept alive until the frame comes back.
+*             Allocate is thread safe.
+*****************************************************************************/
+class FrameUploadAllocator final : public gu::NonCopyable
+{
+protected:
+	using DevicePtr = gu::SharedPointer<rhi::core::RHIDevice>;
+	using FencePtr  = gu::SharedPointer<rhi::core::RHIFence>;
+	using BufferPtr = gu::SharedPointer<rhi::core::GPUBuffer>;
+
+public:
+	/****************************************************************************
+	**                Static Configuration
+	*****************************************************************************/
+	/* @brief : Default alignment. Constant buffer view requires 256 byte alignment in DirectX12.*/
+	static constexpr gu::uint64 DEFAULT_ALIGNMENT = 256;
+
+	static constexpr gu::uint64 DEFAULT_FRAME_BYTE_SIZE = 4 * 1024 * 1024;
+
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	/* @brief : Wait until the GPU has finished the region of the frame, and reset the head.
+	            The registered FrameConstantBuffers are uploaded to the new region.*/
+	void BeginFrame(const gu::uint32 frameIndex);
+
+	/* @brief : Record the fence value signaled after the command lists of the current frame.*/
+	void EndFrame(const FencePtr& fence, const gu::uint64 fenceValue);
+
+	/* @brief : Allocate the range in the current frame region. alignment must be the power of two.*/
+	FrameUploadAllocation Allocate(const gu::uint64 byteSize, const gu::uint64 alignment = DEFAULT_ALIGNMENT);
+
+	/* @brief : Allocate the range and copy the data*/
+	FrameUploadAllocation Upload(const void* data, const gu::uint64 byteSize, const gu::uint64 alignment = DEFAULT_ALIGNMENT);
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+	/* @brief : Statistics of one frame*/
+	struct Statistics
+	{
+		gu::uint32 AllocationCount = 0;
+		gu::uint64 UploadByteSize  = 0; // sum of the requested byte size
+		gu::uint32 GrowCount       = 0; // count of the buffer replacement
+		gu::uint32 MapCount        = 0; // Map call count in the frame (only the buffer replacement maps)
+	};
+
+	/* @brief : Statistics of the last finished frame*/
+	const Statistics& GetLastFrameStatistics() const noexcept { return _lastStatistics; }
+
+	gu::uint32 GetCurrentFrameIndex() const noexcept { return _currentFrameIndex; }
+
+	gu::uint32 GetFrameCount() const noexcept { return static_cast<gu::uint32>(_frames.Size()); }
+
+	/* @brief : Byte size of the current frame region*/
+	gu::uint64 GetFrameByteSize() const noexcept { return _frames[_currentFrameIndex].Capacity; }
+
+	/****************************************************************************
+	**                Constructor and Destructor
+	*****************************************************************************/
+	FrameUploadAllocator() = default;
+
+	FrameUploadAllocator(const DevicePtr& device, const gu::uint32 frameCount, const gu::uint64 frameByteSize = DEFAULT_FRAME_BYTE_SIZE);
+
+	~FrameUploadAllocator();
+
+protected:
+	/****************************************************************************
+	**                Protected Function
+	*****************************************************************************/
+	friend class FrameConstantBuffer;
+
+	void Register  (FrameConstantBuffer* constantBuffer);
+
+	void Unregister(FrameConstantBuffer* constantBuffer);
+
+	std::mutex& GetMutex() noexcept { return _mutex; }
+
+	FrameUploadAllocation AllocateUnlocked(const gu::uint64 byteSize, const gu::uint64 alignment);
+
+	BufferPtr CreateUploadBuffer(const gu::uint64 byteSize, gu::uint8*& cpuAddress);
+
+	/****************************************************************************
+	**                Protected Member Variables
+	*****************************************************************************/
+	struct FrameRegion
+	{
+		BufferPtr  Buffer     = nullptr;
+		gu::uint8* CPUAddress = nullptr;
+		gu::uint64 GPUAddress = 0;
+		gu::uint64 Capacity   = 0;
+		gu::uint64 Head       = 0;
+
+		/* @brief : Fence signaled at the end of the frame which used this region last time*/
+		FencePtr   Fence      = nullptr;
+		gu::uint64 FenceValue = 0;
+
+		/* @brief : Buffers replaced in the frame. Released when the region is reused.*/
+		gu::DynamicArray<BufferPtr> RetiredBuffers = {};
+	};
+
+	DevicePtr _device = nullptr;
+
+	gu::DynamicArray<FrameRegion> _frames = {};
+
+	gu::uint32 _currentFrameIndex = 0;
+
+	gu::DynamicArray<FrameConstantBuffer*> _constantBuffers = {};
+
+	/* @brief : True between EndFrame and BeginFrame. The current region is read by the GPU.*/
+	bool _isFrameSubmitted = false;
+
+	Statistics _statistics     = {};
+	Statistics _lastStatistics = {};
+
+	std::mutex _mutex;
+};
+
+/****************************************************************************
+*				  			   FrameConstantBuffer
+*************************************************************************//**
+*  @class     FrameConstantBuffer
+*  @brief     Constant buffer view whose data is placed in the upload ring.
+*             The CPU copy of the constants is kept, and it is uploaded to the new frame region in BeginFrame,
+*             so SetData writes only the current frame range (no Map / Unmap, no GPU / CPU race).
+*             SetData called after the frame is submitted updates only the CPU copy, which is uploaded in the next BeginFrame.
+*             Element i is placed at i * aligned stride in the range.
+*****************************************************************************/
+class FrameConstantBuffer final : public gu::NonCopyable
+{
+protected:
+	using DevicePtr    = gu::SharedPointer<rhi::core::RHIDevice>;
+	using ViewPtr      = gu::SharedPointer<rhi::core::GPUResourceView>;
+	using AllocatorPtr = gu::SharedPointer<FrameUploadAllocator>;
+
+public:
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	/* @brief : Write the data to the element range. byteOffset is the offset from the element head.*/
+	void SetData(const void* data, const gu::uint64 byteSize, const gu::uint64 elementIndex = 0, const gu::uint64 byteOffset = 0);
+
+	/* @brief : Write the whole elements (elementCount * elementByteSize). The stride of data is elementByteSize.*/
+	void SetElements(const void* data, const gu::uint64 elementCount, const gu::uint64 firstElement = 0);
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+	/* @brief : Constant buffer view of the current frame range*/
+	const ViewPtr& GetView() const noexcept { return _view; }
+
+	gu::uint64 GetElementCount() const noexcept { return _elementCount; }
+
+	/* @brief : Aligned element stride in the range*/
+	gu::uint64 GetElementStride() const noexcept { return _elementStride; }
+
+	/****************************************************************************
+	**                Constructor and Destructor
+	*****************************************************************************/
+	FrameConstantBuffer() = default;
+
+	FrameConstantBuffer(const AllocatorPtr& allocator, const DevicePtr& device, const gu::uint64 elementByteSize, const gu::uint64 elementCount = 1, const void* initData = nullptr);
+
+	~FrameConstantBuffer();
+
+protected:
+	/****************************************************************************
+	**                Protected Function
+	*****************************************************************************/
+	friend class FrameUploadAllocator;
+
+	/* @brief : Upload the CPU copy to the new frame region. The allocator mutex is held by the caller.*/
+	void Upload();
+
+	/****************************************************************************
+	**                Protected Member Variables
+	*****************************************************************************/
+	/* @brief : Held to unregister safely even if the engine is shut down first*/
+	AllocatorPtr _allocator = nullptr;
+
+	ViewPtr _view = nullptr;
+
+	/* @brief : CPU copy of the constants (elementCount * elementStride)*/
+	gu::DynamicArray<gu::uint8> _cpuData = {};
+
+	FrameUploadAllocation _allocation = {};
+
+	gu::uint64 _elementByteSize = 0;
+	gu::uint64 _elementStride   = 0;
+	gu::uint64 _elementCount    = 0;
+};
+#endif
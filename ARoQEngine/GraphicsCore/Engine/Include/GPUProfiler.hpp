@@ -0,0 +1,159 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GPUProfiler.hpp
+///             @brief  GPU zone profiler using the timestamp query heap.
+///                     The GPU timestamps are converted to the CPU clock with the calibration timestamp
+///                     and merged into gu::Profiler, so the CPU and GPU zones are shown on the same timeline.
+///             How To: 1. BeginFrame(commandList) after the command list is opened
+///                     2. GPUProfileScope scope(profiler, commandList, "Shadow"); ...draw...
+///                     3. EndFrame(commandList) before the command list is closed
+///                     4. Collect() after the fence wait of the frame
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GPU_PROFILER_HPP
+#define GPU_PROFILER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIQuery.hpp"
+#include "GameUtility/Base/Include/GUClassUtility.hpp"
+#include "GameUtility/Base/Include/GUSmartPointer.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::core
+{
+	class RHICommandList;
+	class RHICommandQueue;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+/****************************************************************************
+*				  			   GPUProfiler
+*************************************************************************//**
+*  @class     GPUProfiler
+*  @brief     Write the timestamp query at the begin / end of each zone and resolve them at the frame end.
+*             The results are read in Collect, so the frame must be finished on the GPU before Collect
+*             (LowLevelGraphicsEngine waits the fence every frame).
+*             The profiler is disabled when the query heap is not supported (timestamp frequency is 0).
+*****************************************************************************/
+class GPUProfiler final : public gu::NonCopyable
+{
+protected:
+	using CommandListPtr  = gu::SharedPointer<rhi::core::RHICommandList>;
+	using CommandQueuePtr = gu::SharedPointer<rhi::core::RHICommandQueue>;
+	using QueryPtr        = gu::SharedPointer<rhi::core::RHIQuery>;
+
+public:
+	/****************************************************************************
+	**                Static Configuration
+	*****************************************************************************/
+	/* @brief : Max zone count in one frame (including the frame zone)*/
+	static constexpr gu::uint32 MAX_ZONE_COUNT = 256;
+
+	static constexpr gu::uint32 INVALID_ZONE_INDEX = static_cast<gu::uint32>(-1);
+
+	/****************************************************************************
+	**                Public Function
+	*****************************************************************************/
+	/* @brief : Start the frame zone. Call after the command list starts recording.*/
+	void BeginFrame(const CommandListPtr& commandList);
+
+	/* @brief : Finish the frame zone and resolve the timestamps. Call before the command list is closed.*/
+	void EndFrame(const CommandListPtr& commandList);
+
+	/* @brief : Write the begin timestamp. The name must be the string literal. Return INVALID_ZONE_INDEX if the zone is not recorded.*/
+	gu::uint32 BeginZone(const CommandListPtr& commandList, const char* name);
+
+	/* @brief : Write the end timestamp of the zone returned by BeginZone*/
+	void EndZone(const CommandListPtr& commandList, const gu::uint32 zoneIndex);
+
+	/* @brief : Read the resolved timestamps and pass them to gu::Profiler. Call after the GPU has finished the frame.*/
+	void Collect();
+
+	/****************************************************************************
+	**                Public Member Variables
+	*****************************************************************************/
+	bool IsSupported() const noexcept { return _timestampFrequency != 0; }
+
+	/****************************************************************************
+	**                Constructor and Destructor
+	*****************************************************************************/
+	GPUProfiler() = default;
+
+	GPUProfiler(const QueryPtr& timestampQuery, const CommandQueuePtr& commandQueue);
+
+	~GPUProfiler();
+
+protected:
+	/****************************************************************************
+	**                Protected Function
+	*****************************************************************************/
+	struct Zone
+	{
+		const char* Name  = nullptr;
+		gu::uint32  Depth = 0;
+	};
+
+	/****************************************************************************
+	**                Protected Member Variables
+	*****************************************************************************/
+	/* @brief : Timestamp query heap and the queue executing the profiled command list*/
+	QueryPtr        _query        = nullptr;
+	CommandQueuePtr _commandQueue = nullptr;
+
+	/* @brief : Two queries (begin, end) for each zone*/
+	gu::DynamicArray<rhi::core::QueryResultLocation> _locations = {};
+
+	/* @brief : Zones recorded in the current frame*/
+	gu::DynamicArray<Zone> _zones = {};
+
+	/* @brief : true : the query ids are sequential, so the results are resolved by one call*/
+	bool _isSequentialQuery = false;
+
+	/* @brief : true : between BeginFrame and EndFrame (the zones are recorded)*/
+	bool _isFrameActive = false;
+
+	/* @brief : true : the current frame has been resolved and waits for Collect*/
+	bool _hasResolved = false;
+
+	gu::uint32 _frameZoneIndex = INVALID_ZONE_INDEX;
+
+	gu::uint32 _currentDepth = 0;
+
+	gu::uint64 _timestampFrequency = 0;
+};
+
+/****************************************************************************
+*				  			   GPUProfileScope
+*************************************************************************//**
+*  @class     GPUProfileScope
+*  @brief     Record the GPU zone from the constructor to the destructor. (The profiler can be nullptr)
+*****************************************************************************/
+class GPUProfileScope final : public gu::NonCopyable
+{
+public:
+	GPUProfileScope(GPUProfiler* profiler, const gu::SharedPointer<rhi::core::RHICommandList>& commandList, const char* name)
+		: _profiler(profiler), _commandList(commandList)
+	{
+		if (_profiler) { _zoneIndex = _profiler->BeginZone(_commandList, name); }
+	}
+
+	~GPUProfileScope()
+	{
+		if (_profiler) { _profiler->EndZone(_commandList, _zoneIndex); }
+	}
+
+private:
+	GPUProfiler* _profiler = nullptr;
+	gu::SharedPointer<rhi::core::RHICommandList> _commandList = nullptr;
+	gu::uint32 _zoneIndex = GPUProfiler::INVALID_ZONE_INDEX;
+};
+
+#endif
@@ -16,6 +16,8 @@
 //////////////////////////////////////////////////////////////////////////////////
 #include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIDevice.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHICommandList.hpp"
+#include "GraphicsCore/Engine/Include/GPUProfiler.hpp"
+#include "GraphicsCore/Engine/Include/FrameUploadAllocator.hpp"
 
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -129,6 +131,22 @@ public:
 		return _queryHeaps.At(queryType); 
 	}
 
+	/*----------------------------------------------------------------------
+	*  @brief : Graphics command listGPUvԂ܂ (GU_PROFILER_ENABLED = 0, ܂͔Ή̏ꍇnullptr)
+	*----------------------------------------------------------------------*/
+	__forceinline GPUProfiler* GetGPUProfiler() const noexcept
+	{
+		return _gpuProfiler.Get();
+	}
+
+	/*----------------------------------------------------------------------
+	*  @brief : t[XV萔obt@, _f[^p̃t[Pʂ̃Abv[hOԂ܂
+	*----------------------------------------------------------------------*/
+	__forceinline const gu::SharedPointer<FrameUploadAllocator>& GetFrameUploadAllocator() const noexcept
+	{
+		return _frameUploadAllocator;
+	}
+
 	/****************************************************************************
 	**                Constructor and Destructor
 	*****************************************************************************/
@@ -229,6 +247,16 @@ protected:
 	*----------------------------------------------------------------------*/
 	gu::SortedMap<rhi::core::QueryHeapType, gu::SharedPointer<rhi::core::RHIQuery>> _queryHeaps = {};
 
+	/*----------------------------------------------------------------------
+	*  @brief : Graphics command listGPUv. ʂgu::Profilerɓ܂
+	*----------------------------------------------------------------------*/
+	gu::SharedPointer<GPUProfiler> _gpuProfiler = nullptr;
+
+	/*----------------------------------------------------------------------
+	*  @brief : t[Ƃ̃Abv[hO. t[̗̈EndDrawFrameŋL^tFX̊ɍėp܂
+	*----------------------------------------------------------------------*/
+	gu::SharedPointer<FrameUploadAllocator> _frameUploadAllocator = nullptr;
+
 	/****************************************************************************
 	**                Heap Config
 	*****************************************************************************/
@@ -244,6 +272,7 @@ private:
 	void SetUpHeap();
 	void SetUpFence();
 	void SetUpQuery();
+	void SetUpGPUProfiler();
 
 };
 
@@ -0,0 +1,423 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   FrameUploadAllocator.cpp
+///             @brief  Per-frame linear upload ring for the dynamic constant / vertex data.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/Engine/Include/FrameUploadAllocator.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIDevice.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIFence.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUBuffer.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUResourceView.hpp"
+#include "GameUtility/Memory/Include/GUMemory.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::core;
+
+namespace
+{
+	constexpr gu::uint64 AlignUp(const gu::uint64 value, const gu::uint64 alignment)
+	{
+		return (value + alignment - 1) & ~(alignment - 1);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region FrameUploadAllocator
+#pragma region Constructor and Destructor
+FrameUploadAllocator::FrameUploadAllocator(const DevicePtr& device, const gu::uint32 frameCount, const gu::uint64 frameByteSize)
+	: _device(device)
+{
+	Check(_device);
+	Check(frameCount > 0);
+
+	/*-------------------------------------------------------------------
+	-      Map the upload buffer of each frame once
+	---------------------------------------------------------------------*/
+	_frames.Resize(frameCount);
+	for (auto& frame : _frames)
+	{
+		frame.Buffer     = CreateUploadBuffer(AlignUp(frameByteSize, DEFAULT_ALIGNMENT), frame.CPUAddress);
+		frame.GPUAddress = frame.Buffer->GetGPUVirtualAddress();
+		frame.Capacity   = frame.Buffer->GetTotalByteSize();
+	}
+}
+
+FrameUploadAllocator::~FrameUploadAllocator()
+{
+	for (auto& frame : _frames)
+	{
+		for (auto& retired : frame.RetiredBuffers) { retired->CopyEnd(); }
+		if (frame.Buffer) { frame.Buffer->CopyEnd(); }
+	}
+	_frames.Clear();
+	_constantBuffers.Clear();
+}
+
+#pragma endregion Constructor and Destructor
+
+#pragma region Main Function
+/****************************************************************************
+*                     BeginFrame
+*************************************************************************//**
+*  @fn        void FrameUploadAllocator::BeginFrame(const gu::uint32 frameIndex)
+*
+*  @brief     Wait until the GPU has finished the region of the frame, and reset the head.
+*             The registered FrameConstantBuffers are uploaded to the new region.
+*
+*  @param[in] const gu::uint32 frameIndex
+*
+*  @return    void
+*****************************************************************************/
+void FrameUploadAllocator::BeginFrame(const gu::uint32 frameIndex)
+{
+	std::scoped_lock lock(_mutex);
+
+	_lastStatistics = _statistics;
+	_statistics     = {};
+
+	_currentFrameIndex = frameIndex % static_cast<gu::uint32>(_frames.Size());
+	auto& frame = _frames[_currentFrameIndex];
+
+	/*-------------------------------------------------------------------
+	-      Wait the last use of this region
+	---------------------------------------------------------------------*/
+	if (frame.Fence && frame.Fence->GetCompletedValue() < frame.FenceValue)
+	{
+		frame.Fence->Wait(frame.FenceValue);
+	}
+	frame.Fence = nullptr;
+
+	for (auto& retired : frame.RetiredBuffers) { retired->CopyEnd(); }
+	frame.RetiredBuffers.Clear();
+	frame.Head = 0;
+
+	_isFrameSubmitted = false;
+
+	/*-------------------------------------------------------------------
+	-      Upload the constants to the new region
+	---------------------------------------------------------------------*/
+	for (auto constantBuffer : _constantBuffers)
+	{
+		constantBuffer->Upload();
+	}
+}
+
+/****************************************************************************
+*                     EndFrame
+*************************************************************************//**
+*  @fn        void FrameUploadAllocator::EndFrame(const FencePtr& fence, const gu::uint64 fenceValue)
+*
+*  @brief     Record the fence value signaled after the command lists of the current frame.
+*             The fence is held because LowLevelGraphicsEngine may recreate it.
+*
+*  @param[in] const FencePtr& fence
+*  @param[in] const gu::uint64 fenceValue
+*
+*  @return    void
+*****************************************************************************/
+void FrameUploadAllocator::EndFrame(const FencePtr& fence, const gu::uint64 fenceValue)
+{
+	std::scoped_lock lock(_mutex);
+
+	auto& frame = _frames[_currentFrameIndex];
+	frame.Fence      = fence;
+	frame.FenceValue = fenceValue;
+
+	_isFrameSubmitted = true;
+}
+
+/****************************************************************************
+*                     Allocate
+*************************************************************************//**
+*  @fn        FrameUploadAllocation FrameUploadAllocator::Allocate(const gu::uint64 byteSize, const gu::uint64 alignment)
+*
+*  @brief     Allocate the range in the current frame region.
+*
+*  @param[in] const gu::uint64 byteSize
+*  @param[in] const gu::uint64 alignment (power of two)
+*
+*  @return    FrameUploadAllocation
+*****************************************************************************/
+FrameUploadAllocation FrameUploadAllocator::Allocate(const gu::uint64 byteSize, const gu::uint64 alignment)
+{
+	std::scoped_lock lock(_mutex);
+	return AllocateUnlocked(byteSize, alignment);
+}
+
+/****************************************************************************
+*                     Upload
+*************************************************************************//**
+*  @fn        FrameUploadAllocation FrameUploadAllocator::Upload(const void* data, const gu::uint64 byteSize, const gu::uint64 alignment)
+*
+*  @brief     Allocate the range and copy the data
+*
+*  @param[in] const void* data
+*  @param[in] const gu::uint64 byteSize
+*  @param[in] const gu::uint64 alignment (power of two)
+*
+*  @return    FrameUploadAllocation
+*****************************************************************************/
+FrameUploadAllocation FrameUploadAllocator::Upload(const void* data, const gu::uint64 byteSize, const gu::uint64 alignment)
+{
+	std::scoped_lock lock(_mutex);
+
+	const auto allocation = AllocateUnlocked(byteSize, alignment);
+	if (data && byteSize > 0) { gu::Memory::Copy(allocation.CPUAddress, data, byteSize); }
+	return allocation;
+}
+
+#pragma endregion Main Function
+
+#pragma region Protected Function
+/****************************************************************************
+*                     AllocateUnlocked
+*************************************************************************//**
+*  @fn        FrameUploadAllocation FrameUploadAllocator::AllocateUnlocked(const gu::uint64 byteSize, const gu::uint64 alignment)
+*
+*  @brief     Bump the head of the current region. The mutex is held by the caller.
+*             If the region is full, the buffer is replaced with the larger one.
+*             The old buffer is retired and released when the region is reused.
+*
+*  @param[in] const gu::uint64 byteSize
+*  @param[in] const gu::uint64 alignment (power of two)
+*
+*  @return    FrameUploadAllocation
+*****************************************************************************/
+FrameUploadAllocation FrameUploadAllocator::AllocateUnlocked(const gu::uint64 byteSize, const gu::uint64 alignment)
+{
+	Check(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+	auto& frame = _frames[_currentFrameIndex];
+	const gu::uint64 size   = byteSize > 0 ? byteSize : 1;
+	gu::uint64       offset = AlignUp(frame.Head, alignment);
+
+	/*-------------------------------------------------------------------
+	-      Replace the buffer with the twice larger one
+	---------------------------------------------------------------------*/
+	if (offset + size > frame.Capacity)
+	{
+		gu::uint64 capacity = frame.Capacity * 2;
+		while (capacity < size) { capacity *= 2; }
+
+		frame.RetiredBuffers.Push(frame.Buffer);
+		frame.Buffer     = CreateUploadBuffer(capacity, frame.CPUAddress);
+		frame.GPUAddress = frame.Buffer->GetGPUVirtualAddress();
+		frame.Capacity   = frame.Buffer->GetTotalByteSize();
+		offset           = 0;
+		_statistics.GrowCount++;
+	}
+
+	frame.Head = offset + size;
+
+	_statistics.AllocationCount++;
+	_statistics.UploadByteSize += byteSize;
+
+	FrameUploadAllocation allocation = {};
+	allocation.Buffer     = frame.Buffer;
+	allocation.Offset     = offset;
+	allocation.Size       = byteSize;
+	allocation.CPUAddress = frame.CPUAddress + offset;
+	allocation.GPUAddress = frame.GPUAddress != 0 ? frame.GPUAddress + offset : 0;
+	allocation.FrameIndex = _currentFrameIndex;
+	return allocation;
+}
+
+/****************************************************************************
+*                     CreateUploadBuffer
+*************************************************************************//**
+*  @fn        FrameUploadAllocator::BufferPtr FrameUploadAllocator::CreateUploadBuffer(const gu::uint64 byteSize, gu::uint8*& cpuAddress)
+*
+*  @brief     Create the upload buffer usable as the constant / vertex / index buffer, and map it persistently.
+*
+*  @param[in]  const gu::uint64 byteSize
+*  @param[out] gu::uint8*& cpuAddress
+*
+*  @return    BufferPtr
+*****************************************************************************/
+FrameUploadAllocator::BufferPtr FrameUploadAllocator::CreateUploadBuffer(const gu::uint64 byteSize, gu::uint8*& cpuAddress)
+{
+	auto metaData = GPUBufferMetaData::ConstantBuffer(byteSize, 1, MemoryHeap::Upload, ResourceState::GeneralRead);
+	metaData.ResourceUsage |= ResourceUsage::VertexBuffer | ResourceUsage::IndexBuffer;
+
+	auto buffer = _device->CreateBuffer(metaData, SP("FrameUploadBuffer"));
+	buffer->CopyStart();
+	cpuAddress = buffer->GetCPUMemory();
+
+	_statistics.MapCount++;
+	return buffer;
+}
+
+/****************************************************************************
+*                     Register
+*************************************************************************//**
+*  @fn        void FrameUploadAllocator::Register(FrameConstantBuffer* constantBuffer)
+*
+*  @brief     Register the constant buffer uploaded in each BeginFrame, and upload it to the current region.
+*
+*  @param[in] FrameConstantBuffer* constantBuffer
+*
+*  @return    void
+*****************************************************************************/
+void FrameUploadAllocator::Register(FrameConstantBuffer* constantBuffer)
+{
+	std::scoped_lock lock(_mutex);
+
+	_constantBuffers.Push(constantBuffer);
+	constantBuffer->Upload();
+}
+
+/****************************************************************************
+*                     Unregister
+*************************************************************************//**
+*  @fn        void FrameUploadAllocator::Unregister(FrameConstantBuffer* constantBuffer)
+*
+*  @brief     Remove the constant buffer from the upload list
+*
+*  @param[in] FrameConstantBuffer* constantBuffer
+*
+*  @return    void
+*****************************************************************************/
+void FrameUploadAllocator::Unregister(FrameConstantBuffer* constantBuffer)
+{
+	std::scoped_lock lock(_mutex);
+	_constantBuffers.Remove(constantBuffer);
+}
+
+#pragma endregion Protected Function
+#pragma endregion FrameUploadAllocator
+
+#pragma region FrameConstantBuffer
+#pragma region Constructor and Destructor
+FrameConstantBuffer::FrameConstantBuffer(const AllocatorPtr& allocator, const DevicePtr& device, const gu::uint64 elementByteSize, const gu::uint64 elementCount, const void* initData)
+	: _allocator(allocator), _elementByteSize(elementByteSize), _elementCount(elementCount)
+{
+	Check(_allocator);
+	Check(device);
+	Check(elementByteSize > 0 && elementCount > 0);
+
+	_elementStride = AlignUp(elementByteSize, FrameUploadAllocator::DEFAULT_ALIGNMENT);
+	_cpuData.Resize(_elementStride * _elementCount, true, 0);
+
+	if (initData)
+	{
+		const auto source = static_cast<const gu::uint8*>(initData);
+		for (gu::uint64 i = 0; i < _elementCount; ++i)
+		{
+			gu::Memory::Copy(_cpuData.Data() + i * _elementStride, source + i * _elementByteSize, _elementByteSize);
+		}
+	}
+
+	/*-------------------------------------------------------------------
+	-      The buffer range is set in each Upload
+	---------------------------------------------------------------------*/
+	_view = device->CreateResourceView(ResourceViewType::ConstantBuffer, gu::SharedPointer<GPUBuffer>(nullptr));
+	_allocator->Register(this);
+}
+
+FrameConstantBuffer::~FrameConstantBuffer()
+{
+	if (_allocator) { _allocator->Unregister(this); }
+}
+
+#pragma endregion Constructor and Destructor
+
+#pragma region Main Function
+/****************************************************************************
+*                     SetData
+*************************************************************************//**
+*  @fn        void FrameConstantBuffer::SetData(const void* data, const gu::uint64 byteSize, const gu::uint64 elementIndex, const gu::uint64 byteOffset)
+*
+*  @brief     Write the data to the CPU copy and the current frame range.
+*             After the frame is submitted, only the CPU copy is updated (uploaded in the next BeginFrame).
+*
+*  @param[in] const void* data
+*  @param[in] const gu::uint64 byteSize
+*  @param[in] const gu::uint64 elementIndex
+*  @param[in] const gu::uint64 byteOffset (from the element head)
+*
+*  @return    void
+*****************************************************************************/
+void FrameConstantBuffer::SetData(const void* data, const gu::uint64 byteSize, const gu::uint64 elementIndex, const gu::uint64 byteOffset)
+{
+	Check(data);
+	Check(elementIndex < _elementCount);
+	Check(byteOffset + byteSize <= _elementStride * (_elementCount - elementIndex));
+
+	const auto offset = elementIndex * _elementStride + byteOffset;
+
+	std::scoped_lock lock(_allocator->GetMutex());
+
+	gu::Memory::Copy(_cpuData.Data() + offset, data, byteSize);
+	if (!_allocator->_isFrameSubmitted)
+	{
+		gu::Memory::Copy(_allocation.CPUAddress + offset, data, byteSize);
+	}
+}
+
+/****************************************************************************
+*                     SetElements
+*************************************************************************//**
+*  @fn        void FrameConstantBuffer::SetElements(const void* data, const gu::uint64 elementCount, const gu::uint64 firstElement)
+*
+*  @brief     Write the packed elements. The stride of data is the element byte size given in the constructor.
+*
+*  @param[in] const void* data
+*  @param[in] const gu::uint64 elementCount
+*  @param[in] const gu::uint64 firstElement
+*
+*  @return    void
+*****************************************************************************/
+void FrameConstantBuffer::SetElements(const void* data, const gu::uint64 elementCount, const gu::uint64 firstElement)
+{
+	Check(data);
+	Check(firstElement + elementCount <= _elementCount);
+
+	const auto source = static_cast<const gu::uint8*>(data);
+
+	std::scoped_lock lock(_allocator->GetMutex());
+
+	const bool writeRing = !_allocator->_isFrameSubmitted;
+	for (gu::uint64 i = 0; i < elementCount; ++i)
+	{
+		const auto offset = (firstElement + i) * _elementStride;
+		gu::Memory::Copy(_cpuData.Data() + offset, source + i * _elementByteSize, _elementByteSize);
+		if (writeRing) { gu::Memory::Copy(_allocation.CPUAddress + offset, source + i * _elementByteSize, _elementByteSize); }
+	}
+}
+
+#pragma endregion Main Function
+
+#pragma region Protected Function
+/****************************************************************************
+*                     Upload
+*************************************************************************//**
+*  @fn        void FrameConstantBuffer::Upload()
+*
+*  @brief     Copy the CPU copy to the new range and point the view to it.
+*             The descriptor slot is the frame index, so the descriptor read by the GPU in the other frame is not overwritten.
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
+void FrameConstantBuffer::Upload()
+{
+	_allocation = _allocator->AllocateUnlocked(_cpuData.Size(), FrameUploadAllocator::DEFAULT_ALIGNMENT);
+	gu::Memory::Copy(_allocation.CPUAddress, _cpuData.Data(), _cpuData.Size());
+
+	_view->SetBufferRange(_allocation.Buffer, _allocation.Offset, _allocation.Size, _allocation.FrameIndex);
+}
+
+#pragma endregion Protected Function
+#pragma endregion FrameConstantBuffer
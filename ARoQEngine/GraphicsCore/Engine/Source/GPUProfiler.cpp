@@ -0,0 +1,218 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   GPUProfiler.cpp
+///             @brief  GPU zone profiler using the timestamp query heap.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/Engine/Include/GPUProfiler.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHICommandList.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHICommandQueue.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUBuffer.hpp"
+#include "GameUtility/Base/Include/GUProfiler.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::core;
+
+namespace
+{
+	constexpr const char* GPU_FRAME_ZONE_NAME = "GPU Frame";
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+GPUProfiler::GPUProfiler(const QueryPtr& timestampQuery, const CommandQueuePtr& commandQueue)
+	: _query(timestampQuery), _commandQueue(commandQueue)
+{
+	/*-------------------------------------------------------------------
+	-      Vulkan does not implement the query yet (frequency is 0)
+	---------------------------------------------------------------------*/
+	if (!_query || !_commandQueue) { return; }
+
+	_timestampFrequency = _commandQueue->GetTimestampFrequency();
+	if (_timestampFrequency == 0) { return; }
+
+	/*-------------------------------------------------------------------
+	-      Allocate the begin / end query of all zones at once
+	---------------------------------------------------------------------*/
+	_locations.Reserve(MAX_ZONE_COUNT * 2);
+	for (gu::uint32 i = 0; i < MAX_ZONE_COUNT * 2; ++i)
+	{
+		_locations.Push(_query->Allocate());
+	}
+
+	_isSequentialQuery = true;
+	for (gu::uint32 i = 1; i < _locations.Size(); ++i)
+	{
+		if (_locations[i].QueryID != _locations[0].QueryID + i) { _isSequentialQuery = false; break; }
+	}
+
+	_zones.Reserve(MAX_ZONE_COUNT);
+}
+
+GPUProfiler::~GPUProfiler()
+{
+	if (!_query) { return; }
+
+	for (auto& location : _locations)
+	{
+		_query->Free(location);
+	}
+	_locations.Clear();
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Public Function
+/****************************************************************************
+*                     BeginFrame
+*************************************************************************//**
+*  @fn        void GPUProfiler::BeginFrame(const CommandListPtr& commandList)
+*
+*  @brief     Start the frame zone. The zones of the previous frame must be collected before.
+*
+*  @param[in] const CommandListPtr& commandList (recording)
+*
+*  @return    void
+*****************************************************************************/
+void GPUProfiler::BeginFrame(const CommandListPtr& commandList)
+{
+	_zones.Clear();
+	_currentDepth   = 0;
+	_hasResolved    = false;
+	_isFrameActive  = IsSupported() && gu::Profiler::Instance().IsEnabled();
+	_frameZoneIndex = INVALID_ZONE_INDEX;
+
+	if (!_isFrameActive) { return; }
+
+	_frameZoneIndex = BeginZone(commandList, GPU_FRAME_ZONE_NAME);
+}
+
+/****************************************************************************
+*                     EndFrame
+*************************************************************************//**
+*  @fn        void GPUProfiler::EndFrame(const CommandListPtr& commandList)
+*
+*  @brief     Finish the frame zone and resolve the timestamps into the readback buffer.
+*
+*  @param[in] const CommandListPtr& commandList (recording)
+*
+*  @return    void
+*****************************************************************************/
+void GPUProfiler::EndFrame(const CommandListPtr& commandList)
+{
+	if (!_isFrameActive) { return; }
+
+	EndZone(commandList, _frameZoneIndex);
+	_frameZoneIndex = INVALID_ZONE_INDEX;
+	_isFrameActive  = false;
+
+	/*-------------------------------------------------------------------
+	-      Resolve [begin, end] x zone count
+	---------------------------------------------------------------------*/
+	const auto queryCount = static_cast<gu::uint32>(_zones.Size() * 2);
+	if (_isSequentialQuery)
+	{
+		commandList->ResolveQueryData(_locations[0], queryCount);
+	}
+	else
+	{
+		for (gu::uint32 i = 0; i < queryCount; ++i)
+		{
+			commandList->ResolveQueryData(_locations[i], 1);
+		}
+	}
+
+	_hasResolved = true;
+}
+
+/****************************************************************************
+*                     BeginZone
+*************************************************************************//**
+*  @fn        gu::uint32 GPUProfiler::BeginZone(const CommandListPtr& commandList, const char* name)
+*
+*  @brief     Write the begin timestamp of the zone.
+*
+*  @param[in] const CommandListPtr& commandList (recording)
+*  @param[in] const char* name (string literal)
+*
+*  @return    gu::uint32 zone index (INVALID_ZONE_INDEX : the frame is not started or the zone is full)
+*****************************************************************************/
+gu::uint32 GPUProfiler::BeginZone(const CommandListPtr& commandList, const char* name)
+{
+	if (!_isFrameActive || _zones.Size() >= MAX_ZONE_COUNT) { return INVALID_ZONE_INDEX; }
+
+	const auto zoneIndex = static_cast<gu::uint32>(_zones.Size());
+	_zones.Push(Zone{ name, _currentDepth++ });
+
+	commandList->EndQuery(_locations[zoneIndex * 2]);
+	return zoneIndex;
+}
+
+/****************************************************************************
+*                     EndZone
+*************************************************************************//**
+*  @fn        void GPUProfiler::EndZone(const CommandListPtr& commandList, const gu::uint32 zoneIndex)
+*
+*  @brief     Write the end timestamp of the zone.
+*
+*  @param[in] const CommandListPtr& commandList (recording)
+*  @param[in] const gu::uint32 zoneIndex (returned by BeginZone)
+*
+*  @return    void
+*****************************************************************************/
+void GPUProfiler::EndZone(const CommandListPtr& commandList, const gu::uint32 zoneIndex)
+{
+	if (!_isFrameActive || zoneIndex == INVALID_ZONE_INDEX) { return; }
+	Check(zoneIndex < _zones.Size());
+
+	commandList->EndQuery(_locations[zoneIndex * 2 + 1]);
+	_currentDepth--;
+}
+
+/****************************************************************************
+*                     Collect
+*************************************************************************//**
+*  @fn        void GPUProfiler::Collect()
+*
+*  @brief     Convert the resolved GPU ticks to the CPU clock microseconds and pass them to gu::Profiler.
+*             cpu = gpu - calibration.GPUMicroseconds + calibration.CPUMicroseconds
+*             (CPUMicroseconds is QueryPerformanceCounter based, the same clock as gu::Profiler::GetClockMicroseconds)
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
+void GPUProfiler::Collect()
+{
+	if (!_hasResolved) { return; }
+	_hasResolved = false;
+
+	const auto resultBuffer = _query->GetResultBuffer();
+	if (!resultBuffer || resultBuffer->GetCPUMemory() == nullptr) { return; }
+
+	const auto ticks       = reinterpret_cast<const gu::uint64*>(resultBuffer->GetCPUMemory());
+	const auto calibration = _commandQueue->GetCalibrationTimestamp();
+
+	const double microsecondsPerTick = 1e6 / static_cast<double>(_timestampFrequency);
+	const double offset = static_cast<double>(calibration.CPUMicroseconds) - static_cast<double>(calibration.GPUMicroseconds);
+
+	auto& profiler = gu::Profiler::Instance();
+	for (gu::uint32 i = 0; i < _zones.Size(); ++i)
+	{
+		const double begin = static_cast<double>(ticks[_locations[i * 2    ].QueryID]) * microsecondsPerTick + offset;
+		const double end   = static_cast<double>(ticks[_locations[i * 2 + 1].QueryID]) * microsecondsPerTick + offset;
+		if (begin < 0.0 || end < begin) { continue; }
+
+		profiler.AddGPUZone(_zones[i].Name, static_cast<gu::uint64>(begin), static_cast<gu::uint64>(end), _zones[i].Depth);
+	}
+}
+#pragma endregion Public Function
@@ -29,6 +29,7 @@
 #include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIFence.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIDescriptorHeap.hpp"
 #include "GameUtility/Base/Include/Screen.hpp"
+#include "GameUtility/Base/Include/GUProfiler.hpp"
 #include <iostream>
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -134,6 +135,17 @@ void LowLevelGraphicsEngine::StartUp(APIVersion apiVersion, void* hwnd, void* hI
 	---------------------------------------------------------------------*/
 	SetUpQuery();
 
+	/*-------------------------------------------------------------------
+	-      Set up gpu profiler
+	---------------------------------------------------------------------*/
+	SetUpGPUProfiler();
+
+	/*-------------------------------------------------------------------
+	-      Set up per-frame upload ring
+	---------------------------------------------------------------------*/
+	_frameUploadAllocator = gu::MakeShared<FrameUploadAllocator>(_device, FRAME_BUFFER_COUNT);
+	_frameUploadAllocator->BeginFrame(_currentFrameIndex);
+
 	_hasInitialized = true;
 }
 
@@ -161,6 +173,11 @@ void LowLevelGraphicsEngine::BeginDrawFrame()
 	---------------------------------------------------------------------*/
 	graphicsCommandList->BeginRecording(false);
 	computeCommandList ->BeginRecording(false);
+
+	/*-------------------------------------------------------------------
+	-      Start GPU frame zone
+	---------------------------------------------------------------------*/
+	if (_gpuProfiler) { _gpuProfiler->BeginFrame(graphicsCommandList); }
 }
 
 /****************************************************************************
@@ -189,6 +206,7 @@ void LowLevelGraphicsEngine::EndDrawFrame()
 	{
 		graphicsCommandList->EndRenderPass();
 		graphicsCommandList->CopyResource(_swapchain->GetBuffer(_currentFrameIndex), _frameBuffers[_currentFrameIndex]->GetRenderTarget());
+		if (_gpuProfiler) { _gpuProfiler->EndFrame(graphicsCommandList); }
 		graphicsCommandList->EndRecording();
 	}
 
@@ -202,17 +220,25 @@ void LowLevelGraphicsEngine::EndDrawFrame()
 	_commandQueues[core::CommandListType::Graphics]->Execute({ graphicsCommandList });
 	_commandQueues[core::CommandListType::Graphics]->Signal(_fence, ++_fenceValue);
 
+	// ̃t[̃Abv[ḧ͂̃tFXl̊ɍėpł
+	_frameUploadAllocator->EndFrame(_fence, _fenceValue);
+
 	/*-------------------------------------------------------------------
 	-          Flip Screen
 	---------------------------------------------------------------------*/
 	_swapchain->Present(_fence, _fenceValue);
 	_fence->Wait(_fenceValue);
 
+	// GPU̎s, ^CX^vǂݎ
+	if (_gpuProfiler) { _gpuProfiler->Collect(); }
+
 	/*-------------------------------------------------------------------
 	-      GPU Command Wait
 	---------------------------------------------------------------------*/
 	_currentFrameIndex = _swapchain->PrepareNextImage(_fence, ++_fenceValue);
 	SetUpFence(); // reset fence value for the next frame
+
+	_frameUploadAllocator->BeginFrame(_currentFrameIndex);
 }
 
 /****************************************************************************
@@ -311,6 +337,8 @@ void LowLevelGraphicsEngine::OnResize(const size_t newWidth, const size_t newHei
 	_currentFrameIndex = _swapchain->PrepareNextImage(_fence,++_fenceValue);
 	_fence->Wait(_fenceValue);
 
+	_frameUploadAllocator->BeginFrame(_currentFrameIndex);
+
 }
 
 void LowLevelGraphicsEngine::BeginSwapchainRenderPass()
@@ -351,6 +379,12 @@ void LowLevelGraphicsEngine::ShutDown()
 
 	if (_renderPass) { _renderPass.Reset(); }
 
+	// NG̕ԋps, Query heapɔj܂
+	if (_gpuProfiler) { _gpuProfiler.Reset(); }
+
+	// iIɃ}bvAbv[hobt@Unmap܂
+	if (_frameUploadAllocator) { _frameUploadAllocator.Reset(); }
+
 	_queryHeaps.Clear();
 
 	/*-------------------------------------------------------------------
@@ -394,8 +428,8 @@ void LowLevelGraphicsEngine::SetUpHeap()
 	heapCount.CBVDescCount = CBV_DESC_COUNT; 
 	heapCount.SRVDescCount = SRV_DESC_COUNT;
 	heapCount.UAVDescCount = UAV_DESC_COUNT;
-	heapCount.DSVDescCount = _apiVersion == APIVersion::DirectX12 ? DSV_DESC_COUNT : 0;
-	heapCount.RTVDescCount = _apiVersion == APIVersion::DirectX12 ? RTV_DESC_COUNT : 0;
+	heapCount.DSVDescCount = _apiVersion != APIVersion::Vulkan ? DSV_DESC_COUNT : 0;
+	heapCount.RTVDescCount = _apiVersion != APIVersion::Vulkan ? RTV_DESC_COUNT : 0;
 	heapCount.SamplerDescCount = MAX_SAMPLER_STATE;
 	_device->SetUpDefaultHeap(heapCount);
 
@@ -409,6 +443,29 @@ void LowLevelGraphicsEngine::SetUpQuery()
 	_queryHeaps[QueryHeapType::PipelineStatistics] = _device->CreateQuery(QueryHeapType::PipelineStatistics);
 }
 
+/****************************************************************************
+*                     SetUpGPUProfiler
+*************************************************************************//**
+*  @fn        void LowLevelGraphicsEngine::SetUpGPUProfiler()
+*
+*  @brief     Graphics queuẽ^CX^vGPUvs܂.
+*             TimestampNGΉ̏ꍇ (Vulkan) ͍쐬܂
+*
+*  @param[in] void
+*
+*  @return @@void
+*****************************************************************************/
+void LowLevelGraphicsEngine::SetUpGPUProfiler()
+{
+#if GU_PROFILER_ENABLED
+	const auto& timestampQuery = _queryHeaps[QueryHeapType::TimeStamp];
+	if (!timestampQuery) { return; }
+
+	_gpuProfiler = gu::MakeShared<GPUProfiler>(timestampQuery, _commandQueues[core::CommandListType::Graphics]);
+	if (!_gpuProfiler->IsSupported()) { _gpuProfiler.Reset(); }
+#endif
+}
+
 void LowLevelGraphicsEngine::SetUpFence()
 {
 	if (_fence) { _fence.Reset(); }
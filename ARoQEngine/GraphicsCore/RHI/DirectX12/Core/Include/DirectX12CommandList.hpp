@@ -83,6 +83,11 @@ namespace rhi::directX12
 		*  @brief : GPU擾邽߂̃NGI܂
 		/*----------------------------------------------------------------------*/
 		void EndQuery(const core::QueryResultLocation& location) override;
+
+		/*----------------------------------------------------------------------
+		*  @brief : NǦʂQuery heapReadback bufferɃRs[܂
+		/*----------------------------------------------------------------------*/
+		void ResolveQueryData(const core::QueryResultLocation& location, const gu::uint32 queryCount) override;
 #pragma endregion Query
 #pragma region Graphics Command Function
 		/*-------------------------------------------------------------------
@@ -106,6 +111,8 @@ namespace rhi::directX12
 		void SetGraphicsPipeline(const gu::SharedPointer<core::GPUGraphicsPipelineState>& pipelineState) override;
 		
 		void SetVertexBuffer(const gu::SharedPointer<core::GPUBuffer>& buffer) override ;
+
+		void SetVertexBuffer(const gu::SharedPointer<core::GPUBuffer>& buffer, const gu::uint64 byteOffset, const gu::uint64 byteSize, const gu::uint32 stride) override;
 		
 		void SetVertexBuffers(const gu::DynamicArray<gu::SharedPointer<core::GPUBuffer>>& buffers, const size_t startSlot = 0) override;
 		
@@ -166,6 +173,11 @@ namespace rhi::directX12
 		*  @brief : eNX`̗̈܂Ƃ߂ĕʂ̃\[XɃRs[
 		/*----------------------------------------------------------------------*/
 		void CopyResource(const gu::SharedPointer<core::GPUTexture>& dest, const gu::SharedPointer<core::GPUTexture>& source) override;
+
+		/*----------------------------------------------------------------------
+		*  @brief : sourcemip0Ŝdestmip0(destX, destY)ɃRs[
+		/*----------------------------------------------------------------------*/
+		void CopyTextureRegion(const gu::SharedPointer<core::GPUTexture>& dest, const gu::uint32 destX, const gu::uint32 destY, const gu::SharedPointer<core::GPUTexture>& source) override;
 		
 		/*----------------------------------------------------------------------
 		*  @brief : 郊\[Ẍ̗܂Ƃ߂ĕʂ̃\[XɃRs[. 
@@ -201,6 +213,8 @@ namespace rhi::directX12
 		void BeginRenderPassImpl(const gu::SharedPointer<directX12::RHIRenderPass>& renderPass, const gu::SharedPointer<directX12::RHIFrameBuffer>& frameBuffer);
 		
 		void OMSetFrameBuffer   (const gu::SharedPointer<directX12::RHIRenderPass>& renderPass, const gu::SharedPointer<directX12::RHIFrameBuffer>& frameBuffer);
+
+		void DiscardPlacedTexture(const gu::SharedPointer<core::GPUTexture>& texture);
 	};
 }
 #endif
\ No newline at end of file
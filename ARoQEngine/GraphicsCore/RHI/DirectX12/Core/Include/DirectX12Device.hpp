@@ -12,6 +12,7 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIDevice.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIMemoryAllocator.hpp"
 #include "DirectX12Core.hpp"
 #include <dxgiformat.h>
 #include <d3d12.h>
@@ -142,6 +143,27 @@ namespace rhi::directX12
 			const D3D12_RESOURCE_STATES initialState,
 			const D3D12_CLEAR_VALUE* clearValue = nullptr
 		);
+
+		/*----------------------------------------------------------------------
+		*  @brief : Place the resource into the pooled heap of the memory allocator.
+		*           Falls back to CreateCommittedResource (allocation stays invalid) when the resource cannot be placed.
+		*           The placed render target / depth stencil must be cleared or discarded before the first use.
+		/*----------------------------------------------------------------------*/
+		HRESULT CreateSubAllocatedResource
+		(
+			ResourceComPtr& resource,
+			core::MemoryAllocation& allocation,
+			const D3D12_RESOURCE_DESC& resourceDesc,
+			const D3D12_HEAP_PROPERTIES& heapProp,
+			const D3D12_RESOURCE_STATES initialState,
+			const D3D12_CLEAR_VALUE* clearValue = nullptr,
+			const core::MemoryAllocationStrategy strategy = core::MemoryAllocationStrategy::General
+		);
+
+		/*----------------------------------------------------------------------
+		*  @brief : Release the resource created by CreateSubAllocatedResource and return its range to the allocator
+		/*----------------------------------------------------------------------*/
+		void ReleaseSubAllocatedResource(ResourceComPtr& resource, core::MemoryAllocation& allocation);
 #pragma endregion Create Function
 
 		/****************************************************************************
@@ -184,6 +206,8 @@ namespace rhi::directX12
 
 		bool IsSupportedAllowTearing       () const noexcept { return _isSupportedAllowTearing; }
 
+		bool IsSupportedHeapNotZero        () const noexcept { return _isSupportedHeapNotZero; }
+
 		bool IsSupportedDxr                () const override { return _isSupportedRayTracing; }
 
 		bool IsSupportedHDR                () const override { return _isSupportedHDR; };
@@ -52,6 +52,12 @@ namespace rhi::directX12
 			const core::MemoryHeap heapType,
 			const std::uint64_t size, 
 			[[maybe_unused]]std::uint32_t typeBits);
+
+		/* @brief : Wrap the heap created by the caller (the memory allocator creates the heaps with its own flags)*/
+		explicit RHIMemory(
+			const gu::SharedPointer<core::RHIDevice>& device,
+			const core::MemoryHeap heapType,
+			const HeapComPtr& heap);
 	
 	protected:
 		/****************************************************************************
@@ -0,0 +1,69 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   DirectX12MemoryAllocator.hpp
+///             @brief  GPU memory sub-allocator (ID3D12Heap blocks)
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef DIRECTX12_MEMORY_ALLOCATOR_HPP
+#define DIRECTX12_MEMORY_ALLOCATOR_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIMemoryAllocator.hpp"
+#include "DirectX12Core.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::directX12
+{
+	class RHIDevice;
+
+	/****************************************************************************
+	*				  			RHIMemoryAllocator
+	*************************************************************************//**
+	*  @class     RHIMemoryAllocator
+	*  @brief     Create the ID3D12Heap of each pool.
+	*             The heap flags follow the resource category (ALLOW_ONLY_BUFFERS / NON_RT_DS_TEXTURES / RT_DS_TEXTURES),
+	*             so the heaps are valid on the resource heap tier 1 devices.
+	*             The budget is read from IDXGIAdapter3::QueryVideoMemoryInfo.
+	*****************************************************************************/
+	class RHIMemoryAllocator : public core::RHIMemoryAllocator
+	{
+	public:
+		/****************************************************************************
+		**                Static Function
+		*****************************************************************************/
+		/* @brief : Return false if the heap properties cannot be expressed by core::MemoryHeap (the resource is committed instead)*/
+		static bool ConvertHeapType(const D3D12_HEAP_PROPERTIES& heapProperties, core::MemoryHeap& heapType);
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		RHIMemoryAllocator() = default;
+
+		~RHIMemoryAllocator();
+
+		explicit RHIMemoryAllocator(const gu::SharedPointer<RHIDevice>& device);
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+		gu::SharedPointer<core::RHIMemory> CreateMemoryBlock(const core::MemoryPoolKey& key, const gu::uint64 byteSize) override;
+
+		bool QueryDeviceBudget(const core::MemoryHeap heapType, gu::uint64& budget, gu::uint64& usage) const override;
+
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		gu::SharedPointer<RHIDevice> _device = nullptr;
+	};
+}
+#endif
@@ -28,9 +28,15 @@
 #include <d3d12.h>
 #include <dxgi1_6.h>
 #include "GameUtility/Container/Include/GUDynamicArray.hpp"
+#include "GameUtility/Container/Include/GUSmallArray.hpp"
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	// Barrier batches are usually at most the render target count, so they are kept on the stack.
+	constexpr gu::uint64 INLINE_BARRIER_COUNT = 8;
+}
 using namespace rhi;
 using namespace rhi::directX12;
 using namespace Microsoft::WRL;
@@ -213,9 +219,15 @@ void RHICommandList::BeginRenderPass(const gu::SharedPointer<core::RHIRenderPass
 	/*-------------------------------------------------------------------
 	-          Layout Transition (Present -> RenderTarget)
 	---------------------------------------------------------------------*/
-	gu::DynamicArray<core::ResourceState> states(frameBuffer->GetRenderTargetSize(), core::ResourceState::RenderTarget);
+	gu::SmallArray<core::ResourceState, INLINE_BARRIER_COUNT> states(frameBuffer->GetRenderTargetSize(), core::ResourceState::RenderTarget);
 	TransitionResourceStates(static_cast<std::uint32_t>(frameBuffer->GetRenderTargetSize()), frameBuffer->GetRenderTargets().Data(), states.Data());
 
+	/*-------------------------------------------------------------------
+	-          Initialize the placed render targets on the first use
+	---------------------------------------------------------------------*/
+	for (const auto& renderTarget : frameBuffer->GetRenderTargets()) { DiscardPlacedTexture(renderTarget); }
+	if (frameBuffer->GetDepthStencil()) { DiscardPlacedTexture(frameBuffer->GetDepthStencil()); }
+
 	/*-------------------------------------------------------------------
 	-          Select renderpass and frame buffer action
 	---------------------------------------------------------------------*/
@@ -249,7 +261,7 @@ void RHICommandList::EndRenderPass()
 	/*-------------------------------------------------------------------
 	-          Layout Transition (RenderTarget -> Present)
 	---------------------------------------------------------------------*/
-	gu::DynamicArray<core::ResourceState> states(_frameBuffer->GetRenderTargetSize(), core::ResourceState::Present);
+	gu::SmallArray<core::ResourceState, INLINE_BARRIER_COUNT> states(_frameBuffer->GetRenderTargetSize(), core::ResourceState::Present);
 	TransitionResourceStates(static_cast<std::uint32_t>(_frameBuffer->GetRenderTargetSize()), _frameBuffer->GetRenderTargets().Data(), states.Data());
 	_beginRenderPass = false;
 }
@@ -337,6 +349,33 @@ void RHICommandList::EndQuery(const core::QueryResultLocation& location)
 	// NG̏I
 	_commandList->EndQuery(query->GetHeap().Get(), query->GetDxQueryType(), location.QueryID);
 }
+
+/****************************************************************************
+*                       ResolveQueryData
+*************************************************************************//**
+*  @fn        void RHICommandList::ResolveQueryData(const core::QueryResultLocation& location, const gu::uint32 queryCount)
+*
+*  @brief     NǦʂQuery heapReadback bufferɃRs[܂.
+*             Rs[QueryIDƓzʒuł. GPU̎sCPUǂݎ܂
+*
+*  @param[in] const core::QueryResultLocation& location (擪̃NG)
+*  @param[in] const gu::uint32 queryCount
+*
+*  @return @@void
+*****************************************************************************/
+void RHICommandList::ResolveQueryData(const core::QueryResultLocation& location, const gu::uint32 queryCount)
+{
+	if (queryCount == 0) { return; }
+
+	const auto query = static_cast<directX12::RHIQuery*>(location.Heap.Get());
+	Checkf(query, "query is nullptr");
+
+	const auto resultBuffer = static_cast<directX12::GPUBuffer*>(query->GetResultBuffer().Get());
+	Checkf(resultBuffer, "result buffer is nullptr");
+
+	_commandList->ResolveQueryData(query->GetHeap().Get(), query->GetDxQueryType(), location.QueryID, queryCount,
+		resultBuffer->GetResourcePtr(), static_cast<gu::uint64>(location.QueryID) * query->GetResultStrideByteSize());
+}
 #pragma endregion Query
 /****************************************************************************
 *                       SetPrimitiveTopology
@@ -444,6 +483,35 @@ void RHICommandList::SetVertexBuffer(const gu::SharedPointer<core::GPUBuffer>& b
 	_commandList->IASetVertexBuffers(0, 1, &view);
 }
 
+/****************************************************************************
+*                     SetVertexBuffer
+*************************************************************************//**
+*  @fn        void RHICommandList::SetVertexBuffer(const gu::SharedPointer<core::GPUBuffer>& buffer, const gu::uint64 byteOffset, const gu::uint64 byteSize, const gu::uint32 stride)
+*
+*  @brief     obt@̈ꕔ͈̔͂𒸓_obt@ƂĐݒ肵܂ (Abv[hO̊m۔͈͂Ȃ)
+*
+*  @param[in] const gu::SharedPointer<core::GPUBuffer>& buffer
+*  @param[in] const gu::uint64 byteOffset
+*  @param[in] const gu::uint64 byteSize
+*  @param[in] const gu::uint32 stride
+*
+*  @return @@void
+*****************************************************************************/
+void RHICommandList::SetVertexBuffer(const gu::SharedPointer<core::GPUBuffer>& buffer, const gu::uint64 byteOffset, const gu::uint64 byteSize, const gu::uint32 stride)
+{
+#ifdef _DEBUG
+	assert(byteOffset + byteSize <= buffer->GetTotalByteSize());
+#endif
+
+	const D3D12_VERTEX_BUFFER_VIEW view = 
+	{
+		gu::StaticPointerCast<directX12::GPUBuffer>(buffer)->GetResourcePtr()->GetGPUVirtualAddress() + byteOffset,
+		static_cast<UINT>(byteSize),
+		static_cast<UINT>(stride)
+	};
+	_commandList->IASetVertexBuffers(0, 1, &view);
+}
+
 void RHICommandList::SetResourceLayout(const gu::SharedPointer<core::RHIResourceLayout>& resourceLayout)
 {
 	_commandList->SetGraphicsRootSignature(gu::StaticPointerCast<directX12::RHIResourceLayout>(resourceLayout)->GetRootSignature().Get());
@@ -558,7 +626,8 @@ void RHICommandList::TransitionResourceState(const gu::SharedPointer<core::GPUTe
 *****************************************************************************/
 void RHICommandList::TransitionResourceStates(const std::uint32_t numStates, const gu::SharedPointer<core::GPUTexture>* textures, core::ResourceState* afters)
 {
-	gu::DynamicArray<BARRIER> barriers = {};
+	gu::SmallArray<BARRIER, INLINE_BARRIER_COUNT> barriers = {};
+	barriers.Reserve(numStates);
 	for (std::uint32_t i = 0; i < numStates; ++i)
 	{
 		BARRIER barrier = BARRIER::Transition(gu::StaticPointerCast<directX12::GPUTexture>(textures[i])->GetResource().Get(),
@@ -571,7 +640,7 @@ void RHICommandList::TransitionResourceStates(const std::uint32_t numStates, con
 
 void RHICommandList::TransitionResourceStates(const gu::DynamicArray<gu::SharedPointer<core::GPUResource>>& resources, core::ResourceState* afters)
 {
-	gu::DynamicArray<BARRIER> barriers(resources.Size());
+	gu::SmallArray<BARRIER, INLINE_BARRIER_COUNT> barriers(resources.Size());
 	for (uint32 i = 0; i < resources.Size(); ++i)
 	{
 		if (resources[i]->IsTexture())
@@ -675,8 +744,8 @@ void RHICommandList::CopyBufferRegion(const gu::SharedPointer<core::GPUBuffer>&
 
 	const auto rhiDestBuffer   = static_cast<directX12::GPUBuffer*>(dest.Get());
 	const auto rhiSourceBuffer = static_cast<directX12::GPUBuffer*>(source.Get());
-	const auto destResource    = rhiDestBuffer->GetResourcePtr();
-	const auto sourceResource  = rhiSourceBuffer->GetResourcePtr();
+	const auto destResource    = rhiDestBuffer->GetResource().Get();
+	const auto sourceResource  = rhiSourceBuffer->GetResource().Get();
 
 	/*-------------------------------------------------------------------
 	-           Copyable resource check
@@ -705,6 +774,51 @@ void RHICommandList::CopyBufferRegion(const gu::SharedPointer<core::GPUBuffer>&
 	TransitionResourceStates({ dest, source }, befores);
 }
 
+/****************************************************************************
+*                     CopyTextureRegion
+*************************************************************************//**
+*  @fn        void RHICommandList::CopyTextureRegion(const gu::SharedPointer<core::GPUTexture>& dest, const gu::uint32 destX, const gu::uint32 destY, const gu::SharedPointer<core::GPUTexture>& source)
+*
+*  @brief     sourcemip0Ŝdestmip0(destX, destY)ɃRs[.
+*             ubNktH[}bg̏ꍇ, destX, destY4̔{łKv܂.
+*
+*  @param[in] const gu::SharedPointer<core::GPUTexture>& Rs[̃eNX`
+*  @param[in] const gu::uint32 destX Rs[̍̃sNZʒu
+*  @param[in] const gu::uint32 destY Rs[̍̃sNZʒu
+*  @param[in] const gu::SharedPointer<core::GPUTexture>& Rs[̃eNX`
+
+*  @return @@void
+*****************************************************************************/
+void RHICommandList::CopyTextureRegion(const gu::SharedPointer<core::GPUTexture>& dest, const gu::uint32 destX, const gu::uint32 destY, const gu::SharedPointer<core::GPUTexture>& source)
+{
+	using enum core::ResourceState;
+
+	Check(dest && source && dest != source);
+	Check(dest->GetPixelFormat() == source->GetPixelFormat());
+	Check(destX + source->GetWidth() <= dest->GetWidth() && destY + source->GetHeight() <= dest->GetHeight());
+
+	core::ResourceState befores[] = { dest->GetResourceState(), source->GetResourceState() };
+	core::ResourceState afters[]  = { CopyDestination, CopySource };
+
+	TransitionResourceStates({ dest, source }, afters);
+
+	/*-------------------------------------------------------------------
+	-           Copy mip 0 of the first array slice
+	---------------------------------------------------------------------*/
+	D3D12_TEXTURE_COPY_LOCATION destLocation = {};
+	destLocation.pResource        = gu::StaticPointerCast<directX12::GPUTexture>(dest)->GetResource().Get();
+	destLocation.Type             = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+	destLocation.SubresourceIndex = 0;
+
+	D3D12_TEXTURE_COPY_LOCATION sourceLocation = {};
+	sourceLocation.pResource        = gu::StaticPointerCast<directX12::GPUTexture>(source)->GetResource().Get();
+	sourceLocation.Type             = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+	sourceLocation.SubresourceIndex = 0;
+
+	_commandList->CopyTextureRegion(&destLocation, destX, destY, 0, &sourceLocation, nullptr);
+
+	TransitionResourceStates({ dest, source }, befores);
+}
 
 #pragma endregion Copy
 #pragma endregion GPU Command
@@ -870,4 +984,26 @@ void RHICommandList::OMSetFrameBuffer(const gu::SharedPointer<directX12::RHIRend
 	_commandList->OMSetRenderTargets(static_cast<std::uint32_t>(rtvHandle.Size()), hasRTV ? rtvHandle.Data() : nullptr, FALSE, hasDSV ? &dsvHandle : nullptr);
 }
 
+/****************************************************************************
+*                     DiscardPlacedTexture
+*************************************************************************//**
+*  @fn        void RHICommandList::DiscardPlacedTexture(const gu::SharedPointer<core::GPUTexture>& texture)
+*  @brief     Discard the placed render target or depth stencil once before its first use.
+*             The heap range may hold the old resource, so D3D12 requires a discard, a full clear or a copy.
+*  @param[in] const gu::SharedPointer<core::GPUTexture>& texture
+*  @return @@void
+*****************************************************************************/
+void RHICommandList::DiscardPlacedTexture(const gu::SharedPointer<core::GPUTexture>& texture)
+{
+	const auto dxTexture = static_cast<directX12::GPUTexture*>(texture.Get());
+	if (dxTexture == nullptr || !dxTexture->RequiresInitialDiscard()) { return; }
+
+	// DiscardResource is only valid in the render target or the depth write state.
+	const auto state = dxTexture->GetResourceState();
+	if (state != core::ResourceState::RenderTarget && state != core::ResourceState::DepthStencil) { return; }
+
+	_commandList->DiscardResource(dxTexture->GetResource().Get(), nullptr);
+	dxTexture->OnInitialDiscarded();
+}
+
 #pragma endregion Private Function
\ No newline at end of file
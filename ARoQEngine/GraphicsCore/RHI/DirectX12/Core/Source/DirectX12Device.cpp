@@ -21,6 +21,8 @@
 #include "../Include/DirectX12FrameBuffer.hpp"
 #include "../Include/DirectX12Instance.hpp"
 #include "../Include/DirectX12Query.hpp"
+#include "../Include/DirectX12Memory.hpp"
+#include "../Include/DirectX12MemoryAllocator.hpp"
 #include "GraphicsCore/RHI/DirectX12/PipelineState/Include/DirectX12GPUPipelineState.hpp"
 #include "GraphicsCore/RHI/DirectX12/Resource/Include/DirectX12GPUTexture.hpp"
 #include "GraphicsCore/RHI/DirectX12/Resource/Include/DirectX12GPUBuffer.hpp"
@@ -169,6 +171,10 @@ void RHIDevice::SetUpDefaultHeap(const core::DefaultHeapCount& heapCount)
 	_defaultHeap[DefaultHeapType::DSV]->Resize(core::DescriptorHeapType::DSV, heapCount.DSVDescCount);
 	_defaultHeap[DefaultHeapType::Sampler]->Resize(core::DescriptorHeapType::SAMPLER, heapCount.SamplerDescCount);
 
+	/*-------------------------------------------------------------------
+	-                   GPU memory sub-allocator
+	---------------------------------------------------------------------*/
+	_memoryAllocator = gu::StaticPointerCast<core::RHIMemoryAllocator>(gu::MakeShared<directX12::RHIMemoryAllocator>(SharedFromThis()));
 }
 
 /****************************************************************************
@@ -202,6 +208,11 @@ void RHIDevice::Destroy()
 
 	if (_drawIndexedIndirectCommandSignature) { _drawIndexedIndirectCommandSignature.Reset(); }
 
+	/*-------------------------------------------------------------------
+	-              Release the pooled heaps (they refer to this device)
+	---------------------------------------------------------------------*/
+	if (_memoryAllocator) { _memoryAllocator.Reset(); }
+
 
 	/*-------------------------------------------------------------------
 	-              Clear device
@@ -478,6 +489,127 @@ HRESULT RHIDevice::CreatePlacedResource( ResourceComPtr& resource, const D3D12_R
 	return _device->CreatePlacedResource(heap.Get(), heapOffset, &resourceDesc, initialState, clearValue, IID_PPV_ARGS(resource.GetAddressOf()));
 }
 
+/****************************************************************************
+*                     CreateSubAllocatedResource
+*************************************************************************//**
+*  @fn        HRESULT RHIDevice::CreateSubAllocatedResource(ResourceComPtr& resource, core::MemoryAllocation& allocation, const D3D12_RESOURCE_DESC& resourceDesc, const D3D12_HEAP_PROPERTIES& heapProps, const D3D12_RESOURCE_STATES initialState, const D3D12_CLEAR_VALUE* clearValue, const core::MemoryAllocationStrategy strategy)
+*
+*  @brief     AP[^̃q[vɃ\[Xzu܂. 
+*             zułȂꍇ (L\[X, Acceleration Structure, ΉĂȂJX^q[v, q[vmێs) Committed Resource쐬܂
+*
+*  @param[out] ResourceComPtr&  resource
+*  @param[out] core::MemoryAllocation& allocation (Committed Resourcȅꍇ͖)
+*  @param[in]  const D3D12_RESOURCE_DESC&  resource̐ݒ
+*  @param[in]  D3D12_HEAP_PROPERTIES& q[v̐ݒ
+*  @param[in]  const D3D12_RESOURCE_STATES ŏɐݒ肷resource state
+*  @param[in]  const D3D12_CLEAR_VALUE*    NAJ[
+*  @param[in]  const core::MemoryAllocationStrategy gpAP[^ (RenderTarget : ofBAP[^)
+*
+*  @return @@HRESULT
+*****************************************************************************/
+HRESULT RHIDevice::CreateSubAllocatedResource(ResourceComPtr& resource, core::MemoryAllocation& allocation,
+	const D3D12_RESOURCE_DESC& resourceDesc,
+	const D3D12_HEAP_PROPERTIES& heapProps,
+	const D3D12_RESOURCE_STATES initialState, const D3D12_CLEAR_VALUE* clearValue,
+	const core::MemoryAllocationStrategy strategy)
+{
+	allocation = core::MemoryAllocation();
+
+	/*-------------------------------------------------------------------
+	-            zu\̊mF
+	---------------------------------------------------------------------*/
+	core::MemoryHeap heapType = core::MemoryHeap::Default;
+	const bool canPlace = _memoryAllocator
+		&& directX12::RHIMemoryAllocator::ConvertHeapType(heapProps, heapType)
+		&& (resourceDesc.Flags & D3D12_RESOURCE_FLAG_ALLOW_SIMULTANEOUS_ACCESS) == 0
+		&& initialState != D3D12_RESOURCE_STATE_RAYTRACING_ACCELERATION_STRUCTURE;
+
+	if (!canPlace)
+	{
+		return CreateCommittedResource(resource, resourceDesc, heapProps, initialState, clearValue);
+	}
+
+	/*-------------------------------------------------------------------
+	-            \[XTCYƃACg̎擾
+	---------------------------------------------------------------------*/
+	const bool isBuffer       = resourceDesc.Dimension == D3D12_RESOURCE_DIMENSION_BUFFER;
+	const bool isRenderTarget = (resourceDesc.Flags & (D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET | D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL)) != 0;
+
+	auto localDesc = resourceDesc;
+	D3D12_RESOURCE_ALLOCATION_INFO allocationInfo = {};
+
+	// Placed buffer̃ACg0 (64KB) ̂ݎw\
+	if (isBuffer) { localDesc.Alignment = 0; }
+
+	// eNX`4KBACg (ΉĂȂꍇ͊̃ACgɖ߂)
+	if (!isBuffer && !isRenderTarget && localDesc.SampleDesc.Count <= 1)
+	{
+		localDesc.Alignment = D3D12_SMALL_RESOURCE_PLACEMENT_ALIGNMENT;
+		allocationInfo      = _device->GetResourceAllocationInfo(0, 1, &localDesc);
+		if (allocationInfo.Alignment != D3D12_SMALL_RESOURCE_PLACEMENT_ALIGNMENT)
+		{
+			localDesc.Alignment = 0;
+			allocationInfo      = _device->GetResourceAllocationInfo(0, 1, &localDesc);
+		}
+	}
+	else
+	{
+		allocationInfo = _device->GetResourceAllocationInfo(0, 1, &localDesc);
+	}
+
+	if (allocationInfo.SizeInBytes == 0 || allocationInfo.SizeInBytes == UINT64_MAX)
+	{
+		return CreateCommittedResource(resource, resourceDesc, heapProps, initialState, clearValue);
+	}
+
+	/*-------------------------------------------------------------------
+	-            q[v̈̊mۂƔzu
+	---------------------------------------------------------------------*/
+	core::MemoryAllocationDesc allocationDesc = {};
+	allocationDesc.ByteSize  = allocationInfo.SizeInBytes;
+	allocationDesc.Alignment = allocationInfo.Alignment;
+	allocationDesc.HeapType  = heapType;
+	allocationDesc.Category  = isBuffer ? core::MemoryResourceCategory::Buffer
+		: isRenderTarget ? core::MemoryResourceCategory::RenderTargetTexture : core::MemoryResourceCategory::Texture;
+	allocationDesc.Strategy  = strategy;
+
+	allocation = _memoryAllocator->Allocate(allocationDesc);
+	if (allocation.IsValid())
+	{
+		const auto heap = static_cast<directX12::RHIMemory*>(allocation.Memory)->GetHeap();
+		const auto result = CreatePlacedResource(resource, localDesc, heap, allocation.Offset, initialState, clearValue);
+		if (SUCCEEDED(result)) { return result; }
+
+		_memoryAllocator->Free(allocation);
+		allocation = core::MemoryAllocation();
+	}
+
+	return CreateCommittedResource(resource, resourceDesc, heapProps, initialState, clearValue);
+}
+
+/****************************************************************************
+*                     ReleaseSubAllocatedResource
+*************************************************************************//**
+*  @fn        void RHIDevice::ReleaseSubAllocatedResource(ResourceComPtr& resource, core::MemoryAllocation& allocation)
+*
+*  @brief     \[X, q[v̗̈AP[^ɕԋp܂
+*
+*  @param[in,out] ResourceComPtr& resource
+*  @param[in,out] core::MemoryAllocation& allocation
+*
+*  @return @@void
+*****************************************************************************/
+void RHIDevice::ReleaseSubAllocatedResource(ResourceComPtr& resource, core::MemoryAllocation& allocation)
+{
+	if (resource) { resource.Reset(); }
+
+	if (allocation.IsValid() && _memoryAllocator)
+	{
+		_memoryAllocator->Free(allocation);
+	}
+	allocation = core::MemoryAllocation();
+}
+
 #pragma endregion           Create Resource Function
 
 #pragma region Debug Function
@@ -308,6 +308,10 @@ DXGI_FORMAT EnumConverter::Convert(const core::InputFormat inputFormat)
 		case R32G32B32A32_FLOAT: return DXGI_FORMAT_R32G32B32A32_FLOAT;
 		case R32G32B32A32_INT  : return DXGI_FORMAT_R32G32B32A32_SINT;
 		case R32_FLOAT         : return DXGI_FORMAT_R32_FLOAT;
+		case R16G16_FLOAT      : return DXGI_FORMAT_R16G16_FLOAT;
+		case R16G16_SNORM      : return DXGI_FORMAT_R16G16_SNORM;
+		case R16G16B16A16_UINT : return DXGI_FORMAT_R16G16B16A16_UINT;
+		case R8G8B8A8_UNORM    : return DXGI_FORMAT_R8G8B8A8_UNORM;
 		default:
 			throw std::runtime_error("not supported input format");
 	}
@@ -12,6 +12,7 @@
 #include "../Include/DirectX12Device.hpp"
 #include "../Include/DirectX12Debug.hpp"
 #include "../Include/DirectX12EnumConverter.hpp"
+#include "../Include/DirectX12BaseStruct.hpp"
 #include <d3d12.h>
 #include <stdexcept>
 //////////////////////////////////////////////////////////////////////////////////
@@ -32,7 +33,7 @@ RHIMemory::RHIMemory(const gu::SharedPointer<core::RHIDevice>& device, const cor
 	const D3D12_HEAP_DESC desc =
 	{
 		.SizeInBytes = memorySize,
-		.Properties  = EnumConverter::Convert(heapType),
+		.Properties  = HEAP_PROPERTY(EnumConverter::Convert(heapType)),
 		.Alignment   = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT,
 		.Flags       = D3D12_HEAP_FLAG_NONE
 	};
@@ -41,4 +42,10 @@ RHIMemory::RHIMemory(const gu::SharedPointer<core::RHIDevice>& device, const cor
 	
 }
 
+RHIMemory::RHIMemory(const gu::SharedPointer<core::RHIDevice>& device, const core::MemoryHeap heapType, const HeapComPtr& heap)
+	: core::RHIMemory(device, heapType, heap ? heap->GetDesc().SizeInBytes : 0), _heap(heap)
+{
+	
+}
+
 #pragma endregion Constructor and Destructor
\ No newline at end of file
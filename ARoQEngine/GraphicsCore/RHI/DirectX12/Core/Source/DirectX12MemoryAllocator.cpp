@@ -0,0 +1,160 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   DirectX12MemoryAllocator.cpp
+///             @brief  GPU memory sub-allocator (ID3D12Heap blocks)
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/DirectX12MemoryAllocator.hpp"
+#include "../Include/DirectX12Memory.hpp"
+#include "../Include/DirectX12Device.hpp"
+#include "../Include/DirectX12Adapter.hpp"
+#include "../Include/DirectX12BaseStruct.hpp"
+#include "../Include/DirectX12EnumConverter.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include <d3d12.h>
+#include <dxgi1_6.h>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::directX12;
+using namespace Microsoft::WRL;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+RHIMemoryAllocator::RHIMemoryAllocator(const gu::SharedPointer<RHIDevice>& device)
+	: core::RHIMemoryAllocator(), _device(device)
+{
+	Check(_device);
+}
+
+RHIMemoryAllocator::~RHIMemoryAllocator()
+{
+	// Release the heaps before the device reference is dropped
+	ReleaseAll();
+	if (_device) { _device.Reset(); }
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Static Function
+bool RHIMemoryAllocator::ConvertHeapType(const D3D12_HEAP_PROPERTIES& heapProperties, core::MemoryHeap& heapType)
+{
+	switch (heapProperties.Type)
+	{
+		case D3D12_HEAP_TYPE_DEFAULT : heapType = core::MemoryHeap::Default;  return true;
+		case D3D12_HEAP_TYPE_UPLOAD  : heapType = core::MemoryHeap::Upload;   return true;
+		case D3D12_HEAP_TYPE_READBACK: heapType = core::MemoryHeap::Readback; return true;
+		case D3D12_HEAP_TYPE_CUSTOM  :
+		{
+			// Only the custom heap used by GPUTexture (CPU write back, system memory) is pooled.
+			if (heapProperties.CPUPageProperty != D3D12_CPU_PAGE_PROPERTY_WRITE_BACK || heapProperties.MemoryPoolPreference != D3D12_MEMORY_POOL_L0)
+			{
+				return false;
+			}
+			heapType = core::MemoryHeap::Custom;
+			return true;
+		}
+		default: return false;
+	}
+}
+#pragma endregion Static Function
+
+#pragma region Protected Function
+/****************************************************************************
+*                       CreateMemoryBlock
+*************************************************************************//**
+*  @fn        gu::SharedPointer<core::RHIMemory> RHIMemoryAllocator::CreateMemoryBlock(const core::MemoryPoolKey& key, const gu::uint64 byteSize)
+*
+*  @brief     Create the ID3D12Heap for the pool. Return nullptr if the heap cannot be created (out of memory).
+*
+*  @param[in] const core::MemoryPoolKey& key
+*  @param[in] const gu::uint64 byteSize
+*
+*  @return    gu::SharedPointer<core::RHIMemory>
+*****************************************************************************/
+gu::SharedPointer<core::RHIMemory> RHIMemoryAllocator::CreateMemoryBlock(const core::MemoryPoolKey& key, const gu::uint64 byteSize)
+{
+	const auto dxDevice = _device->GetDevice();
+	if (!dxDevice) { return nullptr; }
+
+	/*-------------------------------------------------------------------
+	-            Heap flags
+	---------------------------------------------------------------------*/
+	D3D12_HEAP_FLAGS heapFlags = D3D12_HEAP_FLAG_NONE;
+	switch (key.Category)
+	{
+		case core::MemoryResourceCategory::Buffer             : heapFlags = D3D12_HEAP_FLAG_ALLOW_ONLY_BUFFERS;             break;
+		case core::MemoryResourceCategory::Texture            : heapFlags = D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES;  break;
+		case core::MemoryResourceCategory::RenderTargetTexture: heapFlags = D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES;      break;
+		default: break;
+	}
+
+	// Same rule as CreateCommittedResource : the render target and the depth stencil are always initialized by the first clear / discard.
+	if (_device->IsSupportedHeapNotZero() && key.Category != core::MemoryResourceCategory::RenderTargetTexture)
+	{
+		heapFlags |= D3D12_HEAP_FLAG_CREATE_NOT_ZEROED;
+	}
+
+	/*-------------------------------------------------------------------
+	-            Heap properties
+	---------------------------------------------------------------------*/
+	const HEAP_PROPERTY heapProperties = key.HeapType == core::MemoryHeap::Custom
+		? HEAP_PROPERTY(D3D12_CPU_PAGE_PROPERTY_WRITE_BACK, D3D12_MEMORY_POOL_L0)
+		: HEAP_PROPERTY(EnumConverter::Convert(key.HeapType));
+
+	const gu::uint64 alignment = key.Alignment > D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT
+		? D3D12_DEFAULT_MSAA_RESOURCE_PLACEMENT_ALIGNMENT : D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+
+	const HEAP_DESC heapDesc(byteSize, heapProperties, alignment, heapFlags);
+
+	HeapComPtr heap = nullptr;
+	if (FAILED(dxDevice->CreateHeap(&heapDesc, IID_PPV_ARGS(heap.GetAddressOf()))))
+	{
+		return nullptr;
+	}
+
+	return gu::StaticPointerCast<core::RHIMemory>(gu::MakeShared<directX12::RHIMemory>(gu::StaticPointerCast<core::RHIDevice>(_device), key.HeapType, heap));
+}
+
+/****************************************************************************
+*                       QueryDeviceBudget
+*************************************************************************//**
+*  @fn        bool RHIMemoryAllocator::QueryDeviceBudget(const core::MemoryHeap heapType, gu::uint64& budget, gu::uint64& usage) const
+*
+*  @brief     Default heap : local segment (VRAM), the others : non local segment (system memory)
+*             On the UMA device, everything is in the local segment.
+*
+*  @param[in]  const core::MemoryHeap heapType
+*  @param[out] gu::uint64& budget
+*  @param[out] gu::uint64& usage
+*
+*  @return    bool
+*****************************************************************************/
+bool RHIMemoryAllocator::QueryDeviceBudget(const core::MemoryHeap heapType, gu::uint64& budget, gu::uint64& usage) const
+{
+	const auto adapter = gu::StaticPointerCast<directX12::RHIDisplayAdapter>(_device->GetDisplayAdapter());
+	if (!adapter) { return false; }
+
+	ComPtr<IDXGIAdapter3> adapter3 = nullptr;
+	if (FAILED(adapter->GetAdapter().As(&adapter3))) { return false; }
+
+	const bool isLocal = heapType == core::MemoryHeap::Default || !_device->IsDiscreteGPU();
+
+	DXGI_QUERY_VIDEO_MEMORY_INFO info = {};
+	if (FAILED(adapter3->QueryVideoMemoryInfo(0, isLocal ? DXGI_MEMORY_SEGMENT_GROUP_LOCAL : DXGI_MEMORY_SEGMENT_GROUP_NON_LOCAL, &info)))
+	{
+		return false;
+	}
+
+	budget = info.Budget;
+	usage  = info.CurrentUsage;
+	return true;
+}
+#pragma endregion Protected Function
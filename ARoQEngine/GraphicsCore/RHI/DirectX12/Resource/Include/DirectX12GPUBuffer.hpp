@@ -12,6 +12,7 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUBuffer.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIMemoryAllocator.hpp"
 #include "GraphicsCore/RHI/DirectX12/Core/Include/DirectX12Core.hpp"
 #include <d3d12.h>
 //////////////////////////////////////////////////////////////////////////////////
@@ -71,6 +72,8 @@ namespace rhi::directX12
 
 		D3D12_GPU_VIRTUAL_ADDRESS GetDxGPUVirtualAddress() const { return _resource->GetGPUVirtualAddress(); }
 
+		gu::uint64 GetGPUVirtualAddress() const noexcept override { return _resource ? _resource->GetGPUVirtualAddress() : 0; }
+
 		void SetName(const gu::tstring& name) override;
 		
 		/****************************************************************************
@@ -95,6 +98,10 @@ namespace rhi::directX12
 		*****************************************************************************/
 		ResourceComPtr _resource = nullptr;
 		ResourceComPtr _intermediateBuffer = nullptr; // for default buffer
+
+		/* @brief : Placed range of the resources (invalid : committed resource)*/
+		core::MemoryAllocation _allocation             = {};
+		core::MemoryAllocation _intermediateAllocation = {};
 	};
 }
 #endif
\ No newline at end of file
@@ -41,6 +41,11 @@ namespace rhi::directX12
 		*  @brief : Resource Layout̔zCfbNXR}hXgƃoCh
 		/*----------------------------------------------------------------------*/
 		void Bind(const gu::SharedPointer<core::RHICommandList>& commandList, const gu::uint32 index, [[maybe_unused]]const gu::SharedPointer<core::RHIResourceLayout>& layout = nullptr) override;
+
+		/*----------------------------------------------------------------------
+		*  @brief : 萔obt@r[wobt@͈̔͂ύX܂. descriptorSlotƂɃfBXNv^mۂ܂
+		/*----------------------------------------------------------------------*/
+		void SetBufferRange(const gu::SharedPointer<core::GPUBuffer>& buffer, const gu::uint64 byteOffset, const gu::uint64 byteSize, const gu::uint32 descriptorSlot = 0) override;
 		
 		/****************************************************************************
 		**                Public Member Variables
@@ -90,6 +95,9 @@ namespace rhi::directX12
 		*****************************************************************************/
 		std::pair<core::DescriptorHeapType, gu::uint32> _heapOffset = {};
 		bool _hasCreated = false;
+
+		/* @brief : SetBufferRangeŎgpXbgƂ̃fBXNv^ID (Xbg0͍쐬̃fBXNv^L)*/
+		gu::DynamicArray<gu::uint32> _slotDescriptorIDs = {};
 	};
 }
 #endif
\ No newline at end of file
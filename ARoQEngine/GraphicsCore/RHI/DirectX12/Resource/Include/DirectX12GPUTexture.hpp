@@ -12,6 +12,7 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUTexture.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIMemoryAllocator.hpp"
 #include "GraphicsCore/RHI/DirectX12/Core/Include/DirectX12Core.hpp"
 #include <d3d12.h>
 //////////////////////////////////////////////////////////////////////////////////
@@ -53,6 +54,12 @@ namespace rhi::directX12
 		D3D12_GPU_VIRTUAL_ADDRESS GetGPUVirtualAddress() { return _resource->GetGPUVirtualAddress(); }
 		
 		void SetName(const gu::tstring& name) override;
+
+		/* @brief : Placed render target or depth stencil which has not been discarded or cleared since the placement.
+		            D3D12 requires the initialization before the first use because the heap range may be aliased.*/
+		bool RequiresInitialDiscard() const noexcept { return _requiresInitialDiscard; }
+
+		void OnInitialDiscarded() noexcept { _requiresInitialDiscard = false; }
 		
 		/****************************************************************************
 		**                Constructor and Destructor
@@ -83,10 +90,16 @@ namespace rhi::directX12
 		ResourceComPtr        _resource = nullptr;
 
 		ResourceComPtr        _stagingBuffer = nullptr; // KvȂȂ^C~OŎ̂Ă
+
+		/* @brief : Placed range of the resources (invalid : committed or external resource)*/
+		core::MemoryAllocation _allocation        = {};
+		core::MemoryAllocation _stagingAllocation = {};
 		
 		D3D12_RESOURCE_STATES _usageState = D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_COMMON;
 		
 		bool _hasAllocated = false;
+
+		bool _requiresInitialDiscard = false;
 	private:
 		/****************************************************************************
 		**                Private Function
@@ -71,13 +71,20 @@ GPUBuffer::GPUBuffer(const gu::SharedPointer<core::RHIDevice>& device, const cor
 	-           Create
 	---------------------------------------------------------------------*/
 	const auto dxDevice = static_cast<rhi::directX12::RHIDevice*>(_device.Get());
-	ThrowIfFailed( dxDevice->CreateCommittedResource(_resource, resourceDesc, heapProp, EnumConverter::Convert(metaData.State)));
+	ThrowIfFailed( dxDevice->CreateSubAllocatedResource(_resource, _allocation, resourceDesc, heapProp, EnumConverter::Convert(metaData.State)));
 
 	_resource->SetName(name.CString());
 }
 
 GPUBuffer::~GPUBuffer()
 {
+	if (_device)
+	{
+		const auto dxDevice = static_cast<rhi::directX12::RHIDevice*>(_device.Get());
+		dxDevice->ReleaseSubAllocatedResource(_intermediateBuffer, _intermediateAllocation);
+		dxDevice->ReleaseSubAllocatedResource(_resource, _allocation);
+	}
+
 	if (_intermediateBuffer) { _intermediateBuffer.Reset(); }
 	if (_resource)           { _resource.Reset(); }
 }
@@ -185,10 +192,11 @@ void GPUBuffer::Pack(const void* data, const gu::SharedPointer<core::RHICommandL
 
 		const auto uploadTempBuffer = RESOURCE_DESC::Buffer(GetTotalByteSize());
 
-		// CreateCommittedResource -> Heapm + ۂGPUɃނ𗼕Ă.
-		ThrowIfFailed(rhiDevice->CreateCommittedResource
+		// OPackō쐬ԃobt@͉ĂAbv[hq[vɔzu.
+		rhiDevice->ReleaseSubAllocatedResource(_intermediateBuffer, _intermediateAllocation);
+		ThrowIfFailed(rhiDevice->CreateSubAllocatedResource
 		(
-			_intermediateBuffer, uploadTempBuffer, uploadHeapProp, D3D12_RESOURCE_STATE_GENERIC_READ, nullptr)
+			_intermediateBuffer, _intermediateAllocation, uploadTempBuffer, uploadHeapProp, D3D12_RESOURCE_STATE_GENERIC_READ, nullptr)
 		);
 
 		_intermediateBuffer->SetName(L"Intermediate Buffer");
@@ -68,7 +68,15 @@ GPUResourceView::GPUResourceView(
 
 GPUResourceView::~GPUResourceView()
 {
-	if (_hasCreated)
+	if (!_slotDescriptorIDs.IsEmpty())
+	{
+		const auto dxHeap = gu::StaticPointerCast<directX12::RHIDescriptorHeap>(_heap);
+		for (const auto id : _slotDescriptorIDs)
+		{
+			dxHeap->Free(core::DescriptorHeapType::CBV, id);
+		}
+	}
+	else if (_hasCreated)
 	{
 		const auto heapType = _heapOffset.first;
 		const auto id       = _heapOffset.second;
@@ -113,6 +121,60 @@ void GPUResourceView::Bind(const gu::SharedPointer<core::RHICommandList>& comman
 	}
 }
 
+/****************************************************************************
+*                     SetBufferRange
+*************************************************************************//**
+*  @fn        void GPUResourceView::SetBufferRange(const gu::SharedPointer<core::GPUBuffer>& buffer, const gu::uint64 byteOffset, const gu::uint64 byteSize, const gu::uint32 descriptorSlot)
+*
+*  @brief     萔obt@r[wobt@͈̔͂ύX܂. 
+*             GPUÕt[œǂݍݒ̃fBXNv^㏑Ȃ悤, descriptorSlotƂɃfBXNv^܂.
+*
+*  @param[in] const gu::SharedPointer<core::GPUBuffer>& buffer
+*  @param[in] const gu::uint64 byteOffset (256 byte alignment)
+*  @param[in] const gu::uint64 byteSize
+*  @param[in] const gu::uint32 descriptorSlot
+*
+*  @return @@void
+*****************************************************************************/
+void GPUResourceView::SetBufferRange(const gu::SharedPointer<core::GPUBuffer>& buffer, const gu::uint64 byteOffset, const gu::uint64 byteSize, const gu::uint32 descriptorSlot)
+{
+#ifdef _DEBUG
+	assert(buffer);
+	assert(_resourceViewType == core::ResourceViewType::ConstantBuffer);
+	assert(byteOffset % D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT == 0);
+#endif
+
+	const auto heap = SelectDescriptorHeap(_resourceViewType);
+
+	/*-------------------------------------------------------------------
+	-             Allocate the descriptor of the slot
+	---------------------------------------------------------------------*/
+	if (_slotDescriptorIDs.IsEmpty() && _hasCreated)
+	{
+		_slotDescriptorIDs.Push(_heapOffset.second);
+	}
+	while (_slotDescriptorIDs.Size() <= descriptorSlot)
+	{
+		_slotDescriptorIDs.Push(heap->Allocate(core::DescriptorHeapType::CBV));
+	}
+
+	_buffer         = buffer;
+	_bufferOffset   = byteOffset;
+	_bufferByteSize = byteSize;
+	_heapOffset     = { core::DescriptorHeapType::CBV, _slotDescriptorIDs[descriptorSlot] };
+	_hasCreated     = true;
+
+	/*-------------------------------------------------------------------
+	-             Write the constant buffer view
+	---------------------------------------------------------------------*/
+	const auto dxDevice = gu::StaticPointerCast<directX12::RHIDevice>(_device)->GetDevice();
+
+	D3D12_CONSTANT_BUFFER_VIEW_DESC desc = {};
+	desc.BufferLocation = gu::StaticPointerCast<directX12::GPUBuffer>(_buffer)->GetDxGPUVirtualAddress() + byteOffset;
+	desc.SizeInBytes    = static_cast<UINT>((byteSize + D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT - 1) & ~static_cast<gu::uint64>(D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT - 1));
+
+	dxDevice->CreateConstantBufferView(&desc, heap->GetCPUDescHandler(core::DescriptorHeapType::CBV, _heapOffset.second));
+}
 #pragma endregion Bind Function
 #pragma region Setup view
 void GPUResourceView::CreateView(const gu::SharedPointer<directX12::RHIDescriptorHeap>& heap)
@@ -86,6 +86,13 @@ GPUTexture::GPUTexture(const gu::SharedPointer<core::RHIDevice>& device, const c
 
 GPUTexture::~GPUTexture()
 {
+	if (_device)
+	{
+		const auto rhiDevice = static_cast<directX12::RHIDevice*>(_device.Get());
+		rhiDevice->ReleaseSubAllocatedResource(_stagingBuffer, _stagingAllocation);
+		rhiDevice->ReleaseSubAllocatedResource(_resource, _allocation);
+	}
+
 	if (_stagingBuffer) { _stagingBuffer.Reset(); }
 	if (_resource) { _resource.Reset(); }
 }
@@ -220,14 +227,16 @@ void GPUTexture::Load(const gu::tstring& filePath, const gu::SharedPointer<core:
 		D3D12_HEAP_PROPERTIES heapProperty = HEAP_PROPERTY(D3D12_HEAP_TYPE_UPLOAD);
 		D3D12_RESOURCE_DESC   uploadDesc = RESOURCE_DESC::Buffer(uploadBufferSize);
 		
-		dxDevice->CreateCommittedResource(
-			&heapProperty,
-			D3D12_HEAP_FLAG_NONE,
-			&uploadDesc,
+		const auto rhiDevice = static_cast<directX12::RHIDevice*>(_device.Get());
+		rhiDevice->ReleaseSubAllocatedResource(_stagingBuffer, _stagingAllocation);
+		ThrowIfFailed(rhiDevice->CreateSubAllocatedResource(
+			_stagingBuffer,
+			_stagingAllocation,
+			uploadDesc,
+			heapProperty,
 			D3D12_RESOURCE_STATE_GENERIC_READ,
-			nullptr,
-			IID_PPV_ARGS(_stagingBuffer.GetAddressOf())
-		);
+			nullptr
+		));
 
 		/*-------------------------------------------------------------------
 		-                 Copy Texture Data
@@ -304,11 +313,12 @@ void GPUTexture::Write(const gu::SharedPointer<core::RHICommandList>& commandLis
 	// Acquire heap property
 	const D3D12_HEAP_PROPERTIES heapProperty = HEAP_PROPERTY(D3D12_HEAP_TYPE_DEFAULT);
 
-	// Create Heap + Allocate gpu resource
-	ThrowIfFailed(dxDevice->CreateCommittedResource(
-		&heapProperty, D3D12_HEAP_FLAG_NONE, &resourceDesc, EnumConverter::Convert(_metaData.State),
-		nullptr,
-		IID_PPV_ARGS(_resource.GetAddressOf())));
+	// Allocate gpu resource in the pooled heap
+	const auto rhiDevice = static_cast<directX12::RHIDevice*>(_device.Get());
+	rhiDevice->ReleaseSubAllocatedResource(_resource, _allocation);
+	ThrowIfFailed(rhiDevice->CreateSubAllocatedResource(
+		_resource, _allocation, resourceDesc, heapProperty, EnumConverter::Convert(_metaData.State),
+		nullptr));
 
 	/*-------------------------------------------------------------------
 	-      To copy cpu memory data into our default buffer, we need to create an intermediate upload heap
@@ -544,11 +554,21 @@ void GPUTexture::AllocateGPUTextureBuffer(const D3D12_RESOURCE_DESC& resourceDes
 		clearValue.DepthStencil.Stencil = _metaData.ClearColor.Stencil;
 	}
 
-	ThrowIfFailed(dxDevice->CreateCommittedResource(
-		&heapProperty, D3D12_HEAP_FLAG_NONE, &resourceDesc, EnumConverter::Convert(_metaData.State),
-		gu::HasAnyFlags(_metaData.ResourceUsage, core::ResourceUsage::RenderTarget) ||
-		gu::HasAnyFlags(_metaData.ResourceUsage, core::ResourceUsage::DepthStencil) ? &clearValue : nullptr,
-		IID_PPV_ARGS(_resource.GetAddressOf())));
+	/*-------------------------------------------------------------------
+	-             Place the texture (render targets use the buddy pools)
+	---------------------------------------------------------------------*/
+	const bool isRenderTarget = gu::HasAnyFlags(_metaData.ResourceUsage, core::ResourceUsage::RenderTarget) ||
+		gu::HasAnyFlags(_metaData.ResourceUsage, core::ResourceUsage::DepthStencil);
+
+	const auto rhiDevice = static_cast<directX12::RHIDevice*>(_device.Get());
+	rhiDevice->ReleaseSubAllocatedResource(_resource, _allocation);
+	ThrowIfFailed(rhiDevice->CreateSubAllocatedResource(
+		_resource, _allocation, resourceDesc, heapProperty, EnumConverter::Convert(_metaData.State),
+		isRenderTarget ? &clearValue : nullptr,
+		isRenderTarget ? core::MemoryAllocationStrategy::RenderTarget : core::MemoryAllocationStrategy::General));
+
+	// The committed resource is initialized by the driver, the placed one is not.
+	_requiresInitialDiscard = isRenderTarget && _allocation.IsValid();
 
 	/*-------------------------------------------------------------------
 	-             Get total byte size and alighment size
@@ -99,6 +99,12 @@ namespace rhi::core
 		*  @brief :  End the query to get GPU information.
 		/*----------------------------------------------------------------------*/
 		virtual void EndQuery(const QueryResultLocation& location) = 0;
+
+		/*----------------------------------------------------------------------
+		*  @brief :  Copy the query results [location.QueryID, location.QueryID + queryCount) into the readback buffer of the query heap.
+		*            The result can be read from the CPU after the command list has finished on the GPU.
+		/*----------------------------------------------------------------------*/
+		virtual void ResolveQueryData(const QueryResultLocation& location, const gu::uint32 queryCount) = 0;
 #pragma endregion Query
 
 #pragma region Graphics Command Function
@@ -119,6 +125,9 @@ namespace rhi::core
 		virtual void SetViewportAndScissor(const Viewport& viewport, const ScissorRect& rect)       = 0;
 		
 		virtual void SetVertexBuffer      (const gu::SharedPointer<GPUBuffer>& buffer) = 0;
+
+		/* @brief : Bind the byte range of the buffer as the vertex buffer (e.g. the allocation of the upload ring)*/
+		virtual void SetVertexBuffer      (const gu::SharedPointer<GPUBuffer>& buffer, const gu::uint64 byteOffset, const gu::uint64 byteSize, const gu::uint32 stride) = 0;
 		
 		virtual void SetVertexBuffers     (const gu::DynamicArray<gu::SharedPointer<GPUBuffer>>& buffers, const size_t startSlot = 0) = 0;
 		
@@ -173,6 +182,12 @@ namespace rhi::core
 		*           GPUmemcpy
 		/*----------------------------------------------------------------------*/
 		virtual void CopyBufferRegion(const gu::SharedPointer<GPUBuffer>& dest, const gu::uint64 destOffset, const gu::SharedPointer<GPUBuffer>& source, const gu::uint64 sourceOffset, const gu::uint64 copyByteSize) = 0;
+
+		/*----------------------------------------------------------------------
+		*  @brief : sourcemip0Ŝdestmip0(destX, destY)ɃRs[. eNX`AgX̍\zɎgp܂
+		*           ̃eNX`͓sNZtH[}bgłKv܂. `pX̊OŌĂяoĂ
+		/*----------------------------------------------------------------------*/
+		virtual void CopyTextureRegion(const gu::SharedPointer<GPUTexture>& dest, const gu::uint32 destX, const gu::uint32 destY, const gu::SharedPointer<GPUTexture>& source) = 0;
 #pragma endregion Copys
 		/*-------------------------------------------------------------------
 		-                Transition layout
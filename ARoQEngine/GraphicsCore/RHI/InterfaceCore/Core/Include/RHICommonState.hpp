@@ -34,7 +34,8 @@ namespace rhi::core
 	{
 		Unknown    = 0,
 		DirectX12  = 1,
-		Vulkan     = 2
+		Vulkan     = 2,
+		Null       = 3  // headless (CPU side benchmark)
 	};
 #pragma endregion           API
 #pragma region CommandList
@@ -79,6 +80,10 @@ namespace rhi::core
 		R32G32B32_FLOAT,    // 12 byte format
 		R32G32B32A32_FLOAT, // 16 byte format
 		R32G32B32A32_INT,   // 16 byte format
+		R16G16_FLOAT,       // 4  byte format (half2)
+		R16G16_SNORM,       // 4  byte format (octahedral normal)
+		R16G16B16A16_UINT,  // 8  byte format (bone indices)
+		R8G8B8A8_UNORM,     // 4  byte format (color, bone weights)
 	};
 	class InputFormatSizeOf
 	{
@@ -92,7 +97,11 @@ namespace rhi::core
 				case InputFormat::R32G32B32_FLOAT   : return 12;
 				case InputFormat::R32G32B32A32_INT  :
 				case InputFormat::R32G32B32A32_FLOAT: return 16;
-				case InputFormat::R32_FLOAT         : return 4;
+				case InputFormat::R16G16B16A16_UINT : return 8;
+				case InputFormat::R32_FLOAT         :
+				case InputFormat::R16G16_FLOAT      :
+				case InputFormat::R16G16_SNORM      :
+				case InputFormat::R8G8B8A8_UNORM    : return 4;
 				default: return 0;
 			}
 		}
@@ -54,6 +54,7 @@ namespace rhi::core
 	class GPUBuffer;
 	class GPUTexture;
 	class RHIQuery;
+	class RHIMemoryAllocator;
 	class GPUPipelineFactory;
 	class RayTracingGeometry;
 	class BLASBuffer;
@@ -151,6 +152,9 @@ namespace rhi::core
 		virtual gu::uint32 GetShadingRateImageTileSize() const = 0;
 		
 		gu::SharedPointer<RHIDisplayAdapter> GetDisplayAdapter() const noexcept { return _adapter; }
+
+		/* @brief : GPU memory sub-allocator for the placed resources. nullptr before SetUpDefaultHeap and after Destroy*/
+		gu::SharedPointer<RHIMemoryAllocator> GetMemoryAllocator() const noexcept { return _memoryAllocator; }
 		
 		/*----------------------------------------------------------------------
 		*  @brief : DevicegpƂɂǂGPUgp邩̃rbg}XN擾܂
@@ -219,6 +223,9 @@ namespace rhi::core
 
 		// @brief : GPŨCfbNX
 		RHIMultiGPUMask _gpuMask = RHIMultiGPUMask::SingleGPU();
+
+		/* @brief : Created by the backend in SetUpDefaultHeap*/
+		gu::SharedPointer<RHIMemoryAllocator> _memoryAllocator = nullptr;
 	};
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,279 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   RHIMemoryAllocator.hpp
+///             @brief  GPU memory sub-allocator. Large RHIMemory blocks are created per pool
+///                     and the resources are placed into them at the offset chosen by the CPU side allocator.
+///                     General      : TLSF, for the buffers and the textures
+///                     RenderTarget : buddy, for the render targets and the depth stencils
+///                     Linear       : bump pointer, for the per frame data (freed by ResetLinearPools)
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef RHI_MEMORY_ALLOCATOR_HPP
+#define RHI_MEMORY_ALLOCATOR_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIMemory.hpp"
+#include "GameUtility/Memory/Include/GUOffsetAllocator.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+#include <mutex>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::core
+{
+	/****************************************************************************
+	*				  			MemoryAllocationStrategy
+	*************************************************************************//**
+	*  @enum      MemoryAllocationStrategy
+	*  @brief     Offset allocator used in the pool
+	*****************************************************************************/
+	enum class MemoryAllocationStrategy : gu::uint8
+	{
+		General,      // TLSF
+		RenderTarget, // Buddy
+		Linear,       // Bump pointer. Free does nothing, ResetLinearPools frees all.
+		CountOf
+	};
+
+	/****************************************************************************
+	*				  			MemoryResourceCategory
+	*************************************************************************//**
+	*  @enum      MemoryResourceCategory
+	*  @brief     Resources of the different category are never placed into the same block.
+	*             (DirectX12 resource heap tier 1 / Vulkan bufferImageGranularity)
+	*****************************************************************************/
+	enum class MemoryResourceCategory : gu::uint8
+	{
+		Buffer,
+		Texture,
+		RenderTargetTexture,
+		CountOf
+	};
+
+	/****************************************************************************
+	*				  			MemoryAllocationDesc
+	*************************************************************************//**
+	*  @struct    MemoryAllocationDesc
+	*  @brief     Allocation request
+	*****************************************************************************/
+	struct MemoryAllocationDesc
+	{
+		/* @brief : Required byte size of the resource*/
+		gu::uint64 ByteSize = 0;
+
+		/* @brief : Required alignment of the resource (power of two)*/
+		gu::uint64 Alignment = 1;
+
+		/* @brief : Vulkan memory type index (DirectX12 : 0)*/
+		gu::uint32 MemoryTypeIndex = 0;
+
+		MemoryHeap               HeapType = MemoryHeap::Default;
+		MemoryResourceCategory   Category = MemoryResourceCategory::Buffer;
+		MemoryAllocationStrategy Strategy = MemoryAllocationStrategy::General;
+	};
+
+	/****************************************************************************
+	*				  			MemoryPoolKey
+	*************************************************************************//**
+	*  @struct    MemoryPoolKey
+	*  @brief     The blocks are shared by the allocations having the same key.
+	*             Alignment is the alignment class of the pool (the heap alignment of the block).
+	*****************************************************************************/
+	struct MemoryPoolKey
+	{
+		MemoryHeap               HeapType        = MemoryHeap::Default;
+		MemoryResourceCategory   Category        = MemoryResourceCategory::Buffer;
+		MemoryAllocationStrategy Strategy        = MemoryAllocationStrategy::General;
+		gu::uint32               MemoryTypeIndex = 0;
+		gu::uint64               Alignment       = 0;
+
+		bool operator==(const MemoryPoolKey& other) const noexcept
+		{
+			return HeapType == other.HeapType && Category == other.Category && Strategy == other.Strategy
+				&& MemoryTypeIndex == other.MemoryTypeIndex && Alignment == other.Alignment;
+		}
+	};
+
+	/****************************************************************************
+	*				  			MemoryAllocation
+	*************************************************************************//**
+	*  @struct    MemoryAllocation
+	*  @brief     Place the resource at Offset of Memory, and pass this back to RHIMemoryAllocator::Free.
+	*             Memory is owned by the allocator and is alive until the allocation is freed.
+	*****************************************************************************/
+	struct MemoryAllocation
+	{
+		RHIMemory* Memory = nullptr;
+
+		gu::uint64 Offset = 0;
+
+		gu::uint64 Size = 0;
+
+		/* @brief : Allocator internal*/
+		gu::uint32 PoolIndex = 0;
+		gu::uint64 BlockID   = 0;
+		gu::OffsetAllocation Range = {};
+
+		bool IsValid() const noexcept { return Memory != nullptr; }
+	};
+
+	/****************************************************************************
+	*				  			MemoryBudget
+	*************************************************************************//**
+	*  @struct    MemoryBudget
+	*  @brief     Memory usage of the heap type
+	*****************************************************************************/
+	struct MemoryBudget
+	{
+		/* @brief : Reported by the OS / driver (0 : unknown)*/
+		gu::uint64 BudgetBytes = 0;
+		gu::uint64 UsageBytes  = 0;
+
+		/* @brief : Total size of the blocks created by this allocator*/
+		gu::uint64 ReservedBytes = 0;
+
+		/* @brief : Bytes handed out to the resources*/
+		gu::uint64 AllocatedBytes = 0;
+
+		gu::uint32 BlockCount      = 0;
+		gu::uint32 AllocationCount = 0;
+	};
+
+	/****************************************************************************
+	*				  			MemoryDefragmentationHint
+	*************************************************************************//**
+	*  @struct    MemoryDefragmentationHint
+	*  @brief     Block which should be emptied by moving its resources to the other blocks of the same pool.
+	*             The allocator never moves the resources itself.
+	*****************************************************************************/
+	struct MemoryDefragmentationHint
+	{
+		RHIMemory*               Memory          = nullptr;
+		MemoryPoolKey            PoolKey         = {};
+		gu::uint64               BlockBytes      = 0;
+		gu::uint64               AllocatedBytes  = 0;
+		gu::uint32               AllocationCount = 0;
+		float                    Utilization     = 0.0f;
+		float                    Fragmentation   = 0.0f;
+	};
+
+	/****************************************************************************
+	*				  			RHIMemoryAllocator
+	*************************************************************************//**
+	*  @class     RHIMemoryAllocator
+	*  @brief     Backend independent part of the GPU memory sub-allocator (thread safe).
+	*             The backend creates the blocks (CreateMemoryBlock) and reports the OS budget (QueryDeviceBudget).
+	*             The allocation larger than half of the block size gets its own dedicated block.
+	*             At most one empty block is kept in each pool to avoid creating the heap every frame.
+	*****************************************************************************/
+	class RHIMemoryAllocator : public gu::NonCopyable
+	{
+	public:
+		/****************************************************************************
+		**                Static Configuration
+		*****************************************************************************/
+		static constexpr gu::uint64 DEFAULT_BLOCK_SIZE       = 64ull  * 1024 * 1024;
+		static constexpr gu::uint64 RENDER_TARGET_BLOCK_SIZE = 128ull * 1024 * 1024;
+		static constexpr gu::uint64 LINEAR_BLOCK_SIZE        = 16ull  * 1024 * 1024;
+
+		/* @brief : Min block size of the buddy pools*/
+		static constexpr gu::uint64 RENDER_TARGET_MIN_BLOCK_SIZE = 64ull * 1024;
+
+		/* @brief : Alignment classes. The request is put into the smallest class holding its alignment.*/
+		static constexpr gu::uint64 SMALL_ALIGNMENT         = 256;
+		static constexpr gu::uint64 SMALL_TEXTURE_ALIGNMENT = 4ull  * 1024;
+		static constexpr gu::uint64 DEFAULT_ALIGNMENT       = 64ull * 1024;
+
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Return the invalid allocation if the block cannot be created (the caller falls back to the committed resource)*/
+		MemoryAllocation Allocate(const MemoryAllocationDesc& desc);
+
+		void Free(const MemoryAllocation& allocation);
+
+		/* @brief : Free all allocations of the linear pools. Call after the GPU has finished using them.*/
+		void ResetLinearPools();
+
+		/* @brief : Release all blocks. The outstanding allocations become invalid.*/
+		void ReleaseAll();
+
+		/* @brief : Blocks whose utilization is lower than maxUtilization in the pools having two or more blocks (lowest first)*/
+		gu::DynamicArray<MemoryDefragmentationHint> GetDefragmentationHints(const float maxUtilization = 0.25f) const;
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		MemoryBudget GetBudget(const MemoryHeap heapType) const;
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		virtual ~RHIMemoryAllocator();
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+		RHIMemoryAllocator() = default;
+
+		/* @brief : Create the heap (DirectX12) / device memory (Vulkan) used as the block. Return nullptr on failure.*/
+		virtual gu::SharedPointer<RHIMemory> CreateMemoryBlock(const MemoryPoolKey& key, const gu::uint64 byteSize) = 0;
+
+		/* @brief : OS budget and usage of the heap type. Return false if unknown.*/
+		virtual bool QueryDeviceBudget([[maybe_unused]] const MemoryHeap heapType, [[maybe_unused]] gu::uint64& budget, [[maybe_unused]] gu::uint64& usage) const { return false; }
+
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		struct Block
+		{
+			gu::SharedPointer<RHIMemory> Memory = nullptr;
+
+			gu::uint64 ID       = 0;
+			gu::uint64 ByteSize = 0;
+
+			/* @brief : Only the allocator of the pool strategy is initialized*/
+			gu::TLSFAllocator   TLSF   = {};
+			gu::BuddyAllocator  Buddy  = {};
+			gu::LinearAllocator Linear = {};
+
+			/* @brief : Dedicated block has exactly one allocation covering the whole block*/
+			bool IsDedicated = false;
+
+			gu::uint32 AllocationCount = 0;
+		};
+
+		struct Pool
+		{
+			MemoryPoolKey Key = {};
+
+			gu::DynamicArray<gu::SharedPointer<Block>> Blocks = {};
+		};
+
+		gu::uint32 FindOrCreatePool(const MemoryPoolKey& key);
+
+		gu::SharedPointer<Block> CreateBlock(const MemoryPoolKey& key, const gu::uint64 byteSize, const bool isDedicated);
+
+		static gu::OffsetAllocation AllocateInBlock(Block& block, const MemoryAllocationStrategy strategy, const gu::uint64 byteSize, const gu::uint64 alignment);
+
+		static gu::OffsetAllocatorStatistics GetBlockStatistics(const Block& block, const MemoryAllocationStrategy strategy);
+
+		static gu::uint64 GetBlockSize(const MemoryAllocationStrategy strategy);
+
+		mutable std::mutex _mutex = {};
+
+		gu::DynamicArray<Pool> _pools = {};
+
+		gu::uint64 _nextBlockID = 1;
+	};
+}
+#endif
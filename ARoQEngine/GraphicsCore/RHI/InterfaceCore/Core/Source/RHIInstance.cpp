@@ -13,6 +13,8 @@
 #include "GraphicsCore/RHI/DirectX12/Core/Include/DirectX12Instance.hpp"
 // Vulkan
 #include "GraphicsCore/RHI/Vulkan/Core/Include/VulkanInstance.hpp"
+// Null
+#include "GraphicsCore/RHI/Null/Core/Include/NullInstance.hpp"
 
 // common
 #include <stdexcept>
@@ -31,6 +33,7 @@ gu::SharedPointer<RHIInstance> rhi::core::RHIInstance::CreateInstance(const rhi:
 	{
 		case APIVersion::DirectX12: { std::cout << "DirectX12" << std::endl; return gu::MakeShared<rhi::directX12::RHIInstance>(enableCPUDebugger,enableGPUDebugger, useGPUDebugBreak);}
 		case APIVersion::Vulkan:    { std::cout << "Vulkan"    << std::endl; return gu::MakeShared<rhi::vulkan::RHIInstance>(enableCPUDebugger, enableGPUDebugger, useGPUDebugBreak); }
+		case APIVersion::Null:      { std::cout << "Null"      << std::endl; return gu::MakeShared<rhi::null::RHIInstance>(enableCPUDebugger, enableGPUDebugger, useGPUDebugBreak); }
 		default: { throw std::runtime_error("Unknown API."); }
 	}
 }
@@ -0,0 +1,378 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   RHIMemoryAllocator.cpp
+///             @brief  GPU memory sub-allocator
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIMemoryAllocator.hpp"
+#include <algorithm>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi::core;
+
+namespace
+{
+	inline gu::uint64 AlignUp(const gu::uint64 value, const gu::uint64 alignment)
+	{
+		return (value + alignment - 1) & ~(alignment - 1);
+	}
+
+	inline gu::uint64 NextPowerOfTwo(const gu::uint64 value)
+	{
+		gu::uint64 result = 1;
+		while (result < value) { result <<= 1; }
+		return result;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+RHIMemoryAllocator::~RHIMemoryAllocator()
+{
+	ReleaseAll();
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Public Function
+/****************************************************************************
+*                       Allocate
+*************************************************************************//**
+*  @fn        MemoryAllocation RHIMemoryAllocator::Allocate(const MemoryAllocationDesc& desc)
+*
+*  @brief     Find the pool of the alignment class and take the range from the first block having the space.
+*             A new block is created when no block has the space.
+*
+*  @param[in] const MemoryAllocationDesc& desc
+*
+*  @return    MemoryAllocation (invalid : the block could not be created)
+*****************************************************************************/
+MemoryAllocation RHIMemoryAllocator::Allocate(const MemoryAllocationDesc& desc)
+{
+	if (desc.ByteSize == 0) { return MemoryAllocation(); }
+
+	/*-------------------------------------------------------------------
+	-   Alignment class
+	---------------------------------------------------------------------*/
+	const gu::uint64 alignment = NextPowerOfTwo(desc.Alignment == 0 ? 1 : desc.Alignment);
+
+	MemoryPoolKey key = {};
+	key.HeapType        = desc.HeapType;
+	key.Category        = desc.Category;
+	key.Strategy        = desc.Strategy;
+	key.MemoryTypeIndex = desc.MemoryTypeIndex;
+	if      (alignment <= SMALL_ALIGNMENT && desc.Category == MemoryResourceCategory::Buffer) { key.Alignment = SMALL_ALIGNMENT; }
+	else if (alignment <= SMALL_TEXTURE_ALIGNMENT)                                            { key.Alignment = SMALL_TEXTURE_ALIGNMENT; }
+	else if (alignment <= DEFAULT_ALIGNMENT)                                                  { key.Alignment = DEFAULT_ALIGNMENT; }
+	else                                                                                      { key.Alignment = alignment; }
+
+	const gu::uint64 blockSize = GetBlockSize(desc.Strategy);
+
+	std::scoped_lock lock(_mutex);
+
+	const gu::uint32 poolIndex = FindOrCreatePool(key);
+	Pool& pool = _pools[poolIndex];
+
+	MemoryAllocation allocation = {};
+	allocation.PoolIndex = poolIndex;
+
+	/*-------------------------------------------------------------------
+	-   Large request : the dedicated block
+	---------------------------------------------------------------------*/
+	if (desc.ByteSize > blockSize / 2)
+	{
+		auto block = CreateBlock(key, AlignUp(desc.ByteSize, key.Alignment), true);
+		if (!block) { return MemoryAllocation(); }
+
+		block->AllocationCount = 1;
+		pool.Blocks.Push(block);
+
+		allocation.Memory  = block->Memory.Get();
+		allocation.BlockID = block->ID;
+		allocation.Offset  = 0;
+		allocation.Size    = block->ByteSize;
+		allocation.Range   = gu::OffsetAllocation{ 0, block->ByteSize, 0 };
+		return allocation;
+	}
+
+	/*-------------------------------------------------------------------
+	-   Sub-allocate from the existing blocks
+	---------------------------------------------------------------------*/
+	for (gu::uint64 i = 0; i < pool.Blocks.Size(); ++i)
+	{
+		Block& block = *pool.Blocks[i];
+		if (block.IsDedicated) { continue; }
+
+		const auto range = AllocateInBlock(block, key.Strategy, desc.ByteSize, alignment);
+		if (!range.IsValid()) { continue; }
+
+		block.AllocationCount++;
+		allocation.Memory  = block.Memory.Get();
+		allocation.BlockID = block.ID;
+		allocation.Offset  = range.Offset;
+		allocation.Size    = range.Size;
+		allocation.Range   = range;
+		return allocation;
+	}
+
+	/*-------------------------------------------------------------------
+	-   Create the new block
+	---------------------------------------------------------------------*/
+	auto block = CreateBlock(key, blockSize, false);
+	if (!block) { return MemoryAllocation(); }
+
+	const auto range = AllocateInBlock(*block, key.Strategy, desc.ByteSize, alignment);
+	if (!range.IsValid()) { return MemoryAllocation(); }
+
+	block->AllocationCount = 1;
+	pool.Blocks.Push(block);
+
+	allocation.Memory  = block->Memory.Get();
+	allocation.BlockID = block->ID;
+	allocation.Offset  = range.Offset;
+	allocation.Size    = range.Size;
+	allocation.Range   = range;
+	return allocation;
+}
+
+/****************************************************************************
+*                       Free
+*************************************************************************//**
+*  @fn        void RHIMemoryAllocator::Free(const MemoryAllocation& allocation)
+*
+*  @brief     Return the range to the block. The dedicated block and the second empty block of the pool are released.
+*             The linear allocation is freed by ResetLinearPools.
+*
+*  @param[in] const MemoryAllocation& allocation
+*
+*  @return    void
+*****************************************************************************/
+void RHIMemoryAllocator::Free(const MemoryAllocation& allocation)
+{
+	if (!allocation.IsValid()) { return; }
+
+	std::scoped_lock lock(_mutex);
+	if (allocation.PoolIndex >= _pools.Size()) { return; }
+
+	Pool& pool = _pools[allocation.PoolIndex];
+	if (pool.Key.Strategy == MemoryAllocationStrategy::Linear) { return; }
+
+	for (gu::uint64 i = 0; i < pool.Blocks.Size(); ++i)
+	{
+		Block& block = *pool.Blocks[i];
+		if (block.ID != allocation.BlockID) { continue; }
+
+		block.AllocationCount--;
+		if (block.IsDedicated) { pool.Blocks.RemoveAt(i); return; }
+
+		if (pool.Key.Strategy == MemoryAllocationStrategy::RenderTarget) { block.Buddy.Free(allocation.Range); }
+		else                                                             { block.TLSF .Free(allocation.Range); }
+
+		/*-------------------------------------------------------------------
+		-   Keep only one empty block
+		---------------------------------------------------------------------*/
+		if (block.AllocationCount == 0)
+		{
+			for (gu::uint64 j = 0; j < pool.Blocks.Size(); ++j)
+			{
+				if (j != i && !pool.Blocks[j]->IsDedicated && pool.Blocks[j]->AllocationCount == 0)
+				{
+					pool.Blocks.RemoveAt(i);
+					break;
+				}
+			}
+		}
+		return;
+	}
+}
+
+/****************************************************************************
+*                       ResetLinearPools
+*************************************************************************//**
+*  @fn        void RHIMemoryAllocator::ResetLinearPools()
+*
+*  @brief     Free all allocations of the linear pools. The blocks are kept for the next frame.
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
+void RHIMemoryAllocator::ResetLinearPools()
+{
+	std::scoped_lock lock(_mutex);
+
+	for (auto& pool : _pools)
+	{
+		if (pool.Key.Strategy != MemoryAllocationStrategy::Linear) { continue; }
+
+		for (gu::uint64 i = 0; i < pool.Blocks.Size();)
+		{
+			if (pool.Blocks[i]->IsDedicated) { pool.Blocks.RemoveAt(i); continue; }
+
+			pool.Blocks[i]->Linear.Reset();
+			pool.Blocks[i]->AllocationCount = 0;
+			++i;
+		}
+	}
+}
+
+void RHIMemoryAllocator::ReleaseAll()
+{
+	std::scoped_lock lock(_mutex);
+	_pools.Clear();
+}
+
+/****************************************************************************
+*                       GetDefragmentationHints
+*************************************************************************//**
+*  @fn        gu::DynamicArray<MemoryDefragmentationHint> RHIMemoryAllocator::GetDefragmentationHints(const float maxUtilization) const
+*
+*  @brief     Moving the resources out of the sparse block lets Free release it.
+*             The caller recreates the listed resources (they will be placed into the denser blocks first).
+*
+*  @param[in] const float maxUtilization
+*
+*  @return    gu::DynamicArray<MemoryDefragmentationHint> (lowest utilization first)
+*****************************************************************************/
+gu::DynamicArray<MemoryDefragmentationHint> RHIMemoryAllocator::GetDefragmentationHints(const float maxUtilization) const
+{
+	std::scoped_lock lock(_mutex);
+
+	gu::DynamicArray<MemoryDefragmentationHint> hints = {};
+	for (const auto& pool : _pools)
+	{
+		if (pool.Key.Strategy == MemoryAllocationStrategy::Linear) { continue; }
+
+		gu::uint32 sharedBlockCount = 0;
+		for (const auto& block : pool.Blocks) { if (!block->IsDedicated) { sharedBlockCount++; } }
+		if (sharedBlockCount < 2) { continue; }
+
+		for (const auto& block : pool.Blocks)
+		{
+			if (block->IsDedicated || block->AllocationCount == 0) { continue; }
+
+			const auto statistics = GetBlockStatistics(*block, pool.Key.Strategy);
+			if (statistics.GetUtilization() > maxUtilization) { continue; }
+
+			MemoryDefragmentationHint hint = {};
+			hint.Memory          = block->Memory.Get();
+			hint.PoolKey         = pool.Key;
+			hint.BlockBytes      = block->ByteSize;
+			hint.AllocatedBytes  = statistics.UsedSize;
+			hint.AllocationCount = block->AllocationCount;
+			hint.Utilization     = statistics.GetUtilization();
+			hint.Fragmentation   = statistics.GetFragmentation();
+			hints.Push(hint);
+		}
+	}
+
+	std::sort(hints.Data(), hints.Data() + hints.Size(), [](const MemoryDefragmentationHint& left, const MemoryDefragmentationHint& right)
+	{
+		return left.Utilization < right.Utilization;
+	});
+	return hints;
+}
+#pragma endregion Public Function
+
+#pragma region Public Member Variables
+MemoryBudget RHIMemoryAllocator::GetBudget(const MemoryHeap heapType) const
+{
+	MemoryBudget budget = {};
+	QueryDeviceBudget(heapType, budget.BudgetBytes, budget.UsageBytes);
+
+	std::scoped_lock lock(_mutex);
+	for (const auto& pool : _pools)
+	{
+		if (pool.Key.HeapType != heapType) { continue; }
+
+		for (const auto& block : pool.Blocks)
+		{
+			budget.ReservedBytes   += block->ByteSize;
+			budget.AllocatedBytes  += block->IsDedicated ? block->ByteSize : GetBlockStatistics(*block, pool.Key.Strategy).UsedSize;
+			budget.AllocationCount += block->AllocationCount;
+			budget.BlockCount++;
+		}
+	}
+	return budget;
+}
+#pragma endregion Public Member Variables
+
+#pragma region Protected Function
+gu::uint32 RHIMemoryAllocator::FindOrCreatePool(const MemoryPoolKey& key)
+{
+	for (gu::uint64 i = 0; i < _pools.Size(); ++i)
+	{
+		if (_pools[i].Key == key) { return static_cast<gu::uint32>(i); }
+	}
+
+	Pool pool = {};
+	pool.Key = key;
+	_pools.Push(pool);
+	return static_cast<gu::uint32>(_pools.Size() - 1);
+}
+
+gu::SharedPointer<RHIMemoryAllocator::Block> RHIMemoryAllocator::CreateBlock(const MemoryPoolKey& key, const gu::uint64 byteSize, const bool isDedicated)
+{
+	const auto memory = CreateMemoryBlock(key, byteSize);
+	if (!memory) { return nullptr; }
+
+	auto block = gu::MakeShared<Block>();
+	block->Memory      = memory;
+	block->ID          = _nextBlockID++;
+	block->ByteSize    = byteSize;
+	block->IsDedicated = isDedicated;
+
+	if (isDedicated) { return block; }
+
+	switch (key.Strategy)
+	{
+		case MemoryAllocationStrategy::General:
+			block->TLSF = gu::TLSFAllocator(byteSize, key.Alignment);
+			break;
+		case MemoryAllocationStrategy::RenderTarget:
+			block->Buddy = gu::BuddyAllocator(byteSize, key.Alignment > RENDER_TARGET_MIN_BLOCK_SIZE ? key.Alignment : RENDER_TARGET_MIN_BLOCK_SIZE);
+			break;
+		default:
+			block->Linear = gu::LinearAllocator(byteSize);
+			break;
+	}
+	return block;
+}
+
+gu::OffsetAllocation RHIMemoryAllocator::AllocateInBlock(Block& block, const MemoryAllocationStrategy strategy, const gu::uint64 byteSize, const gu::uint64 alignment)
+{
+	switch (strategy)
+	{
+		case MemoryAllocationStrategy::General     : return block.TLSF  .Allocate(byteSize, alignment);
+		case MemoryAllocationStrategy::RenderTarget: return block.Buddy .Allocate(byteSize, alignment);
+		default                                    : return block.Linear.Allocate(byteSize, alignment);
+	}
+}
+
+gu::OffsetAllocatorStatistics RHIMemoryAllocator::GetBlockStatistics(const Block& block, const MemoryAllocationStrategy strategy)
+{
+	switch (strategy)
+	{
+		case MemoryAllocationStrategy::General     : return block.TLSF  .GetStatistics();
+		case MemoryAllocationStrategy::RenderTarget: return block.Buddy .GetStatistics();
+		default                                    : return block.Linear.GetStatistics();
+	}
+}
+
+gu::uint64 RHIMemoryAllocator::GetBlockSize(const MemoryAllocationStrategy strategy)
+{
+	switch (strategy)
+	{
+		case MemoryAllocationStrategy::RenderTarget: return RENDER_TARGET_BLOCK_SIZE;
+		case MemoryAllocationStrategy::Linear      : return LINEAR_BLOCK_SIZE;
+		default                                    : return DEFAULT_BLOCK_SIZE;
+	}
+}
+#pragma endregion Protected Function
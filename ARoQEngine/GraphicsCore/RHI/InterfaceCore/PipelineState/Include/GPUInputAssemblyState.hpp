@@ -43,6 +43,10 @@ namespace rhi::core
 		// Note : VVertexGameCoreŒ`ꍇ͂̊֐菜, ړ. 
 		static gu::DynamicArray<InputLayoutElement> GetDefaultVertexElement()     { return DEFAULT_VERTEX_ELEMENTS; }
 		static gu::DynamicArray<InputLayoutElement> GetDefaultSkinVertexElement() { return DEFAULT_SKINVERTEX_ELEMENTS; }
+
+		/* @brief : Layout of gm::CompressedVertex / gm::CompressedSkinMeshVertex (octahedral normal, half uv, UNORM8 weights)*/
+		static gu::DynamicArray<InputLayoutElement> GetCompressedVertexElement()     { return COMPRESSED_VERTEX_ELEMENTS; }
+		static gu::DynamicArray<InputLayoutElement> GetCompressedSkinVertexElement() { return COMPRESSED_SKINVERTEX_ELEMENTS; }
 		
 		/****************************************************************************
 		**                Public Member Variables
@@ -99,6 +103,8 @@ namespace rhi::core
 	private:
 		static const gu::DynamicArray<InputLayoutElement> DEFAULT_VERTEX_ELEMENTS;
 		static const gu::DynamicArray<InputLayoutElement> DEFAULT_SKINVERTEX_ELEMENTS;
+		static const gu::DynamicArray<InputLayoutElement> COMPRESSED_VERTEX_ELEMENTS;
+		static const gu::DynamicArray<InputLayoutElement> COMPRESSED_SKINVERTEX_ELEMENTS;
 	};
 
 }
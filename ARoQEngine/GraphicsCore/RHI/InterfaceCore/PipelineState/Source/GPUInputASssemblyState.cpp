@@ -33,4 +33,21 @@ const gu::DynamicArray<InputLayoutElement> GPUInputAssemblyState::DEFAULT_SKINVE
 	InputLayoutElement("TEXCOORD", InputFormat::R32G32_FLOAT   , InputClassification::PerVertex, 0),
 	InputLayoutElement("BONE_NO" , InputFormat::R32G32B32A32_INT, InputClassification::PerVertex),
 	InputLayoutElement("WEIGHT"  , InputFormat::R32G32B32A32_FLOAT,InputClassification::PerVertex)
+};
+
+const gu::DynamicArray<InputLayoutElement> GPUInputAssemblyState::COMPRESSED_VERTEX_ELEMENTS =
+{
+	InputLayoutElement("POSITION", InputFormat::R32G32B32_FLOAT, InputClassification::PerVertex, 0),
+	InputLayoutElement("NORMAL"  , InputFormat::R16G16_SNORM   , InputClassification::PerVertex, 0),
+	InputLayoutElement("COLOR"   , InputFormat::R8G8B8A8_UNORM , InputClassification::PerVertex, 0),
+	InputLayoutElement("TEXCOORD", InputFormat::R16G16_FLOAT   , InputClassification::PerVertex, 0)
+};
+
+const gu::DynamicArray<InputLayoutElement> GPUInputAssemblyState::COMPRESSED_SKINVERTEX_ELEMENTS =
+{
+	InputLayoutElement("POSITION", InputFormat::R32G32B32_FLOAT  , InputClassification::PerVertex, 0),
+	InputLayoutElement("NORMAL"  , InputFormat::R16G16_SNORM     , InputClassification::PerVertex, 0),
+	InputLayoutElement("TEXCOORD", InputFormat::R16G16_FLOAT     , InputClassification::PerVertex, 0),
+	InputLayoutElement("BONE_NO" , InputFormat::R16G16B16A16_UINT, InputClassification::PerVertex, 0),
+	InputLayoutElement("WEIGHT"  , InputFormat::R8G8B8A8_UNORM   , InputClassification::PerVertex, 0)
 };
\ No newline at end of file
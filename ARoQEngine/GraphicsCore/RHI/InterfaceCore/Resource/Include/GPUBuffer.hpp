@@ -119,6 +119,11 @@ namespace rhi::core
 		/*----------------------------------------------------------------------*/
 		__forceinline gu::uint8* GetCPUMemory() { return _mappedData; }
 
+		/*----------------------------------------------------------------------
+		*  @brief :  GPU virtual address of the buffer head (0 if the API cannot return it)
+		/*----------------------------------------------------------------------*/
+		virtual gu::uint64 GetGPUVirtualAddress() const noexcept = 0;
+
 		__forceinline GPUBufferMetaData& GetMetaData()                      { return _metaData; }
 		__forceinline const GPUBufferMetaData& GetMetaData() const noexcept { return _metaData; }
 		
@@ -14,6 +14,7 @@
 #include "GameUtility/Base/Include/GUClassUtility.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHICommonState.hpp"
 #include "GameUtility/Base/Include/GUSmartPointer.hpp"
+#include "GameUtility/Base/Include/GUName.hpp"
 #include <string>
 #include "GameUtility/Container/Include/GUSortedMap.hpp"
 //////////////////////////////////////////////////////////////////////////////////
@@ -79,7 +80,8 @@ namespace rhi::core
 
 		gu::SharedPointer<RHIDescriptorHeap> _customHeap = nullptr;
 
-		gu::SortedMap<std::uint64_t, GPUResourceViewPtr> _resourceViews;
+		// key : interned file path
+		gu::SortedMap<gu::Name, GPUResourceViewPtr> _resourceViews;
 	};
 }
 
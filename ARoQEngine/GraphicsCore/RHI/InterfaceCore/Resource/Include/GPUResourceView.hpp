@@ -48,6 +48,14 @@ namespace rhi::core
 		            index : resource layout array index
 		/*----------------------------------------------------------------------*/
 		virtual void Bind(const gu::SharedPointer<core::RHICommandList>& commandList, const gu::uint32 index, const gu::SharedPointer<RHIResourceLayout>& layout = nullptr) = 0;
+
+		/*----------------------------------------------------------------------
+		*  @brief : Point the constant buffer view at [byteOffset, byteOffset + byteSize) of the buffer.
+		            Used for the sub-allocation of the per-frame upload ring (byteOffset : 256 byte aligned).
+		            descriptorSlot : each frame in flight uses its own slot, 
+		            so the descriptor which the GPU is still reading is not overwritten.
+		/*----------------------------------------------------------------------*/
+		virtual void SetBufferRange(const gu::SharedPointer<GPUBuffer>& buffer, const gu::uint64 byteOffset, const gu::uint64 byteSize, const gu::uint32 descriptorSlot = 0) = 0;
 		
 		/****************************************************************************
 		**                Public Member Variables
@@ -89,6 +97,11 @@ namespace rhi::core
 		/*----------------------------------------------------------------------*/
 		gu::SharedPointer<GPUBuffer> GetBuffer() const noexcept { return _buffer; }
 
+		/*----------------------------------------------------------------------
+		*  @brief : Return the byte offset in the buffer set by SetBufferRange (otherwise 0)
+		/*----------------------------------------------------------------------*/
+		gu::uint64 GetBufferOffset() const noexcept { return _bufferOffset; }
+
 		/*----------------------------------------------------------------------
 		*  @brief : Set texture pointer. ({obt@prłȂgpȂł)
 		/*----------------------------------------------------------------------*/
@@ -129,6 +142,10 @@ namespace rhi::core
 		// @brief : buffer pointer
 		gu::SharedPointer<GPUBuffer>  _buffer = nullptr;
 
+		// @brief : byte range in the buffer set by SetBufferRange (byte size 0 : the whole buffer)
+		gu::uint64 _bufferOffset   = 0;
+		gu::uint64 _bufferByteSize = 0;
+
 		// @brief : texture pointer
 		gu::SharedPointer<GPUTexture> _texture = nullptr;
 
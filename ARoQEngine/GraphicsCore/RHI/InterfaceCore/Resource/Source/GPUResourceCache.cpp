@@ -13,7 +13,7 @@
 #include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUTexture.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIDescriptorHeap.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIDevice.hpp"
-#include <functional>
+#include "GameUtility/Memory/Include/GUMemoryTracker.hpp"
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
@@ -24,15 +24,15 @@ using namespace rhi::core;
 //////////////////////////////////////////////////////////////////////////////////
 GPUResourceCache::GPUResourceViewPtr GPUResourceCache::Load(const gu::tstring& filePath)
 {
+	GU_MEMORY_TAG_SCOPE(gu::MemoryTag::Texture);
+
 	/*-------------------------------------------------------------------
-	-           Get hash code 
+	-           Get interned key
 	---------------------------------------------------------------------*/
-	const auto name = filePath + SP("_SRV");
-	const auto stdName = std::wstring(name.CString());
-	size_t hashCode = std::hash<std::wstring>()(stdName);
-	if (_resourceViews.Contains(hashCode))
+	const gu::Name key = filePath;
+	if (_resourceViews.Contains(key))
 	{
-		return _resourceViews.At(hashCode);
+		return _resourceViews.At(key);
 	}
 	else // create texture and texture resource view
 	{
@@ -41,13 +41,13 @@ GPUResourceCache::GPUResourceViewPtr GPUResourceCache::Load(const gu::tstring& f
 		---------------------------------------------------------------------*/
 		const auto texture = _device->CreateTextureEmpty();
 		texture->Load(filePath, _commandList);
-		texture->SetName(name);
+		texture->SetName(filePath + SP("_SRV"));
 		/*-------------------------------------------------------------------
 		-           Load texture view
 		---------------------------------------------------------------------*/
 		const auto view = _device->CreateResourceView(core::ResourceViewType::Texture, texture, _customHeap);
 		// regist resource view
-		_resourceViews[hashCode] = view;
+		_resourceViews[key] = view;
 		return view;
 	}
 
@@ -55,9 +55,8 @@ GPUResourceCache::GPUResourceViewPtr GPUResourceCache::Load(const gu::tstring& f
 
 bool GPUResourceCache::Find(const gu::tstring& filePath)
 {
-	const auto name    = filePath + SP("_SRV");
-	const auto stdName = std::wstring(name.CString());
-	size_t hashCode = std::hash<std::wstring>()(stdName);
+	// the path which has never been registered is not loaded.
+	const gu::Name key = gu::Name::Find(filePath);
 	
-	return _resourceViews.Contains(hashCode);
+	return !key.IsNone() && _resourceViews.Contains(key);
 }
\ No newline at end of file
@@ -0,0 +1,72 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullAdapter.hpp
+///             @brief  Null RHI virtual display adapter
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_ADAPTER_HPP
+#define NULL_ADAPTER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIAdapter.hpp"
+#include "NullCore.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Template Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			RHIDisplayAdapter
+	*************************************************************************//**
+	*  @class     RHIDisplayAdapter
+	*  @brief     Virtual adapter which creates the null device
+	*****************************************************************************/
+	class RHIDisplayAdapter : public core::RHIDisplayAdapter, public gu::EnableSharedFromThis<RHIDisplayAdapter>
+	{
+	public:
+		/****************************************************************************
+		**                Static Configuration
+		*****************************************************************************/
+		/* @brief : PCI vendor id reserved for the software devices (not NVIDIA / Intel / AMD)*/
+		static constexpr gu::uint32 VENDER_ID = 0x1414;
+		static constexpr gu::uint32 DEVICE_ID = 0x0001;
+
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Return the null logical device*/
+		gu::SharedPointer<core::RHIDevice> CreateDevice() override;
+
+		/* @brief : Print the adapter name*/
+		void PrintInfo() override;
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		explicit RHIDisplayAdapter(const gu::SharedPointer<core::RHIInstance>& instance);
+
+		~RHIDisplayAdapter() = default;
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+	};
+}
+#endif
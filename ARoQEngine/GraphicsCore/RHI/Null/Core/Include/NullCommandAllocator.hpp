@@ -0,0 +1,66 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullCommandAllocator.hpp
+///             @brief  Null RHI command allocator (the commands are stored in the command list)
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_COMMAND_ALLOCATOR_HPP
+#define NULL_COMMAND_ALLOCATOR_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHICommandAllocator.hpp"
+#include "NullCore.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Template Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			RHICommandAllocator
+	*************************************************************************//**
+	*  @class     RHICommandAllocator
+	*  @brief     Command allocator. The null command list owns its command array, so CleanUp does nothing.
+	*****************************************************************************/
+	class RHICommandAllocator : public core::RHICommandAllocator
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		void CleanUp() override {};
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		void SetName(const gu::tstring& name) override { _name = name; }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		RHICommandAllocator() = default;
+
+		~RHICommandAllocator() = default;
+
+		explicit RHICommandAllocator(const gu::SharedPointer<core::RHIDevice>& device, const core::CommandListType type, const gu::tstring& name)
+			: core::RHICommandAllocator(device, type), _name(name) {};
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		gu::tstring _name = SP("");
+	};
+}
+#endif
@@ -0,0 +1,173 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullCommandList.hpp
+///             @brief  Null RHI command list. The commands are recorded into the CPU side array.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_COMMAND_LIST_HPP
+#define NULL_COMMAND_LIST_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHICommandList.hpp"
+#include "NullCore.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Template Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			RHICommandList
+	*************************************************************************//**
+	*  @class     RHICommandList
+	*  @brief     Records the commands and the referenced resources.
+	*             The resource state transitions are applied at the recording like DirectX12,
+	*             and the copies and the queries are played back by the command queue.
+	*****************************************************************************/
+	class RHICommandList : public core::RHICommandList
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+#pragma region Call Draw Frame
+		/* @brief : Clear the recorded commands and open the command list*/
+		void BeginRecording(const bool stillMidFrame = false) override;
+
+		void EndRecording() override;
+
+		void BeginRenderPass(const gu::SharedPointer<core::RHIRenderPass>& renderPass, const gu::SharedPointer<core::RHIFrameBuffer>& frameBuffer) override;
+
+		void EndRenderPass() override;
+
+		void Reset(const gu::SharedPointer<core::RHICommandAllocator>& changeAllocator = nullptr) override;
+#pragma endregion Call Draw Frame
+
+#pragma region Common Command
+		void SetResourceLayout(const gu::SharedPointer<core::RHIResourceLayout>& resourceLayout) override;
+
+		void SetDescriptorHeap(const gu::SharedPointer<core::RHIDescriptorHeap>& heap) override;
+
+		void BeginQuery(const core::QueryResultLocation& location) override;
+
+		void EndQuery(const core::QueryResultLocation& location) override;
+
+		void ResolveQueryData(const core::QueryResultLocation& location, const gu::uint32 queryCount) override;
+#pragma endregion Common Command
+
+#pragma region Graphics Command
+		void SetDepthBounds(const float minDepth, const float maxDepth) override;
+
+		void SetPrimitiveTopology(const core::PrimitiveTopology topology) override;
+
+		void SetViewport(const core::Viewport* viewport, const std::uint32_t numViewport = 1) override;
+
+		void SetScissor(const core::ScissorRect* rect, const std::uint32_t numRect = 1) override;
+
+		void SetViewportAndScissor(const core::Viewport& viewport, const core::ScissorRect& rect) override;
+
+		void SetVertexBuffer(const gu::SharedPointer<core::GPUBuffer>& buffer) override;
+
+		void SetVertexBuffer(const gu::SharedPointer<core::GPUBuffer>& buffer, const gu::uint64 byteOffset, const gu::uint64 byteSize, const gu::uint32 stride) override;
+
+		void SetVertexBuffers(const gu::DynamicArray<gu::SharedPointer<core::GPUBuffer>>& buffers, const size_t startSlot = 0) override;
+
+		void SetIndexBuffer(const gu::SharedPointer<core::GPUBuffer>& buffer, const core::IndexType indexType = core::IndexType::UInt32) override;
+
+		void SetGraphicsPipeline(const gu::SharedPointer<core::GPUGraphicsPipelineState>& pipeline) override;
+
+		void DrawIndexed(std::uint32_t indexCount, std::uint32_t startIndexLocation = 0, std::uint32_t baseVertexLocation = 0) override;
+
+		void DrawIndexedInstanced(std::uint32_t indexCountPerInstance, std::uint32_t instanceCount, std::uint32_t startIndexLocation = 0, std::uint32_t baseVertexLocation = 0, std::uint32_t startInstanceLocation = 0) override;
+
+		/* @brief : The argument buffer is not read, so each indirect draw is counted as one draw without the index count*/
+		void DrawIndexedIndirect(const gu::SharedPointer<core::GPUBuffer>& argumentBuffer, const std::uint32_t drawCallCount) override;
+
+		void DispatchMesh(const std::uint32_t threadGroupCountX = 1, const std::uint32_t threadGroupCountY = 1, const std::uint32_t threadGroupCountZ = 1) override;
+#pragma endregion Graphics Command
+
+#pragma region Compute Command
+		void SetComputeResourceLayout(const gu::SharedPointer<core::RHIResourceLayout>& resourceLayout) override;
+
+		void SetComputePipeline(const gu::SharedPointer<core::GPUComputePipelineState>& pipeline) override;
+
+		void Dispatch(std::uint32_t threadGroupCountX = 1, std::uint32_t threadGroupCountY = 1, std::uint32_t threadGroupCountZ = 1) override;
+#pragma endregion Compute Command
+
+#pragma region Copy
+		void CopyResource(const gu::SharedPointer<core::GPUTexture>& dest, const gu::SharedPointer<core::GPUTexture>& source) override;
+
+		void CopyBufferRegion(const gu::SharedPointer<core::GPUBuffer>& dest, const gu::uint64 destOffset, const gu::SharedPointer<core::GPUBuffer>& source, const gu::uint64 sourceOffset, const gu::uint64 copyByteSize) override;
+
+		void CopyTextureRegion(const gu::SharedPointer<core::GPUTexture>& dest, const gu::uint32 destX, const gu::uint32 destY, const gu::SharedPointer<core::GPUTexture>& source) override;
+#pragma endregion Copy
+
+#pragma region Transition Resource State
+		void TransitionResourceState(const gu::SharedPointer<core::GPUTexture>& texture, core::ResourceState after) override;
+
+		void TransitionResourceStates(const std::uint32_t numStates, const gu::SharedPointer<core::GPUTexture>* textures, core::ResourceState* afters) override;
+#pragma endregion Transition Resource State
+
+		/* @brief : Called by null::GPUResourceView::Bind*/
+		void BindResourceView(const gu::uint32 layoutIndex, const gu::uint32 descriptorID);
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		/* @brief : Commands recorded since the last BeginRecording*/
+		const gu::DynamicArray<Command>& GetCommands() const noexcept { return _commands; }
+
+		/* @brief : Work recorded since the last BeginRecording (added to the device statistics by the command queue)*/
+		const Statistics& GetStatistics() const noexcept { return _statistics; }
+
+		/* @brief : Resources referenced by Command::Resource*/
+		const gu::SharedPointer<core::GPUBuffer>& GetBuffer (const gu::uint32 index) const { return _buffers[index]; }
+		const gu::SharedPointer<core::GPUTexture>& GetTexture(const gu::uint32 index) const { return _textures[index]; }
+		const gu::SharedPointer<core::RHIQuery>& GetQuery  (const gu::uint32 index) const { return _queries[index]; }
+
+		void SetName(const gu::tstring& name) override { _name = name; }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		RHICommandList() = default;
+
+		~RHICommandList() = default;
+
+		explicit RHICommandList(const gu::SharedPointer<core::RHIDevice>& device, const gu::SharedPointer<core::RHICommandAllocator>& commandAllocator, const gu::tstring& name);
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+		/* @brief : Append the command and return it to fill the parameters*/
+		Command& Record(const CommandType type);
+
+		gu::uint32 AddBuffer (const gu::SharedPointer<core::GPUBuffer>& buffer);
+		gu::uint32 AddTexture(const gu::SharedPointer<core::GPUTexture>& texture);
+		gu::uint32 AddQuery  (const gu::SharedPointer<core::RHIQuery>& query);
+
+		void TransitionResourceStates(const gu::DynamicArray<gu::SharedPointer<core::GPUResource>>& resources, core::ResourceState* afters);
+
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		gu::DynamicArray<Command> _commands = {};
+
+		gu::DynamicArray<gu::SharedPointer<core::GPUBuffer>>  _buffers  = {};
+		gu::DynamicArray<gu::SharedPointer<core::GPUTexture>> _textures = {};
+		gu::DynamicArray<gu::SharedPointer<core::RHIQuery>>   _queries  = {};
+
+		Statistics _statistics = {};
+
+		gu::tstring _name = SP("");
+	};
+}
+#endif
@@ -0,0 +1,91 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullCommandQueue.hpp
+///             @brief  Null RHI command queue.
+///                     Plays back the copies and the queries of the submitted command lists
+///                     and advances the simulated GPU timeline.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_COMMAND_QUEUE_HPP
+#define NULL_COMMAND_QUEUE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHICommandQueue.hpp"
+#include "NullCore.hpp"
+#include <mutex>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Template Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	class RHICommandList;
+
+	/****************************************************************************
+	*				  			RHICommandQueue
+	*************************************************************************//**
+	*  @class     RHICommandQueue
+	*  @brief     Executes the recorded commands on the CPU.
+	*             Each Execute occupies the queue for RHIDevice::GetSimulatedExecuteMicroseconds,
+	*             and the fence signaled after it completes at the end of that time.
+	*****************************************************************************/
+	class RHICommandQueue : public core::RHICommandQueue
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : The following submissions start after the fence value is completed*/
+		void Wait  (const gu::SharedPointer<core::RHIFence>& fence, const gu::uint64 value) override;
+
+		/* @brief : The fence value is completed when the submitted work has finished*/
+		void Signal(const gu::SharedPointer<core::RHIFence>& fence, const gu::uint64 value) override;
+
+		/* @brief : Play back the copies and the queries, and count the work in the device statistics*/
+		void Execute(const gu::DynamicArray<gu::SharedPointer<core::RHICommandList>>& commandLists) override;
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		void SetName(const gu::tstring& name) override { _name = name; }
+
+		/* @brief : The timestamps are in gu::Profiler clock microseconds*/
+		gu::uint64 GetTimestampFrequency() override { return 1000000; }
+
+		core::GPUTimingCalibrationTimestamp GetCalibrationTimestamp() override;
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		RHICommandQueue() = default;
+
+		~RHICommandQueue() = default;
+
+		explicit RHICommandQueue(const gu::SharedPointer<core::RHIDevice>& device, const core::CommandListType type, const gu::tstring& name);
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+		/* @brief : Play back the commands which have the visible result on the CPU side memory*/
+		void PlayBack(const RHICommandList& commandList, Statistics& statistics, const gu::uint64 startTime, const gu::uint64 executeTime);
+
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		std::mutex _mutex = {};
+
+		/* @brief : Time at which the simulated GPU finishes the submitted work (gu::Profiler clock microseconds)*/
+		gu::uint64 _busyUntil = 0;
+
+		gu::tstring _name = SP("");
+	};
+}
+#endif
@@ -0,0 +1,112 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullCore.hpp
+///             @brief  Null (headless) RHI common types.
+///                     The null backend does not talk to any graphics API.
+///                     The command lists record the commands into the CPU side array,
+///                     the command queue plays back only the copies and the timestamp queries,
+///                     and the device counts the submitted work, so the CPU cost of the renderer
+///                     can be measured without the GPU and the window.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_CORE_HPP
+#define NULL_CORE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/Base/Include/GUType.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			CommandType
+	*************************************************************************//**
+	*  @enum      CommandType
+	*  @brief     Recorded command kind
+	*****************************************************************************/
+	enum class CommandType : gu::uint8
+	{
+		BeginRenderPass,
+		EndRenderPass,
+		SetResourceLayout,
+		SetComputeResourceLayout,
+		SetDescriptorHeap,
+		SetGraphicsPipeline,
+		SetComputePipeline,
+		SetPrimitiveTopology,
+		SetDepthBounds,
+		SetViewport,
+		SetScissor,
+		SetVertexBuffer,
+		SetIndexBuffer,
+		BindResourceView,
+		DrawIndexed,
+		DrawIndexedIndirect,
+		Dispatch,
+		DispatchMesh,
+		BeginQuery,
+		EndQuery,
+		ResolveQueryData,
+		CopyResource,
+		CopyBufferRegion,
+		CopyTextureRegion,
+		ResourceBarrier,
+		CountOf
+	};
+
+	/****************************************************************************
+	*				  			Command
+	*************************************************************************//**
+	*  @struct    Command
+	*  @brief     One recorded command.
+	*             Resource[] is the index into the resource reference arrays of the command list
+	*             (buffers, textures or queries depending on the type), Arguments[] holds the numeric parameters.
+	*****************************************************************************/
+	struct Command
+	{
+		static constexpr gu::uint32 INVALID_RESOURCE = 0xffffffff;
+
+		CommandType Type         = CommandType::CountOf;
+		gu::uint32  Resource[2]  = { INVALID_RESOURCE, INVALID_RESOURCE };
+		gu::uint64  Arguments[4] = { 0, 0, 0, 0 };
+	};
+
+	/****************************************************************************
+	*				  			Statistics
+	*************************************************************************//**
+	*  @struct    Statistics
+	*  @brief     Work counted by the null device
+	*****************************************************************************/
+	struct Statistics
+	{
+		/* @brief : Executed commands*/
+		gu::uint64 CommandCount  = 0;
+		gu::uint64 DrawCount     = 0; // DrawIndexed(Instanced) + every indirect draw
+		gu::uint64 DispatchCount = 0; // Dispatch + DispatchMesh
+		gu::uint64 IndexCount    = 0; // indexCountPerInstance * instanceCount
+		gu::uint64 InstanceCount = 0;
+		gu::uint64 BarrierCount  = 0; // resource state transitions which changed the state
+
+		/* @brief : Views created or rewritten (SetBufferRange)*/
+		gu::uint64 DescriptorWriteCount = 0;
+
+		/* @brief : Bytes written by the CPU into the buffers and the textures*/
+		gu::uint64 UploadBytes = 0;
+
+		/* @brief : Bytes copied by the executed copy commands*/
+		gu::uint64 CopyBytes = 0;
+
+		gu::uint64 ExecuteCount = 0; // command lists submitted to the queues
+		gu::uint64 PresentCount = 0;
+	};
+}
+#endif
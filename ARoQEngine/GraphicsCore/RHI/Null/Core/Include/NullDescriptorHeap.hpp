@@ -0,0 +1,81 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullDescriptorHeap.hpp
+///             @brief  Null RHI descriptor heap (only issues the descriptor ids)
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_DESCRIPTOR_HEAP_HPP
+#define NULL_DESCRIPTOR_HEAP_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIDescriptorHeap.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Template Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			RHIDescriptorHeap
+	*************************************************************************//**
+	*  @class     RHIDescriptorHeap
+	*  @brief     Issues the descriptor ids for each heap type.
+	*             There is no descriptor memory, so all heap types can be combined in one heap
+	*             and Resize keeps the issued ids.
+	*****************************************************************************/
+	class RHIDescriptorHeap : public core::RHIDescriptorHeap
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Return the unused descriptor id. Throw if the heap of the type is full.*/
+		DescriptorID Allocate(const core::DescriptorHeapType heapType, const gu::SharedPointer<core::RHIResourceLayout>& resourceLayout = nullptr) override;
+
+		void Free(const core::DescriptorHeapType heapType, const DescriptorID offsetIndex) override;
+
+		void Resize(const core::DescriptorHeapType type, const size_t viewCount) override;
+
+		void Resize(const gu::SortedMap<core::DescriptorHeapType, MaxDescriptorSize>& heapInfo) override;
+
+		void Reset(const ResetFlag flag = ResetFlag::OnlyOffset) override;
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		RHIDescriptorHeap() = default;
+
+		~RHIDescriptorHeap() = default;
+
+		explicit RHIDescriptorHeap(const gu::SharedPointer<core::RHIDevice>& device) : core::RHIDescriptorHeap(device) {};
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		struct IDAllocator
+		{
+			DescriptorID                   NextID  = 0;
+			gu::DynamicArray<DescriptorID> FreeIDs = {};
+		};
+
+		gu::SortedMap<core::DescriptorHeapType, IDAllocator> _allocators = {};
+	};
+}
+#endif
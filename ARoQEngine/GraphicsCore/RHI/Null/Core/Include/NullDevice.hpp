@@ -0,0 +1,201 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullDevice.hpp
+///             @brief  Null RHI logical device.
+///                     Creates the CPU only resources and accumulates the statistics of the submitted work.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_DEVICE_HPP
+#define NULL_DEVICE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIDevice.hpp"
+#include "NullCore.hpp"
+#include <mutex>
+#include <atomic>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Device class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			RHIDevice
+	*************************************************************************//**
+	*  @class     RHIDevice
+	*  @brief     Null logical device (managed by the shared pointer)
+	*             Ray tracing is not supported (the creation functions return nullptr).
+	*             All descriptor heap types share the one default heap.
+	*****************************************************************************/
+	class RHIDevice : public core::RHIDevice, public gu::EnableSharedFromThis<RHIDevice>
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		void Destroy() override;
+
+#pragma region Create Function
+		void                                              SetUpDefaultHeap(const core::DefaultHeapCount& heapCount) override;
+
+		gu::SharedPointer<core::RHIFrameBuffer>           CreateFrameBuffer(const gu::SharedPointer<core::RHIRenderPass>& renderPass, const gu::DynamicArray<gu::SharedPointer<core::GPUTexture>>& renderTargets, const gu::SharedPointer<core::GPUTexture>& depthStencil = nullptr) override;
+
+		gu::SharedPointer<core::RHIFrameBuffer>           CreateFrameBuffer(const gu::SharedPointer<core::RHIRenderPass>& renderPass, const gu::SharedPointer<core::GPUTexture>& renderTarget, const gu::SharedPointer<core::GPUTexture>& depthStencil = nullptr) override;
+
+		gu::SharedPointer<core::RHIFence>                 CreateFence(const gu::uint64 fenceValue = 0, const gu::tstring& name = SP("Fence")) override;
+
+		gu::SharedPointer<core::RHICommandList>           CreateCommandList(const gu::SharedPointer<core::RHICommandAllocator>& commandAllocator, const gu::tstring& name = SP("CommandList")) override;
+
+		gu::SharedPointer<core::RHICommandQueue>          CreateCommandQueue(const core::CommandListType type, const gu::tstring& name = SP("CommandQueue")) override;
+
+		gu::SharedPointer<core::RHICommandAllocator>      CreateCommandAllocator(const core::CommandListType type, const gu::tstring& name = SP("CommandAllocator")) override;
+
+		gu::SharedPointer<core::RHISwapchain>             CreateSwapchain(const gu::SharedPointer<core::RHICommandQueue>& commandQueue, const core::WindowInfo& windowInfo, const core::PixelFormat& pixelFormat, const size_t frameBufferCount = 2, const gu::uint32 vsync = 0, const bool isValidHDR = true) override;
+
+		gu::SharedPointer<core::RHISwapchain>             CreateSwapchain(const core::SwapchainDesc& desc) override;
+
+		gu::SharedPointer<core::RHIDescriptorHeap>        CreateDescriptorHeap(const core::DescriptorHeapType heapType, const size_t maxDescriptorCount) override;
+
+		gu::SharedPointer<core::RHIDescriptorHeap>        CreateDescriptorHeap(const gu::SortedMap<core::DescriptorHeapType, size_t>& heapInfo) override;
+
+		gu::SharedPointer<core::RHIRenderPass>            CreateRenderPass(const gu::DynamicArray<core::Attachment>& colors, const gu::Optional<core::Attachment>& depth) override;
+
+		gu::SharedPointer<core::RHIRenderPass>            CreateRenderPass(const core::Attachment& color, const gu::Optional<core::Attachment>& depth) override;
+
+		gu::SharedPointer<core::GPUGraphicsPipelineState> CreateGraphicPipelineState(const gu::SharedPointer<core::RHIRenderPass>& renderPass, const gu::SharedPointer<core::RHIResourceLayout>& resourceLayout) override;
+
+		gu::SharedPointer<core::GPUComputePipelineState>  CreateComputePipelineState(const gu::SharedPointer<core::RHIResourceLayout>& resourceLayout) override;
+
+		gu::SharedPointer<core::RHIResourceLayout>        CreateResourceLayout(const gu::DynamicArray<core::ResourceLayoutElement>& elements = {}, const gu::DynamicArray<core::SamplerLayoutElement>& samplers = {}, const gu::Optional<core::Constant32Bits>& constant32Bits = {}, const gu::tstring& name = SP("ResourceLayout")) override;
+
+		gu::SharedPointer<core::GPUPipelineFactory>       CreatePipelineFactory() override;
+
+		gu::SharedPointer<core::GPUResourceView>          CreateResourceView(const core::ResourceViewType viewType, const gu::SharedPointer<core::GPUTexture>& texture, const gu::uint32 mipSlice = 0, const gu::uint32 placeSlice = 0, const gu::SharedPointer<core::RHIDescriptorHeap>& customHeap = nullptr) override;
+
+		gu::SharedPointer<core::GPUResourceView>          CreateResourceView(const core::ResourceViewType viewType, const gu::SharedPointer<core::GPUBuffer>& buffer, const gu::uint32 mipSlice = 0, const gu::uint32 placeSlice = 0, const gu::SharedPointer<core::RHIDescriptorHeap>& customHeap = nullptr) override;
+
+		gu::SharedPointer<core::GPUSampler>               CreateSampler(const core::SamplerInfo& samplerInfo) override;
+
+		gu::SharedPointer<core::GPUBuffer>                CreateBuffer(const core::GPUBufferMetaData& metaData, const gu::tstring& name = SP("")) override;
+
+		gu::SharedPointer<core::GPUTexture>               CreateTexture(const core::GPUTextureMetaData& metaData, const gu::tstring& name = SP("")) override;
+
+		gu::SharedPointer<core::GPUTexture>               CreateTextureEmpty() override;
+
+		/* @brief : Not supported (return nullptr)*/
+		gu::SharedPointer<core::RayTracingGeometry>       CreateRayTracingGeometry(const core::RayTracingGeometryFlags flags, const gu::SharedPointer<core::GPUBuffer>& vertexBuffer, const gu::SharedPointer<core::GPUBuffer>& indexBuffer = nullptr) override;
+
+		/* @brief : Not supported (return nullptr)*/
+		gu::SharedPointer<core::ASInstance>               CreateASInstance(
+			const gu::SharedPointer<core::BLASBuffer>& blasBuffer, const gm::Float3x4& blasTransform,
+			const gu::uint32 instanceID, const gu::uint32 instanceContributionToHitGroupIndex,
+			const gu::uint32 instanceMask = 0xFF, const core::RayTracingInstanceFlags flags = core::RayTracingInstanceFlags::None) override;
+
+		/* @brief : Not supported (return nullptr)*/
+		gu::SharedPointer<core::BLASBuffer>               CreateRayTracingBLASBuffer(const gu::DynamicArray<gu::SharedPointer<core::RayTracingGeometry>>& geometryDesc, const core::BuildAccelerationStructureFlags flags) override;
+
+		/* @brief : Not supported (return nullptr)*/
+		gu::SharedPointer<core::TLASBuffer>               CreateRayTracingTLASBuffer(const gu::DynamicArray<gu::SharedPointer<core::ASInstance>>& asInstances, const core::BuildAccelerationStructureFlags flags) override;
+
+		gu::SharedPointer<core::RHIQuery>                 CreateQuery(const core::QueryHeapType heapType) override;
+#pragma endregion Create Function
+
+		/*-------------------------------------------------------------------
+		-               Statistics
+		---------------------------------------------------------------------*/
+		/* @brief : Return the work counted since the creation or the last ResetStatistics (thread safe)*/
+		Statistics GetStatistics() const;
+
+		void ResetStatistics();
+
+		/* @brief : Called by the null resources and the command queues*/
+		void AddStatistics(const Statistics& statistics);
+
+		void CountDescriptorWrite(const gu::uint64 count = 1);
+
+		void CountUploadBytes(const gu::uint64 byteSize);
+
+		void CountPresent();
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		/*----------------------------------------------------------------------
+		*  @brief : Time which the simulated GPU spends on each ExecuteCommandLists (0 : finished immediately).
+		*           The fence signaled after the submission completes when this time has passed,
+		*           so the CPU-GPU overlap of the frame pipeline can be observed without the GPU.
+		/*----------------------------------------------------------------------*/
+		void       SetSimulatedExecuteMicroseconds(const gu::uint64 microseconds) noexcept { _simulatedExecuteMicroseconds.store(microseconds); }
+		gu::uint64 GetSimulatedExecuteMicroseconds() const noexcept { return _simulatedExecuteMicroseconds.load(); }
+
+		gu::uint32 GetShadingRateImageTileSize() const override { return 0; }
+
+		gu::SharedPointer<core::RHIDescriptorHeap> GetDefaultHeap(const core::DescriptorHeapType heapType) override;
+
+		void SetName(const gu::tstring& name) override { _name = name; }
+
+		/*-------------------------------------------------------------------
+		-               Device Support Check
+		---------------------------------------------------------------------*/
+		bool IsSupportedDxr                () const override { return false; }
+
+		bool IsSupportedHDR                () const override { return false; }
+
+		bool IsSupportedVariableRateShading() const override { return false; }
+
+		bool IsSupportedMeshShading        () const override { return true; }
+
+		bool IsSupportedDrawIndirected     () const override { return true; }
+
+		bool IsSupportedGeometryShader     () const override { return true; }
+
+		bool IsSupportedRenderPass         () const override { return true; }
+
+		bool IsSupportedDepthBoundsTest    () const override { return true; }
+
+		bool IsSupportedSamplerFeedback    () const override { return false; }
+
+		bool IsSupportedStencilReferenceFromPixelShader() const override { return false; }
+
+		bool IsSupportedWaveLane() const override { return false; }
+
+		bool IsSupportedNative16bitOperation() const override { return false; }
+
+		bool IsSupportedAtomicOperation() const override { return false; }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		RHIDevice() = default;
+
+		~RHIDevice();
+
+		explicit RHIDevice(const gu::SharedPointer<core::RHIDisplayAdapter>& adapter, const core::RHIMultiGPUMask& mask = core::RHIMultiGPUMask::SingleGPU());
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		/* @brief : Shared by all descriptor heap types*/
+		gu::SharedPointer<core::RHIDescriptorHeap> _defaultHeap = nullptr;
+
+		mutable std::mutex _statisticsMutex = {};
+		Statistics         _statistics      = {};
+
+		std::atomic<gu::uint64> _simulatedExecuteMicroseconds = 0;
+
+		gu::tstring _name = SP("NullDevice");
+	};
+}
+#endif
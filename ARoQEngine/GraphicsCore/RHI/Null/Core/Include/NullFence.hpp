@@ -0,0 +1,101 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullFence.hpp
+///             @brief  Null RHI fence. Signals carry the completion time on the simulated GPU timeline.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_FENCE_HPP
+#define NULL_FENCE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIFence.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+#include "NullCore.hpp"
+#include <mutex>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Template Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			RHIFence
+	*************************************************************************//**
+	*  @class     RHIFence
+	*  @brief     CPU-GPU synchronization.
+	*             The command queue signals the value with the time at which the simulated GPU reaches it,
+	*             and the value becomes the completed value when the time has passed (thread safe).
+	*****************************************************************************/
+	class RHIFence : public core::RHIFence
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief: Set fence value from CPU side (completed immediately)*/
+		void Signal(const std::uint64_t value) override;
+
+		/* @brief: Block the CPU until the value is completed*/
+		void Wait(const std::uint64_t value) override;
+
+		/* @brief: Return current fence value*/
+		std::uint64_t GetCompletedValue() override;
+
+		/*----------------------------------------------------------------------
+		*  @brief : Signal from the command queue. The value is completed at completionTime (gu::Profiler clock microseconds)
+		/*----------------------------------------------------------------------*/
+		void SignalAt(const gu::uint64 value, const gu::uint64 completionTime);
+
+		/*----------------------------------------------------------------------
+		*  @brief : Return the time at which the value is completed.
+		*           0 if already completed, UINT64_MAX if the value has not been signaled yet.
+		/*----------------------------------------------------------------------*/
+		gu::uint64 GetCompletionTime(const gu::uint64 value);
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		void SetName(const gu::tstring& name) override { _name = name; }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		RHIFence() = default;
+
+		~RHIFence() = default;
+
+		explicit RHIFence(const gu::SharedPointer<core::RHIDevice>& device, const std::uint64_t initialValue = 0, const gu::tstring& name = SP("Fence"));
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+		/* @brief : Move the pending signals whose time has passed to the completed value (call in the lock)*/
+		void RetirePendingSignals(const gu::uint64 now);
+
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		struct PendingSignal
+		{
+			gu::uint64 Value          = 0;
+			gu::uint64 CompletionTime = 0;
+		};
+
+		std::mutex _mutex = {};
+
+		gu::DynamicArray<PendingSignal> _pendingSignals = {};
+
+		gu::uint64 _completedValue = 0;
+
+		gu::tstring _name = SP("");
+	};
+}
+#endif
@@ -0,0 +1,60 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullFrameBuffer.hpp
+///             @brief  Null RHI render target and depth stencil buffer
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_FRAME_BUFFER_HPP
+#define NULL_FRAME_BUFFER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIFrameBuffer.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Template Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			RHIFrameBuffer
+	*************************************************************************//**
+	*  @class     RHIFrameBuffer
+	*  @brief     Render and Depth Stencil Buffer. The views are allocated from the device default heap.
+	*****************************************************************************/
+	class RHIFrameBuffer : public core::RHIFrameBuffer
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		RHIFrameBuffer() = default;
+
+		~RHIFrameBuffer() = default;
+
+		explicit RHIFrameBuffer(const gu::SharedPointer<core::RHIDevice>& device, const gu::SharedPointer<core::RHIRenderPass>& renderPass, const gu::SharedPointer<core::GPUTexture>& renderTarget, const gu::SharedPointer<core::GPUTexture>& depthStencil);
+
+		explicit RHIFrameBuffer(const gu::SharedPointer<core::RHIDevice>& device, const gu::SharedPointer<core::RHIRenderPass>& renderPass, const gu::DynamicArray<gu::SharedPointer<core::GPUTexture>>& renderTargets, const gu::SharedPointer<core::GPUTexture>& depthStencil);
+
+	private:
+		/****************************************************************************
+		**                Private Function
+		*****************************************************************************/
+		void Prepare();
+	};
+}
+#endif
@@ -0,0 +1,74 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullInstance.hpp
+///             @brief  Null RHI instance. Enumerates the one virtual display adapter.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_INSTANCE_HPP
+#define NULL_INSTANCE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIInstance.hpp"
+#include "NullCore.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Template Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			RHIInstance
+	*************************************************************************//**
+	*  @class     RHIInstance
+	*  @brief     Null api instance. The debugger flags are ignored.
+	*****************************************************************************/
+	class RHIInstance : public core::RHIInstance, public gu::EnableSharedFromThis<RHIInstance>
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Return the virtual adapter*/
+		gu::SharedPointer<core::RHIDisplayAdapter> SearchHighPerformanceAdapter() override;
+
+		/* @brief : Return the virtual adapter*/
+		gu::SharedPointer<core::RHIDisplayAdapter> SearchMinimumPowerAdapter() override;
+
+		/* @brief : Return the virtual adapter only*/
+		gu::DynamicArray<gu::SharedPointer<core::RHIDisplayAdapter>> EnumrateAdapters() override;
+
+		/* @brief : Print the virtual adapter*/
+		void LogAdapters() override;
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		RHIInstance() = default;
+
+		RHIInstance(bool enableCPUDebugger, bool enableGPUDebugger, bool useGPUDebugBreak)
+			: core::RHIInstance(enableCPUDebugger, enableGPUDebugger, useGPUDebugBreak) {};
+
+		~RHIInstance() = default;
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+	};
+}
+#endif
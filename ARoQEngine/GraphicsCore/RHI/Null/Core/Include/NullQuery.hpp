@@ -0,0 +1,80 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullQuery.hpp
+///             @brief  Null RHI query heap
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_QUERY_HPP
+#define NULL_QUERY_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIQuery.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			   RHIQuery
+	*************************************************************************//**
+	*  @class     RHIQuery
+	*  @brief     Query heap which holds one 64 bit result per query.
+	*             The timestamps are written by the command queue in gu::Profiler clock microseconds.
+	*             The occlusion and the pipeline statistics results are always 0.
+	*****************************************************************************/
+	class RHIQuery : public core::RHIQuery
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		core::QueryResultLocation Allocate() override;
+
+		void Free(core::QueryResultLocation& location) override;
+
+		/* @brief : Write the result of the query (called by the command queue)*/
+		void WriteResult(const gu::uint32 queryID, const gu::uint64 value);
+
+		/* @brief : Copy the results [queryID, queryID + queryCount) into the readback buffer*/
+		void Resolve(const gu::uint32 queryID, const gu::uint32 queryCount);
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		gu::uint32 GetMaxQueryCount() const noexcept { return static_cast<gu::uint32>(_results.Size()); }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		RHIQuery() = default;
+
+		~RHIQuery();
+
+		explicit RHIQuery(const gu::SharedPointer<core::RHIDevice>& device, const core::QueryHeapType heapType);
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		/* @brief : Query heap memory (the GPU side results)*/
+		gu::DynamicArray<gu::uint64> _results = {};
+
+		/* @brief : Released query ids and the next unused id*/
+		gu::DynamicArray<gu::uint32> _freeIDs = {};
+		gu::uint32 _nextID = 0;
+	};
+}
+#endif
@@ -0,0 +1,69 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullRenderPass.hpp
+///             @brief  Null RHI render pass
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_RENDER_PASS_HPP
+#define NULL_RENDER_PASS_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIRenderPass.hpp"
+#include "NullCore.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Template Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			RHIRenderPass
+	*************************************************************************//**
+	*  @class     RHIRenderPass
+	*  @brief     Render pass (only holds the attachment description)
+	*****************************************************************************/
+	class RHIRenderPass : public core::RHIRenderPass
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		/* @brief : set debugging name. */
+		void SetName(const gu::tstring& name) override { _name = name; };
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		RHIRenderPass() = default;
+
+		~RHIRenderPass() = default;
+
+		explicit RHIRenderPass(const gu::SharedPointer<core::RHIDevice>& device, const gu::DynamicArray<core::Attachment>& colors, const gu::Optional<core::Attachment>& depth = {}) :
+			core::RHIRenderPass(device, colors, depth) {};
+
+		explicit RHIRenderPass(const gu::SharedPointer<core::RHIDevice>& device, const core::Attachment& color, const gu::Optional<core::Attachment>& depth = {}) :
+			core::RHIRenderPass(device, color, depth) {};
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		gu::tstring _name = SP("");
+	};
+}
+#endif
@@ -0,0 +1,70 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullResourceLayout.hpp
+///             @brief  Null RHI resource layout
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_RESOURCE_LAYOUT_HPP
+#define NULL_RESOURCE_LAYOUT_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIResourceLayout.hpp"
+#include "NullCore.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Template Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			RHIResourceLayout
+	*************************************************************************//**
+	*  @class     RHIResourceLayout
+	*  @brief     Resource layout (only holds the layout description)
+	*****************************************************************************/
+	class RHIResourceLayout : public core::RHIResourceLayout
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		void SetName(const gu::tstring& name) override { _name = name; }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		RHIResourceLayout() = default;
+
+		~RHIResourceLayout() = default;
+
+		explicit RHIResourceLayout(
+			const gu::SharedPointer<core::RHIDevice>& device,
+			const gu::DynamicArray<core::ResourceLayoutElement>& elements = {},
+			const gu::DynamicArray<core::SamplerLayoutElement>& samplers = {},
+			const gu::Optional<core::Constant32Bits>& constant32Bits = {},
+			const gu::tstring& name = SP("ResourceLayout"))
+			: core::RHIResourceLayout(device, elements, samplers, constant32Bits), _name(name) {};
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		gu::tstring _name = SP("");
+	};
+}
+#endif
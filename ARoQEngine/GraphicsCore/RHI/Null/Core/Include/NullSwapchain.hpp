@@ -0,0 +1,86 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullSwapchain.hpp
+///             @brief  Null RHI swapchain. The back buffers are the CPU side textures and Present only rotates them.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_SWAPCHAIN_HPP
+#define NULL_SWAPCHAIN_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHISwapchain.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Template Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			RHISwapchain
+	*************************************************************************//**
+	*  @class     RHISwapchain
+	*  @brief     Swapchain without the window surface
+	*****************************************************************************/
+	class RHISwapchain : public core::RHISwapchain
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Signal the fence from the command queue and return the current back buffer index*/
+		gu::uint32 PrepareNextImage(const gu::SharedPointer<core::RHIFence>& fence, const gu::uint64 signalValue) override;
+
+		/* @brief : Wait the fence on the command queue and move to the next back buffer*/
+		void Present(const gu::SharedPointer<core::RHIFence>& fence, std::uint64_t waitValue) override;
+
+		/* @brief : Recreate the back buffers*/
+		void Resize(const size_t width, const size_t height) override;
+
+		size_t GetCurrentBufferIndex() const override { return _currentIndex; }
+
+		void SwitchFullScreenMode(const bool isOn) override { _isFullScreen = isOn; }
+
+		void SwitchHDRMode(const bool enableHDR) override { _desc.IsValidHDR = enableHDR; }
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		~RHISwapchain() = default;
+
+		explicit RHISwapchain(
+			const gu::SharedPointer<core::RHIDevice>& device,
+			const gu::SharedPointer<core::RHICommandQueue>& queue,
+			const core::WindowInfo& windowInfo,
+			const core::PixelFormat& pixelFormat,
+			const size_t frameBufferCount = 3, const std::uint32_t vsync = 0,
+			const bool isValidHDR = true,
+			const bool isFullScreen = false);
+
+		explicit RHISwapchain(
+			const gu::SharedPointer<core::RHIDevice>& device,
+			const core::SwapchainDesc& desc);
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+		void CreateBackBuffers();
+
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		size_t _currentIndex = 0;
+	};
+}
+#endif
@@ -0,0 +1,67 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullAdapter.cpp
+///             @brief  Null RHI virtual display adapter
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/NullAdapter.hpp"
+#include "../Include/NullDevice.hpp"
+#include <iostream>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::null;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+RHIDisplayAdapter::RHIDisplayAdapter(const gu::SharedPointer<core::RHIInstance>& instance)
+	: core::RHIDisplayAdapter(instance)
+{
+	_venderID      = VENDER_ID;
+	_deviceID      = DEVICE_ID;
+	_isDiscreteGPU = false;
+	_name          = "Null Device";
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Public Function
+/****************************************************************************
+*                     CreateDevice
+*************************************************************************//**
+*  @fn        gu::SharedPointer<core::RHIDevice> RHIDisplayAdapter::CreateDevice()
+*
+*  @brief     Return the null logical device
+*
+*  @param[in] void
+*
+*  @return    gu::SharedPointer<core::RHIDevice>
+*****************************************************************************/
+gu::SharedPointer<core::RHIDevice> RHIDisplayAdapter::CreateDevice()
+{
+	return gu::StaticPointerCast<core::RHIDevice>(gu::MakeShared<null::RHIDevice>(SharedFromThis()));
+}
+
+/****************************************************************************
+*                     PrintInfo
+*************************************************************************//**
+*  @fn        void RHIDisplayAdapter::PrintInfo()
+*
+*  @brief     Print the adapter name
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
+void RHIDisplayAdapter::PrintInfo()
+{
+	std::cout << "Adapter : " << _name.CString() << std::endl;
+}
+#pragma endregion Public Function
@@ -0,0 +1,600 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullCommandList.cpp
+///             @brief  Null RHI command list
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/NullCommandList.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHICommandAllocator.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIFrameBuffer.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIQuery.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUBuffer.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUTexture.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include "GameUtility/Container/Include/GUSmallArray.hpp"
+#include <bit>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	// Barrier batches are usually at most the render target count, so they are kept on the stack.
+	constexpr gu::uint64 INLINE_BARRIER_COUNT = 8;
+}
+using namespace rhi;
+using namespace rhi::null;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+RHICommandList::RHICommandList(const gu::SharedPointer<core::RHIDevice>& device, const gu::SharedPointer<core::RHICommandAllocator>& commandAllocator, const gu::tstring& name)
+	: core::RHICommandList(device, commandAllocator), _name(name)
+{
+	Check(commandAllocator);
+
+	_commandListType = commandAllocator->GetCommandListType();
+	_isOpen          = false;
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Call Draw Frame
+/****************************************************************************
+*                     BeginRecording
+*************************************************************************//**
+*  @fn        void RHICommandList::BeginRecording(const bool stillMidFrame)
+*
+*  @brief     Clear the recorded commands and open the command list.
+*             If still mid frame is set false, this function clears the command allocator
+*
+*  @param[in] const bool stillMidFrame (default: false)
+*
+*  @return    void
+*****************************************************************************/
+void RHICommandList::BeginRecording(const bool stillMidFrame)
+{
+	if (IsOpen()) { return; }
+
+	if (_commandAllocator && !stillMidFrame)
+	{
+		_commandAllocator->CleanUp();
+	}
+
+	// The arrays keep the capacity, so the steady state does not allocate.
+	_commands.Clear();
+	_buffers .Clear();
+	_textures.Clear();
+	_queries .Clear();
+	_statistics = {};
+
+	_isOpen          = true;
+	_beginRenderPass = false;
+}
+
+/****************************************************************************
+*                     EndRecording
+*************************************************************************//**
+*  @fn        void RHICommandList::EndRecording()
+*
+*  @brief     Close the command list. The recorded commands can be executed by the command queue.
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
+void RHICommandList::EndRecording()
+{
+	if (IsClosed()) { return; }
+	_isOpen = false;
+}
+
+/****************************************************************************
+*                     Reset
+*************************************************************************//**
+*  @fn        void RHICommandList::Reset(const gu::SharedPointer<core::RHICommandAllocator>& commandAllocator)
+*
+*  @brief     Change the command allocator and proceed to the record state.
+*             Basically, use BeginRecording instead of this function.
+*
+*  @param[in] const gu::SharedPointer<core::RHICommandAllocator>& commandAllocator
+*
+*  @return    void
+*****************************************************************************/
+void RHICommandList::Reset(const gu::SharedPointer<core::RHICommandAllocator>& commandAllocator)
+{
+	if (IsOpen() || !commandAllocator) { return; }
+
+	if (commandAllocator->GetCommandListType() != GetType()) { return; }
+
+	_commandAllocator = commandAllocator;
+
+	_commands.Clear();
+	_buffers .Clear();
+	_textures.Clear();
+	_queries .Clear();
+	_statistics = {};
+
+	_isOpen          = true;
+	_beginRenderPass = false;
+}
+
+/****************************************************************************
+*                     BeginRenderPass
+*************************************************************************//**
+*  @fn        void RHICommandList::BeginRenderPass(const gu::SharedPointer<core::RHIRenderPass>& renderPass, const gu::SharedPointer<core::RHIFrameBuffer>& frameBuffer)
+*
+*  @brief     Begin render pass and frame buffer.
+*
+*  @param[in] const gu::SharedPointer<core::RHIRenderPass>& renderPass
+*  @param[in] const gu::SharedPointer<core::RHIFrameBuffer>& frameBuffer
+*
+*  @return    void
+*****************************************************************************/
+void RHICommandList::BeginRenderPass(const gu::SharedPointer<core::RHIRenderPass>& renderPass, const gu::SharedPointer<core::RHIFrameBuffer>& frameBuffer)
+{
+	/*-------------------------------------------------------------------
+	-          Layout Transition (Present -> RenderTarget)
+	---------------------------------------------------------------------*/
+	gu::SmallArray<core::ResourceState, INLINE_BARRIER_COUNT> states(frameBuffer->GetRenderTargetSize(), core::ResourceState::RenderTarget);
+	TransitionResourceStates(static_cast<std::uint32_t>(frameBuffer->GetRenderTargetSize()), frameBuffer->GetRenderTargets().Data(), states.Data());
+
+	Record(CommandType::BeginRenderPass).Arguments[0] = frameBuffer->GetRenderTargetSize();
+
+	_renderPass      = renderPass;
+	_frameBuffer     = frameBuffer;
+	_beginRenderPass = true;
+}
+
+/****************************************************************************
+*                     EndRenderPass
+*************************************************************************//**
+*  @fn        void RHICommandList::EndRenderPass()
+*
+*  @brief     End render pass
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
+void RHICommandList::EndRenderPass()
+{
+	if (!_beginRenderPass) { return; }
+
+	Record(CommandType::EndRenderPass);
+
+	/*-------------------------------------------------------------------
+	-          Layout Transition (RenderTarget -> Present)
+	---------------------------------------------------------------------*/
+	gu::SmallArray<core::ResourceState, INLINE_BARRIER_COUNT> states(_frameBuffer->GetRenderTargetSize(), core::ResourceState::Present);
+	TransitionResourceStates(static_cast<std::uint32_t>(_frameBuffer->GetRenderTargetSize()), _frameBuffer->GetRenderTargets().Data(), states.Data());
+	_beginRenderPass = false;
+}
+#pragma endregion Call Draw Frame
+
+#pragma region Common Command
+void RHICommandList::SetResourceLayout([[maybe_unused]] const gu::SharedPointer<core::RHIResourceLayout>& resourceLayout)
+{
+	Record(CommandType::SetResourceLayout);
+}
+
+void RHICommandList::SetComputeResourceLayout([[maybe_unused]] const gu::SharedPointer<core::RHIResourceLayout>& resourceLayout)
+{
+	Record(CommandType::SetComputeResourceLayout);
+}
+
+void RHICommandList::SetDescriptorHeap([[maybe_unused]] const gu::SharedPointer<core::RHIDescriptorHeap>& heap)
+{
+	Record(CommandType::SetDescriptorHeap);
+}
+
+void RHICommandList::BindResourceView(const gu::uint32 layoutIndex, const gu::uint32 descriptorID)
+{
+	auto& command = Record(CommandType::BindResourceView);
+	command.Arguments[0] = layoutIndex;
+	command.Arguments[1] = descriptorID;
+}
+
+/****************************************************************************
+*                       BeginQuery
+*************************************************************************//**
+*  @fn        void RHICommandList::BeginQuery(const core::QueryResultLocation& location)
+*
+*  @brief     Start the occlusion or the pipeline statistics query.
+*             The null device does not rasterize, so the results stay 0.
+*
+*  @param[in] const core::QueryResultLocation& location
+*
+*  @return    void
+*****************************************************************************/
+void RHICommandList::BeginQuery(const core::QueryResultLocation& location)
+{
+	Checkf(location.Heap, "query is nullptr");
+
+	auto& command = Record(CommandType::BeginQuery);
+	command.Resource [0] = AddQuery(location.Heap);
+	command.Arguments[0] = location.QueryID;
+}
+
+/****************************************************************************
+*                       EndQuery
+*************************************************************************//**
+*  @fn        void RHICommandList::EndQuery(const core::QueryResultLocation& location)
+*
+*  @brief     End the query. The timestamp query is written when the command queue plays back the command.
+*
+*  @param[in] const core::QueryResultLocation& location
+*
+*  @return    void
+*****************************************************************************/
+void RHICommandList::EndQuery(const core::QueryResultLocation& location)
+{
+	Checkf(location.Heap, "query is nullptr");
+
+	auto& command = Record(CommandType::EndQuery);
+	command.Resource [0] = AddQuery(location.Heap);
+	command.Arguments[0] = location.QueryID;
+}
+
+/****************************************************************************
+*                       ResolveQueryData
+*************************************************************************//**
+*  @fn        void RHICommandList::ResolveQueryData(const core::QueryResultLocation& location, const gu::uint32 queryCount)
+*
+*  @brief     Copy the query results into the readback buffer of the query heap (played back by the command queue).
+*
+*  @param[in] const core::QueryResultLocation& location (first query)
+*  @param[in] const gu::uint32 queryCount
+*
+*  @return    void
+*****************************************************************************/
+void RHICommandList::ResolveQueryData(const core::QueryResultLocation& location, const gu::uint32 queryCount)
+{
+	if (queryCount == 0) { return; }
+	Checkf(location.Heap, "query is nullptr");
+
+	auto& command = Record(CommandType::ResolveQueryData);
+	command.Resource [0] = AddQuery(location.Heap);
+	command.Arguments[0] = location.QueryID;
+	command.Arguments[1] = queryCount;
+}
+#pragma endregion Common Command
+
+#pragma region Graphics Command
+void RHICommandList::SetDepthBounds(const float minDepth, const float maxDepth)
+{
+	auto& command = Record(CommandType::SetDepthBounds);
+	command.Arguments[0] = std::bit_cast<gu::uint32>(minDepth);
+	command.Arguments[1] = std::bit_cast<gu::uint32>(maxDepth);
+}
+
+void RHICommandList::SetPrimitiveTopology(const core::PrimitiveTopology topology)
+{
+	Record(CommandType::SetPrimitiveTopology).Arguments[0] = static_cast<gu::uint64>(topology);
+}
+
+void RHICommandList::SetViewport([[maybe_unused]] const core::Viewport* viewport, const std::uint32_t numViewport)
+{
+	Record(CommandType::SetViewport).Arguments[0] = numViewport;
+}
+
+void RHICommandList::SetScissor([[maybe_unused]] const core::ScissorRect* rect, const std::uint32_t numRect)
+{
+	Record(CommandType::SetScissor).Arguments[0] = numRect;
+}
+
+void RHICommandList::SetViewportAndScissor(const core::Viewport& viewport, const core::ScissorRect& rect)
+{
+	SetViewport(&viewport, 1);
+	SetScissor (&rect, 1);
+}
+
+void RHICommandList::SetVertexBuffer(const gu::SharedPointer<core::GPUBuffer>& buffer)
+{
+	auto& command = Record(CommandType::SetVertexBuffer);
+	command.Resource [0] = AddBuffer(buffer);
+	command.Arguments[1] = buffer->GetTotalByteSize();
+	command.Arguments[2] = buffer->GetElementByteSize();
+}
+
+void RHICommandList::SetVertexBuffer(const gu::SharedPointer<core::GPUBuffer>& buffer, const gu::uint64 byteOffset, const gu::uint64 byteSize, const gu::uint32 stride)
+{
+	Check(byteOffset + byteSize <= buffer->GetTotalByteSize());
+
+	auto& command = Record(CommandType::SetVertexBuffer);
+	command.Resource [0] = AddBuffer(buffer);
+	command.Arguments[0] = byteOffset;
+	command.Arguments[1] = byteSize;
+	command.Arguments[2] = stride;
+}
+
+void RHICommandList::SetVertexBuffers(const gu::DynamicArray<gu::SharedPointer<core::GPUBuffer>>& buffers, const size_t startSlot)
+{
+	for (gu::uint64 i = 0; i < buffers.Size(); ++i)
+	{
+		SetVertexBuffer(buffers[i]);
+		_commands.Back().Arguments[3] = startSlot + i;
+	}
+}
+
+void RHICommandList::SetIndexBuffer(const gu::SharedPointer<core::GPUBuffer>& buffer, const core::IndexType indexType)
+{
+	auto& command = Record(CommandType::SetIndexBuffer);
+	command.Resource [0] = AddBuffer(buffer);
+	command.Arguments[0] = static_cast<gu::uint64>(indexType);
+}
+
+void RHICommandList::SetGraphicsPipeline([[maybe_unused]] const gu::SharedPointer<core::GPUGraphicsPipelineState>& pipelineState)
+{
+	Record(CommandType::SetGraphicsPipeline);
+}
+
+void RHICommandList::SetComputePipeline([[maybe_unused]] const gu::SharedPointer<core::GPUComputePipelineState>& pipelineState)
+{
+	Record(CommandType::SetComputePipeline);
+}
+
+void RHICommandList::DrawIndexed(std::uint32_t indexCount, std::uint32_t startIndexLocation, std::uint32_t baseVertexLocation)
+{
+	DrawIndexedInstanced(indexCount, 1, startIndexLocation, baseVertexLocation, 0);
+}
+
+void RHICommandList::DrawIndexedInstanced(std::uint32_t indexCountPerInstance, std::uint32_t instanceCount, std::uint32_t startIndexLocation, std::uint32_t baseVertexLocation, std::uint32_t startInstanceLocation)
+{
+	auto& command = Record(CommandType::DrawIndexed);
+	command.Arguments[0] = indexCountPerInstance;
+	command.Arguments[1] = instanceCount;
+	command.Arguments[2] = startIndexLocation;
+	command.Arguments[3] = (static_cast<gu::uint64>(startInstanceLocation) << 32) | baseVertexLocation;
+
+	_statistics.DrawCount++;
+	_statistics.IndexCount    += static_cast<gu::uint64>(indexCountPerInstance) * instanceCount;
+	_statistics.InstanceCount += instanceCount;
+}
+
+void RHICommandList::DrawIndexedIndirect(const gu::SharedPointer<core::GPUBuffer>& argumentBuffer, const std::uint32_t drawCallCount)
+{
+	auto& command = Record(CommandType::DrawIndexedIndirect);
+	command.Resource [0] = AddBuffer(argumentBuffer);
+	command.Arguments[0] = drawCallCount;
+
+	_statistics.DrawCount += drawCallCount;
+}
+
+void RHICommandList::DispatchMesh(const std::uint32_t threadGroupCountX, const std::uint32_t threadGroupCountY, const std::uint32_t threadGroupCountZ)
+{
+	auto& command = Record(CommandType::DispatchMesh);
+	command.Arguments[0] = threadGroupCountX;
+	command.Arguments[1] = threadGroupCountY;
+	command.Arguments[2] = threadGroupCountZ;
+
+	_statistics.DispatchCount++;
+}
+
+void RHICommandList::Dispatch(std::uint32_t threadGroupCountX, std::uint32_t threadGroupCountY, std::uint32_t threadGroupCountZ)
+{
+	auto& command = Record(CommandType::Dispatch);
+	command.Arguments[0] = threadGroupCountX;
+	command.Arguments[1] = threadGroupCountY;
+	command.Arguments[2] = threadGroupCountZ;
+
+	_statistics.DispatchCount++;
+}
+#pragma endregion Graphics Command
+
+#pragma region Transition Resource State
+/****************************************************************************
+*                     TransitionResourceState
+*************************************************************************//**
+*  @fn        void RHICommandList::TransitionResourceState(const gu::SharedPointer<core::GPUTexture>& texture, core::ResourceState after)
+*
+*  @brief     Transition a single resource layout. Only the transition which changes the state is counted.
+*
+*  @param[in] const gu::SharedPointer<core::GPUTexture>& texture
+*  @param[in] core::ResourceState after
+*
+*  @return    void
+*****************************************************************************/
+void RHICommandList::TransitionResourceState(const gu::SharedPointer<core::GPUTexture>& texture, core::ResourceState after)
+{
+	TransitionResourceStates(1, &texture, &after);
+}
+
+/****************************************************************************
+*                     TransitionResourceStates
+*************************************************************************//**
+*  @fn        void RHICommandList::TransitionResourceStates(const std::uint32_t numStates, const gu::SharedPointer<core::GPUTexture>* textures, core::ResourceState* afters)
+*
+*  @brief     Transition resource layouts. Only the transitions which change the state are counted.
+*
+*  @param[in] const std::uint32_t numStates
+*  @param[in] const gu::SharedPointer<core::GPUTexture>* texture array,
+*  @param[in] core::ResourceState* state array
+*
+*  @return    void
+*****************************************************************************/
+void RHICommandList::TransitionResourceStates(const std::uint32_t numStates, const gu::SharedPointer<core::GPUTexture>* textures, core::ResourceState* afters)
+{
+	gu::uint64 barrierCount = 0;
+	for (std::uint32_t i = 0; i < numStates; ++i)
+	{
+		if (textures[i]->GetResourceState() == afters[i]) { continue; }
+		textures[i]->TransitionResourceState(afters[i]);
+		barrierCount++;
+	}
+
+	if (barrierCount == 0) { return; }
+
+	Record(CommandType::ResourceBarrier).Arguments[0] = barrierCount;
+	_statistics.BarrierCount += barrierCount;
+}
+
+void RHICommandList::TransitionResourceStates(const gu::DynamicArray<gu::SharedPointer<core::GPUResource>>& resources, core::ResourceState* afters)
+{
+	gu::uint64 barrierCount = 0;
+	for (gu::uint32 i = 0; i < resources.Size(); ++i)
+	{
+		if (resources[i]->GetResourceState() == afters[i]) { continue; }
+		resources[i]->TransitionResourceState(afters[i]);
+		barrierCount++;
+	}
+
+	if (barrierCount == 0) { return; }
+
+	Record(CommandType::ResourceBarrier).Arguments[0] = barrierCount;
+	_statistics.BarrierCount += barrierCount;
+}
+#pragma endregion Transition Resource State
+
+#pragma region Copy
+/****************************************************************************
+*                     CopyResource
+*************************************************************************//**
+*  @fn        void RHICommandList::CopyResource(const gu::SharedPointer<core::GPUTexture>& dest, const gu::SharedPointer<core::GPUTexture>& source)
+*
+*  @brief     Copy the whole texture (played back by the command queue)
+*
+*  @param[in] const gu::SharedPointer<core::GPUTexture>& dest
+*  @param[in] const gu::SharedPointer<core::GPUTexture>& source
+*
+*  @return    void
+*****************************************************************************/
+void RHICommandList::CopyResource(const gu::SharedPointer<core::GPUTexture>& dest, const gu::SharedPointer<core::GPUTexture>& source)
+{
+	using enum core::ResourceState;
+
+	Check(dest && source && dest != source);
+
+	core::ResourceState befores[] = { dest->GetResourceState(), source->GetResourceState() };
+	core::ResourceState afters[]  = { CopyDestination, CopySource };
+
+	TransitionResourceStates({ dest, source }, afters);
+
+	auto& command = Record(CommandType::CopyResource);
+	command.Resource[0] = AddTexture(dest);
+	command.Resource[1] = AddTexture(source);
+
+	TransitionResourceStates({ dest, source }, befores);
+}
+
+/****************************************************************************
+*                     CopyBufferRegion
+*************************************************************************//**
+*  @fn        void RHICommandList::CopyBufferRegion(const gu::SharedPointer<core::GPUBuffer>& dest, const gu::uint64 destOffset, const gu::SharedPointer<core::GPUBuffer>& source, const gu::uint64 sourceOffset, const gu::uint64 copyByteSize)
+*
+*  @brief     Copy the byte range of the buffer into the other buffer (played back by the command queue)
+*
+*  @param[in] const gu::SharedPointer<core::GPUBuffer>& dest
+*  @param[in] const gu::uint64 destOffset
+*  @param[in] const gu::SharedPointer<core::GPUBuffer>& source
+*  @param[in] const gu::uint64 sourceOffset
+*  @param[in] const gu::uint64 copyByteSize
+*
+*  @return    void
+*****************************************************************************/
+void RHICommandList::CopyBufferRegion(const gu::SharedPointer<core::GPUBuffer>& dest, const gu::uint64 destOffset, const gu::SharedPointer<core::GPUBuffer>& source, const gu::uint64 sourceOffset, const gu::uint64 copyByteSize)
+{
+	using enum core::ResourceState;
+
+	Checkf(dest != source, "CopyBufferRegion cannot be used on the same resource.");
+	Check(destOffset   + copyByteSize <= dest  ->GetTotalByteSize());
+	Check(sourceOffset + copyByteSize <= source->GetTotalByteSize());
+
+	core::ResourceState befores[] = { dest->GetResourceState(), source->GetResourceState() };
+	core::ResourceState afters[]  = { CopyDestination, CopySource };
+
+	TransitionResourceStates({ dest, source }, afters);
+
+	auto& command = Record(CommandType::CopyBufferRegion);
+	command.Resource [0] = AddBuffer(dest);
+	command.Resource [1] = AddBuffer(source);
+	command.Arguments[0] = destOffset;
+	command.Arguments[1] = sourceOffset;
+	command.Arguments[2] = copyByteSize;
+
+	TransitionResourceStates({ dest, source }, befores);
+}
+
+/****************************************************************************
+*                     CopyTextureRegion
+*************************************************************************//**
+*  @fn        void RHICommandList::CopyTextureRegion(const gu::SharedPointer<core::GPUTexture>& dest, const gu::uint32 destX, const gu::uint32 destY, const gu::SharedPointer<core::GPUTexture>& source)
+*
+*  @brief     Copy mip 0 of the source into mip 0 of the dest at (destX, destY) (played back by the command queue)
+*
+*  @param[in] const gu::SharedPointer<core::GPUTexture>& dest
+*  @param[in] const gu::uint32 destX
+*  @param[in] const gu::uint32 destY
+*  @param[in] const gu::SharedPointer<core::GPUTexture>& source
+*
+*  @return    void
+*****************************************************************************/
+void RHICommandList::CopyTextureRegion(const gu::SharedPointer<core::GPUTexture>& dest, const gu::uint32 destX, const gu::uint32 destY, const gu::SharedPointer<core::GPUTexture>& source)
+{
+	using enum core::ResourceState;
+
+	Check(dest && source && dest != source);
+	Check(dest->GetPixelFormat() == source->GetPixelFormat());
+	Check(destX + source->GetWidth() <= dest->GetWidth() && destY + source->GetHeight() <= dest->GetHeight());
+
+	core::ResourceState befores[] = { dest->GetResourceState(), source->GetResourceState() };
+	core::ResourceState afters[]  = { CopyDestination, CopySource };
+
+	TransitionResourceStates({ dest, source }, afters);
+
+	auto& command = Record(CommandType::CopyTextureRegion);
+	command.Resource [0] = AddTexture(dest);
+	command.Resource [1] = AddTexture(source);
+	command.Arguments[0] = destX;
+	command.Arguments[1] = destY;
+
+	TransitionResourceStates({ dest, source }, befores);
+}
+#pragma endregion Copy
+
+#pragma region Protected Function
+/****************************************************************************
+*                     Record
+*************************************************************************//**
+*  @fn        Command& RHICommandList::Record(const CommandType type)
+*
+*  @brief     Append the command and return it to fill the parameters
+*
+*  @param[in] const CommandType type
+*
+*  @return    Command&
+*****************************************************************************/
+Command& RHICommandList::Record(const CommandType type)
+{
+	Checkf(IsOpen(), "The command list is closed. Call BeginRecording first.");
+
+	Command command = {};
+	command.Type = type;
+	_commands.Push(command);
+
+	_statistics.CommandCount++;
+	return _commands.Back();
+}
+
+gu::uint32 RHICommandList::AddBuffer(const gu::SharedPointer<core::GPUBuffer>& buffer)
+{
+	_buffers.Push(buffer);
+	return static_cast<gu::uint32>(_buffers.Size() - 1);
+}
+
+gu::uint32 RHICommandList::AddTexture(const gu::SharedPointer<core::GPUTexture>& texture)
+{
+	_textures.Push(texture);
+	return static_cast<gu::uint32>(_textures.Size() - 1);
+}
+
+gu::uint32 RHICommandList::AddQuery(const gu::SharedPointer<core::RHIQuery>& query)
+{
+	_queries.Push(query);
+	return static_cast<gu::uint32>(_queries.Size() - 1);
+}
+#pragma endregion Protected Function
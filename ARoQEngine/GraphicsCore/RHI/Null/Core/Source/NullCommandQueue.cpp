@@ -0,0 +1,257 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullCommandQueue.cpp
+///             @brief  Null RHI command queue
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/NullCommandQueue.hpp"
+#include "../Include/NullCommandList.hpp"
+#include "../Include/NullDevice.hpp"
+#include "../Include/NullFence.hpp"
+#include "../Include/NullQuery.hpp"
+#include "GraphicsCore/RHI/Null/Resource/Include/NullGPUBuffer.hpp"
+#include "GraphicsCore/RHI/Null/Resource/Include/NullGPUTexture.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include "GameUtility/Base/Include/GUProfiler.hpp"
+#include "GameUtility/Memory/Include/GUMemory.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::null;
+
+namespace
+{
+	gu::uint64 Now()
+	{
+		return static_cast<gu::uint64>(gu::Profiler::GetClockMicroseconds());
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+RHICommandQueue::RHICommandQueue(const gu::SharedPointer<core::RHIDevice>& device, const core::CommandListType type, const gu::tstring& name)
+	: core::RHICommandQueue(device, type), _name(name)
+{
+	Check(device);
+	Check(type != core::CommandListType::Unknown);
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Execute Function
+/****************************************************************************
+*							Wait
+*************************************************************************//**
+*  @fn        void RHICommandQueue::Wait(const gu::SharedPointer<core::RHIFence>& fence, const gu::uint64 value)
+*
+*  @brief     The following submissions start after the fence value is completed. The CPU is not blocked.
+*             If the value has not been signaled yet, the queue waits from the current time.
+*
+*  @param[in] const gu::SharedPointer<core::RHIFence>& fence
+*  @param[in] const gu::uint64 value
+*
+*  @return    void
+*****************************************************************************/
+void RHICommandQueue::Wait(const gu::SharedPointer<core::RHIFence>& fence, const gu::uint64 value)
+{
+	const auto completionTime = static_cast<null::RHIFence*>(fence.Get())->GetCompletionTime(value);
+	const auto now            = Now();
+
+	std::scoped_lock lock(_mutex);
+	const auto waitUntil = completionTime == 0 ? 0 : completionTime == static_cast<gu::uint64>(-1) ? now : completionTime;
+	if (_busyUntil < waitUntil) { _busyUntil = waitUntil; }
+}
+
+/****************************************************************************
+*							Signal
+*************************************************************************//**
+*  @fn        void RHICommandQueue::Signal(const gu::SharedPointer<core::RHIFence>& fence, const gu::uint64 value)
+*
+*  @brief     The fence value is completed when the submitted work has finished on the simulated GPU.
+*
+*  @param[in] const gu::SharedPointer<core::RHIFence>& fence
+*  @param[in] const gu::uint64 value
+*
+*  @return    void
+*****************************************************************************/
+void RHICommandQueue::Signal(const gu::SharedPointer<core::RHIFence>& fence, const gu::uint64 value)
+{
+	const auto now = Now();
+
+	gu::uint64 completionTime = 0;
+	{
+		std::scoped_lock lock(_mutex);
+		completionTime = _busyUntil > now ? _busyUntil : now;
+	}
+
+	static_cast<null::RHIFence*>(fence.Get())->SignalAt(value, completionTime);
+}
+
+/****************************************************************************
+*							Execute
+*************************************************************************//**
+*  @fn        void RHICommandQueue::Execute(const gu::DynamicArray<gu::SharedPointer<core::RHICommandList>>& commandLists)
+*
+*  @brief     Play back the copies and the queries of the command lists,
+*             occupy the queue for the simulated execution time and count the work in the device statistics.
+*
+*  @param[in] const gu::DynamicArray<gu::SharedPointer<core::RHICommandList>>& commandLists
+*
+*  @return    void
+*****************************************************************************/
+void RHICommandQueue::Execute(const gu::DynamicArray<gu::SharedPointer<core::RHICommandList>>& commandLists)
+{
+	if (commandLists.IsEmpty()) { return; }
+
+	const auto nullDevice = static_cast<null::RHIDevice*>(_device.Get());
+	const auto now        = Now();
+
+	/*-------------------------------------------------------------------
+	-           Advance the simulated GPU timeline
+	---------------------------------------------------------------------*/
+	const auto executeTime = nullDevice->GetSimulatedExecuteMicroseconds();
+
+	gu::uint64 startTime = 0;
+	{
+		std::scoped_lock lock(_mutex);
+		startTime  = _busyUntil > now ? _busyUntil : now;
+		_busyUntil = startTime + executeTime;
+	}
+
+	/*-------------------------------------------------------------------
+	-           Play back and count the work
+	---------------------------------------------------------------------*/
+	// The execution time is divided equally between the command lists
+	const auto listTime = executeTime / commandLists.Size();
+
+	Statistics statistics = {};
+	for (gu::uint64 i = 0; i < commandLists.Size(); ++i)
+	{
+		const auto& commandList = commandLists[i];
+		Checkf(commandList->IsClosed(), "The command list must be closed before the execution.");
+
+		const auto nullCommandList = static_cast<null::RHICommandList*>(commandList.Get());
+		PlayBack(*nullCommandList, statistics, startTime + listTime * i, listTime);
+
+		const auto& recorded = nullCommandList->GetStatistics();
+		statistics.CommandCount  += recorded.CommandCount;
+		statistics.DrawCount     += recorded.DrawCount;
+		statistics.DispatchCount += recorded.DispatchCount;
+		statistics.IndexCount    += recorded.IndexCount;
+		statistics.InstanceCount += recorded.InstanceCount;
+		statistics.BarrierCount  += recorded.BarrierCount;
+		statistics.ExecuteCount++;
+	}
+
+	nullDevice->AddStatistics(statistics);
+}
+#pragma endregion Execute Function
+
+#pragma region Property
+/****************************************************************************
+*							GetCalibrationTimestamp
+*************************************************************************//**
+*  @fn        core::GPUTimingCalibrationTimestamp RHICommandQueue::GetCalibrationTimestamp()
+*
+*  @brief     The simulated GPU uses the CPU clock, so both timestamps are the same.
+*
+*  @param[in] void
+*
+*  @return    core::GPUTimingCalibrationTimestamp
+*****************************************************************************/
+core::GPUTimingCalibrationTimestamp RHICommandQueue::GetCalibrationTimestamp()
+{
+	const auto now = Now();
+	return core::GPUTimingCalibrationTimestamp(now, now);
+}
+#pragma endregion Property
+
+#pragma region Protected Function
+/****************************************************************************
+*							PlayBack
+*************************************************************************//**
+*  @fn        void RHICommandQueue::PlayBack(const RHICommandList& commandList, Statistics& statistics, const gu::uint64 startTime, const gu::uint64 executeTime)
+*
+*  @brief     Play back the commands which have the visible result on the CPU side memory.
+*             The draws and the dispatches are only counted.
+*             The timestamp query is stamped at the time proportional to the command position in the list,
+*             so the GPU profiler zones have the width on the simulated timeline.
+*
+*  @param[in]  const RHICommandList& commandList
+*  @param[out] Statistics& statistics (CopyBytes)
+*  @param[in]  const gu::uint64 startTime   : time at which the simulated GPU starts the list
+*  @param[in]  const gu::uint64 executeTime : time which the simulated GPU spends on the list
+*
+*  @return    void
+*****************************************************************************/
+void RHICommandQueue::PlayBack(const RHICommandList& commandList, Statistics& statistics, const gu::uint64 startTime, const gu::uint64 executeTime)
+{
+	const auto& commands = commandList.GetCommands();
+	for (gu::uint64 i = 0; i < commands.Size(); ++i)
+	{
+		const auto& command = commands[i];
+
+		switch (command.Type)
+		{
+			case CommandType::CopyBufferRegion:
+			{
+				const auto& dest   = commandList.GetBuffer(command.Resource[0]);
+				const auto& source = commandList.GetBuffer(command.Resource[1]);
+				gu::Memory::Copy(dest->GetCPUMemory() + command.Arguments[0], source->GetCPUMemory() + command.Arguments[1], command.Arguments[2]);
+				statistics.CopyBytes += command.Arguments[2];
+				break;
+			}
+			case CommandType::CopyResource:
+			{
+				const auto dest   = static_cast<null::GPUTexture*>(commandList.GetTexture(command.Resource[0]).Get());
+				const auto source = static_cast<null::GPUTexture*>(commandList.GetTexture(command.Resource[1]).Get());
+				const auto byteSize = dest->GetCPUMemorySize() < source->GetCPUMemorySize() ? dest->GetCPUMemorySize() : source->GetCPUMemorySize();
+				gu::Memory::Copy(dest->GetCPUMemory(), source->GetCPUMemory(), byteSize);
+				statistics.CopyBytes += byteSize;
+				break;
+			}
+			case CommandType::CopyTextureRegion:
+			{
+				const auto dest   = static_cast<null::GPUTexture*>(commandList.GetTexture(command.Resource[0]).Get());
+				const auto source = static_cast<null::GPUTexture*>(commandList.GetTexture(command.Resource[1]).Get());
+
+				const auto pixelSize   = core::PixelFormatSizeOf::Get(source->GetPixelFormat());
+				const auto rowByteSize = source->GetWidth() * pixelSize;
+				for (gu::uint64 y = 0; y < source->GetHeight(); ++y)
+				{
+					const auto destOffset = ((command.Arguments[1] + y) * dest->GetWidth() + command.Arguments[0]) * pixelSize;
+					gu::Memory::Copy(dest->GetCPUMemory() + destOffset, source->GetCPUMemory() + y * rowByteSize, rowByteSize);
+				}
+				statistics.CopyBytes += rowByteSize * source->GetHeight();
+				break;
+			}
+			case CommandType::EndQuery:
+			{
+				const auto query = static_cast<null::RHIQuery*>(commandList.GetQuery(command.Resource[0]).Get());
+				if (query->GetHeapType() == core::QueryHeapType::TimeStamp || query->GetHeapType() == core::QueryHeapType::CopyQueueTimeStamp)
+				{
+					query->WriteResult(static_cast<gu::uint32>(command.Arguments[0]), startTime + executeTime * (i + 1) / commands.Size());
+				}
+				break;
+			}
+			case CommandType::ResolveQueryData:
+			{
+				const auto query = static_cast<null::RHIQuery*>(commandList.GetQuery(command.Resource[0]).Get());
+				query->Resolve(static_cast<gu::uint32>(command.Arguments[0]), static_cast<gu::uint32>(command.Arguments[1]));
+				break;
+			}
+			default:
+			{
+				break;
+			}
+		}
+	}
+}
+#pragma endregion Protected Function
@@ -0,0 +1,141 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullDescriptorHeap.cpp
+///             @brief  Null RHI descriptor heap
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/NullDescriptorHeap.hpp"
+#include <stdexcept>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::null;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Public Function
+/****************************************************************************
+*                     Allocate
+*************************************************************************//**
+*  @fn        RHIDescriptorHeap::DescriptorID RHIDescriptorHeap::Allocate(const core::DescriptorHeapType heapType, const gu::SharedPointer<core::RHIResourceLayout>& resourceLayout)
+*
+*  @brief     Return the unused descriptor id in the heap type
+*
+*  @param[in] const core::DescriptorHeapType heapType
+*  @param[in] const gu::SharedPointer<core::RHIResourceLayout>& resourceLayout (not used)
+*
+*  @return    DescriptorID
+*****************************************************************************/
+RHIDescriptorHeap::DescriptorID RHIDescriptorHeap::Allocate(const core::DescriptorHeapType heapType, [[maybe_unused]] const gu::SharedPointer<core::RHIResourceLayout>& resourceLayout)
+{
+	if (!_heapInfo.Contains(heapType)) { throw std::runtime_error("Not include heap type"); }
+
+	auto& allocator = _allocators[heapType];
+	if (!allocator.FreeIDs.IsEmpty())
+	{
+		const auto id = allocator.FreeIDs.Back();
+		allocator.FreeIDs.Pop();
+		return id;
+	}
+
+	if (allocator.NextID >= _heapInfo.At(heapType)) { throw std::runtime_error("The descriptor heap is full"); }
+	return allocator.NextID++;
+}
+
+/****************************************************************************
+*                     Free
+*************************************************************************//**
+*  @fn        void RHIDescriptorHeap::Free(const core::DescriptorHeapType heapType, const DescriptorID offsetIndex)
+*
+*  @brief     Return the descriptor id to the heap type
+*
+*  @param[in] const core::DescriptorHeapType heapType
+*  @param[in] const DescriptorID offsetIndex
+*
+*  @return    void
+*****************************************************************************/
+void RHIDescriptorHeap::Free(const core::DescriptorHeapType heapType, const DescriptorID offsetIndex)
+{
+	if (!_heapInfo.Contains(heapType)) { return; }
+	_allocators[heapType].FreeIDs.Push(offsetIndex);
+}
+
+/****************************************************************************
+*                     Resize
+*************************************************************************//**
+*  @fn        void RHIDescriptorHeap::Resize(const core::DescriptorHeapType type, const size_t viewCount)
+*
+*  @brief     Resize max view count size heap
+*
+*  @param[in] const core::DescriptorHeapType type
+*  @param[in] const size_t viewCount
+*
+*  @return    void
+*****************************************************************************/
+void RHIDescriptorHeap::Resize(const core::DescriptorHeapType type, const size_t viewCount)
+{
+	gu::SortedMap<core::DescriptorHeapType, MaxDescriptorSize> heapInfo;
+	heapInfo[type] = viewCount;
+	Resize(heapInfo);
+}
+
+/****************************************************************************
+*                     Resize
+*************************************************************************//**
+*  @fn        void RHIDescriptorHeap::Resize(const gu::SortedMap<core::DescriptorHeapType, MaxDescriptorSize>& heapInfos)
+*
+*  @brief     Grow the max view count of each heap type. The issued ids are kept.
+*
+*  @param[in] const gu::SortedMap<core::DescriptorHeapType, MaxDescriptorSize>& heapInfos
+*
+*  @return    void
+*****************************************************************************/
+void RHIDescriptorHeap::Resize(const gu::SortedMap<core::DescriptorHeapType, MaxDescriptorSize>& heapInfos)
+{
+	for (const auto& heapInfo : heapInfos)
+	{
+		if (_heapInfo.Contains(heapInfo.Key) && _heapInfo.At(heapInfo.Key) >= heapInfo.Value) { continue; }
+		_heapInfo[heapInfo.Key] = heapInfo.Value;
+	}
+
+	_totalHeapCount = 0;
+	for (const auto& heapInfo : _heapInfo)
+	{
+		_totalHeapCount += heapInfo.Value;
+	}
+}
+
+/****************************************************************************
+*                     Reset
+*************************************************************************//**
+*  @fn        void RHIDescriptorHeap::Reset(const ResetFlag flag)
+*
+*  @brief     Reset the issued ids. ResetFlag::All also removes the heap types.
+*
+*  @param[in] const ResetFlag flag
+*
+*  @return    void
+*****************************************************************************/
+void RHIDescriptorHeap::Reset(const ResetFlag flag)
+{
+	for (auto& allocator : _allocators)
+	{
+		allocator.Value.NextID = 0;
+		allocator.Value.FreeIDs.Clear();
+	}
+
+	if (flag == ResetFlag::All)
+	{
+		_heapInfo.Clear();
+		_allocators.Clear();
+		_totalHeapCount = 0;
+	}
+}
+#pragma endregion Public Function
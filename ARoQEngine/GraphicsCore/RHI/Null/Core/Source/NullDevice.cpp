@@ -0,0 +1,324 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullDevice.cpp
+///             @brief  Null RHI logical device
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/NullDevice.hpp"
+#include "../Include/NullCommandAllocator.hpp"
+#include "../Include/NullCommandList.hpp"
+#include "../Include/NullCommandQueue.hpp"
+#include "../Include/NullDescriptorHeap.hpp"
+#include "../Include/NullFence.hpp"
+#include "../Include/NullFrameBuffer.hpp"
+#include "../Include/NullQuery.hpp"
+#include "../Include/NullRenderPass.hpp"
+#include "../Include/NullResourceLayout.hpp"
+#include "../Include/NullSwapchain.hpp"
+#include "GraphicsCore/RHI/Null/PipelineState/Include/NullGPUPipelineFactory.hpp"
+#include "GraphicsCore/RHI/Null/PipelineState/Include/NullGPUPipelineState.hpp"
+#include "GraphicsCore/RHI/Null/Resource/Include/NullGPUBuffer.hpp"
+#include "GraphicsCore/RHI/Null/Resource/Include/NullGPUTexture.hpp"
+#include "GraphicsCore/RHI/Null/Resource/Include/NullGPUResourceView.hpp"
+#include "GraphicsCore/RHI/Null/Resource/Include/NullGPUSampler.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::null;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+RHIDevice::RHIDevice(const gu::SharedPointer<core::RHIDisplayAdapter>& adapter, const core::RHIMultiGPUMask& mask) :
+	core::RHIDevice(adapter, mask)
+{
+
+}
+
+RHIDevice::~RHIDevice()
+{
+	Destroy();
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Set up and Destroy
+/****************************************************************************
+*                     SetUpDefaultHeap
+*************************************************************************//**
+*  @fn        void RHIDevice::SetUpDefaultHeap(const core::DefaultHeapCount& heapCount)
+*
+*  @brief     Set up the default descriptor heap shared by all heap types
+*
+*  @param[in] const core::DefaultHeapCount& heapCount
+*
+*  @return    void
+*****************************************************************************/
+void RHIDevice::SetUpDefaultHeap(const core::DefaultHeapCount& heapCount)
+{
+	gu::SortedMap<core::DescriptorHeapType, size_t> heapInfoList;
+	heapInfoList[core::DescriptorHeapType::CBV]     = heapCount.CBVDescCount;
+	heapInfoList[core::DescriptorHeapType::SRV]     = heapCount.SRVDescCount;
+	heapInfoList[core::DescriptorHeapType::UAV]     = heapCount.UAVDescCount;
+	heapInfoList[core::DescriptorHeapType::SAMPLER] = heapCount.SamplerDescCount;
+	heapInfoList[core::DescriptorHeapType::RTV]     = heapCount.RTVDescCount;
+	heapInfoList[core::DescriptorHeapType::DSV]     = heapCount.DSVDescCount;
+
+	_defaultHeap = gu::StaticPointerCast<core::RHIDescriptorHeap>(gu::MakeShared<null::RHIDescriptorHeap>(SharedFromThis()));
+	_defaultHeap->Resize(heapInfoList);
+}
+
+/****************************************************************************
+*                     Destroy
+*************************************************************************//**
+*  @fn        void RHIDevice::Destroy()
+*
+*  @brief     Release the default descriptor heap
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
+void RHIDevice::Destroy()
+{
+	if (_defaultHeap) { _defaultHeap.Reset(); }
+}
+#pragma endregion Set up and Destroy
+
+#pragma region Create Function
+gu::SharedPointer<core::RHIFrameBuffer> RHIDevice::CreateFrameBuffer(const gu::SharedPointer<core::RHIRenderPass>& renderPass, const gu::DynamicArray<gu::SharedPointer<core::GPUTexture>>& renderTargets, const gu::SharedPointer<core::GPUTexture>& depthStencil)
+{
+	return gu::StaticPointerCast<core::RHIFrameBuffer>(gu::MakeShared<null::RHIFrameBuffer>(SharedFromThis(), renderPass, renderTargets, depthStencil));
+}
+
+gu::SharedPointer<core::RHIFrameBuffer> RHIDevice::CreateFrameBuffer(const gu::SharedPointer<core::RHIRenderPass>& renderPass, const gu::SharedPointer<core::GPUTexture>& renderTarget, const gu::SharedPointer<core::GPUTexture>& depthStencil)
+{
+	return gu::StaticPointerCast<core::RHIFrameBuffer>(gu::MakeShared<null::RHIFrameBuffer>(SharedFromThis(), renderPass, renderTarget, depthStencil));
+}
+
+gu::SharedPointer<core::RHIFence> RHIDevice::CreateFence(const gu::uint64 fenceValue, const gu::tstring& name)
+{
+	return gu::StaticPointerCast<core::RHIFence>(gu::MakeShared<null::RHIFence>(SharedFromThis(), fenceValue, name));
+}
+
+gu::SharedPointer<core::RHICommandList> RHIDevice::CreateCommandList(const gu::SharedPointer<core::RHICommandAllocator>& commandAllocator, const gu::tstring& name)
+{
+	return gu::StaticPointerCast<core::RHICommandList>(gu::MakeShared<null::RHICommandList>(SharedFromThis(), commandAllocator, name));
+}
+
+gu::SharedPointer<core::RHICommandQueue> RHIDevice::CreateCommandQueue(const core::CommandListType type, const gu::tstring& name)
+{
+	return gu::StaticPointerCast<core::RHICommandQueue>(gu::MakeShared<null::RHICommandQueue>(SharedFromThis(), type, name));
+}
+
+gu::SharedPointer<core::RHICommandAllocator> RHIDevice::CreateCommandAllocator(const core::CommandListType type, const gu::tstring& name)
+{
+	return gu::StaticPointerCast<core::RHICommandAllocator>(gu::MakeShared<null::RHICommandAllocator>(SharedFromThis(), type, name));
+}
+
+gu::SharedPointer<core::RHISwapchain> RHIDevice::CreateSwapchain(const gu::SharedPointer<core::RHICommandQueue>& commandQueue, const core::WindowInfo& windowInfo, const core::PixelFormat& pixelFormat, const size_t frameBufferCount, const gu::uint32 vsync, const bool isValidHDR)
+{
+	return gu::StaticPointerCast<core::RHISwapchain>(gu::MakeShared<null::RHISwapchain>(SharedFromThis(), commandQueue, windowInfo, pixelFormat, frameBufferCount, vsync, isValidHDR));
+}
+
+gu::SharedPointer<core::RHISwapchain> RHIDevice::CreateSwapchain(const core::SwapchainDesc& desc)
+{
+	return gu::StaticPointerCast<core::RHISwapchain>(gu::MakeShared<null::RHISwapchain>(SharedFromThis(), desc));
+}
+
+gu::SharedPointer<core::RHIDescriptorHeap> RHIDevice::CreateDescriptorHeap(const core::DescriptorHeapType heapType, const size_t maxDescriptorCount)
+{
+	auto heapPtr = gu::StaticPointerCast<core::RHIDescriptorHeap>(gu::MakeShared<null::RHIDescriptorHeap>(SharedFromThis()));
+	heapPtr->Resize(heapType, maxDescriptorCount);
+	return heapPtr;
+}
+
+gu::SharedPointer<core::RHIDescriptorHeap> RHIDevice::CreateDescriptorHeap(const gu::SortedMap<core::DescriptorHeapType, size_t>& heapInfo)
+{
+	auto heapPtr = gu::StaticPointerCast<core::RHIDescriptorHeap>(gu::MakeShared<null::RHIDescriptorHeap>(SharedFromThis()));
+	heapPtr->Resize(heapInfo);
+	return heapPtr;
+}
+
+gu::SharedPointer<core::RHIRenderPass> RHIDevice::CreateRenderPass(const gu::DynamicArray<core::Attachment>& colors, const gu::Optional<core::Attachment>& depth)
+{
+	return gu::StaticPointerCast<core::RHIRenderPass>(gu::MakeShared<null::RHIRenderPass>(SharedFromThis(), colors, depth));
+}
+
+gu::SharedPointer<core::RHIRenderPass> RHIDevice::CreateRenderPass(const core::Attachment& color, const gu::Optional<core::Attachment>& depth)
+{
+	return gu::StaticPointerCast<core::RHIRenderPass>(gu::MakeShared<null::RHIRenderPass>(SharedFromThis(), color, depth));
+}
+
+gu::SharedPointer<core::GPUGraphicsPipelineState> RHIDevice::CreateGraphicPipelineState(const gu::SharedPointer<core::RHIRenderPass>& renderPass, const gu::SharedPointer<core::RHIResourceLayout>& resourceLayout)
+{
+	return gu::StaticPointerCast<core::GPUGraphicsPipelineState>(gu::MakeShared<null::GPUGraphicsPipelineState>(SharedFromThis(), renderPass, resourceLayout));
+}
+
+gu::SharedPointer<core::GPUComputePipelineState> RHIDevice::CreateComputePipelineState(const gu::SharedPointer<core::RHIResourceLayout>& resourceLayout)
+{
+	return gu::StaticPointerCast<core::GPUComputePipelineState>(gu::MakeShared<null::GPUComputePipelineState>(SharedFromThis(), resourceLayout));
+}
+
+gu::SharedPointer<core::RHIResourceLayout> RHIDevice::CreateResourceLayout(const gu::DynamicArray<core::ResourceLayoutElement>& elements, const gu::DynamicArray<core::SamplerLayoutElement>& samplers, const gu::Optional<core::Constant32Bits>& constant32Bits, const gu::tstring& name)
+{
+	return gu::StaticPointerCast<core::RHIResourceLayout>(gu::MakeShared<null::RHIResourceLayout>(SharedFromThis(), elements, samplers, constant32Bits, name));
+}
+
+gu::SharedPointer<core::GPUPipelineFactory> RHIDevice::CreatePipelineFactory()
+{
+	return gu::StaticPointerCast<core::GPUPipelineFactory>(gu::MakeShared<null::GPUPipelineFactory>(SharedFromThis()));
+}
+
+gu::SharedPointer<core::GPUResourceView> RHIDevice::CreateResourceView(const core::ResourceViewType viewType, const gu::SharedPointer<core::GPUTexture>& texture, const gu::uint32 mipSlice, const gu::uint32 planeSlice, const gu::SharedPointer<core::RHIDescriptorHeap>& customHeap)
+{
+	return gu::StaticPointerCast<core::GPUResourceView>(gu::MakeShared<null::GPUResourceView>(SharedFromThis(), viewType, texture, mipSlice, planeSlice, customHeap));
+}
+
+gu::SharedPointer<core::GPUResourceView> RHIDevice::CreateResourceView(const core::ResourceViewType viewType, const gu::SharedPointer<core::GPUBuffer>& buffer, const gu::uint32 mipSlice, const gu::uint32 planeSlice, const gu::SharedPointer<core::RHIDescriptorHeap>& customHeap)
+{
+	return gu::StaticPointerCast<core::GPUResourceView>(gu::MakeShared<null::GPUResourceView>(SharedFromThis(), viewType, buffer, mipSlice, planeSlice, customHeap));
+}
+
+gu::SharedPointer<core::GPUSampler> RHIDevice::CreateSampler(const core::SamplerInfo& samplerInfo)
+{
+	return gu::StaticPointerCast<core::GPUSampler>(gu::MakeShared<null::GPUSampler>(SharedFromThis(), samplerInfo));
+}
+
+gu::SharedPointer<core::GPUBuffer> RHIDevice::CreateBuffer(const core::GPUBufferMetaData& metaData, const gu::tstring& name)
+{
+	return gu::StaticPointerCast<core::GPUBuffer>(gu::MakeShared<null::GPUBuffer>(SharedFromThis(), metaData, name));
+}
+
+gu::SharedPointer<core::GPUTexture> RHIDevice::CreateTexture(const core::GPUTextureMetaData& metaData, const gu::tstring& name)
+{
+	return gu::StaticPointerCast<core::GPUTexture>(gu::MakeShared<null::GPUTexture>(SharedFromThis(), metaData, name));
+}
+
+gu::SharedPointer<core::GPUTexture> RHIDevice::CreateTextureEmpty()
+{
+	return gu::StaticPointerCast<core::GPUTexture>(gu::MakeShared<null::GPUTexture>(SharedFromThis()));
+}
+
+gu::SharedPointer<core::RayTracingGeometry> RHIDevice::CreateRayTracingGeometry([[maybe_unused]] const core::RayTracingGeometryFlags flags, [[maybe_unused]] const gu::SharedPointer<core::GPUBuffer>& vertexBuffer, [[maybe_unused]] const gu::SharedPointer<core::GPUBuffer>& indexBuffer)
+{
+	return nullptr;
+}
+
+gu::SharedPointer<core::ASInstance> RHIDevice::CreateASInstance(
+	[[maybe_unused]] const gu::SharedPointer<core::BLASBuffer>& blasBuffer, [[maybe_unused]] const gm::Float3x4& blasTransform,
+	[[maybe_unused]] const gu::uint32 instanceID, [[maybe_unused]] const gu::uint32 instanceContributionToHitGroupIndex,
+	[[maybe_unused]] const gu::uint32 instanceMask, [[maybe_unused]] const core::RayTracingInstanceFlags flags)
+{
+	return nullptr;
+}
+
+gu::SharedPointer<core::BLASBuffer> RHIDevice::CreateRayTracingBLASBuffer([[maybe_unused]] const gu::DynamicArray<gu::SharedPointer<core::RayTracingGeometry>>& geometryDesc, [[maybe_unused]] const core::BuildAccelerationStructureFlags flags)
+{
+	return nullptr;
+}
+
+gu::SharedPointer<core::TLASBuffer> RHIDevice::CreateRayTracingTLASBuffer([[maybe_unused]] const gu::DynamicArray<gu::SharedPointer<core::ASInstance>>& asInstances, [[maybe_unused]] const core::BuildAccelerationStructureFlags flags)
+{
+	return nullptr;
+}
+
+gu::SharedPointer<core::RHIQuery> RHIDevice::CreateQuery(const core::QueryHeapType heapType)
+{
+	return gu::StaticPointerCast<core::RHIQuery>(gu::MakeShared<null::RHIQuery>(SharedFromThis(), heapType));
+}
+#pragma endregion Create Function
+
+#pragma region Statistics
+/****************************************************************************
+*                     GetStatistics
+*************************************************************************//**
+*  @fn        Statistics RHIDevice::GetStatistics() const
+*
+*  @brief     Return the work counted since the creation or the last ResetStatistics
+*
+*  @param[in] void
+*
+*  @return    Statistics
+*****************************************************************************/
+Statistics RHIDevice::GetStatistics() const
+{
+	std::scoped_lock lock(_statisticsMutex);
+	return _statistics;
+}
+
+void RHIDevice::ResetStatistics()
+{
+	std::scoped_lock lock(_statisticsMutex);
+	_statistics = {};
+}
+
+/****************************************************************************
+*                     AddStatistics
+*************************************************************************//**
+*  @fn        void RHIDevice::AddStatistics(const Statistics& statistics)
+*
+*  @brief     Accumulate the statistics of the executed command lists
+*
+*  @param[in] const Statistics& statistics
+*
+*  @return    void
+*****************************************************************************/
+void RHIDevice::AddStatistics(const Statistics& statistics)
+{
+	std::scoped_lock lock(_statisticsMutex);
+	_statistics.CommandCount         += statistics.CommandCount;
+	_statistics.DrawCount            += statistics.DrawCount;
+	_statistics.DispatchCount        += statistics.DispatchCount;
+	_statistics.IndexCount           += statistics.IndexCount;
+	_statistics.InstanceCount        += statistics.InstanceCount;
+	_statistics.BarrierCount         += statistics.BarrierCount;
+	_statistics.DescriptorWriteCount += statistics.DescriptorWriteCount;
+	_statistics.UploadBytes          += statistics.UploadBytes;
+	_statistics.CopyBytes            += statistics.CopyBytes;
+	_statistics.ExecuteCount         += statistics.ExecuteCount;
+	_statistics.PresentCount         += statistics.PresentCount;
+}
+
+void RHIDevice::CountDescriptorWrite(const gu::uint64 count)
+{
+	std::scoped_lock lock(_statisticsMutex);
+	_statistics.DescriptorWriteCount += count;
+}
+
+void RHIDevice::CountUploadBytes(const gu::uint64 byteSize)
+{
+	std::scoped_lock lock(_statisticsMutex);
+	_statistics.UploadBytes += byteSize;
+}
+
+void RHIDevice::CountPresent()
+{
+	std::scoped_lock lock(_statisticsMutex);
+	_statistics.PresentCount++;
+}
+#pragma endregion Statistics
+
+#pragma region Property
+/****************************************************************************
+*                     GetDefaultHeap
+*************************************************************************//**
+*  @fn        gu::SharedPointer<core::RHIDescriptorHeap> RHIDevice::GetDefaultHeap(const core::DescriptorHeapType heapType)
+*
+*  @brief     Return the default heap. All heap types share the one heap.
+*
+*  @param[in] const core::DescriptorHeapType heapType (unused)
+*
+*  @return    gu::SharedPointer<core::RHIDescriptorHeap>
+*****************************************************************************/
+gu::SharedPointer<core::RHIDescriptorHeap> RHIDevice::GetDefaultHeap([[maybe_unused]] const core::DescriptorHeapType heapType)
+{
+	return _defaultHeap;
+}
+#pragma endregion Property
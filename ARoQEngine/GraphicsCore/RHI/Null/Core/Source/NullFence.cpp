@@ -0,0 +1,182 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullFence.cpp
+///             @brief  Null RHI fence
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/NullFence.hpp"
+#include "GameUtility/Base/Include/GUProfiler.hpp"
+#include <thread>
+#include <chrono>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::null;
+
+namespace
+{
+	/* @brief : Wait time when the value has not been signaled yet (the other thread may submit it)*/
+	constexpr gu::uint64 UNSIGNALED_POLLING_MICROSECONDS = 100;
+
+	constexpr gu::uint64 NOT_SIGNALED = static_cast<gu::uint64>(-1);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+RHIFence::RHIFence(const gu::SharedPointer<core::RHIDevice>& device, const std::uint64_t initialValue, const gu::tstring& name)
+	: core::RHIFence(device), _completedValue(initialValue), _name(name)
+{
+
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Public Function
+/****************************************************************************
+*                     Signal
+*************************************************************************//**
+*  @fn        void RHIFence::Signal(const std::uint64_t value)
+*
+*  @brief     Set fence value from CPU side. The value is completed immediately.
+*
+*  @param[in] const std::uint64_t value
+*
+*  @return    void
+*****************************************************************************/
+void RHIFence::Signal(const std::uint64_t value)
+{
+	std::scoped_lock lock(_mutex);
+	_completedValue = value;
+	_pendingSignals.Clear();
+}
+
+/****************************************************************************
+*                     SignalAt
+*************************************************************************//**
+*  @fn        void RHIFence::SignalAt(const gu::uint64 value, const gu::uint64 completionTime)
+*
+*  @brief     Signal from the command queue. The value is completed at completionTime.
+*
+*  @param[in] const gu::uint64 value
+*  @param[in] const gu::uint64 completionTime (gu::Profiler clock microseconds)
+*
+*  @return    void
+*****************************************************************************/
+void RHIFence::SignalAt(const gu::uint64 value, const gu::uint64 completionTime)
+{
+	std::scoped_lock lock(_mutex);
+
+	// The queue executes in order, so the completion time never goes backward
+	const auto lastTime = _pendingSignals.IsEmpty() ? 0 : _pendingSignals.Back().CompletionTime;
+	_pendingSignals.Push({ value, completionTime > lastTime ? completionTime : lastTime });
+}
+
+/****************************************************************************
+*                     Wait
+*************************************************************************//**
+*  @fn        void RHIFence::Wait(const std::uint64_t value)
+*
+*  @brief     Block the CPU until the value is completed.
+*
+*  @param[in] const std::uint64_t value
+*
+*  @return    void
+*****************************************************************************/
+void RHIFence::Wait(const std::uint64_t value)
+{
+	while (true)
+	{
+		const auto completionTime = GetCompletionTime(value);
+		if (completionTime == 0) { return; }
+
+		const auto now = static_cast<gu::uint64>(gu::Profiler::GetClockMicroseconds());
+		const auto waitTime = completionTime == NOT_SIGNALED ? UNSIGNALED_POLLING_MICROSECONDS
+			                : completionTime > now ? completionTime - now : 0;
+
+		if (waitTime > 0)
+		{
+			std::this_thread::sleep_for(std::chrono::microseconds(waitTime));
+		}
+	}
+}
+
+/****************************************************************************
+*                     GetCompletedValue
+*************************************************************************//**
+*  @fn        std::uint64_t RHIFence::GetCompletedValue()
+*
+*  @brief     Return current fence value
+*
+*  @param[in] void
+*
+*  @return    std::uint64_t
+*****************************************************************************/
+std::uint64_t RHIFence::GetCompletedValue()
+{
+	std::scoped_lock lock(_mutex);
+	RetirePendingSignals(static_cast<gu::uint64>(gu::Profiler::GetClockMicroseconds()));
+	return _completedValue;
+}
+
+/****************************************************************************
+*                     GetCompletionTime
+*************************************************************************//**
+*  @fn        gu::uint64 RHIFence::GetCompletionTime(const gu::uint64 value)
+*
+*  @brief     Return the time at which the value is completed.
+*             0 if already completed, UINT64_MAX if the value has not been signaled yet.
+*
+*  @param[in] const gu::uint64 value
+*
+*  @return    gu::uint64
+*****************************************************************************/
+gu::uint64 RHIFence::GetCompletionTime(const gu::uint64 value)
+{
+	std::scoped_lock lock(_mutex);
+	RetirePendingSignals(static_cast<gu::uint64>(gu::Profiler::GetClockMicroseconds()));
+
+	if (_completedValue >= value) { return 0; }
+
+	for (const auto& signal : _pendingSignals)
+	{
+		if (signal.Value >= value) { return signal.CompletionTime; }
+	}
+	return NOT_SIGNALED;
+}
+#pragma endregion Public Function
+
+#pragma region Protected Function
+/****************************************************************************
+*                     RetirePendingSignals
+*************************************************************************//**
+*  @fn        void RHIFence::RetirePendingSignals(const gu::uint64 now)
+*
+*  @brief     Move the pending signals whose time has passed to the completed value
+*
+*  @param[in] const gu::uint64 now
+*
+*  @return    void
+*****************************************************************************/
+void RHIFence::RetirePendingSignals(const gu::uint64 now)
+{
+	gu::uint64 retireCount = 0;
+	for (const auto& signal : _pendingSignals)
+	{
+		if (signal.CompletionTime > now) { break; }
+		_completedValue = signal.Value;
+		retireCount++;
+	}
+
+	if (retireCount > 0)
+	{
+		_pendingSignals.RemoveAt(0, retireCount, false);
+	}
+}
+#pragma endregion Protected Function
@@ -0,0 +1,76 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullFrameBuffer.cpp
+///             @brief  Null RHI render target and depth stencil buffer
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/NullFrameBuffer.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIDevice.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUResourceView.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUTexture.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::null;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+RHIFrameBuffer::RHIFrameBuffer(const gu::SharedPointer<core::RHIDevice>& device, const gu::SharedPointer<core::RHIRenderPass>& renderPass, const gu::DynamicArray<gu::SharedPointer<core::GPUTexture>>& renderTargets, const gu::SharedPointer<core::GPUTexture>& depthStencil)
+	: core::RHIFrameBuffer(device, renderPass, renderTargets, depthStencil)
+{
+	Prepare();
+}
+
+RHIFrameBuffer::RHIFrameBuffer(const gu::SharedPointer<core::RHIDevice>& device, const gu::SharedPointer<core::RHIRenderPass>& renderPass, const gu::SharedPointer<core::GPUTexture>& renderTarget, const gu::SharedPointer<core::GPUTexture>& depthStencil)
+	: core::RHIFrameBuffer(device, renderPass, renderTarget, depthStencil)
+{
+	Prepare();
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Prepare
+/****************************************************************************
+*                      Prepare
+*************************************************************************//**
+*  @fn        void RHIFrameBuffer::Prepare()
+*
+*  @brief     Prepare the resource views (render target and depth stencil)
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
+void RHIFrameBuffer::Prepare()
+{
+	/*-------------------------------------------------------------------
+	-                Create Render Target View
+	---------------------------------------------------------------------*/
+	_renderTargetViews.Resize(_renderTargets.Size());
+	_renderTargetSRVs .Resize(_renderTargets.Size());
+	_renderTargetUAVs .Resize(_renderTargets.Size());
+
+	for (size_t i = 0; i < _renderTargets.Size(); ++i)
+	{
+		_renderTargetViews[i] = _device->CreateResourceView(core::ResourceViewType::RenderTarget, _renderTargets[i], 0, 0, nullptr);
+		_renderTargetSRVs[i]  = _device->CreateResourceView(core::ResourceViewType::Texture     , _renderTargets[i], 0, 0, nullptr);
+		_renderTargetUAVs[i]  = _device->CreateResourceView(core::ResourceViewType::RWTexture   , _renderTargets[i], 0, 0, nullptr);
+	}
+
+	/*-------------------------------------------------------------------
+	-				 Set Depth / Stencil Descriptor
+	---------------------------------------------------------------------*/
+	if (_depthStencil)
+	{
+		_depthStencilView = _device->CreateResourceView(core::ResourceViewType::DepthStencil, _depthStencil, 0, 0, nullptr);
+		_depthStencilSRV  = _device->CreateResourceView(core::ResourceViewType::Texture     , _depthStencil, 0, 0, nullptr);
+	}
+}
+#pragma endregion Prepare
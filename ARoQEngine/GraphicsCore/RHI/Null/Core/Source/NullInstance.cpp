@@ -0,0 +1,48 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullInstance.cpp
+///             @brief  Null RHI instance
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/NullInstance.hpp"
+#include "../Include/NullAdapter.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::null;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Public Function
+gu::SharedPointer<core::RHIDisplayAdapter> RHIInstance::SearchHighPerformanceAdapter()
+{
+	return gu::StaticPointerCast<core::RHIDisplayAdapter>(gu::MakeShared<null::RHIDisplayAdapter>(SharedFromThis()));
+}
+
+gu::SharedPointer<core::RHIDisplayAdapter> RHIInstance::SearchMinimumPowerAdapter()
+{
+	return SearchHighPerformanceAdapter();
+}
+
+gu::DynamicArray<gu::SharedPointer<core::RHIDisplayAdapter>> RHIInstance::EnumrateAdapters()
+{
+	gu::DynamicArray<gu::SharedPointer<core::RHIDisplayAdapter>> adapters = {};
+	adapters.Push(SearchHighPerformanceAdapter());
+	return adapters;
+}
+
+void RHIInstance::LogAdapters()
+{
+	for (const auto& adapter : EnumrateAdapters())
+	{
+		adapter->PrintInfo();
+	}
+}
+#pragma endregion Public Function
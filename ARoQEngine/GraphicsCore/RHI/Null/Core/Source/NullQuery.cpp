@@ -0,0 +1,138 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullQuery.cpp
+///             @brief  Null RHI query heap
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/NullQuery.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIDevice.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUBuffer.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include "GameUtility/Memory/Include/GUMemory.hpp"
+#include <stdexcept>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::null;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+RHIQuery::RHIQuery(const gu::SharedPointer<core::RHIDevice>& device, const core::QueryHeapType heapType)
+	: core::RHIQuery(device, heapType)
+{
+	const auto count = MAX_HEAP_BYTE_SIZE / static_cast<gu::uint32>(sizeof(gu::uint64));
+
+	_results.Resize(count, true, 0);
+
+	/*-------------------------------------------------------------------
+	-                  Readback buffer
+	---------------------------------------------------------------------*/
+	auto metaData = core::GPUBufferMetaData::UploadBuffer(sizeof(gu::uint64), count, core::MemoryHeap::Readback, nullptr);
+	metaData.State = core::ResourceState::CopyDestination;
+
+	_resultBuffer = _device->CreateBuffer(metaData, SP("ReadbackBuffer"));
+	_resultBuffer->CopyStart();
+}
+
+RHIQuery::~RHIQuery()
+{
+	if (_resultBuffer)
+	{
+		_resultBuffer->CopyEnd();
+		_resultBuffer.Reset();
+	}
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Main Function
+/****************************************************************************
+*                     Allocate
+*************************************************************************//**
+*  @fn        core::QueryResultLocation RHIQuery::Allocate()
+*
+*  @brief     Return the location of the unused query
+*
+*  @param[in] void
+*
+*  @return    core::QueryResultLocation
+*****************************************************************************/
+core::QueryResultLocation RHIQuery::Allocate()
+{
+	gu::uint32 queryID = 0;
+	if (!_freeIDs.IsEmpty())
+	{
+		queryID = _freeIDs.Back();
+		_freeIDs.Pop();
+	}
+	else
+	{
+		if (_nextID >= GetMaxQueryCount()) { throw std::runtime_error("The query heap is full"); }
+		queryID = _nextID++;
+	}
+
+	return core::QueryResultLocation(SharedFromThis(), queryID, _queryHeapType);
+}
+
+/****************************************************************************
+*                     Free
+*************************************************************************//**
+*  @fn        void RHIQuery::Free(core::QueryResultLocation& location)
+*
+*  @brief     Release the query
+*
+*  @param[in] core::QueryResultLocation& location
+*
+*  @return    void
+*****************************************************************************/
+void RHIQuery::Free(core::QueryResultLocation& location)
+{
+	_freeIDs.Push(location.QueryID);
+	location.Heap = nullptr;
+}
+
+/****************************************************************************
+*                     WriteResult
+*************************************************************************//**
+*  @fn        void RHIQuery::WriteResult(const gu::uint32 queryID, const gu::uint64 value)
+*
+*  @brief     Write the result of the query (called by the command queue)
+*
+*  @param[in] const gu::uint32 queryID
+*  @param[in] const gu::uint64 value
+*
+*  @return    void
+*****************************************************************************/
+void RHIQuery::WriteResult(const gu::uint32 queryID, const gu::uint64 value)
+{
+	Check(queryID < _results.Size());
+	_results[queryID] = value;
+}
+
+/****************************************************************************
+*                     Resolve
+*************************************************************************//**
+*  @fn        void RHIQuery::Resolve(const gu::uint32 queryID, const gu::uint32 queryCount)
+*
+*  @brief     Copy the results [queryID, queryID + queryCount) into the readback buffer at the same index
+*
+*  @param[in] const gu::uint32 queryID
+*  @param[in] const gu::uint32 queryCount
+*
+*  @return    void
+*****************************************************************************/
+void RHIQuery::Resolve(const gu::uint32 queryID, const gu::uint32 queryCount)
+{
+	Check(static_cast<gu::uint64>(queryID) + queryCount <= _results.Size());
+
+	gu::Memory::Copy(_resultBuffer->GetCPUMemory() + static_cast<gu::uint64>(queryID) * sizeof(gu::uint64),
+		_results.Data() + queryID, sizeof(gu::uint64) * queryCount);
+}
+#pragma endregion Main Function
@@ -0,0 +1,139 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullSwapchain.cpp
+///             @brief  Null RHI swapchain
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/NullSwapchain.hpp"
+#include "../Include/NullDevice.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHICommandQueue.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUTexture.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include <stdexcept>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::null;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+RHISwapchain::RHISwapchain(const gu::SharedPointer<core::RHIDevice>& device, const gu::SharedPointer<core::RHICommandQueue>& queue,
+	const core::WindowInfo& windowInfo, const core::PixelFormat& pixelFormat, const size_t frameBufferCount, const std::uint32_t vsync, const bool isValidHDR, const bool isFullScreen)
+	: core::RHISwapchain(device, queue, windowInfo, pixelFormat, frameBufferCount, vsync, isValidHDR, isFullScreen)
+{
+	CreateBackBuffers();
+}
+
+RHISwapchain::RHISwapchain(const gu::SharedPointer<core::RHIDevice>& device, const core::SwapchainDesc& desc)
+	: core::RHISwapchain(device, desc)
+{
+	CreateBackBuffers();
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Public Function
+/****************************************************************************
+*							PrepareNextImage
+*************************************************************************//**
+*  @fn        gu::uint32 RHISwapchain::PrepareNextImage(const gu::SharedPointer<core::RHIFence>& fence, const gu::uint64 signalValue)
+*
+*  @brief     Signal the fence from the command queue and return the current back buffer index
+*
+*  @param[in] const gu::SharedPointer<core::RHIFence>& fence
+*  @param[in] const gu::uint64 signalValue
+*
+*  @return    gu::uint32
+*****************************************************************************/
+gu::uint32 RHISwapchain::PrepareNextImage(const gu::SharedPointer<core::RHIFence>& fence, const gu::uint64 signalValue)
+{
+	_desc.CommandQueue->Signal(fence, signalValue);
+	return static_cast<gu::uint32>(_currentIndex);
+}
+
+/****************************************************************************
+*							Present
+*************************************************************************//**
+*  @fn        void RHISwapchain::Present(const gu::SharedPointer<core::RHIFence>& fence, std::uint64_t waitValue)
+*
+*  @brief     Wait the fence on the command queue and move to the next back buffer
+*
+*  @param[in] const gu::SharedPointer<core::RHIFence>& fence
+*  @param[in] std::uint64_t waitValue
+*
+*  @return    void
+*****************************************************************************/
+void RHISwapchain::Present(const gu::SharedPointer<core::RHIFence>& fence, std::uint64_t waitValue)
+{
+	_desc.CommandQueue->Wait(fence, waitValue);
+
+	static_cast<null::RHIDevice*>(_device.Get())->CountPresent();
+
+	_currentIndex = (_currentIndex + 1) % _backBuffers.Size();
+}
+
+/****************************************************************************
+*							Resize
+*************************************************************************//**
+*  @fn        void RHISwapchain::Resize(const size_t width, const size_t height)
+*
+*  @brief     Recreate the back buffers with the new size
+*
+*  @param[in] const size_t width
+*  @param[in] const size_t height
+*
+*  @return    void
+*****************************************************************************/
+void RHISwapchain::Resize(const size_t width, const size_t height)
+{
+	if (_desc.WindowInfo.Width == width && _desc.WindowInfo.Height == height) { return; }
+
+	if (_desc.WindowInfo.Width == 0 || _desc.WindowInfo.Height == 0) { throw std::runtime_error("Width or height is zero."); }
+
+	_desc.WindowInfo.Width  = width;
+	_desc.WindowInfo.Height = height;
+
+	CreateBackBuffers();
+}
+#pragma endregion Public Function
+
+#pragma region Protected Function
+/****************************************************************************
+*							CreateBackBuffers
+*************************************************************************//**
+*  @fn        void RHISwapchain::CreateBackBuffers()
+*
+*  @brief     Create the back buffers in the present state
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
+void RHISwapchain::CreateBackBuffers()
+{
+	Checkf(_desc.CommandQueue->GetType() == core::CommandListType::Graphics, "swapchain must be graphics type command queue");
+	Check(_desc.FrameBufferCount > 0);
+
+	_backBuffers.Clear();
+	for (size_t index = 0; index < _desc.FrameBufferCount; ++index)
+	{
+		auto info = core::GPUTextureMetaData::Texture2D(
+			static_cast<size_t>(_desc.WindowInfo.Width),
+			static_cast<size_t>(_desc.WindowInfo.Height),
+			_desc.PixelFormat, 1, core::ResourceUsage::RenderTarget);
+
+		info.State = core::ResourceState::Present;
+
+		_backBuffers.Push(_device->CreateTexture(info, SP("BackBuffer")));
+	}
+
+	_currentIndex = 0;
+}
+#pragma endregion Protected Function
@@ -0,0 +1,71 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullGPUPipelineFactory.hpp
+///             @brief  Null RHI pipeline each stage creator
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_GPU_PIPELINE_FACTORY_HPP
+#define NULL_GPU_PIPELINE_FACTORY_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/PipelineState/Include/GPUPipelineFactory.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Template Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			GPUPipelineFactory
+	*************************************************************************//**
+	*  @class     GPUPipelineFactory
+	*  @brief     Create the null pipeline states
+	*****************************************************************************/
+	class GPUPipelineFactory : public core::GPUPipelineFactory
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		gu::SharedPointer<core::GPUInputAssemblyState> CreateInputAssemblyState(
+			const gu::DynamicArray<core::InputLayoutElement>& elements,
+			const core::PrimitiveTopology primitiveTopology = core::PrimitiveTopology::TriangleList) override;
+
+		gu::SharedPointer<core::GPURasterizerState> CreateRasterizerState(
+			const core::RasterizerProperty& rasterizerProperty) override;
+
+		gu::SharedPointer<core::GPUDepthStencilState> CreateDepthStencilState(
+			const core::DepthStencilProperty& depthStencilProperty = core::DepthStencilProperty()) override;
+
+		gu::SharedPointer<core::GPUShaderState> CreateShaderState() override;
+
+		gu::SharedPointer<core::GPUBlendState> CreateBlendState(
+			const gu::DynamicArray<core::BlendProperty>& properties = { core::BlendProperty() }) override;
+
+		gu::SharedPointer<core::GPUBlendState> CreateSingleBlendState(
+			const core::BlendProperty& blendProperty = core::BlendProperty()) override;
+
+		gu::SharedPointer<core::GPUBlendState> CreateBlendState(const size_t numRenderTargets) override;
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		GPUPipelineFactory() = default;
+
+		~GPUPipelineFactory() = default;
+
+		explicit GPUPipelineFactory(const gu::SharedPointer<core::RHIDevice>& device) : core::GPUPipelineFactory(device) {};
+	};
+}
+#endif
@@ -0,0 +1,104 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullGPUPipelineState.hpp
+///             @brief  Null RHI graphics and compute pipeline states
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_GPU_PIPELINE_STATE_HPP
+#define NULL_GPU_PIPELINE_STATE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/PipelineState/Include/GPUPipelineState.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Template Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			GPUGraphicsPipelineState
+	*************************************************************************//**
+	*  @class     GPUGraphicsPipelineState
+	*  @brief     Graphics pipeline. CompleteSetting does not create any pipeline object.
+	*****************************************************************************/
+	class GPUGraphicsPipelineState : public core::GPUGraphicsPipelineState
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		void CompleteSetting() override {};
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		void SetName(const gu::tstring& name) override { _name = name; }
+
+		const gu::tstring& GetName() const noexcept { return _name; }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		GPUGraphicsPipelineState() = default;
+
+		~GPUGraphicsPipelineState() = default;
+
+		explicit GPUGraphicsPipelineState(
+			const gu::SharedPointer<core::RHIDevice>& device,
+			const gu::SharedPointer<core::RHIRenderPass>& renderPass,
+			const gu::SharedPointer<core::RHIResourceLayout>& layout) : core::GPUGraphicsPipelineState(device, renderPass, layout) {};
+
+	protected:
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		gu::tstring _name = SP("");
+	};
+
+	/****************************************************************************
+	*				  			GPUComputePipelineState
+	*************************************************************************//**
+	*  @class     GPUComputePipelineState
+	*  @brief     Compute pipeline. CompleteSetting does not create any pipeline object.
+	*****************************************************************************/
+	class GPUComputePipelineState : public core::GPUComputePipelineState
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		void CompleteSetting() override {};
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		void SetName(const gu::tstring& name) override { _name = name; }
+
+		const gu::tstring& GetName() const noexcept { return _name; }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		GPUComputePipelineState() = default;
+
+		~GPUComputePipelineState() = default;
+
+		explicit GPUComputePipelineState(
+			const gu::SharedPointer<core::RHIDevice>& device,
+			const gu::SharedPointer<core::RHIResourceLayout>& layout = nullptr) : core::GPUComputePipelineState(device, layout) {};
+
+	protected:
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		gu::tstring _name = SP("");
+	};
+}
+#endif
@@ -0,0 +1,72 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullGPUShaderState.hpp
+///             @brief  Null RHI shader state. The shader is not compiled (the blob is empty).
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_GPU_SHADER_STATE_HPP
+#define NULL_GPU_SHADER_STATE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/PipelineState/Include/GPUShaderState.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Template Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			GPUShaderState
+	*************************************************************************//**
+	*  @class     GPUShaderState
+	*  @brief     Records only the shader type and the version
+	*****************************************************************************/
+	class GPUShaderState : public core::GPUShaderState
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		void Compile(const core::ShaderType type, const gu::tstring& fileName, const gu::tstring& entryPoint = SP("main"), const float version = NEWEST_VERSION,
+			const gu::DynamicArray<gu::tstring>& includeDirectories = {}, const gu::DynamicArray<gu::tstring>& defines = {}) override
+		{
+			_shaderType = type;
+			_version    = version;
+			_fileName   = fileName;
+		}
+
+		void LoadBinary(const core::ShaderType type, const gu::tstring& fileName) override
+		{
+			_shaderType = type;
+			_fileName   = fileName;
+		}
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		const gu::tstring& GetFileName() const noexcept { return _fileName; }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		GPUShaderState() = default;
+
+		~GPUShaderState() = default;
+
+		explicit GPUShaderState(const gu::SharedPointer<core::RHIDevice>& device) : core::GPUShaderState(device) {};
+
+	protected:
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		gu::tstring _fileName = SP("");
+	};
+}
+#endif
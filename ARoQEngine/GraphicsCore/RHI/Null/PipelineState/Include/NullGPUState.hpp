@@ -0,0 +1,103 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullGPUState.hpp
+///             @brief  Null RHI blend, depth stencil, input assembly and rasterizer states.
+///                     The null backend does not translate the properties, so the states only hold the core properties.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_GPU_STATE_HPP
+#define NULL_GPU_STATE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/PipelineState/Include/GPUBlendState.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/PipelineState/Include/GPUDepthStencilState.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/PipelineState/Include/GPUInputAssemblyState.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/PipelineState/Include/GPURasterizerState.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Template Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			GPUBlendState
+	*************************************************************************//**
+	*  @class     GPUBlendState
+	*  @brief     BlendState
+	*****************************************************************************/
+	class GPUBlendState : public core::GPUBlendState
+	{
+	public:
+		GPUBlendState() = default;
+
+		~GPUBlendState() = default;
+
+		explicit GPUBlendState(const gu::SharedPointer<core::RHIDevice>& device, const gu::DynamicArray<core::BlendProperty>& blendProperties)
+			: core::GPUBlendState(device, blendProperties) {};
+
+		explicit GPUBlendState(const gu::SharedPointer<core::RHIDevice>& device, const core::BlendProperty& blendProperty)
+			: core::GPUBlendState(device, blendProperty) {};
+	};
+
+	/****************************************************************************
+	*				  			GPUDepthStencilState
+	*************************************************************************//**
+	*  @class     GPUDepthStencilState
+	*  @brief     DepthStencilState
+	*****************************************************************************/
+	class GPUDepthStencilState : public core::GPUDepthStencilState
+	{
+	public:
+		GPUDepthStencilState() = default;
+
+		~GPUDepthStencilState() = default;
+
+		explicit GPUDepthStencilState(const gu::SharedPointer<core::RHIDevice>& device, const core::DepthStencilProperty& depthStencilProperty)
+			: core::GPUDepthStencilState(device, depthStencilProperty) {};
+	};
+
+	/****************************************************************************
+	*				  			GPUInputAssemblyState
+	*************************************************************************//**
+	*  @class     GPUInputAssemblyState
+	*  @brief     InputAssemblyState
+	*****************************************************************************/
+	class GPUInputAssemblyState : public core::GPUInputAssemblyState
+	{
+	public:
+		GPUInputAssemblyState() = default;
+
+		~GPUInputAssemblyState() = default;
+
+		explicit GPUInputAssemblyState(
+			const gu::SharedPointer<core::RHIDevice>& device,
+			const gu::DynamicArray<core::InputLayoutElement>& elements,
+			const core::PrimitiveTopology primitiveTopology = core::PrimitiveTopology::TriangleList)
+			: core::GPUInputAssemblyState(device, elements, primitiveTopology) {};
+	};
+
+	/****************************************************************************
+	*				  			GPURasterizerState
+	*************************************************************************//**
+	*  @class     GPURasterizerState
+	*  @brief     RasterizerState
+	*****************************************************************************/
+	class GPURasterizerState : public core::GPURasterizerState
+	{
+	public:
+		GPURasterizerState() = default;
+
+		~GPURasterizerState() = default;
+
+		explicit GPURasterizerState(const gu::SharedPointer<core::RHIDevice>& device, const core::RasterizerProperty& rasterizerProperty)
+			: core::GPURasterizerState(device, rasterizerProperty) {};
+	};
+}
+#endif
@@ -0,0 +1,82 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullGPUBuffer.hpp
+///             @brief  Null RHI buffer. The buffer memory is the CPU side array.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_GPU_BUFFER_HPP
+#define NULL_GPU_BUFFER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUBuffer.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Template Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			GPUBuffer
+	*************************************************************************//**
+	*  @class     GPUBuffer
+	*  @brief     Buffer which owns its memory.
+	*             The memory is always mapped (GetCPUMemory is valid for every heap type)
+	*             so that the command queue can play back the copies into the default buffers.
+	*****************************************************************************/
+	class GPUBuffer : public core::GPUBuffer
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Copy the whole data. The null device has no staging, so the data is written directly.*/
+		void Pack(const void* data, const gu::SharedPointer<core::RHICommandList>& commandList = nullptr) override;
+
+		/* @brief : The memory is always mapped*/
+		void CopyStart() override {};
+
+		void CopyData(const void* data, const size_t elementIndex) override;
+
+		void CopyTotalData(const void* data, const size_t dataLength, const size_t indexOffset = 0) override;
+
+		void CopyEnd() override {};
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		/* @brief : Address of the CPU side memory*/
+		gu::uint64 GetGPUVirtualAddress() const noexcept override { return reinterpret_cast<gu::uint64>(_memory.Data()); }
+
+		void SetName(const gu::tstring& name) override { _name = name; }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		GPUBuffer() = default;
+
+		~GPUBuffer() = default;
+
+		explicit GPUBuffer(const gu::SharedPointer<core::RHIDevice>& device, const core::GPUBufferMetaData& metaData, const gu::tstring& name = SP("Buffer"));
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		gu::DynamicArray<gu::uint8> _memory = {};
+
+		gu::tstring _name = SP("");
+	};
+}
+#endif
@@ -0,0 +1,95 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullGPUResourceView.hpp
+///             @brief  Null RHI resource view (only holds the descriptor id)
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_GPU_RESOURCE_VIEW_HPP
+#define NULL_GPU_RESOURCE_VIEW_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUResourceView.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Template Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	class RHIDescriptorHeap;
+
+	/****************************************************************************
+	*				  			GPUResourceView
+	*************************************************************************//**
+	*  @class     GPUResourceView
+	*  @brief     Allocates the descriptor id from the heap of the view type.
+	*             Creating or rewriting the view is counted as the descriptor write of the device.
+	*****************************************************************************/
+	class GPUResourceView : public core::GPUResourceView
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Record the bind command with the descriptor id*/
+		void Bind(const gu::SharedPointer<core::RHICommandList>& commandList, const gu::uint32 index, const gu::SharedPointer<core::RHIResourceLayout>& layout = nullptr) override;
+
+		/* @brief : Point the constant buffer view at the range of the buffer. Each descriptor slot has its own id.*/
+		void SetBufferRange(const gu::SharedPointer<core::GPUBuffer>& buffer, const gu::uint64 byteOffset, const gu::uint64 byteSize, const gu::uint32 descriptorSlot = 0) override;
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		/* @brief : Return the byte size set by SetBufferRange (0 : the whole buffer)*/
+		gu::uint64 GetBufferByteSize() const noexcept { return _bufferByteSize; }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		GPUResourceView() = default;
+
+		~GPUResourceView();
+
+		explicit GPUResourceView(
+			const gu::SharedPointer<core::RHIDevice>& device,
+			const core::ResourceViewType type,
+			const gu::SharedPointer<core::GPUBuffer>& buffer,
+			const gu::uint32 mipSlice = 0,
+			const gu::uint32 planeSlice = 0,
+			const gu::SharedPointer<core::RHIDescriptorHeap>& customHeap = nullptr);
+
+		explicit GPUResourceView(
+			const gu::SharedPointer<core::RHIDevice>& device,
+			const core::ResourceViewType type,
+			const gu::SharedPointer<core::GPUTexture>& texture,
+			const gu::uint32 mipSlice = 0,
+			const gu::uint32 planeSlice = 0,
+			const gu::SharedPointer<core::RHIDescriptorHeap>& customHeap = nullptr);
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+		/* @brief : Allocate the descriptor id from the custom heap or the default heap*/
+		void CreateView();
+
+		/* @brief : Return the descriptor heap type used by the view type*/
+		static core::DescriptorHeapType GetHeapType(const core::ResourceViewType type);
+
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		/* @brief : Descriptor id of each slot set by SetBufferRange*/
+		gu::DynamicArray<gu::uint32> _slotDescriptorIDs = {};
+
+		bool _hasCreated = false;
+	};
+}
+#endif
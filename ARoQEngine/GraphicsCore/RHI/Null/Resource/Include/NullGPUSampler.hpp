@@ -0,0 +1,53 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullGPUSampler.hpp
+///             @brief  Null RHI sampler (only holds the sampler info)
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_GPU_SAMPLER_HPP
+#define NULL_GPU_SAMPLER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUSampler.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Template Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			GPUSampler
+	*************************************************************************//**
+	*  @class     GPUSampler
+	*  @brief     Sampler state
+	*****************************************************************************/
+	class GPUSampler : public core::GPUSampler
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		GPUSampler() = default;
+
+		~GPUSampler() = default;
+
+		explicit GPUSampler(const gu::SharedPointer<core::RHIDevice>& device, const core::SamplerInfo& samplerInfo)
+			: core::GPUSampler(device, samplerInfo) {};
+	};
+}
+#endif
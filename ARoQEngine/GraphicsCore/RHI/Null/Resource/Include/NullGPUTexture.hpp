@@ -0,0 +1,86 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullGPUTexture.hpp
+///             @brief  Null RHI texture. The texture memory is the CPU side array.
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_GPU_TEXTURE_HPP
+#define NULL_GPU_TEXTURE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUTexture.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Template Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			GPUTexture
+	*************************************************************************//**
+	*  @class     GPUTexture
+	*  @brief     Texture which owns its memory (all array slices and mip levels, tightly packed).
+	*             The image files are not decoded. Load creates the 1x1 RGBA8 texture,
+	*             so the code which loads the textures runs without the decoder and the files.
+	*****************************************************************************/
+	class GPUTexture : public core::GPUTexture
+	{
+	public:
+		/****************************************************************************
+		**                Public Function
+		*****************************************************************************/
+		/* @brief : Create the 1x1 RGBA8 placeholder (the file is not read)*/
+		void Load(const gu::tstring& filePath, const gu::SharedPointer<core::RHICommandList>& commandList) override;
+
+		/* @brief : Not supported (do nothing)*/
+		void Save(const gu::tstring& filePath, const gu::SharedPointer<core::RHICommandList>& commandList, const gu::SharedPointer<core::RHICommandQueue>& commandQueue) override;
+
+		/* @brief : Write mip 0 of the RGBA8 texture*/
+		void Write(const gu::SharedPointer<core::RHICommandList>& commandList, const gm::RGBA* pixel) override;
+
+		/****************************************************************************
+		**                Public Member Variables
+		*****************************************************************************/
+		gu::uint8* GetCPUMemory() noexcept { return _memory.Data(); }
+
+		gu::uint64 GetCPUMemorySize() const noexcept { return _memory.Size(); }
+
+		void SetName(const gu::tstring& name) override { _name = name; }
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		GPUTexture() = default;
+
+		~GPUTexture() = default;
+
+		explicit GPUTexture(const gu::SharedPointer<core::RHIDevice>& device, const gu::tstring& name = SP(""));
+
+		explicit GPUTexture(const gu::SharedPointer<core::RHIDevice>& device, const core::GPUTextureMetaData& metaData, const gu::tstring& name = SP(""));
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+		void Pack([[maybe_unused]] const gu::SharedPointer<core::RHICommandList>& commandList) override {};
+
+		/* @brief : Allocate the memory from the meta data*/
+		void Allocate();
+
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		gu::DynamicArray<gu::uint8> _memory = {};
+
+		gu::tstring _name = SP("");
+	};
+}
+#endif
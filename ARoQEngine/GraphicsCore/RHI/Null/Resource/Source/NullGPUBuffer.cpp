@@ -0,0 +1,99 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullGPUBuffer.cpp
+///             @brief  Null RHI buffer
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/NullGPUBuffer.hpp"
+#include "GraphicsCore/RHI/Null/Core/Include/NullDevice.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include "GameUtility/Memory/Include/GUMemory.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::null;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+GPUBuffer::GPUBuffer(const gu::SharedPointer<core::RHIDevice>& device, const core::GPUBufferMetaData& metaData, const gu::tstring& name)
+	: core::GPUBuffer(device, metaData, name), _name(name)
+{
+	const auto isDynamic = gu::HasAnyFlags(metaData.ResourceUsage, core::ResourceUsage::AnyDynamic);
+	Check(isDynamic ? _metaData.HeapType != core::MemoryHeap::Default : true);
+
+	_memory.Resize(GetTotalByteSize(), true, 0);
+	_mappedData = _memory.Data();
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Public Function
+/****************************************************************************
+*                     CopyData
+*************************************************************************//**
+*  @fn        void GPUBuffer::CopyData(const void* data, const size_t elementIndex)
+*
+*  @brief     Copy one element
+*
+*  @param[in] const void* data
+*  @param[in] const size_t elementIndex
+*
+*  @return    void
+*****************************************************************************/
+void GPUBuffer::CopyData(const void* data, const size_t elementIndex)
+{
+	Check(elementIndex < _metaData.Count);
+	gu::Memory::Copy(&_mappedData[elementIndex * _metaData.Stride], data, _metaData.Stride);
+
+	static_cast<null::RHIDevice*>(_device.Get())->CountUploadBytes(_metaData.Stride);
+}
+
+/****************************************************************************
+*                     CopyTotalData
+*************************************************************************//**
+*  @fn        void GPUBuffer::CopyTotalData(const void* data, const size_t dataLength, const size_t indexOffset)
+*
+*  @brief     Copy the specified element range
+*
+*  @param[in] const void*  data
+*  @param[in] const size_t dataLength  (element count)
+*  @param[in] const size_t indexOffset (default 0)
+*
+*  @return    void
+*****************************************************************************/
+void GPUBuffer::CopyTotalData(const void* data, const size_t dataLength, const size_t indexOffset)
+{
+	Check(dataLength + indexOffset <= _metaData.Count);
+	gu::Memory::Copy(&_mappedData[indexOffset * _metaData.Stride], data, _metaData.Stride * dataLength);
+
+	static_cast<null::RHIDevice*>(_device.Get())->CountUploadBytes(_metaData.Stride * dataLength);
+}
+
+/****************************************************************************
+*                     Pack
+*************************************************************************//**
+*  @fn        void GPUBuffer::Pack(const void* data, const gu::SharedPointer<core::RHICommandList>& commandList)
+*
+*  @brief     Copy the whole data into the buffer
+*
+*  @param[in] const void* data
+*  @param[in] const gu::SharedPointer<core::RHICommandList>& commandList (not used)
+*
+*  @return    void
+*****************************************************************************/
+void GPUBuffer::Pack(const void* data, [[maybe_unused]] const gu::SharedPointer<core::RHICommandList>& commandList)
+{
+	if (data == nullptr) { return; }
+
+	gu::Memory::Copy(_mappedData, data, GetTotalByteSize());
+
+	static_cast<null::RHIDevice*>(_device.Get())->CountUploadBytes(GetTotalByteSize());
+}
+#pragma endregion Public Function
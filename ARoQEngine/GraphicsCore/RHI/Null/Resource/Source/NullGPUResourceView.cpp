@@ -0,0 +1,197 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullGPUResourceView.cpp
+///             @brief  Null RHI resource view
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/NullGPUResourceView.hpp"
+#include "GraphicsCore/RHI/Null/Core/Include/NullDevice.hpp"
+#include "GraphicsCore/RHI/Null/Core/Include/NullDescriptorHeap.hpp"
+#include "GraphicsCore/RHI/Null/Core/Include/NullCommandList.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include <stdexcept>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::null;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+GPUResourceView::GPUResourceView(
+	const gu::SharedPointer<core::RHIDevice>& device,
+	const core::ResourceViewType type,
+	const gu::SharedPointer<core::GPUBuffer>& buffer,
+	const gu::uint32 mipSlice,
+	const gu::uint32 planeSlice,
+	const gu::SharedPointer<core::RHIDescriptorHeap>& customHeap)
+	: core::GPUResourceView(device, type, mipSlice, planeSlice, customHeap)
+{
+	_buffer  = buffer;
+	_texture = nullptr;
+	if (_buffer) { CreateView(); }
+}
+
+GPUResourceView::GPUResourceView(
+	const gu::SharedPointer<core::RHIDevice>& device,
+	const core::ResourceViewType type,
+	const gu::SharedPointer<core::GPUTexture>& texture,
+	const gu::uint32 mipSlice,
+	const gu::uint32 planeSlice,
+	const gu::SharedPointer<core::RHIDescriptorHeap>& customHeap)
+	: core::GPUResourceView(device, type, mipSlice, planeSlice, customHeap)
+{
+	_texture = texture;
+	_buffer  = nullptr;
+	if (_texture) { CreateView(); }
+}
+
+GPUResourceView::~GPUResourceView()
+{
+	if (!_heap) { return; }
+
+	const auto heapType = GetHeapType(_resourceViewType);
+	if (!_slotDescriptorIDs.IsEmpty())
+	{
+		for (const auto id : _slotDescriptorIDs)
+		{
+			_heap->Free(heapType, id);
+		}
+	}
+	else if (_hasCreated)
+	{
+		_heap->Free(heapType, _descriptorID);
+	}
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Public Function
+/****************************************************************************
+*                     Bind
+*************************************************************************//**
+*  @fn        void GPUResourceView::Bind(const gu::SharedPointer<core::RHICommandList>& commandList, const gu::uint32 index, const gu::SharedPointer<core::RHIResourceLayout>& layout)
+*
+*  @brief     Record the bind of the descriptor id to the resource layout index
+*
+*  @param[in] const gu::SharedPointer<core::RHICommandList>& commandList
+*  @param[in] const gu::uint32 index : resource layout array index
+*  @param[in] const gu::SharedPointer<core::RHIResourceLayout>& layout (unused)
+*
+*  @return    void
+*****************************************************************************/
+void GPUResourceView::Bind(const gu::SharedPointer<core::RHICommandList>& commandList, const gu::uint32 index, [[maybe_unused]] const gu::SharedPointer<core::RHIResourceLayout>& layout)
+{
+	if (commandList->GetType() == core::CommandListType::Copy)
+	{
+		throw std::runtime_error("failed to bind resource view (copy command list)");
+	}
+
+	static_cast<null::RHICommandList*>(commandList.Get())->BindResourceView(index, _descriptorID);
+}
+
+/****************************************************************************
+*                     SetBufferRange
+*************************************************************************//**
+*  @fn        void GPUResourceView::SetBufferRange(const gu::SharedPointer<core::GPUBuffer>& buffer, const gu::uint64 byteOffset, const gu::uint64 byteSize, const gu::uint32 descriptorSlot)
+*
+*  @brief     Point the constant buffer view at [byteOffset, byteOffset + byteSize) of the buffer
+*
+*  @param[in] const gu::SharedPointer<core::GPUBuffer>& buffer
+*  @param[in] const gu::uint64 byteOffset (256 byte alignment)
+*  @param[in] const gu::uint64 byteSize
+*  @param[in] const gu::uint32 descriptorSlot
+*
+*  @return    void
+*****************************************************************************/
+void GPUResourceView::SetBufferRange(const gu::SharedPointer<core::GPUBuffer>& buffer, const gu::uint64 byteOffset, const gu::uint64 byteSize, const gu::uint32 descriptorSlot)
+{
+	Check(buffer);
+	Check(_resourceViewType == core::ResourceViewType::ConstantBuffer);
+	Check(byteOffset % 256 == 0);
+
+	if (!_heap) { _heap = _device->GetDefaultHeap(core::DescriptorHeapType::CBV); }
+
+	/*-------------------------------------------------------------------
+	-             Allocate the descriptor of the slot
+	---------------------------------------------------------------------*/
+	if (_slotDescriptorIDs.IsEmpty() && _hasCreated)
+	{
+		_slotDescriptorIDs.Push(_descriptorID);
+	}
+	while (_slotDescriptorIDs.Size() <= descriptorSlot)
+	{
+		_slotDescriptorIDs.Push(_heap->Allocate(core::DescriptorHeapType::CBV, nullptr));
+	}
+
+	_buffer         = buffer;
+	_bufferOffset   = byteOffset;
+	_bufferByteSize = byteSize;
+	_descriptorID   = _slotDescriptorIDs[descriptorSlot];
+	_hasCreated     = true;
+
+	static_cast<null::RHIDevice*>(_device.Get())->CountDescriptorWrite();
+}
+#pragma endregion Public Function
+
+#pragma region Protected Function
+/****************************************************************************
+*                     CreateView
+*************************************************************************//**
+*  @fn        void GPUResourceView::CreateView()
+*
+*  @brief     Allocate the descriptor id from the custom heap or the default heap
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
+void GPUResourceView::CreateView()
+{
+	const auto heapType = GetHeapType(_resourceViewType);
+	if (!_heap) { _heap = _device->GetDefaultHeap(heapType); }
+
+	_descriptorID = _heap->Allocate(heapType, nullptr);
+	_hasCreated   = true;
+
+	static_cast<null::RHIDevice*>(_device.Get())->CountDescriptorWrite();
+}
+
+/****************************************************************************
+*                     GetHeapType
+*************************************************************************//**
+*  @fn        core::DescriptorHeapType GPUResourceView::GetHeapType(const core::ResourceViewType type)
+*
+*  @brief     Return the descriptor heap type used by the view type
+*
+*  @param[in] const core::ResourceViewType type
+*
+*  @return    core::DescriptorHeapType
+*****************************************************************************/
+core::DescriptorHeapType GPUResourceView::GetHeapType(const core::ResourceViewType type)
+{
+	switch (type)
+	{
+		case core::ResourceViewType::ConstantBuffer:        { return core::DescriptorHeapType::CBV; }
+		case core::ResourceViewType::Texture:
+		case core::ResourceViewType::Buffer:
+		case core::ResourceViewType::StructuredBuffer:
+		case core::ResourceViewType::AccelerationStructure: { return core::DescriptorHeapType::SRV; }
+		case core::ResourceViewType::RWBuffer:
+		case core::ResourceViewType::RWTexture:
+		case core::ResourceViewType::RWStructuredBuffer:    { return core::DescriptorHeapType::UAV; }
+		case core::ResourceViewType::RenderTarget:          { return core::DescriptorHeapType::RTV; }
+		case core::ResourceViewType::DepthStencil:          { return core::DescriptorHeapType::DSV; }
+		default:
+		{
+			throw std::runtime_error("not support descriptor view. (null api)");
+		}
+	}
+}
+#pragma endregion Protected Function
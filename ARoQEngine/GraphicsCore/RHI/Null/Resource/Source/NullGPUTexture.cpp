@@ -0,0 +1,129 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   NullGPUTexture.cpp
+///             @brief  Null RHI texture
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/NullGPUTexture.hpp"
+#include "GraphicsCore/RHI/Null/Core/Include/NullDevice.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include "GameUtility/Memory/Include/GUMemory.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::null;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+GPUTexture::GPUTexture(const gu::SharedPointer<core::RHIDevice>& device, const gu::tstring& name)
+	: core::GPUTexture(device, name), _name(name)
+{
+
+}
+
+GPUTexture::GPUTexture(const gu::SharedPointer<core::RHIDevice>& device, const core::GPUTextureMetaData& metaData, const gu::tstring& name)
+	: core::GPUTexture(device, metaData, name), _name(name)
+{
+	Allocate();
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Public Function
+/****************************************************************************
+*                     Load
+*************************************************************************//**
+*  @fn        void GPUTexture::Load(const gu::tstring& filePath, const gu::SharedPointer<core::RHICommandList>& commandList)
+*
+*  @brief     Create the 1x1 white RGBA8 texture instead of decoding the file
+*
+*  @param[in] const gu::tstring& filePath (not read)
+*  @param[in] const gu::SharedPointer<core::RHICommandList>& commandList
+*
+*  @return    void
+*****************************************************************************/
+void GPUTexture::Load([[maybe_unused]] const gu::tstring& filePath, const gu::SharedPointer<core::RHICommandList>& commandList)
+{
+	Check(commandList);
+
+	_metaData = core::GPUTextureMetaData::Texture2D(1, 1, core::PixelFormat::R8G8B8A8_UNORM, 1);
+	Allocate();
+
+	const gu::uint8 white[] = { 0xff, 0xff, 0xff, 0xff };
+	Write(commandList, reinterpret_cast<const gm::RGBA*>(white));
+}
+
+/****************************************************************************
+*                     Save
+*************************************************************************//**
+*  @fn        void GPUTexture::Save(const gu::tstring& filePath, const gu::SharedPointer<core::RHICommandList>& commandList, const gu::SharedPointer<core::RHICommandQueue>& commandQueue)
+*
+*  @brief     Not supported (the file is not written)
+*
+*  @param[in] const gu::tstring& filePath
+*  @param[in] const gu::SharedPointer<core::RHICommandList>& commandList
+*  @param[in] const gu::SharedPointer<core::RHICommandQueue>& commandQueue
+*
+*  @return    void
+*****************************************************************************/
+void GPUTexture::Save([[maybe_unused]] const gu::tstring& filePath, [[maybe_unused]] const gu::SharedPointer<core::RHICommandList>& commandList, [[maybe_unused]] const gu::SharedPointer<core::RHICommandQueue>& commandQueue)
+{
+
+}
+
+/****************************************************************************
+*                     Write
+*************************************************************************//**
+*  @fn        void GPUTexture::Write(const gu::SharedPointer<core::RHICommandList>& commandList, const gm::RGBA* pixel)
+*
+*  @brief     Write mip 0 of the RGBA8 texture.
+*             Like DirectX12, the pointer is read as the packed pixel data of the texture format.
+*
+*  @param[in] const gu::SharedPointer<core::RHICommandList>& commandList (graphics)
+*  @param[in] const gm::RGBA* pixel
+*
+*  @return    void
+*****************************************************************************/
+void GPUTexture::Write([[maybe_unused]] const gu::SharedPointer<core::RHICommandList>& commandList, const gm::RGBA* pixel)
+{
+	Check(pixel);
+	Check(_metaData.PixelFormat == core::PixelFormat::R8G8B8A8_UNORM);
+
+	gu::Memory::Copy(_memory.Data(), pixel, GetByteSize(0));
+
+	static_cast<null::RHIDevice*>(_device.Get())->CountUploadBytes(GetByteSize(0));
+}
+#pragma endregion Public Function
+
+#pragma region Protected Function
+/****************************************************************************
+*                     Allocate
+*************************************************************************//**
+*  @fn        void GPUTexture::Allocate()
+*
+*  @brief     Allocate the memory of all array slices and mip levels
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
+void GPUTexture::Allocate()
+{
+	gu::uint64 byteSize = 0;
+	for (size_t mip = 0; mip < GetMipMapLevels(); ++mip)
+	{
+		byteSize += GetByteSize(mip);
+	}
+	byteSize *= GetArrayLength();
+
+	_memory.Clear();
+	_memory.Resize(byteSize, true, 0);
+}
+#pragma endregion Protected Function
@@ -60,6 +60,11 @@ namespace rhi::vulkan
 		/*----------------------------------------------------------------------*/
 		void EndQuery(const core::QueryResultLocation& location) override {};
 
+		/*----------------------------------------------------------------------
+		*  @brief : NǦʂQuery heapReadback bufferɃRs[܂
+		/*----------------------------------------------------------------------*/
+		void ResolveQueryData([[maybe_unused]] const core::QueryResultLocation& location, [[maybe_unused]] const gu::uint32 queryCount) override {};
+
 #pragma endregion Query
 		/*-------------------------------------------------------------------
 		-               Graphic Pipeline command
@@ -85,6 +90,8 @@ namespace rhi::vulkan
 		void SetComputePipeline(const gu::SharedPointer<core::GPUComputePipelineState>& pipeline) override {};
 		
 		void SetVertexBuffer (const gu::SharedPointer<core::GPUBuffer>& buffer) override;
+
+		void SetVertexBuffer (const gu::SharedPointer<core::GPUBuffer>& buffer, const gu::uint64 byteOffset, const gu::uint64 byteSize, const gu::uint32 stride) override;
 		
 		void SetVertexBuffers(const gu::DynamicArray<gu::SharedPointer<core::GPUBuffer>>& buffers, const size_t startSlot = 0) override;
 		
@@ -117,6 +124,11 @@ namespace rhi::vulkan
 		void TransitionResourceStates(const std::uint32_t numStates, const gu::SharedPointer<core::GPUTexture>* textures, core::ResourceState* afters) override;
 		
 		void CopyResource(const gu::SharedPointer<core::GPUTexture>& dest, const gu::SharedPointer<core::GPUTexture>& source) override {};;
+
+		/*----------------------------------------------------------------------
+		*  @brief : sourcemip0Ŝdestmip0(destX, destY)ɃRs[
+		/*----------------------------------------------------------------------*/
+		void CopyTextureRegion(const gu::SharedPointer<core::GPUTexture>& dest, const gu::uint32 destX, const gu::uint32 destY, const gu::SharedPointer<core::GPUTexture>& source) override;
 		
 		/*----------------------------------------------------------------------
 		*  @brief : obt@̗̈郊\[Xʂ̃\[XɃRs[. GPUmemcpy
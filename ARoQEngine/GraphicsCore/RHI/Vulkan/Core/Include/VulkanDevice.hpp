@@ -12,6 +12,7 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIDevice.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIMemoryAllocator.hpp"
 #define VK_USE_PLATFORM_WIN32_KHR
 #include <vulkan/vulkan.h>
 #include "GameUtility/Container/Include/GUDynamicArray.hpp"
@@ -120,6 +121,13 @@ namespace rhi::vulkan
 		
 		/* @brief : g̎ނĂmemoryIndexԂ.*/
 		std::uint32_t  GetMemoryTypeIndex(std::uint32_t typeBits, const VkMemoryPropertyFlags& flags);
+
+		/* @brief : AP[^̃v[烁͈͂mۂ. v[łȂꍇ͖allocationԂ (ĂяoŐpmۂ)*/
+		core::MemoryAllocation AllocateSubAllocatedMemory(const VkMemoryRequirements& requirement, const core::MemoryHeap heapType,
+			const core::MemoryResourceCategory category, const core::MemoryAllocationStrategy strategy = core::MemoryAllocationStrategy::General);
+
+		/* @brief : AllocateSubAllocatedMemoryŊmۂ͈͂AP[^ɕԂ*/
+		void FreeSubAllocatedMemory(core::MemoryAllocation& allocation);
 		
 		std::uint32_t GetQueueCount(const rhi::core::CommandListType type) { return _commandQueueInfo[type].QueueCount; }
 
@@ -45,13 +45,20 @@ namespace rhi::vulkan
 		*****************************************************************************/
 		RHIMemory() = default;
 
-		~RHIMemory() = default;
+		~RHIMemory();
 
 		explicit RHIMemory(
 			const gu::SharedPointer<core::RHIDevice>& device, 
 			const core::MemoryHeap heapType,
 			const std::uint64_t size, 
 			std::uint32_t typeBits);
+
+		/* @brief : Take the ownership of the memory allocated by the caller (the memory allocator)*/
+		explicit RHIMemory(
+			const gu::SharedPointer<core::RHIDevice>& device,
+			const core::MemoryHeap heapType,
+			const VkDeviceMemory memory,
+			const std::uint64_t size);
 	
 	protected:
 		/****************************************************************************
@@ -0,0 +1,62 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   VulkanMemoryAllocator.hpp
+///             @brief  GPU memory sub-allocator (VkDeviceMemory blocks)
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef VULKAN_MEMORY_ALLOCATOR_HPP
+#define VULKAN_MEMORY_ALLOCATOR_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIMemoryAllocator.hpp"
+#include <vulkan/vulkan.h>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::vulkan
+{
+	class RHIDevice;
+
+	/****************************************************************************
+	*				  			RHIMemoryAllocator
+	*************************************************************************//**
+	*  @class     RHIMemoryAllocator
+	*  @brief     Allocate one VkDeviceMemory per block with the memory type index of the pool.
+	*             Buffers and images live in the different pools, so bufferImageGranularity never matters.
+	*             Without VK_EXT_memory_budget only the heap size is reported as the budget.
+	*****************************************************************************/
+	class RHIMemoryAllocator : public core::RHIMemoryAllocator
+	{
+	public:
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		RHIMemoryAllocator() = default;
+
+		~RHIMemoryAllocator();
+
+		explicit RHIMemoryAllocator(const gu::SharedPointer<RHIDevice>& device);
+
+	protected:
+		/****************************************************************************
+		**                Protected Function
+		*****************************************************************************/
+		gu::SharedPointer<core::RHIMemory> CreateMemoryBlock(const core::MemoryPoolKey& key, const gu::uint64 byteSize) override;
+
+		bool QueryDeviceBudget(const core::MemoryHeap heapType, gu::uint64& budget, gu::uint64& usage) const override;
+
+		/****************************************************************************
+		**                Protected Member Variables
+		*****************************************************************************/
+		gu::SharedPointer<RHIDevice> _device = nullptr;
+	};
+}
+#endif
@@ -19,6 +19,7 @@
 #include "GraphicsCore/RHI/Vulkan/Core/Include/VulkanEnumConverter.hpp"
 #include "GraphicsCore/RHI/Vulkan/Resource/Include/VulkanGPUTexture.hpp"
 #include "GraphicsCore/RHI/Vulkan/Resource/Include/VulkanGPUBuffer.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
 #include <stdexcept>
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -264,6 +265,13 @@ void RHICommandList::SetVertexBuffer(const gu::SharedPointer<core::GPUBuffer>& b
 	VkDeviceSize offsets[] = { 0 };
 	vkCmdBindVertexBuffers(_commandBuffer, 0, 1, &vkBuffer, offsets);
 }
+void RHICommandList::SetVertexBuffer(const gu::SharedPointer<core::GPUBuffer>& buffer, const gu::uint64 byteOffset, [[maybe_unused]] const gu::uint64 byteSize, [[maybe_unused]] const gu::uint32 stride)
+{
+	// stride̓pCvC̒_͂Ŏwς
+	auto vkBuffer = gu::StaticPointerCast<vulkan::GPUBuffer>(buffer)->GetBuffer();
+	VkDeviceSize offsets[] = { byteOffset };
+	vkCmdBindVertexBuffers(_commandBuffer, 0, 1, &vkBuffer, offsets);
+}
 void RHICommandList::SetVertexBuffers(const gu::DynamicArray<gu::SharedPointer<core::GPUBuffer>>& buffers, const size_t startSlot)
 {
 	auto vkBuffers = gu::DynamicArray<VkBuffer>(buffers.Size());
@@ -371,6 +379,57 @@ VkAccessFlags RHICommandList::SelectVkAccessFlag(const VkImageLayout imageLayout
 #pragma endregion TransitionResourceLayout
 #pragma endregion GPU Command
 
+#pragma region Copy
+/****************************************************************************
+*                     CopyTextureRegion
+*************************************************************************//**
+*  @fn        void RHICommandList::CopyTextureRegion(const gu::SharedPointer<core::GPUTexture>& dest, const gu::uint32 destX, const gu::uint32 destY, const gu::SharedPointer<core::GPUTexture>& source)
+*
+*  @brief     sourcemip0Ŝdestmip0(destX, destY)ɃRs[.
+*             J[eNX`݂̂ΏۂƂ܂.
+*
+*  @param[in] const gu::SharedPointer<core::GPUTexture>& Rs[̃eNX`
+*  @param[in] const gu::uint32 destX Rs[̍̃sNZʒu
+*  @param[in] const gu::uint32 destY Rs[̍̃sNZʒu
+*  @param[in] const gu::SharedPointer<core::GPUTexture>& Rs[̃eNX`
+
+*  @return @@void
+*****************************************************************************/
+void RHICommandList::CopyTextureRegion(const gu::SharedPointer<core::GPUTexture>& dest, const gu::uint32 destX, const gu::uint32 destY, const gu::SharedPointer<core::GPUTexture>& source)
+{
+	using enum core::ResourceState;
+
+	Check(dest && source && dest != source);
+	Check(dest->GetPixelFormat() == source->GetPixelFormat());
+	Check(destX + source->GetWidth() <= dest->GetWidth() && destY + source->GetHeight() <= dest->GetHeight());
+
+	gu::SharedPointer<core::GPUTexture> textures[] = { dest, source };
+	core::ResourceState befores[] = { dest->GetResourceState(), source->GetResourceState() };
+	core::ResourceState afters[]  = { CopyDestination, CopySource };
+
+	TransitionResourceStates(2, textures, afters);
+
+	/*-------------------------------------------------------------------
+	-           Copy mip 0 of the first array layer
+	---------------------------------------------------------------------*/
+	const VkImageCopy region =
+	{
+		.srcSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 },
+		.srcOffset      = { 0, 0, 0 },
+		.dstSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 },
+		.dstOffset      = { static_cast<std::int32_t>(destX), static_cast<std::int32_t>(destY), 0 },
+		.extent         = { static_cast<std::uint32_t>(source->GetWidth()), static_cast<std::uint32_t>(source->GetHeight()), 1 }
+	};
+
+	vkCmdCopyImage(_commandBuffer,
+		gu::StaticPointerCast<vulkan::GPUTexture>(source)->GetImage(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+		gu::StaticPointerCast<vulkan::GPUTexture>(dest)  ->GetImage(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+		1, &region);
+
+	TransitionResourceStates(2, textures, befores);
+}
+#pragma endregion Copy
+
 #pragma region Property
 void RHICommandList::SetName(const gu::tstring& name)
 {
@@ -20,6 +20,8 @@
 #include "../Include/VulkanSwapchain.hpp"
 #include "../Include/VulkanFrameBuffer.hpp"
 #include "../Include/VulkanResourceLayout.hpp"
+#include "../Include/VulkanMemoryAllocator.hpp"
+#include "../Include/VulkanEnumConverter.hpp"
 #include "GraphicsCore/RHI/Vulkan/PipelineState/Include/VulkanGPUPipelineState.hpp"
 #include "GraphicsCore/RHI/Vulkan/Resource/Include/VulkanGPUResourceView.hpp"
 #include "GraphicsCore/RHI/Vulkan/Resource/Include/VulkanGPUTexture.hpp"
@@ -89,6 +91,10 @@ void RHIDevice::Destroy()
 	if (_logicalDevice) 
 	{ 
 		vkDeviceWaitIdle(_logicalDevice);
+
+		// TuAP[^̃ubN͘_foCX̔jOɉ
+		if (_memoryAllocator) { _memoryAllocator.Reset(); }
+
 		vkDestroyDevice(_logicalDevice, nullptr); 
 		_logicalDevice = nullptr;
 	} // destroy logical device
@@ -106,6 +112,11 @@ void RHIDevice::SetUpDefaultHeap(const core::DefaultHeapCount& heapCount)
 	heapInfoList[core::DescriptorHeapType::UAV] = heapCount.UAVDescCount;
 	_defaultHeap = gu::MakeShared<vulkan::RHIDescriptorHeap>(SharedFromThis());
 	_defaultHeap->Resize(heapInfoList);
+
+	/*-------------------------------------------------------------------
+	-           GPŨTuAP[^
+	---------------------------------------------------------------------*/
+	_memoryAllocator = gu::StaticPointerCast<core::RHIMemoryAllocator>(gu::MakeShared<vulkan::RHIMemoryAllocator>(SharedFromThis()));
 }
 
 gu::SharedPointer<core::RHIFrameBuffer> RHIDevice::CreateFrameBuffer(const gu::SharedPointer<core::RHIRenderPass>& renderPass, const gu::DynamicArray<gu::SharedPointer<core::GPUTexture>>& renderTargets, const gu::SharedPointer<core::GPUTexture>& depthStencil)
@@ -605,6 +616,60 @@ std::uint32_t RHIDevice::GetMemoryTypeIndex(std::uint32_t requiredTypeBits, cons
 
 	throw std::runtime_error("failed to get memory type index");
 }
+
+/****************************************************************************
+*                     AllocateSubAllocatedMemory
+*************************************************************************//**
+*  @fn        core::MemoryAllocation RHIDevice::AllocateSubAllocatedMemory(const VkMemoryRequirements& requirement, const core::MemoryHeap heapType,
+			const core::MemoryResourceCategory category, const core::MemoryAllocationStrategy strategy)
+*
+*  @brief     AP[^̃v[烁͈͂mۂ܂.
+*             CPUMapUpload, Readback̃offset 0Map邽ߐp̂܂܂Ƃ܂.
+*
+*  @param[in] const VkMemoryRequirements& requirement
+*  @param[in] const core::MemoryHeap heapType
+*  @param[in] const core::MemoryResourceCategory category
+*  @param[in] const core::MemoryAllocationStrategy strategy
+*
+*  @return @@core::MemoryAllocation (v[łȂꍇ͖)
+*****************************************************************************/
+core::MemoryAllocation RHIDevice::AllocateSubAllocatedMemory(const VkMemoryRequirements& requirement, const core::MemoryHeap heapType,
+	const core::MemoryResourceCategory category, const core::MemoryAllocationStrategy strategy)
+{
+	if (!_memoryAllocator || heapType != core::MemoryHeap::Default) { return core::MemoryAllocation(); }
+
+	const core::MemoryAllocationDesc desc =
+	{
+		.ByteSize        = requirement.size,
+		.Alignment       = requirement.alignment,
+		.MemoryTypeIndex = GetMemoryTypeIndex(requirement.memoryTypeBits, EnumConverter::Convert(heapType)),
+		.HeapType        = heapType,
+		.Category        = category,
+		.Strategy        = strategy
+	};
+
+	return _memoryAllocator->Allocate(desc);
+}
+
+/****************************************************************************
+*                     FreeSubAllocatedMemory
+*************************************************************************//**
+*  @fn        void RHIDevice::FreeSubAllocatedMemory(core::MemoryAllocation& allocation)
+*
+*  @brief     AllocateSubAllocatedMemoryŊmۂ͈͂AP[^ɕԂ܂. 
+*             \[X (VkBuffer, VkImage) ͐ɔjĂĂ.
+*
+*  @param[in] core::MemoryAllocation& allocation
+*
+*  @return @@void
+*****************************************************************************/
+void RHIDevice::FreeSubAllocatedMemory(core::MemoryAllocation& allocation)
+{
+	if (!allocation.IsValid()) { return; }
+
+	if (_memoryAllocator) { _memoryAllocator->Free(allocation); }
+	allocation = core::MemoryAllocation();
+}
 #pragma endregion          Set Up Function
 #pragma region Property
 /****************************************************************************
@@ -331,6 +331,10 @@ VkFormat EnumConverter::Convert(const rhi::core::InputFormat inputFormat)
 		case core::InputFormat::R32G32B32A32_FLOAT: return VkFormat::VK_FORMAT_R32G32B32A32_SFLOAT;
 		case core::InputFormat::R32G32B32A32_INT  : return VkFormat::VK_FORMAT_R32G32B32A32_SINT;
 		case core::InputFormat::R32_FLOAT         : return VkFormat::VK_FORMAT_R32_SFLOAT;
+		case core::InputFormat::R16G16_FLOAT      : return VkFormat::VK_FORMAT_R16G16_SFLOAT;
+		case core::InputFormat::R16G16_SNORM      : return VkFormat::VK_FORMAT_R16G16_SNORM;
+		case core::InputFormat::R16G16B16A16_UINT : return VkFormat::VK_FORMAT_R16G16B16A16_UINT;
+		case core::InputFormat::R8G8B8A8_UNORM    : return VkFormat::VK_FORMAT_R8G8B8A8_UNORM;
 		default:
 			throw std::runtime_error("not supported input layout format type (vulkan api)");
 	}
@@ -48,4 +48,20 @@ RHIMemory::RHIMemory( const gu::SharedPointer<core::RHIDevice>& device, const co
 	}
 }
 
+RHIMemory::RHIMemory(const gu::SharedPointer<core::RHIDevice>& device, const core::MemoryHeap heapType,
+	const VkDeviceMemory memory, const std::uint64_t size)
+	: core::RHIMemory(device, heapType, size), _memory(memory)
+{
+
+}
+
+RHIMemory::~RHIMemory()
+{
+	if (_memory && _device)
+	{
+		vkFreeMemory(gu::StaticPointerCast<vulkan::RHIDevice>(_device)->GetDevice(), _memory, nullptr);
+		_memory = nullptr;
+	}
+}
+
 #pragma endregion Constructor and Destructor
\ No newline at end of file
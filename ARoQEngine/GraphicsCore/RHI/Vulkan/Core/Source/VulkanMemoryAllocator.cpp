@@ -0,0 +1,111 @@
+//////////////////////////////////////////////////////////////////////////////////
+///             @file   VulkanMemoryAllocator.cpp
+///             @brief  GPU memory sub-allocator (VkDeviceMemory blocks)
+///             @author Toide Yutaro
+///             @date   2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/VulkanMemoryAllocator.hpp"
+#include "../Include/VulkanMemory.hpp"
+#include "../Include/VulkanDevice.hpp"
+#include "../Include/VulkanAdapter.hpp"
+#include "../Include/VulkanEnumConverter.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::vulkan;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+RHIMemoryAllocator::RHIMemoryAllocator(const gu::SharedPointer<RHIDevice>& device)
+	: core::RHIMemoryAllocator(), _device(device)
+{
+	Check(_device);
+}
+
+RHIMemoryAllocator::~RHIMemoryAllocator()
+{
+	// Free the device memory before the device reference is dropped
+	ReleaseAll();
+	if (_device) { _device.Reset(); }
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Protected Function
+/****************************************************************************
+*                       CreateMemoryBlock
+*************************************************************************//**
+*  @fn        gu::SharedPointer<core::RHIMemory> RHIMemoryAllocator::CreateMemoryBlock(const core::MemoryPoolKey& key, const gu::uint64 byteSize)
+*
+*  @brief     Allocate the VkDeviceMemory for the pool. Return nullptr if the memory cannot be allocated.
+*
+*  @param[in] const core::MemoryPoolKey& key
+*  @param[in] const gu::uint64 byteSize
+*
+*  @return    gu::SharedPointer<core::RHIMemory>
+*****************************************************************************/
+gu::SharedPointer<core::RHIMemory> RHIMemoryAllocator::CreateMemoryBlock(const core::MemoryPoolKey& key, const gu::uint64 byteSize)
+{
+	const auto vkDevice = _device->GetDevice();
+	if (!vkDevice) { return nullptr; }
+
+	const VkMemoryAllocateInfo memoryInfo =
+	{
+		.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+		.pNext           = nullptr,
+		.allocationSize  = byteSize,
+		.memoryTypeIndex = key.MemoryTypeIndex
+	};
+
+	VkDeviceMemory memory = nullptr;
+	if (vkAllocateMemory(vkDevice, &memoryInfo, nullptr, &memory) != VK_SUCCESS)
+	{
+		return nullptr;
+	}
+
+	return gu::StaticPointerCast<core::RHIMemory>(gu::MakeShared<vulkan::RHIMemory>(gu::StaticPointerCast<core::RHIDevice>(_device), key.HeapType, memory, byteSize));
+}
+
+/****************************************************************************
+*                       QueryDeviceBudget
+*************************************************************************//**
+*  @fn        bool RHIMemoryAllocator::QueryDeviceBudget(const core::MemoryHeap heapType, gu::uint64& budget, gu::uint64& usage) const
+*
+*  @brief     Return the size of the largest memory heap which has the memory type for the heap type.
+*             The OS usage is unknown without VK_EXT_memory_budget, so usage is always 0.
+*
+*  @param[in]  const core::MemoryHeap heapType
+*  @param[out] gu::uint64& budget
+*  @param[out] gu::uint64& usage
+*
+*  @return    bool
+*****************************************************************************/
+bool RHIMemoryAllocator::QueryDeviceBudget(const core::MemoryHeap heapType, gu::uint64& budget, gu::uint64& usage) const
+{
+	const auto adapter = gu::StaticPointerCast<vulkan::RHIDisplayAdapter>(_device->GetDisplayAdapter());
+	if (!adapter) { return false; }
+
+	const auto memoryProperties = adapter->GetMemoryProperties();
+	const auto flags            = EnumConverter::Convert(heapType);
+
+	budget = 0;
+	usage  = 0;
+	for (std::uint32_t i = 0; i < memoryProperties.memoryTypeCount; ++i)
+	{
+		const auto& memoryType = memoryProperties.memoryTypes[i];
+		if ((memoryType.propertyFlags & flags) != flags) { continue; }
+
+		const gu::uint64 heapSize = memoryProperties.memoryHeaps[memoryType.heapIndex].size;
+		if (heapSize > budget) { budget = heapSize; }
+	}
+	return budget != 0;
+}
+#pragma endregion Protected Function
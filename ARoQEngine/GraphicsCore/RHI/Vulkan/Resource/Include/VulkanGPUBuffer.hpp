@@ -12,6 +12,7 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUBuffer.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIMemoryAllocator.hpp"
 #include <vulkan/vulkan.h>
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -55,6 +56,9 @@ namespace rhi::vulkan
 		*****************************************************************************/
 		VkBuffer GetBuffer() const noexcept { return _buffer; }
 
+		// VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BITw肵ĂȂ, foCXAhX͎擾Ȃ
+		gu::uint64 GetGPUVirtualAddress() const noexcept override { return 0; }
+
 		void SetName(const gu::tstring& name) override;
 
 		/****************************************************************************
@@ -83,6 +87,9 @@ namespace rhi::vulkan
 
 		VkBuffer       _buffer = nullptr;
 
+		// AP[^̃v[ɔzuꂽꍇ͈̔ (̏ꍇ_memorynullptr)
+		core::MemoryAllocation _allocation = {};
+
 		// GPUANZXłȂɃRs[sߒԃobt@
 		VkBuffer _stagingBuffer = nullptr;
 
@@ -91,7 +98,7 @@ namespace rhi::vulkan
 		std::uint8_t* _stagingMappedData = nullptr;
 	
 	private:
-		void Prepare(VkBuffer& buffer, VkDeviceMemory& memory, VkMemoryPropertyFlags flags);
+		void Prepare(VkBuffer& buffer, VkDeviceMemory& memory, VkMemoryPropertyFlags flags, core::MemoryAllocation* allocation = nullptr);
 	};
 
 
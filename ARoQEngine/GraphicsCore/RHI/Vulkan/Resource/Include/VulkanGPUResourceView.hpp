@@ -36,6 +36,9 @@ namespace rhi::vulkan
 		**                Public Function
 		*****************************************************************************/
 		void Bind(const gu::SharedPointer<core::RHICommandList>& commandList, const std::uint32_t index, const gu::SharedPointer<core::RHIResourceLayout>& layout = nullptr) override;
+
+		// descriptorSlot is not used because the descriptor set is written in each Bind
+		void SetBufferRange(const gu::SharedPointer<core::GPUBuffer>& buffer, const gu::uint64 byteOffset, const gu::uint64 byteSize, const gu::uint32 descriptorSlot = 0) override;
 		
 		/****************************************************************************
 		**                Public Member Variables
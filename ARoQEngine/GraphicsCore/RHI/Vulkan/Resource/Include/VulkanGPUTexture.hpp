@@ -12,6 +12,7 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUTexture.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIMemoryAllocator.hpp"
 #include <vulkan/vulkan.h>
 #include <string>
 //////////////////////////////////////////////////////////////////////////////////
@@ -93,6 +94,9 @@ namespace rhi::vulkan
 
 		VkImage        _image     = nullptr;
 
+		// AP[^̃v[ɔzuꂽꍇ͈̔ (̏ꍇ_memorynullptr)
+		core::MemoryAllocation _allocation = {};
+
 		VkImageViewCreateInfo  _imageViewDesc = {};
 
 		gu::SharedPointer<core::GPUBuffer> _stagingBuffer = nullptr;
@@ -11,6 +11,7 @@
 #include "../Include/VulkanGPUBuffer.hpp"
 #include "../../Core/Include/VulkanEnumConverter.hpp"
 #include "../../Core/Include/VulkanDevice.hpp"
+#include "../../Core/Include/VulkanMemory.hpp"
 #include "../../Core/Include/VulkanAdapter.hpp"
 #include "../../Core/Include/VulkanInstance.hpp"
 #include "../../Core/Include/VulkanCommandList.hpp"
@@ -33,7 +34,7 @@ GPUBuffer::GPUBuffer(const gu::SharedPointer<core::RHIDevice>& device, const cor
 #ifdef _DEBUG
 	assert(device);
 #endif
-	Prepare(_buffer, _memory, EnumConverter::Convert(_metaData.HeapType));
+	Prepare(_buffer, _memory, EnumConverter::Convert(_metaData.HeapType), &_allocation);
 	SetName(name);
 }
 
@@ -44,6 +45,12 @@ GPUBuffer::~GPUBuffer()
 	if (_memory)             { vkFreeMemory(vkDevice, _memory, nullptr); }
 	if (_stagingBuffer) { vkDestroyBuffer(vkDevice, _stagingBuffer, nullptr); }
 	if (_buffer) { vkDestroyBuffer(vkDevice, _buffer, nullptr); }
+
+	// obt@jɃv[͈֔͂Ԃ
+	if (_allocation.IsValid())
+	{
+		gu::StaticPointerCast<vulkan::RHIDevice>(_device)->FreeSubAllocatedMemory(_allocation);
+	}
 }
 
 #pragma endregion Constructor and Destructor
@@ -219,14 +226,19 @@ void GPUBuffer::SetName(const gu::tstring& name)
 *  @fn        void GPUBuffer::Prepare()
 * 
 *  @brief     Create Buffer and Bind buffer memory
+*             allocationw肳ꂽꍇ, Defaultq[ṽ̓AP[^̃v[ɔzu܂.
 * 
-*  @param[in] void
+*  @param[out] VkBuffer& buffer
+*  @param[out] VkDeviceMemory& memory (v[ɔzuꂽꍇnullptr)
+*  @param[in]  VkMemoryPropertyFlags flags
+*  @param[out] core::MemoryAllocation* allocation
 * 
 *  @return @@void
 *****************************************************************************/
-void GPUBuffer::Prepare(VkBuffer& buffer, VkDeviceMemory& memory, VkMemoryPropertyFlags flags)
+void GPUBuffer::Prepare(VkBuffer& buffer, VkDeviceMemory& memory, VkMemoryPropertyFlags flags, core::MemoryAllocation* allocation)
 {
-	VkDevice vkDevice = gu::StaticPointerCast<vulkan::RHIDevice>(_device)->GetDevice();
+	const auto vkRHIDevice = gu::StaticPointerCast<vulkan::RHIDevice>(_device);
+	VkDevice   vkDevice    = vkRHIDevice->GetDevice();
 
 	/*-------------------------------------------------------------------
 	-           Create Buffer
@@ -254,13 +266,30 @@ void GPUBuffer::Prepare(VkBuffer& buffer, VkDeviceMemory& memory, VkMemoryProper
 	VkMemoryRequirements memoryRequirement = {};
 	vkGetBufferMemoryRequirements(vkDevice, buffer, &memoryRequirement);
 
+	/*-------------------------------------------------------------------
+	-           Place the buffer in the pooled memory
+	---------------------------------------------------------------------*/
+	if (allocation)
+	{
+		*allocation = vkRHIDevice->AllocateSubAllocatedMemory(memoryRequirement, _metaData.HeapType, core::MemoryResourceCategory::Buffer);
+		if (allocation->IsValid())
+		{
+			const auto pooledMemory = static_cast<vulkan::RHIMemory*>(allocation->Memory)->GetMemory();
+			if (vkBindBufferMemory(vkDevice, buffer, pooledMemory, allocation->Offset) != VK_SUCCESS)
+			{
+				throw std::runtime_error("failed to bind buffer memory. (vulkan api)");
+			}
+			memory = nullptr;
+			return;
+		}
+	}
+
 	const VkMemoryAllocateInfo memoryInfo = 
 	{
 		.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
 		.pNext           = nullptr,
 		.allocationSize  = memoryRequirement.size,
-		.memoryTypeIndex = gu::StaticPointerCast<vulkan::RHIDevice>(_device)
-		->GetMemoryTypeIndex(memoryRequirement.memoryTypeBits, flags)
+		.memoryTypeIndex = vkRHIDevice->GetMemoryTypeIndex(memoryRequirement.memoryTypeBits, flags)
 	};
 	
 	/*-------------------------------------------------------------------
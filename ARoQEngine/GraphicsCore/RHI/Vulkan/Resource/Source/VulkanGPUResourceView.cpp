@@ -56,7 +56,9 @@ GPUResourceView::GPUResourceView(const gu::SharedPointer<core::RHIDevice>& devic
 	_buffer  = buffer;
 	_texture = nullptr;
 	SelectDescriptorHeap(type);
-	CreateView();
+
+	// obt@ꍇSetBufferRangeŌォݒ肷
+	if (_buffer) { CreateView(); }
 	
 }
 GPUResourceView::GPUResourceView(const gu::SharedPointer<core::RHIDevice>& device, const core::ResourceViewType type, const gu::SharedPointer<core::GPUTexture>& texture, 
@@ -148,8 +150,8 @@ void GPUResourceView::Bind(const gu::SharedPointer<core::RHICommandList>& comman
 		const VkDescriptorBufferInfo bufferInfo = 
 		{
 			.buffer = vkBuffer->GetBuffer(),
-			.offset = 0,
-			.range  = vkBuffer->GetTotalByteSize()
+			.offset = _bufferOffset,
+			.range  = _bufferByteSize != 0 ? _bufferByteSize : vkBuffer->GetTotalByteSize()
 		};
 		
 		writeDesc.pBufferInfo = &bufferInfo;
@@ -164,6 +166,32 @@ void GPUResourceView::Bind(const gu::SharedPointer<core::RHICommandList>& comman
 	---------------------------------------------------------------------*/
 	vkUpdateDescriptorSets(vkDevice->GetDevice(), 1, &writeDesc, 0, nullptr);
 }
+/****************************************************************************
+*                     SetBufferRange
+*************************************************************************//**
+*  @fn        void GPUResourceView::SetBufferRange(const gu::SharedPointer<core::GPUBuffer>& buffer, const gu::uint64 byteOffset, const gu::uint64 byteSize, const gu::uint32 descriptorSlot)
+*
+*  @brief     萔obt@r[wobt@͈̔͂ύX܂. BindŃfBXNv^Zbgɏ܂܂.
+*
+*  @param[in] const gu::SharedPointer<core::GPUBuffer>& buffer
+*  @param[in] const gu::uint64 byteOffset (minUniformBufferOffsetAlignmentȏ̃ACg)
+*  @param[in] const gu::uint64 byteSize
+*  @param[in] const gu::uint32 descriptorSlot (gp)
+*
+*  @return @@void
+*****************************************************************************/
+void GPUResourceView::SetBufferRange(const gu::SharedPointer<core::GPUBuffer>& buffer, const gu::uint64 byteOffset, const gu::uint64 byteSize, [[maybe_unused]] const gu::uint32 descriptorSlot)
+{
+#ifdef _DEBUG
+	assert(buffer);
+	assert(_resourceViewType == core::ResourceViewType::ConstantBuffer);
+#endif
+
+	_buffer                 = buffer;
+	_bufferOffset           = byteOffset;
+	_bufferByteSize         = byteSize;
+	_calledCreateBufferView = true;
+}
 #pragma endregion Bind Function
 #pragma region Prepare View Function 
 /****************************************************************************
@@ -12,6 +12,7 @@
 #include "../Include/VulkanGPUBuffer.hpp"
 #include "../../Core/Include/VulkanEnumConverter.hpp"
 #include "../../Core/Include/VulkanDevice.hpp"
+#include "../../Core/Include/VulkanMemory.hpp"
 #include "../../Core/Include/VulkanAdapter.hpp"
 #include "../../Core/Include/VulkanInstance.hpp"
 #include "../../Core/Include/VulkanCommandList.hpp"
@@ -82,6 +83,12 @@ GPUTexture::~GPUTexture()
 		vkFreeMemory(vkDevice, _memory, nullptr);
 		vkDestroyImage(vkDevice, _image, nullptr);
 	}
+	else if (_allocation.IsValid())
+	{
+		// C[WjɃv[͈֔͂Ԃ
+		vkDestroyImage(vkDevice, _image, nullptr);
+		gu::StaticPointerCast<vulkan::RHIDevice>(_device)->FreeSubAllocatedMemory(_allocation);
+	}
 }
 #pragma endregion Constructor and Destructor
 
@@ -260,6 +267,29 @@ void GPUTexture::Prepare()
 	VkMemoryRequirements memoryRequirement = {};
 	vkGetImageMemoryRequirements(vkDevice, _image, &memoryRequirement);
 
+	/*-------------------------------------------------------------------
+	-       Place the image in the pooled memory (Default heap only)
+	---------------------------------------------------------------------*/
+	{
+		const bool isRenderTarget = gu::HasAnyFlags(_metaData.ResourceUsage, core::ResourceUsage::RenderTarget) ||
+			gu::HasAnyFlags(_metaData.ResourceUsage, core::ResourceUsage::DepthStencil);
+
+		_allocation = gu::StaticPointerCast<vulkan::RHIDevice>(_device)->AllocateSubAllocatedMemory(memoryRequirement, _metaData.HeapType,
+			isRenderTarget ? core::MemoryResourceCategory::RenderTargetTexture : core::MemoryResourceCategory::Texture,
+			isRenderTarget ? core::MemoryAllocationStrategy::RenderTarget     : core::MemoryAllocationStrategy::General);
+
+		if (_allocation.IsValid())
+		{
+			const auto pooledMemory = static_cast<vulkan::RHIMemory*>(_allocation.Memory)->GetMemory();
+			if (vkBindImageMemory(vkDevice, _image, pooledMemory, _allocation.Offset) != VK_SUCCESS)
+			{
+				throw std::runtime_error("failed to bind image memory");
+			}
+			_memory = nullptr;
+			return;
+		}
+	}
+
 	/*-------------------------------------------------------------------
 	-               Set Memory Allocate
 	---------------------------------------------------------------------*/
@@ -34,8 +34,8 @@ public:
 	**                Public Function
 	*****************************************************************************/
 	void GameStart(const engine::setting::StartUpParameters& parameters);
-	void GameUpdateMain();
-	void GameDrawMain();
+	void GameUpdateMain(engine::core::RenderSnapshot& snapshot);
+	void GameDrawMain  (const engine::core::RenderSnapshot& snapshot);
 	void GameEnd();
 
 	/****************************************************************************
@@ -43,6 +43,7 @@ public:
 	*****************************************************************************/
 	gu::SharedPointer<PPPEngine> GetEngine() const { return _engine; }
 	gu::SharedPointer<LowLevelGraphicsEngine> GetGraphicsEngine() { return _engine->GetLowLevelGraphics(); }
+	bool UseRenderSnapshot() const { return _sceneManager.UseRenderSnapshot(); }
 	/****************************************************************************
 	**                Constructor and Destructor
 	*****************************************************************************/
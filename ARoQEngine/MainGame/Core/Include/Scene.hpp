@@ -41,9 +41,19 @@ public:
 	virtual void Update   ();
 	virtual void Draw     () = 0;
 	virtual void Terminate() = 0;
+
+	/* @brief : Called after Update. Write the data Draw reads into the snapshot.*/
+	virtual void WriteRenderSnapshot([[maybe_unused]] engine::core::RenderSnapshot& snapshot) {};
 	/****************************************************************************
 	**                Public Member Variables
 	*****************************************************************************/
+	/* @brief : Return true when Draw reads only the render snapshot and the resources not changed by Update.
+	            Then the render thread draws this frame while the next frame is updated.
+	            Otherwise the engine waits for the render before every update.*/
+	virtual bool UseRenderSnapshot() const { return false; }
+
+	/* @brief : Set by the scene manager during Draw*/
+	void SetRenderSnapshot(const engine::core::RenderSnapshot* snapshot) noexcept { _renderSnapshot = snapshot; }
 
 	/****************************************************************************
 	**                Constructor and Destructor
@@ -71,6 +81,9 @@ protected:
 	/* @brief: Game timer : Calculate the deltaTime and total time*/
 	GameTimerPtr _gameTimer  = nullptr;
 
+	/* @brief : Snapshot of the frame being drawn (only valid in Draw)*/
+	const engine::core::RenderSnapshot* _renderSnapshot = nullptr;
+
 	// !note! these variables must be called at the place of the end of update function.
 	bool _hasExecutedSceneTransition = false;
 	bool _hasExecutedBackScene       = false;
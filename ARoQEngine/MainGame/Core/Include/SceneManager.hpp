@@ -44,8 +44,8 @@ public:
 	void StartUp(PPPEnginePtr& engine, const GameTimerPtr& gameTimer);
 	void TransitScene(ScenePtr scene);
 	void CallSceneInitialize(const GameTimerPtr& gameTimer);
-	void CallSceneUpdate();
-	void CallSceneDraw();
+	void CallSceneUpdate(engine::core::RenderSnapshot& snapshot);
+	void CallSceneDraw  (const engine::core::RenderSnapshot& snapshot);
 	void CallSceneTerminate();
 	void PushScene(ScenePtr scene);
 	void PopScene();
@@ -53,6 +53,8 @@ public:
 	/****************************************************************************
 	**                Public Member Variables
 	*****************************************************************************/
+	/* @brief : Whether the current scene draws only from the render snapshot (can overlap with the next update)*/
+	bool UseRenderSnapshot() const;
 
 	/****************************************************************************
 	**                Constructor and Destructor
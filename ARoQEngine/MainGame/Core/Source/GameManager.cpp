@@ -27,14 +27,14 @@ void GameManager::GameStart(const engine::setting::StartUpParameters& parameters
 	_engine->Run();
 }
 
-void GameManager::GameUpdateMain()
+void GameManager::GameUpdateMain(engine::core::RenderSnapshot& snapshot)
 {
-	_sceneManager.CallSceneUpdate();
+	_sceneManager.CallSceneUpdate(snapshot);
 }
 
-void GameManager::GameDrawMain()
+void GameManager::GameDrawMain(const engine::core::RenderSnapshot& snapshot)
 {
-	_sceneManager.CallSceneDraw();
+	_sceneManager.CallSceneDraw(snapshot);
 }
 
 void GameManager::GameEnd()
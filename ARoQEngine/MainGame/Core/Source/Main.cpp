@@ -29,6 +29,7 @@
 #include "GameUtility/Base/Include/GUCommandLine.hpp"
 #include "GameUtility/Base/Include/GUParse.hpp"
 #include "GameUtility/Math/Include/GMVector.hpp"
+#include "GameUtility/Memory/Include/GUMemoryTracker.hpp"
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
@@ -65,6 +66,25 @@
 
     gu::CommandLine::SetUp(argument.CString());
 
+    /*---------------------------------------------------------------
+                gbLO̊Jn (Nォv܂)
+                -MemoryTracking        : ^Oʂ̏WvƏĨ[N
+                -MemoryStackSample=N   : N1R[X^bNL^
+                -MemoryTrace           : MemoryTrace.gumtɃoCig[Xo
+    -----------------------------------------------------------------*/
+#if GU_MEMORY_TRACKING_ENABLED
+    if (gu::Parse::Contains(gu::CommandLine::Get(), SP("-MemoryTracking")))
+    {
+        gu::MemoryTrackerSetting setting = {};
+        gu::Parse::Value(gu::CommandLine::Get(), SP("-MemoryStackSample="), setting.StackSampleRate);
+        if (gu::Parse::Contains(gu::CommandLine::Get(), SP("-MemoryTrace")))
+        {
+            setting.TraceFilePath = SP("MemoryTrace.gumt");
+        }
+        gu::MemoryTracker::Instance().Enable(setting);
+    }
+#endif
+
     /********************************************
     **         Initialize
     *********************************************/
@@ -80,6 +100,13 @@
     /********************************************
     **         Check MemoryLeaks
     *********************************************/
+#if GU_MEMORY_TRACKING_ENABLED
+    if (gu::MemoryTracker::IsTracking())
+    {
+        gu::MemoryTracker::Instance().ReportLiveAllocations(stdout);
+        gu::MemoryTracker::Instance().Disable();
+    }
+#endif
 
     exit(EXIT_SUCCESS);
 }
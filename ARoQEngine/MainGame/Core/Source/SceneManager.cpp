@@ -20,6 +20,8 @@
 #include "MainGame/Sample/Include/SampleSky.hpp"
 #include "MainGame/Sample/Include/SampleCollisionDetection.hpp"
 #include "GameUtility/Base/Include/GUAssert.hpp"
+#include "GameUtility/Base/Include/GUProfiler.hpp"
+#include "GameUtility/Memory/Include/GUMemoryTracker.hpp"
 
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -53,6 +55,9 @@ void SceneManager::TransitScene(ScenePtr scene)
 {
 	if (!scene) { return; }
 
+	// `XbhV[`悵I܂ő҂
+	_engine->GetFramePipeline()->Flush();
+
 	CallSceneTerminate();
 	_currentScene.pop();
 	_currentScene.emplace(std::move(scene));
@@ -64,25 +69,65 @@ void SceneManager::CallSceneInitialize( const GameTimerPtr& gameTimer)
 	if (_currentScene.empty()) { return; }
 	_currentScene.top()->Initialize(_engine, gameTimer);
 }
-void SceneManager::CallSceneUpdate()
+/****************************************************************************
+*                       CallSceneUpdate
+*************************************************************************//**
+*  @fn        void SceneManager::CallSceneUpdate(engine::core::RenderSnapshot& snapshot)
+*  @brief     V[XV, `Xe[Wǂރf[^XibvVbgɏ݂܂
+*  @param[in] engine::core::RenderSnapshot& snapshot
+*  @return @@void
+*****************************************************************************/
+void SceneManager::CallSceneUpdate(engine::core::RenderSnapshot& snapshot)
 {
+	// t[̊Jn (vt@C)
+	GU_PROFILE_BEGIN_FRAME();
+	GU_PROFILE_SCOPE("Scene Update");
+
+	snapshot.DeltaTime = _gameTimer->DeltaTime();
+	snapshot.TotalTime = _gameTimer->TotalTime();
+
 	_currentScene.top()->Update();
+	_currentScene.top()->WriteRenderSnapshot(snapshot);
 }
-void SceneManager::CallSceneDraw()
+
+/****************************************************************************
+*                       CallSceneDraw
+*************************************************************************//**
+*  @fn        void SceneManager::CallSceneDraw(const engine::core::RenderSnapshot& snapshot)
+*  @brief     `XbhĂ΂܂. V[̓XibvVbg̓eŕ`悵܂
+*  @param[in] const engine::core::RenderSnapshot& snapshot
+*  @return @@void
+*****************************************************************************/
+void SceneManager::CallSceneDraw(const engine::core::RenderSnapshot& snapshot)
 {
-	_currentScene.top()->Draw();
+	{
+		GU_PROFILE_SCOPE("Scene Draw");
+		_currentScene.top()->SetRenderSnapshot(&snapshot);
+		_currentScene.top()->Draw();
+		_currentScene.top()->SetRenderSnapshot(nullptr);
+	}
+
+	// t[̏I. eXbȟvʂWv܂
+	GU_PROFILE_END_FRAME();
+	GU_MEMORY_END_FRAME();
 }
 void SceneManager::CallSceneTerminate()
 {
 	if (_currentScene.empty()) { return; }
 	_currentScene.top()->Terminate();
 }
+bool SceneManager::UseRenderSnapshot() const
+{
+	return !_currentScene.empty() && _currentScene.top()->UseRenderSnapshot();
+}
 void SceneManager::PushScene(ScenePtr scene)
 {
+	if (_engine) { _engine->GetFramePipeline()->Flush(); }
 	_currentScene.emplace(scene);
 }
 void SceneManager::PopScene()
 {
+	if (_engine) { _engine->GetFramePipeline()->Flush(); }
 	_currentScene.pop();
 }
 /****************************************************************************
@@ -30,6 +30,7 @@ namespace gc::ui
 {
 	class Font;
 	class Text;
+	class TextLayoutCache;
 	class UIRenderer;
 }
 namespace sample
@@ -46,6 +47,7 @@ namespace sample
 		using UIRendererPtr = gu::SharedPointer<gc::ui::UIRenderer>;
 		using TextPtr       = gu::SharedPointer<gc::ui::Text>;
 		using FontPtr       = gu::SharedPointer<gc::ui::Font>;
+		using TextLayoutCachePtr = gu::SharedPointer<gc::ui::TextLayoutCache>;
 		using GPUResourceCachePtr = gu::SharedPointer<rhi::core::GPUResourceCache>;
 		using GPUResourceViewPtr = gu::SharedPointer<rhi::core::GPUResourceView>;
 	public:
@@ -80,6 +82,7 @@ namespace sample
 		UIRendererPtr _renderer = nullptr;
 		TextPtr       _text     = nullptr;
 		FontPtr       _font     = nullptr;
+		TextLayoutCachePtr _layoutCache = nullptr;
 		GPUResourceCachePtr _resourceCache = nullptr;
 		GPUResourceViewPtr _resourceView = nullptr;
 	};
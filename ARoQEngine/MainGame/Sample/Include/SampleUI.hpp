@@ -33,6 +33,7 @@ namespace gc::ui
 	class Image;
 	class Font;
 	class UIRenderer;
+	class TextureAtlas;
 }
 namespace sample
 {
@@ -46,6 +47,7 @@ namespace sample
 	class SampleUI : public Scene
 	{
 		using UIRendererPtr       = gu::SharedPointer<gc::ui::UIRenderer>;
+		using TextureAtlasPtr     = gu::SharedPointer<gc::ui::TextureAtlas>;
 		using ImagePtr            = gu::SharedPointer<gc::ui::Image>;
 		using ButtonPtr           = gu::SharedPointer<gc::ui::Button>;
 		using SliderPtr           = gu::SharedPointer<gc::ui::Slider>;
@@ -60,9 +62,14 @@ namespace sample
 		void Update() override;
 		void Draw() override;
 		void Terminate() override;
+
+		/* @brief : Copy the ui rects into the snapshot. Draw reads only the snapshot.*/
+		void WriteRenderSnapshot(engine::core::RenderSnapshot& snapshot) override;
 		/****************************************************************************
 		**                Public Member Variables
 		*****************************************************************************/
+		/* @brief : The ui renderer is used only by Draw, so the render thread can draw while the next frame is updated.*/
+		bool UseRenderSnapshot() const override { return true; }
 
 		/****************************************************************************
 		**                Constructor and Destructor
@@ -83,6 +90,7 @@ namespace sample
 		**                Protected Member Variables
 		*****************************************************************************/
 		UIRendererPtr       _renderer      = nullptr;
+		TextureAtlasPtr     _textureAtlas  = nullptr;
 		GPUResourceCachePtr _resourceCache = nullptr;
 		GPUResourceViewPtr  _resourceView  = nullptr;
 
@@ -60,17 +60,13 @@ void SampleText::Update()
 
 	/*-------------------------------------------------------------------
 	-            Update Text Color
+	-     (ʒuƐF̕ύX̓CAEg, LbVꂽ_gp܂)
 	---------------------------------------------------------------------*/
-	StringInfo info = 
-	{   .String = "Text\nSample", .SizePerChar = {0.1f, 0.167f}, 
-		.StartPosition = {0.5f * cosf(_gameTimer->TotalTime()) - 0.5f, 0.5f * sinf(_gameTimer->TotalTime()), 1.0f},
-		.Space = {0.0f, 0.0f},
-		.Color = {sinf(_gameTimer->TotalTime()), cosf(_gameTimer->TotalTime()),1,1}
-	};
-	_text = gu::MakeShared<Text>(CoordinateType::NDC, _font, info);
+	_text->SetStartPosition({0.5f * cosf(_gameTimer->TotalTime()) - 0.5f, 0.5f * sinf(_gameTimer->TotalTime()), 1.0f});
+	_text->SetColor({sinf(_gameTimer->TotalTime()), cosf(_gameTimer->TotalTime()),1,1});
 
 	_renderer->Clear();
-	_renderer->AddFrameObjects(_text->GetTextImages(), _text->GetFontView());
+	_renderer->AddFrameText(*_text);
 }
 /****************************************************************************
 *                       Draw
@@ -108,6 +104,8 @@ void SampleText::Terminate()
 {
 	_resourceView.Reset();
 	_resourceCache.Reset();
+	_text.Reset();
+	_layoutCache.Reset();
 }
 #pragma endregion Public Function
 
@@ -134,9 +132,11 @@ void SampleText::LoadMaterials()
 	-             SetUp Resources
 	---------------------------------------------------------------------*/
 	_font = gu::MakeShared<Font>(_engine, SP("Resources/Font/GennokakuEnglish.png"), gm::Float2(35.0f, 64.0f), 3325.0f);
-	// Create image sprite
-	StringInfo info = { .String = "Text Sample", .SizePerChar = {0.1f, 0.15f}, .StartPosition = {-0.6f, 0.0f, 1.0f}, .Space = 0.0f, .Color = {1,1,1,1} };
-	_text = gu::MakeShared<Text>(CoordinateType::NDC, _font, info);
+	_layoutCache = gu::MakeShared<TextLayoutCache>(_font);
+
+	// Create cached text
+	StringInfo info = { .String = "Text\nSample", .SizePerChar = {0.1f, 0.167f}, .StartPosition = {-0.6f, 0.0f, 1.0f}, .Space = {0.0f, 0.0f}, .Color = {1,1,1,1} };
+	_text = gu::MakeShared<Text>(CoordinateType::NDC, _layoutCache, info);
 
 	// Create Texture
 	_resourceCache = gu::MakeShared<GPUResourceCache>(_engine->GetDevice(), graphicsCommandList);
@@ -10,6 +10,7 @@
 //////////////////////////////////////////////////////////////////////////////////
 #include "MainGame/Sample/Include/SampleUI.hpp"
 #include "GameCore/Rendering/UI/Public/Include/UIRenderer.hpp"
+#include "GameCore/Rendering/UI/Public/Include/UITextureAtlas.hpp"
 #include "GameCore/Rendering/UI/Public/Include/UIImage.hpp"
 #include "GameCore/Rendering/UI/Public/Include/UIButton.hpp"
 #include "GameCore/Rendering/UI/Public/Include/UISlider.hpp"
@@ -63,11 +64,20 @@ void SampleUI::Initialize(const PPPEnginePtr& engine, const GameTimerPtr& gameTi
 void SampleUI::Update()
 {
 	Scene::Update();
-
-	_renderer->Clear();
-	_renderer->AddFrameObjects({ *_button }, _resourceView);
-	_renderer->AddFrameObjects({ _slider->GetRenderResource(Slider::BackGround).Image }, _slider->GetRenderResource(Slider::BackGround).ResourceView);
-	_renderer->AddFrameObjects({ _slider->GetRenderResource(Slider::Color).Image }, _slider->GetRenderResource(Slider::Color).ResourceView);
+}
+/****************************************************************************
+*                       WriteRenderSnapshot
+*************************************************************************//**
+*  @fn        void SampleUI::WriteRenderSnapshot(engine::core::RenderSnapshot& snapshot)
+*  @brief     Copy the ui rects of this frame into the snapshot
+*  @param[out] engine::core::RenderSnapshot& snapshot
+*  @return @@void
+*****************************************************************************/
+void SampleUI::WriteRenderSnapshot(engine::core::RenderSnapshot& snapshot)
+{
+	snapshot.UI.AddImages({ *_button }, _resourceView);
+	snapshot.UI.AddImages({ _slider->GetRenderResource(Slider::BackGround).Image }, _slider->GetRenderResource(Slider::BackGround).ResourceView);
+	snapshot.UI.AddImages({ _slider->GetRenderResource(Slider::Color).Image }, _slider->GetRenderResource(Slider::Color).ResourceView, 1); // wȉɕ`悷
 }
 /****************************************************************************
 *                       Draw
@@ -89,6 +99,13 @@ void SampleUI::Draw()
 		core::Viewport   (0, 0, (float)Screen::GetScreenWidth(), (float)Screen::GetScreenHeight()),
 		core::ScissorRect(0, 0, (long) Screen::GetScreenWidth(), (long) Screen::GetScreenHeight()));
 
+	// XVXe[W񂾃XibvVbgUI`悷
+	_renderer->Clear();
+	const auto& ui = _renderSnapshot->UI;
+	for (const auto& range : ui.Ranges)
+	{
+		_renderer->AddFrameVertices(&ui.Vertices[(gu::uint64)range.ImageStart * 4], range.ImageCount, range.View, range.Layer);
+	}
 	_renderer->Draw();
 
 	_engine->EndDrawFrame();
@@ -104,6 +121,7 @@ void SampleUI::Draw()
 void SampleUI::Terminate()
 {
 	_resourceView.Reset();
+	_textureAtlas.Reset();
 	_resourceCache.Reset();
 }
 #pragma endregion Public Function
@@ -154,6 +172,13 @@ void SampleUI::LoadMaterials()
 	// Create UI Renderer
 	_renderer = gu::MakeShared<gc::ui::UIRenderer>(_engine);
 
+	// UĨeNX`1̃AgXɂ܂Ƃ, `񐔂炷
+	_textureAtlas = gu::MakeShared<gc::ui::TextureAtlas>(_engine);
+	_textureAtlas->Add(_resourceView, graphicsCommandList);
+	_textureAtlas->Add(_slider->GetRenderResource(Slider::BackGround).ResourceView, graphicsCommandList);
+	_textureAtlas->Add(_slider->GetRenderResource(Slider::Color).ResourceView     , graphicsCommandList);
+	_renderer->SetTextureAtlas(_textureAtlas);
+
 	/*-------------------------------------------------------------------
 	-             Close Copy CommandList and Flush CommandQueue
 	---------------------------------------------------------------------*/
@@ -88,6 +88,7 @@ void SampleURP::Update()
 		.IsUse      = true
 	};
 	_renderer->SetLight<DirectionalLightData>(LightType::Directional, 0, directionalLight);
+	_renderer->SetLODView(gc::core::LODView::Perspective(_camera->GetPosition3f(), _camera->GetFovVertical(), (float)Screen::GetScreenHeight()));
 }
 
 /****************************************************************************
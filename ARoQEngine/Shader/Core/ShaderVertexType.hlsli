@@ -16,6 +16,17 @@ struct VSInputVertex
     float2 UV       : TEXCOORD;
 };
 
+#ifdef USE_COMPRESSED_VERTEX
+// gm::CompressedSkinMeshVertex (octahedral normal : R16G16_SNORM, uv : R16G16_FLOAT, weight : R8G8B8A8_UNORM)
+struct VSInputSkinVertex
+{
+    float4 Position : POSITION;
+    float2 Normal   : NORMAL;
+    float2 UV       : TEXCOORD;
+    uint4 BoneNo    : BONE_NO;
+    float4 Weight   : WEIGHT;
+};
+#else
 struct VSInputSkinVertex
 {
     float4 Position : POSITION;
@@ -25,6 +36,26 @@ struct VSInputSkinVertex
     float4 Weight   : WEIGHT;
     
 };
+#endif
+
+// Octahedral normal [-1, 1]^2 -> unit vector (same as gm::VectorPack::DecodeOctahedralNormalStream)
+float3 DecodeOctahedralNormal(float2 encoded)
+{
+    float3 normal = float3(encoded, 1.0f - abs(encoded.x) - abs(encoded.y));
+    const float fold = saturate(-normal.z);
+    normal.xy -= fold * (step(0.0f, normal.xy) * 2.0f - 1.0f); // x >= 0 : -fold, x < 0 : +fold
+    return normalize(normal);
+}
+
+// Normal of the skin vertex. w is 1 like the R32G32B32_FLOAT input of the full format.
+float4 GetVertexNormal(VSInputSkinVertex vertexIn)
+{
+#ifdef USE_COMPRESSED_VERTEX
+    return float4(DecodeOctahedralNormal(vertexIn.Normal), 1.0f);
+#else
+    return vertexIn.Normal;
+#endif
+}
 
 // VSOutput
 struct VSOutputVertex
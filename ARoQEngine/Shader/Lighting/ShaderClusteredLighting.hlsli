@@ -0,0 +1,56 @@
+//////////////////////////////////////////////////////////////////////////////////
+//              Title:  ShaderClusteredLighting.hlsli
+//            Content:  Cluster lookup of the lights binned on the CPU (gc::basepass::ClusteredLightCulling)
+//                      uint2 range = GetLightClusterRange(input.Position.xy, viewZ);
+//                      point lights : LightClusterIndices[range.x + i], i < (range.y & 0xFFFF)
+//                      spot  lights : LightClusterIndices[range.x + (range.y & 0xFFFF) + i], i < (range.y >> 16)
+//             Author:  Toide Yutaro
+//             Create:  2026_10_19
+//////////////////////////////////////////////////////////////////////////////////
+#ifndef SHADER_CLUSTERED_LIGHTING_HLSLI
+#define SHADER_CLUSTERED_LIGHTING_HLSLI
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Define
+//////////////////////////////////////////////////////////////////////////////////
+#ifndef LIGHT_CLUSTER_INFO_REGISTER
+#define LIGHT_CLUSTER_INFO_REGISTER b6
+#endif
+
+#ifndef LIGHT_CLUSTER_RANGE_REGISTER
+#define LIGHT_CLUSTER_RANGE_REGISTER t8
+#endif
+
+#ifndef LIGHT_CLUSTER_INDEX_REGISTER
+#define LIGHT_CLUSTER_INDEX_REGISTER t9
+#endif
+
+// 32 bytes
+cbuffer LightClusterInfo : register(LIGHT_CLUSTER_INFO_REGISTER)
+{
+    uint3  ClusterCount;      // x : screen tiles (left to right), y : screen tiles (top to bottom), z : depth slices
+    float  ClusterDepthScale; // slice = log(viewZ) * ClusterDepthScale + ClusterDepthBias
+    float  ClusterDepthBias;
+    float2 ClusterTileScale;  // ClusterCount.xy / screen size
+    float  ClusterPadding;
+}
+
+// x : offset in LightClusterIndices, y : point light count | spot light count << 16
+StructuredBuffer<uint2> LightClusterRanges  : register(LIGHT_CLUSTER_RANGE_REGISTER);
+StructuredBuffer<uint>  LightClusterIndices : register(LIGHT_CLUSTER_INDEX_REGISTER);
+
+uint GetLightClusterIndex(float2 pixelPosition, float viewZ)
+{
+    uint2 tile  = min(uint2(pixelPosition * ClusterTileScale), ClusterCount.xy - 1);
+    uint  slice = uint(clamp(floor(log(max(viewZ, 1e-6f)) * ClusterDepthScale + ClusterDepthBias), 0.0f, float(ClusterCount.z - 1)));
+    return (slice * ClusterCount.y + tile.y) * ClusterCount.x + tile.x;
+}
+
+uint2 GetLightClusterRange(float2 pixelPosition, float viewZ)
+{
+    return LightClusterRanges[GetLightClusterIndex(pixelPosition, viewZ)];
+}
+#endif
@@ -43,7 +43,7 @@ PSIn VSMain( VSInputSkinVertex vertexIn )
 	---------------------------------------------------------------------*/
 	float4 positionWorld = mul(World, vertexIn.Position);
 	result.Position      = mul(ProjectionView, positionWorld);
-	result.WorldNormal   = normalize(mul(World, vertexIn.Normal).xyz);
+	result.WorldNormal   = normalize(mul(World, GetVertexNormal(vertexIn)).xyz);
 	result.UV            = vertexIn.UV;
 	return result;
 }
@@ -45,7 +45,7 @@ PSInput VSMain( VSInputSkinVertex vertexIn)
 	---------------------------------------------------------------------*/
 	float4 positionWorld = mul(World, vertexIn.Position);
 	result.Position      = mul(ProjectionView, positionWorld);
-	result.WorldNormal   = mul(World, vertexIn.Normal);
+	result.WorldNormal   = mul(World, GetVertexNormal(vertexIn));
 	result.ViewNormal    = mul(View, result.WorldNormal);
 	result.UV            = vertexIn.UV;
 	